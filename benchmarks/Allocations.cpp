@@ -0,0 +1,66 @@
+#include "Allocations.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+namespace {
+std::atomic<uint64_t> allocations_{0};
+
+#if defined(__GLIBC__)
+// mallinfo only reports on the main arena, so all threads have to allocate from it. This runs
+// before main, so before any thread is started.
+[[maybe_unused]] const int oneArena = mallopt(M_ARENA_MAX, 1);
+#endif
+}
+
+namespace bench {
+uint64_t
+allocations()
+{
+        return allocations_.load(std::memory_order_relaxed);
+}
+
+uint64_t
+heapBytes()
+{
+        // Large blocks are mapped separately and not part of the arena.
+#if defined(__GLIBC__) && __GLIBC_PREREQ(2, 33)
+        const auto info = mallinfo2();
+        return info.uordblks + info.hblkhd;
+#elif defined(__GLIBC__)
+        const auto info = mallinfo();
+        return static_cast<unsigned>(info.uordblks) + static_cast<unsigned>(info.hblkhd);
+#else
+        return 0;
+#endif
+}
+}
+
+// Counts and forwards to malloc, like the default operator new, which the array and nothrow
+// versions call.
+void *
+operator new(std::size_t size)
+{
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+
+        if (void *p = std::malloc(size ? size : 1))
+                return p;
+        throw std::bad_alloc();
+}
+
+void
+operator delete(void *p) noexcept
+{
+        std::free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+        std::free(p);
+}
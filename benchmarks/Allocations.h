@@ -0,0 +1,15 @@
+#pragma once
+
+#include <cstdint>
+
+namespace bench {
+//! The heap allocations with operator new so far, by all threads. The benchmarks, which report
+//! allocations, count the ones of their timed code, including those of worker threads running
+//! meanwhile.
+uint64_t
+allocations();
+//! The bytes in use on the heap, allocated by any thread with malloc, which the Qt containers use,
+//! or operator new. Only known with glibc, elsewhere it is 0.
+uint64_t
+heapBytes();
+}
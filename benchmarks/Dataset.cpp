@@ -0,0 +1,47 @@
+#include "Dataset.h"
+
+#include <utility>
+
+#include "Cache.h"
+#include "Cache_p.h"
+#include "SyncGenerator.h"
+
+namespace {
+//! The rooms and messages of the loaded dataset or -1, if the cache holds something else.
+std::pair<int, int> loaded_{-1, -1};
+}
+
+namespace bench {
+void
+resetCache()
+{
+        if (cache::client())
+                cache::deleteData();
+
+        cache::init(LOCAL_USER);
+        cache::setCurrentFormat();
+
+        loaded_ = {-1, -1};
+}
+
+void
+loadDataset(int rooms, int messages)
+{
+        if (loaded_ == std::make_pair(rooms, messages))
+                return;
+
+        resetCache();
+
+        const auto raw      = initialSync(rooms, messages);
+        const auto response = parse(raw);
+        cache::saveInitialState(response.sync, response.summaries, raw, {});
+
+        loaded_ = {rooms, messages};
+}
+
+SyncResponse
+parse(const nlohmann::json &response)
+{
+        return response.get<SyncResponse>();
+}
+}
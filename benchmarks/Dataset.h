@@ -0,0 +1,23 @@
+#pragma once
+
+#include <nlohmann/json.hpp>
+
+#include "CacheStructs.h"
+
+//! The cache of the benchmarks. It lives in the cache directory of the benchmark application,
+//! which is separate from the one of nheko, and is deleted, when the benchmarks finish.
+namespace bench {
+//! Replace the cache with an empty one of the local user.
+void
+resetCache();
+
+//! Make the cache hold the initial sync of the given number of rooms with the given number of
+//! messages each. The cache is only rebuilt, if another dataset was loaded in between, so the
+//! benchmarks of a dataset share it.
+void
+loadDataset(int rooms, int messages = 50);
+
+//! Parse a generated response, like the sync callback does.
+SyncResponse
+parse(const nlohmann::json &response);
+}
@@ -0,0 +1,276 @@
+#include "SyncGenerator.h"
+
+#include <algorithm>
+#include <cstdint>
+
+using nlohmann::json;
+
+namespace {
+//! The users, the members of all rooms are drawn from, so rooms share members.
+constexpr int USER_POOL = 5000;
+//! The members listed in the summary of a room without a name.
+constexpr int HEROES = 5;
+
+constexpr int64_t FIRST_TS = 1600000000000;
+
+const char *const WORDS[] = {"the",     "meeting", "is",     "moved", "to",       "tomorrow",
+                             "please",  "review",  "my",     "patch", "build",    "fails",
+                             "on",      "arm64",   "thanks", "lunch", "anyone",   "deploy",
+                             "release", "notes",   "fixed",  "bug",   "👍",       "🎉",
+                             "ok",      "see",     "https://example.org/issue", "later"};
+
+int64_t
+timestamp(int batch, int index)
+{
+        return FIRST_TS + int64_t{batch} * 100000000 + int64_t{index} * 1000;
+}
+
+std::string
+eventId(int room, int batch, int index)
+{
+        return "$" + std::to_string(room) + "_" + std::to_string(batch) + "_" +
+               std::to_string(index) + ":example.org";
+}
+
+//! The member of a room with the given number. The first member is the local user.
+std::string
+member(int room, int index)
+{
+        if (index == 0)
+                return bench::LOCAL_USER;
+
+        return bench::userId((room * 37 + index) % USER_POOL);
+}
+
+//! A text of some words, between short chat lines and paragraphs.
+std::string
+text(int seed)
+{
+        const int words = 3 + (seed * 7) % 40;
+
+        std::string body;
+        for (int i = 0; i < words; i++) {
+                if (i > 0)
+                        body += ' ';
+                body += WORDS[(seed + i * 13) % std::size(WORDS)];
+        }
+        return body;
+}
+
+json
+stateEvent(const std::string &type,
+           const std::string &state_key,
+           const std::string &sender,
+           const std::string &event_id,
+           json content)
+{
+        return {{"type", type},
+                {"state_key", state_key},
+                {"sender", sender},
+                {"event_id", event_id},
+                {"origin_server_ts", FIRST_TS},
+                {"content", std::move(content)}};
+}
+
+json
+roomState(int room)
+{
+        const auto creator = member(room, 0);
+        const auto prefix  = "$state" + std::to_string(room) + "_";
+
+        json events = json::array();
+        events.push_back(stateEvent(
+          "m.room.create", "", creator, prefix + "create", {{"creator", creator}}));
+        events.push_back(stateEvent("m.room.power_levels",
+                                    "",
+                                    creator,
+                                    prefix + "power_levels",
+                                    {{"users", {{creator, 100}}}, {"users_default", 0}}));
+        events.push_back(stateEvent("m.room.join_rules",
+                                    "",
+                                    creator,
+                                    prefix + "join_rules",
+                                    {{"join_rule", "invite"}}));
+        if (room % 3 != 0)
+                events.push_back(stateEvent("m.room.name",
+                                            "",
+                                            creator,
+                                            prefix + "name",
+                                            {{"name", "Room " + std::to_string(room)}}));
+
+        const int members = bench::memberCount(room);
+        for (int i = 0; i < members; i++) {
+                const auto user = member(room, i);
+                json content    = {{"membership", "join"},
+                                {"displayname", "User " + user.substr(1, user.find(':') - 1)}};
+                if (i % 2 == 0)
+                        content["avatar_url"] = "mxc://example.org/" + std::to_string(i);
+
+                events.push_back(stateEvent("m.room.member",
+                                            user,
+                                            user,
+                                            prefix + "member" + std::to_string(i),
+                                            std::move(content)));
+        }
+
+        return events;
+}
+
+json
+summary(int room)
+{
+        const int members = bench::memberCount(room);
+
+        json summary = {{"m.joined_member_count", members}, {"m.invited_member_count", 0}};
+        if (room % 3 == 0) {
+                json heroes = json::array();
+                for (int i = 1; i < std::min(members, HEROES + 1); i++)
+                        heroes.push_back(member(room, i));
+                summary["m.heroes"] = std::move(heroes);
+        }
+        return summary;
+}
+
+json
+joinedRoom(int room, int messages, int batch, bool withState)
+{
+        json timeline = json::array();
+        for (int i = 0; i < messages; i++)
+                timeline.push_back(bench::message(room, batch, i));
+
+        return {{"state", {{"events", withState ? roomState(room) : json::array()}}},
+                {"timeline",
+                 {{"events", std::move(timeline)},
+                  {"limited", withState},
+                  {"prev_batch", "p" + std::to_string(batch)}}},
+                {"ephemeral", {{"events", json::array()}}},
+                {"account_data", {{"events", json::array()}}},
+                {"unread_notifications", {{"highlight_count", 0}, {"notification_count", 0}}},
+                {"summary", withState ? summary(room) : json::object()}};
+}
+
+json
+sync(int rooms, int messages, int batch, bool withState)
+{
+        json join = json::object();
+        for (int room = 0; room < rooms; room++)
+                join[bench::roomId(room)] = joinedRoom(room, messages, batch, withState);
+
+        return {{"next_batch", "s" + std::to_string(batch)},
+                {"rooms",
+                 {{"join", std::move(join)},
+                  {"invite", json::object()},
+                  {"leave", json::object()}}},
+                {"account_data", {{"events", json::array()}}},
+                {"presence", {{"events", json::array()}}},
+                {"to_device", {{"events", json::array()}}},
+                {"device_lists", {{"changed", json::array()}, {"left", json::array()}}},
+                {"device_one_time_keys_count", json::object()}};
+}
+}
+
+namespace bench {
+std::string
+roomId(int room)
+{
+        return "!room" + std::to_string(room) + ":example.org";
+}
+
+std::string
+userId(int user)
+{
+        return "@user" + std::to_string(user) + ":example.org";
+}
+
+int
+memberCount(int room)
+{
+        if (room % 100 == 0)
+                return 2000;
+        if (room % 10 == 0)
+                return 300;
+        return 2 + room % 30;
+}
+
+json
+message(int room, int batch, int index)
+{
+        const auto seed   = room * 31 + batch * 17 + index;
+        const auto sender = member(room, index % memberCount(room));
+
+        json event = {{"event_id", eventId(room, batch, index)},
+                      {"sender", sender},
+                      {"origin_server_ts", timestamp(batch, index)},
+                      {"type", "m.room.message"}};
+
+        switch (index % 20) {
+        case 5:
+                event["content"] = {{"msgtype", "m.notice"}, {"body", text(seed)}};
+                break;
+        case 9:
+                event["content"] = {{"msgtype", "m.emote"}, {"body", text(seed)}};
+                break;
+        case 13:
+                event["content"] = {
+                  {"msgtype", "m.image"},
+                  {"body", "image.png"},
+                  {"url", "mxc://example.org/image" + std::to_string(seed)},
+                  {"info", {{"w", 800}, {"h", 600}, {"mimetype", "image/png"}, {"size", 81920}}}};
+                break;
+        case 17:
+                event["content"] = {{"msgtype", "m.file"},
+                                    {"body", "report.pdf"},
+                                    {"url", "mxc://example.org/file" + std::to_string(seed)},
+                                    {"info", {{"mimetype", "application/pdf"}, {"size", 4096}}}};
+                break;
+        case 19:
+                event["type"]      = "m.room.topic";
+                event["state_key"] = "";
+                event["content"]   = {{"topic", text(seed)}};
+                break;
+        default: {
+                const auto body  = text(seed);
+                event["content"] = {{"msgtype", "m.text"}, {"body", body}};
+                if (index % 4 == 0) {
+                        event["content"]["format"]         = "org.matrix.custom.html";
+                        event["content"]["formatted_body"] = "<b>" + body + "</b>";
+                }
+                break;
+        }
+        }
+
+        return event;
+}
+
+json
+redaction(int room, int batch, int index)
+{
+        return {{"event_id", "$redaction" + eventId(room, batch, index).substr(1)},
+                {"sender", member(room, 0)},
+                {"origin_server_ts", timestamp(batch, index) + 1},
+                {"type", "m.room.redaction"},
+                {"redacts", eventId(room, batch, index)},
+                {"content", json::object()}};
+}
+
+json
+receipt(int room, int batch, int index)
+{
+        return {{"type", "m.receipt"},
+                {"content",
+                 {{eventId(room, batch, index),
+                   {{"m.read", {{member(room, 1), {{"ts", timestamp(batch, index) + 2}}}}}}}}}};
+}
+
+json
+initialSync(int rooms, int messages)
+{
+        return sync(rooms, messages, 0, true);
+}
+
+json
+incrementalSync(int rooms, int messages, int batch)
+{
+        return sync(rooms, messages, batch, false);
+}
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <string>
+
+#include <nlohmann/json.hpp>
+
+//! Synthetic sync responses, as the server sends them, for the benchmarks. The same arguments
+//! always give the same response, so runs can be compared.
+namespace bench {
+//! The user, who is logged in.
+constexpr auto LOCAL_USER = "@bench:example.org";
+
+//! The id of the room with the given number.
+std::string
+roomId(int room);
+//! The id of the user with the given number.
+std::string
+userId(int user);
+
+//! The members of a room, like on a real account: most rooms are small, every tenth room has
+//! hundreds of members and every hundredth thousands.
+int
+memberCount(int room);
+
+//! A message of a room, whose type depends on the index: mostly text, also notices, emotes,
+//! images, files and topic changes. The ids differ for each batch.
+nlohmann::json
+message(int room, int batch, int index);
+//! The redaction of the message with the given batch and index.
+nlohmann::json
+redaction(int room, int batch, int index);
+//! The read receipt of another member of the room for the message with the given batch and
+//! index, as an ephemeral event.
+nlohmann::json
+receipt(int room, int batch, int index);
+
+//! The response of the initial sync with the given number of rooms, each with its state and the
+//! given number of messages. A third of the rooms has no name and is named by its heroes.
+nlohmann::json
+initialSync(int rooms, int messages);
+//! A later sync with the given number of new messages in each of the given rooms. batch numbers
+//! the syncs, so their events don't repeat the ones of earlier syncs.
+nlohmann::json
+incrementalSync(int rooms, int messages, int batch);
+}
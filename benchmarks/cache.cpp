@@ -0,0 +1,218 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <QString>
+
+#include "Cache.h"
+#include "Dataset.h"
+#include "SyncGenerator.h"
+
+namespace {
+//! The messages of every room in the initial sync.
+constexpr int MESSAGES = 50;
+//! Like Cache.cpp, a room is trimmed, once it has more than three times as many messages.
+constexpr int MAX_RESTORED_MESSAGES = 30'000;
+
+//! The first room always has thousands of members.
+const std::string LARGE_ROOM = bench::roomId(0);
+const std::string SMALL_ROOM = bench::roomId(1);
+
+//! The number of a new sync on the loaded dataset. The benchmarks run several times and share
+//! the dataset, so their syncs must not repeat the events of earlier ones.
+int
+nextBatch()
+{
+        static int batch = 1;
+        return batch++;
+}
+
+void
+datasets(benchmark::internal::Benchmark *b)
+{
+        b->ArgName("rooms")->Arg(10)->Arg(100)->Arg(1000);
+}
+
+//! A sync with a few new messages in some rooms: in ten, like most syncs while nheko is open, or
+//! in every room, like the first sync after a night offline.
+void
+BM_SaveState(benchmark::State &state)
+{
+        bench::loadDataset(state.range(0), MESSAGES);
+
+        const int rooms = state.range(1);
+        for (auto _ : state) {
+                state.PauseTiming();
+                const auto response = bench::parse(bench::incrementalSync(rooms, 5, nextBatch()));
+                state.ResumeTiming();
+
+                cache::saveState(response.sync, response.summaries);
+        }
+
+        state.SetItemsProcessed(state.iterations() * rooms * 5);
+}
+BENCHMARK(BM_SaveState)
+  ->ArgNames({"rooms", "synced"})
+  ->Args({10, 10})
+  ->Args({100, 10})
+  ->Args({1000, 10})
+  ->Args({1000, 1000})
+  ->Unit(benchmark::kMillisecond);
+
+//! A sync with a new message of the local user in each of 1000 rooms, which waits for its read
+//! receipt, and receipts for the message in the given number of rooms.
+void
+BM_PendingReceipts(benchmark::State &state)
+{
+        constexpr int ROOMS = 1000;
+
+        bench::loadDataset(ROOMS, MESSAGES);
+
+        // The first message of a room is the one of the local user.
+        const int read = state.range(0);
+        for (auto _ : state) {
+                state.PauseTiming();
+                const int batch = nextBatch();
+                auto sync       = bench::incrementalSync(ROOMS, 1, batch);
+                for (int room = 0; room < ROOMS; room++) {
+                        const auto room_id = bench::roomId(room);
+                        cache::addPendingReceipt(
+                          QString::fromStdString(room_id),
+                          QString::fromStdString(
+                            bench::message(room, batch, 0)["event_id"].get<std::string>()));
+
+                        if (room < read)
+                                sync["rooms"]["join"][room_id]["ephemeral"]["events"].push_back(
+                                  bench::receipt(room, batch, 0));
+                }
+                const auto response = bench::parse(sync);
+                state.ResumeTiming();
+
+                cache::saveState(response.sync, response.summaries);
+        }
+
+        state.SetItemsProcessed(state.iterations() * ROOMS);
+}
+BENCHMARK(BM_PendingReceipts)
+  ->ArgName("read")
+  ->Arg(10)
+  ->Arg(100)
+  ->Arg(1000)
+  ->Unit(benchmark::kMillisecond);
+
+void
+BM_GetRoomInfo(benchmark::State &state)
+{
+        bench::loadDataset(state.range(0), MESSAGES);
+
+        std::vector<std::string> rooms;
+        for (int room = 0; room < state.range(0); room++)
+                rooms.push_back(bench::roomId(room));
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(cache::getRoomInfo(rooms));
+
+        state.SetItemsProcessed(state.iterations() * rooms.size());
+}
+BENCHMARK(BM_GetRoomInfo)->Apply(datasets)->Unit(benchmark::kMicrosecond);
+
+void
+BM_RoomInfo(benchmark::State &state)
+{
+        bench::loadDataset(state.range(0), MESSAGES);
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(cache::roomInfo());
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RoomInfo)->Apply(datasets)->Unit(benchmark::kMicrosecond);
+
+//! A page of messages, from the newest one, as when a room is opened, and from the middle of
+//! the stored ones, as when scrolling up.
+void
+BM_GetTimelineMessages(benchmark::State &state)
+{
+        bench::loadDataset(state.range(0), MESSAGES);
+
+        const std::string before =
+          state.range(1) ? bench::message(1, 0, MESSAGES / 2)["event_id"].get<std::string>() : "";
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(cache::getTimelineMessages(SMALL_ROOM, before, 20));
+
+        state.SetItemsProcessed(state.iterations() * 20);
+}
+BENCHMARK(BM_GetTimelineMessages)
+  ->ArgNames({"rooms", "paged"})
+  ->ArgsProduct({{10, 100, 1000}, {0, 1}})
+  ->Unit(benchmark::kMicrosecond);
+
+//! The completion of a mention in the room with thousands of members.
+void
+BM_SearchUsers(benchmark::State &state)
+{
+        bench::loadDataset(state.range(0), MESSAGES);
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(cache::searchUsers(LARGE_ROOM, "user12"));
+}
+BENCHMARK(BM_SearchUsers)->Apply(datasets)->Unit(benchmark::kMicrosecond);
+
+//! The first page of the member list and one far down of the room with thousands of members.
+void
+BM_GetMembers(benchmark::State &state)
+{
+        bench::loadDataset(state.range(0), MESSAGES);
+
+        const std::size_t start = state.range(1) ? 1500 : 0;
+        for (auto _ : state)
+                benchmark::DoNotOptimize(cache::getMembers(LARGE_ROOM, start, 30));
+
+        state.SetItemsProcessed(state.iterations() * 30);
+}
+BENCHMARK(BM_GetMembers)
+  ->ArgNames({"rooms", "paged"})
+  ->ArgsProduct({{10, 100, 1000}, {0, 1}})
+  ->Unit(benchmark::kMicrosecond);
+
+//! The check on every start, when no room has to be trimmed.
+void
+BM_DeleteOldMessages(benchmark::State &state)
+{
+        bench::loadDataset(state.range(0), MESSAGES);
+
+        for (auto _ : state)
+                cache::deleteOldMessages();
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_DeleteOldMessages)->Apply(datasets)->Unit(benchmark::kMicrosecond);
+
+//! Trimming a room, which has grown past its quota, down to it.
+void
+BM_DeleteOldMessagesTrim(benchmark::State &state)
+{
+        constexpr int OVER_QUOTA = 3 * MAX_RESTORED_MESSAGES + 1;
+        constexpr int CHUNK      = 10'000;
+
+        int batch = 1;
+        for (auto _ : state) {
+                state.PauseTiming();
+                bench::resetCache();
+                for (int saved = 0; saved < OVER_QUOTA; saved += CHUNK) {
+                        const auto response = bench::parse(
+                          bench::incrementalSync(1, std::min(CHUNK, OVER_QUOTA - saved), batch++));
+                        cache::saveState(response.sync, response.summaries);
+                }
+                state.ResumeTiming();
+
+                cache::deleteOldMessages();
+        }
+
+        state.SetItemsProcessed(state.iterations() * (OVER_QUOTA - MAX_RESTORED_MESSAGES));
+}
+BENCHMARK(BM_DeleteOldMessagesTrim)->Iterations(3)->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,171 @@
+#include <benchmark/benchmark.h>
+
+#include <cstdlib>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "CacheCompression.h"
+
+using nlohmann::json;
+
+namespace {
+//! How often every sample event is stored, with another id, like in a busy room.
+constexpr int COPIES = 200;
+
+//! Every that many events of the sample events are held out to train the dictionary on, the
+//! others are measured.
+constexpr std::size_t TRAINING_STRIDE = 3;
+
+//! The stored values of the messages: the events of NHEKO_BENCHMARK_EVENTS, a JSON array of
+//! events, e.g. exported from a cache, or the bundled ones. Either the events, which train the
+//! dictionary, or the others.
+std::vector<json>
+load(bool training)
+{
+        const char *path = std::getenv("NHEKO_BENCHMARK_EVENTS");
+        std::ifstream file(path ? path : NHEKO_BENCHMARK_DATA "/events.json");
+        const auto all = json::parse(file);
+
+        std::vector<json> events;
+        for (std::size_t i = 0; i < all.size(); i++)
+                if ((i % TRAINING_STRIDE == 0) == training)
+                        events.push_back(all[i]);
+
+        std::vector<json> values;
+        for (int copy = 0; copy < COPIES; copy++) {
+                for (auto event : events) {
+                        event["event_id"] = event.value("event_id", "") + std::to_string(copy);
+                        event["origin_server_ts"] =
+                          event.value("origin_server_ts", int64_t{0}) + copy * 1000;
+                        values.push_back({{"event", std::move(event)},
+                                          {"token", "t" + std::to_string(copy)}});
+                }
+        }
+        return values;
+}
+
+//! The measured values, which the dictionary wasn't trained on.
+const std::vector<json> &
+samples()
+{
+        static const auto values = load(false);
+        return values;
+}
+
+//! The CBOR encoding of the values, as encodeValue stores them.
+const std::vector<std::string> &
+encoded()
+{
+        static const auto values = [] {
+                std::vector<std::string> values;
+                for (const auto &value : samples()) {
+                        const auto bytes = json::to_cbor(value);
+                        values.emplace_back(bytes.begin(), bytes.end());
+                }
+                return values;
+        }();
+
+        return values;
+}
+
+//! Use the dictionary trained on the held out events, if the first argument is 1.
+void
+useDictionary(const benchmark::State &state)
+{
+        static const auto trained = compression::train(load(true));
+
+        compression::setEnabled(true);
+        compression::setDictionary(state.range(0) ? trained : std::string());
+}
+
+void
+BM_Compress(benchmark::State &state)
+{
+        useDictionary(state);
+
+        std::size_t in = 0, out = 0;
+        for (auto _ : state) {
+                for (const auto &value : encoded()) {
+                        auto compressed = compression::compress(value);
+                        in += value.size();
+                        out += compressed.size();
+                        benchmark::DoNotOptimize(compressed);
+                }
+        }
+
+        state.SetItemsProcessed(state.iterations() * encoded().size());
+        state.SetBytesProcessed(in);
+        state.counters["ratio"] = static_cast<double>(out) / in;
+}
+BENCHMARK(BM_Compress)->ArgName("dictionary")->Arg(0)->Arg(1);
+
+void
+BM_Decompress(benchmark::State &state)
+{
+        useDictionary(state);
+
+        std::vector<std::string> compressed;
+        for (const auto &value : encoded())
+                compressed.push_back(compression::compress(value));
+
+        std::size_t out = 0;
+        for (auto _ : state) {
+                for (const auto &value : compressed) {
+                        auto decompressed = compression::isCompressed(value)
+                                              ? compression::decompress(value)
+                                              : std::optional<std::string>(value);
+                        if (!decompressed) {
+                                state.SkipWithError("failed to decompress a sample");
+                                return;
+                        }
+                        out += decompressed->size();
+                        benchmark::DoNotOptimize(decompressed);
+                }
+        }
+
+        state.SetItemsProcessed(state.iterations() * compressed.size());
+        state.SetBytesProcessed(out);
+}
+BENCHMARK(BM_Decompress)->ArgName("dictionary")->Arg(0)->Arg(1);
+
+//! What reading an uncompressed message costs, the baseline of BM_DecompressAndParse.
+void
+BM_Parse(benchmark::State &state)
+{
+        for (auto _ : state)
+                for (const auto &value : encoded())
+                        benchmark::DoNotOptimize(json::from_cbor(value));
+
+        state.SetItemsProcessed(state.iterations() * encoded().size());
+}
+BENCHMARK(BM_Parse);
+
+//! What reading a compressed message costs in total, decompressing and parsing it.
+void
+BM_DecompressAndParse(benchmark::State &state)
+{
+        useDictionary(state);
+
+        std::vector<std::string> compressed;
+        for (const auto &value : encoded())
+                compressed.push_back(compression::compress(value));
+
+        for (auto _ : state) {
+                for (const auto &value : compressed) {
+                        const auto bytes = compression::isCompressed(value)
+                                             ? *compression::decompress(value)
+                                             : value;
+                        benchmark::DoNotOptimize(json::from_cbor(bytes));
+                }
+        }
+
+        state.SetItemsProcessed(state.iterations() * compressed.size());
+}
+BENCHMARK(BM_DecompressAndParse)->ArgName("dictionary")->Arg(0)->Arg(1);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,406 @@
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <mtx/events/encrypted.hpp>
+#include <mtxclient/crypto/client.hpp>
+#include <nlohmann/json.hpp>
+
+#include "Cache.h"
+#include "Dataset.h"
+#include "Olm.h"
+#include "SyncGenerator.h"
+#include "timeline/TimelineModel.h"
+
+using nlohmann::json;
+
+namespace {
+constexpr auto DEVICE_ID   = "BENCHDEVICE";
+constexpr auto ROOM        = "!crypto:example.org";
+constexpr auto MEGOLM_ALGO = "m.megolm.v1.aes-sha2";
+
+//! The account of the local user, created once. The cache has to be set up, before the account
+//! is used, because handling the olm messages saves it.
+void
+createAccount()
+{
+        static const bool created = [] {
+                olm::client()->set_user_id(bench::LOCAL_USER);
+                olm::client()->set_device_id(DEVICE_ID);
+                olm::client()->create_new_account();
+                return true;
+        }();
+        (void)created;
+}
+
+//! A new megolm session of the local user, as it is shared with the room.
+struct MegolmSession
+{
+        mtx::crypto::OutboundGroupSessionPtr outbound;
+        OutboundGroupSessionData data;
+
+        MegolmSessionIndex index() const
+        {
+                return {ROOM, data.session_id, olm::client()->identity_keys().curve25519};
+        }
+        json payload() const
+        {
+                return {{"algorithm", MEGOLM_ALGO},
+                        {"room_id", ROOM},
+                        {"session_id", data.session_id},
+                        {"session_key", data.session_key}};
+        }
+};
+
+MegolmSession
+newMegolmSession()
+{
+        MegolmSession session;
+        session.outbound         = olm::client()->init_outbound_group_session();
+        session.data.session_id  = mtx::crypto::session_id(session.outbound.get());
+        session.data.session_key = mtx::crypto::session_key(session.outbound.get());
+        return session;
+}
+
+//! The json of a message event with a body of the given size, as it is encrypted.
+std::string
+plaintext(int size)
+{
+        return json{{"type", "m.room.message"},
+                    {"room_id", ROOM},
+                    {"content", {{"msgtype", "m.text"}, {"body", std::string(size, 'x')}}}}
+          .dump();
+}
+
+void
+messageSizes(benchmark::internal::Benchmark *b)
+{
+        b->ArgName("bytes")->Arg(100)->Arg(1 << 10)->Arg(16 << 10)->Arg(64 << 10);
+}
+
+//! The megolm decryption itself, at different message sizes.
+void
+BM_MegolmDecrypt(benchmark::State &state)
+{
+        bench::resetCache();
+        createAccount();
+
+        const auto session = newMegolmSession();
+        const auto inbound = olm::client()->init_inbound_group_session(session.data.session_key);
+
+        const auto message = plaintext(state.range(0));
+        const auto encrypted =
+          olm::client()->encrypt_group_message(session.outbound.get(), message);
+        const std::string ciphertext(encrypted.begin(), encrypted.end());
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(
+                  olm::client()->decrypt_group_message(inbound.get(), ciphertext));
+
+        state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_MegolmDecrypt)->Apply(messageSizes);
+
+//! Decrypting a new event of the timeline: looking up the session, decrypting, and keeping and
+//! indexing the plaintext.
+void
+BM_DecryptAndKeep(benchmark::State &state)
+{
+        bench::resetCache();
+        createAccount();
+
+        auto session = newMegolmSession();
+        cache::saveInboundMegolmSession(
+          session.index(), olm::client()->init_inbound_group_session(session.data.session_key));
+
+        const auto message = plaintext(state.range(0));
+
+        int next = 0;
+        for (auto _ : state) {
+                state.PauseTiming();
+                const auto encrypted =
+                  olm::client()->encrypt_group_message(session.outbound.get(), message);
+
+                mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> event;
+                event.type               = mtx::events::EventType::RoomEncrypted;
+                event.event_id           = "$encrypted" + std::to_string(next++) + ":example.org";
+                event.room_id            = ROOM;
+                event.sender             = bench::LOCAL_USER;
+                event.origin_server_ts   = 1600000000000 + next;
+                event.content.algorithm  = MEGOLM_ALGO;
+                event.content.ciphertext = std::string(encrypted.begin(), encrypted.end());
+                event.content.device_id  = DEVICE_ID;
+                event.content.sender_key = olm::client()->identity_keys().curve25519;
+                event.content.session_id = session.data.session_id;
+                state.ResumeTiming();
+
+                benchmark::DoNotOptimize(TimelineModel::decryptAndKeep(ROOM, event));
+        }
+
+        state.SetBytesProcessed(state.iterations() * message.size());
+}
+BENCHMARK(BM_DecryptAndKeep)->Apply(messageSizes)->Unit(benchmark::kMicrosecond);
+
+//! A room message, which is encrypted with the megolm session of the room and advances its
+//! message index.
+void
+BM_EncryptGroupMessage(benchmark::State &state)
+{
+        bench::resetCache();
+        createAccount();
+
+        auto session = newMegolmSession();
+        cache::saveOutboundMegolmSession(ROOM, session.data, std::move(session.outbound));
+
+        const auto body = json::parse(plaintext(state.range(0)));
+        for (auto _ : state)
+                benchmark::DoNotOptimize(olm::encrypt_group_message(ROOM, DEVICE_ID, body));
+
+        state.SetBytesProcessed(state.iterations() * body.dump().size());
+}
+BENCHMARK(BM_EncryptGroupMessage)->Apply(messageSizes)->Unit(benchmark::kMicrosecond);
+
+//! Other devices, which open olm sessions with the local user or receive its room keys.
+struct RemoteDevice
+{
+        std::string user_id;
+        std::unique_ptr<mtx::crypto::OlmClient> client;
+        std::string one_time_key;
+};
+
+const std::vector<RemoteDevice> &
+remoteDevices(std::size_t count)
+{
+        static std::vector<RemoteDevice> devices;
+        while (devices.size() < count) {
+                RemoteDevice device;
+                device.user_id = bench::userId(devices.size());
+                device.client  = std::make_unique<mtx::crypto::OlmClient>();
+                device.client->set_user_id(device.user_id);
+                device.client->set_device_id("DEVICE" + std::to_string(devices.size()));
+                device.client->create_new_account();
+                device.client->generate_one_time_keys(1);
+                device.one_time_key =
+                  device.client->one_time_keys().curve25519.begin()->second;
+                devices.push_back(std::move(device));
+        }
+        return devices;
+}
+
+//! The room keys of new olm sessions, which other devices send in one sync: every message is
+//! an olm pre-key message for a new session with a one-time key of the account.
+void
+BM_PreKeyMessages(benchmark::State &state)
+{
+        bench::resetCache();
+        createAccount();
+
+        const std::size_t count = state.range(0);
+        const auto &devices     = remoteDevices(count);
+        const auto session      = newMegolmSession();
+        const auto our_keys     = olm::client()->identity_keys();
+
+        for (auto _ : state) {
+                state.PauseTiming();
+                olm::client()->mark_keys_as_published();
+                olm::client()->generate_one_time_keys(count);
+
+                std::vector<json> messages;
+                auto one_time_keys = olm::client()->one_time_keys().curve25519.begin();
+                for (std::size_t i = 0; i < count; i++, ++one_time_keys) {
+                        const auto &device = devices[i];
+                        auto olm_session   = device.client->create_outbound_session(
+                          our_keys.curve25519, one_time_keys->second);
+                        const auto room_key =
+                          device.client
+                            ->create_room_key_event(
+                              ::UserId(bench::LOCAL_USER), our_keys.ed25519, session.payload())
+                            .dump();
+
+                        messages.push_back(
+                          {{"type", "m.room.encrypted"},
+                           {"sender", device.user_id},
+                           {"content",
+                            device.client->create_olm_encrypted_content(
+                              olm_session.get(), room_key, our_keys.curve25519)}});
+                }
+                state.ResumeTiming();
+
+                olm::handle_to_device_messages(messages);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_PreKeyMessages)
+  ->ArgName("messages")
+  ->Arg(1)
+  ->Arg(10)
+  ->Arg(50)
+  ->Unit(benchmark::kMillisecond);
+
+//! Sharing a room key with the devices of the room, like handleClaimedKeys does for each of
+//! them: an olm session is created, the key encrypted with it and the session saved.
+void
+BM_ShareRoomKey(benchmark::State &state)
+{
+        bench::resetCache();
+        createAccount();
+
+        const std::size_t count = state.range(0);
+        const auto &devices     = remoteDevices(count);
+        const auto session      = newMegolmSession();
+
+        std::vector<std::string> room_keys;
+        for (std::size_t i = 0; i < count; i++) {
+                const auto &device = devices[i];
+                const auto ed25519 = device.client->identity_keys().ed25519;
+                room_keys.push_back(
+                  olm::client()
+                    ->create_room_key_event(::UserId(device.user_id), ed25519, session.payload())
+                    .dump());
+        }
+
+        for (auto _ : state) {
+                json messages = json::object();
+                for (std::size_t i = 0; i < count; i++) {
+                        const auto id_key = devices[i].client->identity_keys().curve25519;
+                        auto s =
+                          olm::client()->create_outbound_session(id_key, devices[i].one_time_key);
+
+                        messages[std::to_string(i)] = olm::client()->create_olm_encrypted_content(
+                          s.get(), room_keys[i], id_key);
+
+                        cache::saveOlmSession(id_key, std::move(s));
+                }
+                benchmark::DoNotOptimize(messages);
+        }
+
+        state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ShareRoomKey)
+  ->ArgName("devices")
+  ->Arg(10)
+  ->Arg(100)
+  ->Arg(1000)
+  ->Unit(benchmark::kMillisecond);
+
+//! Fill the crypto db with count inbound megolm sessions and an outbound session for every 100
+//! of them, as if they were received in as many rooms.
+std::vector<MegolmSessionIndex>
+saveSessions(int count)
+{
+        bench::resetCache();
+        createAccount();
+
+        const auto session = newMegolmSession();
+
+        std::vector<MegolmSessionIndex> indices;
+        std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>> chunk;
+        for (int i = 0; i < count; i++) {
+                MegolmSessionIndex index{bench::roomId(i / 100),
+                                         "session" + std::to_string(i),
+                                         bench::userId(i % 1000)};
+                indices.push_back(index);
+                chunk.emplace_back(
+                  index, olm::client()->init_inbound_group_session(session.data.session_key));
+
+                if (chunk.size() == 1000 || i == count - 1)
+                        cache::saveInboundMegolmSessions(std::exchange(chunk, {}));
+
+                if (i % 100 == 0) {
+                        auto outbound = newMegolmSession();
+                        cache::saveOutboundMegolmSession(
+                          bench::roomId(i / 100), outbound.data, std::move(outbound.outbound));
+                }
+        }
+        return indices;
+}
+
+void
+BM_RestoreSessions(benchmark::State &state)
+{
+        saveSessions(state.range(0));
+
+        // The outbound sessions restored by the first iteration are kept, the others parse and
+        // unpickle them again, but don't replace them.
+        for (auto _ : state)
+                cache::restoreSessions();
+
+        state.SetItemsProcessed(state.iterations() * state.range(0) / 100);
+}
+BENCHMARK(BM_RestoreSessions)
+  ->ArgName("sessions")
+  ->Arg(10'000)
+  ->Arg(100'000)
+  ->Iterations(5)
+  ->Unit(benchmark::kMillisecond);
+
+//! The inbound sessions, which restoreSessions leaves in the db, are unpickled on their first
+//! use.
+void
+BM_LoadInboundSessions(benchmark::State &state)
+{
+        const auto indices = saveSessions(state.range(0));
+
+        for (auto _ : state) {
+                state.PauseTiming();
+                cache::trimInboundMegolmSessions(0);
+                state.ResumeTiming();
+
+                for (std::size_t i = 0; i < indices.size(); i += 100)
+                        benchmark::DoNotOptimize(cache::getInboundMegolmSession(indices[i]));
+        }
+
+        state.SetItemsProcessed(state.iterations() * indices.size() / 100);
+}
+BENCHMARK(BM_LoadInboundSessions)
+  ->ArgName("sessions")
+  ->Arg(10'000)
+  ->Arg(100'000)
+  ->Iterations(5)
+  ->Unit(benchmark::kMillisecond);
+
+void
+BM_ExportSessionKeys(benchmark::State &state)
+{
+        saveSessions(state.range(0));
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(cache::exportSessionKeys());
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ExportSessionKeys)
+  ->ArgName("sessions")
+  ->Arg(10'000)
+  ->Arg(100'000)
+  ->Iterations(3)
+  ->Unit(benchmark::kMillisecond);
+
+//! Importing the exported sessions into an empty crypto db.
+void
+BM_ImportSessionKeys(benchmark::State &state)
+{
+        saveSessions(state.range(0));
+        const auto keys = cache::exportSessionKeys();
+
+        for (auto _ : state) {
+                state.PauseTiming();
+                bench::resetCache();
+                state.ResumeTiming();
+
+                cache::importSessionKeys(*keys);
+        }
+
+        state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ImportSessionKeys)
+  ->ArgName("sessions")
+  ->Arg(10'000)
+  ->Arg(100'000)
+  ->Iterations(3)
+  ->Unit(benchmark::kMillisecond);
+}
@@ -0,0 +1,83 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <QTemporaryDir>
+
+#include <lmdb++.h>
+
+#include "Cache_p.h"
+#include "SyncGenerator.h"
+
+namespace {
+//! The databases every room has, like in the cache.
+const char *const ROOM_DBS[] = {"/messages", "/event_index", "/state", "/members"};
+
+//! An environment of its own with the per room databases of an account with the given number of
+//! rooms, all of them opened and registered.
+struct RoomDatabases
+{
+        explicit RoomDatabases(int rooms)
+          : env(lmdb::env::create())
+        {
+                env.set_mapsize(256UL * 1024 * 1024);
+                env.set_max_dbs(8092);
+                env.open(dir.path().toStdString().c_str(), MDB_NOTLS);
+
+                auto txn          = lmdb::txn::begin(env);
+                const auto handle = txn.handle();
+                for (int room = 0; room < rooms; room++) {
+                        room_ids.push_back(bench::roomId(room));
+                        for (const auto suffix : ROOM_DBS) {
+                                const auto name = room_ids.back() + suffix;
+                                const auto db   = lmdb::dbi::open(txn, name.c_str(), MDB_CREATE);
+                                registry.opened(handle, name, db.handle());
+                        }
+                }
+                txn.commit();
+                registry.finished(handle, true);
+        }
+
+        QTemporaryDir dir;
+        lmdb::env env;
+        DbiRegistry registry;
+        std::vector<std::string> room_ids;
+};
+
+void
+rooms(benchmark::internal::Benchmark *b)
+{
+        b->ArgName("rooms")->Arg(10)->Arg(100)->Arg(1000);
+}
+
+//! The messages db of every room, opened by name like the getters did before the registry.
+void
+BM_DbiOpen(benchmark::State &state)
+{
+        RoomDatabases dbs(state.range(0));
+
+        auto txn = lmdb::txn::begin(dbs.env, nullptr, MDB_RDONLY);
+        for (auto _ : state)
+                for (const auto &room_id : dbs.room_ids)
+                        benchmark::DoNotOptimize(
+                          lmdb::dbi::open(txn, (room_id + "/messages").c_str()).handle());
+
+        state.SetItemsProcessed(state.iterations() * dbs.room_ids.size());
+}
+BENCHMARK(BM_DbiOpen)->Apply(rooms);
+
+//! The messages db of every room, looked up in the registry like openDb does.
+void
+BM_DbiRegistryFind(benchmark::State &state)
+{
+        RoomDatabases dbs(state.range(0));
+
+        for (auto _ : state)
+                for (const auto &room_id : dbs.room_ids)
+                        benchmark::DoNotOptimize(dbs.registry.find(room_id + "/messages"));
+
+        state.SetItemsProcessed(state.iterations() * dbs.room_ids.size());
+}
+BENCHMARK(BM_DbiRegistryFind)->Apply(rooms);
+}
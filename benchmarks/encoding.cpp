@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "CacheStructs.h"
+#include "Cache_p.h"
+#include "SyncGenerator.h"
+
+using nlohmann::json;
+
+namespace {
+//! The encodings of the cached values: the JSON text of the formats before 2020.05.03 and the
+//! CBOR since.
+enum Encoding
+{
+        JsonText,
+        Cbor,
+};
+
+constexpr int VALUES = 1000;
+
+std::vector<json>
+roomInfos()
+{
+        std::vector<json> values;
+        for (int room = 0; room < VALUES; room++) {
+                RoomInfo info;
+                info.name         = "Room " + std::to_string(room);
+                info.topic        = "The topic of room " + std::to_string(room);
+                info.avatar_url   = "mxc://example.org/avatar" + std::to_string(room);
+                info.version      = "5";
+                info.member_count = bench::memberCount(room);
+                if (room % 5 == 0)
+                        info.tags = {"m.favourite"};
+
+                values.push_back(info);
+        }
+        return values;
+}
+
+std::vector<json>
+memberInfos()
+{
+        std::vector<json> values;
+        for (int user = 0; user < VALUES; user++)
+                values.push_back(MemberInfo{"User " + std::to_string(user),
+                                            "mxc://example.org/user" + std::to_string(user)});
+        return values;
+}
+
+//! Messages of all the types of the generated syncs.
+std::vector<json>
+events()
+{
+        std::vector<json> values;
+        for (int i = 0; i < VALUES; i++)
+                values.push_back(bench::message(1, 0, i));
+        return values;
+}
+
+//! Parse the values like the lookups of the cache do, in the encoding of the argument, and
+//! report the average size of a stored value.
+void
+decode(benchmark::State &state, const std::vector<json> &values)
+{
+        const auto encoding = static_cast<Encoding>(state.range(0));
+
+        std::vector<std::string> stored;
+        std::size_t bytes = 0;
+        for (const auto &value : values) {
+                stored.push_back(encoding == Cbor ? encodeValue(value) : value.dump());
+                bytes += stored.back().size();
+        }
+
+        for (auto _ : state)
+                for (const auto &value : stored)
+                        benchmark::DoNotOptimize(decodeValue(value));
+
+        state.SetItemsProcessed(state.iterations() * stored.size());
+        state.counters["bytes/value"] = benchmark::Counter(static_cast<double>(bytes) / VALUES);
+}
+
+void
+BM_DecodeRoomInfo(benchmark::State &state)
+{
+        decode(state, roomInfos());
+}
+BENCHMARK(BM_DecodeRoomInfo)->ArgName("cbor")->Arg(JsonText)->Arg(Cbor);
+
+void
+BM_DecodeMemberInfo(benchmark::State &state)
+{
+        decode(state, memberInfos());
+}
+BENCHMARK(BM_DecodeMemberInfo)->ArgName("cbor")->Arg(JsonText)->Arg(Cbor);
+
+void
+BM_DecodeEvent(benchmark::State &state)
+{
+        decode(state, events());
+}
+BENCHMARK(BM_DecodeEvent)->ArgName("cbor")->Arg(JsonText)->Arg(Cbor);
+}
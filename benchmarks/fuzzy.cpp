@@ -0,0 +1,130 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <QString>
+
+#include "Utils.h"
+
+namespace {
+constexpr int NAMES = 100'000;
+
+const std::string QUERY = "alice wonderland";
+
+//! utils::levenshtein_distance, which utils::FuzzyNeedle replaced, as the baseline: two rows
+//! per call and the full matrix over the bytes of UTF-8 strings.
+int
+levenshteinDistance(const std::string &s1, const std::string &s2)
+{
+        const int nlen = s1.size();
+        const int hlen = s2.size();
+
+        if (hlen == 0)
+                return -1;
+        if (nlen == 1)
+                return s2.find(s1);
+
+        std::vector<int> row1(hlen + 1, 0);
+        std::vector<int> row2(hlen + 1);
+
+        for (int i = 0; i < nlen; ++i) {
+                row2[0] = i + 1;
+
+                for (int j = 0; j < hlen; ++j) {
+                        const int cost = s1[i] != s2[j];
+                        row2[j + 1] =
+                          std::min(row1[j + 1] + 1, std::min(row2[j] + 1, row1[j] + cost));
+                }
+
+                row1.swap(row2);
+        }
+
+        return *std::min_element(row1.begin(), row1.end());
+}
+
+//! Lowercase names of 8 to 32 letters and spaces, like the display names of a search index.
+const std::vector<std::string> &
+names()
+{
+        static const auto names = [] {
+                std::mt19937 random(42);
+                std::uniform_int_distribution<int> length(8, 32);
+                std::uniform_int_distribution<int> letter(0, 26);
+
+                std::vector<std::string> names;
+                for (int i = 0; i < NAMES; i++) {
+                        std::string name(length(random), ' ');
+                        for (auto &c : name) {
+                                const int l = letter(random);
+                                c           = l == 26 ? ' ' : static_cast<char>('a' + l);
+                        }
+                        names.push_back(std::move(name));
+                }
+                return names;
+        }();
+        return names;
+}
+
+const std::vector<QString> &
+qnames()
+{
+        static const auto qnames = [] {
+                std::vector<QString> qnames;
+                for (const auto &name : names())
+                        qnames.push_back(QString::fromStdString(name));
+                return qnames;
+        }();
+        return qnames;
+}
+
+void
+BM_LevenshteinDistance(benchmark::State &state)
+{
+        for (auto _ : state)
+                for (const auto &name : names())
+                        benchmark::DoNotOptimize(levenshteinDistance(QUERY, name));
+
+        state.SetItemsProcessed(state.iterations() * NAMES);
+}
+BENCHMARK(BM_LevenshteinDistance)->Unit(benchmark::kMillisecond);
+
+//! The needle with the largest distance, which computes every column like the baseline, and
+//! with the cutoff of a search, which stops early.
+void
+BM_FuzzyNeedle(benchmark::State &state)
+{
+        const utils::FuzzyNeedle needle(QString::fromStdString(QUERY));
+        const int maxDistance = state.range(0) ? static_cast<int>(state.range(0)) : needle.size();
+
+        // The distances have to agree with the baseline, where they are at most maxDistance.
+        for (int i = 0; i < 1000; i++) {
+                const int expected = levenshteinDistance(QUERY, names()[i]);
+                const int actual   = needle.distance(qnames()[i], maxDistance);
+                if (std::min(expected, maxDistance + 1) != actual) {
+                        state.SkipWithError("the distance differs from levenshteinDistance");
+                        return;
+                }
+        }
+
+        for (auto _ : state)
+                for (const auto &name : qnames())
+                        benchmark::DoNotOptimize(needle.distance(name, maxDistance));
+
+        state.SetItemsProcessed(state.iterations() * NAMES);
+}
+BENCHMARK(BM_FuzzyNeedle)->ArgName("cutoff")->Arg(0)->Arg(3)->Unit(benchmark::kMillisecond);
+
+//! Preparing the needle, which happens once per query.
+void
+BM_FuzzyNeedleSetup(benchmark::State &state)
+{
+        const auto query = QString::fromStdString(QUERY);
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(utils::FuzzyNeedle(query));
+}
+BENCHMARK(BM_FuzzyNeedleSetup);
+}
@@ -0,0 +1,48 @@
+#include <benchmark/benchmark.h>
+
+#include <QApplication>
+#include <QDir>
+#include <QStandardPaths>
+
+#include <mtx/identifiers.hpp>
+
+#include "Cache.h"
+#include "Cache_p.h"
+#include "Logging.h"
+#include "MatrixClient.h"
+#include "SyncGenerator.h"
+
+//! Runs the benchmarks of nheko_bench on the real classes of nheko, without a window. The cache
+//! and the settings are the ones of a separate "nheko-bench" application, so a profile of nheko
+//! is never touched.
+int
+main(int argc, char **argv)
+{
+        benchmark::Initialize(&argc, argv);
+        if (benchmark::ReportUnrecognizedArguments(argc, argv))
+                return 1;
+
+        if (qEnvironmentVariableIsEmpty("QT_QPA_PLATFORM"))
+                qputenv("QT_QPA_PLATFORM", "offscreen");
+
+        QCoreApplication::setApplicationName("nheko-bench");
+        QCoreApplication::setOrganizationName("nheko");
+        QStandardPaths::setTestModeEnabled(true);
+
+        QApplication app(argc, argv);
+
+        nhlog::init(QDir::temp().filePath("nheko-bench.log").toStdString());
+        nhlog::setLevel("warn");
+
+        http::init();
+        using namespace mtx::identifiers;
+        http::client()->set_user(parse<User>(bench::LOCAL_USER));
+
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+
+        if (cache::client())
+                cache::deleteData();
+
+        return 0;
+}
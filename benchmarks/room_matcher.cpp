@@ -0,0 +1,99 @@
+#include <benchmark/benchmark.h>
+
+#include <iterator>
+#include <string>
+
+#include <QDateTime>
+#include <QMap>
+#include <QString>
+
+#include "RoomMatcher.h"
+#include "SyncGenerator.h"
+
+namespace {
+constexpr int ROOMS = 5000;
+
+const char *const NAME_WORDS[] = {"release", "team",   "general", "random",  "design",
+                                  "backend", "matrix", "nheko",   "support", "offtopic",
+                                  "linux",   "music",  "family",  "gaming",  "announcements"};
+
+//! Rooms named by two or three words and a number, with their last message spread over the
+//! last months.
+QMap<QString, RoomInfo>
+rooms()
+{
+        const auto now = QDateTime::currentDateTime();
+
+        QMap<QString, RoomInfo> rooms;
+        for (int room = 0; room < ROOMS; room++) {
+                const auto word = [](int n) {
+                        return std::string(NAME_WORDS[n % std::size(NAME_WORDS)]);
+                };
+
+                RoomInfo info;
+                info.name = word(room) + " " + word(room / 7);
+                if (room % 3 == 0)
+                        info.name += " " + word(room / 3);
+                info.name += " " + std::to_string(room);
+
+                info.msgInfo.userid   = QString::fromStdString(bench::userId(room));
+                info.msgInfo.datetime = now.addSecs(-60 * 60 * (room % (24 * 90)));
+
+                rooms.insert(QString::fromStdString(bench::roomId(room)), info);
+        }
+        return rooms;
+}
+
+//! Typing a query into the quick switcher, one keystroke after the other.
+void
+BM_TypeQuery(benchmark::State &state)
+{
+        const QString query = "release team";
+
+        RoomMatcher matcher;
+        matcher.setRooms(rooms());
+
+        for (auto _ : state) {
+                for (int i = 1; i <= query.size(); i++)
+                        benchmark::DoNotOptimize(matcher.match(query.left(i), 10));
+
+                // The next query starts over with every room, like a new query in the switcher.
+                benchmark::DoNotOptimize(matcher.match("x", 10));
+        }
+
+        state.counters["keystroke"] = benchmark::Counter(
+          state.iterations() * (query.size() + 1),
+          benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+}
+BENCHMARK(BM_TypeQuery)->Unit(benchmark::kMicrosecond);
+
+//! The first keystroke, which scores every room.
+void
+BM_FirstKeystroke(benchmark::State &state)
+{
+        RoomMatcher matcher;
+        matcher.setRooms(rooms());
+
+        bool other = false;
+        for (auto _ : state) {
+                benchmark::DoNotOptimize(matcher.match(other ? "e" : "a", 10));
+                other = !other;
+        }
+
+        state.SetItemsProcessed(state.iterations() * ROOMS);
+}
+BENCHMARK(BM_FirstKeystroke)->Unit(benchmark::kMicrosecond);
+
+void
+BM_SetRooms(benchmark::State &state)
+{
+        const auto all = rooms();
+
+        RoomMatcher matcher;
+        for (auto _ : state)
+                matcher.setRooms(all);
+
+        state.SetItemsProcessed(state.iterations() * ROOMS);
+}
+BENCHMARK(BM_SetRooms)->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,459 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <QCoreApplication>
+#include <QHash>
+#include <QSharedPointer>
+#include <QSignalSpy>
+#include <QThreadPool>
+
+#include <mtx/events/collections.hpp>
+#include <mtx/responses.hpp>
+#include <nlohmann/json.hpp>
+
+#include "Allocations.h"
+#include "Cache.h"
+#include "Dataset.h"
+#include "EventAccessors.h"
+#include "SyncGenerator.h"
+#include "UserSettingsPage.h"
+#include "timeline/EventStore.h"
+#include "timeline/TimelineModel.h"
+#include "timeline/TimelineViewManager.h"
+
+using nlohmann::json;
+
+namespace {
+//! The room of the timelines. Its members are in the cache, so the names of the senders are
+//! looked up like in a real room.
+constexpr int ROOM = 1;
+//! An encrypted room, whose messages wait in the outbox.
+constexpr auto ENCRYPTED_ROOM = "!encrypted:example.org";
+//! The events of the sync batches of the benchmarks come after the stored ones.
+constexpr int BATCH = 1000;
+
+//! The manager of the timelines. Its view is never shown.
+TimelineViewManager *
+manager()
+{
+        static auto manager =
+          new TimelineViewManager(QSharedPointer<UserSettings>(new UserSettings), nullptr);
+        return manager;
+}
+
+std::unique_ptr<TimelineModel>
+model(const QString &room_id = QString::fromStdString(bench::roomId(ROOM)))
+{
+        return std::make_unique<TimelineModel>(manager(), room_id, nullptr);
+}
+
+//! The timeline of a sync with count messages of the room, starting at the given index.
+mtx::responses::Timeline
+syncedMessages(int batch, int first, int count)
+{
+        json events = json::array();
+        for (int i = first; i < first + count; i++)
+                events.push_back(bench::message(ROOM, batch, i));
+
+        return json{{"events", std::move(events)}, {"limited", false}, {"prev_batch", "p"}}
+          .get<mtx::responses::Timeline>();
+}
+
+//! Report the rate of the events and the allocations of the timed code per event.
+void
+report(benchmark::State &state, int64_t events, uint64_t allocations)
+{
+        state.SetItemsProcessed(events);
+        state.counters["allocs/event"] =
+          benchmark::Counter(static_cast<double>(allocations) / std::max<int64_t>(events, 1));
+}
+
+//! Measures the allocations of the timed code, stopping while the timing is paused.
+class AllocationCounter
+{
+public:
+        void start() { start_ = bench::allocations(); }
+        void stop() { counted_ += bench::allocations() - start_; }
+        uint64_t counted() const { return counted_; }
+
+private:
+        uint64_t start_   = 0;
+        uint64_t counted_ = 0;
+};
+
+//! The layouts of the events of a timeline.
+enum Layout
+{
+        //! The events by id in a QHash and their ids in timeline order, like before the EventStore.
+        EventsById,
+        Store,
+};
+
+//! Wait until the thread pool is done, e.g. encoding the events of an EventStore, and the
+//! results are handed back.
+void
+settle()
+{
+        do {
+                QThreadPool::globalInstance()->waitForDone();
+                QCoreApplication::processEvents();
+        } while (QThreadPool::globalInstance()->activeThreadCount() > 0);
+}
+
+//! The heap memory a room with 30k events takes in each layout, once its events are stored.
+void
+BM_EventStoreMemory(benchmark::State &state)
+{
+        constexpr int EVENTS = 30'000;
+
+        std::vector<mtx::events::collections::TimelineEvents> events;
+        for (int i = 0; i < EVENTS; i++) {
+                mtx::events::collections::TimelineEvent event;
+                mtx::events::collections::from_json(bench::message(ROOM, BATCH, i), event);
+                events.push_back(std::move(event.data));
+        }
+        const auto room_id = bench::roomId(ROOM);
+
+        const auto layout = static_cast<Layout>(state.range(0));
+        uint64_t bytes    = 0;
+        for (auto _ : state) {
+                const auto before = bench::heapBytes();
+
+                if (layout == EventsById) {
+                        QHash<QString, mtx::events::collections::TimelineEvents> byId;
+                        std::vector<QString> order;
+                        for (const auto &event : events) {
+                                const auto id =
+                                  QString::fromStdString(mtx::accessors::event_id(event));
+                                byId.insert(id, event);
+                                order.push_back(id);
+                        }
+
+                        bytes += bench::heapBytes() - before;
+                } else {
+                        EventStore store(room_id);
+                        // The events are oldest first, the timeline is newest first.
+                        std::vector<QString> ids;
+                        for (auto event = events.rbegin(); event != events.rend(); ++event) {
+                                ids.push_back(
+                                  QString::fromStdString(mtx::accessors::event_id(*event)));
+                                store.insert(ids.back(), *event);
+                        }
+                        store.append(ids);
+                        ids = {};
+                        settle();
+
+                        bytes += bench::heapBytes() - before;
+                }
+        }
+
+        state.SetItemsProcessed(state.iterations() * EVENTS);
+        state.counters["bytes/event"] =
+          benchmark::Counter(static_cast<double>(bytes) / (state.iterations() * EVENTS));
+}
+BENCHMARK(BM_EventStoreMemory)
+  ->ArgName("store")
+  ->Arg(EventsById)
+  ->Arg(Store)
+  ->Iterations(3)
+  ->Unit(benchmark::kMillisecond);
+
+//! 1000 messages of mixed types, which arrive in syncs of the given size.
+void
+BM_AddEvents(benchmark::State &state)
+{
+        constexpr int EVENTS = 1000;
+
+        bench::loadDataset(10);
+
+        const int size = state.range(0);
+        std::vector<mtx::responses::Timeline> syncs;
+        for (int first = 0; first < EVENTS; first += size)
+                syncs.push_back(syncedMessages(BATCH, first, size));
+
+        AllocationCounter allocations;
+        for (auto _ : state) {
+                state.PauseTiming();
+                auto timeline = model();
+                allocations.start();
+                state.ResumeTiming();
+
+                for (const auto &sync : syncs)
+                        timeline->addEvents(sync);
+
+                state.PauseTiming();
+                allocations.stop();
+                timeline.reset();
+                state.ResumeTiming();
+        }
+
+        report(state, state.iterations() * EVENTS, allocations.counted());
+}
+BENCHMARK(BM_AddEvents)->ArgName("sync")->Arg(1)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+//! The messages of the local user arrive in a sync and replace their local echoes.
+void
+BM_ReplaceLocalEchoes(benchmark::State &state)
+{
+        constexpr int EVENTS = 100;
+
+        bench::loadDataset(10);
+
+        // The room is encrypted, so restoring the outbox doesn't send the messages, but waits
+        // for the members of the room.
+        const auto encryption = json{
+          {"next_batch", "encrypted"},
+          {"rooms",
+           {{"join",
+             {{ENCRYPTED_ROOM,
+               {{"state",
+                 {{"events",
+                   {{{"type", "m.room.encryption"},
+                     {"state_key", ""},
+                     {"sender", bench::LOCAL_USER},
+                     {"event_id", "$encryption:example.org"},
+                     {"origin_server_ts", 1600000000000},
+                     {"content", {{"algorithm", "m.megolm.v1.aes-sha2"}}}}}}}},
+                {"timeline", {{"events", json::array()}, {"prev_batch", "p"}}}}}}}}}};
+        const auto response = bench::parse(encryption);
+        cache::saveState(response.sync, response.summaries);
+
+        // Only messages are sent, not the topic changes among the events.
+        std::vector<mtx::events::collections::TimelineEvents> echoes;
+        std::vector<std::string> txn_ids;
+        json synced = json::array();
+        for (int i = 0; i < EVENTS; i++) {
+                auto event = bench::message(ROOM, BATCH, i);
+                if (event["type"] != "m.room.message")
+                        continue;
+
+                const auto txn_id = "m" + std::to_string(i);
+                txn_ids.push_back(txn_id);
+
+                event["sender"]   = bench::LOCAL_USER;
+                event["unsigned"] = {{"transaction_id", txn_id}};
+                synced.push_back(event);
+
+                event["event_id"] = txn_id;
+                event.erase("unsigned");
+                mtx::events::collections::TimelineEvent echo;
+                mtx::events::collections::from_json(event, echo);
+                echoes.push_back(echo.data);
+        }
+        const auto sync = json{{"events", synced}, {"limited", false}, {"prev_batch", "p"}}
+                            .get<mtx::responses::Timeline>();
+
+        AllocationCounter allocations;
+        for (auto _ : state) {
+                state.PauseTiming();
+                for (const auto &echo : echoes)
+                        cache::saveOutboxMessage(ENCRYPTED_ROOM, echo);
+                auto timeline = model(ENCRYPTED_ROOM);
+                allocations.start();
+                state.ResumeTiming();
+
+                timeline->addEvents(sync);
+
+                state.PauseTiming();
+                allocations.stop();
+                timeline.reset();
+                for (const auto &txn_id : txn_ids)
+                        cache::removeOutboxMessage(ENCRYPTED_ROOM, txn_id);
+                state.ResumeTiming();
+        }
+
+        report(state, state.iterations() * echoes.size(), allocations.counted());
+}
+BENCHMARK(BM_ReplaceLocalEchoes)->Unit(benchmark::kMillisecond);
+
+//! A sync redacts every shown message.
+void
+BM_Redactions(benchmark::State &state)
+{
+        constexpr int EVENTS = 100;
+
+        bench::loadDataset(10);
+
+        const auto messages = syncedMessages(BATCH, 0, EVENTS);
+
+        json redactions = json::array();
+        for (int i = 0; i < EVENTS; i++)
+                redactions.push_back(bench::redaction(ROOM, BATCH, i));
+        const auto sync = json{{"events", redactions}, {"limited", false}, {"prev_batch", "p"}}
+                            .get<mtx::responses::Timeline>();
+
+        AllocationCounter allocations;
+        for (auto _ : state) {
+                state.PauseTiming();
+                auto timeline = model();
+                timeline->addEvents(messages);
+                allocations.start();
+                state.ResumeTiming();
+
+                timeline->addEvents(sync);
+
+                state.PauseTiming();
+                allocations.stop();
+                timeline.reset();
+                state.ResumeTiming();
+        }
+
+        report(state, state.iterations() * EVENTS, allocations.counted());
+}
+BENCHMARK(BM_Redactions)->Unit(benchmark::kMillisecond);
+
+//! A sync after reconnecting, which updates 100 shown messages and redacts 100 others. Reports the
+//! dataChanged signals of the model, each of which makes the view update its delegates.
+void
+BM_RowUpdates(benchmark::State &state)
+{
+        constexpr int EVENTS = 200;
+
+        bench::loadDataset(10);
+
+        const auto messages = syncedMessages(BATCH, 0, EVENTS);
+
+        // Every other message comes again with another body, the rest is redacted.
+        json updates = json::array();
+        for (int i = 0; i < EVENTS; i++) {
+                if (i % 2 == 0) {
+                        auto message = bench::message(ROOM, BATCH, i);
+                        message["content"]["body"] = "edited " + std::to_string(i);
+                        updates.push_back(std::move(message));
+                } else {
+                        updates.push_back(bench::redaction(ROOM, BATCH, i));
+                }
+        }
+        const auto sync = json{{"events", updates}, {"limited", false}, {"prev_batch", "p"}}
+                            .get<mtx::responses::Timeline>();
+
+        int64_t signals = 0;
+        for (auto _ : state) {
+                state.PauseTiming();
+                auto timeline = model();
+                timeline->addEvents(messages);
+                QSignalSpy spy(timeline.get(), &TimelineModel::dataChanged);
+                state.ResumeTiming();
+
+                timeline->addEvents(sync);
+
+                state.PauseTiming();
+                signals += spy.count();
+                timeline.reset();
+                state.ResumeTiming();
+        }
+
+        state.SetItemsProcessed(state.iterations() * EVENTS);
+        state.counters["dataChanged"] =
+          benchmark::Counter(static_cast<double>(signals) / state.iterations());
+}
+BENCHMARK(BM_RowUpdates)->Unit(benchmark::kMillisecond);
+
+//! Scrolling up through ten pages of older messages.
+void
+BM_PrependPages(benchmark::State &state)
+{
+        constexpr int PAGES = 10;
+        constexpr int PAGE  = 50;
+
+        bench::loadDataset(10);
+
+        // The newest messages come last in the sync, but first in a page of older messages.
+        const auto newest = syncedMessages(BATCH, PAGES * PAGE, PAGE);
+        std::vector<mtx::responses::Messages> pages;
+        for (int page = PAGES - 1; page >= 0; page--) {
+                json chunk = json::array();
+                for (int i = (page + 1) * PAGE - 1; i >= page * PAGE; i--)
+                        chunk.push_back(bench::message(ROOM, BATCH, i));
+
+                pages.push_back(
+                  json{{"start", "s"}, {"end", "e" + std::to_string(page)}, {"chunk", chunk}}
+                    .get<mtx::responses::Messages>());
+        }
+
+        AllocationCounter allocations;
+        for (auto _ : state) {
+                state.PauseTiming();
+                auto timeline = model();
+                timeline->addEvents(newest);
+                allocations.start();
+                state.ResumeTiming();
+
+                for (const auto &page : pages)
+                        emit timeline->oldMessagesRetrieved(page, true);
+
+                state.PauseTiming();
+                allocations.stop();
+                timeline.reset();
+                state.ResumeTiming();
+        }
+
+        report(state, state.iterations() * PAGES * PAGE, allocations.counted());
+}
+BENCHMARK(BM_PrependPages)->Unit(benchmark::kMillisecond);
+
+void
+BM_IdToIndex(benchmark::State &state)
+{
+        bench::loadDataset(10);
+
+        const int rows = state.range(0);
+        auto timeline  = model();
+        timeline->addEvents(syncedMessages(BATCH, 0, rows));
+
+        std::vector<QString> ids;
+        for (int i = 0; i < rows; i += 7)
+                ids.push_back(QString::fromStdString(
+                  bench::message(ROOM, BATCH, i)["event_id"].get<std::string>()));
+
+        for (auto _ : state)
+                for (const auto &id : ids)
+                        benchmark::DoNotOptimize(timeline->idToIndex(id));
+
+        state.SetItemsProcessed(state.iterations() * ids.size());
+}
+BENCHMARK(BM_IdToIndex)->ArgName("rows")->Arg(100)->Arg(1000)->Arg(10000);
+
+//! Every row of a timeline for one role, as the delegates read them, with the display values
+//! computed again or cached.
+void
+BM_Data(benchmark::State &state)
+{
+        constexpr int ROWS = 200;
+
+        bench::loadDataset(10);
+
+        const int role    = state.range(0);
+        const bool cached = state.range(1);
+
+        auto timeline = model();
+        timeline->addEvents(syncedMessages(BATCH, 0, ROWS));
+        state.SetLabel(timeline->roleNames().value(role).toStdString());
+
+        AllocationCounter allocations;
+        for (auto _ : state) {
+                if (!cached) {
+                        state.PauseTiming();
+                        timeline->clearDisplayRows();
+                        state.ResumeTiming();
+                }
+                allocations.start();
+
+                for (int row = 0; row < timeline->rowCount(); row++)
+                        benchmark::DoNotOptimize(timeline->data(timeline->index(row), role));
+
+                allocations.stop();
+        }
+
+        report(state, state.iterations() * timeline->rowCount(), allocations.counted());
+}
+BENCHMARK(BM_Data)
+  ->ArgNames({"role", "cached"})
+  ->ArgsProduct({benchmark::CreateDenseRange(TimelineModel::Section, TimelineModel::Dump, 1),
+                 {0, 1}})
+  ->Unit(benchmark::kMicrosecond);
+}
@@ -0,0 +1,134 @@
+#include <benchmark/benchmark.h>
+
+#include <string>
+#include <vector>
+
+#include <QString>
+
+#include <mtx/events/collections.hpp>
+
+#include "Dataset.h"
+#include "SyncGenerator.h"
+#include "Utils.h"
+
+namespace {
+struct Corpus
+{
+        const char *name;
+        QString text;
+};
+
+QString
+repeat(const QString &text, int times)
+{
+        QString repeated;
+        for (int i = 0; i < times; i++)
+                repeated += text;
+        return repeated;
+}
+
+//! The texts, which the per message functions see: chat lines, a pasted source file, lines
+//! of emoji and the formatted body of a message with many tags.
+const std::vector<Corpus> &
+corpora()
+{
+        static const std::vector<Corpus> corpora = {
+          {"short", "sure, see you at 5 at https://example.org/meeting *after* lunch"},
+          {"code",
+           "```cpp\n" +
+             repeat("for (const auto &[room_id, room] : res.rooms.join) {\n"
+                    "        if (room.timeline.events.empty() && x < 3 && y > 4)\n"
+                    "                continue; // <not> a tag, but \"quoted\" & escaped\n"
+                    "        loadMembers(QString::fromStdString(room_id));\n"
+                    "}\n",
+                    60) +
+             "```"},
+          {"emoji", repeat("🎉🎉 party 👍🏽 time 🇩🇪 ❤️ 👨‍👩‍👧‍👦 ", 40)},
+          {"html",
+           repeat("<p>Hello <b>world</b>, <i>see</i> <a href=\"https://example.org/x?a=1&b=2\" "
+                  "onclick=\"evil()\">this link</a><br/><font color=\"#ff0000\">red</font> "
+                  "<code>code()</code> <script>alert(1)</script><span "
+                  "data-mx-spoiler>secret</span></p>\n",
+                  30)},
+        };
+        return corpora;
+}
+
+void
+corpusArgs(benchmark::internal::Benchmark *b)
+{
+        b->ArgName("corpus")->DenseRange(0, static_cast<int>(corpora().size()) - 1);
+}
+
+//! Run one of the string functions of utils on a corpus.
+template<QString (*Function)(const QString &)>
+void
+BM_Corpus(benchmark::State &state)
+{
+        const auto &corpus = corpora().at(state.range(0));
+        state.SetLabel(corpus.name);
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(Function(corpus.text));
+
+        state.SetBytesProcessed(state.iterations() * corpus.text.size() * sizeof(QChar));
+}
+BENCHMARK_TEMPLATE(BM_Corpus, utils::escapeBlacklistedHtml)->Apply(corpusArgs);
+BENCHMARK_TEMPLATE(BM_Corpus, utils::markdownToHtml)->Apply(corpusArgs);
+BENCHMARK_TEMPLATE(BM_Corpus, utils::linkifyMessage)->Apply(corpusArgs);
+BENCHMARK_TEMPLATE(BM_Corpus, utils::replaceEmoji)->Apply(corpusArgs);
+BENCHMARK_TEMPLATE(BM_Corpus, utils::linkifyAndReplaceEmoji)->Apply(corpusArgs);
+
+//! The descriptions of the last messages in the room list, for messages of every type.
+void
+BM_GetMessageDescription(benchmark::State &state)
+{
+        constexpr int ROOM = 1;
+
+        bench::loadDataset(10);
+
+        std::vector<mtx::events::collections::TimelineEvents> events;
+        for (int i = 0; i < 20; i++) {
+                mtx::events::collections::TimelineEvent event;
+                mtx::events::collections::from_json(bench::message(ROOM, 0, i), event);
+                events.push_back(event.data);
+        }
+
+        const auto local_user = QString(bench::LOCAL_USER);
+        const auto room_id    = QString::fromStdString(bench::roomId(ROOM));
+        for (auto _ : state)
+                for (const auto &event : events)
+                        benchmark::DoNotOptimize(
+                          utils::getMessageDescription(event, local_user, room_id));
+
+        state.SetItemsProcessed(state.iterations() * events.size());
+}
+BENCHMARK(BM_GetMessageDescription);
+
+//! The colors of the names of many users.
+void
+BM_GenerateContrastingHexColor(benchmark::State &state)
+{
+        std::vector<QString> users;
+        for (int user = 0; user < 100; user++)
+                users.push_back(QString::fromStdString(bench::userId(user)));
+
+        for (auto _ : state)
+                for (const auto &user : users)
+                        benchmark::DoNotOptimize(
+                          utils::generateContrastingHexColor(user, "#ffffff"));
+
+        state.SetItemsProcessed(state.iterations() * users.size());
+}
+BENCHMARK(BM_GenerateContrastingHexColor);
+
+void
+BM_HumanReadableFingerprint(benchmark::State &state)
+{
+        const std::string key = "l9TcMKeKAOXrvSMLONdLUWGOJ5JhY5BKLLEtnUaaBGU";
+
+        for (auto _ : state)
+                benchmark::DoNotOptimize(utils::humanReadableFingerprint(key));
+}
+BENCHMARK(BM_HumanReadableFingerprint);
+}
@@ -361,14 +361,9 @@
     </message>
 </context>
 <context>
-    <name>RoomInfoListItem</name>
+    <name>RoomListDelegate</name>
     <message>
-        <location filename="../../src/RoomInfoListItem.cpp" line="+98"/>
-        <source>Leave room</source>
-        <translation>Leave room</translation>
-    </message>
-    <message>
-        <location line="+158"/>
+        <location filename="../../src/RoomListView.cpp" line="+487"/>
         <source>Accept</source>
         <translation>Accept</translation>
     </message>
@@ -378,6 +373,14 @@
         <translation>Decline</translation>
     </message>
 </context>
+<context>
+    <name>RoomListView</name>
+    <message>
+        <location filename="../../src/RoomListView.cpp" line="+93"/>
+        <source>Leave room</source>
+        <translation>Leave room</translation>
+    </message>
+</context>
 <context>
     <name>SideBarActions</name>
     <message>
@@ -362,14 +362,9 @@
     </message>
 </context>
 <context>
-    <name>RoomInfoListItem</name>
+    <name>RoomListDelegate</name>
     <message>
-        <location filename="../../src/RoomInfoListItem.cpp" line="+98"/>
-        <source>Leave room</source>
-        <translation>Quitter le salon</translation>
-    </message>
-    <message>
-        <location line="+158"/>
+        <location filename="../../src/RoomListView.cpp" line="+487"/>
         <source>Accept</source>
         <translation>Accepter</translation>
     </message>
@@ -379,6 +374,14 @@
         <translation>Décliner</translation>
     </message>
 </context>
+<context>
+    <name>RoomListView</name>
+    <message>
+        <location filename="../../src/RoomListView.cpp" line="+93"/>
+        <source>Leave room</source>
+        <translation>Quitter le salon</translation>
+    </message>
+</context>
 <context>
     <name>SideBarActions</name>
     <message>
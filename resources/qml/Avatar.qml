@@ -1,6 +1,5 @@
 import QtQuick 2.6
 import QtQuick.Controls 2.3
-import QtGraphicalEffects 1.0
 
 Rectangle {
 	id: avatar
@@ -8,8 +7,10 @@ Rectangle {
 	height: 48
 	radius: settings.avatar_circles ? height/2 : 3
 
-	property alias url: img.source
+	property string url
 	property string displayName
+	// Shown as an identicon, if there is no url and the jdenticon plugin is loaded.
+	property string userid
 
 	Label {
 		anchors.fill: parent
@@ -22,26 +23,24 @@ Rectangle {
 		color: colors.brightText
 	}
 
+	// The provider cuts the corners off and scales the image to its size, so the small textures
+	// of all avatars share the atlas of the scene graph and are drawn in one batch. A layer with
+	// a mask or mipmaps would give every avatar its own texture.
 	Image {
 		id: img
 		anchors.fill: parent
 		asynchronous: true
 		fillMode: Image.PreserveAspectCrop
-		mipmap: true
-		smooth: false
-
-		sourceSize.width: avatar.width
-		sourceSize.height: avatar.height
-
-		layer.enabled: true
-		layer.effect: OpacityMask {
-			maskSource: Rectangle {
-				anchors.fill: parent
-				width: avatar.width
-				height: avatar.height
-				radius: settings.avatar_circles ? height/2 : 3
-			}
+		smooth: true
+		// The image is loaded in device pixels, so the radius is scaled along.
+		source: {
+			var base = avatar.url ? avatar.url
+				: avatar.userid && timelineManager.jdenticonsAvailable() ? "image://jdenticon/" + encodeURIComponent(avatar.userid)
+				: ""
+			return base ? base + "?radius=" + (avatar.radius * sourceSize.width / avatar.width) : ""
 		}
+
+		sourceSize: timelineManager.imageSourceSize(avatar.width, avatar.height)
 	}
 	color: colors.dark
 }
@@ -1,12 +1,11 @@
 import QtQuick 2.5
 import QtQuick.Controls 2.3
+import im.nheko 1.0
 
-TextEdit {
-	textFormat: TextEdit.RichText
-	readOnly: true
-	wrapMode: Text.Wrap
-	selectByMouse: true
+RichText {
 	color: colors.text
+	linkColor: colors.link
+	selectionColor: colors.highlight
 
 	onLinkActivated: {
 		if (/^https:\/\/matrix.to\/#\/(@.*)$/.test(link)) chat.model.openUserProfile(/^https:\/\/matrix.to\/#\/(@.*)$/.exec(link)[1])
@@ -14,7 +13,7 @@ TextEdit {
 		else if (/^https:\/\/matrix.to\/#\/(![^\/]*)\/(\$.*)$/.test(link)) {
 			var match = /^https:\/\/matrix.to\/#\/(![^\/]*)\/(\$.*)$/.exec(link)
 			timelineManager.setHistoryView(match[1])
-			chat.positionViewAtIndex(chat.model.idToIndex(match[2]), ListView.Contain)
+			timelineManager.timeline.showEvent(match[2])
 		}
 		else Qt.openUrlExternally(link)
 	}
@@ -27,6 +27,8 @@ Rectangle {
 		id: stateImg
 		// Workaround, can't get icon.source working for now...
 		anchors.fill: parent
+		sourceSize.width: width
+		sourceSize.height: height
 		source: switch (indicator.state) {
 			case MtxEvent.Failed: return "image://colorimage/:/icons/icons/ui/remove-symbol.png?" + colors.buttonText
 			case MtxEvent.Sent: return "image://colorimage/:/icons/icons/ui/clock.png?" + colors.buttonText
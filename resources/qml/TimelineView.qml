@@ -3,6 +3,7 @@ import QtQuick.Controls 2.3
 import QtQuick.Layouts 1.2
 import QtGraphicalEffects 1.0
 import QtQuick.Window 2.2
+import QtMultimedia 5.6
 import Qt.labs.settings 1.0
 
 import im.nheko 1.0
@@ -93,6 +94,7 @@ Page {
 		BusyIndicator {
 			anchors.centerIn: parent
 			running: timelineManager.isInitialSync
+			visible: running
 			height: 200
 			width: 200
 			z: 3
@@ -113,9 +115,110 @@ Page {
 
 			model: timelineManager.timeline
 
+			// The loaded events stay in the model of a room, so going back to it shows the
+			// messages, at which it was left, without fetching them again.
+			onModelChanged: Qt.callLater(restoreViewport)
+
+			function saveViewport() {
+				if (!model)
+					return
+				if (atYEnd) {
+					model.saveViewport("", 0)
+					return
+				}
+				var y = contentY + height - 1
+				var index = indexAt(width / 2, y)
+				var item = itemAt(width / 2, y)
+				if (index >= 0 && item)
+					model.saveViewport(model.indexToId(index), item.y + item.height - (contentY + height))
+			}
+
+			function restoreViewport() {
+				if (!model)
+					return
+				var anchor = model.viewportAnchor()
+				var index = anchor ? model.idToIndex(anchor) : -1
+				if (index < 0)
+					return
+				// The list grows from the bottom, so the beginning is the bottom of the view.
+				positionViewAtIndex(index, ListView.Beginning)
+				contentY -= model.viewportOffset()
+				returnToBounds()
+			}
+
+			// A jump to an event may replace the rows, so the list is positioned, once it has
+			// laid them out.
+			Connections {
+				target: chat.model
+				onScrollToIndex: Qt.callLater(chat.positionViewAtIndex, index, ListView.Contain)
+			}
+
 			boundsBehavior: Flickable.StopAtBounds
 			pixelAligned: true
 
+			// Only the frames of a scroll are timed by the performance overlay.
+			onMovingChanged: timelineManager.stats.setScrolling(moving)
+
+			// The section headers are reused, instead of created and destroyed, while scrolling.
+			// They are owned by the list, so they outlive the delegates showing them.
+			property var sectionPool: []
+
+			function acquireSection(wrapper, modelData) {
+				var header = sectionPool.length > 0 ? sectionPool.pop() : sectionHeader.createObject(chat)
+				header.modelData = modelData
+				header.parent = wrapper
+				return header
+			}
+
+			function releaseSection(header) {
+				header.parent = null
+				sectionPool.push(header)
+			}
+
+			// The media players are only created, when a message is played, and are shared by
+			// the whole timeline. If all are in use, the least recently acquired one is taken
+			// from its message.
+			property int maxMediaPlayers: 4
+			property var mediaPlayers: []
+
+			function acquireMediaPlayer(owner) {
+				var entry = null
+				for (var i = 0; i < mediaPlayers.length; i++) {
+					if (!mediaPlayers[i].owner) {
+						entry = mediaPlayers.splice(i, 1)[0]
+						break
+					}
+				}
+				if (!entry && mediaPlayers.length < maxMediaPlayers)
+					entry = { "player": mediaPlayerComponent.createObject(chat), "owner": null }
+				if (!entry) {
+					entry = mediaPlayers.shift()
+					entry.player.stop()
+					entry.owner.mediaPlayerTaken()
+				}
+				entry.owner = owner
+				mediaPlayers.push(entry)
+				return entry.player
+			}
+
+			function releaseMediaPlayer(player) {
+				for (var i = 0; i < mediaPlayers.length; i++) {
+					if (mediaPlayers[i].player === player) {
+						player.stop()
+						player.source = ""
+						mediaPlayers[i].owner = null
+						return
+					}
+				}
+			}
+
+			Component {
+				id: mediaPlayerComponent
+				MediaPlayer {
+					onError: console.log(errorString)
+				}
+			}
+
 			MouseArea {
 				anchors.fill: parent
 				acceptedButtons: Qt.NoButton
@@ -152,6 +255,25 @@ Page {
 
 			onCountChanged: if (atYEnd) model.currentIndex = 0 // Mark last event as read, since we are at the bottom
 
+			// Fetch the avatars and images of the next screenful in both directions, once
+			// the scrolling settles for a moment.
+			onContentYChanged: prefetchTimer.restart()
+			Timer {
+				id: prefetchTimer
+				interval: 100
+				onTriggered: {
+					var top = chat.indexAt(chat.width / 2, chat.contentY)
+					var bottom = chat.indexAt(chat.width / 2, chat.contentY + chat.height - 1)
+					chat.saveViewport()
+					if (top < 0 || bottom < 0)
+						return
+					var first = Math.min(top, bottom)
+					var last = Math.max(top, bottom)
+					var screen = last - first + 1
+					chat.model.prefetchMedia(first - screen, last + screen, avatarSize, chat.width - avatarSize - 4, timelineRoot.height / 2)
+				}
+			}
+
 			delegate: Rectangle {
 				// This would normally be previousSection, but our model's order is inverted.
 				property bool sectionBoundary: (ListView.nextSection != "" && ListView.nextSection !== ListView.section) || model.index === chat.count - 1
@@ -169,18 +291,22 @@ Page {
 
 				onSectionBoundaryChanged: {
 					if (sectionBoundary) {
-						var properties = {
-							'modelData': model.dump,
-							'section': ListView.section,
-							'nextSection': ListView.nextSection
-						}
-						section = sectionHeader.createObject(wrapper, properties)
-					} else {
-						section.destroy()
+						section = chat.acquireSection(wrapper, model.sectionHeader)
+					} else if (section) {
+						chat.releaseSection(section)
 						section = null
 					}
 				}
 
+				// Older events may start or continue the day of this one.
+				ListView.onNextSectionChanged: if (section) section.modelData = model.sectionHeader
+				Component.onCompleted: timelineManager.stats.delegateCreated(model.type)
+				Component.onDestruction: {
+					timelineManager.stats.delegateDestroyed()
+					if (section)
+						chat.releaseSection(section)
+				}
+
 				Binding {
 					target: chat.model
 					property: "currentIndex"
@@ -198,8 +324,6 @@ Page {
 				id: sectionHeader
 				Column {
 					property var modelData
-					property string section
-					property string nextSection
 
 					topPadding: 4
 					bottomPadding: 4
@@ -207,13 +331,13 @@ Page {
 
 					visible: !!modelData
 
-					width: parent.width
-					height: (section.includes(" ") ? dateBubble.height + 8 + userName.height : userName.height) + 8
+					width: parent ? parent.width : 0
+					height: (modelData && modelData.newDay ? dateBubble.height + 8 + userName.height : userName.height) + 8
 
 					Label {
 						id: dateBubble
 						anchors.horizontalCenter: parent ? parent.horizontalCenter : undefined
-						visible: section.includes(" ")
+						visible: modelData && modelData.newDay
 						text: chat.model.formatDateSeparator(modelData.timestamp)
 						color: colors.brightText
 
@@ -231,8 +355,9 @@ Page {
 						Avatar {
 							width: avatarSize
 							height: avatarSize
-							url: chat.model.avatarUrl(modelData.userId).replace("mxc://", "image://MxcImage/")
+							url: modelData.avatarUrl.replace("mxc://", "image://MxcImage/")
 							displayName: modelData.userName
+							userid: modelData.userId
 
 							MouseArea {
 								anchors.fill: parent
@@ -250,7 +375,7 @@ Page {
 
 							MouseArea {
 								anchors.fill: parent
-								onClicked: chat.model.openUserProfile(section.split(" ")[0])
+								onClicked: chat.model.openUserProfile(modelData.userId)
 								cursorShape: Qt.PointingHandCursor
 								propagateComposedEvents: true
 							}
@@ -261,6 +386,91 @@ Page {
 
 		}
 
+		// The performance overlay, to find the messages, which make the scrolling stutter.
+		Shortcut {
+			sequence: "Ctrl+Shift+Alt+P"
+			onActivated: timelineManager.stats.enabled = !timelineManager.stats.enabled
+		}
+
+		// The scroll benchmark flicks towards the older messages and back, while the frames are
+		// timed. Every flick is given the time to settle, so the next one starts from rest.
+		Shortcut {
+			sequence: "Ctrl+Shift+Alt+S"
+			onActivated: scrollBenchmark.begin()
+		}
+
+		// With --scroll-benchmark it starts by itself, once a room is shown.
+		Connections {
+			target: timelineManager.stats
+			onBenchmarkRequested: scrollBenchmark.begin()
+		}
+
+		Timer {
+			id: scrollBenchmark
+
+			property int flicks: 0
+			readonly property int flicksPerDirection: 10
+
+			function begin() {
+				if (running)
+					return;
+				timelineManager.stats.startBenchmark();
+				flicks = 0;
+				start();
+			}
+
+			interval: 800
+			repeat: true
+			onTriggered: {
+				// Hiding the overlay ends the benchmark early.
+				if (!timelineManager.stats.benchmarking) {
+					stop();
+					return;
+				}
+				if (flicks == 2 * flicksPerDirection) {
+					stop();
+					timelineManager.stats.finishBenchmark();
+					return;
+				}
+				chat.flick(0, flicks < flicksPerDirection ? 4000 : -4000);
+				flicks++;
+			}
+		}
+
+		Rectangle {
+			id: statsOverlay
+
+			visible: timelineManager.stats.enabled
+			anchors.top: parent.top
+			anchors.right: parent.right
+			anchors.topMargin: 8
+			anchors.rightMargin: scrollbar.width + 8
+			width: statsText.width + 16
+			height: statsText.height + 16
+			radius: 4
+			color: "#c0000000"
+			z: 4
+
+			Label {
+				id: statsText
+				anchors.centerIn: parent
+				color: "white"
+				font.family: "monospace"
+
+				property var stats: timelineManager.stats
+				text: "frame " + stats.frameTime.toFixed(1) + " ms, max " + stats.maxFrameTime.toFixed(1) + " ms\n"
+					+ "slowest frame created: " + (stats.slowestFrame || "nothing") + "\n"
+					+ "delegates " + stats.delegates + ", " + stats.delegatesCreated + " created/s\n"
+					+ "rows " + stats.rows + "\n"
+					+ "pending images " + stats.pendingImages + "\n"
+					+ "decode pool " + stats.decodeQueue + " queued, " + stats.decodeRunning + " running\n"
+					+ "media crypto pool " + stats.cryptoQueue + " queued, " + stats.cryptoRunning + " running\n"
+					+ "decrypting " + stats.decryptQueue
+					+ (stats.benchmarking ? "\nscroll benchmark running" : "")
+					+ (stats.benchmarkResult ? "\n" + stats.benchmarkResult : "")
+			}
+		}
+
 		Rectangle {
 			id: chatFooter
 
@@ -1,4 +1,5 @@
 import QtQuick 2.6
+import QtQuick.Controls 2.1
 import QtQuick.Layouts 1.2
 
 Item {
@@ -52,6 +53,23 @@ Item {
 				elide: Text.ElideRight
 				color: colors.text
 			}
+			ProgressBar {
+				id: download
+				Layout.fillWidth: true
+				visible: false
+				indeterminate: to <= 0
+			}
+		}
+	}
+
+	Connections {
+		target: timelineManager.timeline
+		onMediaProgress: {
+			if (mxcUrl == model.data.url) {
+				download.to = total
+				download.value = received
+				download.visible = total <= 0 || received < total
+			}
 		}
 	}
 
@@ -28,14 +28,18 @@ Item {
 		id: img
 		anchors.fill: parent
 
-		source: model.data.url.replace("mxc://", "image://MxcImage/")
+		// The thumbnail, if the sender uploaded one, so encrypted images aren't downloaded in full
+		// just to show them in the timeline.
+		source: (model.data.thumbnailUrl ? model.data.thumbnailUrl : model.data.url).replace("mxc://", "image://MxcImage/")
 		asynchronous: true
 		fillMode: Image.PreserveAspectFit
+		// Loaded at about the shown size, rounded like the prefetches of the timeline.
+		sourceSize: timelineManager.imageSourceSize(parent.width, parent.height)
 
 		MouseArea {
 			enabled: model.data.type == MtxEvent.ImageMessage && img.status == Image.Ready
 			anchors.fill: parent
-			onClicked: timelineManager.openImageOverlay(model.data.url, model.data.id)
+			onClicked: timelineManager.openImageOverlay(model.data.url, model.data.id, model.data.thumbnailUrl ? model.data.thumbnailUrl : model.data.url, img.sourceSize)
 		}
 	}
 }
@@ -19,6 +19,13 @@ Item {
 		roleValue: model.data.type
 		anchors.fill: parent
 
+		// Shown, while an asynchronous delegate is created. About as high as the media, so the
+		// rows don't move, once it is done.
+		placeholder: Item {
+			width: chooser.width
+			height: model.data.proportionalHeight > 0 ? Math.min(timelineRoot.height / 2, (model.data.width < 1 ? width : Math.min(width, model.data.width)) * model.data.proportionalHeight) : 48
+		}
+
 		DelegateChoice {
 			roleValue: MtxEvent.UnknownMessage
 			Placeholder { text: "Unretrieved event" }
@@ -40,10 +47,12 @@ Item {
 		}
 		DelegateChoice {
 			roleValue: MtxEvent.ImageMessage
+			asynchronous: true
 			ImageMessage {}
 		}
 		DelegateChoice {
 			roleValue: MtxEvent.Sticker
+			asynchronous: true
 			ImageMessage {}
 		}
 		DelegateChoice {
@@ -52,10 +61,12 @@ Item {
 		}
 		DelegateChoice {
 			roleValue: MtxEvent.VideoMessage
+			asynchronous: true
 			PlayableMediaMessage {}
 		}
 		DelegateChoice {
 			roleValue: MtxEvent.AudioMessage
+			asynchronous: true
 			PlayableMediaMessage {}
 		}
 		DelegateChoice {
@@ -116,7 +127,14 @@ Item {
 		DelegateChoice {
 			roleValue: MtxEvent.Member
 			NoticeMessage {
-				text: timelineManager.timeline.formatMemberEvent(model.data.id);
+				text: model.data.collapsedCount > 1 ? timelineManager.timeline.formatMemberRun(model.data.id) : timelineManager.timeline.formatMemberEvent(model.data.id);
+
+				MouseArea {
+					anchors.fill: parent
+					enabled: model.data.collapsedCount > 1
+					cursorShape: Qt.PointingHandCursor
+					onClicked: timelineManager.timeline.expandMemberRun(model.data.id)
+				}
 			}
 		}
 		DelegateChoice {
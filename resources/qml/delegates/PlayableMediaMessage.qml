@@ -12,6 +12,18 @@ Rectangle {
 	height: content.height + 24
 	width: parent ? parent.width : undefined
 
+	// Taken from the player pool of the timeline on the first play and returned, when the
+	// message scrolls out of view.
+	property var media: null
+	property string mediaSource
+
+	function mediaPlayerTaken() {
+		media = null
+		button.state = "stopped"
+	}
+
+	Component.onDestruction: if (media) chat.releaseMediaPlayer(media)
+
 	Column { 
 		id: content
 		width: parent.width - 24
@@ -27,11 +39,12 @@ Rectangle {
 				source: model.data.thumbnailUrl.replace("mxc://", "image://MxcImage/")
 				asynchronous: true
 				fillMode: Image.PreserveAspectFit
+				sourceSize: timelineManager.imageSourceSize(videoContainer.width, videoContainer.height)
 
 				VideoOutput {
 					anchors.fill: parent
 					fillMode: VideoOutput.PreserveAspectFit
-					source: media
+					source: bg.media
 				}
 			}
 		}
@@ -46,11 +59,11 @@ Rectangle {
 			Slider {
 				Layout.fillWidth: true
 				id: progress
-				value: media.position
+				value: media ? media.position : 0
 				from: 0
-				to: media.duration
+				to: media ? media.duration : 0
 
-				onMoved: media.seek(value)
+				onMoved: if (media) media.seek(value)
 				//indeterminate: true
 				function updatePositionTexts() {
 					function formatTime(date) {
@@ -62,8 +75,8 @@ Rectangle {
 						if (ss < 10) {ss = "0"+ss;}
 						return hh+":"+mm+":"+ss;
 					}
-					positionText.text = formatTime(new Date(media.position))
-					durationText.text = formatTime(new Date(media.duration))
+					positionText.text = formatTime(new Date(media ? media.position : 0))
+					durationText.text = formatTime(new Date(media ? media.duration : 0))
 				}
 				onValueChanged: updatePositionTexts()
 
@@ -102,6 +115,10 @@ Rectangle {
 						switch (button.state) {
 							case "": timelineManager.timeline.cacheMedia(model.data.id); break;
 							case "stopped":
+							if (!media) {
+								media = chat.acquireMediaPlayer(bg)
+								media.source = mediaSource
+							}
 							media.play(); console.log("play");
 							button.state = "playing"
 							break
@@ -113,10 +130,9 @@ Rectangle {
 					}
 					cursorShape: Qt.PointingHandCursor
 				}
-				MediaPlayer {
-					id: media
-					onError: console.log(errorString)
-					onStatusChanged: if(status == MediaPlayer.Loaded) progress.updatePositionTexts()
+				Connections {
+					target: media
+					onStatusChanged: if (media.status == MediaPlayer.Loaded) progress.updatePositionTexts()
 					onStopped: button.state = "stopped"
 				}
 
@@ -124,7 +140,7 @@ Rectangle {
 					target: timelineManager.timeline
 					onMediaCached: {
 						if (mxcUrl == model.data.url) {
-							media.source = "file://" + cacheUrl
+							mediaSource = "file://" + cacheUrl
 							button.state = "stopped"
 							console.log("media loaded: " + mxcUrl + " at " + cacheUrl)
 						}
@@ -160,6 +176,23 @@ Rectangle {
 					elide: Text.ElideRight
 					color: colors.text
 				}
+				ProgressBar {
+					id: download
+					Layout.fillWidth: true
+					visible: false
+					indeterminate: to <= 0
+
+					Connections {
+						target: timelineManager.timeline
+						onMediaProgress: {
+							if (mxcUrl == model.data.url) {
+								download.to = total
+								download.value = received
+								download.visible = total <= 0 || received < total
+							}
+						}
+					}
+				}
 			}
 		}
 	}
@@ -15,7 +15,7 @@ Item {
 	MouseArea {
 		anchors.fill: parent
 		preventStealing: true
-		onClicked: chat.positionViewAtIndex(chat.model.idToIndex(timelineManager.replyingEvent), ListView.Contain)
+		onClicked: chat.model.showEvent(timelineManager.replyingEvent)
 		cursorShape: Qt.PointingHandCursor
 	}
 
@@ -2,6 +2,7 @@ import ".."
 
 MatrixText {
 	property string formatted: model.data.formattedBody
-	text: "<style type=\"text/css\">a { color:"+colors.link+";}</style>" + formatted.replace("<pre>", "<pre style='white-space: pre-wrap'>")
+	text: formatted.replace("<pre>", "<pre style='white-space: pre-wrap'>")
+	eventId: model.data.id
 	width: parent ? parent.width : undefined
 }
@@ -3,8 +3,6 @@
 import sys
 import re
 
-from jinja2 import Template
-
 
 class Emoji(object):
     def __init__(self, code, shortname):
@@ -12,16 +10,13 @@ class Emoji(object):
         self.shortname = shortname
 
 def generate_code(emojis, category):
-    tmpl = Template('''
-const std::vector<Emoji> emoji::Provider::{{ category }} = {
-    {%- for e in emoji %}
-        Emoji{QString::fromUtf8("{{ e.code }}"), "{{ e.shortname }}"},
-    {%- endfor %}
-};
-    ''')
-
-    d = dict(category=category, emoji=emojis)
-    print(tmpl.render(d))
+    # constexpr arrays of UTF-8 literals, so no emoji is constructed at startup.
+    print()
+    print('constexpr Emoji {}_[] = {{'.format(category))
+    for e in emojis:
+        print('  Emoji{{"{}", "{}"}},'.format(e.code, e.shortname))
+    print('};')
+    print('const Emojis emoji::Provider::{0}{{{0}_}};'.format(category))
 
 
 if __name__ == '__main__':
@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+
+# Makes a cache fixture for scripts/startup_benchmark.py without an account on a server.
+#
+# The fixture is a logged in session of @fixture:example.org with a homeserver, which isn't
+# reachable, and a generated initial sync of the given number of rooms. nheko replays the sync
+# into a new cache (see --replay-syncs) and quits, once the first room is shown. The sizes
+# small, medium and huge stand for the accounts the benchmark is usually run against.
+
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+USER = '@fixture:example.org'
+# Nothing listens on port 1, so every request fails right away.
+HOMESERVER = '127.0.0.1:1'
+FIRST_TS = 1600000000000
+
+SIZES = {
+    'small': (20, 20),
+    'medium': (200, 50),
+    'huge': (2000, 50),
+}
+
+WORDS = ['the', 'meeting', 'is', 'moved', 'to', 'tomorrow', 'please', 'review', 'my', 'patch',
+         'build', 'fails', 'on', 'arm64', 'thanks', 'lunch', 'anyone', 'deploy', 'release',
+         'notes', 'fixed', 'bug', 'ok', 'see', 'https://example.org/issue', 'later']
+
+
+def user_id(n):
+    return '@user{}:example.org'.format(n)
+
+
+def member_count(room):
+    # A few big rooms among many small ones, like a real account.
+    if room % 100 == 0:
+        return 2000
+    if room % 10 == 0:
+        return 300
+    return 2 + room % 30
+
+
+def state_event(room, event_type, state_key, content, n):
+    return {
+        'type': event_type,
+        'state_key': state_key,
+        'sender': USER,
+        'event_id': '$state{}_{}:example.org'.format(room, n),
+        'origin_server_ts': FIRST_TS,
+        'content': content,
+    }
+
+
+def room_state(room):
+    events = [
+        state_event(room, 'm.room.create', '', {'creator': USER}, 0),
+        state_event(room, 'm.room.join_rules', '', {'join_rule': 'invite'}, 1),
+        state_event(room, 'm.room.power_levels', '', {'users': {USER: 100}}, 2),
+    ]
+    if room % 3 != 0:
+        events.append(state_event(room, 'm.room.name', '', {'name': 'Room {}'.format(room)}, 3))
+
+    members = [USER] + [user_id((room * 37 + i) % 5000) for i in range(1, member_count(room))]
+    for i, member in enumerate(members):
+        event = state_event(room, 'm.room.member', member,
+                            {'membership': 'join', 'displayname': member[1:].split(':')[0]},
+                            4 + i)
+        event['sender'] = member
+        events.append(event)
+    return events, members
+
+
+def message(room, index, members):
+    words = 3 + (room + index * 7) % 40
+    body = ' '.join(WORDS[(room + index + i * 13) % len(WORDS)] for i in range(words))
+    return {
+        'type': 'm.room.message',
+        'sender': members[index % len(members)],
+        'event_id': '${}_{}:example.org'.format(room, index),
+        'origin_server_ts': FIRST_TS + room * 100000 + index * 1000,
+        'content': {'msgtype': 'm.text', 'body': body},
+    }
+
+
+def initial_sync(rooms, messages):
+    join = {}
+    for room in range(rooms):
+        state, members = room_state(room)
+        join['!room{}:example.org'.format(room)] = {
+            'state': {'events': state},
+            'timeline': {
+                'events': [message(room, i, members) for i in range(messages)],
+                'limited': True,
+                'prev_batch': 'p{}'.format(room),
+            },
+            'summary': {'m.joined_member_count': len(members)},
+        }
+    return {'next_batch': 'fixture', 'rooms': {'join': join}}
+
+
+def write_settings(home):
+    config = os.path.join(home, 'config', 'nheko')
+    os.makedirs(config, exist_ok=True)
+    with open(os.path.join(config, 'nheko.conf'), 'w') as f:
+        f.write('[auth]\n')
+        f.write('access_token=fixture\n')
+        f.write('device_id=FIXTURE\n')
+        f.write('home_server={}\n'.format(HOMESERVER))
+        f.write('user_id={}\n'.format(USER))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 4:
+        print('usage: make_startup_fixture.py /path/to/nheko /path/to/fixture '
+              'small|medium|huge|<rooms>x<messages>')
+        sys.exit(1)
+
+    nheko = sys.argv[1]
+    fixture = sys.argv[2]
+    size = sys.argv[3]
+    if size in SIZES:
+        rooms, messages = SIZES[size]
+    else:
+        rooms, messages = (int(n) for n in size.split('x'))
+
+    if os.path.exists(fixture):
+        print('{} exists already'.format(fixture))
+        sys.exit(1)
+
+    with tempfile.TemporaryDirectory() as tmp:
+        home = os.path.join(tmp, 'home')
+        write_settings(home)
+
+        replay = os.path.join(tmp, 'replay')
+        os.makedirs(replay)
+        with open(os.path.join(replay, '0.json'), 'w') as f:
+            json.dump(initial_sync(rooms, messages), f)
+
+        report = os.path.join(tmp, 'report.json')
+        env = dict(os.environ,
+                   XDG_CONFIG_HOME=os.path.join(home, 'config'),
+                   XDG_DATA_HOME=os.path.join(home, 'data'),
+                   XDG_CACHE_HOME=os.path.join(home, 'cache'))
+        subprocess.run([nheko, '--startup-benchmark', report, '--replay-syncs', replay,
+                        '--replay-into-profile'],
+                       env=env, check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+        # The benchmark quits after a minute, even if the replay didn't finish.
+        with open(report) as f:
+            milestones = json.loads(f.readline())
+        if milestones.get('startup: first sync') is None:
+            print('the sync was not saved in time, try a smaller fixture')
+            sys.exit(1)
+
+        shutil.copytree(home, fixture)
+
+    print('{} rooms with {} messages each in {}'.format(rooms, messages, fixture))
@@ -0,0 +1,98 @@
+#!/usr/bin/env python3
+
+# Starts nheko over and over against a cache fixture and reports the times of its startup
+# milestones (see src/Startup.h).
+#
+# A fixture is a directory with the config, data and cache directories of a logged in account.
+# scripts/make_startup_fixture.py generates one for a small, a medium and a huge account, whose
+# homeserver isn't reachable, so no request needs a stub. A real account works as well: run
+# nheko once with XDG_CONFIG_HOME, XDG_DATA_HOME and XDG_CACHE_HOME pointing into the fixture and
+# change its homeserver afterwards. Every run works on a copy, so the fixture isn't changed. No
+# sync is sent: the replay of an empty directory takes its place. nheko opens the first room
+# itself, so the runs are unattended.
+#
+# A cold run drops the page cache of the system first, which needs root. Otherwise only the
+# warm runs are reported.
+
+import json
+import os
+import shutil
+import statistics
+import subprocess
+import sys
+import tempfile
+
+
+def drop_page_cache():
+    try:
+        os.sync()
+        with open('/proc/sys/vm/drop_caches', 'w') as f:
+            f.write('3\n')
+        return True
+    except OSError:
+        return False
+
+
+def run(nheko, home, report):
+    env = dict(os.environ,
+               XDG_CONFIG_HOME=os.path.join(home, 'config'),
+               XDG_DATA_HOME=os.path.join(home, 'data'),
+               XDG_CACHE_HOME=os.path.join(home, 'cache'))
+    replay = os.path.join(home, 'replay')
+    os.makedirs(replay, exist_ok=True)
+    subprocess.run([nheko, '--startup-benchmark', report, '--replay-syncs', replay,
+                    '--replay-into-profile'],
+                   env=env, check=True, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+
+
+def summarize(name, runs):
+    print('{} ({} runs)'.format(name, len(runs)))
+    print('  {:<28} {:>10} {:>10} {:>10} {:>10}'.format('milestone', 'median', 'min', 'max',
+                                                      'stdev'))
+    for milestone in runs[0]:
+        times = [r[milestone] for r in runs if r[milestone] is not None]
+        if not times:
+            print('  {:<28} {:>10}'.format(milestone, 'not reached'))
+            continue
+        stdev = statistics.stdev(times) if len(times) > 1 else 0
+        print('  {:<28} {:>10.1f} {:>10.1f} {:>10.1f} {:>10.1f}'.format(
+            milestone, statistics.median(times), min(times), max(times), stdev))
+
+
+if __name__ == '__main__':
+    if len(sys.argv) < 3:
+        print('usage: startup_benchmark.py /path/to/nheko /path/to/fixture [runs]')
+        sys.exit(1)
+
+    nheko = sys.argv[1]
+    fixture = sys.argv[2]
+    runs = int(sys.argv[3]) if len(sys.argv) > 3 else 10
+
+    cold = []
+    warm = []
+    with tempfile.TemporaryDirectory() as tmp:
+        home = os.path.join(tmp, 'home')
+        shutil.copytree(fixture, home)
+
+        # The first run migrates the copy, if the fixture is older than the binary, and fills
+        # the page cache, so it isn't counted.
+        run(nheko, home, os.path.join(tmp, 'ignored.json'))
+
+        for _ in range(runs):
+            if drop_page_cache():
+                report = os.path.join(tmp, 'cold.json')
+                run(nheko, home, report)
+            report = os.path.join(tmp, 'warm.json')
+            run(nheko, home, report)
+
+        for name, results in (('cold', cold), ('warm', warm)):
+            path = os.path.join(tmp, name + '.json')
+            if os.path.exists(path):
+                with open(path) as f:
+                    results.extend(json.loads(line) for line in f if line.strip())
+
+    if not cold:
+        print('the page cache can only be dropped as root, so there are no cold runs')
+    for name, results in (('cold', cold), ('warm', warm)):
+        if results:
+            summarize(name, results)
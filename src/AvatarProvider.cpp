@@ -16,72 +16,285 @@
  */
 
 #include <QBuffer>
-#include <QPixmapCache>
+#include <QCache>
+#include <QCoreApplication>
+#include <QPointer>
+#include <algorithm>
+#include <deque>
 #include <memory>
-#include <unordered_map>
+#include <vector>
 
 #include "AvatarProvider.h"
 #include "Cache.h"
 #include "Logging.h"
 #include "MatrixClient.h"
+#include "MemoryGovernor.h"
+#include "NetworkUsage.h"
+#include "RequestScheduler.h"
 #include "Utils.h"
+#include "WorkerPools.h"
 
-static QPixmapCache avatar_cache;
+//! The size of the one image of an avatar, which is downloaded and stored in the media store.
+//! Every requested size is scaled from it.
+constexpr int SOURCE_SIZE = 256;
+//! The smallest size of the memory tier. The sizes double from here.
+constexpr int MIN_BUCKET = 32;
+
+namespace {
+struct Waiter
+{
+        QPointer<QObject> receiver;
+        int size;
+        AvatarCallback callback;
+};
+
+//! The memory tier holds the avatars at the bucket sizes. Its cost is in bytes. Only used from
+//! the GUI thread, since it holds pixmaps.
+QCache<QString, QPixmap> &
+memoryTier()
+{
+        static QCache<QString, QPixmap> tier(
+          static_cast<int>(memory::budget(memory::Layer::Avatars)));
+        return tier;
+}
+
+//! The requests waiting for the source image of an avatar url.
+QHash<QString, std::vector<Waiter>> pending_;
+
+//! Prefetches wait in a queue and only a few load at once, so they don't delay the avatars,
+//! which are shown.
+constexpr int MAX_PREFETCHES = 4;
+std::deque<std::pair<QString, int>> prefetchQueue_;
+//! The sizes of the running prefetches by url.
+QHash<QString, int> prefetching_;
+
+int
+bucket(int size)
+{
+        int b = MIN_BUCKET;
+        while (b < size)
+                b *= 2;
+        return b;
+}
+
+QString
+memoryKey(const QString &avatarUrl, int bucket)
+{
+        return QString("%1_%2").arg(avatarUrl).arg(bucket);
+}
+
+QString
+sourceKey(const QString &avatarUrl)
+{
+        return avatarUrl + "_avatar";
+}
+
+//! The avatar at its bucket size, scaled from the source and kept in the memory tier.
+QPixmap
+bucketPixmap(const QString &avatarUrl, int size, const QImage &source)
+{
+        const auto b   = bucket(size);
+        const auto key = memoryKey(avatarUrl, b);
+
+        if (auto pixmap = memoryTier().object(key))
+                return *pixmap;
+
+        auto pixmap = QPixmap::fromImage(
+          source.scaled(b, b, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation));
+        memoryTier().insert(key, new QPixmap(pixmap), pixmap.width() * pixmap.height() * 4);
+
+        return pixmap;
+}
+
+//! The pixmap of a bucket at the requested size.
+QPixmap
+sized(const QPixmap &pixmap, int size)
+{
+        if (size <= 0 || pixmap.width() == size)
+                return pixmap;
+
+        return pixmap.scaled(size, size, Qt::KeepAspectRatioByExpanding, Qt::SmoothTransformation);
+}
 
-namespace AvatarProvider {
 void
-resolve(const QString &avatarUrl, int size, QObject *receiver, AvatarCallback callback)
+loadSource(const QString &avatarUrl, http::Priority priority);
+
+void
+startPrefetches()
 {
-        const auto cacheKey = QString("%1_size_%2").arg(avatarUrl).arg(size);
+        while (prefetching_.size() < MAX_PREFETCHES && !prefetchQueue_.empty()) {
+                const auto [avatarUrl, size] = prefetchQueue_.front();
+                prefetchQueue_.pop_front();
 
-        if (avatarUrl.isEmpty())
-                return;
+                // It was requested or prefetched in the meantime.
+                if (pending_.contains(avatarUrl))
+                        continue;
 
-        QPixmap pixmap;
-        if (avatar_cache.find(cacheKey, &pixmap)) {
-                callback(pixmap);
-                return;
+                prefetching_.insert(avatarUrl, size);
+                pending_[avatarUrl];
+                loadSource(avatarUrl, http::Priority::Background);
         }
+}
 
-        auto data = cache::image(cacheKey);
-        if (!data.isNull()) {
-                pixmap = QPixmap::fromImage(utils::readImage(&data));
-                avatar_cache.insert(cacheKey, pixmap);
-                callback(pixmap);
-                return;
+void
+sourceLoaded(const QString &avatarUrl, const QImage &source)
+{
+        const auto waiters = pending_.take(avatarUrl);
+
+        if (prefetching_.contains(avatarUrl)) {
+                // Fill the memory tier, so the first request of the avatar doesn't wait.
+                const auto size = prefetching_.take(avatarUrl);
+                if (!source.isNull())
+                        bucketPixmap(avatarUrl, size, source);
+                startPrefetches();
         }
 
+        for (const auto &waiter : waiters) {
+                if (!waiter.receiver)
+                        continue;
+
+                if (!source.isNull())
+                        waiter.callback(
+                          sized(bucketPixmap(avatarUrl, waiter.size, source), waiter.size));
+        }
+}
+
+//! Load the source image of an avatar from the media store or download it, in the pool.
+void
+loadSource(const QString &avatarUrl, http::Priority priority)
+{
         auto proxy = std::make_shared<AvatarProxy>();
         QObject::connect(proxy.get(),
-                         &AvatarProxy::avatarDownloaded,
-                         receiver,
-                         [callback, cacheKey](QByteArray data) {
-                                 QPixmap pm = QPixmap::fromImage(utils::readImage(&data));
-                                 avatar_cache.insert(cacheKey, pm);
-                                 callback(pm);
-                         });
-
-        mtx::http::ThumbOpts opts;
-        opts.width   = size;
-        opts.height  = size;
-        opts.mxc_url = avatarUrl.toStdString();
-
-        http::client()->get_thumbnail(
-          opts,
-          [opts, cacheKey, proxy = std::move(proxy)](const std::string &res,
-                                                     mtx::http::RequestErr err) {
-                  if (err) {
-                          nhlog::net()->warn("failed to download avatar: {} - ({} {})",
-                                             opts.mxc_url,
-                                             mtx::errors::to_string(err->matrix_error.errcode),
-                                             err->matrix_error.error);
-                          return;
-                  }
-
-                  cache::saveImage(cacheKey.toStdString(), res);
-
-                  emit proxy->avatarDownloaded(QByteArray(res.data(), res.size()));
-          });
+                         &AvatarProxy::avatarDecoded,
+                         QCoreApplication::instance(),
+                         [avatarUrl](const QImage &image) { sourceLoaded(avatarUrl, image); });
+
+        // Avatars are decoded in the pool, so a large picture doesn't block the GUI thread. Only
+        // the QPixmaps have to be created in the GUI thread.
+        const auto workerPriority = priority == http::Priority::Background
+                                      ? workers::Priority::Background
+                                      : workers::Priority::Visible;
+        auto load = [avatarUrl, priority, workerPriority, proxy = std::move(proxy)]() {
+                const auto key = sourceKey(avatarUrl);
+
+                auto data = cache::image(key);
+                if (!data.isNull()) {
+                        emit proxy->avatarDecoded(
+                          utils::readImage(&data, QSize(SOURCE_SIZE, SOURCE_SIZE)));
+                        return;
+                }
+
+                mtx::http::ThumbOpts opts;
+                opts.width   = SOURCE_SIZE;
+                opts.height  = SOURCE_SIZE;
+                opts.mxc_url = avatarUrl.toStdString();
+
+                http::schedule(priority, [opts, key, proxy, workerPriority](auto slot) {
+                        http::countRequest(http::Traffic::Thumbnail);
+                        http::client()->get_thumbnail(
+                          opts,
+                          [slot, opts, key, proxy, workerPriority](const std::string &res,
+                                                                   mtx::http::RequestErr err) {
+                                  http::countBytes(http::Traffic::Thumbnail, res.size());
+                                  if (slot.retry(err))
+                                          return;
+
+                                  if (err) {
+                                          nhlog::net()->warn(
+                                            "failed to download avatar: {} - ({} {})",
+                                            opts.mxc_url,
+                                            mtx::errors::to_string(err->matrix_error.errcode),
+                                            err->matrix_error.error);
+                                          emit proxy->avatarDecoded(QImage());
+                                          return;
+                                  }
+
+                                  workers::run(
+                                    workers::Pool::Decode, workerPriority, [key, proxy, res]() {
+                                            auto data = QByteArray(res.data(), res.size());
+
+                                            // Only the downscaled avatar is stored, if the
+                                            // server sent a larger one.
+                                            bool downscaled = false;
+                                            auto image      = utils::readImage(
+                                              &data, QSize(SOURCE_SIZE, SOURCE_SIZE), &downscaled);
+                                            cache::saveImage(
+                                              key, downscaled ? utils::encodeImage(image) : data);
+
+                                            emit proxy->avatarDecoded(image);
+                                    });
+                          });
+                });
+        };
+        workers::run(workers::Pool::Decode, workerPriority, std::move(load));
+}
+
+void
+request(const QString &avatarUrl, Waiter waiter)
+{
+        if (auto pixmap = memoryTier().object(memoryKey(avatarUrl, bucket(waiter.size)))) {
+                waiter.callback(sized(*pixmap, waiter.size));
+                return;
+        }
+
+        // Every size of an avatar waits for the same source image.
+        auto &waiters       = pending_[avatarUrl];
+        const bool starting = waiters.empty();
+        waiters.push_back(std::move(waiter));
+
+        if (starting)
+                loadSource(avatarUrl, http::Priority::Visible);
+}
+}
+
+namespace AvatarProvider {
+void
+resolve(const QString &avatarUrl, int size, QObject *receiver, AvatarCallback callback)
+{
+        if (avatarUrl.isEmpty())
+                return;
+
+        request(avatarUrl, {receiver, size, std::move(callback)});
+}
+
+QPixmap
+cached(const QString &avatarUrl, int size)
+{
+        if (auto pixmap = memoryTier().object(memoryKey(avatarUrl, bucket(size))))
+                return sized(*pixmap, size);
+        return {};
+}
+
+void
+prefetch(const std::vector<std::pair<QString, int>> &avatars)
+{
+        // The queued prefetches of the previous call scrolled out of view.
+        prefetchQueue_.clear();
+
+        for (const auto &[avatarUrl, size] : avatars) {
+                if (avatarUrl.isEmpty() || pending_.contains(avatarUrl) ||
+                    memoryTier().contains(memoryKey(avatarUrl, bucket(size))))
+                        continue;
+
+                prefetchQueue_.emplace_back(avatarUrl, size);
+        }
+
+        startPrefetches();
+}
+
+std::size_t
+memoryUsage()
+{
+        return static_cast<std::size_t>(memoryTier().totalCost());
+}
+
+void
+trim(std::size_t bytes)
+{
+        // Lowering the maximum evicts the least recently used pixmaps right away.
+        auto &tier = memoryTier();
+        tier.setMaxCost(static_cast<int>(std::min<std::size_t>(bytes, tier.maxCost())));
+        tier.setMaxCost(static_cast<int>(memory::budget(memory::Layer::Avatars)));
 }
 
 void
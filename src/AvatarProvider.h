@@ -17,20 +17,28 @@
 
 #pragma once
 
+#include <QImage>
 #include <QPixmap>
+#include <cstddef>
 #include <functional>
+#include <utility>
+#include <vector>
 
 class AvatarProxy : public QObject
 {
         Q_OBJECT
 
 signals:
-        void avatarDownloaded(const QByteArray &data);
+        void avatarDecoded(const QImage &image);
 };
 
 using AvatarCallback = std::function<void(QPixmap)>;
 
+//! Avatars in three tiers: the pixmaps of a few sizes in memory, within the byte budget of the
+//! memory profile, one source image per avatar in the media store and the server.
+//! Every size is scaled from the source image, so an avatar is only downloaded once.
 namespace AvatarProvider {
+//! Call cb with the avatar at size, if receiver still exists when it is loaded.
 void
 resolve(const QString &avatarUrl, int size, QObject *receiver, AvatarCallback cb);
 void
@@ -39,4 +47,17 @@ resolve(const QString &room_id,
         int size,
         QObject *receiver,
         AvatarCallback cb);
+//! The avatar at size, if it is in memory, otherwise a null pixmap.
+QPixmap
+cached(const QString &avatarUrl, int size);
+//! Load avatars, which will probably be shown soon, into memory with a low priority. The
+//! prefetches of the previous call, which didn't start yet, are cancelled.
+void
+prefetch(const std::vector<std::pair<QString, int>> &avatars);
+//! The bytes used by the pixmaps in memory.
+std::size_t
+memoryUsage();
+//! Drop the least recently used pixmaps, until they use at most bytes.
+void
+trim(std::size_t bytes);
 }
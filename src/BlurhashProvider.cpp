@@ -1,14 +1,61 @@
 #include "BlurhashProvider.h"
 
 #include <algorithm>
+#include <atomic>
+#include <mutex>
 
+#include <QCache>
 #include <QUrl>
 
+#include "CacheStats.h"
 #include "blurhash.hpp"
 
+//! A blurhash has at most 9x9 components, so a small grid keeps all of its detail.
+constexpr int DECODE_SIZE = 32;
+//! Requested sizes are rounded up to steps of this, so resizing a delegate hits the cache.
+constexpr int SIZE_BUCKET = 64;
+//! The placeholders are small and flat, so a few MiB hold the ones of many rooms.
+constexpr int CACHE_BYTES = 16 * 1024 * 1024;
+
+namespace {
+std::mutex cache_mtx_;
+QCache<QString, QImage> cache_(CACHE_BYTES);
+
+std::atomic<uint64_t> decoded_{0};
+std::atomic<uint64_t> cache_hits_{0};
+std::atomic<uint64_t> cancelled_{0};
+
+int
+bucket(int size)
+{
+        return (size + SIZE_BUCKET - 1) / SIZE_BUCKET * SIZE_BUCKET;
+}
+}
+
+BlurhashStats
+BlurhashProvider::stats()
+{
+        BlurhashStats stats;
+        stats.decoded    = decoded_;
+        stats.cache_hits = cache_hits_;
+        stats.cancelled  = cancelled_;
+
+        std::unique_lock<std::mutex> lock(cache_mtx_);
+        stats.memory = static_cast<std::size_t>(cache_.totalCost());
+        return stats;
+}
+
 void
 BlurhashResponse::run()
 {
+        // A cancelled response still has to finish, so the engine deletes it.
+        if (m_cancelled) {
+                cancelled_++;
+                m_error = QStringLiteral("Cancelled");
+                emit finished();
+                return;
+        }
+
         if (m_requestedSize.width() < 0 || m_requestedSize.height() < 0) {
                 m_error = QStringLiteral("Blurhash needs size request");
                 emit finished();
@@ -21,9 +68,29 @@ BlurhashResponse::run()
                 return;
         }
 
+        // QML scales the image to the item anyway, so the size of the bucket is returned.
+        const QSize size(bucket(m_requestedSize.width()), bucket(m_requestedSize.height()));
+        const auto key = QString("%1_%2x%3").arg(m_id).arg(size.width()).arg(size.height());
+
+        {
+                std::unique_lock<std::mutex> lock(cache_mtx_);
+                if (auto image = cache_.object(key)) {
+                        cache_hits_++;
+                        m_image = *image;
+                        emit finished();
+                        return;
+                }
+        }
+
+        // The blurhash is decoded into a small grid with the aspect ratio of the request and
+        // then upscaled, which is much cheaper than evaluating the basis for every pixel.
+        const auto grid = size.scaled(DECODE_SIZE, DECODE_SIZE, Qt::KeepAspectRatio)
+                            .expandedTo(QSize(1, 1));
+
+        cache::LatencyTimer timer(NHEKO_METRIC("decode blurhash"));
         auto decoded = blurhash::decode(QUrl::fromPercentEncoding(m_id.toUtf8()).toStdString(),
-                                        m_requestedSize.width(),
-                                        m_requestedSize.height(),
+                                        grid.width(),
+                                        grid.height(),
                                         4);
         if (decoded.image.empty()) {
                 m_error = QStringLiteral("Failed decode!");
@@ -31,8 +98,17 @@ BlurhashResponse::run()
                 return;
         }
 
-        QImage image(decoded.image.data(), decoded.width, decoded.height, QImage::Format_RGB32);
+        decoded_++;
+
+        // The decoded pixels are RGB bytes followed by an opaque alpha byte.
+        QImage image(decoded.image.data(), decoded.width, decoded.height, QImage::Format_RGBX8888);
+
+        m_image = image.scaled(size, Qt::IgnoreAspectRatio, Qt::SmoothTransformation);
+
+        {
+                std::unique_lock<std::mutex> lock(cache_mtx_);
+                cache_.insert(key, new QImage(m_image), m_image.bytesPerLine() * m_image.height());
+        }
 
-        m_image = image.copy();
         emit finished();
 }
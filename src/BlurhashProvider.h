@@ -1,23 +1,35 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
 #include <QQuickAsyncImageProvider>
 #include <QQuickImageResponse>
 
 #include <QImage>
-#include <QThreadPool>
 
-class BlurhashResponse
-  : public QQuickImageResponse
-  , public QRunnable
+#include "WorkerPools.h"
+
+//! How the placeholders were served.
+struct BlurhashStats
+{
+        uint64_t decoded    = 0;
+        uint64_t cache_hits = 0;
+        //! Responses, which QML dropped before they were decoded.
+        uint64_t cancelled = 0;
+        //! The bytes of the decoded placeholders in memory.
+        std::size_t memory = 0;
+};
+
+class BlurhashResponse : public QQuickImageResponse
 {
 public:
         BlurhashResponse(const QString &id, const QSize &requestedSize)
 
           : m_id(id)
           , m_requestedSize(requestedSize)
-        {
-                setAutoDelete(false);
-        }
+        {}
 
         QQuickTextureFactory *textureFactory() const override
         {
@@ -25,11 +37,17 @@ public:
         }
         QString errorString() const override { return m_error; }
 
-        void run() override;
+        //! Decode the placeholder, in the decode pool.
+        void run();
+        //! Skip the decode, if it didn't start yet.
+        void cancel() override { m_cancelled = true; }
 
         QString m_id, m_error;
         QSize m_requestedSize;
         QImage m_image;
+
+private:
+        std::atomic_bool m_cancelled{false};
 };
 
 class BlurhashProvider
@@ -37,15 +55,18 @@ class BlurhashProvider
   , public QQuickAsyncImageProvider
 {
         Q_OBJECT
+public:
+        //! The counters of all providers.
+        static BlurhashStats stats();
+
 public slots:
         QQuickImageResponse *requestImageResponse(const QString &id,
                                                   const QSize &requestedSize) override
         {
                 BlurhashResponse *response = new BlurhashResponse(id, requestedSize);
-                pool.start(response);
+                workers::run(workers::Pool::Decode, workers::Priority::Visible, [response]() {
+                        response->run();
+                });
                 return response;
         }
-
-private:
-        QThreadPool pool;
 };
@@ -15,38 +15,189 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
 #include <limits>
+#include <set>
 #include <stdexcept>
+#include <string_view>
 #include <variant>
 
 #include <QByteArray>
 #include <QCoreApplication>
+#include <QCryptographicHash>
 #include <QFile>
+#include <QFileInfo>
 #include <QHash>
 #include <QMap>
+#include <QSaveFile>
 #include <QSettings>
 #include <QStandardPaths>
+#include <QtConcurrent>
 
 #include <mtx/responses/common.hpp>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
 
 #include "Cache.h"
+#include "CacheCompression.h"
 #include "Cache_p.h"
+#include "EventAccessors.h"
 #include "Logging.h"
 #include "Utils.h"
 
 //! Should be changed when a breaking change occurs in the cache format.
 //! This will reset client's data.
-static const std::string CURRENT_CACHE_FORMAT_VERSION("2018.09.21");
+static const std::string CURRENT_CACHE_FORMAT_VERSION("2020.05.11");
+//! The oldest cache format we can still migrate from.
+static const std::string OLDEST_MIGRATABLE_FORMAT_VERSION("2018.09.21");
 static const std::string SECRET("secret");
 
 static lmdb::val NEXT_BATCH_KEY("next_batch");
+//! In SYNC_STATE_DB before the 2020.05.09 format, in CRYPTO_STATE_DB since.
 static lmdb::val OLM_ACCOUNT_KEY("olm_account");
 static lmdb::val CACHE_FORMAT_VERSION_KEY("cache_format_version");
+//! The formats, whose background migrations didn't finish yet, as json array.
+static lmdb::val PENDING_MIGRATIONS_KEY("pending_migrations");
+//! The dictionary of the compressed messages since the 2020.05.11 format, see compression.
+static lmdb::val MESSAGES_DICTIONARY_KEY("messages_dictionary");
+//! The room list of the last session, which is shown while the cache is restored.
+static lmdb::val ROOM_LIST_SNAPSHOT_KEY("room_list_snapshot");
+//! The uploaded sync filters by name, with the definition they were uploaded for.
+static lmdb::val SYNC_FILTERS_KEY("sync_filters");
+//! The number of mentions in MENTIONS_DB, see MentionsSummary.
+static lmdb::val MENTIONS_SUMMARY_KEY("mentions_summary");
+//! The token of the next older page of mentions, while the mentions are fetched page by page.
+static lmdb::val MENTIONS_TOKEN_KEY("mentions_token");
+//! The RoomSummary of a joined room in its states db, merged from the syncs.
+static lmdb::val ROOM_SUMMARY_KEY("summary");
 
 constexpr size_t MAX_RESTORED_MESSAGES = 30'000;
+//! How many joined rooms of the initial sync are saved in one write txn.
+constexpr size_t INITIAL_SYNC_ROOMS_PER_TXN = 50;
+//! How many session keys are exported or imported at once, i.e. in one write transaction.
+constexpr size_t SESSION_KEYS_CHUNK = 1000;
+//! The missing inbound megolm sessions remembered per shard. Once there are more, they are
+//! forgotten, and looked up in the db once more.
+constexpr size_t MAX_MISSING_MEGOLM_SESSIONS_PER_SHARD = 256;
+//! An outbound megolm session is saved after that many messages or that long after the first
+//! unsaved message, whatever comes first.
+constexpr int OUTBOUND_MEGOLM_SAVE_MESSAGES = 20;
+constexpr std::chrono::milliseconds OUTBOUND_MEGOLM_SAVE_INTERVAL{5'000};
+//! How many messages the compaction deletes per transaction.
+constexpr size_t COMPACTION_CHUNK_SIZE = 500;
+//! How many entries a background migration writes per transaction, so the sync isn't blocked
+//! for long.
+constexpr size_t MIGRATION_CHUNK_SIZE = 1000;
+//! The newest messages of every room, which the dictionary of the compression is trained on,
+//! and how many it needs at least.
+constexpr size_t DICTIONARY_SAMPLES_PER_ROOM = 64;
+constexpr size_t MAX_DICTIONARY_SAMPLES      = 4096;
+constexpr size_t MIN_DICTIONARY_SAMPLES      = 256;
+
+//! Size of the media store in MB, if user/media_store_size is not set.
+constexpr uint64_t DEFAULT_MEDIA_STORE_SIZE_MB = 512;
+//! Eviction shrinks the media store to this fraction of its budget, so not every save evicts.
+constexpr double MEDIA_STORE_LOW_WATERMARK = 0.9;
+//! How outdated the access time of media may be, before reading it writes a new one.
+constexpr qint64 MEDIA_ATIME_RESOLUTION = 60 * 60;
+
+//! Rooms with at least that many members are large rooms, if user/large_room_members is not
+//! set. 0 turns the large rooms off.
+constexpr int DEFAULT_LARGE_ROOM_MEMBERS = 1000;
+
+//! How many decrypted events are kept. Eviction drops the oldest down to the low watermark.
+constexpr uint64_t MAX_DECRYPTED_EVENTS         = 50'000;
+constexpr double DECRYPTED_EVENTS_LOW_WATERMARK = 0.9;
+//! Larger events are decrypted again, when they are shown.
+constexpr std::size_t MAX_DECRYPTED_EVENT_SIZE = 64 * 1024;
+//! How many decrypted events are written in one transaction.
+constexpr std::size_t DECRYPTED_EVENTS_BATCH_SIZE = 64;
+//! The plaintext is sealed with AES-256-GCM.
+constexpr int PLAINTEXT_KEY_SIZE = 32;
+constexpr int PLAINTEXT_IV_SIZE  = 12;
+constexpr int PLAINTEXT_TAG_SIZE = 16;
+
+//! Durability of a commit, by the user/cache_durability setting. "full" syncs every commit to
+//! disk. "relaxed" skips syncing the meta page, so a system crash may undo the last commit, but
+//! can't corrupt the database. "fast" leaves syncing to flushToDisk. The kernel may write the
+//! pages of a commit in any order, so a system crash or power loss may corrupt the database and
+//! the cache has to be cleared. A crash of nheko alone loses nothing in any mode, as the kernel
+//! still writes its pages. The crypto environment always syncs every commit.
+static unsigned int
+durabilityFlags(const QString &mode)
+{
+        if (mode == "relaxed")
+                return MDB_NOMETASYNC;
+        if (mode == "fast")
+                return MDB_NOSYNC;
+
+        return 0;
+}
+
+//! Open the environment in a directory, which is created if necessary. The environment is
+//! created anew, if its files are from an incompatible LMDB version. Returns whether it was.
+static bool
+openEnvironment(lmdb::env &env, const QString &path)
+{
+        if (!QFile::exists(path)) {
+                nhlog::db()->info("initializing LMDB in {}", path.toStdString());
+
+                if (!QDir().mkpath(path)) {
+                        throw std::runtime_error(
+                          ("Unable to create state directory:" + path).toStdString().c_str());
+                }
+        }
+
+        // Read-only transactions are pooled and renewed by any thread.
+        try {
+                env.open(path.toStdString().c_str(), MDB_NOTLS);
+                return false;
+        } catch (const lmdb::error &e) {
+                if (e.code() != MDB_VERSION_MISMATCH && e.code() != MDB_INVALID) {
+                        throw std::runtime_error("LMDB initialization failed" +
+                                                 std::string(e.what()));
+                }
+
+                nhlog::db()->warn("resetting cache due to LMDB version mismatch: {}", e.what());
+        }
+
+        QDir dir(path);
+        for (const auto &file : dir.entryList(QDir::Files | QDir::NoDotAndDotDot)) {
+                if (!dir.remove(file))
+                        throw std::runtime_error(
+                          ("Unable to delete file " + file).toStdString().c_str());
+        }
+
+        env.open(path.toStdString().c_str(), MDB_NOTLS);
+        return true;
+}
 
-constexpr auto DB_SIZE = 32ULL * 1024ULL * 1024ULL * 1024ULL; // 32 GB
+//! Delete a directory in a thread of the global pool, which waits for it on exit.
+static void
+removeInBackground(const QString &path)
+{
+        QtConcurrent::run([path]() {
+                if (QDir(path).removeRecursively())
+                        nhlog::db()->info("deleted cache files from disk");
+                else
+                        nhlog::db()->warn("failed to delete {}", path.toStdString());
+        });
+}
+
+//! The map starts small and doubles, whenever it is full, up to MAX_DB_SIZE.
+constexpr std::size_t INITIAL_DB_SIZE = 256ULL * 1024ULL * 1024ULL; // 256 MB
+constexpr std::size_t MAX_DB_SIZE     = sizeof(void *) > 4
+                                      ? 32ULL * 1024ULL * 1024ULL * 1024ULL // 32 GB
+                                      : 1ULL * 1024ULL * 1024ULL * 1024ULL; // 1 GB
 constexpr auto MAX_DBS = 8092UL;
+//! The crypto environment holds only keys, so its map starts smaller, but grows the same way.
+constexpr std::size_t INITIAL_CRYPTO_DB_SIZE = 64ULL * 1024ULL * 1024ULL; // 64 MB
+constexpr std::size_t MAX_CRYPTO_DB_SIZE     = sizeof(void *) > 4
+                                             ? 16ULL * 1024ULL * 1024ULL * 1024ULL // 16 GB
+                                             : 512ULL * 1024ULL * 1024ULL;         // 512 MB
 
 //! Cache databases and their format.
 //!
@@ -54,28 +205,82 @@ constexpr auto MAX_DBS = 8092UL;
 //! Format: room_id -> RoomInfo
 constexpr auto ROOMS_DB("rooms");
 constexpr auto INVITES_DB("invites");
-//! Keeps already downloaded media for reuse.
+//! The left rooms, whose databases weren't reclaimed yet.
+//! Format: room_id -> empty
+constexpr auto REMOVED_ROOMS_DB("removed_rooms");
+//! Kept already downloaded media before the 2020.05.04 format. Only used during the migration.
 //! Format: matrix_url -> binary data.
 constexpr auto MEDIA_DB("media");
+//! Index of the media store, whose files live in the media directory.
+//! Format: cache key -> {file, size, atime}
+constexpr auto MEDIA_INDEX_DB("media_index");
 //! Information that  must be kept between sync requests.
 constexpr auto SYNC_STATE_DB("sync_state");
-//! Read receipts per room/event.
+//! Read receipts per room/event before the 2020.05.08 format. Only used during the migration.
+//! Format: receiptKey -> {user_id -> timestamp}
 constexpr auto READ_RECEIPTS_DB("read_receipts");
+//! The newest read receipt of every user of a room.
+//! Format: receiptKey(room_id, user_id) -> messageKey(timestamp, event_id)
+constexpr auto USER_RECEIPTS_DB("user_receipts");
 constexpr auto NOTIFICATIONS_DB("sent_notifications");
+//! Whether a joined room has unread messages, as last calculated from its read receipts.
+//! Format: room_id -> bool
+constexpr auto READ_STATUS_DB("read_status");
+//! Summary of the newest message of each room, as shown by the room list.
+//! Format: room_id -> {event_id, userid, body, ts}
+constexpr auto LAST_MESSAGES_DB("last_messages");
+//! The colors of the user names on a background, see utils::userColor.
+//! Format: background color -> [rgb by hue]
+constexpr auto USER_COLORS_DB("user_colors");
+//! The dimensions of the images, whose events didn't have them, see ImageDimensions.
+//! Format: mxc url -> [width, height]
+constexpr auto IMAGE_DIMENSIONS_DB("image_dimensions");
+//! The to-device messages of the syncs, which weren't handled yet. They are saved with the next
+//! batch token, since the server drops them, once the token is used.
+//! Format: zero padded sequence number -> json array of the messages
+constexpr auto PENDING_TO_DEVICE_DB("pending_to_device");
+//! The messages, which weren't acknowledged by the server yet.
+//! Format: outboxKey -> event with the transaction id as event id
+constexpr auto OUTBOX_DB("outbox");
+//! The mentions of the user in all rooms, as retrieved from the notifications.
+//! Format: messageKey(ts, event_id) -> notification
+constexpr auto MENTIONS_DB("mentions");
+//! The mentions by room. The notifications are in MENTIONS_DB.
+//! Format: room_id + '\0' + messageKey(ts, event_id) -> empty
+constexpr auto ROOM_MENTIONS_DB("room_mentions");
+//! The profiles and rooms of the joined communities.
+//! Format: group_id -> CommunityInfo
+constexpr auto COMMUNITIES_DB("communities");
+//! The tagged rooms by tag, an index of the tags in ROOMS_DB since the 2020.05.10 format.
+//! Format: tagKey(tag, room_id) -> empty
+constexpr auto TAGS_DB("tags");
 
 //! Encryption related databases.
 
 //! user_id -> list of devices
 constexpr auto DEVICES_DB("devices");
-//! device_id -> device keys
+//! user_id -> the verified keys of the devices of the user, see UserDeviceKeys
 constexpr auto DEVICE_KEYS_DB("device_keys");
 //! room_ids that have encryption enabled.
 constexpr auto ENCRYPTED_ROOMS_DB("encrypted_rooms");
-
+//! The plaintext of the decrypted events, sealed with the key in auth/plaintext_cache_key.
+//! Format: event_id -> iv + tag + encrypted event
+constexpr auto DECRYPTED_EVENTS_DB("decrypted_events");
+//! The order the decrypted events were saved in, for the eviction.
+//! Format: messageKey(saved ts, event_id) -> empty
+constexpr auto DECRYPTED_EVENTS_ORDER_DB("decrypted_events_order");
+
+//! The keys of the crypto environment. They were in the state environment before the
+//! 2020.05.09 format, along with the olm sessions of every device in "olm_sessions/<curve25519>".
+
+//! The pickled olm account.
+constexpr auto CRYPTO_STATE_DB("crypto_state");
 //! room_id -> pickled OlmInboundGroupSession
 constexpr auto INBOUND_MEGOLM_SESSIONS_DB("inbound_megolm_sessions");
 //! MegolmSessionIndex -> pickled OlmOutboundGroupSession
 constexpr auto OUTBOUND_MEGOLM_SESSIONS_DB("outbound_megolm_sessions");
+//! olmSessionUsageKey -> {last_used}, when the olm session last decrypted a message.
+constexpr auto OLM_SESSION_USAGE_DB("olm_session_usage");
 
 using CachedReceipts = std::multimap<uint64_t, std::string, std::greater<uint64_t>>;
 using Receipts       = std::map<std::string, std::map<std::string, uint64_t>>;
@@ -91,7 +296,9 @@ namespace {
 std::unique_ptr<Cache> instance_ = nullptr;
 }
 
-int
+//! Comparator of the per room message databases before the 2020.05.01 format, which used the
+//! decimal representation of the timestamp as the key. Only used during the migration.
+static int
 numeric_key_comparison(const MDB_val *a, const MDB_val *b)
 {
         auto lhs = std::stoull(std::string((char *)a->mv_data, a->mv_size));
@@ -105,19 +312,424 @@ numeric_key_comparison(const MDB_val *a, const MDB_val *b)
         return -1;
 }
 
+//! Whether the key is a decimal timestamp of the format before 2020.05.01. The keys of the
+//! current format start with the most significant byte of the timestamp, which is never a digit.
+static bool
+isLegacyMessageKey(std::string_view key)
+{
+        return !key.empty() &&
+               std::all_of(key.begin(), key.end(), [](char c) { return c >= '0' && c <= '9'; });
+}
+
+std::string
+messageKey(uint64_t timestamp, const std::string &event_id)
+{
+        std::string key(sizeof(timestamp), '\0');
+
+        for (std::size_t i = 0; i < sizeof(timestamp); i++)
+                key[i] = static_cast<char>((timestamp >> (8 * (sizeof(timestamp) - 1 - i))) & 0xff);
+
+        return key + event_id;
+}
+
+uint64_t
+messageKeyTimestamp(std::string_view key)
+{
+        uint64_t timestamp = 0;
+
+        for (std::size_t i = 0; i < sizeof(timestamp) && i < key.size(); i++)
+                timestamp = (timestamp << 8) | static_cast<unsigned char>(key[i]);
+
+        return timestamp;
+}
+
+std::string
+messageKeyEventId(std::string_view key)
+{
+        if (key.size() <= sizeof(uint64_t))
+                return {};
+
+        return std::string(key.substr(sizeof(uint64_t)));
+}
+
+//! The key of DECRYPTED_EVENTS_DB. It is kept in the settings, which are deleted on logout
+//! along with the cache, so a copy of the cache alone doesn't reveal the messages. Sets created,
+//! if there was no key yet. Empty, if user/encryption/cache_plaintext is off.
+static QByteArray
+plaintextKey(bool &created)
+{
+        created = false;
+
+        QSettings settings;
+        if (!settings.value("user/encryption/cache_plaintext", true).toBool())
+                return {};
+
+        auto key = QByteArray::fromBase64(settings.value("auth/plaintext_cache_key").toByteArray());
+        if (key.size() == PLAINTEXT_KEY_SIZE)
+                return key;
+
+        key = QByteArray(PLAINTEXT_KEY_SIZE, Qt::Uninitialized);
+        if (RAND_bytes(reinterpret_cast<unsigned char *>(key.data()), key.size()) != 1)
+                return {};
+
+        settings.setValue("auth/plaintext_cache_key", key.toBase64());
+        created = true;
+        return key;
+}
+
+//! Encrypt the plaintext of an event. The event id is authenticated too, so an entry can't be
+//! passed off as another event.
+static std::optional<std::string>
+sealPlaintext(const QByteArray &key, const std::string &event_id, const std::string &plaintext)
+{
+        std::string sealed(PLAINTEXT_IV_SIZE + PLAINTEXT_TAG_SIZE + plaintext.size(), '\0');
+        auto iv  = reinterpret_cast<unsigned char *>(&sealed[0]);
+        auto tag = iv + PLAINTEXT_IV_SIZE;
+        auto out = tag + PLAINTEXT_TAG_SIZE;
+        if (RAND_bytes(iv, PLAINTEXT_IV_SIZE) != 1)
+                return std::nullopt;
+
+        auto ctx = EVP_CIPHER_CTX_new();
+        if (!ctx)
+                return std::nullopt;
+
+        int length    = 0;
+        const bool ok =
+          EVP_EncryptInit_ex(ctx,
+                             EVP_aes_256_gcm(),
+                             nullptr,
+                             reinterpret_cast<const unsigned char *>(key.constData()),
+                             iv) == 1 &&
+          EVP_EncryptUpdate(ctx,
+                            nullptr,
+                            &length,
+                            reinterpret_cast<const unsigned char *>(event_id.data()),
+                            static_cast<int>(event_id.size())) == 1 &&
+          EVP_EncryptUpdate(ctx,
+                            out,
+                            &length,
+                            reinterpret_cast<const unsigned char *>(plaintext.data()),
+                            static_cast<int>(plaintext.size())) == 1 &&
+          EVP_EncryptFinal_ex(ctx, out + length, &length) == 1 &&
+          EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_GET_TAG, PLAINTEXT_TAG_SIZE, tag) == 1;
+        EVP_CIPHER_CTX_free(ctx);
+
+        if (!ok)
+                return std::nullopt;
+        return sealed;
+}
+
+//! Decrypt the plaintext sealed by sealPlaintext. Fails, if it was sealed with another key or
+//! for another event.
+static std::optional<std::string>
+openPlaintext(const QByteArray &key, const std::string &event_id, const std::string &sealed)
+{
+        if (sealed.size() < static_cast<std::size_t>(PLAINTEXT_IV_SIZE + PLAINTEXT_TAG_SIZE))
+                return std::nullopt;
+
+        std::string plaintext(sealed.size() - PLAINTEXT_IV_SIZE - PLAINTEXT_TAG_SIZE, '\0');
+        auto iv  = reinterpret_cast<const unsigned char *>(sealed.data());
+        auto tag = const_cast<unsigned char *>(iv + PLAINTEXT_IV_SIZE);
+        auto out = reinterpret_cast<unsigned char *>(&plaintext[0]);
+
+        auto ctx = EVP_CIPHER_CTX_new();
+        if (!ctx)
+                return std::nullopt;
+
+        int length    = 0;
+        const bool ok =
+          EVP_DecryptInit_ex(ctx,
+                             EVP_aes_256_gcm(),
+                             nullptr,
+                             reinterpret_cast<const unsigned char *>(key.constData()),
+                             iv) == 1 &&
+          EVP_DecryptUpdate(ctx,
+                            nullptr,
+                            &length,
+                            reinterpret_cast<const unsigned char *>(event_id.data()),
+                            static_cast<int>(event_id.size())) == 1 &&
+          EVP_DecryptUpdate(ctx,
+                            out,
+                            &length,
+                            tag + PLAINTEXT_TAG_SIZE,
+                            static_cast<int>(plaintext.size())) == 1 &&
+          EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, PLAINTEXT_TAG_SIZE, tag) == 1 &&
+          EVP_DecryptFinal_ex(ctx, out + length, &length) == 1;
+        EVP_CIPHER_CTX_free(ctx);
+
+        if (!ok)
+                return std::nullopt;
+        return plaintext;
+}
+
+std::string
+receiptKey(const std::string &room_id, const std::string &event_id)
+{
+        std::string key = room_id;
+        key.push_back('\0');
+
+        return key + event_id;
+}
+
+const nlohmann::json &
+rawTimelineEvents(const nlohmann::json &sync, const std::string &room_id)
+{
+        static const nlohmann::json none;
+
+        const nlohmann::json *node = &sync;
+        for (const auto &name : {std::string("rooms"),
+                                 std::string("join"),
+                                 room_id,
+                                 std::string("timeline"),
+                                 std::string("events")}) {
+                if (!node->is_object())
+                        return none;
+
+                auto child = node->find(name);
+                if (child == node->end())
+                        return none;
+
+                node = &*child;
+        }
+
+        return *node;
+}
+
+//! The summary of a joined room in a sync, which is empty, if the server didn't send one.
+static const RoomSummary &
+syncSummary(const std::map<std::string, RoomSummary> &summaries, const std::string &room_id)
+{
+        static const RoomSummary none;
+
+        auto summary = summaries.find(room_id);
+        return summary != summaries.end() ? summary->second : none;
+}
+
+//! A digest of the invite state of an invited room, which is never 0. A sync repeats an invite
+//! unchanged, until it is accepted or declined.
+static std::size_t
+inviteDigest(const mtx::responses::InvitedRoom &room)
+{
+        std::string state;
+        for (const auto &e : room.invite_state)
+                std::visit([&state](const auto &msg) { state += json(msg).dump(); }, e);
+
+        return std::max<std::size_t>(std::hash<std::string>{}(state), 1);
+}
+
+//! The room id followed by the transaction id, so the messages of a room are adjacent.
+std::string
+outboxKey(const std::string &room_id, const std::string &txn_id)
+{
+        std::string key = room_id;
+        key.push_back('\0');
+
+        return key + txn_id;
+}
+
+//! The tag followed by the room id, so the rooms of a tag are adjacent.
+std::string
+tagKey(const std::string &tag, const std::string &room_id)
+{
+        std::string key = tag;
+        key.push_back('\0');
+
+        return key + room_id;
+}
+
+std::string
+olmSessionUsageKey(const std::string &curve25519, const std::string &session_id)
+{
+        std::string key = curve25519;
+        key.push_back('\0');
+
+        return key + session_id;
+}
+
+json
+lastMessageToJson(const DescInfo &info)
+{
+        json obj;
+        obj["event_id"] = info.event_id.toStdString();
+        obj["userid"]   = info.userid.toStdString();
+        obj["body"]     = info.body.toStdString();
+        obj["ts"]       = info.datetime.toMSecsSinceEpoch();
+
+        return obj;
+}
+
+DescInfo
+lastMessageFromJson(const json &obj)
+{
+        const auto ts = QDateTime::fromMSecsSinceEpoch(obj.value("ts", qint64(0)));
+
+        // The time is described relative to now, so it can't be stored.
+        return DescInfo{QString::fromStdString(obj.value("event_id", "")),
+                        QString::fromStdString(obj.value("userid", "")),
+                        QString::fromStdString(obj.value("body", "")),
+                        utils::descriptiveTime(ts),
+                        ts};
+}
+
+//! The event without the keys, which a redaction removes, see the redaction algorithm of the
+//! spec. It keeps the redaction in its unsigned data, like the events the server sends.
+static json
+redactedEvent(const json &event, const json &redaction)
+{
+        static const std::set<std::string> keptKeys = {"auth_events",
+                                                       "content",
+                                                       "depth",
+                                                       "event_id",
+                                                       "hashes",
+                                                       "membership",
+                                                       "origin",
+                                                       "origin_server_ts",
+                                                       "prev_events",
+                                                       "prev_state",
+                                                       "room_id",
+                                                       "sender",
+                                                       "signatures",
+                                                       "state_key",
+                                                       "type"};
+        static const std::map<std::string, std::vector<std::string>> keptContent = {
+          {"m.room.aliases", {"aliases"}},
+          {"m.room.create", {"creator"}},
+          {"m.room.history_visibility", {"history_visibility"}},
+          {"m.room.join_rules", {"join_rule"}},
+          {"m.room.member", {"membership"}},
+          {"m.room.power_levels",
+           {"ban",
+            "events",
+            "events_default",
+            "kick",
+            "redact",
+            "state_default",
+            "users",
+            "users_default"}},
+        };
+
+        json redacted = json::object();
+        for (auto it = event.begin(); it != event.end(); ++it)
+                if (keptKeys.count(it.key()) != 0)
+                        redacted[it.key()] = it.value();
+
+        json content = json::object();
+        if (auto keys = keptContent.find(event.value("type", "")); keys != keptContent.end()) {
+                const auto &original = event.value("content", json::object());
+                for (const auto &key : keys->second)
+                        if (original.count(key) != 0)
+                                content[key] = original.at(key);
+        }
+        redacted["content"] = std::move(content);
+
+        redacted["unsigned"] = {{"redacted_by", redaction.value("event_id", "")},
+                                {"redacted_because", redaction}};
+        return redacted;
+}
+
+//! The mxc urls of the media of an event, e.g. of an image and its thumbnail.
+static std::vector<std::string>
+mediaUrls(const json &event)
+{
+        std::vector<std::string> urls;
+
+        const auto content = event.value("content", json::object());
+        const auto info    = content.value("info", json::object());
+        for (const auto &url : {content.value("url", ""),
+                                content.value("file", json::object()).value("url", ""),
+                                info.value("thumbnail_url", ""),
+                                info.value("thumbnail_file", json::object()).value("url", "")})
+                if (!url.empty())
+                        urls.push_back(url);
+
+        return urls;
+}
+
+std::string
+encodeValue(const nlohmann::json &j)
+{
+        const auto bytes = nlohmann::json::to_cbor(j);
+
+        return std::string(bytes.begin(), bytes.end());
+}
+
+nlohmann::json
+decodeValue(const std::string &data)
+{
+        return decodeValue(lmdb::val(data.data(), data.size()));
+}
+
+std::string
+encodeMessage(const nlohmann::json &j)
+{
+        return compression::compress(encodeValue(j));
+}
+
+nlohmann::json
+decodeValue(const lmdb::val &data)
+{
+        if (compression::isCompressed(view(data))) {
+                const auto decompressed = compression::decompress(view(data));
+                if (!decompressed)
+                        throw compression::Error("failed to decompress a value of " +
+                                                 std::to_string(data.size()) + " bytes");
+
+                return decodeValue(*decompressed);
+        }
+
+        const auto begin = reinterpret_cast<const uint8_t *>(data.data());
+        const auto end   = begin + data.size();
+
+        // All our values are objects and a CBOR map never starts with '{'.
+        if (data.size() > 0 && data.data()[0] == '{')
+                return nlohmann::json::parse(begin, end);
+
+        return nlohmann::json::from_cbor(begin, end);
+}
+
+//! A stored message, or an empty object, if it is corrupt. Where the messages are iterated, a
+//! corrupt one is skipped like a value without an event, instead of failing all of them.
+static json
+decodeMessage(const lmdb::val &data)
+{
+        try {
+                return decodeValue(data);
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("skipping a corrupt message: {}", e.what());
+                return json::object();
+        }
+}
+
 Cache::Cache(const QString &userId, QObject *parent)
   : QObject{parent}
   , env_{nullptr}
+  , cryptoEnv_{nullptr}
   , syncStateDb_{0}
   , roomsDb_{0}
   , invitesDb_{0}
-  , mediaDb_{0}
-  , readReceiptsDb_{0}
+  , removedRoomsDb_{0}
+  , mediaIndexDb_{0}
+  , userReceiptsDb_{0}
   , notificationsDb_{0}
+  , readStatusDb_{0}
+  , lastMessagesDb_{0}
+  , userColorsDb_{0}
+  , imageDimensionsDb_{0}
+  , pendingToDeviceDb_{0}
+  , outboxDb_{0}
+  , mentionsDb_{0}
+  , roomMentionsDb_{0}
+  , communitiesDb_{0}
+  , tagsDb_{0}
   , devicesDb_{0}
   , deviceKeysDb_{0}
   , inboundMegolmSessionDb_{0}
   , outboundMegolmSessionDb_{0}
+  , olmSessionUsageDb_{0}
+  , cryptoStateDb_{0}
+  , encryptedRoomsDb_{0}
+  , decryptedEventsDb_{0}
+  , decryptedEventsOrderDb_{0}
   , localUserId_{userId}
 {
         setup();
@@ -135,60 +747,155 @@ Cache::setup()
         cacheDirectory_ = QString("%1/%2")
                             .arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
                             .arg(QString::fromUtf8(localUserId_.toUtf8().toHex()));
+        mediaDirectory_ = cacheDirectory_ + "/media";
+
+        // Finish deleting the caches of earlier logouts, which were interrupted.
+        const QFileInfo cacheInfo(cacheDirectory_);
+        for (const auto &removed : cacheInfo.dir().entryList(
+               {cacheInfo.fileName() + ".removed-*"}, QDir::Dirs | QDir::NoDotAndDotDot))
+                removeInBackground(cacheInfo.dir().filePath(removed));
 
-        bool isInitial = !QFile::exists(statePath);
+        mediaBudget_ = QSettings()
+                         .value("user/media_store_size", DEFAULT_MEDIA_STORE_SIZE_MB)
+                         .toULongLong() *
+                       1024ULL * 1024ULL;
+        largeRoomMembers_ =
+          QSettings().value("user/large_room_members", DEFAULT_LARGE_ROOM_MEMBERS).toInt();
 
         env_ = lmdb::env::create();
-        env_.set_mapsize(DB_SIZE);
+        env_.set_mapsize(INITIAL_DB_SIZE);
         env_.set_max_dbs(MAX_DBS);
 
-        if (isInitial) {
-                nhlog::db()->info("initializing LMDB");
+        // The media files are useless without their index.
+        if (openEnvironment(env_, statePath))
+                QDir(mediaDirectory_).removeRecursively();
 
-                if (!QDir().mkpath(statePath)) {
-                        throw std::runtime_error(
-                          ("Unable to create state directory:" + statePath).toStdString().c_str());
-                }
-        }
+        // Reopening adopts the size of the existing data, which leaves no room to grow.
+        auto sizes = mapSizeInfo();
+        auto size  = sizes.map_size;
+        while (size < sizes.used_size * 2 && size < MAX_DB_SIZE)
+                size = std::min(size * 2, MAX_DB_SIZE);
+        if (size != sizes.map_size)
+                env_.set_mapsize(size);
 
-        try {
-                env_.open(statePath.toStdString().c_str());
-        } catch (const lmdb::error &e) {
-                if (e.code() != MDB_VERSION_MISMATCH && e.code() != MDB_INVALID) {
-                        throw std::runtime_error("LMDB initialization failed" +
-                                                 std::string(e.what()));
-                }
+        nhlog::db()->info("map size {} bytes, {} used", size, sizes.used_size);
 
-                nhlog::db()->warn("resetting cache due to LMDB version mismatch: {}", e.what());
+        setDurability(QSettings().value("user/cache_durability", "full").toString());
+        compression::setEnabled(QSettings().value("user/cache_compression", true).toBool());
 
-                QDir stateDir(statePath);
+        // Every commit of the crypto environment is synced, whatever the durability setting.
+        cryptoEnv_ = lmdb::env::create();
+        cryptoEnv_.set_mapsize(INITIAL_CRYPTO_DB_SIZE);
+        cryptoEnv_.set_max_dbs(MAX_DBS);
+        openEnvironment(cryptoEnv_, cacheDirectory_ + "/crypto");
 
-                for (const auto &file : stateDir.entryList(QDir::NoDotAndDotDot)) {
-                        if (!stateDir.remove(file))
-                                throw std::runtime_error(
-                                  ("Unable to delete file " + file).toStdString().c_str());
-                }
+        auto cryptoSizes = mapSizeInfo(cryptoEnv_);
+        auto cryptoSize  = cryptoSizes.map_size;
+        while (cryptoSize < cryptoSizes.used_size * 2 && cryptoSize < MAX_CRYPTO_DB_SIZE)
+                cryptoSize = std::min(cryptoSize * 2, MAX_CRYPTO_DB_SIZE);
+        if (cryptoSize != cryptoSizes.map_size)
+                cryptoEnv_.set_mapsize(cryptoSize);
 
-                env_.open(statePath.toStdString().c_str());
+        {
+                auto txn       = beginCryptoTxn();
+                cryptoStateDb_ = lmdb::dbi::open(txn, CRYPTO_STATE_DB, MDB_CREATE);
+                inboundMegolmSessionDb_ =
+                  lmdb::dbi::open(txn, INBOUND_MEGOLM_SESSIONS_DB, MDB_CREATE);
+                outboundMegolmSessionDb_ =
+                  lmdb::dbi::open(txn, OUTBOUND_MEGOLM_SESSIONS_DB, MDB_CREATE);
+                olmSessionUsageDb_ = lmdb::dbi::open(txn, OLM_SESSION_USAGE_DB, MDB_CREATE);
+                txn.commit();
         }
 
-        auto txn         = lmdb::txn::begin(env_);
+        auto txn         = beginTxn();
         syncStateDb_     = lmdb::dbi::open(txn, SYNC_STATE_DB, MDB_CREATE);
         roomsDb_         = lmdb::dbi::open(txn, ROOMS_DB, MDB_CREATE);
         invitesDb_       = lmdb::dbi::open(txn, INVITES_DB, MDB_CREATE);
-        mediaDb_         = lmdb::dbi::open(txn, MEDIA_DB, MDB_CREATE);
-        readReceiptsDb_  = lmdb::dbi::open(txn, READ_RECEIPTS_DB, MDB_CREATE);
+        removedRoomsDb_  = lmdb::dbi::open(txn, REMOVED_ROOMS_DB, MDB_CREATE);
+        mediaIndexDb_    = lmdb::dbi::open(txn, MEDIA_INDEX_DB, MDB_CREATE);
+        userReceiptsDb_  = lmdb::dbi::open(txn, USER_RECEIPTS_DB, MDB_CREATE);
         notificationsDb_ = lmdb::dbi::open(txn, NOTIFICATIONS_DB, MDB_CREATE);
+        readStatusDb_    = lmdb::dbi::open(txn, READ_STATUS_DB, MDB_CREATE);
+        lastMessagesDb_  = lmdb::dbi::open(txn, LAST_MESSAGES_DB, MDB_CREATE);
+        userColorsDb_    = lmdb::dbi::open(txn, USER_COLORS_DB, MDB_CREATE);
+        outboxDb_        = lmdb::dbi::open(txn, OUTBOX_DB, MDB_CREATE);
+        mentionsDb_      = lmdb::dbi::open(txn, MENTIONS_DB, MDB_CREATE);
+        roomMentionsDb_  = lmdb::dbi::open(txn, ROOM_MENTIONS_DB, MDB_CREATE);
+        communitiesDb_   = lmdb::dbi::open(txn, COMMUNITIES_DB, MDB_CREATE);
+        tagsDb_          = lmdb::dbi::open(txn, TAGS_DB, MDB_CREATE);
+
+        imageDimensionsDb_ = lmdb::dbi::open(txn, IMAGE_DIMENSIONS_DB, MDB_CREATE);
+        pendingToDeviceDb_ = lmdb::dbi::open(txn, PENDING_TO_DEVICE_DB, MDB_CREATE);
 
         // Device management
         devicesDb_    = lmdb::dbi::open(txn, DEVICES_DB, MDB_CREATE);
         deviceKeysDb_ = lmdb::dbi::open(txn, DEVICE_KEYS_DB, MDB_CREATE);
 
-        // Session management
-        inboundMegolmSessionDb_  = lmdb::dbi::open(txn, INBOUND_MEGOLM_SESSIONS_DB, MDB_CREATE);
-        outboundMegolmSessionDb_ = lmdb::dbi::open(txn, OUTBOUND_MEGOLM_SESSIONS_DB, MDB_CREATE);
+        encryptedRoomsDb_ = lmdb::dbi::open(txn, ENCRYPTED_ROOMS_DB, MDB_CREATE);
+
+        decryptedEventsDb_      = lmdb::dbi::open(txn, DECRYPTED_EVENTS_DB, MDB_CREATE);
+        decryptedEventsOrderDb_ = lmdb::dbi::open(txn, DECRYPTED_EVENTS_ORDER_DB, MDB_CREATE);
+
+        // The plaintext sealed with a lost key can't be opened anymore, and without a key it
+        // isn't kept at all.
+        bool newPlaintextKey = false;
+        plaintextKey_        = plaintextKey(newPlaintextKey);
+        if (plaintextKey_.isEmpty() || newPlaintextKey) {
+                lmdb::dbi_drop(txn, decryptedEventsDb_, false);
+                lmdb::dbi_drop(txn, decryptedEventsOrderDb_, false);
+        }
+
+        std::string key, entry;
+
+        auto encryptedRooms = std::make_shared<std::unordered_set<std::string>>();
+        auto roomsCursor    = lmdb::cursor::open(txn, encryptedRoomsDb_);
+        while (roomsCursor.get(key, entry, MDB_NEXT))
+                encryptedRooms->insert(key);
+        roomsCursor.close();
+        std::atomic_store(&encryptedRooms_,
+                          std::shared_ptr<const std::unordered_set<std::string>>(
+                            std::move(encryptedRooms)));
+
+        // Without a dictionary, e.g. of the cache of another account, the messages are
+        // compressed without one, until it is trained.
+        lmdb::val dictionary;
+        if (lmdb::dbi_get(txn, syncStateDb_, MESSAGES_DICTIONARY_KEY, dictionary))
+                compression::setDictionary(std::string(dictionary.data(), dictionary.size()));
+        else
+                compression::setDictionary({});
+
+        auto invitesCursor = lmdb::cursor::open(txn, invitesDb_);
+        while (invitesCursor.get(key, entry, MDB_NEXT))
+                invites_.emplace(key, 0);
+        invitesCursor.close();
+
+        uint64_t mediaSize = 0;
+
+        auto cursor = lmdb::cursor::open(txn, mediaIndexDb_);
+        while (cursor.get(key, entry, MDB_NEXT)) {
+                try {
+                        mediaSize += decodeValue(entry).value("size", uint64_t(0));
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse media entry {}: {}", key, e.what());
+                }
+        }
+        cursor.close();
 
         txn.commit();
+
+        mediaSize_ = mediaSize;
+
+        if (!QDir().mkpath(mediaDirectory_))
+                nhlog::db()->critical("unable to create media directory: {}",
+                                      mediaDirectory_.toStdString());
+
+        if (QSettings().value("user/search/index_messages", true).toBool()) {
+                try {
+                        messageIndex_ = std::make_unique<MessageIndex>(cacheDirectory_ + "/search");
+                } catch (const std::exception &e) {
+                        nhlog::db()->critical("failed to open the message index: {}", e.what());
+                }
+        }
 }
 
 void
@@ -196,74 +903,159 @@ Cache::setEncryptedRoom(lmdb::txn &txn, const std::string &room_id)
 {
         nhlog::db()->info("mark room {} as encrypted", room_id);
 
-        auto db = lmdb::dbi::open(txn, ENCRYPTED_ROOMS_DB, MDB_CREATE);
-        lmdb::dbi_put(txn, db, lmdb::val(room_id), lmdb::val("0"));
+        lmdb::dbi_put(txn, encryptedRoomsDb_, lmdb::val(room_id), lmdb::val("0"));
+
+        std::lock_guard lock(encryptedRoomsMutex_);
+
+        const auto rooms = std::atomic_load(&encryptedRooms_);
+        if (rooms->count(room_id))
+                return;
+
+        // If txn is aborted, the room is encrypted by the next sync again.
+        auto updated = std::make_shared<std::unordered_set<std::string>>(*rooms);
+        updated->insert(room_id);
+        std::atomic_store(&encryptedRooms_,
+                          std::shared_ptr<const std::unordered_set<std::string>>(
+                            std::move(updated)));
 }
 
 bool
 Cache::isRoomEncrypted(const std::string &room_id)
 {
-        lmdb::val unused;
-
-        auto txn = lmdb::txn::begin(env_);
-        auto db  = lmdb::dbi::open(txn, ENCRYPTED_ROOMS_DB, MDB_CREATE);
-        auto res = lmdb::dbi_get(txn, db, lmdb::val(room_id), unused);
-        txn.commit();
-
-        return res;
+        return std::atomic_load(&encryptedRooms_)->count(room_id) > 0;
 }
 
-mtx::crypto::ExportedSessionKeys
-Cache::exportSessionKeys()
+std::optional<mtx::crypto::ExportedSessionKeys>
+Cache::exportSessionKeys(const std::function<bool(std::size_t, std::size_t)> &progress)
 {
         using namespace mtx::crypto;
 
+        struct Entry
+        {
+                std::string key;
+                std::string pickled;
+                std::optional<ExportedSession> exported;
+        };
+
+        // Unpickling and exporting each session is the expensive part, so every chunk is
+        // processed on all cores.
+        auto exportChunk = [](std::vector<Entry> &chunk, ExportedSessionKeys &keys) {
+                QtConcurrent::blockingMap(chunk, [](Entry &entry) {
+                        try {
+                                const auto index =
+                                  nlohmann::json::parse(entry.key).get<MegolmSessionIndex>();
+                                auto session =
+                                  unpickle<InboundSessionObject>(entry.pickled, SECRET);
+
+                                ExportedSession exported;
+                                exported.room_id     = index.room_id;
+                                exported.sender_key  = index.sender_key;
+                                exported.session_id  = index.session_id;
+                                exported.session_key = export_session(session.get());
+                                entry.exported       = std::move(exported);
+                        } catch (const nlohmann::json::exception &e) {
+                                nhlog::db()->critical("failed to export megolm session: {}",
+                                                      e.what());
+                        } catch (const olm_exception &e) {
+                                nhlog::db()->critical("failed to export megolm session: {}",
+                                                      e.what());
+                        }
+                });
+
+                for (auto &entry : chunk) {
+                        if (entry.exported)
+                                keys.sessions.push_back(std::move(*entry.exported));
+                }
+                chunk.clear();
+        };
+
+        cache::LatencyTimer timer(NHEKO_METRIC("exportSessionKeys"));
         ExportedSessionKeys keys;
 
-        auto txn    = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        auto cursor = lmdb::cursor::open(txn, inboundMegolmSessionDb_);
+        auto txn         = beginCryptoTxn(MDB_RDONLY);
+        const auto total = inboundMegolmSessionDb_.size(txn);
+        std::size_t done = 0;
+        auto cursor      = lmdb::cursor::open(txn, inboundMegolmSessionDb_);
 
+        std::vector<Entry> chunk;
         std::string key, value;
         while (cursor.get(key, value, MDB_NEXT)) {
-                ExportedSession exported;
-                MegolmSessionIndex index;
-
-                auto saved_session = unpickle<InboundSessionObject>(value, SECRET);
-
-                try {
-                        index = nlohmann::json::parse(key).get<MegolmSessionIndex>();
-                } catch (const nlohmann::json::exception &e) {
-                        nhlog::db()->critical("failed to export megolm session: {}", e.what());
+                chunk.push_back({std::move(key), std::move(value), std::nullopt});
+                if (chunk.size() < SESSION_KEYS_CHUNK)
                         continue;
-                }
 
-                exported.room_id     = index.room_id;
-                exported.sender_key  = index.sender_key;
-                exported.session_id  = index.session_id;
-                exported.session_key = export_session(saved_session.get());
-
-                keys.sessions.push_back(exported);
+                done += chunk.size();
+                exportChunk(chunk, keys);
+                if (progress && !progress(done, total))
+                        return std::nullopt;
         }
 
+        done += chunk.size();
+        exportChunk(chunk, keys);
+
         cursor.close();
         txn.commit();
 
+        if (progress)
+                progress(done, total);
+
+        cache::recordCount(NHEKO_METRIC("exportSessionKeys sessions"), keys.sessions.size());
         return keys;
 }
 
-void
-Cache::importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys)
+bool
+Cache::importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys,
+                         const std::function<bool(std::size_t, std::size_t)> &progress)
 {
-        for (const auto &s : keys.sessions) {
-                MegolmSessionIndex index;
-                index.room_id    = s.room_id;
-                index.session_id = s.session_id;
-                index.sender_key = s.sender_key;
+        struct Entry
+        {
+                const mtx::crypto::ExportedSession *exported = nullptr;
+                mtx::crypto::InboundGroupSessionPtr session;
+        };
+
+        cache::LatencyTimer timer(NHEKO_METRIC("importSessionKeys"));
+
+        const auto total = keys.sessions.size();
+        cache::recordCount(NHEKO_METRIC("importSessionKeys sessions"), total);
+        for (std::size_t start = 0; start < total; start += SESSION_KEYS_CHUNK) {
+                const auto end = std::min(start + SESSION_KEYS_CHUNK, total);
+
+                std::vector<Entry> chunk(end - start);
+                for (std::size_t i = start; i < end; i++)
+                        chunk[i - start].exported = &keys.sessions[i];
+
+                QtConcurrent::blockingMap(chunk, [](Entry &entry) {
+                        try {
+                                entry.session =
+                                  mtx::crypto::import_session(entry.exported->session_key);
+                        } catch (const mtx::crypto::olm_exception &e) {
+                                nhlog::db()->warn("failed to import megolm session {}: {}",
+                                                  entry.exported->session_id,
+                                                  e.what());
+                        }
+                });
+
+                std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>>
+                  sessions;
+                for (auto &entry : chunk) {
+                        if (!entry.session)
+                                continue;
 
-                auto exported_session = mtx::crypto::import_session(s.session_key);
+                        MegolmSessionIndex index;
+                        index.room_id    = entry.exported->room_id;
+                        index.session_id = entry.exported->session_id;
+                        index.sender_key = entry.exported->sender_key;
+                        sessions.emplace_back(std::move(index), std::move(entry.session));
+                }
+
+                // One write transaction per chunk.
+                saveInboundMegolmSessions(std::move(sessions));
 
-                saveInboundMegolmSession(index, std::move(exported_session));
+                if (progress && !progress(end, total))
+                        return false;
         }
+
+        return true;
 }
 
 //
@@ -273,86 +1065,380 @@ Cache::importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys)
 void
 Cache::saveInboundMegolmSession(const MegolmSessionIndex &index,
                                 mtx::crypto::InboundGroupSessionPtr session)
+{
+        std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>> sessions;
+        sessions.emplace_back(index, std::move(session));
+
+        saveInboundMegolmSessions(std::move(sessions));
+}
+
+void
+Cache::saveInboundMegolmSessions(
+  std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>> sessions)
 {
         using namespace mtx::crypto;
-        const auto key     = json(index).dump();
-        const auto pickled = pickle<InboundSessionObject>(session.get(), SECRET);
 
-        auto txn = lmdb::txn::begin(env_);
-        lmdb::dbi_put(txn, inboundMegolmSessionDb_, lmdb::val(key), lmdb::val(pickled));
-        txn.commit();
+        if (sessions.empty())
+                return;
 
-        {
-                std::unique_lock<std::mutex> lock(session_storage.group_inbound_mtx);
-                session_storage.group_inbound_sessions[key] = std::move(session);
+        std::vector<std::string> keys;
+        keys.reserve(sessions.size());
+
+        std::vector<std::string> pickled;
+        pickled.reserve(sessions.size());
+        for (const auto &[index, session] : sessions) {
+                keys.push_back(json(index).dump());
+                pickled.push_back(pickle<InboundSessionObject>(session.get(), SECRET));
+        }
+
+        auto save = [this, &keys, &pickled](std::size_t first, std::size_t last) {
+                writeCrypto([&](lmdb::txn &txn) {
+                        for (std::size_t i = first; i < last; i++)
+                                lmdb::dbi_put(txn,
+                                              inboundMegolmSessionDb_,
+                                              lmdb::val(keys[i]),
+                                              lmdb::val(pickled[i]));
+                });
+        };
+
+        // A session, which couldn't be saved, is still used. It is saved again, when it is
+        // evicted, like a session, which decrypted messages.
+        std::vector<bool> unsaved(sessions.size(), false);
+        try {
+                save(0, sessions.size());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn(
+                  "failed to save {} megolm sessions, saving them one by one: {}",
+                  sessions.size(),
+                  e.what());
+
+                for (std::size_t i = 0; i < sessions.size(); i++) {
+                        try {
+                                save(i, i + 1);
+                        } catch (const lmdb::error &e) {
+                                nhlog::db()->critical(
+                                  "failed to save megolm session {}: {}", keys[i], e.what());
+                                unsaved[i] = true;
+                        }
+                }
+        }
+
+        std::map<QString, QStringList> received;
+        for (std::size_t i = 0; i < sessions.size(); i++) {
+                auto &shard = inboundMegolmShard(keys[i]);
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                auto entry =
+                  cacheInboundMegolmSession(shard, keys[i], std::move(sessions[i].second));
+                entry->used = unsaved[i];
+
+                const auto &index = sessions[i].first;
+                received[QString::fromStdString(index.room_id)].push_back(
+                  QString::fromStdString(index.session_id));
         }
+
+        for (const auto &[room_id, session_ids] : received)
+                emit inboundMegolmSessionsReceived(room_id, session_ids);
 }
 
-OlmInboundGroupSession *
+std::shared_ptr<InboundGroupSession>
 Cache::getInboundMegolmSession(const MegolmSessionIndex &index)
 {
-        std::unique_lock<std::mutex> lock(session_storage.group_inbound_mtx);
-        return session_storage.group_inbound_sessions[json(index).dump()].get();
+        const auto key = json(index).dump();
+        auto &shard    = inboundMegolmShard(key);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+
+        auto entry = findInboundMegolmSession(shard, key);
+        if (!entry)
+                return nullptr;
+
+        entry->used = true;
+        return entry->session;
 }
 
 bool
 Cache::inboundMegolmSessionExists(const MegolmSessionIndex &index)
 {
-        std::unique_lock<std::mutex> lock(session_storage.group_inbound_mtx);
-        return session_storage.group_inbound_sessions.find(json(index).dump()) !=
-               session_storage.group_inbound_sessions.end();
+        const auto key = json(index).dump();
+        auto &shard    = inboundMegolmShard(key);
+        std::unique_lock<std::mutex> lock(shard.mutex);
+
+        return findInboundMegolmSession(shard, key) != nullptr;
 }
 
-void
-Cache::updateOutboundMegolmSession(const std::string &room_id, int message_index)
+InboundGroupSessionStats
+Cache::inboundMegolmSessionStats()
 {
-        using namespace mtx::crypto;
-
-        if (!outboundMegolmSessionExists(room_id))
-                return;
-
-        OutboundGroupSessionData data;
-        OlmOutboundGroupSession *session;
-        {
-                std::unique_lock<std::mutex> lock(session_storage.group_outbound_mtx);
-                data    = session_storage.group_outbound_session_data[room_id];
-                session = session_storage.group_outbound_sessions[room_id].get();
-
-                // Update with the current message.
-                data.message_index                                   = message_index;
-                session_storage.group_outbound_session_data[room_id] = data;
+        InboundGroupSessionStats stats;
+        for (auto &shard : session_storage.group_inbound_shards) {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                stats.hits += shard.stats.hits;
+                stats.misses += shard.stats.misses;
+                stats.size += shard.lru.size();
         }
 
-        // Save the updated pickled data for the session.
-        json j;
-        j["data"]    = data;
-        j["session"] = pickle<OutboundSessionObject>(session, SECRET);
+        return stats;
+}
 
-        auto txn = lmdb::txn::begin(env_);
-        lmdb::dbi_put(txn, outboundMegolmSessionDb_, lmdb::val(room_id), lmdb::val(j.dump()));
-        txn.commit();
+InboundGroupSessionShard &
+Cache::inboundMegolmShard(const std::string &key)
+{
+        const auto shard = std::hash<std::string>{}(key) % INBOUND_GROUP_SESSION_SHARDS;
+        return session_storage.group_inbound_shards[shard];
 }
 
-void
-Cache::saveOutboundMegolmSession(const std::string &room_id,
-                                 const OutboundGroupSessionData &data,
-                                 mtx::crypto::OutboundGroupSessionPtr session)
+InboundGroupSessionEntry *
+Cache::findInboundMegolmSession(InboundGroupSessionShard &shard, const std::string &key)
 {
-        using namespace mtx::crypto;
-        const auto pickled = pickle<OutboundSessionObject>(session.get(), SECRET);
+        auto it = shard.sessions.find(key);
+        if (it != shard.sessions.end()) {
+                shard.stats.hits++;
+                shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+                return &*it->second;
+        }
 
-        json j;
-        j["data"]    = data;
-        j["session"] = pickled;
+        shard.stats.misses++;
+        if (shard.missing.count(key))
+                return nullptr;
 
-        auto txn = lmdb::txn::begin(env_);
-        lmdb::dbi_put(txn, outboundMegolmSessionDb_, lmdb::val(room_id), lmdb::val(j.dump()));
-        txn.commit();
+        cache::LatencyTimer timer(NHEKO_METRIC("load megolm session"));
 
+        std::string pickled;
         {
-                std::unique_lock<std::mutex> lock(session_storage.group_outbound_mtx);
-                session_storage.group_outbound_session_data[room_id] = data;
-                session_storage.group_outbound_sessions[room_id]     = std::move(session);
+                auto txn = beginCryptoTxn(MDB_RDONLY);
+
+                lmdb::val value;
+                const bool found =
+                  lmdb::dbi_get(txn, inboundMegolmSessionDb_, lmdb::val(key), value);
+                if (found)
+                        pickled = std::string(value.data(), value.size());
+
+                txn.commit();
+
+                if (!found) {
+                        if (shard.missing.size() >= MAX_MISSING_MEGOLM_SESSIONS_PER_SHARD)
+                                shard.missing.clear();
+                        shard.missing.insert(key);
+                        return nullptr;
+                }
+        }
+
+        try {
+                auto session =
+                  mtx::crypto::unpickle<mtx::crypto::InboundSessionObject>(pickled, SECRET);
+                return cacheInboundMegolmSession(shard, key, std::move(session));
+        } catch (const mtx::crypto::olm_exception &e) {
+                nhlog::crypto()->critical(
+                  "failed to unpickle megolm session {}: {}", key, e.what());
+                return nullptr;
+        }
+}
+
+InboundGroupSessionEntry *
+Cache::cacheInboundMegolmSession(InboundGroupSessionShard &shard,
+                                 const std::string &key,
+                                 mtx::crypto::InboundGroupSessionPtr session)
+{
+        using namespace mtx::crypto;
+
+        shard.missing.erase(key);
+
+        auto it = shard.sessions.find(key);
+        if (it != shard.sessions.end()) {
+                shard.lru.erase(it->second);
+                shard.sessions.erase(it);
+        }
+
+        auto unpickled     = std::make_shared<InboundGroupSession>();
+        unpickled->session = std::move(session);
+        shard.lru.push_front(InboundGroupSessionEntry{key, std::move(unpickled)});
+        shard.sessions[key] = shard.lru.begin();
+
+        evictInboundMegolmSessions(shard, maxInboundMegolmSessionsPerShard_);
+        return &shard.lru.front();
+}
+
+void
+Cache::evictInboundMegolmSessions(InboundGroupSessionShard &shard, std::size_t maxSessions)
+{
+        using namespace mtx::crypto;
+
+        if (shard.lru.size() <= maxSessions)
+                return;
+
+        // Decrypting may advance the ratchet of a session. Those that were handed out are
+        // pickled again, so that the next unpickling doesn't have to redo it.
+        std::vector<std::pair<std::string, std::string>> pickled;
+        while (shard.lru.size() > maxSessions) {
+                auto &evicted = shard.lru.back();
+
+                if (evicted.used) {
+                        // It may still decrypt a message on another thread.
+                        std::unique_lock<std::mutex> lock(evicted.session->mutex);
+                        pickled.emplace_back(evicted.key,
+                                             pickle<InboundSessionObject>(
+                                               evicted.session->session.get(), SECRET));
+                }
+
+                shard.sessions.erase(evicted.key);
+                shard.lru.pop_back();
+        }
+
+        if (!pickled.empty()) {
+                try {
+                        writeCrypto([&](lmdb::txn &txn) {
+                                for (const auto &[k, value] : pickled)
+                                        lmdb::dbi_put(txn,
+                                                      inboundMegolmSessionDb_,
+                                                      lmdb::val(k),
+                                                      lmdb::val(value));
+                        });
+                } catch (const lmdb::error &e) {
+                        nhlog::db()->warn("failed to save evicted megolm sessions: {}", e.what());
+                }
+        }
+}
+
+std::size_t
+Cache::inboundMegolmSessionUsage()
+{
+        return inboundMegolmSessionStats().size * MEGOLM_SESSION_BYTES;
+}
+
+void
+Cache::trimInboundMegolmSessions(std::size_t bytes)
+{
+        const auto maxSessions = bytes / MEGOLM_SESSION_BYTES / INBOUND_GROUP_SESSION_SHARDS;
+        for (auto &shard : session_storage.group_inbound_shards) {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                evictInboundMegolmSessions(shard, maxSessions);
+        }
+}
+
+void
+Cache::updateMemoryBudgets()
+{
+        members_.setMaxMembers(memory::budget(memory::Layer::Members) / MEMBER_BYTES);
+
+        maxInboundMegolmSessionsPerShard_ = inboundMegolmSessionsPerShard();
+        for (auto &shard : session_storage.group_inbound_shards) {
+                std::unique_lock<std::mutex> lock(shard.mutex);
+                evictInboundMegolmSessions(shard, maxInboundMegolmSessionsPerShard_);
+        }
+}
+
+void
+Cache::updateOutboundMegolmSession(const std::string &room_id, int message_index)
+{
+        if (!outboundMegolmSessionExists(room_id))
+                return;
+
+        bool firstUnsaved = false, save = false;
+        {
+                std::unique_lock<std::mutex> lock(session_storage.group_outbound_mtx);
+
+                // Update with the current message.
+                session_storage.group_outbound_session_data[room_id].message_index = message_index;
+
+                const auto now = std::chrono::steady_clock::now();
+                auto &unsaved  = session_storage.group_outbound_unsaved[room_id];
+                firstUnsaved   = unsaved.messages++ == 0;
+                if (firstUnsaved)
+                        unsaved.since = now;
+
+                save = unsaved.messages >= OUTBOUND_MEGOLM_SAVE_MESSAGES ||
+                       now - unsaved.since >= OUTBOUND_MEGOLM_SAVE_INTERVAL;
+        }
+
+        if (save) {
+                persistOutboundMegolmSessions({room_id});
+                return;
+        }
+
+        // The session is kept unpickled and saved every few messages. If we crash before that,
+        // the saved session would reuse the message indices of the events already sent, so it is
+        // marked and discarded on the next start.
+        if (firstUnsaved) {
+                writeCrypto([&](lmdb::txn &txn) {
+                        lmdb::val value;
+                        if (!lmdb::dbi_get(
+                              txn, outboundMegolmSessionDb_, lmdb::val(room_id), value))
+                                return;
+
+                        auto j       = decodeValue(value);
+                        j["unsaved"] = true;
+                        lmdb::dbi_put(
+                          txn, outboundMegolmSessionDb_, lmdb::val(room_id), lmdb::val(j.dump()));
+                });
+        }
+}
+
+void
+Cache::saveOutboundMegolmSessions()
+{
+        std::vector<std::string> room_ids;
+        {
+                std::unique_lock<std::mutex> lock(session_storage.group_outbound_mtx);
+                for (const auto &unsaved : session_storage.group_outbound_unsaved)
+                        room_ids.push_back(unsaved.first);
+        }
+
+        persistOutboundMegolmSessions(room_ids);
+}
+
+void
+Cache::persistOutboundMegolmSessions(const std::vector<std::string> &room_ids)
+{
+        using namespace mtx::crypto;
+
+        std::vector<std::pair<std::string, std::string>> pickled;
+        {
+                std::unique_lock<std::mutex> lock(session_storage.group_outbound_mtx);
+                for (const auto &room_id : room_ids) {
+                        session_storage.group_outbound_unsaved.erase(room_id);
+
+                        auto session = session_storage.group_outbound_sessions.find(room_id);
+                        if (session == session_storage.group_outbound_sessions.end())
+                                continue;
+
+                        json j;
+                        j["data"]    = session_storage.group_outbound_session_data[room_id];
+                        j["session"] = pickle<OutboundSessionObject>(session->second.get(), SECRET);
+                        pickled.emplace_back(room_id, j.dump());
+                }
+        }
+
+        if (pickled.empty())
+                return;
+
+        writeCrypto([&](lmdb::txn &txn) {
+                for (const auto &[room_id, value] : pickled)
+                        lmdb::dbi_put(
+                          txn, outboundMegolmSessionDb_, lmdb::val(room_id), lmdb::val(value));
+        });
+}
+
+void
+Cache::saveOutboundMegolmSession(const std::string &room_id,
+                                 const OutboundGroupSessionData &data,
+                                 mtx::crypto::OutboundGroupSessionPtr session)
+{
+        using namespace mtx::crypto;
+        const auto pickled = pickle<OutboundSessionObject>(session.get(), SECRET);
+
+        json j;
+        j["data"]    = data;
+        j["session"] = pickled;
+
+        const auto value = j.dump();
+        writeCrypto([&](lmdb::txn &txn) {
+                lmdb::dbi_put(txn, outboundMegolmSessionDb_, lmdb::val(room_id), lmdb::val(value));
+        });
+
+        {
+                std::unique_lock<std::mutex> lock(session_storage.group_outbound_mtx);
+                session_storage.group_outbound_session_data[room_id] = data;
+                session_storage.group_outbound_sessions[room_id]     = std::move(session);
+                session_storage.group_outbound_unsaved.erase(room_id);
         }
 }
 
@@ -374,6 +1460,102 @@ Cache::getOutboundMegolmSession(const std::string &room_id)
                                            session_storage.group_outbound_session_data[room_id]};
 }
 
+void
+Cache::addOutboundMegolmSessionRecipients(
+  const std::string &room_id,
+  const std::string &session_id,
+  const std::map<std::string, std::set<std::string>> &devices)
+{
+        {
+                std::unique_lock<std::mutex> lock(session_storage.group_outbound_mtx);
+
+                // The session may have been replaced, while its keys were sent.
+                auto data = session_storage.group_outbound_session_data.find(room_id);
+                if (data == session_storage.group_outbound_session_data.end() ||
+                    data->second.session_id != session_id)
+                        return;
+
+                for (const auto &[user_id, device_ids] : devices)
+                        data->second.shared_with[user_id].insert(device_ids.begin(),
+                                                                 device_ids.end());
+        }
+
+        // Losing them only shares the session with these devices again.
+        persistOutboundMegolmSessions({room_id});
+}
+
+//
+// Device keys.
+//
+
+std::map<std::string, UserDeviceKeys>
+Cache::deviceKeys(const std::vector<std::string> &user_ids)
+{
+        std::map<std::string, UserDeviceKeys> keys;
+
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+                for (const auto &user_id : user_ids) {
+                        lmdb::val value;
+                        if (!lmdb::dbi_get(txn, deviceKeysDb_, lmdb::val(user_id), value))
+                                continue;
+
+                        try {
+                                keys.emplace(user_id, decodeValue(value).get<UserDeviceKeys>());
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn(
+                                  "failed to parse device keys of {}: {}", user_id, e.what());
+                        }
+                }
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read device keys: {}", e.what());
+        }
+
+        return keys;
+}
+
+void
+Cache::saveDeviceKeys(const std::map<std::string, UserDeviceKeys> &keys)
+{
+        try {
+                auto txn = beginTxn();
+                for (const auto &[user_id, devices] : keys)
+                        lmdb::dbi_put(txn,
+                                      deviceKeysDb_,
+                                      lmdb::val(user_id),
+                                      lmdb::val(encodeValue(devices)));
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save device keys: {}", e.what());
+        }
+}
+
+void
+Cache::updateDeviceLists(lmdb::txn &txn,
+                         const std::vector<std::string> &changed,
+                         const std::vector<std::string> &left)
+{
+        for (const auto &user_id : changed) {
+                lmdb::val value;
+                if (!lmdb::dbi_get(txn, deviceKeysDb_, lmdb::val(user_id), value))
+                        continue;
+
+                try {
+                        auto keys     = decodeValue(value).get<UserDeviceKeys>();
+                        keys.outdated = true;
+                        lmdb::dbi_put(
+                          txn, deviceKeysDb_, lmdb::val(user_id), lmdb::val(encodeValue(keys)));
+                } catch (const json::exception &) {
+                        lmdb::dbi_del(txn, deviceKeysDb_, lmdb::val(user_id), nullptr);
+                }
+        }
+
+        // We don't share a room with them anymore, so their keys aren't kept up to date.
+        for (const auto &user_id : left)
+                lmdb::dbi_del(txn, deviceKeysDb_, lmdb::val(user_id), nullptr);
+}
+
 //
 // OLM sessions.
 //
@@ -383,15 +1565,40 @@ Cache::saveOlmSession(const std::string &curve25519, mtx::crypto::OlmSessionPtr
 {
         using namespace mtx::crypto;
 
-        auto txn = lmdb::txn::begin(env_);
-        auto db  = getOlmSessionsDb(txn, curve25519);
-
         const auto pickled    = pickle<SessionObject>(session.get(), SECRET);
         const auto session_id = mtx::crypto::session_id(session.get());
 
-        lmdb::dbi_put(txn, db, lmdb::val(session_id), lmdb::val(pickled));
+        // The session was just created or decrypted a message, so it is the most likely one to
+        // decrypt the next message of the sender.
+        const auto now   = QDateTime::currentMSecsSinceEpoch();
+        const auto usage = encodeValue(json{{"last_used", now}});
+
+        writeCrypto([&](lmdb::txn &txn) {
+                auto db = getOlmSessionsDb(txn, curve25519);
+                lmdb::dbi_put(txn, db, lmdb::val(session_id), lmdb::val(pickled));
+                lmdb::dbi_put(txn,
+                              olmSessionUsageDb_,
+                              lmdb::val(olmSessionUsageKey(curve25519, session_id)),
+                              lmdb::val(usage));
+        });
+}
+
+std::optional<lmdb::dbi>
+Cache::findOlmSessionsDb(const std::string &curve25519_key)
+{
+        const auto name = "olm_sessions/" + curve25519_key;
+        if (auto dbi = cryptoDbis_.find(name))
+                return lmdb::dbi(*dbi);
 
+        // Only one write transaction runs at a time, so no other transaction opens a database
+        // concurrently, which LMDB doesn't allow.
+        auto txn = beginCryptoTxn();
+        auto dbi = openExistingDb(txn, name);
+        if (dbi)
+                cryptoDbis_.opened(txn.handle(), name, dbi->handle());
         txn.commit();
+
+        return dbi;
 }
 
 std::optional<mtx::crypto::OlmSessionPtr>
@@ -399,11 +1606,14 @@ Cache::getOlmSession(const std::string &curve25519, const std::string &session_i
 {
         using namespace mtx::crypto;
 
-        auto txn = lmdb::txn::begin(env_);
-        auto db  = getOlmSessionsDb(txn, curve25519);
+        auto db = findOlmSessionsDb(curve25519);
+        if (!db)
+                return std::nullopt;
+
+        auto txn = beginCryptoTxn(MDB_RDONLY);
 
         lmdb::val pickled;
-        bool found = lmdb::dbi_get(txn, db, lmdb::val(session_id), pickled);
+        bool found = lmdb::dbi_get(txn, *db, lmdb::val(session_id), pickled);
 
         txn.commit();
 
@@ -420,28 +1630,56 @@ Cache::getOlmSessions(const std::string &curve25519)
 {
         using namespace mtx::crypto;
 
-        auto txn = lmdb::txn::begin(env_);
-        auto db  = getOlmSessionsDb(txn, curve25519);
+        auto db = findOlmSessionsDb(curve25519);
+        if (!db)
+                return {};
 
-        std::string session_id, unused;
-        std::vector<std::string> res;
+        auto txn = beginCryptoTxn(MDB_RDONLY);
 
-        auto cursor = lmdb::cursor::open(txn, db);
-        while (cursor.get(session_id, unused, MDB_NEXT))
-                res.emplace_back(session_id);
+        lmdb::val key, unused;
+        std::vector<std::pair<int64_t, std::string>> sessions;
+
+        // Only the ids are needed, so the pickled sessions aren't copied.
+        auto cursor = lmdb::cursor::open(txn, *db);
+        while (cursor.get(key, unused, MDB_NEXT)) {
+                const std::string session_id(view(key));
+                int64_t last_used = 0;
+
+                lmdb::val usage;
+                if (lmdb::dbi_get(txn,
+                                  olmSessionUsageDb_,
+                                  lmdb::val(olmSessionUsageKey(curve25519, session_id)),
+                                  usage)) {
+                        try {
+                                last_used = decodeValue(usage).value("last_used", int64_t{0});
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn("invalid olm session usage: {}", e.what());
+                        }
+                }
+
+                sessions.emplace_back(last_used, session_id);
+        }
         cursor.close();
 
         txn.commit();
 
+        std::stable_sort(sessions.begin(), sessions.end(), [](const auto &a, const auto &b) {
+                return a.first > b.first;
+        });
+
+        std::vector<std::string> res;
+        for (auto &session : sessions)
+                res.push_back(std::move(session.second));
+
         return res;
 }
 
 void
 Cache::saveOlmAccount(const std::string &data)
 {
-        auto txn = lmdb::txn::begin(env_);
-        lmdb::dbi_put(txn, syncStateDb_, OLM_ACCOUNT_KEY, lmdb::val(data));
-        txn.commit();
+        writeCrypto([&](lmdb::txn &txn) {
+                lmdb::dbi_put(txn, cryptoStateDb_, OLM_ACCOUNT_KEY, lmdb::val(data));
+        });
 }
 
 void
@@ -449,20 +1687,11 @@ Cache::restoreSessions()
 {
         using namespace mtx::crypto;
 
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        auto txn = beginCryptoTxn(MDB_RDONLY);
         std::string key, value;
+        std::size_t restored = 0;
 
-        //
-        // Inbound Megolm Sessions
-        //
-        {
-                auto cursor = lmdb::cursor::open(txn, inboundMegolmSessionDb_);
-                while (cursor.get(key, value, MDB_NEXT)) {
-                        auto session = unpickle<InboundSessionObject>(value, SECRET);
-                        session_storage.group_inbound_sessions[key] = std::move(session);
-                }
-                cursor.close();
-        }
+        // The inbound megolm sessions are unpickled, when they are first used.
 
         //
         // Outbound Megolm Sessions
@@ -475,12 +1704,28 @@ Cache::restoreSessions()
                         try {
                                 obj = json::parse(value);
 
-                                session_storage.group_outbound_session_data[key] =
-                                  obj.at("data").get<OutboundGroupSessionData>();
+                                // A new session is created, instead of reusing message indices.
+                                if (obj.value("unsaved", false)) {
+                                        nhlog::crypto()->warn(
+                                          "discarding the outbound megolm session of {}, it "
+                                          "wasn't saved after its last messages",
+                                          key);
+                                        continue;
+                                }
 
+                                auto data = obj.at("data").get<OutboundGroupSessionData>();
                                 auto session =
                                   unpickle<OutboundSessionObject>(obj.at("session"), SECRET);
+
+                                // The restore runs concurrently with the rest of the startup, a
+                                // session created in the meantime is newer than the stored one.
+                                std::unique_lock<std::mutex> lock(
+                                  session_storage.group_outbound_mtx);
+                                if (session_storage.group_outbound_sessions.count(key))
+                                        continue;
+                                session_storage.group_outbound_session_data[key] = std::move(data);
                                 session_storage.group_outbound_sessions[key] = std::move(session);
+                                restored++;
                         } catch (const nlohmann::json::exception &e) {
                                 nhlog::db()->critical(
                                   "failed to parse outbound megolm session data: {}", e.what());
@@ -491,15 +1736,16 @@ Cache::restoreSessions()
 
         txn.commit();
 
+        cache::recordCount(NHEKO_METRIC("restoreSessions sessions"), restored);
         nhlog::db()->info("sessions restored");
 }
 
 std::string
 Cache::restoreOlmAccount()
 {
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        auto txn = beginCryptoTxn(MDB_RDONLY);
         lmdb::val pickled;
-        lmdb::dbi_get(txn, syncStateDb_, OLM_ACCOUNT_KEY, pickled);
+        lmdb::dbi_get(txn, cryptoStateDb_, OLM_ACCOUNT_KEY, pickled);
         txn.commit();
 
         return std::string(pickled.data(), pickled.size());
@@ -512,27 +1758,15 @@ Cache::restoreOlmAccount()
 void
 Cache::saveImage(const std::string &url, const std::string &img_data)
 {
-        if (url.empty() || img_data.empty())
-                return;
-
-        try {
-                auto txn = lmdb::txn::begin(env_);
-
-                lmdb::dbi_put(txn,
-                              mediaDb_,
-                              lmdb::val(url.data(), url.size()),
-                              lmdb::val(img_data.data(), img_data.size()));
-
-                txn.commit();
-        } catch (const lmdb::error &e) {
-                nhlog::db()->critical("saveImage: {}", e.what());
-        }
+        // The data outlives the call, so it doesn't need to be copied.
+        saveMedia(QString::fromStdString(url),
+                  QByteArray::fromRawData(img_data.data(), static_cast<int>(img_data.size())));
 }
 
 void
 Cache::saveImage(const QString &url, const QByteArray &image)
 {
-        saveImage(url.toStdString(), std::string(image.constData(), image.length()));
+        saveMedia(url, image);
 }
 
 QByteArray
@@ -542,1613 +1776,5161 @@ Cache::image(lmdb::txn &txn, const std::string &url) const
                 return QByteArray();
 
         try {
-                lmdb::val image;
-                bool res = lmdb::dbi_get(txn, mediaDb_, lmdb::val(url), image);
+                auto entry = mediaEntry(txn, url);
 
-                if (!res)
+                if (!entry)
                         return QByteArray();
 
-                return QByteArray(image.data(), image.size());
+                QFile file(mediaDirectory_ + "/" +
+                           QString::fromStdString(entry->at("file").get<std::string>()));
+
+                if (!file.open(QIODevice::ReadOnly))
+                        return QByteArray();
+
+                return file.readAll();
         } catch (const lmdb::error &e) {
                 nhlog::db()->critical("image: {}, {}", e.what(), url);
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse media entry {}: {}", url, e.what());
         }
 
         return QByteArray();
 }
 
 QByteArray
-Cache::image(const QString &url) const
+Cache::image(const QString &url)
 {
-        if (url.isEmpty())
+        cache::LatencyTimer timer(NHEKO_METRIC("image"));
+
+        const auto path = mediaPath(url);
+
+        if (path.isEmpty())
                 return QByteArray();
 
-        auto key = url.toUtf8();
+        QFile file(path);
 
-        try {
-                auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        if (!file.open(QIODevice::ReadOnly))
+                return QByteArray();
+
+        return file.readAll();
+}
+
+std::optional<nlohmann::json>
+Cache::mediaEntry(lmdb::txn &txn, const std::string &key) const
+{
+        lmdb::val value;
+
+        if (!lmdb::dbi_get(txn, mediaIndexDb_, lmdb::val(key), value))
+                return std::nullopt;
+
+        return decodeValue(value);
+}
 
-                lmdb::val image;
+QString
+Cache::mediaPath(const QString &key)
+{
+        if (key.isEmpty())
+                return QString();
 
-                bool res = lmdb::dbi_get(txn, mediaDb_, lmdb::val(key.data(), key.size()), image);
+        const auto k = key.toStdString();
 
+        try {
+                auto txn   = beginTxn(MDB_RDONLY);
+                auto entry = mediaEntry(txn, k);
                 txn.commit();
 
-                if (!res)
-                        return QByteArray();
+                if (!entry)
+                        return QString();
+
+                const auto file = entry->at("file").get<std::string>();
+                const auto path = mediaDirectory_ + "/" + QString::fromStdString(file);
+
+                // The lookups come from the GUI thread too, so the index is updated in the
+                // background.
+                if (!QFile::exists(path)) {
+                        nhlog::db()->warn("media file of {} is missing", k);
+                        QtConcurrent::run([this, k, file]() { updateMediaEntry(k, file, 0); });
+                        return QString();
+                }
+
+                // Only write the access time, when it changes enough to matter for the eviction.
+                const auto now = QDateTime::currentSecsSinceEpoch();
+                if (now - entry->value("atime", qint64(0)) > MEDIA_ATIME_RESOLUTION)
+                        QtConcurrent::run(
+                          [this, k, file, now]() { updateMediaEntry(k, file, now); });
 
-                return QByteArray(image.data(), image.size());
+                return path;
         } catch (const lmdb::error &e) {
-                nhlog::db()->critical("image: {} {}", e.what(), url.toStdString());
+                nhlog::db()->critical("mediaPath: {}, {}", e.what(), k);
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse media entry {}: {}", k, e.what());
         }
 
-        return QByteArray();
+        return QString();
 }
 
 void
-Cache::removeInvite(lmdb::txn &txn, const std::string &room_id)
+Cache::updateMediaEntry(const std::string &key, const std::string &file, qint64 atime)
 {
-        lmdb::dbi_del(txn, invitesDb_, lmdb::val(room_id), nullptr);
-        lmdb::dbi_drop(txn, getInviteStatesDb(txn, room_id), true);
-        lmdb::dbi_drop(txn, getInviteMembersDb(txn, room_id), true);
-}
+        try {
+                auto txn   = beginTxn();
+                auto entry = mediaEntry(txn, key);
 
-void
-Cache::removeInvite(const std::string &room_id)
-{
-        auto txn = lmdb::txn::begin(env_);
-        removeInvite(txn, room_id);
-        txn.commit();
-}
+                // The file was replaced or evicted meanwhile.
+                if (!entry || entry->value("file", "") != file)
+                        return;
 
-void
-Cache::removeRoom(lmdb::txn &txn, const std::string &roomid)
-{
-        lmdb::dbi_del(txn, roomsDb_, lmdb::val(roomid), nullptr);
-        lmdb::dbi_drop(txn, getStatesDb(txn, roomid), true);
-        lmdb::dbi_drop(txn, getMembersDb(txn, roomid), true);
-}
+                uint64_t removed = 0;
+                if (atime == 0) {
+                        lmdb::dbi_del(txn, mediaIndexDb_, lmdb::val(key), nullptr);
+                        removed = entry->value("size", uint64_t(0));
+                } else {
+                        (*entry)["atime"] = atime;
+                        lmdb::dbi_put(
+                          txn, mediaIndexDb_, lmdb::val(key), lmdb::val(encodeValue(*entry)));
+                }
 
-void
-Cache::removeRoom(const std::string &roomid)
-{
-        auto txn = lmdb::txn::begin(env_, nullptr, 0);
-        lmdb::dbi_del(txn, roomsDb_, lmdb::val(roomid), nullptr);
-        txn.commit();
-}
+                txn.commit();
 
-void
-Cache::setNextBatchToken(lmdb::txn &txn, const std::string &token)
-{
-        lmdb::dbi_put(txn, syncStateDb_, NEXT_BATCH_KEY, lmdb::val(token.data(), token.size()));
+                mediaSize_ -= removed;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to update media entry {}: {}", key, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse media entry {}: {}", key, e.what());
+        }
 }
 
-void
-Cache::setNextBatchToken(lmdb::txn &txn, const QString &token)
+QString
+Cache::mediaFileFor(const QString &key, const QString &suffix)
 {
-        setNextBatchToken(txn, token.toStdString());
+        // Name the files by the hash of the key, so any key gives a safe file name.
+        auto name = QString::fromUtf8(
+          QCryptographicHash::hash(key.toUtf8(), QCryptographicHash::Sha256).toHex());
+        if (!suffix.isEmpty())
+                name += "." + suffix;
+
+        return mediaDirectory_ + "/" + name;
 }
 
-bool
-Cache::isInitialized() const
+QString
+Cache::saveMedia(const QString &key, const QByteArray &data, const QString &suffix)
 {
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        lmdb::val token;
+        if (key.isEmpty() || data.isEmpty())
+                return QString();
 
-        bool res = lmdb::dbi_get(txn, syncStateDb_, NEXT_BATCH_KEY, token);
+        const auto path = mediaFileFor(key, suffix);
 
-        txn.commit();
+        QSaveFile file(path);
+        if (!file.open(QIODevice::WriteOnly) || file.write(data) != data.size() ||
+            !file.commit()) {
+                nhlog::db()->warn("failed to write media file of {}: {}",
+                                  key.toStdString(),
+                                  file.errorString().toStdString());
+                return QString();
+        }
 
-        return res;
+        return addMediaFile(key, suffix, data.size());
 }
 
-std::string
-Cache::nextBatchToken() const
+QString
+Cache::addMediaFile(const QString &key, const QString &suffix, uint64_t size)
 {
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        lmdb::val token;
+        const auto k    = key.toStdString();
+        const auto path = mediaFileFor(key, suffix);
+        const auto name = QFileInfo(path).fileName();
 
-        lmdb::dbi_get(txn, syncStateDb_, NEXT_BATCH_KEY, token);
+        try {
+                auto txn = beginTxn();
 
-        txn.commit();
+                uint64_t previousSize = 0;
+                std::string previousName;
+                if (auto previous = mediaEntry(txn, k)) {
+                        previousSize = previous->value("size", uint64_t(0));
+                        previousName = previous->value("file", "");
+                }
 
-        return std::string(token.data(), token.size());
-}
+                json entry;
+                entry["file"]  = name.toStdString();
+                entry["size"]  = size;
+                entry["atime"] = QDateTime::currentSecsSinceEpoch();
 
-void
-Cache::deleteData()
-{
-        // TODO: We need to remove the env_ while not accepting new requests.
-        if (!cacheDirectory_.isEmpty()) {
-                QDir(cacheDirectory_).removeRecursively();
-                nhlog::db()->info("deleted cache files from disk");
+                lmdb::dbi_put(txn, mediaIndexDb_, lmdb::val(k), lmdb::val(encodeValue(entry)));
+
+                txn.commit();
+
+                // The file of the previous entry is only deleted, once the index doesn't
+                // point to it anymore.
+                if (!previousName.empty() && previousName != name.toStdString())
+                        QFile::remove(mediaDirectory_ + "/" +
+                                      QString::fromStdString(previousName));
+
+                mediaSize_ += size;
+                mediaSize_ -= previousSize;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("addMediaFile: {}", e.what());
+                QFile::remove(path);
+                return QString();
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse media entry {}: {}", k, e.what());
         }
+
+        // Media is added from the download callbacks and workers, so this doesn't block the UI.
+        if (mediaSize_ > mediaBudget_)
+                evictMedia();
+
+        return path;
 }
 
-bool
-Cache::isFormatValid()
+void
+Cache::evictMedia()
 {
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        if (evictingMedia_.exchange(true))
+                return;
 
-        lmdb::val current_version;
-        bool res = lmdb::dbi_get(txn, syncStateDb_, CACHE_FORMAT_VERSION_KEY, current_version);
+        struct Entry
+        {
+                std::string key;
+                std::string file;
+                uint64_t size;
+                qint64 atime;
+        };
 
-        txn.commit();
+        std::vector<Entry> entries;
+        uint64_t total = 0;
 
-        if (!res)
-                return false;
+        try {
+                {
+                        auto txn = beginTxn(MDB_RDONLY);
 
-        std::string stored_version(current_version.data(), current_version.size());
+                        std::string key, value;
 
-        if (stored_version != CURRENT_CACHE_FORMAT_VERSION) {
-                nhlog::db()->warn("breaking changes in the cache format. stored: {}, current: {}",
-                                  stored_version,
-                                  CURRENT_CACHE_FORMAT_VERSION);
-                return false;
-        }
+                        auto cursor = lmdb::cursor::open(txn, mediaIndexDb_);
+                        while (cursor.get(key, value, MDB_NEXT)) {
+                                try {
+                                        const auto entry = decodeValue(value);
+
+                                        entries.push_back(
+                                          Entry{key,
+                                                entry.value("file", ""),
+                                                entry.value("size", uint64_t(0)),
+                                                entry.value("atime", qint64(0))});
+                                        total += entries.back().size;
+                                } catch (const json::exception &e) {
+                                        nhlog::db()->warn(
+                                          "failed to parse media entry {}: {}", key, e.what());
+                                }
+                        }
+                        cursor.close();
 
-        return true;
-}
+                        txn.commit();
+                }
 
-void
-Cache::setCurrentFormat()
-{
-        auto txn = lmdb::txn::begin(env_);
+                std::sort(entries.begin(), entries.end(), [](const Entry &a, const Entry &b) {
+                        return a.atime < b.atime;
+                });
 
-        lmdb::dbi_put(
-          txn,
-          syncStateDb_,
-          CACHE_FORMAT_VERSION_KEY,
-          lmdb::val(CURRENT_CACHE_FORMAT_VERSION.data(), CURRENT_CACHE_FORMAT_VERSION.size()));
+                const auto target = static_cast<uint64_t>(mediaBudget_ * MEDIA_STORE_LOW_WATERMARK);
 
-        txn.commit();
-}
+                std::size_t evicted  = 0;
+                uint64_t evictedSize = 0;
+                std::vector<std::string> files;
+                auto txn = beginTxn();
 
-std::vector<QString>
-Cache::pendingReceiptsEvents(lmdb::txn &txn, const std::string &room_id)
-{
-        auto db = getPendingReceiptsDb(txn);
+                for (const auto &entry : entries) {
+                        if (total <= target)
+                                break;
 
-        std::string key, unused;
-        std::vector<QString> pending;
+                        total -= entry.size;
 
-        auto cursor = lmdb::cursor::open(txn, db);
-        while (cursor.get(key, unused, MDB_NEXT)) {
-                ReadReceiptKey receipt;
-                try {
-                        receipt = json::parse(key);
-                } catch (const nlohmann::json::exception &e) {
-                        nhlog::db()->warn("pendingReceiptsEvents: {}", e.what());
-                        continue;
-                }
+                        // The entries, which were replaced or used since they were read, are
+                        // kept.
+                        const auto current = mediaEntry(txn, entry.key);
+                        if (!current || current->value("file", "") != entry.file ||
+                            current->value("atime", qint64(0)) != entry.atime)
+                                continue;
 
-                if (receipt.room_id == room_id)
-                        pending.emplace_back(QString::fromStdString(receipt.event_id));
-        }
+                        lmdb::dbi_del(txn, mediaIndexDb_, lmdb::val(entry.key), nullptr);
+                        if (!entry.file.empty())
+                                files.push_back(entry.file);
 
-        cursor.close();
+                        evictedSize += entry.size;
+                        evicted += 1;
+                }
 
-        return pending;
-}
+                txn.commit();
 
-void
-Cache::removePendingReceipt(lmdb::txn &txn, const std::string &room_id, const std::string &event_id)
-{
-        auto db = getPendingReceiptsDb(txn);
+                // The files are only deleted, once the index doesn't point to them anymore.
+                for (const auto &file : files)
+                        QFile::remove(mediaDirectory_ + "/" + QString::fromStdString(file));
 
-        ReadReceiptKey receipt_key{event_id, room_id};
-        auto key = json(receipt_key).dump();
+                // Media added meanwhile was counted by addMediaFile, so only the evicted files
+                // are subtracted.
+                mediaSize_ -= evictedSize;
 
-        try {
-                lmdb::dbi_del(txn, db, lmdb::val(key.data(), key.size()), nullptr);
+                nhlog::db()->info("evicted {} media files, {} bytes are left",
+                                  evicted,
+                                  mediaSize_.load());
         } catch (const lmdb::error &e) {
-                nhlog::db()->critical("removePendingReceipt: {}", e.what());
+                nhlog::db()->critical("evictMedia: {}", e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("evictMedia: failed to parse media entry: {}", e.what());
         }
+
+        evictingMedia_ = false;
 }
 
 void
-Cache::addPendingReceipt(const QString &room_id, const QString &event_id)
+Cache::removeInvite(lmdb::txn &txn, const std::string &room_id)
 {
-        auto txn = lmdb::txn::begin(env_);
-        auto db  = getPendingReceiptsDb(txn);
+        lmdb::dbi_del(txn, invitesDb_, lmdb::val(room_id), nullptr);
+        dropDb(txn, room_id + "/invite_state");
+        dropDb(txn, room_id + "/invite_members");
+}
 
-        ReadReceiptKey receipt_key{event_id.toStdString(), room_id.toStdString()};
-        auto key = json(receipt_key).dump();
-        std::string empty;
+void
+Cache::removeInvite(const std::string &room_id)
+{
+        auto txn = beginTxn();
+        removeInvite(txn, room_id);
+        txn.commit();
 
-        try {
-                lmdb::dbi_put(txn,
-                              db,
-                              lmdb::val(key.data(), key.size()),
-                              lmdb::val(empty.data(), empty.size()));
-        } catch (const lmdb::error &e) {
-                nhlog::db()->critical("addPendingReceipt: {}", e.what());
+        {
+                std::unique_lock<std::mutex> lock(invitesMutex_);
+                invites_.erase(room_id);
         }
 
-        txn.commit();
+        refreshRoomInfo({room_id});
 }
 
-CachedReceipts
-Cache::readReceipts(const QString &event_id, const QString &room_id)
+void
+Cache::removeRoom(lmdb::txn &txn, const std::string &roomid, TagChanges &tagChanges)
 {
-        CachedReceipts receipts;
-
-        ReadReceiptKey receipt_key{event_id.toStdString(), room_id.toStdString()};
-        nlohmann::json json_key = receipt_key;
-
-        try {
-                auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-                auto key = json_key.dump();
-
-                lmdb::val value;
-
-                bool res =
-                  lmdb::dbi_get(txn, readReceiptsDb_, lmdb::val(key.data(), key.size()), value);
-
-                txn.commit();
-
-                if (res) {
-                        auto json_response = json::parse(std::string(value.data(), value.size()));
-                        auto values        = json_response.get<std::map<std::string, uint64_t>>();
-
-                        for (const auto &v : values)
-                                // timestamp, user_id
-                                receipts.emplace(v.second, v.first);
+        lmdb::val data;
+        if (lmdb::dbi_get(txn, roomsDb_, lmdb::val(roomid), data)) {
+                try {
+                        const RoomInfo info = decodeValue(data);
+                        updateTagIndex(txn, roomid, info.tags, {}, tagChanges);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse room info: room_id ({}), {}",
+                                          roomid,
+                                          e.what());
                 }
-
-        } catch (const lmdb::error &e) {
-                nhlog::db()->critical("readReceipts: {}", e.what());
         }
 
-        return receipts;
+        lmdb::dbi_del(txn, roomsDb_, lmdb::val(roomid), nullptr);
+        lmdb::dbi_del(txn, lastMessagesDb_, lmdb::val(roomid), nullptr);
+        lmdb::dbi_del(txn, readStatusDb_, lmdb::val(roomid), nullptr);
+
+        // The databases of the room may be large, so they are reclaimed by the compaction.
+        lmdb::dbi_put(txn, removedRoomsDb_, lmdb::val(roomid), lmdb::val(""));
 }
 
-std::vector<QString>
-Cache::filterReadEvents(const QString &room_id,
-                        const std::vector<QString> &event_ids,
-                        const std::string &excluded_user)
+void
+Cache::removeRoom(const std::string &roomid)
 {
-        std::vector<QString> read_events;
-
-        for (const auto &event : event_ids) {
-                auto receipts = readReceipts(event, room_id);
+        TagChanges tagChanges;
 
-                if (receipts.size() == 0)
-                        continue;
-
-                if (receipts.size() == 1) {
-                        if (receipts.begin()->second == excluded_user)
-                                continue;
-                }
+        auto txn = beginTxn();
+        removeRoom(txn, roomid, tagChanges);
+        txn.commit();
 
-                read_events.emplace_back(event);
-        }
+        refreshRoomInfo({roomid});
 
-        return read_events;
+        if (!tagChanges.empty())
+                emit tagsChanged(tagChanges);
 }
 
-void
-Cache::updateReadReceipt(lmdb::txn &txn, const std::string &room_id, const Receipts &receipts)
+bool
+Cache::reclaimRemovedRooms(std::chrono::steady_clock::time_point deadline)
 {
-        auto user_id = this->localUserId_.toStdString();
-        for (const auto &receipt : receipts) {
-                const auto event_id = receipt.first;
-                auto event_receipts = receipt.second;
+        cache::LatencyTimer timer(NHEKO_METRIC("reclaimRemovedRooms"));
 
-                ReadReceiptKey receipt_key{event_id, room_id};
-                nlohmann::json json_key = receipt_key;
+        std::lock_guard<std::mutex> lock(compactionMutex_);
 
-                try {
-                        const auto key = json_key.dump();
+        // Messages first, so a room joined again in between keeps an event index, which
+        // matches its messages.
+        static const std::array<const char *, 5> suffixes = {
+          "/messages", "/event_index", "/fetched_events", "/members", "/state"};
 
-                        lmdb::val prev_value;
+        std::size_t deleted = 0;
+        std::string room_id;
 
-                        bool exists = lmdb::dbi_get(
-                          txn, readReceiptsDb_, lmdb::val(key.data(), key.size()), prev_value);
+        do {
+                auto txn = beginTxn();
 
-                        std::map<std::string, uint64_t> saved_receipts;
+                std::string key, value;
+                auto rooms = lmdb::cursor::open(txn, removedRoomsDb_);
+                if (!rooms.get(key, value, MDB_FIRST)) {
+                        rooms.close();
+                        txn.commit();
+                        return false;
+                }
+                rooms.close();
+                room_id = key;
+
+                // A chunk of the first database of the room, which isn't dropped yet.
+                bool found        = false;
+                std::size_t chunk = 0;
+                for (const auto suffix : suffixes) {
+                        const auto name = room_id + suffix;
+                        auto db         = findDb(txn, name);
+                        if (!db)
+                                continue;
 
-                        // If an entry for the event id already exists, we would
-                        // merge the existing receipts with the new ones.
-                        if (exists) {
-                                auto json_value =
-                                  json::parse(std::string(prev_value.data(), prev_value.size()));
+                        found = true;
 
-                                // Retrieve the saved receipts.
-                                saved_receipts = json_value.get<std::map<std::string, uint64_t>>();
-                        }
+                        const bool messages = name == room_id + "/messages";
+                        const bool fetched  = name == room_id + "/fetched_events";
+                        auto eventsDb       = messages ? findDb(txn, room_id + "/event_index")
+                                                       : std::nullopt;
 
-                        // Append the new ones.
-                        for (const auto &[read_by, timestamp] : event_receipts) {
-                                if (read_by == user_id) {
-                                        emit removeNotification(QString::fromStdString(room_id),
-                                                                QString::fromStdString(event_id));
-                                }
-                                saved_receipts.emplace(read_by, timestamp);
-                        }
+                        auto cursor = lmdb::cursor::open(txn, *db);
+                        while (chunk < COMPACTION_CHUNK_SIZE && cursor.get(key, value, MDB_NEXT)) {
+                                const auto event_id = messages  ? messageKeyEventId(key)
+                                                      : fetched ? key
+                                                                : std::string();
+                                if (eventsDb && !event_id.empty())
+                                        lmdb::dbi_del(txn, *eventsDb, lmdb::val(event_id), nullptr);
 
-                        // Save back the merged (or only the new) receipts.
-                        nlohmann::json json_updated_value = saved_receipts;
-                        std::string merged_receipts       = json_updated_value.dump();
+                                // The plaintext of the decrypted events of the room goes with
+                                // them. The eviction drops their entries in the save order.
+                                if (!event_id.empty())
+                                        lmdb::dbi_del(
+                                          txn, decryptedEventsDb_, lmdb::val(event_id), nullptr);
 
-                        lmdb::dbi_put(txn,
-                                      readReceiptsDb_,
-                                      lmdb::val(key.data(), key.size()),
-                                      lmdb::val(merged_receipts.data(), merged_receipts.size()));
+                                lmdb::cursor_del(cursor);
+                                chunk += 1;
+                        }
+                        cursor.close();
 
-                } catch (const lmdb::error &e) {
-                        nhlog::db()->critical("updateReadReceipts: {}", e.what());
+                        if (chunk < COMPACTION_CHUNK_SIZE)
+                                dropDb(txn, name);
+                        break;
                 }
-        }
-}
 
-void
-Cache::notifyForReadReceipts(const std::string &room_id)
-{
-        auto txn = lmdb::txn::begin(env_);
-
-        QSettings settings;
-        auto local_user = settings.value("auth/user_id").toString();
+                if (!found) {
+                        lmdb::dbi_del(txn, removedRoomsDb_, lmdb::val(room_id), nullptr);
+                        nhlog::db()->info("[{}] reclaimed the databases of the left room",
+                                          room_id);
+                }
 
-        auto matches = filterReadEvents(QString::fromStdString(room_id),
-                                        pendingReceiptsEvents(txn, room_id),
-                                        local_user.toStdString());
+                txn.commit();
 
-        for (const auto &m : matches)
-                removePendingReceipt(txn, room_id, m.toStdString());
+                deleted += chunk;
+        } while (std::chrono::steady_clock::now() < deadline);
 
-        if (!matches.empty())
-                emit newReadReceipts(QString::fromStdString(room_id), matches);
+        if (deleted > 0)
+                nhlog::db()->debug("[{}] reclaimed {} entries of the left room", room_id, deleted);
 
-        txn.commit();
+        return true;
 }
 
 void
-Cache::calculateRoomReadStatus()
+Cache::setNextBatchToken(lmdb::txn &txn, const std::string &token)
 {
-        const auto joined_rooms = joinedRooms();
-
-        std::map<QString, bool> readStatus;
-
-        for (const auto &room : joined_rooms)
-                readStatus.emplace(QString::fromStdString(room), calculateRoomReadStatus(room));
-
-        emit roomReadStatus(readStatus);
+        lmdb::dbi_put(txn, syncStateDb_, NEXT_BATCH_KEY, lmdb::val(token.data(), token.size()));
 }
 
-bool
-Cache::calculateRoomReadStatus(const std::string &room_id)
+void
+Cache::setNextBatchToken(lmdb::txn &txn, const QString &token)
 {
-        auto txn = lmdb::txn::begin(env_);
+        setNextBatchToken(txn, token.toStdString());
+}
 
-        // Get last event id on the room.
-        const auto last_event_id = getLastEventId(txn, room_id);
-        const auto localUser     = utils::localUser().toStdString();
+void
+Cache::savePendingToDevice(lmdb::txn &txn, const std::vector<nlohmann::json> &msgs)
+{
+        if (msgs.empty())
+                return;
 
-        txn.commit();
+        uint64_t sequence = 0;
+        {
+                lmdb::val key, value;
+                auto cursor = lmdb::cursor::open(txn, pendingToDeviceDb_);
+                if (cursor.get(key, value, MDB_LAST))
+                        sequence = std::stoull(std::string(view(key))) + 1;
+                cursor.close();
+        }
 
-        if (last_event_id.empty())
-                return false;
+        // Zero padded, so the messages are handled in the order they were received.
+        const auto key = QString("%1").arg(sequence, 20, 10, QChar('0')).toStdString();
+        lmdb::dbi_put(txn, pendingToDeviceDb_, lmdb::val(key), lmdb::val(encodeValue(msgs)));
+}
 
-        // Retrieve all read receipts for that event.
-        const auto receipts =
-          readReceipts(QString::fromStdString(last_event_id), QString::fromStdString(room_id));
+std::vector<std::pair<std::string, std::vector<nlohmann::json>>>
+Cache::pendingToDeviceMessages()
+{
+        std::vector<std::pair<std::string, std::vector<nlohmann::json>>> pending;
 
-        if (receipts.size() == 0)
-                return true;
+        auto txn = beginTxn(MDB_RDONLY);
 
-        // Check if the local user has a read receipt for it.
-        for (auto it = receipts.cbegin(); it != receipts.cend(); it++) {
-                if (it->second == localUser)
-                        return false;
+        lmdb::val key, value;
+        auto cursor = lmdb::cursor::open(txn, pendingToDeviceDb_);
+        while (cursor.get(key, value, MDB_NEXT)) {
+                try {
+                        pending.emplace_back(std::string(view(key)),
+                                             decodeValue(value).get<std::vector<json>>());
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse pending to-device messages: {}",
+                                          e.what());
+                }
         }
+        cursor.close();
+        txn.commit();
 
-        return true;
+        return pending;
 }
 
 void
-Cache::saveState(const mtx::responses::Sync &res)
+Cache::removePendingToDeviceMessages(const std::string &key)
 {
-        using namespace mtx::events;
-
-        auto txn = lmdb::txn::begin(env_);
+        auto txn = beginTxn();
+        lmdb::dbi_del(txn, pendingToDeviceDb_, lmdb::val(key), nullptr);
+        txn.commit();
+}
 
-        setNextBatchToken(txn, res.next_batch);
+bool
+Cache::isInitialized() const
+{
+        auto txn = beginTxn(MDB_RDONLY);
+        lmdb::val token;
 
-        // Save joined rooms
-        for (const auto &room : res.rooms.join) {
-                auto statesdb  = getStatesDb(txn, room.first);
-                auto membersdb = getMembersDb(txn, room.first);
+        bool res = lmdb::dbi_get(txn, syncStateDb_, NEXT_BATCH_KEY, token);
 
-                saveStateEvents(txn, statesdb, membersdb, room.first, room.second.state.events);
-                saveStateEvents(txn, statesdb, membersdb, room.first, room.second.timeline.events);
+        txn.commit();
 
-                saveTimelineMessages(txn, room.first, room.second.timeline);
+        return res;
+}
 
-                RoomInfo updatedInfo;
-                updatedInfo.name  = getRoomName(txn, statesdb, membersdb).toStdString();
-                updatedInfo.topic = getRoomTopic(txn, statesdb).toStdString();
-                updatedInfo.avatar_url =
-                  getRoomAvatarUrl(txn, statesdb, membersdb, QString::fromStdString(room.first))
-                    .toStdString();
-                updatedInfo.version = getRoomVersion(txn, statesdb).toStdString();
-
-                // Process the account_data associated with this room
-                bool has_new_tags = false;
-                for (const auto &evt : room.second.account_data.events) {
-                        // for now only fetch tag events
-                        if (std::holds_alternative<Event<account_data::Tag>>(evt)) {
-                                auto tags_evt = std::get<Event<account_data::Tag>>(evt);
-                                has_new_tags  = true;
-                                for (const auto &tag : tags_evt.content.tags) {
-                                        updatedInfo.tags.push_back(tag.first);
+std::string
+Cache::nextBatchToken() const
+{
+        auto txn = beginTxn(MDB_RDONLY);
+        lmdb::val token;
+
+        lmdb::dbi_get(txn, syncStateDb_, NEXT_BATCH_KEY, token);
+
+        txn.commit();
+
+        return std::string(token.data(), token.size());
+}
+
+std::string
+Cache::syncFilterId(const std::string &name, const std::string &definition)
+{
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+                lmdb::val data;
+                if (!lmdb::dbi_get(txn, syncStateDb_, SYNC_FILTERS_KEY, data)) {
+                        txn.commit();
+                        return {};
+                }
+
+                const auto filter = decodeValue(data).value(name, json::object());
+                txn.commit();
+
+                if (filter.value("definition", "") == definition)
+                        return filter.value("id", "");
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the sync filter {}: {}", name, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the sync filters: {}", e.what());
+        }
+
+        return {};
+}
+
+void
+Cache::saveSyncFilterId(const std::string &name,
+                        const std::string &definition,
+                        const std::string &filter_id)
+{
+        try {
+                auto txn = beginTxn();
+
+                json filters = json::object();
+                lmdb::val data;
+                if (lmdb::dbi_get(txn, syncStateDb_, SYNC_FILTERS_KEY, data))
+                        filters = decodeValue(data);
+
+                filters[name] = {{"definition", definition}, {"id", filter_id}};
+                lmdb::dbi_put(txn, syncStateDb_, SYNC_FILTERS_KEY, lmdb::val(encodeValue(filters)));
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save the sync filter {}: {}", name, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the sync filters: {}", e.what());
+        }
+}
+
+std::string
+Cache::mentionsToken()
+{
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+                lmdb::val data;
+                if (lmdb::dbi_get(txn, syncStateDb_, MENTIONS_TOKEN_KEY, data))
+                        return std::string(data.data(), data.size());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the mentions token: {}", e.what());
+        }
+
+        return {};
+}
+
+void
+Cache::saveMentionsToken(const std::string &token)
+{
+        try {
+                auto txn = beginTxn();
+                if (token.empty())
+                        lmdb::dbi_del(txn, syncStateDb_, MENTIONS_TOKEN_KEY, nullptr);
+                else
+                        lmdb::dbi_put(txn, syncStateDb_, MENTIONS_TOKEN_KEY, lmdb::val(token));
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save the mentions token: {}", e.what());
+        }
+}
+
+void
+Cache::saveMembers(const std::string &room_id,
+                   const std::vector<mtx::events::StateEvent<mtx::events::state::Member>> &members)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("saveMembers"));
+
+        auto txn       = beginTxn();
+        auto statesdb  = getStatesDb(txn, room_id);
+        auto membersdb = getMembersDb(txn, room_id);
+
+        for (const auto &member : members)
+                saveStateEvent(txn,
+                               statesdb,
+                               membersdb,
+                               room_id,
+                               mtx::events::collections::StateEvents{member});
+
+        txn.commit();
+
+        {
+                std::lock_guard lock(largeRoomsMutex_);
+                largeRooms_.erase(room_id);
+        }
+
+        refreshRoomInfo({room_id});
+}
+
+void
+Cache::deleteData()
+{
+        // TODO: We need to remove the env_ while not accepting new requests.
+        if (cacheDirectory_.isEmpty())
+                return;
+
+        // The directory is moved aside, so a new cache can be created right away, and the
+        // media files, of which there may be many, are deleted in the background.
+        const auto removed = QString("%1.removed-%2")
+                               .arg(cacheDirectory_)
+                               .arg(QDateTime::currentMSecsSinceEpoch());
+        if (QDir().rename(cacheDirectory_, removed)) {
+                removeInBackground(removed);
+                return;
+        }
+
+        QDir(cacheDirectory_).removeRecursively();
+        nhlog::db()->info("deleted cache files from disk");
+}
+
+bool
+Cache::isFormatValid()
+{
+        auto txn = beginTxn(MDB_RDONLY);
+
+        lmdb::val current_version;
+        bool res = lmdb::dbi_get(txn, syncStateDb_, CACHE_FORMAT_VERSION_KEY, current_version);
+
+        txn.commit();
+
+        if (!res)
+                return false;
+
+        std::string stored_version(current_version.data(), current_version.size());
+
+        if (stored_version != CURRENT_CACHE_FORMAT_VERSION) {
+                nhlog::db()->warn("breaking changes in the cache format. stored: {}, current: {}",
+                                  stored_version,
+                                  CURRENT_CACHE_FORMAT_VERSION);
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::runMigrations()
+{
+        std::string stored_version;
+
+        {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                lmdb::val current_version;
+                bool res =
+                  lmdb::dbi_get(txn, syncStateDb_, CACHE_FORMAT_VERSION_KEY, current_version);
+
+                txn.commit();
+
+                if (!res)
+                        return false;
+
+                stored_version = std::string(current_version.data(), current_version.size());
+        }
+
+        if (stored_version < OLDEST_MIGRATABLE_FORMAT_VERSION)
+                return false;
+
+        auto pending = pendingMigrations();
+
+        for (const auto &migration : migrations()) {
+                if (stored_version >= migration.version)
+                        continue;
+
+                if (migration.background) {
+                        nhlog::db()->info("deferring cache migration to format {}",
+                                          migration.version);
+                        pending.push_back(migration.version);
+                        continue;
+                }
+
+                nhlog::db()->info("running cache migration to format {}", migration.version);
+
+                if (!migration.run()) {
+                        nhlog::db()->critical("cache migration to format {} failed",
+                                              migration.version);
+                        return false;
+                }
+        }
+
+        // The deferred migrations are recorded together with the format, so a crash can't lose
+        // them.
+        auto txn = beginTxn();
+        savePendingMigrations(txn, pending);
+        lmdb::dbi_put(
+          txn,
+          syncStateDb_,
+          CACHE_FORMAT_VERSION_KEY,
+          lmdb::val(CURRENT_CACHE_FORMAT_VERSION.data(), CURRENT_CACHE_FORMAT_VERSION.size()));
+        txn.commit();
+
+        return true;
+}
+
+std::vector<Cache::Migration>
+Cache::migrations()
+{
+        // Ordered by the format version they produce. The background migrations only rebuild
+        // data derived from the messages, which the client can do without for a while, so they
+        // must not be needed by the later migrations.
+        return {
+          {"2020.05.01", [this]() { return migrateMessageKeys(); }, false},
+          {"2020.05.02", [this]() { return buildEventIndex(); }, true},
+          {"2020.05.03", [this]() { return encodeValues(); }, false},
+          {"2020.05.04", [this]() { return migrateMedia(); }, false},
+          {"2020.05.05", [this]() { return buildLastMessages(); }, true},
+          {"2020.05.06", [this]() { return migrateReceiptKeys(); }, false},
+          {"2020.05.07", [this]() { return migrateMentions(); }, false},
+          {"2020.05.08", [this]() { return migrateUserReceipts(); }, false},
+          {"2020.05.09", [this]() { return migrateCryptoEnvironment(); }, false},
+          {"2020.05.10", [this]() { return buildTagIndex(); }, false},
+          {"2020.05.11", [this]() { return compressMessages(); }, true},
+        };
+}
+
+std::vector<std::string>
+Cache::pendingMigrations()
+{
+        auto txn = beginTxn(MDB_RDONLY);
+
+        lmdb::val value;
+        if (!lmdb::dbi_get(txn, syncStateDb_, PENDING_MIGRATIONS_KEY, value))
+                return {};
+
+        try {
+                return json::parse(std::string_view(value.data(), value.size()))
+                  .get<std::vector<std::string>>();
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the pending migrations: {}", e.what());
+                return {};
+        }
+}
+
+void
+Cache::savePendingMigrations(lmdb::txn &txn, const std::vector<std::string> &versions)
+{
+        if (versions.empty()) {
+                lmdb::dbi_del(txn, syncStateDb_, PENDING_MIGRATIONS_KEY, nullptr);
+                return;
+        }
+
+        const auto value = json(versions).dump();
+        lmdb::dbi_put(txn, syncStateDb_, PENDING_MIGRATIONS_KEY, lmdb::val(value));
+}
+
+bool
+Cache::runPendingMigrations()
+{
+        auto pending = pendingMigrations();
+        if (pending.empty())
+                return false;
+
+        for (const auto &migration : migrations()) {
+                auto it = std::find(pending.begin(), pending.end(), migration.version);
+                if (it == pending.end())
+                        continue;
+
+                nhlog::db()->info("running deferred cache migration to format {}",
+                                  migration.version);
+
+                // A failed migration is tried again on the next start. The data it rebuilds
+                // is only missing until then.
+                if (!migration.run()) {
+                        nhlog::db()->critical("deferred cache migration to format {} failed",
+                                              migration.version);
+                        continue;
+                }
+
+                pending.erase(it);
+
+                auto txn = beginTxn();
+                savePendingMigrations(txn, pending);
+                txn.commit();
+        }
+
+        return true;
+}
+
+bool
+Cache::migrateMessageKeys()
+{
+        try {
+                for (const auto &room_id : joinedRooms()) {
+                        const auto db_name = room_id + "/messages";
+
+                        // Every room is migrated in one txn, so a crash leaves it either in the
+                        // old or the new format. The rooms migrated before the crash are
+                        // recognized by their keys and skipped, when the migration runs again.
+                        auto txn = beginTxn();
+                        auto db  = lmdb::dbi::open(txn, db_name.c_str(), MDB_CREATE);
+
+                        // Walking to the first key doesn't compare keys, so it is safe with
+                        // either comparator.
+                        std::string timestamp, msg;
+                        {
+                                auto cursor = lmdb::cursor::open(txn, db);
+                                const bool legacy = cursor.get(timestamp, msg, MDB_FIRST) &&
+                                                    isLegacyMessageKey(timestamp);
+                                cursor.close();
+
+                                // The txn is aborted, when it goes out of scope.
+                                if (!legacy)
+                                        continue;
+                        }
+
+                        lmdb::dbi_set_compare(txn, db, numeric_key_comparison);
+
+                        // Rebuild the keys in memory, while the old comparator is in place.
+                        std::vector<std::pair<std::string, std::string>> messages;
+
+                        auto cursor = lmdb::cursor::open(txn, db);
+                        while (cursor.get(timestamp, msg, MDB_NEXT)) {
+                                try {
+                                        auto obj = json::parse(msg);
+
+                                        if (obj.count("event") == 0)
+                                                continue;
+
+                                        messages.emplace_back(
+                                          messageKey(std::stoull(timestamp),
+                                                     obj.at("event").value("event_id", "")),
+                                          std::move(msg));
+                                } catch (const std::exception &e) {
+                                        nhlog::db()->warn("dropping malformed message in {}: {}",
+                                                          room_id,
+                                                          e.what());
                                 }
                         }
+                        cursor.close();
+
+                        lmdb::dbi_drop(txn, db, true);
+                        dbis_.dropped(txn.handle(), db_name);
+
+                        auto newDb = getMessagesDb(txn, room_id);
+                        for (const auto &[key, value] : messages)
+                                lmdb::dbi_put(txn, newDb, lmdb::val(key), lmdb::val(value));
+
+                        txn.commit();
+
+                        nhlog::db()->info("[{}] migrated {} messages", room_id, messages.size());
                 }
-                if (!has_new_tags) {
-                        // retrieve the old tags, they haven't changed
-                        lmdb::val data;
-                        if (lmdb::dbi_get(txn, roomsDb_, lmdb::val(room.first), data)) {
-                                try {
-                                        RoomInfo tmp =
-                                          json::parse(std::string(data.data(), data.size()));
-                                        updatedInfo.tags = tmp.tags;
-                                } catch (const json::exception &e) {
-                                        nhlog::db()->warn(
-                                          "failed to parse room info: room_id ({}), {}",
-                                          room.first,
-                                          std::string(data.data(), data.size()));
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to migrate message keys: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::buildEventIndex()
+{
+        try {
+                for (const auto &room_id : joinedRooms()) {
+                        // It runs in the background, so a large room is indexed in chunks and
+                        // the sync can write in between.
+                        std::string last;
+                        bool more = true;
+                        while (more) {
+                                auto txn      = beginTxn();
+                                auto msgDb    = getMessagesDb(txn, room_id);
+                                auto eventsDb = getEventIndexDb(txn, room_id);
+
+                                lmdb::val key(last.data(), last.size()), unused;
+
+                                auto cursor = lmdb::cursor::open(txn, msgDb);
+                                more        = last.empty() ? cursor.get(key, unused, MDB_FIRST)
+                                                           : cursor.get(key, unused, MDB_SET_RANGE);
+                                if (more && std::string_view(key.data(), key.size()) == last)
+                                        more = cursor.get(key, unused, MDB_NEXT);
+
+                                for (size_t count = 0; more && count < MIGRATION_CHUNK_SIZE;
+                                     count++) {
+                                        last = std::string(key.data(), key.size());
+
+                                        const auto event_id = messageKeyEventId(last);
+                                        if (!event_id.empty())
+                                                lmdb::dbi_put(txn,
+                                                              eventsDb,
+                                                              lmdb::val(event_id),
+                                                              lmdb::val(last));
+
+                                        more = cursor.get(key, unused, MDB_NEXT);
+                                }
+                                cursor.close();
+
+                                txn.commit();
+                        }
+                }
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to build the event index: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::compressMessages()
+{
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+        using std::chrono::steady_clock;
+
+        // Tried again on the next start, once compression is enabled.
+        if (!compression::enabled())
+                return false;
+
+        try {
+                const auto rooms = joinedRooms();
+
+                // The dictionary is never replaced, the values compressed with it need it.
+                if (!compression::hasDictionary()) {
+                        std::vector<json> samples;
+                        {
+                                auto txn = beginTxn(MDB_RDONLY);
+                                for (const auto &room_id : rooms) {
+                                        if (samples.size() >= MAX_DICTIONARY_SAMPLES)
+                                                break;
+
+                                        auto db = getMessagesDb(txn, room_id);
+
+                                        lmdb::val key, value;
+                                        auto cursor = lmdb::cursor::open(txn, db);
+                                        for (std::size_t i = 0;
+                                             i < DICTIONARY_SAMPLES_PER_ROOM &&
+                                             samples.size() < MAX_DICTIONARY_SAMPLES &&
+                                             cursor.get(key, value, MDB_PREV);
+                                             i++) {
+                                                try {
+                                                        samples.push_back(decodeValue(value));
+                                                } catch (const json::exception &) {
+                                                }
+                                        }
+                                        cursor.close();
+                                }
+                                txn.commit();
+                        }
+
+                        // Tried again on the next start, the messages are compressed without
+                        // a dictionary until then.
+                        if (samples.size() < MIN_DICTIONARY_SAMPLES) {
+                                nhlog::db()->info("only {} messages to train the dictionary on",
+                                                  samples.size());
+                                return false;
+                        }
+
+                        auto dictionary = compression::train(samples);
+
+                        auto txn = beginTxn();
+                        lmdb::dbi_put(
+                          txn, syncStateDb_, MESSAGES_DICTIONARY_KEY, lmdb::val(dictionary));
+                        txn.commit();
+
+                        nhlog::db()->info("trained a dictionary of {} bytes on {} messages",
+                                          dictionary.size(),
+                                          samples.size());
+                        compression::setDictionary(std::move(dictionary));
+                }
+
+                // The parsing is timed with and without the decompression, so the log tells
+                // what the smaller reads cost.
+                std::size_t count = 0, plain_size = 0, compressed_size = 0;
+                steady_clock::duration plain_time{}, compressed_time{};
+
+                for (const auto &room_id : rooms) {
+                        // It runs in the background, so a large room is compressed in chunks
+                        // and the sync can write in between.
+                        std::string last;
+                        bool more = true;
+                        while (more) {
+                                auto txn = beginTxn();
+                                auto db  = getMessagesDb(txn, room_id);
+
+                                std::vector<std::pair<std::string, std::string>> values;
+
+                                lmdb::val key(last.data(), last.size()), value;
+
+                                auto cursor = lmdb::cursor::open(txn, db);
+                                more        = last.empty() ? cursor.get(key, value, MDB_FIRST)
+                                                           : cursor.get(key, value, MDB_SET_RANGE);
+                                if (more && std::string_view(key.data(), key.size()) == last)
+                                        more = cursor.get(key, value, MDB_NEXT);
+
+                                for (size_t i = 0; more && i < MIGRATION_CHUNK_SIZE; i++) {
+                                        last = std::string(key.data(), key.size());
+
+                                        // Values compressed without the dictionary are
+                                        // compressed again.
+                                        auto encoded = std::optional<std::string>(
+                                          std::string(value.data(), value.size()));
+                                        if (compression::isCompressed(*encoded))
+                                                encoded = compression::decompress(*encoded);
+
+                                        // A malformed value is kept as it is.
+                                        try {
+                                                if (!encoded)
+                                                        throw compression::Error(
+                                                          "failed to decompress it");
+
+                                                auto compressed = compression::compress(*encoded);
+
+                                                auto start = steady_clock::now();
+                                                decodeValue(*encoded);
+                                                plain_time += steady_clock::now() - start;
+
+                                                start = steady_clock::now();
+                                                decodeValue(compressed);
+                                                compressed_time += steady_clock::now() - start;
+
+                                                count += 1;
+                                                plain_size += encoded->size();
+                                                compressed_size += compressed.size();
+
+                                                if (compressed != view(value))
+                                                        values.emplace_back(last,
+                                                                            std::move(compressed));
+                                        } catch (const json::exception &e) {
+                                                nhlog::db()->warn(
+                                                  "not compressing message {} in {}: {}",
+                                                  last,
+                                                  room_id,
+                                                  e.what());
+                                        }
+
+                                        more = cursor.get(key, value, MDB_NEXT);
                                 }
+                                cursor.close();
+
+                                for (const auto &[k, v] : values)
+                                        lmdb::dbi_put(txn, db, lmdb::val(k), lmdb::val(v));
+
+                                txn.commit();
                         }
                 }
-
-                lmdb::dbi_put(
-                  txn, roomsDb_, lmdb::val(room.first), lmdb::val(json(updatedInfo).dump()));
-
-                updateReadReceipt(txn, room.first, room.second.ephemeral.receipts);
-
-                // Clean up non-valid invites.
-                removeInvite(txn, room.first);
+
+                if (count > 0)
+                        nhlog::db()->info(
+                          "compressed {} messages from {} to {} bytes, parsing one takes {} us "
+                          "instead of {} us",
+                          count,
+                          plain_size,
+                          compressed_size,
+                          duration_cast<microseconds>(compressed_time).count() / double(count),
+                          duration_cast<microseconds>(plain_time).count() / double(count));
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to compress the messages: {}", e.what());
+                return false;
+        } catch (const json::exception &e) {
+                nhlog::db()->critical("failed to compress the messages: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::encodeValues()
+{
+        std::size_t count = 0, json_size = 0, cbor_size = 0;
+        std::chrono::steady_clock::duration json_time{}, cbor_time{};
+
+        auto reencode = [&](lmdb::txn &txn, lmdb::dbi &db) {
+                std::vector<std::pair<std::string, std::string>> values;
+
+                std::string key, value;
+
+                auto cursor = lmdb::cursor::open(txn, db);
+                while (cursor.get(key, value, MDB_NEXT)) {
+                        if (value.empty() || value.front() != '{')
+                                continue;
+
+                        try {
+                                auto start = std::chrono::steady_clock::now();
+                                auto obj   = json::parse(value);
+                                json_time += std::chrono::steady_clock::now() - start;
+
+                                auto encoded = encodeValue(obj);
+
+                                // Measure the new format as well, so the log shows what we gained.
+                                start = std::chrono::steady_clock::now();
+                                decodeValue(encoded);
+                                cbor_time += std::chrono::steady_clock::now() - start;
+
+                                count += 1;
+                                json_size += value.size();
+                                cbor_size += encoded.size();
+
+                                values.emplace_back(std::move(key), std::move(encoded));
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn("failed to re-encode value: {}", e.what());
+                        }
+                }
+                cursor.close();
+
+                for (const auto &[k, v] : values)
+                        lmdb::dbi_put(txn, db, lmdb::val(k), lmdb::val(v));
+        };
+
+        try {
+                {
+                        auto txn        = beginTxn();
+                        auto receiptsDb = lmdb::dbi::open(txn, READ_RECEIPTS_DB, MDB_CREATE);
+
+                        reencode(txn, roomsDb_);
+                        reencode(txn, invitesDb_);
+                        reencode(txn, receiptsDb);
+
+                        txn.commit();
+                }
+
+                for (const auto &room_id : joinedRooms()) {
+                        auto txn       = beginTxn();
+                        auto membersDb = getMembersDb(txn, room_id);
+                        auto msgDb     = getMessagesDb(txn, room_id);
+
+                        reencode(txn, membersDb);
+                        reencode(txn, msgDb);
+
+                        txn.commit();
+                }
+
+                for (const auto &invite : invites()) {
+                        auto txn       = beginTxn();
+                        auto membersDb = getInviteMembersDb(txn, invite.first.toStdString());
+
+                        reencode(txn, membersDb);
+
+                        txn.commit();
+                }
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to re-encode the cache values: {}", e.what());
+                return false;
+        }
+
+        using std::chrono::milliseconds;
+        nhlog::db()->info("re-encoded {} values: {} -> {} bytes, parsing {}ms -> {}ms",
+                          count,
+                          json_size,
+                          cbor_size,
+                          std::chrono::duration_cast<milliseconds>(json_time).count(),
+                          std::chrono::duration_cast<milliseconds>(cbor_time).count());
+
+        return true;
+}
+
+bool
+Cache::migrateReceiptKeys()
+{
+        auto rekey = [](lmdb::txn &txn, lmdb::dbi &db) {
+                std::vector<std::pair<std::string, std::string>> receipts;
+
+                std::string key, value;
+
+                auto cursor = lmdb::cursor::open(txn, db);
+                while (cursor.get(key, value, MDB_NEXT)) {
+                        try {
+                                ReadReceiptKey receipt = json::parse(key);
+                                receipts.emplace_back(
+                                  receiptKey(receipt.room_id, receipt.event_id), std::move(value));
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn("dropping malformed receipt key: {}", e.what());
+                        }
+                }
+                cursor.close();
+
+                lmdb::dbi_drop(txn, db, false);
+
+                for (const auto &[k, v] : receipts)
+                        lmdb::dbi_put(txn, db, lmdb::val(k), lmdb::val(v));
+
+                return receipts.size();
+        };
+
+        try {
+                auto txn        = beginTxn();
+                auto pendingDb  = getPendingReceiptsDb(txn);
+                auto receiptsDb = lmdb::dbi::open(txn, READ_RECEIPTS_DB, MDB_CREATE);
+
+                const auto count = rekey(txn, receiptsDb);
+                rekey(txn, pendingDb);
+
+                txn.commit();
+
+                nhlog::db()->info("migrated the keys of {} read receipts", count);
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to migrate the read receipts: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::migrateUserReceipts()
+{
+        try {
+                auto txn        = beginTxn();
+                auto receiptsDb = lmdb::dbi::open(txn, READ_RECEIPTS_DB, MDB_CREATE);
+
+                // receiptKey(room_id, user_id) -> (timestamp, event_id)
+                std::map<std::string, std::pair<uint64_t, std::string>> latest;
+                std::size_t count = 0;
+
+                std::string key, value;
+
+                auto cursor = lmdb::cursor::open(txn, receiptsDb);
+                while (cursor.get(key, value, MDB_NEXT)) {
+                        const auto separator = key.find('\0');
+                        if (separator == std::string::npos)
+                                continue;
+
+                        const auto room_id  = key.substr(0, separator);
+                        const auto event_id = key.substr(separator + 1);
+
+                        try {
+                                for (const auto &[user_id, ts] :
+                                     decodeValue(value).get<std::map<std::string, uint64_t>>()) {
+                                        auto &newest = latest[receiptKey(room_id, user_id)];
+                                        if (newest.second.empty() || ts > newest.first)
+                                                newest = {ts, event_id};
+                                }
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn("dropping malformed receipts: {}", e.what());
+                        }
+
+                        count++;
+                }
+                cursor.close();
+
+                for (const auto &[k, receipt] : latest)
+                        lmdb::dbi_put(txn,
+                                      userReceiptsDb_,
+                                      lmdb::val(k),
+                                      lmdb::val(messageKey(receipt.first, receipt.second)));
+
+                lmdb::dbi_drop(txn, receiptsDb, true);
+
+                txn.commit();
+
+                nhlog::db()->info(
+                  "migrated the receipts of {} events to {} users", count, latest.size());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to migrate the read receipts: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::migrateCryptoEnvironment()
+{
+        const std::string olmSessionsPrefix = "olm_sessions/";
+
+        // The keys are only deleted from the state environment, once their copies are committed.
+        // If we crash in between, the migration runs again and copies them again.
+        try {
+                std::vector<std::string> olmSessionDbs;
+                std::size_t count = 0;
+                {
+                        auto txn       = beginTxn(MDB_RDONLY);
+                        auto cryptoTxn = beginCryptoTxn();
+
+                        auto copy = [&txn, &cryptoTxn, &count](const lmdb::dbi &from,
+                                                               const lmdb::dbi &to) {
+                                lmdb::val key, value;
+                                auto cursor = lmdb::cursor::open(txn, from);
+                                while (cursor.get(key, value, MDB_NEXT)) {
+                                        lmdb::dbi_put(cryptoTxn, to, key, value);
+                                        count++;
+                                }
+                                cursor.close();
+                        };
+
+                        lmdb::val account;
+                        if (lmdb::dbi_get(txn, syncStateDb_, OLM_ACCOUNT_KEY, account))
+                                lmdb::dbi_put(cryptoTxn, cryptoStateDb_, OLM_ACCOUNT_KEY, account);
+
+                        if (auto db = findDb(txn, INBOUND_MEGOLM_SESSIONS_DB))
+                                copy(*db, inboundMegolmSessionDb_);
+                        if (auto db = findDb(txn, OUTBOUND_MEGOLM_SESSIONS_DB))
+                                copy(*db, outboundMegolmSessionDb_);
+                        if (auto db = findDb(txn, OLM_SESSION_USAGE_DB))
+                                copy(*db, olmSessionUsageDb_);
+
+                        // The keys of the main db are the names of all other dbs.
+                        auto mainDb = lmdb::dbi::open(txn, nullptr);
+                        auto cursor = lmdb::cursor::open(txn, mainDb);
+                        lmdb::val name, unused;
+                        while (cursor.get(name, unused, MDB_NEXT)) {
+                                if (view(name).substr(0, olmSessionsPrefix.size()) ==
+                                    olmSessionsPrefix)
+                                        olmSessionDbs.emplace_back(view(name));
+                        }
+                        cursor.close();
+
+                        for (const auto &db : olmSessionDbs) {
+                                if (auto from = findDb(txn, db))
+                                        copy(*from,
+                                             getOlmSessionsDb(
+                                               cryptoTxn, db.substr(olmSessionsPrefix.size())));
+                        }
+
+                        cryptoTxn.commit();
+                        txn.commit();
+                }
+
+                auto txn = beginTxn();
+                lmdb::dbi_del(txn, syncStateDb_, OLM_ACCOUNT_KEY, nullptr);
+                dropDb(txn, INBOUND_MEGOLM_SESSIONS_DB);
+                dropDb(txn, OUTBOUND_MEGOLM_SESSIONS_DB);
+                dropDb(txn, OLM_SESSION_USAGE_DB);
+                for (const auto &db : olmSessionDbs)
+                        dropDb(txn, db);
+                txn.commit();
+
+                nhlog::db()->info("moved the olm account and {} keys to the crypto environment",
+                                  count);
+        } catch (const lmdb::map_full_error &e) {
+                // The copies were aborted, so they are simply made again in the larger map.
+                nhlog::db()->warn("the crypto db is full: {}", e.what());
+                if (growCryptoMapSize())
+                        return migrateCryptoEnvironment();
+
+                nhlog::db()->critical("failed to move the keys to the crypto environment: {}",
+                                      e.what());
+                return false;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to move the keys to the crypto environment: {}",
+                                      e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::migrateMentions()
+{
+        try {
+                mtx::responses::Notifications mentions;
+
+                for (const auto &room_id : joinedRooms()) {
+                        const auto db_name = room_id + "/mentions";
+
+                        auto txn = beginTxn();
+
+                        std::string event_id, msg;
+
+                        auto cursor = lmdb::cursor::open(txn, openDb(txn, db_name));
+                        while (cursor.get(event_id, msg, MDB_NEXT)) {
+                                try {
+                                        mentions.notifications.push_back(
+                                          json::parse(msg).get<mtx::responses::Notification>());
+                                } catch (const json::exception &e) {
+                                        nhlog::db()->warn("dropping a malformed mention in {}: {}",
+                                                          room_id,
+                                                          e.what());
+                                }
+                        }
+                        cursor.close();
+
+                        dropDb(txn, db_name);
+                        txn.commit();
+                }
+
+                saveTimelineMentions(mentions);
+
+                nhlog::db()->info("migrated {} mentions", mentions.notifications.size());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to migrate the mentions: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::buildTagIndex()
+{
+        try {
+                auto txn    = beginTxn();
+                auto cursor = lmdb::cursor::open(txn, roomsDb_);
+
+                std::size_t tagged = 0;
+                std::string room_id, data;
+                while (cursor.get(room_id, data, MDB_NEXT)) {
+                        try {
+                                const RoomInfo info = decodeValue(data);
+                                for (const auto &tag : info.tags)
+                                        lmdb::dbi_put(txn,
+                                                      tagsDb_,
+                                                      lmdb::val(tagKey(tag, room_id)),
+                                                      lmdb::val(""));
+                                tagged += info.tags.size();
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn(
+                                  "failed to parse room info: room_id ({}), {}", room_id, e.what());
+                        }
+                }
+                cursor.close();
+
+                txn.commit();
+
+                nhlog::db()->info("indexed {} room tags", tagged);
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to build the tag index: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::buildLastMessages()
+{
+        try {
+                for (const auto &room_id : joinedRooms()) {
+                        // The descriptions contain the display names of the senders, which
+                        // can't be read during the transaction.
+                        loadMembers(QString::fromStdString(room_id));
+
+                        auto txn = beginTxn();
+                        updateLastMessageInfo(txn, room_id);
+                        txn.commit();
+                }
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to build the last messages: {}", e.what());
+                return false;
+        }
+
+        return true;
+}
+
+bool
+Cache::migrateMedia()
+{
+        try {
+                std::vector<std::string> urls;
+                {
+                        auto txn = beginTxn();
+                        auto db  = lmdb::dbi::open(txn, MEDIA_DB, MDB_CREATE);
+
+                        std::string url, unused;
+
+                        auto cursor = lmdb::cursor::open(txn, db);
+                        while (cursor.get(url, unused, MDB_NEXT))
+                                urls.push_back(std::move(url));
+                        cursor.close();
+
+                        txn.commit();
+                }
+
+                // Copy one blob at a time, so we never hold the whole media db in memory.
+                for (const auto &url : urls) {
+                        QByteArray data;
+                        {
+                                auto txn = beginTxn(MDB_RDONLY);
+                                auto db  = lmdb::dbi::open(txn, MEDIA_DB, MDB_CREATE);
+
+                                lmdb::val value;
+                                if (lmdb::dbi_get(txn, db, lmdb::val(url), value))
+                                        data = QByteArray(value.data(), value.size());
+
+                                txn.commit();
+                        }
+
+                        saveMedia(QString::fromStdString(url), data);
+                }
+
+                auto txn = beginTxn();
+                auto db  = lmdb::dbi::open(txn, MEDIA_DB, MDB_CREATE);
+                lmdb::dbi_drop(txn, db, true);
+                txn.commit();
+
+                nhlog::db()->info("moved {} media blobs into the media store", urls.size());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to migrate the media db: {}", e.what());
+                return false;
+        }
+
+        // Files downloaded by the timeline are kept in the media store as well now.
+        QDir(QString("%1/media_cache")
+               .arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation)))
+          .removeRecursively();
+
+        return true;
+}
+
+void
+Cache::setCurrentFormat()
+{
+        auto txn = beginTxn();
+
+        lmdb::dbi_put(
+          txn,
+          syncStateDb_,
+          CACHE_FORMAT_VERSION_KEY,
+          lmdb::val(CURRENT_CACHE_FORMAT_VERSION.data(), CURRENT_CACHE_FORMAT_VERSION.size()));
+        // A new cache has no messages to train the dictionary on yet, so it is trained on the
+        // next start.
+        savePendingMigrations(txn, {"2020.05.11"});
+
+        txn.commit();
+}
+
+std::vector<QString>
+Cache::pendingReceiptsEvents(lmdb::txn &txn, const std::string &room_id)
+{
+        auto db = getPendingReceiptsDb(txn);
+
+        const auto prefix = receiptKey(room_id, "");
+
+        std::vector<QString> pending;
+
+        // The pending receipts of the room follow its prefix.
+        lmdb::val key(prefix.data(), prefix.size()), unused;
+
+        auto cursor = lmdb::cursor::open(txn, db);
+        bool found  = cursor.get(key, unused, MDB_SET_RANGE);
+        while (found) {
+                std::string_view k(key.data(), key.size());
+                if (k.substr(0, prefix.size()) != prefix)
+                        break;
+
+                pending.emplace_back(QString::fromUtf8(k.data() + prefix.size(),
+                                                       static_cast<int>(k.size() - prefix.size())));
+
+                found = cursor.get(key, unused, MDB_NEXT);
+        }
+
+        cursor.close();
+
+        return pending;
+}
+
+void
+Cache::removePendingReceipt(lmdb::txn &txn, const std::string &room_id, const std::string &event_id)
+{
+        auto db = getPendingReceiptsDb(txn);
+
+        const auto key = receiptKey(room_id, event_id);
+
+        try {
+                lmdb::dbi_del(txn, db, lmdb::val(key.data(), key.size()), nullptr);
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("removePendingReceipt: {}", e.what());
+        }
+}
+
+void
+Cache::addPendingReceipt(const QString &room_id, const QString &event_id)
+{
+        auto txn = beginTxn();
+        auto db  = getPendingReceiptsDb(txn);
+
+        const auto key = receiptKey(room_id.toStdString(), event_id.toStdString());
+        std::string empty;
+
+        try {
+                lmdb::dbi_put(txn,
+                              db,
+                              lmdb::val(key.data(), key.size()),
+                              lmdb::val(empty.data(), empty.size()));
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("addPendingReceipt: {}", e.what());
+        }
+
+        txn.commit();
+}
+
+std::map<std::string, std::pair<std::string, uint64_t>>
+Cache::roomReceipts(lmdb::txn &txn, const std::string &room_id)
+{
+        std::map<std::string, std::pair<std::string, uint64_t>> receipts;
+
+        // The receipts of the room follow its prefix.
+        const auto prefix = receiptKey(room_id, "");
+        lmdb::val key(prefix.data(), prefix.size()), value;
+
+        auto cursor = lmdb::cursor::open(txn, userReceiptsDb_);
+        bool found  = cursor.get(key, value, MDB_SET_RANGE);
+        while (found) {
+                std::string_view k(key.data(), key.size());
+                if (k.substr(0, prefix.size()) != prefix)
+                        break;
+
+                const auto receipt = view(value);
+                receipts.emplace(std::string(k.substr(prefix.size())),
+                                 std::make_pair(messageKeyEventId(receipt),
+                                                messageKeyTimestamp(receipt)));
+
+                found = cursor.get(key, value, MDB_NEXT);
+        }
+
+        cursor.close();
+
+        return receipts;
+}
+
+std::string
+Cache::eventOrderKey(lmdb::txn &txn, const std::string &room_id, const std::string &event_id)
+{
+        auto db = findDb(txn, room_id + "/event_index");
+
+        lmdb::val key;
+        if (!db || !lmdb::dbi_get(txn, *db, lmdb::val(event_id), key))
+                return {};
+
+        return std::string(key.data(), key.size());
+}
+
+CachedReceipts
+Cache::readReceipts(const QString &event_id, const QString &room_id)
+{
+        CachedReceipts receipts;
+
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                const auto room   = room_id.toStdString();
+                const auto target = event_id.toStdString();
+                const auto order  = eventOrderKey(txn, room, target);
+
+                // Many users read up to the same event.
+                std::map<std::string, std::string> orders;
+                auto readUpTo = [&](const std::string &id) -> const std::string & {
+                        auto it = orders.find(id);
+                        if (it == orders.end())
+                                it = orders.emplace(id, eventOrderKey(txn, room, id)).first;
+                        return it->second;
+                };
+
+                // Only the newest receipt of every user is stored. A user, whose receipt is for a
+                // later event, read this one too.
+                for (const auto &[user_id, receipt] : roomReceipts(txn, room))
+                        if (receipt.first == target ||
+                            (!order.empty() && readUpTo(receipt.first) > order))
+                                // timestamp, user_id
+                                receipts.emplace(receipt.second, user_id);
+
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("readReceipts: {}", e.what());
+        }
+
+        return receipts;
+}
+
+Receipts
+Cache::latestReadReceipts(const std::string &room_id)
+{
+        Receipts receipts;
+
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                for (const auto &[user_id, receipt] : roomReceipts(txn, room_id))
+                        receipts[receipt.first][user_id] = receipt.second;
+
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("latestReadReceipts: {}", e.what());
+        }
+
+        return receipts;
+}
+
+std::vector<QString>
+Cache::filterReadEvents(const QString &room_id,
+                        const std::vector<QString> &event_ids,
+                        const std::string &excluded_user)
+{
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+                auto read_events =
+                  filterReadEvents(txn, room_id.toStdString(), event_ids, excluded_user);
+                txn.commit();
+
+                return read_events;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("filterReadEvents: {}", e.what());
+        }
+
+        return {};
+}
+
+std::vector<QString>
+Cache::filterReadEvents(lmdb::txn &txn,
+                        const std::string &room_id,
+                        const std::vector<QString> &event_ids,
+                        const std::string &excluded_user)
+{
+        // Only the newest receipt of every user is stored, so an event was read, if a receipt is
+        // for it or a later event.
+        std::set<std::string> read_by_others;
+        std::string newest;
+        for (const auto &[user_id, receipt] : roomReceipts(txn, room_id)) {
+                if (user_id == excluded_user || !read_by_others.insert(receipt.first).second)
+                        continue;
+
+                newest = std::max(newest, eventOrderKey(txn, room_id, receipt.first));
+        }
+
+        std::vector<QString> read_events;
+        for (const auto &event : event_ids) {
+                const auto id = event.toStdString();
+                if (read_by_others.count(id)) {
+                        read_events.emplace_back(event);
+                        continue;
+                }
+
+                const auto order = newest.empty() ? std::string() : eventOrderKey(txn, room_id, id);
+                if (!order.empty() && order < newest)
+                        read_events.emplace_back(event);
+        }
+
+        return read_events;
+}
+
+void
+Cache::updateReadReceipt(lmdb::txn &txn, const std::string &room_id, const Receipts &receipts)
+{
+        auto user_id = this->localUserId_.toStdString();
+
+        // A large room only keeps the receipts of the members, which were seen in its timeline, so
+        // a busy room doesn't write a receipt for every lurker.
+        const bool large = isLargeRoom(txn, room_id);
+        auto membersdb   = getMembersDb(txn, room_id);
+
+        for (const auto &[event_id, event_receipts] : receipts) {
+                for (const auto &[read_by, timestamp] : event_receipts) {
+                        if (read_by == user_id) {
+                                emit removeNotification(QString::fromStdString(room_id),
+                                                        QString::fromStdString(event_id));
+                        }
+
+                        try {
+                                lmdb::val member;
+                                if (large && read_by != user_id &&
+                                    !lmdb::dbi_get(txn, membersdb, lmdb::val(read_by), member))
+                                        continue;
+
+                                const auto key = receiptKey(room_id, read_by);
+
+                                // Only the newest receipt of every user is kept.
+                                lmdb::val prev_value;
+                                if (lmdb::dbi_get(
+                                      txn, userReceiptsDb_, lmdb::val(key), prev_value) &&
+                                    messageKeyTimestamp(view(prev_value)) > timestamp)
+                                        continue;
+
+                                lmdb::dbi_put(txn,
+                                              userReceiptsDb_,
+                                              lmdb::val(key),
+                                              lmdb::val(messageKey(timestamp, event_id)));
+                        } catch (const lmdb::error &e) {
+                                nhlog::db()->critical("updateReadReceipts: {}", e.what());
+                        }
+                }
+        }
+}
+
+void
+Cache::notifyForReadReceipts(const std::string &room_id)
+{
+        auto txn = beginTxn();
+        notifyForReadReceipts(txn, room_id);
+        txn.commit();
+}
+
+void
+Cache::notifyForReadReceipts(lmdb::txn &txn, const std::string &room_id)
+{
+        auto matches = filterReadEvents(
+          txn, room_id, pendingReceiptsEvents(txn, room_id), utils::localUser().toStdString());
+
+        for (const auto &m : matches)
+                removePendingReceipt(txn, room_id, m.toStdString());
+
+        if (!matches.empty())
+                emit newReadReceipts(QString::fromStdString(room_id), matches);
+}
+
+void
+Cache::calculateRoomReadStatus()
+{
+        const auto joined_rooms = joinedRooms();
+
+        std::map<QString, bool> readStatus;
+        std::map<QString, bool> calculated;
+
+        // Only the rooms, whose status was never stored, need their receipts checked.
+        {
+                auto txn = beginTxn(MDB_RDONLY);
+                for (const auto &room : joined_rooms) {
+                        lmdb::val data;
+                        if (lmdb::dbi_get(txn, readStatusDb_, lmdb::val(room), data)) {
+                                try {
+                                        readStatus.emplace(QString::fromStdString(room),
+                                                           decodeValue(data).get<bool>());
+                                        continue;
+                                } catch (const json::exception &e) {
+                                        nhlog::db()->warn(
+                                          "failed to parse read status of {}: {}", room, e.what());
+                                }
+                        }
+
+                        calculated.emplace(QString::fromStdString(room), false);
+                }
+                txn.commit();
+        }
+
+        for (auto &[room_id, status] : calculated) {
+                status = readStatusFromReceipts(room_id.toStdString());
+                readStatus.emplace(room_id, status);
+        }
+
+        saveReadStatus(calculated);
+
+        emit roomReadStatus(readStatus);
+}
+
+bool
+Cache::calculateRoomReadStatus(const std::string &room_id)
+{
+        const auto status = readStatusFromReceipts(room_id);
+        saveReadStatus({{QString::fromStdString(room_id), status}});
+        return status;
+}
+
+void
+Cache::saveReadStatus(const std::map<QString, bool> &status)
+{
+        if (status.empty())
+                return;
+
+        auto txn = beginTxn();
+        for (const auto &[room_id, unread] : status)
+                lmdb::dbi_put(txn,
+                              readStatusDb_,
+                              lmdb::val(room_id.toStdString()),
+                              lmdb::val(encodeValue(json(unread))));
+        txn.commit();
+}
+
+bool
+Cache::readStatusFromReceipts(const std::string &room_id)
+{
+        auto txn = beginTxn(MDB_RDONLY);
+
+        // Get last event id on the room.
+        const auto last_event_id = getLastEventId(txn, room_id);
+        const auto localUser     = utils::localUser().toStdString();
+
+        lmdb::val receipt;
+        const bool hasReceipt =
+          lmdb::dbi_get(txn, userReceiptsDb_, lmdb::val(receiptKey(room_id, localUser)), receipt);
+        const auto read_event_id =
+          hasReceipt ? messageKeyEventId(view(receipt)) : "";
+
+        txn.commit();
+
+        if (last_event_id.empty())
+                return false;
+
+        // The room is read, if the newest receipt of the local user is for that event.
+        return read_event_id != last_event_id;
+}
+
+void
+Cache::saveJoinedRoom(lmdb::txn &txn,
+                      const std::string &room_id,
+                      const mtx::responses::JoinedRoom &room,
+                      const RoomSummary &summary,
+                      TagChanges &tagChanges,
+                      const nlohmann::json &rawEvents)
+{
+        using namespace mtx::events;
+
+        auto statesdb  = getStatesDb(txn, room_id);
+        auto membersdb = getMembersDb(txn, room_id);
+
+        // A room joined again, before its databases were reclaimed, starts over with the state
+        // of the sync.
+        if (lmdb::dbi_del(txn, removedRoomsDb_, lmdb::val(room_id), nullptr)) {
+                lmdb::dbi_drop(txn, statesdb, false);
+                lmdb::dbi_drop(txn, membersdb, false);
+        }
+
+        bool summaryChanged = saveStateEvents(txn, statesdb, membersdb, room_id, room.state.events);
+        if (saveStateEvents(txn, statesdb, membersdb, room_id, room.timeline.events))
+                summaryChanged = true;
+        if (saveRoomSummary(txn, statesdb, summary))
+                summaryChanged = true;
+
+        saveTimelineMessages(txn, room_id, room.timeline, rawEvents);
+
+        // Process the account_data associated with this room
+        std::optional<std::vector<std::string>> tags;
+        for (const auto &evt : room.account_data.events) {
+                // for now only fetch tag events
+                if (std::holds_alternative<Event<account_data::Tag>>(evt)) {
+                        auto tags_evt = std::get<Event<account_data::Tag>>(evt);
+                        tags.emplace();
+                        for (const auto &tag : tags_evt.content.tags) {
+                                tags->push_back(tag.first);
+                        }
+                }
+        }
+
+        // Most syncs only bring messages, which leave the summary of the room as it is.
+        lmdb::val data;
+        const bool known = lmdb::dbi_get(txn, roomsDb_, lmdb::val(room_id), data);
+        if (!known || summaryChanged || tags) {
+                RoomInfo updatedInfo;
+                if (known) {
+                        try {
+                                updatedInfo = decodeValue(data);
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn("failed to parse room info: room_id ({}), {}",
+                                                  room_id,
+                                                  std::string(data.data(), data.size()));
+                                summaryChanged = true;
+                        }
+                }
+
+                // getRoomName may have to look at the members of the heroes.
+                if (!known || summaryChanged) {
+                        updatedInfo.name  = getRoomName(txn, statesdb, membersdb).toStdString();
+                        updatedInfo.topic = getRoomTopic(txn, statesdb).toStdString();
+                        updatedInfo.avatar_url =
+                          getRoomAvatarUrl(
+                            txn, statesdb, membersdb, QString::fromStdString(room_id))
+                            .toStdString();
+                        updatedInfo.version = getRoomVersion(txn, statesdb).toStdString();
+                }
+
+                if (tags) {
+                        updateTagIndex(txn, room_id, updatedInfo.tags, *tags, tagChanges);
+                        updatedInfo.tags = std::move(*tags);
+                }
+
+                lmdb::dbi_put(
+                  txn, roomsDb_, lmdb::val(room_id), lmdb::val(encodeValue(updatedInfo)));
+        }
+
+        updateReadReceipt(txn, room_id, room.ephemeral.receipts);
+}
+
+void
+Cache::saveState(const mtx::responses::Sync &res,
+                 const std::map<std::string, RoomSummary> &summaries,
+                 const nlohmann::json &raw)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("saveState"));
+
+        // The descriptions of the last messages contain the display names of the senders, which
+        // can't be read during the transaction.
+        for (const auto &[room_id, room] : res.rooms.join)
+                if (!room.timeline.events.empty())
+                        loadMembers(QString::fromStdString(room_id));
+
+        auto txn = beginTxn();
+
+        setNextBatchToken(txn, res.next_batch);
+        savePendingToDevice(txn, res.to_device);
+
+        // Save joined rooms
+        TagChanges tagChanges;
+        for (const auto &[room_id, room] : res.rooms.join)
+                saveJoinedRoom(txn,
+                               room_id,
+                               room,
+                               syncSummary(summaries, room_id),
+                               tagChanges,
+                               rawTimelineEvents(raw, room_id));
+
+        InviteChanges invites;
+        saveInvites(txn, res.rooms.invite, invites);
+        removeInvites(txn, res.rooms.join, invites);
+        removeInvites(txn, res.rooms.leave, invites);
+
+        removeLeftRooms(txn, res.rooms.leave, tagChanges);
+
+        updateDeviceLists(txn, res.device_lists.changed, res.device_lists.left);
+
+        txn.commit();
+
+        {
+                std::lock_guard lock(largeRoomsMutex_);
+                for (const auto &room : res.rooms.join)
+                        largeRooms_.erase(room.first);
+                for (const auto &room : res.rooms.leave)
+                        largeRooms_.erase(room.first);
+        }
+
+        applyInviteChanges(invites);
+        if (!tagChanges.empty())
+                emit tagsChanged(tagChanges);
+        flushMessageIndex();
+        flushDecryptedEvents();
+        deleteRemovedMedia();
+
+        std::vector<std::string> changedRooms;
+        for (const auto &room : res.rooms.join)
+                changedRooms.push_back(room.first);
+        for (const auto &room : invites.saved)
+                changedRooms.push_back(room.first);
+        for (const auto &room : res.rooms.leave)
+                changedRooms.push_back(room.first);
+
+        refreshRoomInfo(changedRooms);
+
+        {
+                const auto start = std::chrono::steady_clock::now();
+
+                // Pending receipts can only be fulfilled in rooms that received new receipts.
+                std::size_t checked = 0;
+                auto receiptsTxn    = beginTxn();
+                for (const auto &room : res.rooms.join) {
+                        if (room.second.ephemeral.receipts.empty())
+                                continue;
+
+                        notifyForReadReceipts(receiptsTxn, room.first);
+                        checked += 1;
+                }
+                receiptsTxn.commit();
+
+                nhlog::db()->debug("checked the pending receipts of {} of {} rooms in {}ms",
+                                   checked,
+                                   res.rooms.join.size(),
+                                   std::chrono::duration_cast<std::chrono::milliseconds>(
+                                     std::chrono::steady_clock::now() - start)
+                                     .count());
+        }
+
+        std::map<QString, bool> readStatus;
+
+        for (const auto &room : res.rooms.join)
+                readStatus.emplace(QString::fromStdString(room.first),
+                                   readStatusFromReceipts(room.first));
+
+        saveReadStatus(readStatus);
+
+        emit roomReadStatus(readStatus);
+}
+
+void
+Cache::saveInitialState(const mtx::responses::Sync &res,
+                        const std::map<std::string, RoomSummary> &summaries,
+                        const nlohmann::json &raw,
+                        const std::function<void(std::size_t, std::size_t)> &progress)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("saveInitialState"));
+
+        // The joined rooms are committed a few at a time, instead of keeping the dirty pages of
+        // the whole account in a single write txn.
+        const auto &rooms = res.rooms.join;
+        std::size_t saved = 0;
+        for (auto chunk = rooms.begin(); chunk != rooms.end();) {
+                auto room         = chunk;
+                std::size_t count = 0;
+
+                try {
+                        // The tags are read from the index, once all rooms are saved.
+                        TagChanges tagChanges;
+
+                        auto txn = beginTxn();
+                        for (; room != rooms.end() && count < INITIAL_SYNC_ROOMS_PER_TXN;
+                             ++room, ++count)
+                                saveJoinedRoom(txn,
+                                               room->first,
+                                               room->second,
+                                               syncSummary(summaries, room->first),
+                                               tagChanges,
+                                               rawTimelineEvents(raw, room->first));
+                        txn.commit();
+                } catch (const lmdb::map_full_error &e) {
+                        // The chunk was aborted, so it is saved again in the larger map.
+                        nhlog::db()->warn("lmdb is full: {}", e.what());
+                        if (!growMapSize())
+                                throw;
+                        continue;
+                }
+
+                chunk = room;
+                saved += count;
+                progress(saved, rooms.size());
+        }
+
+        // The next batch token is saved last, so an interrupted initial sync is started over.
+        auto txn = beginTxn();
+        InviteChanges invites;
+        saveInvites(txn, res.rooms.invite, invites);
+        removeInvites(txn, res.rooms.join, invites);
+        removeInvites(txn, res.rooms.leave, invites);
+        removeLeftRooms(txn, res.rooms.leave);
+        updateDeviceLists(txn, res.device_lists.changed, res.device_lists.left);
+        setNextBatchToken(txn, res.next_batch);
+        savePendingToDevice(txn, res.to_device);
+        txn.commit();
+
+        {
+                std::lock_guard lock(largeRoomsMutex_);
+                largeRooms_.clear();
+        }
+
+        applyInviteChanges(invites);
+        flushMessageIndex();
+        flushDecryptedEvents();
+        deleteRemovedMedia();
+
+        std::vector<std::string> changedRooms;
+        for (const auto &room : res.rooms.join)
+                changedRooms.push_back(room.first);
+        for (const auto &room : invites.saved)
+                changedRooms.push_back(room.first);
+
+        refreshRoomInfo(changedRooms);
+}
+
+void
+Cache::saveInvites(lmdb::txn &txn,
+                   const std::map<std::string, mtx::responses::InvitedRoom> &rooms,
+                   InviteChanges &changes)
+{
+        for (const auto &room : rooms) {
+                const auto digest = inviteDigest(room.second);
+                {
+                        std::unique_lock<std::mutex> lock(invitesMutex_);
+                        auto known = invites_.find(room.first);
+                        if (known != invites_.end() && known->second == digest)
+                                continue;
+                }
+                changes.saved.emplace(room.first, digest);
+
+                auto statesdb  = getInviteStatesDb(txn, room.first);
+                auto membersdb = getInviteMembersDb(txn, room.first);
+
+                saveInvite(txn, statesdb, membersdb, room.second);
+
+                RoomInfo updatedInfo;
+                updatedInfo.name  = getInviteRoomName(txn, statesdb, membersdb).toStdString();
+                updatedInfo.topic = getInviteRoomTopic(txn, statesdb).toStdString();
+                updatedInfo.avatar_url =
+                  getInviteRoomAvatarUrl(txn, statesdb, membersdb).toStdString();
+                updatedInfo.is_invite = true;
+
+                lmdb::dbi_put(
+                  txn, invitesDb_, lmdb::val(room.first), lmdb::val(encodeValue(updatedInfo)));
+        }
+}
+
+void
+Cache::applyInviteChanges(const InviteChanges &changes)
+{
+        std::vector<QString> removed;
+        {
+                std::unique_lock<std::mutex> lock(invitesMutex_);
+                for (const auto &[room_id, digest] : changes.saved)
+                        invites_[room_id] = digest;
+                for (const auto &room_id : changes.removed) {
+                        if (invites_.erase(room_id))
+                                removed.push_back(QString::fromStdString(room_id));
+                }
+        }
+
+        if (!removed.empty())
+                emit invitesRemoved(removed);
+}
+
+void
+Cache::saveInvite(lmdb::txn &txn,
+                  lmdb::dbi &statesdb,
+                  lmdb::dbi &membersdb,
+                  const mtx::responses::InvitedRoom &room)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        for (const auto &e : room.invite_state) {
+                if (auto msg = std::get_if<StrippedEvent<Member>>(&e)) {
+                        auto display_name = msg->content.display_name.empty()
+                                              ? msg->state_key
+                                              : msg->content.display_name;
+
+                        MemberInfo tmp{display_name, msg->content.avatar_url};
+
+                        lmdb::dbi_put(
+                          txn, membersdb, lmdb::val(msg->state_key), lmdb::val(encodeValue(tmp)));
+                } else {
+                        std::visit(
+                          [&txn, &statesdb](auto msg) {
+                                  bool res = lmdb::dbi_put(txn,
+                                                           statesdb,
+                                                           lmdb::val(to_string(msg.type)),
+                                                           lmdb::val(json(msg).dump()));
+
+                                  if (!res)
+                                          nhlog::db()->warn("couldn't save data: {}",
+                                                            json(msg).dump());
+                          },
+                          e);
+                }
+        }
+}
+
+std::vector<std::string>
+Cache::roomsWithStateUpdates(const mtx::responses::Sync &res)
+{
+        std::vector<std::string> rooms;
+        for (const auto &room : res.rooms.join) {
+                bool hasUpdates = false;
+                for (const auto &s : room.second.state.events) {
+                        if (containsStateUpdates(s)) {
+                                hasUpdates = true;
+                                break;
+                        }
+                }
+
+                for (const auto &s : room.second.timeline.events) {
+                        if (containsStateUpdates(s)) {
+                                hasUpdates = true;
+                                break;
+                        }
+                }
+
+                if (hasUpdates)
+                        rooms.emplace_back(room.first);
+        }
+
+        for (const auto &room : res.rooms.invite) {
+                for (const auto &s : room.second.invite_state) {
+                        if (containsStateUpdates(s)) {
+                                rooms.emplace_back(room.first);
+                                break;
+                        }
+                }
+        }
+
+        return rooms;
+}
+
+std::vector<std::string>
+Cache::roomsNamedByMembers(const std::vector<std::string> &rooms)
+{
+        auto txn = beginTxn(MDB_RDONLY);
+
+        std::vector<std::string> named;
+        for (const auto &room_id : rooms) {
+                try {
+                        lmdb::val data;
+                        if (!lmdb::dbi_get(txn, roomsDb_, lmdb::val(room_id), data))
+                                continue;
+
+                        auto statesdb = getStatesDb(txn, room_id);
+                        if (getRoomSummary(txn, statesdb).heroes)
+                                continue;
+
+                        if (lmdb::dbi_get(txn,
+                                          statesdb,
+                                          lmdb::val(to_string(mtx::events::EventType::RoomName)),
+                                          data)) {
+                                const mtx::events::StateEvent<mtx::events::state::Name> name =
+                                  decodeValue(data);
+                                if (!name.content.name.empty())
+                                        continue;
+                        }
+
+                        if (lmdb::dbi_get(
+                              txn,
+                              statesdb,
+                              lmdb::val(to_string(mtx::events::EventType::RoomCanonicalAlias)),
+                              data)) {
+                                const mtx::events::StateEvent<mtx::events::state::CanonicalAlias>
+                                  alias = decodeValue(data);
+                                if (!alias.content.alias.empty())
+                                        continue;
+                        }
+
+                        named.push_back(room_id);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse the name of {}: {}", room_id, e.what());
+                } catch (const lmdb::error &e) {
+                        nhlog::db()->warn("failed to read the name of {}: {}", room_id, e.what());
+                }
+        }
+
+        return named;
+}
+
+void
+Cache::updateTagIndex(lmdb::txn &txn,
+                      const std::string &room_id,
+                      const std::vector<std::string> &before,
+                      const std::vector<std::string> &after,
+                      TagChanges &changes)
+{
+        for (const auto &tag : before) {
+                if (std::find(after.begin(), after.end(), tag) != after.end())
+                        continue;
+
+                lmdb::dbi_del(txn, tagsDb_, lmdb::val(tagKey(tag, room_id)), nullptr);
+                changes.untag(tag, room_id);
+        }
+
+        for (const auto &tag : after) {
+                if (std::find(before.begin(), before.end(), tag) != before.end())
+                        continue;
+
+                lmdb::dbi_put(txn, tagsDb_, lmdb::val(tagKey(tag, room_id)), lmdb::val(""));
+                changes.tag(tag, room_id);
+        }
+}
+
+std::map<std::string, std::set<std::string>>
+Cache::roomsByTag()
+{
+        std::map<std::string, std::set<std::string>> rooms;
+
+        try {
+                auto txn    = beginTxn(MDB_RDONLY);
+                auto cursor = lmdb::cursor::open(txn, tagsDb_);
+
+                lmdb::val key, unused;
+                while (cursor.get(key, unused, MDB_NEXT)) {
+                        const auto separator = view(key).find('\0');
+                        if (separator == std::string_view::npos)
+                                continue;
+
+                        rooms[std::string(view(key).substr(0, separator))].emplace(
+                          view(key).substr(separator + 1));
+                }
+
+                cursor.close();
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the tagged rooms: {}", e.what());
+        }
+
+        return rooms;
+}
+
+RoomInfo
+Cache::singleRoomInfo(const std::string &room_id)
+{
+        loadRoomInfoTable();
+
+        std::shared_lock lock(roomInfoMutex_);
+
+        auto it = roomInfoTable_.find(room_id);
+        if (it == roomInfoTable_.end() || it->second.is_invite)
+                return RoomInfo();
+
+        return it->second;
+}
+
+std::map<QString, RoomInfo>
+Cache::getRoomInfo(const std::vector<std::string> &rooms)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("getRoomInfo"));
+
+        loadRoomInfoTable();
+
+        std::shared_lock lock(roomInfoMutex_);
+
+        std::map<QString, RoomInfo> room_info;
+
+        for (const auto &room : rooms) {
+                auto it = roomInfoTable_.find(room);
+                if (it != roomInfoTable_.end())
+                        room_info.emplace(QString::fromStdString(room), it->second);
+        }
+
+        return room_info;
+}
+
+int
+Cache::memberCount(lmdb::txn &txn, const std::string &room_id)
+{
+        // Lazy loading only stores some of the members, the summary counts all.
+        auto statesdb      = getStatesDb(txn, room_id);
+        const auto summary = getRoomSummary(txn, statesdb);
+        if (summary.joined_member_count || summary.invited_member_count)
+                return summary.joined_member_count.value_or(0) +
+                       summary.invited_member_count.value_or(0);
+
+        return static_cast<int>(getMembersDb(txn, room_id).size(txn));
+}
+
+bool
+Cache::isLargeRoom(lmdb::txn &txn, const std::string &room_id)
+{
+        return largeRoomMembers_ > 0 && memberCount(txn, room_id) >= largeRoomMembers_;
+}
+
+bool
+Cache::isLargeRoom(const std::string &room_id)
+{
+        // The lock is held while counting, so a sync can't drop the room in between and leave
+        // an outdated count behind.
+        std::lock_guard lock(largeRoomsMutex_);
+        if (auto it = largeRooms_.find(room_id); it != largeRooms_.end())
+                return it->second;
+
+        try {
+                auto txn         = beginTxn(MDB_RDONLY);
+                const bool large = isLargeRoom(txn, room_id);
+                txn.commit();
+
+                largeRooms_[room_id] = large;
+                return large;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to count the members of {}: {}", room_id, e.what());
+                return false;
+        }
+}
+
+std::optional<RoomInfo>
+Cache::readRoomInfo(lmdb::txn &txn, const std::string &room_id)
+{
+        lmdb::val data;
+
+        try {
+                // Check if the room is joined.
+                if (lmdb::dbi_get(txn, roomsDb_, lmdb::val(room_id), data)) {
+                        auto statesdb = getStatesDb(txn, room_id);
+
+                        RoomInfo tmp     = decodeValue(data);
+                        tmp.member_count = memberCount(txn, room_id);
+                        tmp.join_rule    = getRoomJoinRule(txn, statesdb);
+                        tmp.guest_access = getRoomGuestAccess(txn, statesdb);
+                        tmp.msgInfo      = getLastMessageInfo(txn, room_id);
+
+                        return tmp;
+                }
+
+                // Check if the room is an invite.
+                if (lmdb::dbi_get(txn, invitesDb_, lmdb::val(room_id), data)) {
+                        RoomInfo tmp     = decodeValue(data);
+                        tmp.member_count = getInviteMembersDb(txn, room_id).size(txn);
+
+                        return tmp;
+                }
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse room info: room_id ({}), {}", room_id, e.what());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read room info: room_id ({}), {}", room_id, e.what());
+        }
+
+        return std::nullopt;
+}
+
+void
+Cache::loadRoomInfoTable()
+{
+        {
+                std::shared_lock lock(roomInfoMutex_);
+                if (roomInfoTableLoaded_)
+                        return;
+        }
+
+        std::unique_lock lock(roomInfoMutex_);
+        if (roomInfoTableLoaded_)
+                return;
+
+        auto txn = beginTxn(MDB_RDONLY);
+
+        std::vector<std::string> room_ids;
+        lmdb::val room_id, unused;
+
+        auto roomsCursor = lmdb::cursor::open(txn, roomsDb_);
+        while (roomsCursor.get(room_id, unused, MDB_NEXT))
+                room_ids.emplace_back(view(room_id));
+        roomsCursor.close();
+
+        auto invitesCursor = lmdb::cursor::open(txn, invitesDb_);
+        while (invitesCursor.get(room_id, unused, MDB_NEXT))
+                room_ids.emplace_back(view(room_id));
+        invitesCursor.close();
+
+        for (const auto &id : room_ids) {
+                if (auto info = readRoomInfo(txn, id))
+                        roomInfoTable_.emplace(id, std::move(*info));
+        }
+
+        txn.commit();
+
+        roomInfoTableLoaded_ = true;
+
+        nhlog::db()->info("loaded the info of {} rooms", roomInfoTable_.size());
+}
+
+void
+Cache::refreshRoomInfo(const std::vector<std::string> &rooms)
+{
+        {
+                std::shared_lock lock(roomInfoMutex_);
+
+                // The rooms will be read, once the table is needed.
+                if (!roomInfoTableLoaded_)
+                        return;
+        }
+
+        std::map<std::string, std::optional<RoomInfo>> updates;
+        {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                for (const auto &room : rooms)
+                        updates[room] = readRoomInfo(txn, room);
+
+                txn.commit();
+        }
+
+        std::unique_lock lock(roomInfoMutex_);
+
+        for (auto &[room_id, info] : updates) {
+                if (info)
+                        roomInfoTable_[room_id] = std::move(*info);
+                else
+                        roomInfoTable_.erase(room_id);
+        }
+}
+
+void
+Cache::saveRoomListSnapshot() noexcept
+{
+        try {
+                loadRoomInfoTable();
+
+                json rooms = json::object();
+                {
+                        std::shared_lock lock(roomInfoMutex_);
+
+                        for (const auto &[room_id, info] : roomInfoTable_) {
+                                json room      = info;
+                                room["last"]   = lastMessageToJson(info.msgInfo);
+                                rooms[room_id] = std::move(room);
+                        }
+                }
+
+                auto txn = beginTxn();
+                lmdb::dbi_put(
+                  txn, syncStateDb_, ROOM_LIST_SNAPSHOT_KEY, lmdb::val(encodeValue(rooms)));
+                txn.commit();
+
+                nhlog::db()->debug("saved the room list snapshot of {} rooms", rooms.size());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save the room list snapshot: {}", e.what());
+        }
+}
+
+std::optional<QMap<QString, RoomInfo>>
+Cache::roomListSnapshot()
+{
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                lmdb::val data;
+                const bool found =
+                  lmdb::dbi_get(txn, syncStateDb_, ROOM_LIST_SNAPSHOT_KEY, data);
+
+                QMap<QString, RoomInfo> rooms;
+                if (found) {
+                        for (const auto &[room_id, room] : decodeValue(data).items()) {
+                                RoomInfo info = room;
+                                info.msgInfo  = lastMessageFromJson(room.at("last"));
+                                rooms.insert(QString::fromStdString(room_id), std::move(info));
+                        }
+                }
+
+                txn.commit();
+
+                if (found)
+                        return rooms;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the room list snapshot: {}", e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the room list snapshot: {}", e.what());
+        }
+
+        return std::nullopt;
+}
+
+std::optional<CommunityInfo>
+Cache::community(const std::string &group_id)
+{
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                lmdb::val data;
+                const bool found = lmdb::dbi_get(txn, communitiesDb_, lmdb::val(group_id), data);
+
+                std::optional<CommunityInfo> info;
+                if (found)
+                        info = decodeValue(data).get<CommunityInfo>();
+
+                txn.commit();
+
+                return info;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the community {}: {}", group_id, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the community {}: {}", group_id, e.what());
+        }
+
+        return std::nullopt;
+}
+
+void
+Cache::saveCommunity(const std::string &group_id, const CommunityInfo &info)
+{
+        try {
+                auto txn = beginTxn();
+                lmdb::dbi_put(txn,
+                              communitiesDb_,
+                              lmdb::val(group_id),
+                              lmdb::val(encodeValue(json(info))));
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save the community {}: {}", group_id, e.what());
+        }
+}
+
+void
+Cache::removeCommunity(const std::string &group_id)
+{
+        try {
+                auto txn = beginTxn();
+                lmdb::dbi_del(txn, communitiesDb_, lmdb::val(group_id), nullptr);
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to remove the community {}: {}", group_id, e.what());
+        }
+}
+
+MentionsPage
+Cache::getMentions(const std::string &room_id, const std::string &next_token, std::size_t limit)
+{
+        MentionsPage page;
+
+        // The keys of the room index are the ones of the mentions after the prefix of the room.
+        const auto prefix = room_id.empty() ? std::string() : room_id + '\0';
+        // The walk goes backwards from the newest mention before start.
+        const auto start = next_token.empty() ? (room_id.empty() ? "" : room_id + '\1')
+                                              : prefix + next_token;
+
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+                auto cursor =
+                  lmdb::cursor::open(txn, room_id.empty() ? mentionsDb_ : roomMentionsDb_);
+
+                lmdb::val key(start.data(), start.size()), value;
+
+                bool found = false;
+                if (start.empty())
+                        found = cursor.get(key, value, MDB_LAST);
+                else if (cursor.get(key, value, MDB_SET_RANGE))
+                        found = cursor.get(key, value, MDB_PREV);
+                else
+                        found = cursor.get(key, value, MDB_LAST);
+
+                auto inRoom = [&prefix, &key]() {
+                        return std::string_view(key.data(), key.size()).substr(0, prefix.size()) ==
+                               prefix;
+                };
+
+                std::string last_key;
+                while (found && inRoom() && page.mentions.size() < limit) {
+                        last_key.assign(key.data() + prefix.size(), key.size() - prefix.size());
+
+                        lmdb::val mention = value;
+                        if (room_id.empty() ||
+                            lmdb::dbi_get(txn, mentionsDb_, lmdb::val(last_key), mention)) {
+                                try {
+                                        page.mentions.push_back(
+                                          decodeValue(mention)
+                                            .get<mtx::responses::Notification>());
+                                } catch (const json::exception &e) {
+                                        nhlog::db()->warn("failed to parse a mention: {}",
+                                                          e.what());
+                                }
+                        }
+
+                        found = cursor.get(key, value, MDB_PREV);
+                }
+
+                // The walk stopped at the limit and there are older mentions.
+                if (found && inRoom())
+                        page.next_token = last_key;
+
+                cursor.close();
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->error("failed to read the mentions: {}", e.what());
+        }
+
+        return page;
+}
+
+TimelineWindow
+Cache::getTimelineMessages(lmdb::txn &txn,
+                           const std::string &room_id,
+                           const std::string &before_event_id,
+                           std::size_t limit)
+{
+        TimelineWindow window;
+
+        auto db     = getMessagesDb(txn, room_id);
+        auto cursor = lmdb::cursor::open(txn, db);
+
+        lmdb::val key, value;
+
+        if (!before_event_id.empty()) {
+                auto eventsDb = getEventIndexDb(txn, room_id);
+
+                // Position the cursor on the event we page from.
+                if (!lmdb::dbi_get(txn, eventsDb, lmdb::val(before_event_id), key) ||
+                    !cursor.get(key, value, MDB_SET)) {
+                        cursor.close();
+                        window.reached_end = true;
+                        return window;
+                }
+
+                auto obj          = decodeValue(value);
+                window.prev_batch = obj.value("token", "");
+
+                if (obj.value("gap", false)) {
+                        cursor.close();
+                        window.reached_end = true;
+                        return window;
+                }
+        }
+
+        // Keys are sorted by timestamp, so walk backwards. An unpositioned cursor starts at the
+        // newest event.
+        while (window.events.size() < limit) {
+                if (!cursor.get(key, value, MDB_PREV)) {
+                        window.reached_end = true;
+                        break;
+                }
+
+                auto obj = decodeMessage(value);
+
+                if (obj.count("event") == 0)
+                        continue;
+
+                mtx::events::collections::TimelineEvent event;
+                mtx::events::collections::from_json(obj.at("event"), event);
+
+                window.events.push_back(std::move(event.data));
+                window.prev_batch = obj.value("token", "");
+
+                // The older events in the db don't connect to this one.
+                if (obj.value("gap", false)) {
+                        window.reached_end = true;
+                        break;
+                }
+        }
+        cursor.close();
+
+        return window;
+}
+
+NewerTimelineWindow
+Cache::getTimelineMessagesAfter(lmdb::txn &txn,
+                                const std::string &room_id,
+                                const std::string &after_event_id,
+                                std::size_t limit)
+{
+        NewerTimelineWindow window;
+
+        auto db       = getMessagesDb(txn, room_id);
+        auto eventsDb = getEventIndexDb(txn, room_id);
+        auto cursor   = lmdb::cursor::open(txn, db);
+
+        // Position the cursor on the event we page from. Nothing is known to follow an event,
+        // which isn't stored.
+        lmdb::val key, value;
+        if (!lmdb::dbi_get(txn, eventsDb, lmdb::val(after_event_id), key) ||
+            !cursor.get(key, value, MDB_SET)) {
+                cursor.close();
+                return window;
+        }
+
+        // Keys are sorted by timestamp, so walk forwards.
+        while (window.events.size() < limit) {
+                if (!cursor.get(key, value, MDB_NEXT)) {
+                        window.reached_newest = true;
+                        break;
+                }
+
+                auto obj = decodeMessage(value);
+
+                if (obj.count("event") == 0)
+                        continue;
+
+                mtx::events::collections::TimelineEvent event;
+                mtx::events::collections::from_json(obj.at("event"), event);
+
+                // The events before this one don't connect to it, so the page ends before it.
+                if (obj.value("gap", false)) {
+                        window.gap_event_id = utils::event_id(event.data);
+                        window.gap_token    = obj.value("token", "");
+                        break;
+                }
+
+                window.events.push_back(std::move(event.data));
+        }
+        cursor.close();
+
+        return window;
+}
+
+TimelineWindow
+Cache::getTimelineMessages(const std::string &room_id,
+                           const std::string &before_event_id,
+                           std::size_t limit)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("getTimelineMessages"));
+
+        try {
+                auto txn    = beginTxn(MDB_RDONLY);
+                auto window = getTimelineMessages(txn, room_id, before_event_id, limit);
+                txn.commit();
+
+                return window;
+        } catch (const lmdb::error &e) {
+                // The databases of a room only exist after its first timeline was saved.
+                nhlog::db()->debug("getTimelineMessages({}): {}", room_id, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to restore timeline of {}: {}", room_id, e.what());
+        }
+
+        TimelineWindow window;
+        window.reached_end = true;
+
+        return window;
+}
+
+NewerTimelineWindow
+Cache::getTimelineMessagesAfter(const std::string &room_id,
+                                const std::string &after_event_id,
+                                std::size_t limit)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("getTimelineMessagesAfter"));
+
+        try {
+                auto txn    = beginTxn(MDB_RDONLY);
+                auto window = getTimelineMessagesAfter(txn, room_id, after_event_id, limit);
+                txn.commit();
+
+                return window;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->debug("getTimelineMessagesAfter({}): {}", room_id, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to restore timeline of {}: {}", room_id, e.what());
+        }
+
+        return {};
+}
+
+std::optional<TimelineContext>
+Cache::getTimelineContext(const std::string &room_id,
+                          const std::string &event_id,
+                          std::size_t limit)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("getTimelineContext"));
+
+        try {
+                auto txn      = beginTxn(MDB_RDONLY);
+                auto db       = getMessagesDb(txn, room_id);
+                auto eventsDb = getEventIndexDb(txn, room_id);
+
+                lmdb::val key, value;
+                if (!lmdb::dbi_get(txn, eventsDb, lmdb::val(event_id), key) ||
+                    !lmdb::dbi_get(txn, db, key, value)) {
+                        txn.commit();
+                        return std::nullopt;
+                }
+
+                auto obj = decodeValue(value);
+                if (obj.count("event") == 0) {
+                        txn.commit();
+                        return std::nullopt;
+                }
+
+                mtx::events::collections::TimelineEvent event;
+                mtx::events::collections::from_json(obj.at("event"), event);
+
+                TimelineContext context;
+                context.event = std::move(event.data);
+                context.older = getTimelineMessages(txn, room_id, event_id, limit);
+                context.newer = getTimelineMessagesAfter(txn, room_id, event_id, limit);
+                txn.commit();
+
+                // The event is the oldest stored one.
+                if (context.older.prev_batch.empty())
+                        context.older.prev_batch = obj.value("token", "");
+
+                return context;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->debug("getTimelineContext({}): {}", room_id, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to restore the context of {}: {}", event_id, e.what());
+        }
+
+        return std::nullopt;
+}
+
+QMap<QString, RoomInfo>
+Cache::roomInfo(bool withInvites)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("roomInfo"));
+
+        loadRoomInfoTable();
+
+        std::shared_lock lock(roomInfoMutex_);
+
+        QMap<QString, RoomInfo> result;
+
+        for (const auto &[room_id, info] : roomInfoTable_) {
+                if (withInvites || !info.is_invite)
+                        result.insert(QString::fromStdString(room_id), info);
+        }
+
+        return result;
+}
+
+std::string
+Cache::getLastEventId(lmdb::txn &txn, const std::string &room_id)
+{
+        auto db = getMessagesDb(txn, room_id);
+
+        if (db.size(txn) == 0)
+                return {};
+
+        lmdb::val timestamp, msg;
+
+        // An unpositioned cursor starts at the last (newest) entry with MDB_PREV.
+        auto cursor = lmdb::cursor::open(txn, db);
+        while (cursor.get(timestamp, msg, MDB_PREV)) {
+                auto obj = decodeMessage(msg);
+
+                if (obj.count("event") == 0)
+                        continue;
+
+                cursor.close();
+                return obj["event"]["event_id"];
+        }
+        cursor.close();
+
+        return {};
+}
+
+DescInfo
+Cache::getLastMessageInfo(lmdb::txn &txn, const std::string &room_id)
+{
+        lmdb::val data;
+
+        if (!lmdb::dbi_get(txn, lastMessagesDb_, lmdb::val(room_id), data))
+                return DescInfo{};
+
+        try {
+                return lastMessageFromJson(decodeValue(data));
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse last message of {}: {}", room_id, e.what());
+        }
+
+        return DescInfo{};
+}
+
+void
+Cache::saveLastMessageInfo(lmdb::txn &txn, const std::string &room_id, const DescInfo &info)
+{
+        lmdb::dbi_put(txn,
+                      lastMessagesDb_,
+                      lmdb::val(room_id),
+                      lmdb::val(encodeValue(lastMessageToJson(info))));
+}
+
+void
+Cache::updateLastMessageInfo(lmdb::txn &txn, const std::string &room_id)
+{
+        const auto local_user = utils::localUser();
+
+        std::string key, msg;
+
+        auto cursor = lmdb::cursor::open(txn, getMessagesDb(txn, room_id));
+        while (cursor.get(key, msg, MDB_PREV)) {
+                try {
+                        auto obj = decodeValue(msg);
+
+                        if (obj.count("event") == 0)
+                                continue;
+
+                        mtx::events::collections::TimelineEvent event;
+                        mtx::events::collections::from_json(obj.at("event"), event);
+
+                        auto info = utils::getMessageDescription(
+                          event.data, local_user, QString::fromStdString(room_id));
+
+                        if (info.event_id.isEmpty())
+                                continue;
+
+                        cursor.close();
+                        saveLastMessageInfo(txn, room_id, info);
+                        return;
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse message in {}: {}", room_id, e.what());
+                }
+        }
+        cursor.close();
+
+        lmdb::dbi_del(txn, lastMessagesDb_, lmdb::val(room_id), nullptr);
+}
+
+std::vector<uint32_t>
+Cache::userColors(const QString &background)
+{
+        const auto key = background.toStdString();
+
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                lmdb::val data;
+                std::vector<uint32_t> colors;
+                if (lmdb::dbi_get(txn, userColorsDb_, lmdb::val(key), data))
+                        colors = decodeValue(data).get<std::vector<uint32_t>>();
+
+                txn.commit();
+                return colors;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the user colors of {}: {}", key, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the user colors of {}: {}", key, e.what());
+        }
+
+        return {};
+}
+
+void
+Cache::saveUserColors(const QString &background, const std::vector<uint32_t> &colors)
+{
+        const auto key = background.toStdString();
+
+        try {
+                auto txn = beginTxn();
+                lmdb::dbi_put(txn, userColorsDb_, lmdb::val(key), lmdb::val(encodeValue(colors)));
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save the user colors of {}: {}", key, e.what());
+        }
+}
+
+QSize
+Cache::imageDimensions(const QString &mxcUrl)
+{
+        const auto key = mxcUrl.toStdString();
+
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                lmdb::val data;
+                QSize size;
+                if (lmdb::dbi_get(txn, imageDimensionsDb_, lmdb::val(key), data)) {
+                        const auto dimensions = decodeValue(data).get<std::array<int, 2>>();
+                        size                  = QSize(dimensions[0], dimensions[1]);
+                }
+
+                txn.commit();
+                return size;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the dimensions of {}: {}", key, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the dimensions of {}: {}", key, e.what());
+        }
+
+        return {};
+}
+
+void
+Cache::saveImageDimensions(const QString &mxcUrl, const QSize &size)
+{
+        const auto key = mxcUrl.toStdString();
+
+        try {
+                auto txn = beginTxn();
+                const std::array<int, 2> dimensions{size.width(), size.height()};
+                lmdb::dbi_put(
+                  txn, imageDimensionsDb_, lmdb::val(key), lmdb::val(encodeValue(dimensions)));
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save the dimensions of {}: {}", key, e.what());
+        }
+}
+
+void
+Cache::saveOutboxMessage(const std::string &room_id,
+                         const mtx::events::collections::TimelineEvents &event)
+{
+        try {
+                auto txn = beginTxn();
+                lmdb::dbi_put(txn,
+                              outboxDb_,
+                              lmdb::val(outboxKey(room_id, utils::event_id(event))),
+                              lmdb::val(encodeValue(utils::serialize_event(event))));
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save unsent message {} of {}: {}",
+                                  utils::event_id(event),
+                                  room_id,
+                                  e.what());
+        }
+}
+
+void
+Cache::removeOutboxMessage(const std::string &room_id, const std::string &txn_id)
+{
+        try {
+                auto txn = beginTxn();
+                lmdb::dbi_del(txn, outboxDb_, lmdb::val(outboxKey(room_id, txn_id)), nullptr);
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn(
+                  "failed to remove sent message {} of {}: {}", txn_id, room_id, e.what());
+        }
+}
+
+std::vector<mtx::events::collections::TimelineEvents>
+Cache::outboxMessages(const std::string &room_id)
+{
+        std::vector<mtx::events::collections::TimelineEvents> messages;
+
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                const auto prefix = outboxKey(room_id, "");
+                lmdb::val key(prefix.data(), prefix.size()), value;
+
+                auto cursor = lmdb::cursor::open(txn, outboxDb_);
+                bool found  = cursor.get(key, value, MDB_SET_RANGE);
+                while (found) {
+                        std::string_view k(key.data(), key.size());
+                        if (k.substr(0, prefix.size()) != prefix)
+                                break;
+
+                        try {
+                                mtx::events::collections::TimelineEvent event;
+                                mtx::events::collections::from_json(decodeValue(value), event);
+                                messages.push_back(std::move(event.data));
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn("failed to parse unsent message of {}: {}",
+                                                  room_id,
+                                                  e.what());
+                        }
+
+                        found = cursor.get(key, value, MDB_NEXT);
+                }
+
+                cursor.close();
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read unsent messages of {}: {}", room_id, e.what());
+        }
+
+        // The keys are ordered by transaction id, the messages by the time they were queued.
+        std::stable_sort(messages.begin(), messages.end(), [](const auto &a, const auto &b) {
+                return utils::event_timestamp(a) < utils::event_timestamp(b);
+        });
+
+        return messages;
+}
+
+std::vector<std::string>
+Cache::outboxRooms()
+{
+        std::vector<std::string> rooms;
+
+        try {
+                auto txn    = beginTxn(MDB_RDONLY);
+                auto cursor = lmdb::cursor::open(txn, outboxDb_);
+
+                lmdb::val key, unused;
+                while (cursor.get(key, unused, MDB_NEXT)) {
+                        const auto room_id = view(key).substr(0, view(key).find('\0'));
+                        if (rooms.empty() || rooms.back() != room_id)
+                                rooms.emplace_back(room_id);
+                }
+
+                cursor.close();
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the rooms with unsent messages: {}", e.what());
+        }
+
+        return rooms;
+}
+
+std::map<QString, bool>
+Cache::invites()
+{
+        std::map<QString, bool> result;
+
+        auto txn    = beginTxn(MDB_RDONLY);
+        auto cursor = lmdb::cursor::open(txn, invitesDb_);
+
+        lmdb::val room_id, unused;
+
+        while (cursor.get(room_id, unused, MDB_NEXT))
+                result.emplace(QString::fromUtf8(room_id.data(), (int)room_id.size()), true);
+
+        cursor.close();
+        txn.commit();
+
+        return result;
+}
+
+QString
+Cache::getRoomAvatarUrl(lmdb::txn &txn,
+                        lmdb::dbi &statesdb,
+                        lmdb::dbi &membersdb,
+                        const QString &room_id)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomAvatar)), event);
+
+        if (res) {
+                try {
+                        StateEvent<Avatar> msg = decodeValue(event);
+
+                        if (!msg.content.url.empty())
+                                return QString::fromStdString(msg.content.url);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.avatar event: {}", e.what());
+                }
+        }
+
+        // The summary names the other member of a 1-1 chat, without looking through the members.
+        if (const auto summary = getRoomSummary(txn, statesdb); summary.heroes) {
+                const int total = summary.joined_member_count.value_or(0) +
+                                  summary.invited_member_count.value_or(0);
+
+                // We don't use an avatar for group chats.
+                if (summary.heroes->size() > 1 || total > 2)
+                        return QString();
+
+                const auto member = getMemberInfo(txn,
+                                                  membersdb,
+                                                  summary.heroes->empty()
+                                                    ? localUserId_.toStdString()
+                                                    : summary.heroes->front());
+                return member ? QString::fromStdString(member->avatar_url) : QString();
+        }
+
+        // We don't use an avatar for group chats.
+        if (membersdb.size(txn) > 2)
+                return QString();
+
+        auto cursor           = lmdb::cursor::open(txn, membersdb);
+        const auto local_user = localUserId_.toStdString();
+        lmdb::val user_id, member_data;
+
+        // Resolve avatar for 1-1 chats.
+        while (cursor.get(user_id, member_data, MDB_NEXT)) {
+                if (view(user_id) == local_user)
+                        continue;
+
+                try {
+                        MemberInfo m = decodeValue(member_data);
+
+                        cursor.close();
+                        return QString::fromStdString(m.avatar_url);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse member info: {}", e.what());
+                }
+        }
+
+        cursor.close();
+
+        // Default case when there is only one member.
+        lmdb::val local_member;
+        if (lmdb::dbi_get(txn, membersdb, lmdb::val(localUserId_.toStdString()), local_member)) {
+                try {
+                        MemberInfo m = decodeValue(local_member);
+                        return QString::fromStdString(m.avatar_url);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse member info: {}", e.what());
+                }
+        }
+
+        return QString();
+}
+
+QString
+Cache::getRoomName(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomName)), event);
+
+        if (res) {
+                try {
+                        StateEvent<Name> msg = decodeValue(event);
+
+                        if (!msg.content.name.empty())
+                                return QString::fromStdString(msg.content.name);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.name event: {}", e.what());
+                }
+        }
+
+        res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomCanonicalAlias)), event);
+
+        if (res) {
+                try {
+                        StateEvent<CanonicalAlias> msg = decodeValue(event);
+
+                        if (!msg.content.alias.empty())
+                                return QString::fromStdString(msg.content.alias);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.canonical_alias event: {}",
+                                          e.what());
+                }
+        }
+
+        // The heroes of the summary are enough, even if the members are lazy loaded.
+        if (const auto summary = getRoomSummary(txn, statesdb); summary.heroes) {
+                const auto &heroes = *summary.heroes;
+                const int total    = std::max<int>(summary.joined_member_count.value_or(0) +
+                                                  summary.invited_member_count.value_or(0),
+                                                heroes.size() + 1);
+
+                const auto name = [this, &txn, &membersdb](const std::string &user_id) {
+                        const auto member = getMemberInfo(txn, membersdb, user_id);
+                        return member && !member->name.empty()
+                                 ? QString::fromStdString(member->name)
+                                 : QString::fromStdString(user_id);
+                };
+
+                if (heroes.empty())
+                        return total == 1 ? name(localUserId_.toStdString()) : "Empty Room";
+                else if (total == 2)
+                        return name(heroes.front());
+                else
+                        return QString("%1 and %2 others").arg(name(heroes.front())).arg(total - 1);
+        }
+
+        auto cursor     = lmdb::cursor::open(txn, membersdb);
+        const int total = membersdb.size(txn);
+
+        std::size_t ii = 0;
+        lmdb::val user_id, member_data;
+        std::map<std::string, MemberInfo> members;
+
+        while (cursor.get(user_id, member_data, MDB_NEXT) && ii < 3) {
+                try {
+                        members.emplace(std::string(view(user_id)), decodeValue(member_data));
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse member info: {}", e.what());
+                }
+
+                ii++;
+        }
+
+        cursor.close();
+
+        if (total == 1 && !members.empty())
+                return QString::fromStdString(members.begin()->second.name);
+
+        auto first_member = [&members, this]() {
+                for (const auto &m : members) {
+                        if (m.first != localUserId_.toStdString())
+                                return QString::fromStdString(m.second.name);
+                }
+
+                return localUserId_;
+        }();
+
+        if (total == 2)
+                return first_member;
+        else if (total > 2)
+                return QString("%1 and %2 others").arg(first_member).arg(total - 1);
+
+        return "Empty Room";
+}
+
+bool
+Cache::saveRoomSummary(lmdb::txn &txn, lmdb::dbi &statesdb, const RoomSummary &summary)
+{
+        if (!summary.heroes && !summary.joined_member_count && !summary.invited_member_count)
+                return false;
+
+        auto merged       = getRoomSummary(txn, statesdb);
+        const auto stored = json(merged);
+
+        if (summary.heroes)
+                merged.heroes = summary.heroes;
+        if (summary.joined_member_count)
+                merged.joined_member_count = summary.joined_member_count;
+        if (summary.invited_member_count)
+                merged.invited_member_count = summary.invited_member_count;
+
+        const auto updated = json(merged);
+        if (updated == stored)
+                return false;
+
+        lmdb::dbi_put(txn, statesdb, ROOM_SUMMARY_KEY, lmdb::val(encodeValue(updated)));
+        return true;
+}
+
+RoomSummary
+Cache::getRoomSummary(lmdb::txn &txn, lmdb::dbi &statesdb)
+{
+        lmdb::val data;
+        if (!lmdb::dbi_get(txn, statesdb, ROOM_SUMMARY_KEY, data))
+                return {};
+
+        try {
+                return decodeValue(data).get<RoomSummary>();
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the room summary: {}", e.what());
+                return {};
+        }
+}
+
+std::optional<MemberInfo>
+Cache::getMemberInfo(lmdb::txn &txn, lmdb::dbi &membersdb, const std::string &user_id)
+{
+        lmdb::val data;
+        if (!lmdb::dbi_get(txn, membersdb, lmdb::val(user_id), data))
+                return std::nullopt;
+
+        try {
+                return decodeValue(data).get<MemberInfo>();
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse member info: {}", e.what());
+                return std::nullopt;
+        }
+}
+
+mtx::events::state::JoinRule
+Cache::getRoomJoinRule(lmdb::txn &txn, lmdb::dbi &statesdb)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomJoinRules)), event);
+
+        if (res) {
+                try {
+                        StateEvent<state::JoinRules> msg = decodeValue(event);
+                        return msg.content.join_rule;
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.join_rule event: {}", e.what());
+                }
+        }
+        return state::JoinRule::Knock;
+}
+
+bool
+Cache::getRoomGuestAccess(lmdb::txn &txn, lmdb::dbi &statesdb)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomGuestAccess)), event);
+
+        if (res) {
+                try {
+                        StateEvent<GuestAccess> msg = decodeValue(event);
+                        return msg.content.guest_access == AccessState::CanJoin;
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.guest_access event: {}",
+                                          e.what());
+                }
+        }
+        return false;
+}
+
+QString
+Cache::getRoomTopic(lmdb::txn &txn, lmdb::dbi &statesdb)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomTopic)), event);
+
+        if (res) {
+                try {
+                        StateEvent<Topic> msg = decodeValue(event);
+
+                        if (!msg.content.topic.empty())
+                                return QString::fromStdString(msg.content.topic);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.topic event: {}", e.what());
+                }
+        }
+
+        return QString();
+}
+
+QString
+Cache::getRoomVersion(lmdb::txn &txn, lmdb::dbi &statesdb)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomCreate)), event);
+
+        if (res) {
+                try {
+                        StateEvent<Create> msg = decodeValue(event);
+
+                        if (!msg.content.room_version.empty())
+                                return QString::fromStdString(msg.content.room_version);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.create event: {}", e.what());
+                }
+        }
+
+        nhlog::db()->warn("m.room.create event is missing room version, assuming version \"1\"");
+        return QString("1");
+}
+
+QString
+Cache::getInviteRoomName(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomName)), event);
+
+        if (res) {
+                try {
+                        StrippedEvent<state::Name> msg = decodeValue(event);
+                        return QString::fromStdString(msg.content.name);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.name event: {}", e.what());
+                }
+        }
+
+        auto cursor           = lmdb::cursor::open(txn, membersdb);
+        const auto local_user = localUserId_.toStdString();
+        lmdb::val user_id, member_data;
+
+        while (cursor.get(user_id, member_data, MDB_NEXT)) {
+                if (view(user_id) == local_user)
+                        continue;
+
+                try {
+                        MemberInfo tmp = decodeValue(member_data);
+                        cursor.close();
+
+                        return QString::fromStdString(tmp.name);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse member info: {}", e.what());
+                }
+        }
+
+        cursor.close();
+
+        return QString("Empty Room");
+}
+
+QString
+Cache::getInviteRoomAvatarUrl(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res = lmdb::dbi_get(
+          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomAvatar)), event);
+
+        if (res) {
+                try {
+                        StrippedEvent<state::Avatar> msg = decodeValue(event);
+                        return QString::fromStdString(msg.content.url);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.avatar event: {}", e.what());
+                }
+        }
+
+        auto cursor           = lmdb::cursor::open(txn, membersdb);
+        const auto local_user = localUserId_.toStdString();
+        lmdb::val user_id, member_data;
+
+        while (cursor.get(user_id, member_data, MDB_NEXT)) {
+                if (view(user_id) == local_user)
+                        continue;
+
+                try {
+                        MemberInfo tmp = decodeValue(member_data);
+                        cursor.close();
+
+                        return QString::fromStdString(tmp.avatar_url);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse member info: {}", e.what());
+                }
+        }
+
+        cursor.close();
+
+        return QString();
+}
+
+QString
+Cache::getInviteRoomTopic(lmdb::txn &txn, lmdb::dbi &db)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        lmdb::val event;
+        bool res =
+          lmdb::dbi_get(txn, db, lmdb::val(to_string(mtx::events::EventType::RoomTopic)), event);
+
+        if (res) {
+                try {
+                        StrippedEvent<Topic> msg = decodeValue(event);
+                        return QString::fromStdString(msg.content.topic);
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse m.room.topic event: {}", e.what());
+                }
         }
 
-        saveInvites(txn, res.rooms.invite);
+        return QString();
+}
 
-        removeLeftRooms(txn, res.rooms.leave);
+std::vector<std::string>
+Cache::joinedRooms()
+{
+        auto txn         = beginTxn(MDB_RDONLY);
+        auto roomsCursor = lmdb::cursor::open(txn, roomsDb_);
 
-        txn.commit();
+        std::string id, data;
+        std::vector<std::string> room_ids;
 
-        std::map<QString, bool> readStatus;
+        // Gather the room ids for the joined rooms.
+        while (roomsCursor.get(id, data, MDB_NEXT))
+                room_ids.emplace_back(id);
 
-        for (const auto &room : res.rooms.join) {
-                notifyForReadReceipts(room.first);
-                readStatus.emplace(QString::fromStdString(room.first),
-                                   calculateRoomReadStatus(room.first));
-        }
+        roomsCursor.close();
+        txn.commit();
 
-        emit roomReadStatus(readStatus);
+        return room_ids;
 }
 
-void
-Cache::saveInvites(lmdb::txn &txn, const std::map<std::string, mtx::responses::InvitedRoom> &rooms)
+std::vector<SearchResult>
+Cache::searchUsers(const std::string &room_id, const std::string &query, std::uint8_t max_items)
 {
-        for (const auto &room : rooms) {
-                auto statesdb  = getInviteStatesDb(txn, room.first);
-                auto membersdb = getInviteMembersDb(txn, room.first);
+        cache::LatencyTimer timer(NHEKO_METRIC("searchUsers"));
 
-                saveInvite(txn, statesdb, membersdb, room.second);
+        std::vector<std::string> user_ids;
 
-                RoomInfo updatedInfo;
-                updatedInfo.name  = getInviteRoomName(txn, statesdb, membersdb).toStdString();
-                updatedInfo.topic = getInviteRoomTopic(txn, statesdb).toStdString();
-                updatedInfo.avatar_url =
-                  getInviteRoomAvatarUrl(txn, statesdb, membersdb).toStdString();
-                updatedInfo.is_invite = true;
+        {
+                std::shared_lock lock(MemberSearchMutex);
 
-                lmdb::dbi_put(
-                  txn, invitesDb_, lmdb::val(room.first), lmdb::val(json(updatedInfo).dump()));
+                auto it = MemberSearchIndex.find(room_id);
+                if (it != MemberSearchIndex.end())
+                        user_ids = it->second.search(QString::fromStdString(query), max_items);
         }
-}
-
-void
-Cache::saveInvite(lmdb::txn &txn,
-                  lmdb::dbi &statesdb,
-                  lmdb::dbi &membersdb,
-                  const mtx::responses::InvitedRoom &room)
-{
-        using namespace mtx::events;
-        using namespace mtx::events::state;
-
-        for (const auto &e : room.invite_state) {
-                if (auto msg = std::get_if<StrippedEvent<Member>>(&e)) {
-                        auto display_name = msg->content.display_name.empty()
-                                              ? msg->state_key
-                                              : msg->content.display_name;
 
-                        MemberInfo tmp{display_name, msg->content.avatar_url};
+        if (user_ids.empty()) {
+                std::unique_lock lock(MemberSearchMutex);
 
-                        lmdb::dbi_put(
-                          txn, membersdb, lmdb::val(msg->state_key), lmdb::val(json(tmp).dump()));
-                } else {
-                        std::visit(
-                          [&txn, &statesdb](auto msg) {
-                                  bool res = lmdb::dbi_put(txn,
-                                                           statesdb,
-                                                           lmdb::val(to_string(msg.type)),
-                                                           lmdb::val(json(msg).dump()));
+                if (!MemberSearchIndex.count(room_id)) {
+                        // Holding the lock while reading the members makes the display name
+                        // updates of a concurrent sync wait, until they can be applied on top.
+                        SearchIndex index;
 
-                                  if (!res)
-                                          nhlog::db()->warn("couldn't save data: {}",
-                                                            json(msg).dump());
-                          },
-                          e);
-                }
-        }
-}
+                        auto txn    = beginTxn(MDB_RDONLY);
+                        auto cursor = lmdb::cursor::open(txn, getMembersDb(txn, room_id));
 
-std::vector<std::string>
-Cache::roomsWithStateUpdates(const mtx::responses::Sync &res)
-{
-        std::vector<std::string> rooms;
-        for (const auto &room : res.rooms.join) {
-                bool hasUpdates = false;
-                for (const auto &s : room.second.state.events) {
-                        if (containsStateUpdates(s)) {
-                                hasUpdates = true;
-                                break;
+                        lmdb::val key, user_data;
+                        while (cursor.get(key, user_data, MDB_NEXT)) {
+                                try {
+                                        const std::string user_id(view(key));
+                                        MemberInfo info = decodeValue(user_data);
+                                        index.insert(user_id,
+                                                     QString::fromStdString(
+                                                       info.name.empty() ? user_id : info.name));
+                                } catch (const json::exception &e) {
+                                        nhlog::db()->warn("failed to parse member info: {}",
+                                                          e.what());
+                                }
                         }
-                }
 
-                for (const auto &s : room.second.timeline.events) {
-                        if (containsStateUpdates(s)) {
-                                hasUpdates = true;
-                                break;
-                        }
-                }
+                        cursor.close();
+                        txn.commit();
 
-                if (hasUpdates)
-                        rooms.emplace_back(room.first);
-        }
+                        nhlog::db()->debug("indexed {} members of {}", index.size(), room_id);
 
-        for (const auto &room : res.rooms.invite) {
-                for (const auto &s : room.second.invite_state) {
-                        if (containsStateUpdates(s)) {
-                                rooms.emplace_back(room.first);
-                                break;
-                        }
+                        auto &entry = MemberSearchIndex[room_id];
+                        entry       = std::move(index);
+                        user_ids    = entry.search(QString::fromStdString(query), max_items);
                 }
         }
 
-        return rooms;
+        std::vector<SearchResult> results;
+        for (const auto &user_id : user_ids)
+                results.push_back(SearchResult{QString::fromStdString(user_id),
+                                               QString::fromStdString(
+                                                 displayName(room_id, user_id))});
+
+        return results;
 }
 
-std::vector<std::string>
-Cache::roomsWithTagUpdates(const mtx::responses::Sync &res)
+std::vector<RoomMember>
+Cache::getMembers(const std::string &room_id, std::size_t startIndex, std::size_t len)
 {
-        using namespace mtx::events;
+        cache::LatencyTimer timer(NHEKO_METRIC("getMembers"));
 
-        std::vector<std::string> rooms;
-        for (const auto &room : res.rooms.join) {
-                bool hasUpdates = false;
-                for (const auto &evt : room.second.account_data.events) {
-                        if (std::holds_alternative<Event<account_data::Tag>>(evt)) {
-                                hasUpdates = true;
-                        }
-                }
-
-                if (hasUpdates)
-                        rooms.emplace_back(room.first);
-        }
+        auto txn    = beginTxn(MDB_RDONLY);
+        auto db     = getMembersDb(txn, room_id);
+        auto cursor = lmdb::cursor::open(txn, db);
 
-        return rooms;
-}
+        std::size_t currentIndex = 0;
 
-RoomInfo
-Cache::singleRoomInfo(const std::string &room_id)
-{
-        auto txn      = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        auto statesdb = getStatesDb(txn, room_id);
+        const auto endIndex = std::min(startIndex + len, db.size(txn));
 
-        lmdb::val data;
+        std::vector<RoomMember> members;
 
-        // Check if the room is joined.
-        if (lmdb::dbi_get(txn, roomsDb_, lmdb::val(room_id), data)) {
-                try {
-                        RoomInfo tmp     = json::parse(std::string(data.data(), data.size()));
-                        tmp.member_count = getMembersDb(txn, room_id).size(txn);
-                        tmp.join_rule    = getRoomJoinRule(txn, statesdb);
-                        tmp.guest_access = getRoomGuestAccess(txn, statesdb);
+        // The members before the page are skipped without reading their values.
+        lmdb::val user_id, user_data;
+        while (cursor.get(user_id, user_data, MDB_NEXT)) {
+                if (currentIndex < startIndex) {
+                        currentIndex += 1;
+                        continue;
+                }
 
-                        txn.commit();
+                if (currentIndex >= endIndex)
+                        break;
 
-                        return tmp;
+                try {
+                        MemberInfo tmp = decodeValue(user_data);
+                        members.emplace_back(
+                          RoomMember{QString::fromUtf8(user_id.data(), (int)user_id.size()),
+                                     QString::fromStdString(tmp.name),
+                                     QString::fromStdString(tmp.avatar_url)});
                 } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse room info: room_id ({}), {}",
-                                          room_id,
-                                          std::string(data.data(), data.size()));
+                        nhlog::db()->warn("{}", e.what());
                 }
+
+                currentIndex += 1;
         }
 
+        cursor.close();
         txn.commit();
 
-        return RoomInfo();
+        return members;
 }
 
-std::map<QString, RoomInfo>
-Cache::getRoomInfo(const std::vector<std::string> &rooms)
+RoomMembersPage
+Cache::getMembersPage(const std::string &room_id, const std::string &token, std::size_t len)
 {
-        std::map<QString, RoomInfo> room_info;
+        auto txn    = beginTxn(MDB_RDONLY);
+        auto cursor = lmdb::cursor::open(txn, getMembersDb(txn, room_id));
 
-        // TODO This should be read only.
-        auto txn = lmdb::txn::begin(env_);
+        RoomMembersPage page;
 
-        for (const auto &room : rooms) {
-                lmdb::val data;
-                auto statesdb = getStatesDb(txn, room);
+        lmdb::val user_id, user_data;
+        bool found;
+        if (token.empty()) {
+                found = cursor.get(user_id, user_data, MDB_FIRST);
+        } else {
+                // The token is the last user of the previous page, who may have left since.
+                user_id = lmdb::val(token.data(), token.size());
+                found   = cursor.get(user_id, user_data, MDB_SET_RANGE);
 
-                // Check if the room is joined.
-                if (lmdb::dbi_get(txn, roomsDb_, lmdb::val(room), data)) {
-                        try {
-                                RoomInfo tmp = json::parse(std::string(data.data(), data.size()));
-                                tmp.member_count = getMembersDb(txn, room).size(txn);
-                                tmp.join_rule    = getRoomJoinRule(txn, statesdb);
-                                tmp.guest_access = getRoomGuestAccess(txn, statesdb);
+                if (found && view(user_id) == token)
+                        found = cursor.get(user_id, user_data, MDB_NEXT);
+        }
 
-                                room_info.emplace(QString::fromStdString(room), std::move(tmp));
-                        } catch (const json::exception &e) {
-                                nhlog::db()->warn("failed to parse room info: room_id ({}), {}",
-                                                  room,
-                                                  std::string(data.data(), data.size()));
-                        }
-                } else {
-                        // Check if the room is an invite.
-                        if (lmdb::dbi_get(txn, invitesDb_, lmdb::val(room), data)) {
-                                try {
-                                        RoomInfo tmp =
-                                          json::parse(std::string(data.data(), data.size()));
-                                        tmp.member_count = getInviteMembersDb(txn, room).size(txn);
+        std::string last_user_id;
+        while (found && page.members.size() < len) {
+                last_user_id = view(user_id);
 
-                                        room_info.emplace(QString::fromStdString(room),
-                                                          std::move(tmp));
-                                } catch (const json::exception &e) {
-                                        nhlog::db()->warn(
-                                          "failed to parse room info for invite: room_id ({}), {}",
-                                          room,
-                                          std::string(data.data(), data.size()));
-                                }
-                        }
+                try {
+                        MemberInfo tmp = decodeValue(user_data);
+                        page.members.emplace_back(
+                          RoomMember{QString::fromUtf8(user_id.data(), (int)user_id.size()),
+                                     QString::fromStdString(tmp.name),
+                                     QString::fromStdString(tmp.avatar_url)});
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("{}", e.what());
                 }
+
+                found = cursor.get(user_id, user_data, MDB_NEXT);
         }
 
+        if (found)
+                page.next_token = last_user_id;
+
+        cursor.close();
         txn.commit();
 
-        return room_info;
+        return page;
 }
 
-std::map<QString, mtx::responses::Timeline>
-Cache::roomMessages()
+bool
+Cache::isRoomMember(const std::string &user_id, const std::string &room_id)
 {
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        auto txn = beginTxn(MDB_RDONLY);
+        auto db  = findDb(txn, room_id + "/members");
 
-        std::map<QString, mtx::responses::Timeline> msgs;
-        std::string room_id, unused;
-
-        auto roomsCursor = lmdb::cursor::open(txn, roomsDb_);
-        while (roomsCursor.get(room_id, unused, MDB_NEXT))
-                msgs.emplace(QString::fromStdString(room_id), mtx::responses::Timeline());
-
-        roomsCursor.close();
+        lmdb::val value;
+        bool res = db && lmdb::dbi_get(txn, *db, lmdb::val(user_id), value);
         txn.commit();
 
-        return msgs;
+        return res;
 }
 
-QMap<QString, mtx::responses::Notifications>
-Cache::getTimelineMentions()
+void
+Cache::saveTimelineMessages(lmdb::txn &txn,
+                            const std::string &room_id,
+                            const mtx::responses::Timeline &res,
+                            const nlohmann::json &rawEvents)
 {
-        // TODO: Should be read-only, but getMentionsDb will attempt to create a DB
-        // if it doesn't exist, throwing an error.
-        auto txn = lmdb::txn::begin(env_, nullptr);
+        auto db       = getMessagesDb(txn, room_id);
+        auto eventsDb = getEventIndexDb(txn, room_id);
 
-        QMap<QString, mtx::responses::Notifications> notifs;
-
-        auto room_ids = getRoomIds(txn);
+        using namespace mtx::events;
+        using namespace mtx::events::state;
 
-        for (const auto &room_id : room_ids) {
-                auto roomNotifs                         = getTimelineMentionsForRoom(txn, room_id);
-                notifs[QString::fromStdString(room_id)] = roomNotifs;
+        // The events are stored as they were received, if the response is available. Only the
+        // others are serialized again from the parsed events.
+        std::unordered_map<std::string, const json *> originals;
+        if (rawEvents.is_array()) {
+                for (const auto &event : rawEvents)
+                        if (event.is_object() && event.count("event_id") != 0 &&
+                            event.at("event_id").is_string())
+                                originals.emplace(event.at("event_id").get<std::string>(), &event);
         }
 
-        txn.commit();
+        // The first event of a limited timeline doesn't connect to the already stored events.
+        bool isFirst = true;
 
-        return notifs;
-}
+        for (const auto &e : res.events) {
+                const auto event_id = utils::event_id(e);
 
-mtx::responses::Timeline
-Cache::getTimelineMessages(lmdb::txn &txn, const std::string &room_id)
-{
-        // TODO(nico): Limit the messages returned by this maybe?
-        auto db = getMessagesDb(txn, room_id);
+                // The redaction itself isn't stored, only the redacted event is stripped.
+                if (auto redaction = std::get_if<RedactionEvent<msg::Redaction>>(&e)) {
+                        auto original = originals.find(event_id);
+                        redactStoredEvent(txn,
+                                          room_id,
+                                          redaction->redacts,
+                                          original != originals.end()
+                                            ? *original->second
+                                            : utils::serialize_event(e));
+                        continue;
+                }
 
-        mtx::responses::Timeline timeline;
-        std::string timestamp, msg;
+                const auto key = messageKey(utils::event_timestamp(e), event_id);
 
-        auto cursor = lmdb::cursor::open(txn, db);
+                json obj = json::object();
+
+                if (auto original = originals.find(event_id); original != originals.end())
+                        obj["event"] = *original->second;
+                else
+                        obj["event"] = utils::serialize_event(e);
+                obj["token"] = res.prev_batch;
 
-        size_t index = 0;
+                // Unless the event is stored already, e.g. by a limited sync after a short time.
+                // Then it keeps its gap, since the stored events before it connect as before.
+                if (isFirst && res.limited) {
+                        lmdb::val storedKey, stored;
+                        if (!lmdb::dbi_get(txn, eventsDb, lmdb::val(event_id), storedKey) ||
+                            (lmdb::dbi_get(txn, db, storedKey, stored) &&
+                             decodeMessage(stored).value("gap", false)))
+                                obj["gap"] = true;
+                }
+                isFirst = false;
+
+                lmdb::dbi_put(txn, db, lmdb::val(key), lmdb::val(encodeMessage(obj)));
+                lmdb::dbi_put(txn, eventsDb, lmdb::val(event_id), lmdb::val(key));
+
+                // One of our messages arrived. It leaves the outbox here, because the timeline of
+                // the room may not be loaded to see it, which would send it again on its restore.
+                if (const auto txn_id = mtx::accessors::transaction_id_view(e); !txn_id.empty())
+                        lmdb::dbi_del(txn,
+                                      outboxDb_,
+                                      lmdb::val(outboxKey(room_id, std::string(txn_id))),
+                                      nullptr);
+        }
 
-        while (cursor.get(timestamp, msg, MDB_NEXT) && index < MAX_RESTORED_MESSAGES) {
-                auto obj = json::parse(msg);
+        indexMessages(room_id, res.events);
 
-                if (obj.count("event") == 0 || obj.count("token") == 0)
-                        continue;
+        // Only the newest message of the batch is described for the room list.
+        const auto local_user = utils::localUser();
+        for (auto it = res.events.rbegin(); it != res.events.rend(); ++it) {
+                auto info =
+                  utils::getMessageDescription(*it, local_user, QString::fromStdString(room_id));
 
-                mtx::events::collections::TimelineEvent event;
-                mtx::events::collections::from_json(obj.at("event"), event);
+                if (!info.event_id.isEmpty()) {
+                        saveLastMessageInfo(txn, room_id, info);
+                        break;
+                }
+        }
+}
+
+void
+Cache::redactStoredEvent(lmdb::txn &txn,
+                         const std::string &room_id,
+                         const std::string &event_id,
+                         const nlohmann::json &redaction)
+{
+        auto db       = getMessagesDb(txn, room_id);
+        auto eventsDb = getEventIndexDb(txn, room_id);
+
+        lmdb::val storedKey, value;
+        if (!lmdb::dbi_get(txn, eventsDb, lmdb::val(event_id), storedKey) ||
+            !lmdb::dbi_get(txn, db, storedKey, value))
+                return;
 
-                index += 1;
+        // The values point into the map, which the writes below may change.
+        const std::string key(storedKey.data(), storedKey.size());
+        auto obj = decodeMessage(value);
+        if (obj.count("event") == 0 ||
+            obj.at("event").value("unsigned", json::object()).count("redacted_because") != 0)
+                return;
+
+        auto media = mediaUrls(obj.at("event"));
 
-                timeline.events.push_back(event.data);
-                timeline.prev_batch = obj.at("token").get<std::string>();
+        // The media of an encrypted event is only named by its plaintext.
+        std::string sealed;
+        {
+                std::lock_guard lock(plaintextMutex_);
+                if (auto it = pendingPlaintext_.find(event_id); it != pendingPlaintext_.end()) {
+                        sealed = std::move(it->second);
+                        pendingPlaintext_.erase(it);
+                }
         }
-        cursor.close();
+        if (lmdb::val stored; lmdb::dbi_get(txn, decryptedEventsDb_, lmdb::val(event_id), stored)) {
+                if (sealed.empty())
+                        sealed = std::string(stored.data(), stored.size());
+                lmdb::dbi_del(txn, decryptedEventsDb_, lmdb::val(event_id), nullptr);
+        }
+        if (!sealed.empty() && !plaintextKey_.isEmpty()) {
+                if (auto plaintext = openPlaintext(plaintextKey_, event_id, sealed)) {
+                        try {
+                                for (auto &url : mediaUrls(decodeValue(*plaintext)))
+                                        media.push_back(std::move(url));
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn(
+                                  "failed to parse the plaintext of {}: {}", event_id, e.what());
+                        }
+                }
+        }
+
+        for (const auto &url : media)
+                removeMedia(txn, url);
 
-        std::reverse(timeline.events.begin(), timeline.events.end());
+        obj["event"] = redactedEvent(obj.at("event"), redaction);
+        lmdb::dbi_put(txn, db, lmdb::val(key), lmdb::val(encodeMessage(obj)));
 
-        return timeline;
+        // The room list shouldn't keep showing the redacted message.
+        if (getLastMessageInfo(txn, room_id).event_id.toStdString() == event_id)
+                updateLastMessageInfo(txn, room_id);
 }
 
-QMap<QString, RoomInfo>
-Cache::roomInfo(bool withInvites)
+void
+Cache::removeMedia(lmdb::txn &txn, const std::string &mxcUrl)
 {
-        QMap<QString, RoomInfo> result;
-
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        if (mxcUrl.rfind("mxc://", 0) != 0)
+                return;
 
-        std::string room_id;
-        std::string room_data;
+        lmdb::dbi_del(txn, imageDimensionsDb_, lmdb::val(mxcUrl), nullptr);
 
-        // Gather info about the joined rooms.
-        auto roomsCursor = lmdb::cursor::open(txn, roomsDb_);
-        while (roomsCursor.get(room_id, room_data, MDB_NEXT)) {
-                RoomInfo tmp     = json::parse(std::move(room_data));
-                tmp.member_count = getMembersDb(txn, room_id).size(txn);
-                tmp.msgInfo      = getLastMessageInfo(txn, room_id);
+        // The keys of the thumbnails are the key of the full media, followed by "_" and their
+        // size. Other media ids may start with the same characters and sort between them, e.g.
+        // with a "-", so the full media and the thumbnails are looked up separately.
+        const auto key       = mxcUrl.substr(6);
+        const auto thumbnail = key + "_";
 
-                result.insert(QString::fromStdString(std::move(room_id)), std::move(tmp));
-        }
-        roomsCursor.close();
+        std::vector<std::pair<std::string, std::string>> entries;
+        {
+                lmdb::val value;
+                if (lmdb::dbi_get(txn, mediaIndexDb_, lmdb::val(key), value))
+                        entries.emplace_back(key, std::string(value.data(), value.size()));
+
+                auto cursor = lmdb::cursor::open(txn, mediaIndexDb_);
+                lmdb::val k(thumbnail);
+                bool found = cursor.get(k, value, MDB_SET_RANGE);
+                while (found) {
+                        const std::string_view name(k.data(), k.size());
+                        if (name.substr(0, thumbnail.size()) != thumbnail)
+                                break;
 
-        if (withInvites) {
-                // Gather info about the invites.
-                auto invitesCursor = lmdb::cursor::open(txn, invitesDb_);
-                while (invitesCursor.get(room_id, room_data, MDB_NEXT)) {
-                        RoomInfo tmp     = json::parse(room_data);
-                        tmp.member_count = getInviteMembersDb(txn, room_id).size(txn);
-                        result.insert(QString::fromStdString(std::move(room_id)), std::move(tmp));
+                        entries.emplace_back(std::string(name),
+                                             std::string(value.data(), value.size()));
+                        found = cursor.get(k, value, MDB_NEXT);
                 }
-                invitesCursor.close();
+                cursor.close();
         }
 
-        txn.commit();
+        for (const auto &[name, value] : entries) {
+                try {
+                        const auto entry = decodeValue(value);
+
+                        std::lock_guard lock(removedMediaMutex_);
+                        removedMedia_[name] = {entry.value("file", ""),
+                                               entry.value("size", uint64_t(0))};
+                } catch (const json::exception &e) {
+                        nhlog::db()->warn("failed to parse media entry {}: {}", name, e.what());
+                }
 
-        return result;
+                lmdb::dbi_del(txn, mediaIndexDb_, lmdb::val(name), nullptr);
+        }
 }
 
-std::string
-Cache::getLastEventId(lmdb::txn &txn, const std::string &room_id)
+void
+Cache::deleteRemovedMedia()
 {
-        auto db = getMessagesDb(txn, room_id);
-
-        if (db.size(txn) == 0)
-                return {};
+        std::map<std::string, std::pair<std::string, uint64_t>> removed;
+        {
+                std::lock_guard lock(removedMediaMutex_);
+                removed.swap(removedMedia_);
+        }
 
-        std::string timestamp, msg;
+        if (removed.empty())
+                return;
 
-        auto cursor = lmdb::cursor::open(txn, db);
-        while (cursor.get(timestamp, msg, MDB_NEXT)) {
-                auto obj = json::parse(msg);
+        try {
+                // An aborted transaction leaves the entry in the index, so its file is kept.
+                auto txn = beginTxn(MDB_RDONLY);
+                for (auto it = removed.begin(); it != removed.end();) {
+                        lmdb::val unused;
+                        if (lmdb::dbi_get(txn, mediaIndexDb_, lmdb::val(it->first), unused))
+                                it = removed.erase(it);
+                        else
+                                ++it;
+                }
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to check the removed media: {}", e.what());
+                return;
+        }
 
-                if (obj.count("event") == 0)
-                        continue;
+        for (const auto &[key, entry] : removed) {
+                const auto &[file, size] = entry;
+                if (!file.empty())
+                        QFile::remove(mediaDirectory_ + "/" + QString::fromStdString(file));
 
-                cursor.close();
-                return obj["event"]["event_id"];
+                uint64_t current = mediaSize_;
+                while (!mediaSize_.compare_exchange_weak(current,
+                                                         current - std::min(current, size)))
+                        ;
         }
-        cursor.close();
-
-        return {};
 }
 
-DescInfo
-Cache::getLastMessageInfo(lmdb::txn &txn, const std::string &room_id)
+std::optional<mtx::events::collections::TimelineEvents>
+Cache::getEvent(const std::string &room_id, const std::string &event_id)
 {
-        auto db = getMessagesDb(txn, room_id);
-
-        if (db.size(txn) == 0)
-                return DescInfo{};
-
-        std::string timestamp, msg;
+        try {
+                auto txn      = beginTxn(MDB_RDONLY);
+                auto db       = getMessagesDb(txn, room_id);
+                auto eventsDb = getEventIndexDb(txn, room_id);
 
-        QSettings settings;
-        const auto local_user = utils::localUser();
+                lmdb::val key, value;
+                if (!lmdb::dbi_get(txn, eventsDb, lmdb::val(event_id), key) ||
+                    !lmdb::dbi_get(txn, db, key, value)) {
+                        txn.commit();
+                        return getFetchedEvent(room_id, event_id);
+                }
 
-        auto cursor = lmdb::cursor::open(txn, db);
-        while (cursor.get(timestamp, msg, MDB_NEXT)) {
-                auto obj = json::parse(msg);
+                // value points into the map, which is only valid while the txn is open.
+                auto obj = decodeValue(value);
+                txn.commit();
 
-                if (obj.count("event") == 0 || !(obj["event"]["type"] == "m.room.message" ||
-                                                 obj["event"]["type"] == "m.sticker" ||
-                                                 obj["event"]["type"] == "m.room.encrypted"))
-                        continue;
+                if (obj.count("event") == 0)
+                        return std::nullopt;
 
                 mtx::events::collections::TimelineEvent event;
                 mtx::events::collections::from_json(obj.at("event"), event);
 
-                cursor.close();
-                return utils::getMessageDescription(
-                  event.data, local_user, QString::fromStdString(room_id));
+                return event.data;
+        } catch (const lmdb::error &e) {
+                // The databases of a room only exist after its first timeline was saved.
+                nhlog::db()->debug("getEvent({}, {}): {}", room_id, event_id, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse cached event {}: {}", event_id, e.what());
         }
-        cursor.close();
 
-        return DescInfo{};
+        return getFetchedEvent(room_id, event_id);
 }
 
-std::map<QString, bool>
-Cache::invites()
+bool
+Cache::saveOldMessages(const std::string &room_id,
+                       const std::string &before_event_id,
+                       const mtx::responses::Messages &res)
 {
-        std::map<QString, bool> result;
-
-        auto txn    = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        auto cursor = lmdb::cursor::open(txn, invitesDb_);
+        using namespace mtx::events;
 
-        std::string room_id, unused;
+        // Without an end token, the server has no older events. The timeline starts here.
+        const bool reachedStart = res.end.empty() || res.end == res.start;
+        if (res.chunk.empty() && !reachedStart)
+                return false;
 
-        while (cursor.get(room_id, unused, MDB_NEXT))
-                result.emplace(QString::fromStdString(std::move(room_id)), true);
+        bool connected = false;
 
-        cursor.close();
-        txn.commit();
+        try {
+                auto txn      = beginTxn();
+                auto db       = getMessagesDb(txn, room_id);
+                auto eventsDb = getEventIndexDb(txn, room_id);
+
+                // The response continues the timeline before this event, so the event doesn't
+                // start a gap anymore.
+                lmdb::val key, value;
+                if (lmdb::dbi_get(txn, eventsDb, lmdb::val(before_event_id), key) &&
+                    lmdb::dbi_get(txn, db, key, value)) {
+                        auto obj = decodeMessage(value);
+                        if (obj.value("gap", false)) {
+                                obj.erase("gap");
+                                lmdb::dbi_put(txn, db, key, lmdb::val(encodeMessage(obj)));
+                        }
+                }
 
-        return result;
-}
+                // Events are newest first. Once an event is stored already, the page reached the
+                // stored history before the gap, so the rest of the page is stored too and the
+                // stored events connect to the new ones.
+                std::size_t count = 0;
+                for (; count < res.chunk.size(); count++) {
+                        const auto event_id = utils::event_id(res.chunk[count]);
 
-QString
-Cache::getRoomAvatarUrl(lmdb::txn &txn,
-                        lmdb::dbi &statesdb,
-                        lmdb::dbi &membersdb,
-                        const QString &room_id)
-{
-        using namespace mtx::events;
-        using namespace mtx::events::state;
+                        lmdb::val stored;
+                        if (lmdb::dbi_get(txn, eventsDb, lmdb::val(event_id), stored)) {
+                                connected = true;
+                                break;
+                        }
+                }
 
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomAvatar)), event);
+                // Otherwise we don't know, if the stored events before the oldest one connect to
+                // it, unless the timeline starts with it.
+                for (std::size_t i = 0; i < count; i++) {
+                        const auto &e = res.chunk[i];
+                        if (auto redaction = std::get_if<RedactionEvent<msg::Redaction>>(&e)) {
+                                redactStoredEvent(
+                                  txn, room_id, redaction->redacts, utils::serialize_event(e));
+                                continue;
+                        }
 
-        if (res) {
-                try {
-                        StateEvent<Avatar> msg =
-                          json::parse(std::string(event.data(), event.size()));
+                        json obj     = json::object();
+                        obj["event"] = utils::serialize_event(e);
+                        obj["token"] = res.end;
 
-                        if (!msg.content.url.empty())
-                                return QString::fromStdString(msg.content.url);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.avatar event: {}", e.what());
-                }
-        }
+                        if (i + 1 == count && !connected && !reachedStart)
+                                obj["gap"] = true;
 
-        // We don't use an avatar for group chats.
-        if (membersdb.size(txn) > 2)
-                return QString();
+                        const auto event_id  = utils::event_id(e);
+                        const auto event_key = messageKey(utils::event_timestamp(e), event_id);
 
-        auto cursor = lmdb::cursor::open(txn, membersdb);
-        std::string user_id;
-        std::string member_data;
+                        lmdb::dbi_put(txn, db, lmdb::val(event_key), lmdb::val(encodeMessage(obj)));
+                        lmdb::dbi_put(txn, eventsDb, lmdb::val(event_id), lmdb::val(event_key));
+                }
 
-        // Resolve avatar for 1-1 chats.
-        while (cursor.get(user_id, member_data, MDB_NEXT)) {
-                if (user_id == localUserId_.toStdString())
-                        continue;
+                if (connected)
+                        nhlog::db()->debug("filled a gap in the timeline of room {} with {} events",
+                                           room_id,
+                                           count);
 
-                try {
-                        MemberInfo m = json::parse(member_data);
+                indexMessages(room_id,
+                              std::vector<mtx::events::collections::TimelineEvents>(
+                                res.chunk.begin(), res.chunk.begin() + count));
 
-                        cursor.close();
-                        return QString::fromStdString(m.avatar_url);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse member info: {}", e.what());
-                }
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn(
+                  "failed to save the older messages of room {}: {}", room_id, e.what());
+                return false;
         }
 
-        cursor.close();
-
-        // Default case when there is only one member.
-        return avatarUrl(room_id, localUserId_);
+        flushMessageIndex();
+        deleteRemovedMedia();
+        return connected;
 }
 
-QString
-Cache::getRoomName(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb)
+void
+Cache::saveTimelineContext(const std::string &room_id,
+                           const std::vector<mtx::events::collections::TimelineEvents> &events,
+                           const std::string &start)
 {
         using namespace mtx::events;
-        using namespace mtx::events::state;
 
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomName)), event);
+        if (events.empty())
+                return;
 
-        if (res) {
-                try {
-                        StateEvent<Name> msg = json::parse(std::string(event.data(), event.size()));
+        std::vector<collections::TimelineEvents> added;
 
-                        if (!msg.content.name.empty())
-                                return QString::fromStdString(msg.content.name);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.name event: {}", e.what());
+        try {
+                auto txn      = beginTxn();
+                auto db       = getMessagesDb(txn, room_id);
+                auto eventsDb = getEventIndexDb(txn, room_id);
+
+                auto isStored = [&txn, &eventsDb](const std::string &event_id) {
+                        lmdb::val key;
+                        return lmdb::dbi_get(txn, eventsDb, lmdb::val(event_id), key);
+                };
+
+                // The stored event after the newest one doesn't connect to them anymore, unless
+                // the newest one was stored already.
+                if (!isStored(utils::event_id(events.front()))) {
+                        const auto newest = messageKey(utils::event_timestamp(events.front()),
+                                                       utils::event_id(events.front()));
+
+                        auto cursor = lmdb::cursor::open(txn, db);
+                        lmdb::val key(newest), value;
+                        if (cursor.get(key, value, MDB_SET_RANGE)) {
+                                auto obj = decodeMessage(value);
+                                if (obj.count("event") != 0 && !obj.value("gap", false)) {
+                                        obj["gap"] = true;
+                                        lmdb::dbi_put(txn, db, key, lmdb::val(encodeMessage(obj)));
+                                }
+                        }
+                        cursor.close();
                 }
-        }
 
-        res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomCanonicalAlias)), event);
+                // Events are newest first. A stored event, which starts a gap, connects to the
+                // older events of the context now. Stored events keep their token otherwise.
+                for (std::size_t i = 0; i < events.size(); i++) {
+                        const auto &e = events[i];
+                        if (std::holds_alternative<RedactionEvent<msg::Redaction>>(e))
+                                continue;
 
-        if (res) {
-                try {
-                        StateEvent<CanonicalAlias> msg =
-                          json::parse(std::string(event.data(), event.size()));
+                        const auto event_id = utils::event_id(e);
+                        const bool isOldest = i + 1 == events.size();
+
+                        lmdb::val key, value;
+                        if (lmdb::dbi_get(txn, eventsDb, lmdb::val(event_id), key)) {
+                                if (!isOldest && lmdb::dbi_get(txn, db, key, value)) {
+                                        auto obj = decodeMessage(value);
+                                        if (obj.value("gap", false)) {
+                                                obj.erase("gap");
+                                                lmdb::dbi_put(
+                                                  txn, db, key, lmdb::val(encodeMessage(obj)));
+                                        }
+                                }
+                                continue;
+                        }
 
-                        if (!msg.content.alias.empty())
-                                return QString::fromStdString(msg.content.alias);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.canonical_alias event: {}",
-                                          e.what());
-                }
-        }
+                        json obj     = json::object();
+                        obj["event"] = utils::serialize_event(e);
+                        obj["token"] = start;
 
-        auto cursor     = lmdb::cursor::open(txn, membersdb);
-        const int total = membersdb.size(txn);
+                        // We don't know, if the stored events before the oldest one connect to
+                        // it.
+                        if (isOldest)
+                                obj["gap"] = true;
 
-        std::size_t ii = 0;
-        std::string user_id;
-        std::string member_data;
-        std::map<std::string, MemberInfo> members;
+                        const auto event_key = messageKey(utils::event_timestamp(e), event_id);
 
-        while (cursor.get(user_id, member_data, MDB_NEXT) && ii < 3) {
-                try {
-                        members.emplace(user_id, json::parse(member_data));
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse member info: {}", e.what());
+                        lmdb::dbi_put(txn, db, lmdb::val(event_key), lmdb::val(encodeMessage(obj)));
+                        lmdb::dbi_put(txn, eventsDb, lmdb::val(event_id), lmdb::val(event_key));
+                        added.push_back(e);
                 }
 
-                ii++;
-        }
+                indexMessages(room_id, added);
 
-        cursor.close();
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn(
+                  "failed to save the context of an event in room {}: {}", room_id, e.what());
+        }
 
-        if (total == 1 && !members.empty())
-                return QString::fromStdString(members.begin()->second.name);
+        flushMessageIndex();
+}
 
-        auto first_member = [&members, this]() {
-                for (const auto &m : members) {
-                        if (m.first != localUserId_.toStdString())
-                                return QString::fromStdString(m.second.name);
-                }
+void
+Cache::indexMessages(const std::string &room_id,
+                     const std::vector<mtx::events::collections::TimelineEvents> &events)
+{
+        using namespace mtx::events;
 
-                return localUserId_;
-        }();
+        if (!messageIndex_)
+                return;
 
-        if (total == 2)
-                return first_member;
-        else if (total > 2)
-                return QString("%1 and %2 others").arg(first_member).arg(total - 1);
+        for (const auto &e : events) {
+                if (auto redaction = std::get_if<RedactionEvent<msg::Redaction>>(&e)) {
+                        messageIndex_->remove(room_id, redaction->redacts);
+                        continue;
+                }
 
-        return "Empty Room";
+                const auto body = mtx::accessors::body(e);
+                if (!body.empty())
+                        messageIndex_->add(room_id,
+                                           utils::event_id(e),
+                                           utils::event_timestamp(e),
+                                           QString::fromStdString(body));
+        }
 }
 
-mtx::events::state::JoinRule
-Cache::getRoomJoinRule(lmdb::txn &txn, lmdb::dbi &statesdb)
+void
+Cache::flushMessageIndex()
 {
-        using namespace mtx::events;
-        using namespace mtx::events::state;
-
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomJoinRules)), event);
+        if (!messageIndex_)
+                return;
 
-        if (res) {
-                try {
-                        StateEvent<state::JoinRules> msg =
-                          json::parse(std::string(event.data(), event.size()));
-                        return msg.content.join_rule;
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.join_rule event: {}", e.what());
-                }
+        try {
+                messageIndex_->flush();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to update the message index: {}", e.what());
         }
-        return state::JoinRule::Knock;
 }
 
-bool
-Cache::getRoomGuestAccess(lmdb::txn &txn, lmdb::dbi &statesdb)
+void
+Cache::indexDecryptedMessage(const std::string &room_id,
+                             const mtx::events::collections::TimelineEvents &event)
 {
-        using namespace mtx::events;
-        using namespace mtx::events::state;
+        if (!messageIndex_)
+                return;
 
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomGuestAccess)), event);
+        indexMessages(room_id, {event});
 
-        if (res) {
-                try {
-                        StateEvent<GuestAccess> msg =
-                          json::parse(std::string(event.data(), event.size()));
-                        return msg.content.guest_access == AccessState::CanJoin;
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.guest_access event: {}",
-                                          e.what());
-                }
-        }
-        return false;
+        // Decrypted messages arrive one by one, so they are written in small batches.
+        if (messageIndex_->pending() >= 64)
+                flushMessageIndex();
 }
 
-QString
-Cache::getRoomTopic(lmdb::txn &txn, lmdb::dbi &statesdb)
+std::optional<mtx::events::collections::TimelineEvents>
+Cache::getDecryptedEvent(const std::string &event_id)
 {
-        using namespace mtx::events;
-        using namespace mtx::events::state;
+        if (plaintextKey_.isEmpty())
+                return std::nullopt;
 
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomTopic)), event);
+        std::string sealed;
+        {
+                std::lock_guard lock(plaintextMutex_);
+                if (auto it = pendingPlaintext_.find(event_id); it != pendingPlaintext_.end())
+                        sealed = it->second;
+        }
 
-        if (res) {
-                try {
-                        StateEvent<Topic> msg =
-                          json::parse(std::string(event.data(), event.size()));
+        try {
+                if (sealed.empty()) {
+                        auto txn = beginTxn(MDB_RDONLY);
 
-                        if (!msg.content.topic.empty())
-                                return QString::fromStdString(msg.content.topic);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.topic event: {}", e.what());
+                        lmdb::val value;
+                        if (lmdb::dbi_get(txn, decryptedEventsDb_, lmdb::val(event_id), value))
+                                sealed = std::string(value.data(), value.size());
+
+                        txn.commit();
                 }
+
+                if (sealed.empty())
+                        return std::nullopt;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the decrypted event {}: {}", event_id, e.what());
+                return std::nullopt;
         }
 
-        return QString();
+        const auto plaintext = openPlaintext(plaintextKey_, event_id, sealed);
+        if (!plaintext) {
+                nhlog::db()->warn("failed to open the plaintext of {}", event_id);
+                return std::nullopt;
+        }
+
+        try {
+                mtx::events::collections::TimelineEvent event;
+                mtx::events::collections::from_json(decodeValue(*plaintext), event);
+                return event.data;
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the decrypted event {}: {}", event_id, e.what());
+        }
+
+        return std::nullopt;
 }
 
-QString
-Cache::getRoomVersion(lmdb::txn &txn, lmdb::dbi &statesdb)
+void
+Cache::saveDecryptedEvent(const mtx::events::collections::TimelineEvents &event)
 {
-        using namespace mtx::events;
-        using namespace mtx::events::state;
+        if (plaintextKey_.isEmpty())
+                return;
 
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomCreate)), event);
+        const auto event_id  = utils::event_id(event);
+        const auto plaintext = encodeValue(utils::serialize_event(event));
+        if (plaintext.size() > MAX_DECRYPTED_EVENT_SIZE)
+                return;
 
-        if (res) {
-                try {
-                        StateEvent<Create> msg =
-                          json::parse(std::string(event.data(), event.size()));
+        auto sealed = sealPlaintext(plaintextKey_, event_id, plaintext);
+        if (!sealed) {
+                nhlog::db()->warn("failed to seal the plaintext of {}", event_id);
+                return;
+        }
 
-                        if (!msg.content.room_version.empty())
-                                return QString::fromStdString(msg.content.room_version);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.create event: {}", e.what());
-                }
+        bool full = false;
+        {
+                std::lock_guard lock(plaintextMutex_);
+                pendingPlaintext_[event_id] = std::move(*sealed);
+                full = pendingPlaintext_.size() >= DECRYPTED_EVENTS_BATCH_SIZE;
         }
 
-        nhlog::db()->warn("m.room.create event is missing room version, assuming version \"1\"");
-        return QString("1");
+        if (full)
+                flushDecryptedEvents();
 }
 
-QString
-Cache::getInviteRoomName(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb)
+void
+Cache::flushDecryptedEvents()
 {
-        using namespace mtx::events;
-        using namespace mtx::events::state;
-
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomName)), event);
-
-        if (res) {
-                try {
-                        StrippedEvent<state::Name> msg =
-                          json::parse(std::string(event.data(), event.size()));
-                        return QString::fromStdString(msg.content.name);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.name event: {}", e.what());
-                }
+        std::map<std::string, std::string> pending;
+        {
+                std::lock_guard lock(plaintextMutex_);
+                pending.swap(pendingPlaintext_);
         }
 
-        auto cursor = lmdb::cursor::open(txn, membersdb);
-        std::string user_id, member_data;
+        if (pending.empty())
+                return;
 
-        while (cursor.get(user_id, member_data, MDB_NEXT)) {
-                if (user_id == localUserId_.toStdString())
-                        continue;
+        try {
+                auto txn       = beginTxn();
+                const auto now = static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch());
+                for (const auto &[event_id, sealed] : pending) {
+                        lmdb::dbi_put(
+                          txn, decryptedEventsDb_, lmdb::val(event_id), lmdb::val(sealed));
+                        lmdb::dbi_put(txn,
+                                      decryptedEventsOrderDb_,
+                                      lmdb::val(messageKey(now, event_id)),
+                                      lmdb::val(""));
+                }
 
-                try {
-                        MemberInfo tmp = json::parse(member_data);
+                const auto count = decryptedEventsDb_.size(txn);
+                if (count > MAX_DECRYPTED_EVENTS) {
+                        auto excess =
+                          count - static_cast<uint64_t>(MAX_DECRYPTED_EVENTS *
+                                                        DECRYPTED_EVENTS_LOW_WATERMARK);
+
+                        std::vector<std::string> evicted;
+                        std::string key, value;
+                        auto cursor = lmdb::cursor::open(txn, decryptedEventsOrderDb_);
+                        while (evicted.size() < excess && cursor.get(key, value, MDB_NEXT))
+                                evicted.push_back(key);
                         cursor.close();
 
-                        return QString::fromStdString(tmp.name);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse member info: {}", e.what());
+                        for (const auto &k : evicted) {
+                                lmdb::dbi_del(txn, decryptedEventsOrderDb_, lmdb::val(k), nullptr);
+                                lmdb::dbi_del(txn,
+                                              decryptedEventsDb_,
+                                              lmdb::val(messageKeyEventId(k)),
+                                              nullptr);
+                        }
+
+                        nhlog::db()->debug("evicted {} decrypted events", evicted.size());
                 }
+
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to save the decrypted events: {}", e.what());
         }
+}
 
-        cursor.close();
+std::vector<MessageSearchResult>
+Cache::searchMessages(const QString &query, const std::string &room_id, std::size_t max_results)
+{
+        if (!messageIndex_)
+                return {};
 
-        return QString("Empty Room");
+        try {
+                return messageIndex_->search(query, room_id, max_results);
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to search the messages: {}", e.what());
+                return {};
+        }
 }
 
-QString
-Cache::getInviteRoomAvatarUrl(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb)
+std::optional<mtx::events::collections::TimelineEvents>
+Cache::getFetchedEvent(const std::string &room_id, const std::string &event_id)
 {
-        using namespace mtx::events;
-        using namespace mtx::events::state;
-
-        lmdb::val event;
-        bool res = lmdb::dbi_get(
-          txn, statesdb, lmdb::val(to_string(mtx::events::EventType::RoomAvatar)), event);
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+                auto db  = getFetchedEventsDb(txn, room_id);
 
-        if (res) {
-                try {
-                        StrippedEvent<state::Avatar> msg =
-                          json::parse(std::string(event.data(), event.size()));
-                        return QString::fromStdString(msg.content.url);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.avatar event: {}", e.what());
+                lmdb::val value;
+                if (!lmdb::dbi_get(txn, db, lmdb::val(event_id), value)) {
+                        txn.commit();
+                        return std::nullopt;
                 }
-        }
-
-        auto cursor = lmdb::cursor::open(txn, membersdb);
-        std::string user_id, member_data;
 
-        while (cursor.get(user_id, member_data, MDB_NEXT)) {
-                if (user_id == localUserId_.toStdString())
-                        continue;
+                auto obj = decodeValue(value);
+                txn.commit();
 
-                try {
-                        MemberInfo tmp = json::parse(member_data);
-                        cursor.close();
+                mtx::events::collections::TimelineEvent event;
+                mtx::events::collections::from_json(obj, event);
 
-                        return QString::fromStdString(tmp.avatar_url);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse member info: {}", e.what());
-                }
+                return event.data;
+        } catch (const lmdb::error &e) {
+                // The db only exists after the first event of the room was fetched.
+                nhlog::db()->debug("getFetchedEvent({}, {}): {}", room_id, event_id, e.what());
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse fetched event {}: {}", event_id, e.what());
         }
 
-        cursor.close();
-
-        return QString();
+        return std::nullopt;
 }
 
-QString
-Cache::getInviteRoomTopic(lmdb::txn &txn, lmdb::dbi &db)
+void
+Cache::storeFetchedEvent(const std::string &room_id,
+                         const mtx::events::collections::TimelineEvents &event)
 {
-        using namespace mtx::events;
-        using namespace mtx::events::state;
+        try {
+                auto txn = beginTxn();
+                auto db  = getFetchedEventsDb(txn, room_id);
 
-        lmdb::val event;
-        bool res =
-          lmdb::dbi_get(txn, db, lmdb::val(to_string(mtx::events::EventType::RoomTopic)), event);
+                lmdb::dbi_put(txn,
+                              db,
+                              lmdb::val(utils::event_id(event)),
+                              lmdb::val(encodeValue(utils::serialize_event(event))));
 
-        if (res) {
-                try {
-                        StrippedEvent<Topic> msg =
-                          json::parse(std::string(event.data(), event.size()));
-                        return QString::fromStdString(msg.content.topic);
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.topic event: {}", e.what());
-                }
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to store fetched event {}: {}",
+                                  utils::event_id(event),
+                                  e.what());
         }
-
-        return QString();
 }
 
-QImage
-Cache::getRoomAvatar(const QString &room_id)
+std::vector<mtx::responses::Notification>
+Cache::saveTimelineMentions(const mtx::responses::Notifications &res)
 {
-        return getRoomAvatar(room_id.toStdString());
-}
+        std::vector<mtx::responses::Notification> added;
+        if (res.notifications.empty())
+                return added;
 
-QImage
-Cache::getRoomAvatar(const std::string &room_id)
-{
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        try {
+                auto txn     = beginTxn();
+                auto summary = mentionsSummary(txn);
 
-        lmdb::val response;
+                for (const auto &notif : res.notifications) {
+                        const auto key = messageKey(utils::event_timestamp(notif.event),
+                                                    utils::event_id(notif.event));
 
-        if (!lmdb::dbi_get(txn, roomsDb_, lmdb::val(room_id), response)) {
-                txn.commit();
-                return QImage();
-        }
+                        // The newest notifications are fetched again every time, they are only
+                        // written once.
+                        lmdb::val unused;
+                        if (lmdb::dbi_get(txn, mentionsDb_, lmdb::val(key), unused))
+                                continue;
 
-        std::string media_url;
+                        json obj = notif;
+                        lmdb::dbi_put(
+                          txn, mentionsDb_, lmdb::val(key), lmdb::val(encodeValue(obj)));
 
-        try {
-                RoomInfo info = json::parse(std::string(response.data(), response.size()));
-                media_url     = std::move(info.avatar_url);
+                        const auto room_key = notif.room_id + '\0' + key;
+                        lmdb::dbi_put(txn, roomMentionsDb_, lmdb::val(room_key), lmdb::val(""));
 
-                if (media_url.empty()) {
-                        txn.commit();
-                        return QImage();
+                        summary.total++;
+                        summary.rooms[notif.room_id]++;
+                        added.push_back(notif);
                 }
-        } catch (const json::exception &e) {
-                nhlog::db()->warn("failed to parse room info: {}, {}",
-                                  e.what(),
-                                  std::string(response.data(), response.size()));
-        }
 
-        if (!lmdb::dbi_get(txn, mediaDb_, lmdb::val(media_url), response)) {
+                if (added.empty())
+                        return added;
+
+                lmdb::dbi_put(txn,
+                              syncStateDb_,
+                              MENTIONS_SUMMARY_KEY,
+                              lmdb::val(encodeValue(json(summary))));
                 txn.commit();
-                return QImage();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to store the mentions: {}", e.what());
+                added.clear();
         }
 
-        txn.commit();
-
-        return QImage::fromData(QByteArray(response.data(), response.size()));
+        return added;
 }
 
-std::vector<std::string>
-Cache::joinedRooms()
+MentionsSummary
+Cache::mentionsSummary(lmdb::txn &txn)
 {
-        auto txn         = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        auto roomsCursor = lmdb::cursor::open(txn, roomsDb_);
-
-        std::string id, data;
-        std::vector<std::string> room_ids;
-
-        // Gather the room ids for the joined rooms.
-        while (roomsCursor.get(id, data, MDB_NEXT))
-                room_ids.emplace_back(id);
-
-        roomsCursor.close();
-        txn.commit();
+        lmdb::val data;
+        if (!lmdb::dbi_get(txn, syncStateDb_, MENTIONS_SUMMARY_KEY, data))
+                return {};
 
-        return room_ids;
+        try {
+                return decodeValue(data).get<MentionsSummary>();
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse the mentions summary: {}", e.what());
+                return {};
+        }
 }
 
-void
-Cache::populateMembers()
+MentionsSummary
+Cache::mentionsSummary()
 {
-        auto rooms = joinedRooms();
-        nhlog::db()->info("loading {} rooms", rooms.size());
-
-        auto txn = lmdb::txn::begin(env_);
+        try {
+                auto txn     = beginTxn(MDB_RDONLY);
+                auto summary = mentionsSummary(txn);
+                txn.commit();
+                return summary;
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the mentions summary: {}", e.what());
+                return {};
+        }
+}
 
-        for (const auto &room : rooms) {
-                const auto roomid = QString::fromStdString(room);
+std::vector<std::string>
+Cache::updateSentNotifications(const std::vector<std::string> &unread,
+                               const std::vector<std::string> &read)
+{
+        std::vector<std::string> unsent;
 
-                auto membersdb = getMembersDb(txn, room);
-                auto cursor    = lmdb::cursor::open(txn, membersdb);
+        if (unread.empty() && read.empty())
+                return unsent;
 
-                std::string user_id, info;
-                while (cursor.get(user_id, info, MDB_NEXT)) {
-                        MemberInfo m = json::parse(info);
+        auto txn = beginTxn();
 
-                        const auto userid = QString::fromStdString(user_id);
+        for (const auto &event_id : read)
+                lmdb::dbi_del(txn, notificationsDb_, lmdb::val(event_id), nullptr);
 
-                        insertDisplayName(roomid, userid, QString::fromStdString(m.name));
-                        insertAvatarUrl(roomid, userid, QString::fromStdString(m.avatar_url));
-                }
+        for (const auto &event_id : unread) {
+                lmdb::val value;
+                if (lmdb::dbi_get(txn, notificationsDb_, lmdb::val(event_id), value))
+                        continue;
 
-                cursor.close();
+                // We should only send one notification per event.
+                lmdb::dbi_put(
+                  txn, notificationsDb_, lmdb::val(event_id), lmdb::val(std::string("")));
+                unsent.push_back(event_id);
         }
 
         txn.commit();
+
+        return unsent;
 }
 
-std::vector<RoomSearchResult>
-Cache::searchRooms(const std::string &query, std::uint8_t max_items)
+std::vector<std::string>
+Cache::getRoomIds(lmdb::txn &txn)
 {
-        std::multimap<int, std::pair<std::string, RoomInfo>> items;
-
-        auto txn    = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        auto cursor = lmdb::cursor::open(txn, roomsDb_);
+        auto db     = lmdb::dbi::open(txn, ROOMS_DB, MDB_CREATE);
+        auto cursor = lmdb::cursor::open(txn, db);
 
-        std::string room_id, room_data;
-        while (cursor.get(room_id, room_data, MDB_NEXT)) {
-                RoomInfo tmp = json::parse(std::move(room_data));
+        std::vector<std::string> rooms;
 
-                const int score = utils::levenshtein_distance(
-                  query, QString::fromStdString(tmp.name).toLower().toStdString());
-                items.emplace(score, std::make_pair(room_id, tmp));
-        }
+        lmdb::val room_id, unused;
+        while (cursor.get(room_id, unused, MDB_NEXT))
+                rooms.emplace_back(view(room_id));
 
         cursor.close();
 
-        auto end = items.begin();
+        return rooms;
+}
 
-        if (items.size() >= max_items)
-                std::advance(end, max_items);
-        else if (items.size() > 0)
-                std::advance(end, items.size());
+void
+Cache::deleteOldMessages()
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("deleteOldMessages"));
 
-        std::vector<RoomSearchResult> results;
-        for (auto it = items.begin(); it != end; it++) {
-                results.push_back(RoomSearchResult{it->second.first, it->second.second});
-        }
+        while (trimMessages(std::chrono::steady_clock::time_point::max()))
+                ;
+}
 
-        txn.commit();
+bool
+Cache::compactMessages(std::chrono::steady_clock::time_point deadline)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("compactMessages"));
 
-        return results;
+        return trimMessages(deadline);
 }
 
-std::vector<SearchResult>
-Cache::searchUsers(const std::string &room_id, const std::string &query, std::uint8_t max_items)
+bool
+Cache::trimMessages(std::chrono::steady_clock::time_point deadline)
 {
-        std::multimap<int, std::pair<std::string, std::string>> items;
+        std::lock_guard<std::mutex> lock(compactionMutex_);
 
-        auto txn    = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        auto cursor = lmdb::cursor::open(txn, getMembersDb(txn, room_id));
+        const auto start = std::chrono::steady_clock::now();
 
-        std::string user_id, user_data;
-        while (cursor.get(user_id, user_data, MDB_NEXT)) {
-                const auto display_name = displayName(room_id, user_id);
-                const int score         = utils::levenshtein_distance(query, display_name);
+        // Keep trimming the room of the last call, even if it already dropped below the
+        // threshold, otherwise we would stop halfway through it.
+        std::string room_id;
+        std::size_t excess = 0;
+        {
+                auto txn = beginTxn(MDB_RDONLY);
 
-                items.emplace(score, std::make_pair(user_id, display_name));
-        }
+                for (const auto &id : getRoomIds(txn)) {
+                        std::size_t db_size = 0;
+
+                        try {
+                                db_size = getMessagesDb(txn, id).size(txn);
+                        } catch (const lmdb::error &) {
+                                // The room didn't save any messages yet.
+                                continue;
+                        }
 
-        auto end = items.begin();
+                        if (db_size <= MAX_RESTORED_MESSAGES)
+                                continue;
 
-        if (items.size() >= max_items)
-                std::advance(end, max_items);
-        else if (items.size() > 0)
-                std::advance(end, items.size());
+                        const auto room_excess = db_size - MAX_RESTORED_MESSAGES;
 
-        std::vector<SearchResult> results;
-        for (auto it = items.begin(); it != end; it++) {
-                const auto user = it->second;
-                results.push_back(SearchResult{QString::fromStdString(user.first),
-                                               QString::fromStdString(user.second)});
+                        if (id == compactionRoom_) {
+                                room_id = id;
+                                excess  = room_excess;
+                                break;
+                        }
+
+                        if (db_size > 3 * MAX_RESTORED_MESSAGES && room_excess > excess) {
+                                room_id = id;
+                                excess  = room_excess;
+                        }
+                }
+
+                txn.commit();
         }
 
-        return results;
-}
+        if (excess == 0) {
+                compactionRoom_.clear();
+                return false;
+        }
 
-std::vector<RoomMember>
-Cache::getMembers(const std::string &room_id, std::size_t startIndex, std::size_t len)
-{
-        auto txn    = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
-        auto db     = getMembersDb(txn, room_id);
-        auto cursor = lmdb::cursor::open(txn, db);
+        compactionRoom_ = room_id;
 
-        std::size_t currentIndex = 0;
+        std::size_t deleted = 0;
 
-        const auto endIndex = std::min(startIndex + len, db.size(txn));
+        do {
+                auto txn      = beginTxn();
+                auto msg_db   = getMessagesDb(txn, room_id);
+                auto eventsDb = getEventIndexDb(txn, room_id);
 
-        std::vector<RoomMember> members;
+                std::string key, event;
 
-        std::string user_id, user_data;
-        while (cursor.get(user_id, user_data, MDB_NEXT)) {
-                if (currentIndex < startIndex) {
-                        currentIndex += 1;
-                        continue;
+                // The oldest messages come first.
+                std::size_t chunk = 0;
+                auto cursor       = lmdb::cursor::open(txn, msg_db);
+                while (deleted + chunk < excess && chunk < COMPACTION_CHUNK_SIZE &&
+                       cursor.get(key, event, MDB_NEXT)) {
+                        const auto event_id = messageKeyEventId(key);
+                        if (!event_id.empty())
+                                lmdb::dbi_del(txn, eventsDb, lmdb::val(event_id), nullptr);
+
+                        lmdb::cursor_del(cursor);
+                        chunk += 1;
                 }
+                cursor.close();
 
-                if (currentIndex >= endIndex)
-                        break;
+                txn.commit();
 
-                try {
-                        MemberInfo tmp = json::parse(user_data);
-                        members.emplace_back(
-                          RoomMember{QString::fromStdString(user_id),
-                                     QString::fromStdString(tmp.name),
-                                     QImage::fromData(image(txn, tmp.avatar_url))});
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("{}", e.what());
-                }
+                deleted += chunk;
 
-                currentIndex += 1;
-        }
+                if (chunk == 0)
+                        break;
+        } while (deleted < excess && std::chrono::steady_clock::now() < deadline);
 
-        cursor.close();
-        txn.commit();
+        if (deleted >= excess)
+                compactionRoom_.clear();
 
-        return members;
+        nhlog::db()->info("[{}] compacted {} of {} old messages in {}ms",
+                          room_id,
+                          deleted,
+                          excess,
+                          std::chrono::duration_cast<std::chrono::milliseconds>(
+                            std::chrono::steady_clock::now() - start)
+                            .count());
+
+        return true;
 }
 
-bool
-Cache::isRoomMember(const std::string &user_id, const std::string &room_id)
+thread_local int MapUse::depth_ = 0;
+
+std::optional<MDB_dbi>
+DbiRegistry::find(const std::string &name)
 {
-        auto txn = lmdb::txn::begin(env_);
-        auto db  = getMembersDb(txn, room_id);
+        std::unique_lock<std::mutex> lock(mutex_);
 
-        lmdb::val value;
-        bool res = lmdb::dbi_get(txn, db, lmdb::val(user_id), value);
-        txn.commit();
+        auto it = handles_.find(name);
+        if (it == handles_.end())
+                return std::nullopt;
 
-        return res;
+        return it->second;
 }
 
 void
-Cache::saveTimelineMessages(lmdb::txn &txn,
-                            const std::string &room_id,
-                            const mtx::responses::Timeline &res)
+DbiRegistry::opened(MDB_txn *txn, const std::string &name, MDB_dbi dbi)
 {
-        auto db = getMessagesDb(txn, room_id);
-
-        using namespace mtx::events;
-        using namespace mtx::events::state;
+        std::unique_lock<std::mutex> lock(mutex_);
+        pending_[txn].emplace_back(name, dbi);
+}
 
-        for (const auto &e : res.events) {
-                if (std::holds_alternative<RedactionEvent<msg::Redaction>>(e))
-                        continue;
+void
+DbiRegistry::dropped(MDB_txn *txn, const std::string &name)
+{
+        std::unique_lock<std::mutex> lock(mutex_);
+        pending_[txn].emplace_back(name, std::nullopt);
+}
 
-                json obj = json::object();
+void
+DbiRegistry::finished(MDB_txn *txn, bool committed)
+{
+        std::unique_lock<std::mutex> lock(mutex_);
 
-                obj["event"] = utils::serialize_event(e);
-                obj["token"] = res.prev_batch;
+        auto it = pending_.find(txn);
+        if (it == pending_.end())
+                return;
 
-                lmdb::dbi_put(txn,
-                              db,
-                              lmdb::val(std::to_string(utils::event_timestamp(e))),
-                              lmdb::val(obj.dump()));
+        // LMDB closes the handles opened by an aborted transaction.
+        if (committed) {
+                for (const auto &[name, dbi] : it->second) {
+                        if (dbi)
+                                handles_[name] = *dbi;
+                        else
+                                handles_.erase(name);
+                }
         }
+
+        pending_.erase(it);
 }
 
-mtx::responses::Notifications
-Cache::getTimelineMentionsForRoom(lmdb::txn &txn, const std::string &room_id)
+bool
+DbiRegistry::opens(MDB_txn *txn)
 {
-        auto db = getMentionsDb(txn, room_id);
+        std::unique_lock<std::mutex> lock(mutex_);
+        return pending_.count(txn) > 0;
+}
 
-        if (db.size(txn) == 0) {
-                return mtx::responses::Notifications{};
+MDB_txn *
+ReaderPool::acquire(MDB_env *env)
+{
+        MDB_txn *txn = nullptr;
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+                if (!txns_.empty()) {
+                        txn = txns_.back();
+                        txns_.pop_back();
+                }
         }
 
-        mtx::responses::Notifications notif;
-        std::string event_id, msg;
-
-        auto cursor = lmdb::cursor::open(txn, db);
+        if (txn) {
+                if (mdb_txn_renew(txn) == MDB_SUCCESS)
+                        return txn;
 
-        while (cursor.get(event_id, msg, MDB_NEXT)) {
-                auto obj = json::parse(msg);
+                mdb_txn_abort(txn);
+        }
 
-                if (obj.count("event") == 0)
-                        continue;
+        lmdb::txn_begin(env, nullptr, MDB_RDONLY, &txn);
+        return txn;
+}
 
-                mtx::responses::Notification notification;
-                mtx::responses::from_json(obj, notification);
+void
+ReaderPool::release(MDB_txn *txn)
+{
+        mdb_txn_reset(txn);
 
-                notif.notifications.push_back(notification);
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (txns_.size() < MAX_POOLED) {
+                txns_.push_back(txn);
+                return;
         }
-        cursor.close();
 
-        std::reverse(notif.notifications.begin(), notif.notifications.end());
-
-        return notif;
+        mdb_txn_abort(txn);
 }
 
-//! Add all notifications containing a user mention to the db.
 void
-Cache::saveTimelineMentions(const mtx::responses::Notifications &res)
+ReaderPool::clear()
 {
-        QMap<std::string, QList<mtx::responses::Notification>> notifsByRoom;
-
-        // Sort into room-specific 'buckets'
-        for (const auto &notif : res.notifications) {
-                json val = notif;
-                notifsByRoom[notif.room_id].push_back(notif);
-        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        for (auto txn : txns_)
+                mdb_txn_abort(txn);
+        txns_.clear();
+}
 
-        auto txn = lmdb::txn::begin(env_);
-        // Insert the entire set of mentions for each room at a time.
-        QMap<std::string, QList<mtx::responses::Notification>>::const_iterator it =
-          notifsByRoom.constBegin();
-        auto end = notifsByRoom.constEnd();
-        while (it != end) {
-                nhlog::db()->debug("Storing notifications for " + it.key());
-                saveTimelineMentions(txn, it.key(), std::move(it.value()));
-                ++it;
-        }
+MapUse::MapUse(std::shared_mutex &mutex)
+  : mutex_(mutex)
+{
+        if (depth_++ == 0)
+                mutex_.lock_shared();
+}
 
-        txn.commit();
+MapUse::~MapUse()
+{
+        if (--depth_ == 0)
+                mutex_.unlock_shared();
 }
 
 void
-Cache::saveTimelineMentions(lmdb::txn &txn,
-                            const std::string &room_id,
-                            const QList<mtx::responses::Notification> &res)
+Cache::setDurability(const QString &mode)
 {
-        auto db = getMentionsDb(txn, room_id);
-
-        using namespace mtx::events;
-        using namespace mtx::events::state;
+        const auto flags = durabilityFlags(mode);
 
-        for (const auto &notif : res) {
-                const auto event_id = utils::event_id(notif.event);
+        // Commits before the change get the durability of the new mode too.
+        flushToDisk();
 
-                // double check that we have the correct room_id...
-                if (room_id.compare(notif.room_id) != 0) {
-                        return;
-                }
+        mdb_env_set_flags(env_.handle(), MDB_NOMETASYNC | MDB_NOSYNC, 0);
+        if (flags)
+                mdb_env_set_flags(env_.handle(), flags, 1);
 
-                json obj = notif;
+        relaxedDurability_ = flags != 0;
 
-                lmdb::dbi_put(txn, db, lmdb::val(event_id), lmdb::val(obj.dump()));
-        }
+        nhlog::db()->info("cache durability: {}", mode.toStdString());
 }
 
 void
-Cache::markSentNotification(const std::string &event_id)
+Cache::flushToDisk()
 {
-        auto txn = lmdb::txn::begin(env_);
-        lmdb::dbi_put(txn, notificationsDb_, lmdb::val(event_id), lmdb::val(std::string("")));
-        txn.commit();
+        if (!relaxedDurability_)
+                return;
+
+        MapUse use(mapMutex_);
+        if (int err = mdb_env_sync(env_.handle(), 1); err != MDB_SUCCESS)
+                nhlog::db()->warn("failed to sync the cache to disk: {}", mdb_strerror(err));
 }
 
-void
-Cache::removeReadNotification(const std::string &event_id)
+MapSizeInfo
+Cache::mapSizeInfo()
 {
-        auto txn = lmdb::txn::begin(env_);
+        return mapSizeInfo(env_);
+}
 
-        lmdb::dbi_del(txn, notificationsDb_, lmdb::val(event_id), nullptr);
+MapSizeInfo
+Cache::mapSizeInfo(lmdb::env &env)
+{
+        MDB_envinfo info;
+        MDB_stat stat;
+        mdb_env_info(env.handle(), &info);
+        mdb_env_stat(env.handle(), &stat);
 
-        txn.commit();
+        return MapSizeInfo{info.me_mapsize, (info.me_last_pgno + 1) * stat.ms_psize};
 }
 
-bool
-Cache::isNotificationSent(const std::string &event_id)
+std::size_t
+Cache::residentMapSize()
 {
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        // Only Linux tells, which pages of a mapping are resident. The pages read recently stay,
+        // until the system needs the memory, so this is mostly the working set of the reads.
+        QFile smaps("/proc/self/smaps");
+        if (!smaps.open(QIODevice::ReadOnly | QIODevice::Text))
+                return 0;
 
-        lmdb::val value;
-        bool res = lmdb::dbi_get(txn, notificationsDb_, lmdb::val(event_id), value);
-        txn.commit();
+        const auto directory = cacheDirectory_.toUtf8();
 
-        return res;
+        std::size_t resident = 0;
+        bool inMap           = false;
+        for (auto line = smaps.readLine(); !line.isEmpty(); line = smaps.readLine()) {
+                const auto name = line.left(line.indexOf(' '));
+
+                // A mapping starts with its address range, its fields start with their name.
+                if (!name.endsWith(':')) {
+                        line  = line.trimmed();
+                        inMap = line.contains(directory) && line.endsWith("/data.mdb");
+                } else if (inMap && name == "Rss:") {
+                        resident += line.mid(4).trimmed().split(' ').front().toULongLong() * 1024;
+                }
+        }
+
+        return resident;
 }
 
-std::vector<std::string>
-Cache::getRoomIds(lmdb::txn &txn)
+CacheStats
+Cache::stats()
 {
-        auto db     = lmdb::dbi::open(txn, ROOMS_DB, MDB_CREATE);
-        auto cursor = lmdb::cursor::open(txn, db);
+        CacheStats stats;
 
-        std::vector<std::string> rooms;
+        std::map<std::string, DbStats> groups;
+        auto collect = [&groups](lmdb::txn &txn) {
+                // The keys of the main db are the names of all other dbs.
+                auto mainDb = lmdb::dbi::open(txn, nullptr);
+                auto cursor = lmdb::cursor::open(txn, mainDb);
 
-        std::string room_id, _unused;
-        while (cursor.get(room_id, _unused, MDB_NEXT))
-                rooms.emplace_back(room_id);
+                lmdb::val key, unused;
+                while (cursor.get(key, unused, MDB_NEXT)) {
+                        const std::string name(view(key));
 
-        cursor.close();
+                        // Group the dbs of each room and device by their kind.
+                        std::string group = name;
+                        if (name.rfind("olm_sessions/", 0) == 0)
+                                group = "olm_sessions";
+                        else if (auto slash = name.rfind('/'); slash != std::string::npos)
+                                group = "room" + name.substr(slash);
 
-        return rooms;
+                        MDB_stat stat;
+                        try {
+                                auto db = lmdb::dbi::open(txn, name.c_str());
+                                mdb_stat(txn, db.handle(), &stat);
+                        } catch (const lmdb::error &e) {
+                                nhlog::db()->warn("failed to read the db {}: {}", name, e.what());
+                                continue;
+                        }
+
+                        auto &entry = groups[group];
+                        entry.name  = group;
+                        entry.databases += 1;
+                        entry.entries += stat.ms_entries;
+                        entry.bytes += (stat.ms_branch_pages + stat.ms_leaf_pages +
+                                        stat.ms_overflow_pages) *
+                                       stat.ms_psize;
+                }
+
+                cursor.close();
+        };
+
+        {
+                auto txn = beginTxn(MDB_RDONLY);
+                collect(txn);
+                txn.commit();
+        }
+        {
+                auto txn = beginCryptoTxn(MDB_RDONLY);
+                collect(txn);
+                txn.commit();
+        }
+
+        for (auto &group : groups)
+                stats.databases.push_back(std::move(group.second));
+
+        stats.latencies        = cache::latencies();
+        stats.counts           = cache::counts();
+        stats.map              = mapSizeInfo();
+        stats.media_files_size = mediaSize_;
+        stats.megolm_sessions  = inboundMegolmSessionStats();
+
+        return stats;
 }
 
-void
-Cache::deleteOldMessages()
+bool
+Cache::growMapSize()
 {
-        auto txn      = lmdb::txn::begin(env_);
-        auto room_ids = getRoomIds(txn);
+        if (MapUse::active()) {
+                nhlog::db()->warn("can't resize the map during a transaction");
+                return false;
+        }
 
-        for (const auto &id : room_ids) {
-                auto msg_db = getMessagesDb(txn, id);
+        // Waits for the transactions of the other threads, since LMDB remaps the file.
+        std::unique_lock lock(mapMutex_);
+        readers_.clear();
 
-                std::string ts, event;
-                uint64_t idx = 0;
+        const auto sizes = mapSizeInfo();
+        if (sizes.map_size >= MAX_DB_SIZE) {
+                nhlog::db()->warn("the map has reached its maximum size of {} bytes",
+                                  sizes.map_size);
+                return false;
+        }
 
-                const auto db_size = msg_db.size(txn);
-                if (db_size <= 3 * MAX_RESTORED_MESSAGES)
-                        continue;
+        const auto size = std::min(sizes.map_size * 2, MAX_DB_SIZE);
+        env_.set_mapsize(size);
 
-                nhlog::db()->info("[{}] message count: {}", id, db_size);
+        nhlog::db()->info(
+          "resized the map from {} to {} bytes, {} used", sizes.map_size, size, sizes.used_size);
 
-                auto cursor = lmdb::cursor::open(txn, msg_db);
-                while (cursor.get(ts, event, MDB_NEXT)) {
-                        idx += 1;
+        return true;
+}
 
-                        if (idx > MAX_RESTORED_MESSAGES)
-                                lmdb::cursor_del(cursor);
-                }
+bool
+Cache::growCryptoMapSize()
+{
+        if (MapUse::active()) {
+                nhlog::db()->warn("can't resize the crypto map during a transaction");
+                return false;
+        }
 
-                cursor.close();
+        std::unique_lock lock(cryptoMapMutex_);
+        cryptoReaders_.clear();
 
-                nhlog::db()->info("[{}] updated message count: {}", id, msg_db.size(txn));
+        const auto sizes = mapSizeInfo(cryptoEnv_);
+        if (sizes.map_size >= MAX_CRYPTO_DB_SIZE) {
+                nhlog::db()->warn("the crypto map has reached its maximum size of {} bytes",
+                                  sizes.map_size);
+                return false;
         }
 
-        txn.commit();
+        const auto size = std::min(sizes.map_size * 2, MAX_CRYPTO_DB_SIZE);
+        cryptoEnv_.set_mapsize(size);
+
+        nhlog::db()->info("resized the crypto map from {} to {} bytes, {} used",
+                          sizes.map_size,
+                          size,
+                          sizes.used_size);
+
+        return true;
+}
+
+void
+Cache::writeCrypto(const std::function<void(lmdb::txn &)> &write)
+{
+        try {
+                auto txn = beginCryptoTxn();
+                write(txn);
+                txn.commit();
+        } catch (const lmdb::map_full_error &e) {
+                // The failed transaction was aborted, so it is simply retried in the larger map.
+                nhlog::db()->warn("the crypto db is full: {}", e.what());
+                if (!growCryptoMapSize())
+                        throw;
+
+                auto txn = beginCryptoTxn();
+                write(txn);
+                txn.commit();
+        }
 }
 
 void
@@ -2169,50 +6951,109 @@ Cache::hasEnoughPowerLevel(const std::vector<mtx::events::EventType> &eventTypes
         using namespace mtx::events;
         using namespace mtx::events::state;
 
-        auto txn = lmdb::txn::begin(env_);
-        auto db  = getStatesDb(txn, room_id);
-
         uint16_t min_event_level = std::numeric_limits<uint16_t>::max();
         uint16_t user_level      = std::numeric_limits<uint16_t>::min();
 
-        lmdb::val event;
-        bool res = lmdb::dbi_get(txn, db, lmdb::val(to_string(EventType::RoomPowerLevels)), event);
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
 
-        if (res) {
-                try {
-                        StateEvent<PowerLevels> msg =
-                          json::parse(std::string(event.data(), event.size()));
+                std::lock_guard lock(powerLevelsMutex_);
+                const auto cached = parsedPowerLevels(txn, room_id);
+                txn.commit();
 
-                        user_level = msg.content.user_level(user_id);
+                if (!cached)
+                        return false;
 
-                        for (const auto &ty : eventTypes)
-                                min_event_level =
-                                  std::min(min_event_level,
-                                           (uint16_t)msg.content.state_level(to_string(ty)));
-                } catch (const json::exception &e) {
-                        nhlog::db()->warn("failed to parse m.room.power_levels event: {}",
-                                          e.what());
-                }
-        }
+                const auto &levels = cached->levels;
 
-        txn.commit();
+                user_level = levels.user_level(user_id);
+
+                for (const auto &ty : eventTypes)
+                        min_event_level = std::min(min_event_level,
+                                                   (uint16_t)levels.state_level(to_string(ty)));
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse m.room.power_levels event: {}", e.what());
+        } catch (const lmdb::error &e) {
+                // The room has no state yet.
+                nhlog::db()->warn("failed to read the power levels of {}: {}", room_id, e.what());
+        }
 
         return user_level >= min_event_level;
 }
 
+std::optional<NotificationLevels>
+Cache::notificationLevels(const std::string &room_id)
+{
+        try {
+                auto txn = beginTxn(MDB_RDONLY);
+
+                std::lock_guard lock(powerLevelsMutex_);
+                const auto cached = parsedPowerLevels(txn, room_id);
+                txn.commit();
+
+                if (cached)
+                        return NotificationLevels{cached->levels, cached->notifyRoom};
+        } catch (const json::exception &e) {
+                nhlog::db()->warn("failed to parse m.room.power_levels event: {}", e.what());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the power levels of {}: {}", room_id, e.what());
+        }
+
+        return std::nullopt;
+}
+
+const Cache::ParsedPowerLevels *
+Cache::parsedPowerLevels(lmdb::txn &txn, const std::string &room_id)
+{
+        using namespace mtx::events;
+        using namespace mtx::events::state;
+
+        auto db = getStatesDb(txn, room_id);
+
+        lmdb::val event;
+        if (!lmdb::dbi_get(txn, db, lmdb::val(to_string(EventType::RoomPowerLevels)), event))
+                return nullptr;
+
+        // The stored event is compared in place, only changed power levels are parsed.
+        auto cached = powerLevels_.find(room_id);
+        if (cached == powerLevels_.end() ||
+            std::string_view(cached->second.event) !=
+              std::string_view(event.data(), event.size())) {
+                std::string data(event.data(), event.size());
+                const auto obj              = json::parse(data);
+                StateEvent<PowerLevels> msg = obj;
+
+                int64_t notifyRoom = 50;
+                const auto content = obj.find("content");
+                if (content != obj.end() && content->contains("notifications")) {
+                        const auto &notifications = content->at("notifications");
+                        if (notifications.is_object() && notifications.contains("room") &&
+                            notifications.at("room").is_number_integer())
+                                notifyRoom = notifications.at("room").get<int64_t>();
+                }
+
+                cached                    = powerLevels_.try_emplace(room_id).first;
+                cached->second.event      = std::move(data);
+                cached->second.levels     = std::move(msg.content);
+                cached->second.notifyRoom = notifyRoom;
+        }
+
+        return &cached->second;
+}
+
 std::vector<std::string>
 Cache::roomMembers(const std::string &room_id)
 {
-        auto txn = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        auto txn = beginTxn(MDB_RDONLY);
 
         std::vector<std::string> members;
-        std::string user_id, unused;
+        lmdb::val user_id, unused;
 
         auto db = getMembersDb(txn, room_id);
 
         auto cursor = lmdb::cursor::open(txn, db);
         while (cursor.get(user_id, unused, MDB_NEXT))
-                members.emplace_back(std::move(user_id));
+                members.emplace_back(view(user_id));
         cursor.close();
 
         txn.commit();
@@ -2220,15 +7061,80 @@ Cache::roomMembers(const std::string &room_id)
         return members;
 }
 
-QHash<QString, QString> Cache::DisplayNames;
-QHash<QString, QString> Cache::AvatarUrls;
+std::map<std::string, SearchIndex> Cache::MemberSearchIndex;
+std::shared_mutex Cache::MemberSearchMutex;
+
+std::optional<MemberCache::Member>
+Cache::member(const QString &room_id, const QString &user_id)
+{
+        std::optional<MemberCache::Member> member;
+
+        if (!members_.find(room_id, user_id, member)) {
+                loadMembers(room_id);
+                members_.find(room_id, user_id, member);
+        }
+
+        return member;
+}
+
+void
+Cache::loadMembers(const QString &room_id)
+{
+        std::optional<MemberCache::Member> unused;
+        if (members_.find(room_id, QString(), unused))
+                return;
+
+        // LMDB allows only one transaction per thread.
+        if (MapUse::active()) {
+                nhlog::db()->warn("can't load the members of {} during a transaction",
+                                  room_id.toStdString());
+                return;
+        }
+
+        cache::LatencyTimer timer(NHEKO_METRIC("loadMembers"));
+
+        std::vector<std::pair<QString, MemberCache::Member>> members;
+
+        try {
+                auto txn    = beginTxn(MDB_RDONLY);
+                auto cursor = lmdb::cursor::open(txn, getMembersDb(txn, room_id.toStdString()));
+
+                lmdb::val user_id, data;
+                while (cursor.get(user_id, data, MDB_NEXT)) {
+                        try {
+                                MemberInfo info = decodeValue(data);
+
+                                MemberCache::Member member;
+                                if (info.name != view(user_id))
+                                        member.name = QString::fromStdString(info.name);
+                                member.avatarUrl = QString::fromStdString(info.avatar_url);
+
+                                members.emplace_back(
+                                  QString::fromUtf8(user_id.data(), (int)user_id.size()),
+                                  std::move(member));
+                        } catch (const json::exception &e) {
+                                nhlog::db()->warn("failed to parse member info: {}", e.what());
+                        }
+                }
+
+                cursor.close();
+                txn.commit();
+        } catch (const lmdb::error &e) {
+                // The room is kept without members, so it isn't read again on every lookup.
+                nhlog::db()->warn(
+                  "failed to load the members of {}: {}", room_id.toStdString(), e.what());
+        }
+
+        cache::recordCount(NHEKO_METRIC("loadMembers members"), members.size());
+        members_.load(room_id, std::move(members));
+}
 
 QString
 Cache::displayName(const QString &room_id, const QString &user_id)
 {
-        auto fmt = QString("%1 %2").arg(room_id).arg(user_id);
-        if (DisplayNames.contains(fmt))
-                return DisplayNames[fmt];
+        const auto m = member(room_id, user_id);
+        if (m && !m->name.isEmpty())
+                return m->name;
 
         return user_id;
 }
@@ -2236,9 +7142,9 @@ Cache::displayName(const QString &room_id, const QString &user_id)
 std::string
 Cache::displayName(const std::string &room_id, const std::string &user_id)
 {
-        auto fmt = QString::fromStdString(room_id + " " + user_id);
-        if (DisplayNames.contains(fmt))
-                return DisplayNames[fmt].toStdString();
+        const auto m = member(QString::fromStdString(room_id), QString::fromStdString(user_id));
+        if (m && !m->name.isEmpty())
+                return m->name.toStdString();
 
         return user_id;
 }
@@ -2246,91 +7152,207 @@ Cache::displayName(const std::string &room_id, const std::string &user_id)
 QString
 Cache::avatarUrl(const QString &room_id, const QString &user_id)
 {
-        auto fmt = QString("%1 %2").arg(room_id).arg(user_id);
-        if (AvatarUrls.contains(fmt))
-                return AvatarUrls[fmt];
+        const auto m = member(room_id, user_id);
+        if (m)
+                return m->avatarUrl;
 
         return QString();
 }
 
 void
-Cache::insertDisplayName(const QString &room_id,
-                         const QString &user_id,
-                         const QString &display_name)
+Cache::insertMember(const QString &room_id,
+                    const QString &user_id,
+                    const QString &display_name,
+                    const QString &avatar_url)
+{
+        MemberCache::Member member;
+        if (display_name != user_id)
+                member.name = display_name;
+        member.avatarUrl = avatar_url;
+        members_.insert(room_id, user_id, std::move(member));
+
+        std::unique_lock lock(MemberSearchMutex);
+
+        auto it = MemberSearchIndex.find(room_id.toStdString());
+        if (it != MemberSearchIndex.end())
+                it->second.insert(user_id.toStdString(),
+                                  display_name.isEmpty() ? user_id : display_name);
+}
+
+void
+Cache::removeMember(const QString &room_id, const QString &user_id)
+{
+        members_.remove(room_id, user_id);
+
+        std::unique_lock lock(MemberSearchMutex);
+
+        auto it = MemberSearchIndex.find(room_id.toStdString());
+        if (it != MemberSearchIndex.end())
+                it->second.remove(user_id.toStdString());
+}
+
+void
+to_json(json &j, const RoomInfo &info)
+{
+        j["name"]         = info.name;
+        j["topic"]        = info.topic;
+        j["avatar_url"]   = info.avatar_url;
+        j["version"]      = info.version;
+        j["is_invite"]    = info.is_invite;
+        j["join_rule"]    = info.join_rule;
+        j["guest_access"] = info.guest_access;
+
+        if (info.member_count != 0)
+                j["member_count"] = info.member_count;
+
+        if (info.tags.size() != 0)
+                j["tags"] = info.tags;
+}
+
+void
+from_json(const json &j, RoomInfo &info)
+{
+        info.name       = j.at("name");
+        info.topic      = j.at("topic");
+        info.avatar_url = j.at("avatar_url");
+        info.version    = j.value(
+          "version", QCoreApplication::translate("RoomInfo", "no version stored").toStdString());
+        info.is_invite    = j.at("is_invite");
+        info.join_rule    = j.at("join_rule");
+        info.guest_access = j.at("guest_access");
+
+        if (j.count("member_count"))
+                info.member_count = j.at("member_count");
+
+        if (j.count("tags"))
+                info.tags = j.at("tags").get<std::vector<std::string>>();
+}
+
+void
+TagChanges::tag(const std::string &tag, const std::string &room_id)
+{
+        if (auto rooms = removed.find(tag); rooms != removed.end()) {
+                rooms->second.erase(room_id);
+                if (rooms->second.empty())
+                        removed.erase(rooms);
+        }
+
+        added[tag].insert(room_id);
+}
+
+void
+TagChanges::untag(const std::string &tag, const std::string &room_id)
+{
+        if (auto rooms = added.find(tag); rooms != added.end()) {
+                rooms->second.erase(room_id);
+                if (rooms->second.empty())
+                        added.erase(rooms);
+        }
+
+        removed[tag].insert(room_id);
+}
+
+void
+TagChanges::merge(const TagChanges &newer)
 {
-        auto fmt = QString("%1 %2").arg(room_id).arg(user_id);
-        DisplayNames.insert(fmt, display_name);
+        for (const auto &[tag, rooms] : newer.added)
+                for (const auto &room_id : rooms)
+                        this->tag(tag, room_id);
+
+        for (const auto &[tag, rooms] : newer.removed)
+                for (const auto &room_id : rooms)
+                        untag(tag, room_id);
+}
+
+void
+to_json(json &j, const RoomSummary &summary)
+{
+        j = json::object();
+
+        if (summary.heroes)
+                j["m.heroes"] = *summary.heroes;
+        if (summary.joined_member_count)
+                j["m.joined_member_count"] = *summary.joined_member_count;
+        if (summary.invited_member_count)
+                j["m.invited_member_count"] = *summary.invited_member_count;
+}
+
+void
+from_json(const json &j, RoomSummary &summary)
+{
+        if (auto heroes = j.find("m.heroes"); heroes != j.end())
+                summary.heroes = heroes->get<std::vector<std::string>>();
+        if (auto joined = j.find("m.joined_member_count"); joined != j.end())
+                summary.joined_member_count = joined->get<int>();
+        if (auto invited = j.find("m.invited_member_count"); invited != j.end())
+                summary.invited_member_count = invited->get<int>();
 }
 
 void
-Cache::removeDisplayName(const QString &room_id, const QString &user_id)
+from_json(const json &j, SyncResponse &res)
 {
-        auto fmt = QString("%1 %2").arg(room_id).arg(user_id);
-        DisplayNames.remove(fmt);
+        res.sync = j.get<mtx::responses::Sync>();
+
+        const auto rooms = j.find("rooms");
+        if (rooms == j.end() || !rooms->is_object())
+                return;
+
+        const auto join = rooms->find("join");
+        if (join == rooms->end() || !join->is_object())
+                return;
+
+        for (auto room = join->begin(); room != join->end(); ++room) {
+                if (!room->is_object())
+                        continue;
+
+                auto summary = room->find("summary");
+                if (summary != room->end() && summary->is_object() && !summary->empty())
+                        res.summaries.emplace(room.key(), summary->get<RoomSummary>());
+        }
 }
 
 void
-Cache::insertAvatarUrl(const QString &room_id, const QString &user_id, const QString &avatar_url)
+to_json(json &j, const ReadReceiptKey &key)
 {
-        auto fmt = QString("%1 %2").arg(room_id).arg(user_id);
-        AvatarUrls.insert(fmt, avatar_url);
+        j = json{{"event_id", key.event_id}, {"room_id", key.room_id}};
 }
 
 void
-Cache::removeAvatarUrl(const QString &room_id, const QString &user_id)
+from_json(const json &j, ReadReceiptKey &key)
 {
-        auto fmt = QString("%1 %2").arg(room_id).arg(user_id);
-        AvatarUrls.remove(fmt);
+        key.event_id = j.at("event_id").get<std::string>();
+        key.room_id  = j.at("room_id").get<std::string>();
 }
 
 void
-to_json(json &j, const RoomInfo &info)
+to_json(nlohmann::json &j, const MentionsSummary &summary)
 {
-        j["name"]         = info.name;
-        j["topic"]        = info.topic;
-        j["avatar_url"]   = info.avatar_url;
-        j["version"]      = info.version;
-        j["is_invite"]    = info.is_invite;
-        j["join_rule"]    = info.join_rule;
-        j["guest_access"] = info.guest_access;
-
-        if (info.member_count != 0)
-                j["member_count"] = info.member_count;
-
-        if (info.tags.size() != 0)
-                j["tags"] = info.tags;
+        j = json{{"total", summary.total}, {"rooms", summary.rooms}};
 }
 
 void
-from_json(const json &j, RoomInfo &info)
+from_json(const nlohmann::json &j, MentionsSummary &summary)
 {
-        info.name       = j.at("name");
-        info.topic      = j.at("topic");
-        info.avatar_url = j.at("avatar_url");
-        info.version    = j.value(
-          "version", QCoreApplication::translate("RoomInfo", "no version stored").toStdString());
-        info.is_invite    = j.at("is_invite");
-        info.join_rule    = j.at("join_rule");
-        info.guest_access = j.at("guest_access");
-
-        if (j.count("member_count"))
-                info.member_count = j.at("member_count");
-
-        if (j.count("tags"))
-                info.tags = j.at("tags").get<std::vector<std::string>>();
+        summary.total = j.at("total").get<uint64_t>();
+        summary.rooms = j.at("rooms").get<std::map<std::string, uint64_t>>();
 }
 
 void
-to_json(json &j, const ReadReceiptKey &key)
+to_json(nlohmann::json &j, const CommunityInfo &info)
 {
-        j = json{{"event_id", key.event_id}, {"room_id", key.room_id}};
+        j = json{{"name", info.name},
+                 {"avatar_url", info.avatar_url},
+                 {"rooms", info.rooms},
+                 {"fetched_at", info.fetched_at}};
 }
 
 void
-from_json(const json &j, ReadReceiptKey &key)
+from_json(const nlohmann::json &j, CommunityInfo &info)
 {
-        key.event_id = j.at("event_id").get<std::string>();
-        key.room_id  = j.at("room_id").get<std::string>();
+        info.name       = j.value("name", "");
+        info.avatar_url = j.value("avatar_url", "");
+        info.rooms      = j.value("rooms", std::vector<std::string>{});
+        info.fetched_at = j.value("fetched_at", uint64_t(0));
 }
 
 void
@@ -2353,6 +7375,8 @@ to_json(nlohmann::json &obj, const OutboundGroupSessionData &msg)
         obj["session_id"]    = msg.session_id;
         obj["session_key"]   = msg.session_key;
         obj["message_index"] = msg.message_index;
+        obj["created_at"]    = msg.created_at;
+        obj["shared_with"]   = msg.shared_with;
 }
 
 void
@@ -2361,6 +7385,9 @@ from_json(const nlohmann::json &obj, OutboundGroupSessionData &msg)
         msg.session_id    = obj.at("session_id");
         msg.session_key   = obj.at("session_key");
         msg.message_index = obj.at("message_index");
+        msg.created_at    = obj.value("created_at", uint64_t(0));
+        msg.shared_with =
+          obj.value("shared_with", std::map<std::string, std::set<std::string>>{});
 }
 
 void
@@ -2368,13 +7395,31 @@ to_json(nlohmann::json &obj, const DevicePublicKeys &msg)
 {
         obj["ed25519"]    = msg.ed25519;
         obj["curve25519"] = msg.curve25519;
+
+        if (!msg.display_name.empty())
+                obj["display_name"] = msg.display_name;
 }
 
 void
 from_json(const nlohmann::json &obj, DevicePublicKeys &msg)
 {
-        msg.ed25519    = obj.at("ed25519");
-        msg.curve25519 = obj.at("curve25519");
+        msg.ed25519      = obj.at("ed25519");
+        msg.curve25519   = obj.at("curve25519");
+        msg.display_name = obj.value("display_name", "");
+}
+
+void
+to_json(nlohmann::json &obj, const UserDeviceKeys &msg)
+{
+        obj["devices"]  = msg.devices;
+        obj["outdated"] = msg.outdated;
+}
+
+void
+from_json(const nlohmann::json &obj, UserDeviceKeys &msg)
+{
+        msg.devices  = obj.at("devices").get<std::map<std::string, DevicePublicKeys>>();
+        msg.outdated = obj.value("outdated", false);
 }
 
 void
@@ -2431,40 +7476,35 @@ avatarUrl(const QString &room_id, const QString &user_id)
 {
         return instance_->avatarUrl(room_id, user_id);
 }
-
-void
-removeDisplayName(const QString &room_id, const QString &user_id)
-{
-        instance_->removeDisplayName(room_id, user_id);
-}
 void
-removeAvatarUrl(const QString &room_id, const QString &user_id)
+loadMembers(const std::vector<QString> &room_ids)
 {
-        instance_->removeAvatarUrl(room_id, user_id);
+        for (const auto &room_id : room_ids)
+                instance_->loadMembers(room_id);
 }
 
 void
-insertDisplayName(const QString &room_id, const QString &user_id, const QString &display_name)
+pinMembers(const QString &room_id)
 {
-        instance_->insertDisplayName(room_id, user_id, display_name);
+        instance_->pinMembers(room_id);
 }
-void
-insertAvatarUrl(const QString &room_id, const QString &user_id, const QString &avatar_url)
+
+std::vector<std::string>
+joinedRooms()
 {
-        instance_->insertAvatarUrl(room_id, user_id, avatar_url);
+        return instance_->joinedRooms();
 }
 
-//! Load saved data for the display names & avatars.
 void
-populateMembers()
+saveRoomListSnapshot() noexcept
 {
-        instance_->populateMembers();
+        instance_->saveRoomListSnapshot();
 }
 
-std::vector<std::string>
-joinedRooms()
+std::optional<QMap<QString, RoomInfo>>
+roomListSnapshot()
 {
-        return instance_->joinedRooms();
+        return instance_->roomListSnapshot();
 }
 
 QMap<QString, RoomInfo>
@@ -2516,10 +7556,26 @@ getMembers(const std::string &room_id, std::size_t startIndex, std::size_t len)
         return instance_->getMembers(room_id, startIndex, len);
 }
 
+RoomMembersPage
+getMembersPage(const std::string &room_id, const std::string &token, std::size_t len)
+{
+        return instance_->getMembersPage(room_id, token, len);
+}
+
+void
+saveState(const mtx::responses::Sync &res,
+          const std::map<std::string, RoomSummary> &summaries,
+          const nlohmann::json &raw)
+{
+        instance_->saveState(res, summaries, raw);
+}
 void
-saveState(const mtx::responses::Sync &res)
+saveInitialState(const mtx::responses::Sync &res,
+                 const std::map<std::string, RoomSummary> &summaries,
+                 const nlohmann::json &raw,
+                 const std::function<void(std::size_t, std::size_t)> &progress)
 {
-        instance_->saveState(res);
+        instance_->saveInitialState(res, summaries, raw, progress);
 }
 bool
 isInitialized()
@@ -2533,6 +7589,49 @@ nextBatchToken()
         return instance_->nextBatchToken();
 }
 
+std::vector<std::pair<std::string, std::vector<nlohmann::json>>>
+pendingToDeviceMessages()
+{
+        return instance_->pendingToDeviceMessages();
+}
+
+void
+removePendingToDeviceMessages(const std::string &key)
+{
+        instance_->removePendingToDeviceMessages(key);
+}
+
+std::string
+syncFilterId(const std::string &name, const std::string &definition)
+{
+        return instance_->syncFilterId(name, definition);
+}
+void
+saveSyncFilterId(const std::string &name,
+                 const std::string &definition,
+                 const std::string &filter_id)
+{
+        instance_->saveSyncFilterId(name, definition, filter_id);
+}
+
+std::string
+mentionsToken()
+{
+        return instance_->mentionsToken();
+}
+void
+saveMentionsToken(const std::string &token)
+{
+        instance_->saveMentionsToken(token);
+}
+
+void
+saveMembers(const std::string &room_id,
+            const std::vector<mtx::events::StateEvent<mtx::events::state::Member>> &members)
+{
+        instance_->saveMembers(room_id, members);
+}
+
 void
 deleteData()
 {
@@ -2550,9 +7649,9 @@ removeInvite(const std::string &room_id)
         instance_->removeInvite(room_id);
 }
 void
-removeRoom(lmdb::txn &txn, const std::string &roomid)
+removeRoom(lmdb::txn &txn, const std::string &roomid, TagChanges &tagChanges)
 {
-        instance_->removeRoom(txn, roomid);
+        instance_->removeRoom(txn, roomid, tagChanges);
 }
 void
 removeRoom(const std::string &roomid)
@@ -2575,22 +7674,72 @@ isFormatValid()
 {
         return instance_->isFormatValid();
 }
+bool
+runMigrations()
+{
+        return instance_->runMigrations();
+}
+bool
+runPendingMigrations()
+{
+        return instance_->runPendingMigrations();
+}
 void
 setCurrentFormat()
 {
         instance_->setCurrentFormat();
 }
 
-std::map<QString, mtx::responses::Timeline>
-roomMessages()
+MentionsPage
+getMentions(const std::string &room_id, const std::string &next_token, std::size_t limit)
+{
+        return instance_->getMentions(room_id, next_token, limit);
+}
+
+MentionsSummary
+mentionsSummary()
+{
+        return instance_->mentionsSummary();
+}
+
+std::optional<CommunityInfo>
+community(const std::string &group_id)
+{
+        return instance_->community(group_id);
+}
+
+void
+saveCommunity(const std::string &group_id, const CommunityInfo &info)
+{
+        instance_->saveCommunity(group_id, info);
+}
+
+void
+removeCommunity(const std::string &group_id)
 {
-        return instance_->roomMessages();
+        instance_->removeCommunity(group_id);
 }
 
-QMap<QString, mtx::responses::Notifications>
-getTimelineMentions()
+std::vector<MessageSearchResult>
+searchMessages(const QString &query, const std::string &room_id, std::size_t max_results)
+{
+        return instance_->searchMessages(query, room_id, max_results);
+}
+void
+indexDecryptedMessage(const std::string &room_id,
+                      const mtx::events::collections::TimelineEvents &event)
+{
+        instance_->indexDecryptedMessage(room_id, event);
+}
+std::optional<mtx::events::collections::TimelineEvents>
+getDecryptedEvent(const std::string &event_id)
+{
+        return instance_->getDecryptedEvent(event_id);
+}
+void
+saveDecryptedEvent(const mtx::events::collections::TimelineEvents &event)
 {
-        return instance_->getTimelineMentions();
+        instance_->saveDecryptedEvent(event);
 }
 
 //! Retrieve all the user ids from a room.
@@ -2610,16 +7759,10 @@ hasEnoughPowerLevel(const std::vector<mtx::events::EventType> &eventTypes,
         return instance_->hasEnoughPowerLevel(eventTypes, room_id, user_id);
 }
 
-//! Retrieves the saved room avatar.
-QImage
-getRoomAvatar(const QString &id)
-{
-        return instance_->getRoomAvatar(id);
-}
-QImage
-getRoomAvatar(const std::string &id)
+std::optional<NotificationLevels>
+notificationLevels(const std::string &room_id)
 {
-        return instance_->getRoomAvatar(id);
+        return instance_->notificationLevels(room_id);
 }
 
 void
@@ -2634,6 +7777,12 @@ readReceipts(const QString &event_id, const QString &room_id)
         return instance_->readReceipts(event_id, room_id);
 }
 
+Receipts
+latestReadReceipts(const std::string &room_id)
+{
+        return instance_->latestReadReceipts(room_id);
+}
+
 //! Filter the events that have at least one read receipt.
 std::vector<QString>
 filterReadEvents(const QString &room_id,
@@ -2685,6 +7834,71 @@ saveImage(const QString &url, const QByteArray &data)
         instance_->saveImage(url, data);
 }
 
+QString
+mediaPath(const QString &key)
+{
+        return instance_->mediaPath(key);
+}
+QString
+saveMedia(const QString &key, const QByteArray &data, const QString &suffix)
+{
+        return instance_->saveMedia(key, data, suffix);
+}
+QString
+mediaFileFor(const QString &key, const QString &suffix)
+{
+        return instance_->mediaFileFor(key, suffix);
+}
+QString
+addMediaFile(const QString &key, const QString &suffix, uint64_t size)
+{
+        return instance_->addMediaFile(key, suffix, size);
+}
+
+std::vector<uint32_t>
+userColors(const QString &background)
+{
+        return instance_->userColors(background);
+}
+void
+saveUserColors(const QString &background, const std::vector<uint32_t> &colors)
+{
+        instance_->saveUserColors(background, colors);
+}
+
+QSize
+imageDimensions(const QString &mxcUrl)
+{
+        return instance_->imageDimensions(mxcUrl);
+}
+void
+saveImageDimensions(const QString &mxcUrl, const QSize &size)
+{
+        instance_->saveImageDimensions(mxcUrl, size);
+}
+
+void
+saveOutboxMessage(const std::string &room_id,
+                  const mtx::events::collections::TimelineEvents &event)
+{
+        instance_->saveOutboxMessage(room_id, event);
+}
+void
+removeOutboxMessage(const std::string &room_id, const std::string &txn_id)
+{
+        instance_->removeOutboxMessage(room_id, txn_id);
+}
+std::vector<mtx::events::collections::TimelineEvents>
+outboxMessages(const std::string &room_id)
+{
+        return instance_->outboxMessages(room_id);
+}
+std::vector<std::string>
+outboxRooms()
+{
+        return instance_->outboxRooms();
+}
+
 RoomInfo
 singleRoomInfo(const std::string &room_id)
 {
@@ -2695,10 +7909,16 @@ roomsWithStateUpdates(const mtx::responses::Sync &res)
 {
         return instance_->roomsWithStateUpdates(res);
 }
+
 std::vector<std::string>
-roomsWithTagUpdates(const mtx::responses::Sync &res)
+roomsNamedByMembers(const std::vector<std::string> &rooms)
 {
-        return instance_->roomsWithTagUpdates(res);
+        return instance_->roomsNamedByMembers(rooms);
+}
+std::map<std::string, std::set<std::string>>
+roomsByTag()
+{
+        return instance_->roomsByTag();
 }
 std::map<QString, RoomInfo>
 getRoomInfo(const std::vector<std::string> &rooms)
@@ -2724,35 +7944,69 @@ searchUsers(const std::string &room_id, const std::string &query, std::uint8_t m
 {
         return instance_->searchUsers(room_id, query, max_items);
 }
-std::vector<RoomSearchResult>
-searchRooms(const std::string &query, std::uint8_t max_items)
+
+std::optional<mtx::events::collections::TimelineEvents>
+getEvent(const std::string &room_id, const std::string &event_id)
 {
-        return instance_->searchRooms(query, max_items);
+        return instance_->getEvent(room_id, event_id);
 }
 
-void
-markSentNotification(const std::string &event_id)
+bool
+saveOldMessages(const std::string &room_id,
+                const std::string &before_event_id,
+                const mtx::responses::Messages &res)
 {
-        instance_->markSentNotification(event_id);
+        return instance_->saveOldMessages(room_id, before_event_id, res);
 }
-//! Removes an event from the sent notifications.
+
 void
-removeReadNotification(const std::string &event_id)
+storeFetchedEvent(const std::string &room_id,
+                  const mtx::events::collections::TimelineEvents &event)
 {
-        instance_->removeReadNotification(event_id);
+        instance_->storeFetchedEvent(room_id, event);
 }
-//! Check if we have sent a desktop notification for the given event id.
-bool
-isNotificationSent(const std::string &event_id)
+
+TimelineWindow
+getTimelineMessages(const std::string &room_id,
+                    const std::string &before_event_id,
+                    std::size_t limit)
+{
+        return instance_->getTimelineMessages(room_id, before_event_id, limit);
+}
+
+NewerTimelineWindow
+getTimelineMessagesAfter(const std::string &room_id,
+                         const std::string &after_event_id,
+                         std::size_t limit)
+{
+        return instance_->getTimelineMessagesAfter(room_id, after_event_id, limit);
+}
+
+std::optional<TimelineContext>
+getTimelineContext(const std::string &room_id, const std::string &event_id, std::size_t limit)
 {
-        return instance_->isNotificationSent(event_id);
+        return instance_->getTimelineContext(room_id, event_id, limit);
 }
 
-//! Add all notifications containing a user mention to the db.
 void
+saveTimelineContext(const std::string &room_id,
+                    const std::vector<mtx::events::collections::TimelineEvents> &events,
+                    const std::string &start)
+{
+        instance_->saveTimelineContext(room_id, events, start);
+}
+
+std::vector<std::string>
+updateSentNotifications(const std::vector<std::string> &unread,
+                        const std::vector<std::string> &read)
+{
+        return instance_->updateSentNotifications(unread, read);
+}
+
+std::vector<mtx::responses::Notification>
 saveTimelineMentions(const mtx::responses::Notifications &res)
 {
-        instance_->saveTimelineMentions(res);
+        return instance_->saveTimelineMentions(res);
 }
 
 //! Remove old unused data.
@@ -2766,6 +8020,52 @@ deleteOldData() noexcept
 {
         instance_->deleteOldData();
 }
+
+void
+setDurability(const QString &mode)
+{
+        instance_->setDurability(mode);
+}
+
+void
+flushToDisk()
+{
+        instance_->flushToDisk();
+}
+
+bool
+growMapSize()
+{
+        return instance_->growMapSize();
+}
+
+MapSizeInfo
+mapSizeInfo()
+{
+        return instance_->mapSizeInfo();
+}
+
+std::size_t
+residentMapSize()
+{
+        return instance_->residentMapSize();
+}
+
+CacheStats
+stats()
+{
+        return instance_->stats();
+}
+bool
+compactMessages(std::chrono::steady_clock::time_point deadline)
+{
+        return instance_->compactMessages(deadline);
+}
+bool
+reclaimRemovedRooms(std::chrono::steady_clock::time_point deadline)
+{
+        return instance_->reclaimRemovedRooms(deadline);
+}
 //! Retrieve all saved room ids.
 std::vector<std::string>
 getRoomIds(lmdb::txn &txn)
@@ -2785,6 +8085,12 @@ isRoomEncrypted(const std::string &room_id)
         return instance_->isRoomEncrypted(room_id);
 }
 
+bool
+isLargeRoom(const std::string &room_id)
+{
+        return instance_->isLargeRoom(room_id);
+}
+
 //! Check if a user is a member of the room.
 bool
 isRoomMember(const std::string &user_id, const std::string &room_id)
@@ -2807,6 +8113,13 @@ getOutboundMegolmSession(const std::string &room_id)
 {
         return instance_->getOutboundMegolmSession(room_id);
 }
+void
+addOutboundMegolmSessionRecipients(const std::string &room_id,
+                                   const std::string &session_id,
+                                   const std::map<std::string, std::set<std::string>> &devices)
+{
+        instance_->addOutboundMegolmSessionRecipients(room_id, session_id, devices);
+}
 bool
 outboundMegolmSessionExists(const std::string &room_id) noexcept
 {
@@ -2817,16 +8130,22 @@ updateOutboundMegolmSession(const std::string &room_id, int message_index)
 {
         instance_->updateOutboundMegolmSession(room_id, message_index);
 }
-
 void
-importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys)
+saveOutboundMegolmSessions()
+{
+        instance_->saveOutboundMegolmSessions();
+}
+
+bool
+importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys,
+                  const std::function<bool(std::size_t, std::size_t)> &progress)
 {
-        instance_->importSessionKeys(keys);
+        return instance_->importSessionKeys(keys, progress);
 }
-mtx::crypto::ExportedSessionKeys
-exportSessionKeys()
+std::optional<mtx::crypto::ExportedSessionKeys>
+exportSessionKeys(const std::function<bool(std::size_t, std::size_t)> &progress)
 {
-        return instance_->exportSessionKeys();
+        return instance_->exportSessionKeys(progress);
 }
 
 //
@@ -2838,7 +8157,13 @@ saveInboundMegolmSession(const MegolmSessionIndex &index,
 {
         instance_->saveInboundMegolmSession(index, std::move(session));
 }
-OlmInboundGroupSession *
+void
+saveInboundMegolmSessions(
+  std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>> sessions)
+{
+        instance_->saveInboundMegolmSessions(std::move(sessions));
+}
+std::shared_ptr<InboundGroupSession>
 getInboundMegolmSession(const MegolmSessionIndex &index)
 {
         return instance_->getInboundMegolmSession(index);
@@ -2849,6 +8174,42 @@ inboundMegolmSessionExists(const MegolmSessionIndex &index)
         return instance_->inboundMegolmSessionExists(index);
 }
 
+InboundGroupSessionStats
+inboundMegolmSessionStats()
+{
+        return instance_->inboundMegolmSessionStats();
+}
+
+std::size_t
+inboundMegolmSessionUsage()
+{
+        return instance_->inboundMegolmSessionUsage();
+}
+
+void
+trimInboundMegolmSessions(std::size_t bytes)
+{
+        instance_->trimInboundMegolmSessions(bytes);
+}
+
+std::size_t
+memberCacheUsage()
+{
+        return instance_->memberCacheUsage();
+}
+
+void
+trimMemberCache(std::size_t bytes)
+{
+        instance_->trimMemberCache(bytes);
+}
+
+void
+updateMemoryBudgets()
+{
+        instance_->updateMemoryBudgets();
+}
+
 //
 // Olm Sessions
 //
@@ -2868,6 +8229,20 @@ getOlmSession(const std::string &curve25519, const std::string &session_id)
         return instance_->getOlmSession(curve25519, session_id);
 }
 
+//
+// Device keys
+//
+std::map<std::string, UserDeviceKeys>
+deviceKeys(const std::vector<std::string> &user_ids)
+{
+        return instance_->deviceKeys(user_ids);
+}
+void
+saveDeviceKeys(const std::map<std::string, UserDeviceKeys> &keys)
+{
+        instance_->saveDeviceKeys(keys);
+}
+
 void
 saveOlmAccount(const std::string &pickled)
 {
@@ -17,6 +17,10 @@
 
 #pragma once
 
+#include <chrono>
+#include <functional>
+#include <optional>
+
 #include <QDateTime>
 #include <QDir>
 #include <QImage>
@@ -31,7 +35,9 @@
 #include <mtx/responses.hpp>
 
 #include "CacheCryptoStructs.h"
+#include "CacheStats.h"
 #include "CacheStructs.h"
+#include "MessageIndex.h"
 
 namespace cache {
 void
@@ -43,20 +49,14 @@ QString
 displayName(const QString &room_id, const QString &user_id);
 QString
 avatarUrl(const QString &room_id, const QString &user_id);
-
-void
-removeDisplayName(const QString &room_id, const QString &user_id);
-void
-removeAvatarUrl(const QString &room_id, const QString &user_id);
-
+//! Read the members of the rooms into memory, unless they are already. The members of a room
+//! are otherwise read on its first lookup.
 void
-insertDisplayName(const QString &room_id, const QString &user_id, const QString &display_name);
+loadMembers(const std::vector<QString> &room_ids);
+//! Keep the members of the open room in memory, while the members of other rooms are prefetched.
 void
-insertAvatarUrl(const QString &room_id, const QString &user_id, const QString &avatar_url);
+pinMembers(const QString &room_id);
 
-//! Load saved data for the display names & avatars.
-void
-populateMembers();
 std::vector<std::string>
 joinedRooms();
 
@@ -64,6 +64,19 @@ QMap<QString, RoomInfo>
 roomInfo(bool withInvites = true);
 std::map<QString, bool>
 invites();
+//! Store the room list, so the next start can show it before restoring the cache.
+void
+saveRoomListSnapshot() noexcept;
+//! The room list of the last snapshot, which may be outdated.
+std::optional<QMap<QString, RoomInfo>>
+roomListSnapshot();
+//! The community as last fetched, if it was.
+std::optional<CommunityInfo>
+community(const std::string &group_id);
+void
+saveCommunity(const std::string &group_id, const CommunityInfo &info);
+void
+removeCommunity(const std::string &group_id);
 
 //! Calculate & return the name of the room.
 QString
@@ -87,13 +100,54 @@ getRoomVersion(lmdb::txn &txn, lmdb::dbi &statesdb);
 std::vector<RoomMember>
 getMembers(const std::string &room_id, std::size_t startIndex = 0, std::size_t len = 30);
 
+//! Retrieve the page of members following the token of the previous page.
+RoomMembersPage
+getMembersPage(const std::string &room_id, const std::string &token, std::size_t len = 30);
+
+//! Save a sync response with the summaries of its joined rooms. If raw holds the response as it
+//! was received, the timeline events are stored from it, instead of being serialized again.
 void
-saveState(const mtx::responses::Sync &res);
+saveState(const mtx::responses::Sync &res,
+          const std::map<std::string, RoomSummary> &summaries = {},
+          const nlohmann::json &raw                           = nullptr);
+//! Save the response of the initial sync in chunks of rooms, like saveState. Reports the saved and
+//! the total number of joined rooms after every chunk.
+void
+saveInitialState(const mtx::responses::Sync &res,
+                 const std::map<std::string, RoomSummary> &summaries,
+                 const nlohmann::json &raw,
+                 const std::function<void(std::size_t, std::size_t)> &progress);
 bool
 isInitialized();
 
 std::string
 nextBatchToken();
+//! The to-device messages saved with the syncs, which weren't handled yet, oldest first, by their
+//! key. A crash may have left some of them.
+std::vector<std::pair<std::string, std::vector<nlohmann::json>>>
+pendingToDeviceMessages();
+//! Forget the to-device messages of a sync, once they are handled.
+void
+removePendingToDeviceMessages(const std::string &key);
+
+//! The id of the uploaded sync filter of that name, if it was uploaded for the definition.
+std::string
+syncFilterId(const std::string &name, const std::string &definition);
+void
+saveSyncFilterId(const std::string &name,
+                 const std::string &definition,
+                 const std::string &filter_id);
+
+//! The token of the older mentions, which weren't fetched yet, or an empty one.
+std::string
+mentionsToken();
+void
+saveMentionsToken(const std::string &token);
+
+//! Store the members of a room, which the syncs don't contain, because they are lazy loaded.
+void
+saveMembers(const std::string &room_id,
+            const std::vector<mtx::events::StateEvent<mtx::events::state::Member>> &members);
 
 void
 deleteData();
@@ -103,7 +157,7 @@ removeInvite(lmdb::txn &txn, const std::string &room_id);
 void
 removeInvite(const std::string &room_id);
 void
-removeRoom(lmdb::txn &txn, const std::string &roomid);
+removeRoom(lmdb::txn &txn, const std::string &roomid, TagChanges &tagChanges);
 void
 removeRoom(const std::string &roomid);
 void
@@ -115,12 +169,35 @@ bool
 isFormatValid();
 void
 setCurrentFormat();
-
-std::map<QString, mtx::responses::Timeline>
-roomMessages();
-
-QMap<QString, mtx::responses::Notifications>
-getTimelineMentions();
+//! Upgrade the cache from an older format. Returns false if the cache needs to be reset.
+bool
+runMigrations();
+//! Run the migrations deferred by runMigrations. Returns false, if there were none.
+bool
+runPendingMigrations();
+
+//! The stored mentions of a room or of all rooms, if room_id is empty, newest first. Continues
+//! before the page of next_token, if it is given.
+MentionsPage
+getMentions(const std::string &room_id, const std::string &next_token, std::size_t limit);
+MentionsSummary
+mentionsSummary();
+
+//! The messages, which contain all words of the query, newest first. An empty room_id searches
+//! all rooms. Nothing is found, if the message index is disabled, see user/search/index_messages.
+std::vector<MessageSearchResult>
+searchMessages(const QString &query, const std::string &room_id, std::size_t max_results);
+//! Add a decrypted message to the message index.
+void
+indexDecryptedMessage(const std::string &room_id,
+                      const mtx::events::collections::TimelineEvents &event);
+//! The plaintext of an event, which was decrypted in this or an earlier session. Nothing is
+//! found, if user/encryption/cache_plaintext is off.
+std::optional<mtx::events::collections::TimelineEvents>
+getDecryptedEvent(const std::string &event_id);
+//! Keep the plaintext of a decrypted event.
+void
+saveDecryptedEvent(const mtx::events::collections::TimelineEvents &event);
 
 //! Retrieve all the user ids from a room.
 std::vector<std::string>
@@ -132,27 +209,26 @@ bool
 hasEnoughPowerLevel(const std::vector<mtx::events::EventType> &eventTypes,
                     const std::string &room_id,
                     const std::string &user_id);
+//! The power levels of the room, which the push rules check the senders against.
+std::optional<NotificationLevels>
+notificationLevels(const std::string &room_id);
 
-//! Retrieves the saved room avatar.
-QImage
-getRoomAvatar(const QString &id);
-QImage
-getRoomAvatar(const std::string &id);
-
-//! Adds a user to the read list for the given event.
-//!
-//! There should be only one user id present in a receipt list per room.
-//! The user id should be removed from any other lists.
+//! Replaces the receipts of the users with newer ones. Only the newest receipt of every user is
+//! stored.
 using Receipts = std::map<std::string, std::map<std::string, uint64_t>>;
 void
 updateReadReceipt(lmdb::txn &txn, const std::string &room_id, const Receipts &receipts);
 
-//! Retrieve all the read receipts for the given event id and room.
+//! Retrieve the users, who read the given event of the room, i.e. whose newest read receipt is
+//! for it or a later event.
 //!
 //! Returns a map of user ids and the time of the read receipt in milliseconds.
 using UserReceipts = std::multimap<uint64_t, std::string, std::greater<uint64_t>>;
 UserReceipts
 readReceipts(const QString &event_id, const QString &room_id);
+//! The newest receipt of every user in the room, event_id -> {user_id -> timestamp}.
+Receipts
+latestReadReceipts(const std::string &room_id);
 
 //! Filter the events that have at least one read receipt.
 std::vector<QString>
@@ -183,12 +259,56 @@ saveImage(const std::string &url, const std::string &data);
 void
 saveImage(const QString &url, const QByteArray &data);
 
+//! Path of the file holding the media stored under key, or an empty string.
+QString
+mediaPath(const QString &key);
+//! Store media in the media store and return the path of its file.
+QString
+saveMedia(const QString &key, const QByteArray &data, const QString &suffix = QString());
+//! The path, where the file of the media stored under key is written.
+QString
+mediaFileFor(const QString &key, const QString &suffix = QString());
+//! Add a file, which was written to mediaFileFor(key, suffix), to the media store and return its
+//! path.
+QString
+addMediaFile(const QString &key, const QString &suffix, uint64_t size);
+
+//! The colors of the user names on a background by hue, or nothing, if they weren't saved yet.
+std::vector<uint32_t>
+userColors(const QString &background);
+void
+saveUserColors(const QString &background, const std::vector<uint32_t> &colors);
+
+//! The dimensions probed from the header of an image, or an invalid size.
+QSize
+imageDimensions(const QString &mxcUrl);
+void
+saveImageDimensions(const QString &mxcUrl, const QSize &size);
+
+//! Keep a message until the server acknowledged it, so it survives restarts and lost
+//! connections. The event id of the message is its transaction id.
+void
+saveOutboxMessage(const std::string &room_id,
+                  const mtx::events::collections::TimelineEvents &event);
+void
+removeOutboxMessage(const std::string &room_id, const std::string &txn_id);
+//! The unsent messages of a room, oldest first.
+std::vector<mtx::events::collections::TimelineEvents>
+outboxMessages(const std::string &room_id);
+//! The rooms with unsent messages.
+std::vector<std::string>
+outboxRooms();
+
 RoomInfo
 singleRoomInfo(const std::string &room_id);
 std::vector<std::string>
 roomsWithStateUpdates(const mtx::responses::Sync &res);
+//! The joined rooms, which are named after their members.
 std::vector<std::string>
-roomsWithTagUpdates(const mtx::responses::Sync &res);
+roomsNamedByMembers(const std::vector<std::string> &rooms);
+//! The tagged rooms by tag.
+std::map<std::string, std::set<std::string>>
+roomsByTag();
 std::map<QString, RoomInfo>
 getRoomInfo(const std::vector<std::string> &rooms);
 inline std::map<QString, RoomInfo>
@@ -196,11 +316,6 @@ roomUpdates(const mtx::responses::Sync &sync)
 {
         return getRoomInfo(roomsWithStateUpdates(sync));
 }
-inline std::map<QString, RoomInfo>
-roomTagUpdates(const mtx::responses::Sync &sync)
-{
-        return getRoomInfo(roomsWithTagUpdates(sync));
-}
 
 //! Calculates which the read status of a room.
 //! Whether all the events in the timeline have been read.
@@ -211,20 +326,52 @@ calculateRoomReadStatus();
 
 std::vector<SearchResult>
 searchUsers(const std::string &room_id, const std::string &query, std::uint8_t max_items = 5);
-std::vector<RoomSearchResult>
-searchRooms(const std::string &query, std::uint8_t max_items = 5);
 
-void
-markSentNotification(const std::string &event_id);
-//! Removes an event from the sent notifications.
-void
-removeReadNotification(const std::string &event_id);
-//! Check if we have sent a desktop notification for the given event id.
+//! Lookup a timeline event of a room by its id, if it is in the cache.
+std::optional<mtx::events::collections::TimelineEvents>
+getEvent(const std::string &room_id, const std::string &event_id);
+//! Store the events of a /messages response, which continue the stored timeline before the event
+//! before_event_id. Returns whether the response reached older events, which were stored already,
+//! so the stored timeline continues without a gap.
 bool
-isNotificationSent(const std::string &event_id);
+saveOldMessages(const std::string &room_id,
+                const std::string &before_event_id,
+                const mtx::responses::Messages &res);
+//! Store an event retrieved outside of the timeline, e.g. the target of a reply.
+void
+storeFetchedEvent(const std::string &room_id,
+                  const mtx::events::collections::TimelineEvents &event);
+
+//! Retrieve up to limit cached events older than the given event, newest first.
+//! Starts with the newest event of the room, if before_event_id is empty.
+TimelineWindow
+getTimelineMessages(const std::string &room_id,
+                    const std::string &before_event_id,
+                    std::size_t limit);
+//! Retrieve up to limit cached events newer than the given event, oldest first.
+NewerTimelineWindow
+getTimelineMessagesAfter(const std::string &room_id,
+                         const std::string &after_event_id,
+                         std::size_t limit);
+//! The event and up to limit events on each side of it, if it is in the stored timeline.
+std::optional<TimelineContext>
+getTimelineContext(const std::string &room_id, const std::string &event_id, std::size_t limit);
+//! Store the events around an event, newest first, as returned by /context. Start is the token
+//! to request the events before them.
+void
+saveTimelineContext(const std::string &room_id,
+                    const std::vector<mtx::events::collections::TimelineEvents> &events,
+                    const std::string &start);
+
+//! Update the sent desktop notifications in one transaction: The read events are removed and
+//! the unread ones added. Returns the unread events, which weren't sent yet.
+std::vector<std::string>
+updateSentNotifications(const std::vector<std::string> &unread,
+                        const std::vector<std::string> &read);
 
-//! Add all notifications containing a user mention to the db.
-void
+//! Add the notifications containing a user mention to the db, which aren't stored yet, and return
+//! them.
+std::vector<mtx::responses::Notification>
 saveTimelineMentions(const mtx::responses::Notifications &res);
 
 //! Remove old unused data.
@@ -232,6 +379,32 @@ void
 deleteOldMessages();
 void
 deleteOldData() noexcept;
+//! Change the durability of the commits to "full", "relaxed" or "fast".
+void
+setDurability(const QString &mode);
+//! Sync the commits to disk, unless every commit is synced anyway.
+void
+flushToDisk();
+//! Double the size of the LMDB map. Returns false, if it can't grow any further.
+bool
+growMapSize();
+//! The size of the LMDB map and how much of it is used.
+MapSizeInfo
+mapSizeInfo();
+//! The bytes of the LMDB maps, which are resident in memory, or 0, if the system doesn't tell.
+std::size_t
+residentMapSize();
+//! Sizes of the databases and latencies of the cache, for the statistics page.
+CacheStats
+stats();
+//! Trim the messages of the room furthest over its quota, in small transactions, until the
+//! deadline passes. Returns false, if no room needs to be trimmed.
+bool
+compactMessages(std::chrono::steady_clock::time_point deadline);
+//! Delete the databases of the left rooms, in small transactions, until the deadline passes.
+//! Returns false, if no left room is waiting for it.
+bool
+reclaimRemovedRooms(std::chrono::steady_clock::time_point deadline);
 //! Retrieve all saved room ids.
 std::vector<std::string>
 getRoomIds(lmdb::txn &txn);
@@ -241,6 +414,9 @@ void
 setEncryptedRoom(lmdb::txn &txn, const std::string &room_id);
 bool
 isRoomEncrypted(const std::string &room_id);
+//! Whether the room has enough members to be handled as a large room.
+bool
+isLargeRoom(const std::string &room_id);
 
 //! Check if a user is a member of the room.
 bool
@@ -255,15 +431,30 @@ saveOutboundMegolmSession(const std::string &room_id,
                           mtx::crypto::OutboundGroupSessionPtr session);
 OutboundGroupSessionDataRef
 getOutboundMegolmSession(const std::string &room_id);
+//! Record the devices, which received the session, user_id -> device_ids. Ignored, if the room
+//! has another session meanwhile.
+void
+addOutboundMegolmSessionRecipients(const std::string &room_id,
+                                   const std::string &session_id,
+                                   const std::map<std::string, std::set<std::string>> &devices);
 bool
 outboundMegolmSessionExists(const std::string &room_id) noexcept;
+//! Advance the message index of a session. The session is saved every few messages.
 void
 updateOutboundMegolmSession(const std::string &room_id, int message_index);
-
+//! Save the sessions, whose message index advanced since they were saved, e.g. on shutdown.
 void
-importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys);
-mtx::crypto::ExportedSessionKeys
-exportSessionKeys();
+saveOutboundMegolmSessions();
+
+//! Import the sessions in chunks, one write transaction each. progress gets the imported and the
+//! total number of sessions after every chunk and cancels the import by returning false. The
+//! chunks imported so far are kept. Returns whether all sessions were imported.
+bool
+importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys,
+                  const std::function<bool(std::size_t, std::size_t)> &progress = {});
+//! Export all inbound sessions, see importSessionKeys for progress. Nothing, if it was cancelled.
+std::optional<mtx::crypto::ExportedSessionKeys>
+exportSessionKeys(const std::function<bool(std::size_t, std::size_t)> &progress = {});
 
 //
 // Inbound Megolm Sessions
@@ -271,21 +462,56 @@ exportSessionKeys();
 void
 saveInboundMegolmSession(const MegolmSessionIndex &index,
                          mtx::crypto::InboundGroupSessionPtr session);
-OlmInboundGroupSession *
+//! Save several sessions in one transaction, e.g. the room keys of a sync.
+void
+saveInboundMegolmSessions(
+  std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>> sessions);
+//! The inbound megolm session of the index, or nullptr. Lock its mutex to decrypt with it. A
+//! session, which wasn't found, isn't looked up in the db again, until it is saved.
+std::shared_ptr<InboundGroupSession>
 getInboundMegolmSession(const MegolmSessionIndex &index);
 bool
 inboundMegolmSessionExists(const MegolmSessionIndex &index);
+//! The hit rate of the inbound megolm sessions kept in memory.
+InboundGroupSessionStats
+inboundMegolmSessionStats();
+//! The estimated memory of the inbound megolm sessions kept in memory.
+std::size_t
+inboundMegolmSessionUsage();
+//! Pickle the least recently used inbound megolm sessions, until the others use at most bytes.
+void
+trimInboundMegolmSessions(std::size_t bytes);
+//! The estimated memory of the members of the rooms in memory.
+std::size_t
+memberCacheUsage();
+//! Drop the members of the least recently used rooms, until the others use at most bytes.
+void
+trimMemberCache(std::size_t bytes);
+//! Apply the budgets of the current memory profile to the members and the inbound megolm
+//! sessions.
+void
+updateMemoryBudgets();
 
 //
 // Olm Sessions
 //
 void
 saveOlmSession(const std::string &curve25519, mtx::crypto::OlmSessionPtr session);
+//! The ids of the sessions with a device, the most recently used first.
 std::vector<std::string>
 getOlmSessions(const std::string &curve25519);
 std::optional<mtx::crypto::OlmSessionPtr>
 getOlmSession(const std::string &curve25519, const std::string &session_id);
 
+//
+// Device keys
+//
+//! The stored device keys of the users. Users, whose devices were never queried, are missing.
+std::map<std::string, UserDeviceKeys>
+deviceKeys(const std::vector<std::string> &user_ids);
+void
+saveDeviceKeys(const std::map<std::string, UserDeviceKeys> &keys);
+
 void
 saveOlmAccount(const std::string &pickled);
 std::string
@@ -0,0 +1,221 @@
+#include "CacheCompression.h"
+
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <zlib.h>
+
+//! zlib only looks this far back, so a larger dictionary is wasted.
+constexpr std::size_t MAX_DICTIONARY_SIZE = 32 * 1024;
+//! Short values don't get smaller.
+constexpr std::size_t MIN_COMPRESSED_SIZE = 128;
+//! The strings, which are put into the dictionary.
+constexpr std::size_t MIN_STRING_SIZE = 4;
+constexpr std::size_t MAX_STRING_SIZE = 256;
+
+namespace {
+struct Dictionary
+{
+        std::string bytes;
+        //! The adler32 checksum, which zlib stores in the values compressed with it.
+        uLong id = 0;
+};
+
+std::atomic<bool> enabled_{true};
+std::mutex mutex_;
+std::shared_ptr<const Dictionary> dictionary_;
+
+std::shared_ptr<const Dictionary>
+dictionary()
+{
+        std::lock_guard lock(mutex_);
+        return dictionary_;
+}
+
+//! Count the keys and strings of a value, once per value.
+void
+collectStrings(const nlohmann::json &value, std::map<std::string, std::size_t> &seen)
+{
+        auto add = [&seen](const std::string &s) {
+                if (s.size() >= MIN_STRING_SIZE && s.size() <= MAX_STRING_SIZE)
+                        seen.emplace(s, 0);
+        };
+
+        if (value.is_object()) {
+                for (auto it = value.begin(); it != value.end(); ++it) {
+                        add(it.key());
+                        collectStrings(it.value(), seen);
+                }
+        } else if (value.is_array()) {
+                for (const auto &item : value)
+                        collectStrings(item, seen);
+        } else if (value.is_string()) {
+                add(value.get_ref<const std::string &>());
+        }
+}
+}
+
+namespace compression {
+void
+setEnabled(bool enabled)
+{
+        enabled_ = enabled;
+}
+
+bool
+enabled()
+{
+        return enabled_;
+}
+
+void
+setDictionary(std::string bytes)
+{
+        if (bytes.empty()) {
+                std::lock_guard lock(mutex_);
+                dictionary_ = nullptr;
+                return;
+        }
+
+        auto dictionary   = std::make_shared<Dictionary>();
+        dictionary->id    = adler32(adler32(0L, Z_NULL, 0),
+                                 reinterpret_cast<const Bytef *>(bytes.data()),
+                                 static_cast<uInt>(bytes.size()));
+        dictionary->bytes = std::move(bytes);
+
+        std::lock_guard lock(mutex_);
+        dictionary_ = std::move(dictionary);
+}
+
+bool
+hasDictionary()
+{
+        return dictionary() != nullptr;
+}
+
+std::string
+train(const std::vector<nlohmann::json> &samples)
+{
+        // The strings as they are encoded in CBOR, by the number of values they occur in.
+        std::map<std::string, std::size_t> counts;
+        for (const auto &sample : samples) {
+                std::map<std::string, std::size_t> seen;
+                collectStrings(sample, seen);
+
+                for (const auto &[s, unused] : seen) {
+                        const auto encoded = nlohmann::json::to_cbor(nlohmann::json(s));
+                        counts[std::string(encoded.begin(), encoded.end())]++;
+                }
+        }
+
+        // The bytes a string saves, if it is in the dictionary.
+        std::vector<std::pair<std::size_t, const std::string *>> scored;
+        for (const auto &[s, count] : counts)
+                if (count > 1)
+                        scored.emplace_back(count * s.size(), &s);
+        std::sort(scored.begin(), scored.end(), [](const auto &a, const auto &b) {
+                return a.first > b.first;
+        });
+
+        std::size_t size = 0, used = 0;
+        for (; used < scored.size(); used++) {
+                if (size + scored[used].second->size() > MAX_DICTIONARY_SIZE)
+                        break;
+                size += scored[used].second->size();
+        }
+
+        // zlib finds the end of the dictionary the cheapest, so the best strings go there.
+        std::string dictionary;
+        dictionary.reserve(size);
+        for (auto i = used; i > 0; i--)
+                dictionary += *scored[i - 1].second;
+        return dictionary;
+}
+
+std::string
+compress(std::string encoded)
+{
+        if (!enabled_ || encoded.size() < MIN_COMPRESSED_SIZE)
+                return encoded;
+
+        z_stream stream{};
+        if (deflateInit(&stream, Z_DEFAULT_COMPRESSION) != Z_OK)
+                return encoded;
+
+        if (auto dictionary = ::dictionary())
+                deflateSetDictionary(&stream,
+                                     reinterpret_cast<const Bytef *>(dictionary->bytes.data()),
+                                     static_cast<uInt>(dictionary->bytes.size()));
+
+        std::string compressed(1 + deflateBound(&stream, static_cast<uLong>(encoded.size())),
+                               '\0');
+        compressed[0] = COMPRESSED_MARKER;
+
+        stream.next_in   = reinterpret_cast<Bytef *>(encoded.data());
+        stream.avail_in  = static_cast<uInt>(encoded.size());
+        stream.next_out  = reinterpret_cast<Bytef *>(compressed.data() + 1);
+        stream.avail_out = static_cast<uInt>(compressed.size() - 1);
+
+        const auto result = deflate(&stream, Z_FINISH);
+        const auto size   = 1 + stream.total_out;
+        deflateEnd(&stream);
+
+        if (result != Z_STREAM_END || size >= encoded.size())
+                return encoded;
+
+        compressed.resize(size);
+        return compressed;
+}
+
+std::optional<std::string>
+decompress(std::string_view value)
+{
+        if (!isCompressed(value))
+                return std::nullopt;
+        value.remove_prefix(1);
+
+        z_stream stream{};
+        if (inflateInit(&stream) != Z_OK)
+                return std::nullopt;
+
+        stream.next_in  = reinterpret_cast<Bytef *>(const_cast<char *>(value.data()));
+        stream.avail_in = static_cast<uInt>(value.size());
+
+        std::string decompressed(value.size() * 4, '\0');
+        int result = Z_OK;
+        while (result == Z_OK) {
+                if (stream.total_out == decompressed.size())
+                        decompressed.resize(decompressed.size() * 2);
+
+                stream.next_out = reinterpret_cast<Bytef *>(decompressed.data() + stream.total_out);
+                stream.avail_out = static_cast<uInt>(decompressed.size() - stream.total_out);
+
+                result = inflate(&stream, Z_NO_FLUSH);
+                if (result == Z_NEED_DICT) {
+                        // The checksum of the dictionary it needs is in stream.adler.
+                        const auto dictionary = ::dictionary();
+                        if (!dictionary || dictionary->id != stream.adler)
+                                break;
+
+                        result = inflateSetDictionary(
+                          &stream,
+                          reinterpret_cast<const Bytef *>(dictionary->bytes.data()),
+                          static_cast<uInt>(dictionary->bytes.size()));
+                } else if (result == Z_BUF_ERROR && stream.avail_out == 0) {
+                        result = Z_OK;
+                }
+        }
+
+        const auto size = stream.total_out;
+        inflateEnd(&stream);
+
+        if (result != Z_STREAM_END)
+                return std::nullopt;
+
+        decompressed.resize(size);
+        return decompressed;
+}
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+//! The compression of the values of the messages databases.
+//!
+//! The events repeat their keys, the ids of the senders and the room and the markup of their
+//! formatted bodies, so they shrink a lot with a preset dictionary of these strings. The
+//! dictionary is trained once on the stored events and kept in the cache. A value, which was
+//! compressed with it, can't be read without it, so it is never replaced.
+//!
+//! A compressed value starts with COMPRESSED_MARKER, which neither a CBOR map nor a JSON object
+//! starts with, followed by a zlib stream. Values without the marker are read as they are, so a
+//! cache can hold both.
+namespace compression {
+constexpr char COMPRESSED_MARKER = '\x01';
+
+//! A compressed value, which can't be decompressed. It is a json::exception, so the value is
+//! handled like a malformed one.
+class Error : public nlohmann::json::exception
+{
+public:
+        explicit Error(const std::string &what)
+          : nlohmann::json::exception(600, what.c_str())
+        {}
+};
+
+//! Whether new values are compressed, see user/cache_compression. Compressed values are read
+//! either way.
+void
+setEnabled(bool enabled);
+bool
+enabled();
+
+//! Use the dictionary for compressing and decompressing, an empty one removes it. Safe from any
+//! thread.
+void
+setDictionary(std::string dictionary);
+bool
+hasDictionary();
+
+//! Train a dictionary on sample values: the strings, which occur in more than one of them, those
+//! saving the most bytes first.
+std::string
+train(const std::vector<nlohmann::json> &samples);
+
+//! Compress an encoded value, if compression is enabled and the value gets smaller. The value is
+//! returned as it is otherwise.
+std::string
+compress(std::string encoded);
+
+inline bool
+isCompressed(std::string_view value)
+{
+        return !value.empty() && value.front() == COMPRESSED_MARKER;
+}
+
+//! The encoded value of a compressed one. Nothing, if it is corrupt or needs a dictionary, which
+//! isn't there.
+std::optional<std::string>
+decompress(std::string_view value);
+}
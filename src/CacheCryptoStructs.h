@@ -1,7 +1,14 @@
 #pragma once
 
+#include <array>
+#include <chrono>
+#include <list>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
 
 //#include <nlohmann/json.hpp>
 
@@ -14,6 +21,12 @@ struct OutboundGroupSessionData
         std::string session_id;
         std::string session_key;
         uint64_t message_index = 0;
+        //! When the session was created, in ms since the epoch. 0 for sessions created before it
+        //! was recorded.
+        uint64_t created_at = 0;
+        //! The devices, which received the session, user_id -> device_ids. A device joining
+        //! later gets the session at its current index.
+        std::map<std::string, std::set<std::string>> shared_with;
 };
 
 void
@@ -31,6 +44,8 @@ struct DevicePublicKeys
 {
         std::string ed25519;
         std::string curve25519;
+        //! Only shown to the user, it isn't covered by the signature of the keys.
+        std::string display_name;
 };
 
 void
@@ -38,6 +53,20 @@ to_json(nlohmann::json &obj, const DevicePublicKeys &msg);
 void
 from_json(const nlohmann::json &obj, DevicePublicKeys &msg);
 
+//! The verified keys of the devices of a user, as they were queried last.
+struct UserDeviceKeys
+{
+        //! device_id -> keys
+        std::map<std::string, DevicePublicKeys> devices;
+        //! Whether the devices of the user changed since they were queried.
+        bool outdated = false;
+};
+
+void
+to_json(nlohmann::json &obj, const UserDeviceKeys &msg);
+void
+from_json(const nlohmann::json &obj, UserDeviceKeys &msg);
+
 //! Represents a unique megolm session identifier.
 struct MegolmSessionIndex
 {
@@ -54,14 +83,69 @@ to_json(nlohmann::json &obj, const MegolmSessionIndex &msg);
 void
 from_json(const nlohmann::json &obj, MegolmSessionIndex &msg);
 
+//! An unpickled inbound megolm session. Decrypting may advance its ratchet, so only one thread
+//! uses it at a time, while sessions of other messages decrypt in parallel.
+struct InboundGroupSession
+{
+        std::mutex mutex;
+        mtx::crypto::InboundGroupSessionPtr session;
+        //! The events decrypted since the session was unpickled, by message index. A message
+        //! index decrypting another event means the message was replayed. Requires the mutex.
+        std::unordered_map<uint32_t, std::string> decrypted;
+};
+
+//! An unpickled inbound megolm session in the LRU of the session storage.
+struct InboundGroupSessionEntry
+{
+        std::string key;
+        std::shared_ptr<InboundGroupSession> session;
+        //! The session was handed out since it was pickled, so decrypting may have changed it.
+        bool used = false;
+};
+
+//! The messages encrypted with an outbound megolm session since it was last saved.
+struct UnsavedOutboundGroupSession
+{
+        int messages = 0;
+        //! When the first of them was encrypted.
+        std::chrono::steady_clock::time_point since;
+};
+
+//! How well the inbound megolm sessions kept in memory cover the lookups.
+struct InboundGroupSessionStats
+{
+        uint64_t hits   = 0;
+        uint64_t misses = 0;
+        std::size_t size = 0;
+};
+
+//! How many shards the inbound megolm sessions kept in memory are split into.
+constexpr std::size_t INBOUND_GROUP_SESSION_SHARDS = 16;
+
+//! A part of the inbound megolm sessions kept in memory, by the hash of their key. Lookups of
+//! sessions in different shards, e.g. while the events of several rooms are decrypted, don't
+//! wait for each other. Only the recently used sessions are kept unpickled, most recently used
+//! first, the others are read from the db on demand.
+struct InboundGroupSessionShard
+{
+        std::list<InboundGroupSessionEntry> lru;
+        std::unordered_map<std::string, std::list<InboundGroupSessionEntry>::iterator> sessions;
+        //! The keys, which weren't in the db, so looking up the events without keys again doesn't
+        //! read the db. A key is removed, when its session is saved.
+        std::unordered_set<std::string> missing;
+        InboundGroupSessionStats stats;
+        std::mutex mutex;
+};
+
 struct OlmSessionStorage
 {
-        // Megolm sessions
-        std::map<std::string, mtx::crypto::InboundGroupSessionPtr> group_inbound_sessions;
+        // Megolm sessions.
+        std::array<InboundGroupSessionShard, INBOUND_GROUP_SESSION_SHARDS> group_inbound_shards;
         std::map<std::string, mtx::crypto::OutboundGroupSessionPtr> group_outbound_sessions;
         std::map<std::string, OutboundGroupSessionData> group_outbound_session_data;
+        //! The outbound sessions, whose message index advanced since they were saved.
+        std::map<std::string, UnsavedOutboundGroupSession> group_outbound_unsaved;
 
         // Guards for accessing megolm sessions.
         std::mutex group_outbound_mtx;
-        std::mutex group_inbound_mtx;
 };
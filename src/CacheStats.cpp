@@ -0,0 +1,256 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+#include "CacheStats.h"
+
+namespace {
+//! The most metrics, which are recorded. The metrics registered later are dropped.
+constexpr std::size_t MAX_METRICS = 256;
+
+std::mutex metrics_mtx_;
+//! The names of the metrics, by their id.
+std::vector<std::string> metrics_;
+
+enum Kind : std::size_t
+{
+        Latencies,
+        Counts,
+};
+
+//! A histogram, which only the thread of its shard writes, while others may read it.
+struct AtomicHistogram
+{
+        std::array<std::atomic<uint64_t>, LatencyHistogram::BUCKETS> buckets{};
+        std::atomic<uint64_t> count{0};
+        std::atomic<uint64_t> total_us{0};
+        std::atomic<uint64_t> max_us{0};
+
+        void record(uint64_t value)
+        {
+                // There is only one writer, so the values are just stored, without a
+                // read-modify-write.
+                auto add = [](std::atomic<uint64_t> &a, uint64_t v) {
+                        a.store(a.load(std::memory_order_relaxed) + v, std::memory_order_relaxed);
+                };
+
+                add(buckets[LatencyHistogram::bucket(value)], 1);
+                add(count, 1);
+                add(total_us, value);
+                if (value > max_us.load(std::memory_order_relaxed))
+                        max_us.store(value, std::memory_order_relaxed);
+        }
+
+        LatencyHistogram load() const
+        {
+                LatencyHistogram histogram;
+                for (std::size_t bucket = 0; bucket < LatencyHistogram::BUCKETS; bucket++)
+                        histogram.buckets[bucket] =
+                          buckets[bucket].load(std::memory_order_relaxed);
+                histogram.count    = count.load(std::memory_order_relaxed);
+                histogram.total_us = total_us.load(std::memory_order_relaxed);
+                histogram.max_us   = max_us.load(std::memory_order_relaxed);
+                return histogram;
+        }
+};
+
+//! The histograms of one thread, by the id of their metric. A histogram is allocated by the first
+//! record of its metric on the thread.
+struct Shard
+{
+        using Histograms = std::array<std::atomic<AtomicHistogram *>, MAX_METRICS>;
+
+        std::array<Histograms, 2> histograms{};
+
+        ~Shard()
+        {
+                for (auto &kind : histograms)
+                        for (auto &histogram : kind)
+                                delete histogram.load(std::memory_order_relaxed);
+        }
+};
+
+std::mutex shards_mtx_;
+std::vector<std::unique_ptr<Shard>> shards_;
+//! The histograms of the threads, which exited, e.g. the expired threads of a pool.
+std::array<std::map<std::size_t, LatencyHistogram>, 2> retired_;
+
+//! Retires the shard of its thread, when the thread exits.
+struct ShardOwner
+{
+        Shard *shard;
+
+        ShardOwner()
+        {
+                std::unique_lock<std::mutex> lock(shards_mtx_);
+                shards_.push_back(std::make_unique<Shard>());
+                shard = shards_.back().get();
+        }
+        ~ShardOwner()
+        {
+                std::unique_lock<std::mutex> lock(shards_mtx_);
+                for (std::size_t kind = 0; kind < shard->histograms.size(); kind++) {
+                        for (std::size_t id = 0; id < MAX_METRICS; id++)
+                                if (auto histogram = shard->histograms[kind][id].load(
+                                      std::memory_order_relaxed))
+                                        retired_[kind][id].merge(histogram->load());
+                }
+
+                shards_.erase(std::find_if(shards_.begin(),
+                                           shards_.end(),
+                                           [this](const auto &s) { return s.get() == shard; }));
+        }
+};
+
+#ifdef NHEKO_METRICS
+Shard &
+threadShard()
+{
+        thread_local ShardOwner owner;
+        return *owner.shard;
+}
+
+void
+record(Kind kind, const cache::Metric &metric, uint64_t value)
+{
+        if (metric.id() >= MAX_METRICS)
+                return;
+
+        auto &slot     = threadShard().histograms[kind][metric.id()];
+        auto histogram = slot.load(std::memory_order_relaxed);
+        if (!histogram) {
+                histogram = new AtomicHistogram;
+                slot.store(histogram, std::memory_order_release);
+        }
+
+        histogram->record(value);
+}
+#endif
+
+std::map<std::string, LatencyHistogram>
+collect(Kind kind)
+{
+        std::map<std::size_t, LatencyHistogram> byId;
+        {
+                std::unique_lock<std::mutex> lock(shards_mtx_);
+
+                byId = retired_[kind];
+                for (const auto &shard : shards_) {
+                        for (std::size_t id = 0; id < MAX_METRICS; id++)
+                                if (auto histogram = shard->histograms[kind][id].load(
+                                      std::memory_order_acquire))
+                                        byId[id].merge(histogram->load());
+                }
+        }
+
+        std::unique_lock<std::mutex> lock(metrics_mtx_);
+        std::map<std::string, LatencyHistogram> result;
+        for (const auto &[id, histogram] : byId)
+                result[metrics_[id]].merge(histogram);
+        return result;
+}
+}
+
+std::size_t
+LatencyHistogram::bucket(uint64_t value)
+{
+        std::size_t bucket = 0;
+        while (bucket + 1 < BUCKETS && (uint64_t{1} << bucket) < value)
+                bucket++;
+        return bucket;
+}
+
+void
+LatencyHistogram::record(std::chrono::microseconds duration)
+{
+        record(static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0)));
+}
+
+void
+LatencyHistogram::record(uint64_t value)
+{
+        buckets[bucket(value)]++;
+        count++;
+        total_us += value;
+        max_us = std::max(max_us, value);
+}
+
+void
+LatencyHistogram::merge(const LatencyHistogram &other)
+{
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++)
+                buckets[bucket] += other.buckets[bucket];
+        count += other.count;
+        total_us += other.total_us;
+        max_us = std::max(max_us, other.max_us);
+}
+
+uint64_t
+LatencyHistogram::quantile(double q) const
+{
+        if (count == 0)
+                return 0;
+
+        const auto rank = static_cast<uint64_t>(q * static_cast<double>(count - 1));
+
+        uint64_t seen = 0;
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++) {
+                seen += buckets[bucket];
+                if (seen > rank)
+                        return std::min(uint64_t{1} << bucket, max_us);
+        }
+
+        return max_us;
+}
+
+LatencyHistogram
+LatencyHistogram::since(const LatencyHistogram &earlier) const
+{
+        LatencyHistogram recent = *this;
+        for (std::size_t bucket = 0; bucket < BUCKETS; bucket++)
+                recent.buckets[bucket] -= earlier.buckets[bucket];
+        recent.count -= earlier.count;
+        recent.total_us -= earlier.total_us;
+
+        return recent;
+}
+
+namespace cache {
+Metric::Metric(const char *name)
+  : name_(name)
+{
+        std::unique_lock<std::mutex> lock(metrics_mtx_);
+
+        const auto it = std::find(metrics_.begin(), metrics_.end(), name);
+        id_           = static_cast<std::size_t>(it - metrics_.begin());
+        if (it == metrics_.end())
+                metrics_.emplace_back(name);
+}
+
+#ifdef NHEKO_METRICS
+void
+recordLatency(const Metric &metric, std::chrono::microseconds duration)
+{
+        record(Latencies, metric, static_cast<uint64_t>(std::max<int64_t>(duration.count(), 0)));
+}
+
+void
+recordCount(const Metric &metric, uint64_t count)
+{
+        record(Counts, metric, count);
+}
+#endif
+
+std::map<std::string, LatencyHistogram>
+latencies()
+{
+        return collect(Latencies);
+}
+
+std::map<std::string, LatencyHistogram>
+counts()
+{
+        return collect(Counts);
+}
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "CacheCryptoStructs.h"
+#include "CacheStructs.h"
+#include "Trace.h"
+
+//! Distribution of the durations of an operation, in power of two buckets of microseconds.
+struct LatencyHistogram
+{
+        //! The last bucket collects everything above 2^23 us, about 8 s.
+        static constexpr std::size_t BUCKETS = 24;
+
+        std::array<uint64_t, BUCKETS> buckets{};
+        uint64_t count    = 0;
+        uint64_t total_us = 0;
+        uint64_t max_us   = 0;
+
+        //! The bucket of a value.
+        static std::size_t bucket(uint64_t value);
+
+        void record(std::chrono::microseconds duration);
+        //! Record a plain value, e.g. the number of events in a sync response.
+        void record(uint64_t value);
+        //! Add the values recorded by other.
+        void merge(const LatencyHistogram &other);
+        //! Upper bound in microseconds of the bucket, which contains the quantile q.
+        uint64_t quantile(double q) const;
+        //! The values recorded after earlier was copied from this histogram. The maximum can't
+        //! be taken apart, so it is the maximum of all values.
+        LatencyHistogram since(const LatencyHistogram &earlier) const;
+};
+
+//! Entry count and size of a group of databases, e.g. the messages of all rooms.
+struct DbStats
+{
+        std::string name;
+        std::size_t databases = 0;
+        std::size_t entries   = 0;
+        std::size_t bytes     = 0;
+};
+
+//! A snapshot of the cache, as shown on the cache statistics page.
+struct CacheStats
+{
+        std::vector<DbStats> databases;
+        //! The latencies of the instrumented calls, by operation.
+        std::map<std::string, LatencyHistogram> latencies;
+        //! The sizes of the instrumented calls, e.g. the rooms per sync, by operation.
+        std::map<std::string, LatencyHistogram> counts;
+        MapSizeInfo map;
+        uint64_t media_files_size = 0;
+        InboundGroupSessionStats megolm_sessions;
+};
+
+//! The metric of an operation, registered by the first call of the call site, so recording
+//! neither looks up nor copies the name. name has to be a literal.
+#define NHEKO_METRIC(name)                                                                         \
+        ([]() -> const cache::Metric & {                                                           \
+                static const cache::Metric metric(name);                                           \
+                return metric;                                                                     \
+        }())
+
+//! The histograms are recorded by every thread on its own, so recording never waits for another
+//! thread, and are added up, when they are read. Without the METRICS option, nothing is recorded
+//! and the histograms are always empty.
+namespace cache {
+//! An operation, whose latencies or sizes are recorded. Create it with NHEKO_METRIC.
+class Metric
+{
+public:
+        //! Register the name of the operation. The call sites of the same name share it.
+        explicit Metric(const char *name);
+
+        const char *name() const { return name_; }
+        std::size_t id() const { return id_; }
+
+        Metric(const Metric &) = delete;
+        Metric &operator=(const Metric &) = delete;
+
+private:
+        const char *name_;
+        std::size_t id_;
+};
+
+#ifdef NHEKO_METRICS
+//! Add the duration of one call of an operation to its histogram.
+void
+recordLatency(const Metric &metric, std::chrono::microseconds duration);
+//! Add the size of one call of an operation to its histogram.
+void
+recordCount(const Metric &metric, uint64_t count);
+
+//! Records the time from its construction to its destruction as latency of an operation and as
+//! a span of the trace, if tracing is enabled.
+class LatencyTimer
+{
+public:
+        explicit LatencyTimer(const Metric &metric)
+          : metric_(metric)
+          , start_(std::chrono::steady_clock::now())
+        {}
+        ~LatencyTimer()
+        {
+                const auto end = std::chrono::steady_clock::now();
+                recordLatency(metric_,
+                              std::chrono::duration_cast<std::chrono::microseconds>(end - start_));
+
+                if (trace::enabled())
+                        trace::record(metric_.name(), start_, end);
+        }
+
+        LatencyTimer(const LatencyTimer &) = delete;
+        LatencyTimer &operator=(const LatencyTimer &) = delete;
+
+private:
+        const Metric &metric_;
+        std::chrono::steady_clock::time_point start_;
+};
+#else
+inline void
+recordLatency(const Metric &, std::chrono::microseconds)
+{}
+inline void
+recordCount(const Metric &, uint64_t)
+{}
+
+//! Only records the span of the trace.
+class LatencyTimer : public trace::Span
+{
+public:
+        explicit LatencyTimer(const Metric &metric)
+          : trace::Span(metric.name())
+        {}
+};
+#endif
+
+//! The histograms of all operations.
+std::map<std::string, LatencyHistogram>
+latencies();
+//! The size histograms of all operations.
+std::map<std::string, LatencyHistogram>
+counts();
+}
@@ -4,21 +4,47 @@
 #include <QImage>
 #include <QString>
 
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <set>
 #include <string>
+#include <vector>
 
+#include <mtx/events/collections.hpp>
 #include <mtx/events/join_rules.hpp>
+#include <mtx/responses/notifications.hpp>
+#include <mtx/responses/sync.hpp>
 
 struct RoomMember
 {
         QString user_id;
         QString display_name;
-        QImage avatar;
+        QString avatar_url;
+};
+
+//! The size of the LMDB map and the space used by the data in it, in bytes.
+struct MapSizeInfo
+{
+        std::size_t map_size  = 0;
+        std::size_t used_size = 0;
+};
+
+//! A page of the members of a room.
+struct RoomMembersPage
+{
+        std::vector<RoomMember> members;
+        //! Continues the listing after this page. Empty, once all members were returned.
+        std::string next_token;
 };
 
 struct SearchResult
 {
         QString user_id;
         QString display_name;
+        //! Found in the user directory of the server, which isn't scoped to the room, so the
+        //! user may not be a member.
+        bool from_directory = false;
 };
 
 //! Used to uniquely identify a list of read receipts.
@@ -57,7 +83,7 @@ struct RoomInfo
         //! Whether or not the room is an invite.
         bool is_invite = false;
         //! Total number of members in the room.
-        int16_t member_count = 0;
+        int member_count = 0;
         //! Who can access to the room.
         mtx::events::state::JoinRule join_rule = mtx::events::state::JoinRule::Public;
         bool guest_access                      = false;
@@ -84,6 +110,121 @@ to_json(nlohmann::json &j, const MemberInfo &info);
 void
 from_json(const nlohmann::json &j, MemberInfo &info);
 
+//! The summary of a joined room, which names the room, if it has no name or alias. A sync only
+//! has the fields, which changed since the last one.
+struct RoomSummary
+{
+        //! The members, which name the room. The local user isn't one of them.
+        std::optional<std::vector<std::string>> heroes;
+        std::optional<int> joined_member_count;
+        std::optional<int> invited_member_count;
+};
+
+void
+to_json(nlohmann::json &j, const RoomSummary &summary);
+void
+from_json(const nlohmann::json &j, RoomSummary &summary);
+
+//! A sync response with the summaries of the joined rooms, which mtxclient doesn't parse.
+struct SyncResponse
+{
+        mtx::responses::Sync sync;
+        std::map<std::string, RoomSummary> summaries;
+};
+
+void
+from_json(const nlohmann::json &j, SyncResponse &res);
+
+//! The power levels of a room, which decide whether a sender may notify the whole room.
+struct NotificationLevels
+{
+        mtx::events::state::PowerLevels levels;
+        //! The level needed to notify the room with @room, notifications.room of the event.
+        int64_t room = 50;
+};
+
+//! A page of timeline events restored from the cache.
+struct TimelineWindow
+{
+        //! The events of the page, newest first.
+        std::vector<mtx::events::collections::TimelineEvents> events;
+        //! Token to request the events before this page from the server.
+        std::string prev_batch;
+        //! Whether the cache has no more events connecting to this page.
+        bool reached_end = false;
+};
+
+//! A page of timeline events restored from the cache, which are newer than an event.
+struct NewerTimelineWindow
+{
+        //! The events of the page, oldest first.
+        std::vector<mtx::events::collections::TimelineEvents> events;
+        //! The stored event after the page, if the page ended, because the events before it are
+        //! missing, and the token to request them backwards from it.
+        std::string gap_event_id;
+        std::string gap_token;
+        //! Whether the page reached the newest stored event of the room.
+        bool reached_newest = false;
+};
+
+//! The events around an event, restored from the cache.
+struct TimelineContext
+{
+        mtx::events::collections::TimelineEvents event;
+        //! The events before and after it, up to the next gaps.
+        TimelineWindow older;
+        NewerTimelineWindow newer;
+};
+
+//! A page of the stored mentions of the user.
+struct MentionsPage
+{
+        //! The mentions of the page, newest first.
+        std::vector<mtx::responses::Notification> mentions;
+        //! Continues the listing before this page. Empty, once all mentions were returned.
+        std::string next_token;
+};
+
+//! The number of stored mentions in all rooms and per room.
+struct MentionsSummary
+{
+        uint64_t total = 0;
+        std::map<std::string, uint64_t> rooms;
+};
+
+void
+to_json(nlohmann::json &j, const MentionsSummary &summary);
+void
+from_json(const nlohmann::json &j, MentionsSummary &summary);
+
+//! The rooms, which were tagged or untagged, by tag. A room is only in one of them per tag.
+struct TagChanges
+{
+        std::map<std::string, std::set<std::string>> added;
+        std::map<std::string, std::set<std::string>> removed;
+
+        bool empty() const { return added.empty() && removed.empty(); }
+        void tag(const std::string &tag, const std::string &room_id);
+        void untag(const std::string &tag, const std::string &room_id);
+        //! Add changes, which happened after these.
+        void merge(const TagChanges &newer);
+};
+
+//! The profile and rooms of a community, as last fetched from the server.
+struct CommunityInfo
+{
+        std::string name;
+        std::string avatar_url;
+        std::vector<std::string> rooms;
+        //! When the profile and rooms were fetched, in ms since the epoch.
+        uint64_t fetched_at = 0;
+};
+
+void
+to_json(nlohmann::json &j, const CommunityInfo &info);
+void
+from_json(const nlohmann::json &j, CommunityInfo &info);
+
 struct RoomSearchResult
 {
         std::string room_id;
@@ -18,12 +18,26 @@
 
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <optional>
+#include <shared_mutex>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
+#include <QByteArray>
 #include <QDateTime>
 #include <QDir>
 #include <QImage>
 #include <QString>
+#include <QStringList>
 
 #if __has_include(<lmdbxx/lmdb++.h>)
 #include <lmdbxx/lmdb++.h>
@@ -36,10 +50,222 @@
 #include <mtxclient/crypto/client.hpp>
 
 #include "CacheCryptoStructs.h"
+#include "CacheStats.h"
 #include "CacheStructs.h"
+#include "EventTraits.h"
+#include "MemberCache.h"
+#include "MemoryGovernor.h"
+#include "MessageIndex.h"
+#include "SearchIndex.h"
+
+//! Key of a timeline event in the per room message databases.
+//!
+//! The origin_server_ts is stored as a big-endian uint64, so the keys sort chronologically with
+//! LMDB's default memcmp comparison. The event id keeps events of the same millisecond apart.
+std::string
+messageKey(uint64_t timestamp, const std::string &event_id);
+//! Extract the timestamp from a key created with messageKey.
+uint64_t
+messageKeyTimestamp(std::string_view key);
+//! Extract the event id from a key created with messageKey.
+std::string
+messageKeyEventId(std::string_view key);
+
+//! The timeline events of a joined room in a sync response as JSON, or null, if it has none.
+const nlohmann::json &
+rawTimelineEvents(const nlohmann::json &sync, const std::string &room_id);
+
+//! Key of the read receipts of an event.
+//!
+//! Prefixed by the room id and a NUL byte, so the receipts of a room are adjacent in the db.
+std::string
+receiptKey(const std::string &room_id, const std::string &event_id);
+
+//! The summary of the last message of a room, as stored in the last messages db.
+nlohmann::json
+lastMessageToJson(const DescInfo &info);
+DescInfo
+lastMessageFromJson(const nlohmann::json &obj);
+
+//! Serialize a value of the rooms, invites, members, read receipts or messages databases.
+//!
+//! Since the 2020.05.03 format these values are stored as CBOR instead of JSON text, which is
+//! smaller and a lot cheaper to parse.
+std::string
+encodeValue(const nlohmann::json &j);
+//! Serialize a value of the messages databases. Since the 2020.05.11 format it is compressed,
+//! unless user/cache_compression is off, see compression.
+std::string
+encodeMessage(const nlohmann::json &j);
+//! Parse a value written by encodeValue or encodeMessage. JSON text of older formats is accepted
+//! as well.
+nlohmann::json
+decodeValue(const std::string &data);
+nlohmann::json
+decodeValue(const lmdb::val &data);
+//! The bytes of a key or value, read straight from the memory map. Only valid during the
+//! transaction, which read them.
+inline std::string_view
+view(const lmdb::val &data)
+{
+        return std::string_view(data.data(), data.size());
+}
+
+//! Keeps the map of the environment from being resized, while a thread uses it. Only the
+//! outermost use of a thread locks, so a thread may open a transaction within another one.
+class MapUse
+{
+public:
+        explicit MapUse(std::shared_mutex &mutex);
+        ~MapUse();
+
+        MapUse(const MapUse &) = delete;
+        MapUse &operator=(const MapUse &) = delete;
+
+        //! Whether the current thread uses the map.
+        static bool active() { return depth_ > 0; }
+
+private:
+        std::shared_mutex &mutex_;
+        static thread_local int depth_;
+};
+
+//! The handles of the named databases. LMDB keeps the handles opened by a committed
+//! transaction open, until the environment is closed, so they can be reused instead of opening
+//! the databases by name again.
+class DbiRegistry
+{
+public:
+        std::optional<MDB_dbi> find(const std::string &name);
+        //! Remember a handle opened by txn. Others may use it, once txn is committed.
+        void opened(MDB_txn *txn, const std::string &name, MDB_dbi dbi);
+        //! Forget the handle of a database, once txn has dropped it.
+        void dropped(MDB_txn *txn, const std::string &name);
+        //! Whether the transaction opened or dropped any handles.
+        bool opens(MDB_txn *txn);
+        //! Apply the changes of a transaction, or discard them, if it was aborted.
+        void finished(MDB_txn *txn, bool committed);
+
+private:
+        std::mutex mutex_;
+        std::unordered_map<std::string, MDB_dbi> handles_;
+        //! The handles opened or dropped by each open transaction, in order. A missing handle
+        //! means the database was dropped.
+        std::unordered_map<MDB_txn *, std::vector<std::pair<std::string, std::optional<MDB_dbi>>>>
+          pending_;
+};
+
+//! Read-only transactions, which were reset to be renewed later. Renewing a transaction is
+//! cheaper than beginning one, which has to take a slot in the reader table. The environment is
+//! opened with MDB_NOTLS, so the transactions may be renewed by any thread.
+class ReaderPool
+{
+public:
+        ~ReaderPool() { clear(); }
+
+        //! A renewed transaction, or a new one, if none is pooled.
+        MDB_txn *acquire(MDB_env *env);
+        //! Reset the transaction and keep it for reuse.
+        void release(MDB_txn *txn);
+        //! Abort the pooled transactions.
+        void clear();
+
+private:
+        //! More readers at once are rare, so the transactions above this are aborted.
+        static constexpr std::size_t MAX_POOLED = 8;
+
+        std::mutex mutex_;
+        std::vector<MDB_txn *> txns_;
+};
+
+//! A transaction, during which the map can't be resized. The time write transactions are
+//! held is recorded as the latency of hold. Read-only transactions come from the reader
+//! pool and go back to it, when they are committed or destroyed.
+class MapTxn
+  : private MapUse
+  , public lmdb::txn
+{
+public:
+        MapTxn(lmdb::env &env,
+               std::shared_mutex &mutex,
+               DbiRegistry &registry,
+               ReaderPool &readers,
+               unsigned int flags,
+               const cache::Metric &hold)
+          : MapUse(mutex)
+          , lmdb::txn(begin(env, readers, flags))
+          , registry_(registry)
+          , readers_(readers)
+          , hold_(hold)
+          , write_(!(flags & MDB_RDONLY))
+          , start_(std::chrono::steady_clock::now())
+        {}
+        ~MapTxn()
+        {
+                // Still open transactions are aborted.
+                if (handle()) {
+                        if (!write_) {
+                                finishRead();
+                                return;
+                        }
+
+                        registry_.finished(handle(), false);
+                        recordHoldTime();
+                }
+        }
+
+        void commit()
+        {
+                if (!write_) {
+                        finishRead();
+                        return;
+                }
+
+                auto txn = handle();
+                lmdb::txn::commit();
+                registry_.finished(txn, true);
+                recordHoldTime();
+        }
+
+private:
+        static MDB_txn *begin(lmdb::env &env, ReaderPool &readers, unsigned int flags)
+        {
+                if (flags & MDB_RDONLY)
+                        return readers.acquire(env.handle());
+
+                MDB_txn *txn = nullptr;
+                lmdb::txn_begin(env.handle(), nullptr, flags, &txn);
+                return txn;
+        }
 
-int
-numeric_key_comparison(const MDB_val *a, const MDB_val *b);
+        //! Reading transactions, which opened databases, are committed to keep the handles.
+        //! The others are reset for reuse.
+        void finishRead()
+        {
+                auto txn = handle();
+                if (registry_.opens(txn)) {
+                        lmdb::txn::commit();
+                        registry_.finished(txn, true);
+                } else {
+                        _handle = nullptr;
+                        readers_.release(txn);
+                }
+        }
+
+        void recordHoldTime()
+        {
+                if (write_)
+                        cache::recordLatency(hold_,
+                                             std::chrono::duration_cast<std::chrono::microseconds>(
+                                               std::chrono::steady_clock::now() - start_));
+        }
+
+        DbiRegistry &registry_;
+        ReaderPool &readers_;
+        const cache::Metric &hold_;
+        bool write_;
+        std::chrono::steady_clock::time_point start_;
+};
 
 class Cache : public QObject
 {
@@ -48,26 +274,30 @@ class Cache : public QObject
 public:
         Cache(const QString &userId, QObject *parent = nullptr);
 
-        static std::string displayName(const std::string &room_id, const std::string &user_id);
-        static QString displayName(const QString &room_id, const QString &user_id);
-        static QString avatarUrl(const QString &room_id, const QString &user_id);
+        //! The display name and avatar of a member. The members of a room are read from its
+        //! member db on the first lookup, so don't call these with a transaction open on the
+        //! calling thread.
+        std::string displayName(const std::string &room_id, const std::string &user_id);
+        QString displayName(const QString &room_id, const QString &user_id);
+        QString avatarUrl(const QString &room_id, const QString &user_id);
+        //! Read the members of a room from its member db, unless they are in memory.
+        void loadMembers(const QString &room_id);
+        //! Keep the members of the room in memory, while the members of other rooms are read.
+        void pinMembers(const QString &room_id) { members_.pin(room_id); }
 
-        static void removeDisplayName(const QString &room_id, const QString &user_id);
-        static void removeAvatarUrl(const QString &room_id, const QString &user_id);
-
-        static void insertDisplayName(const QString &room_id,
-                                      const QString &user_id,
-                                      const QString &display_name);
-        static void insertAvatarUrl(const QString &room_id,
-                                    const QString &user_id,
-                                    const QString &avatar_url);
-
-        //! Load saved data for the display names & avatars.
-        void populateMembers();
         std::vector<std::string> joinedRooms();
 
         QMap<QString, RoomInfo> roomInfo(bool withInvites = true);
         std::map<QString, bool> invites();
+        //! Store the room info of all rooms, so the next start can show the room list before
+        //! restoring the cache.
+        void saveRoomListSnapshot() noexcept;
+        //! The room info from the last snapshot, which may be outdated.
+        std::optional<QMap<QString, RoomInfo>> roomListSnapshot();
+
+        std::optional<CommunityInfo> community(const std::string &group_id);
+        void saveCommunity(const std::string &group_id, const CommunityInfo &info);
+        void removeCommunity(const std::string &group_id);
 
         //! Calculate & return the name of the room.
         QString getRoomName(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb);
@@ -88,26 +318,84 @@ public:
         std::vector<RoomMember> getMembers(const std::string &room_id,
                                            std::size_t startIndex = 0,
                                            std::size_t len        = 30);
-
-        void saveState(const mtx::responses::Sync &res);
+        //! Retrieve the members following the token of the previous page, or the first members
+        //! for an empty token. Unlike the index of getMembers, the token is found by a seek.
+        RoomMembersPage getMembersPage(const std::string &room_id,
+                                       const std::string &token,
+                                       std::size_t len = 30);
+
+        //! Save a sync response with the summaries of its joined rooms. If raw holds the response
+        //! as it was received, the timeline events are stored from it, instead of being
+        //! serialized again.
+        void saveState(const mtx::responses::Sync &res,
+                       const std::map<std::string, RoomSummary> &summaries = {},
+                       const nlohmann::json &raw                           = nullptr);
+        //! Save the response of the initial sync in chunks of rooms. Reports the saved and the
+        //! total number of joined rooms after every chunk.
+        void saveInitialState(const mtx::responses::Sync &res,
+                              const std::map<std::string, RoomSummary> &summaries,
+                              const nlohmann::json &raw,
+                              const std::function<void(std::size_t, std::size_t)> &progress);
         bool isInitialized() const;
 
         std::string nextBatchToken() const;
+        //! The to-device messages saved with the syncs, which weren't handled yet, oldest first,
+        //! by their key.
+        std::vector<std::pair<std::string, std::vector<nlohmann::json>>> pendingToDeviceMessages();
+        //! Forget the to-device messages of a sync, once they are handled.
+        void removePendingToDeviceMessages(const std::string &key);
+
+        //! The id of the uploaded sync filter of that name, if it was uploaded for the
+        //! definition.
+        std::string syncFilterId(const std::string &name, const std::string &definition);
+        void saveSyncFilterId(const std::string &name,
+                              const std::string &definition,
+                              const std::string &filter_id);
+        //! The token of the older mentions, which weren't fetched yet, or an empty one.
+        std::string mentionsToken();
+        void saveMentionsToken(const std::string &token);
+
+        //! Store the members of a room, which the syncs don't contain, because they are lazy
+        //! loaded.
+        void saveMembers(
+          const std::string &room_id,
+          const std::vector<mtx::events::StateEvent<mtx::events::state::Member>> &members);
 
         void deleteData();
 
         void removeInvite(lmdb::txn &txn, const std::string &room_id);
         void removeInvite(const std::string &room_id);
-        void removeRoom(lmdb::txn &txn, const std::string &roomid);
+        //! Remove a left room. Its tags are added to tagChanges.
+        void removeRoom(lmdb::txn &txn, const std::string &roomid, TagChanges &tagChanges);
         void removeRoom(const std::string &roomid);
         void setup();
 
         bool isFormatValid();
         void setCurrentFormat();
-
-        std::map<QString, mtx::responses::Timeline> roomMessages();
-
-        QMap<QString, mtx::responses::Notifications> getTimelineMentions();
+        //! Upgrade the cache from an older format in place. Returns false if the stored
+        //! format can't be migrated and the cache needs to be reset. The migrations, which only
+        //! rebuild derived data, are deferred to runPendingMigrations.
+        bool runMigrations();
+        //! Run the deferred migrations in chunked transactions, while the client already uses
+        //! the cache. Returns false, if there were none.
+        bool runPendingMigrations();
+
+        MentionsPage getMentions(const std::string &room_id,
+                                 const std::string &next_token,
+                                 std::size_t limit);
+        MentionsSummary mentionsSummary();
+
+        std::vector<MessageSearchResult> searchMessages(const QString &query,
+                                                        const std::string &room_id,
+                                                        std::size_t max_results);
+        void indexDecryptedMessage(const std::string &room_id,
+                                   const mtx::events::collections::TimelineEvents &event);
+        //! The plaintext of an encrypted event, which was decrypted before, see
+        //! DECRYPTED_EVENTS_DB.
+        std::optional<mtx::events::collections::TimelineEvents> getDecryptedEvent(
+          const std::string &event_id);
+        //! Keep the plaintext of a decrypted event, so it isn't decrypted again after a restart.
+        void saveDecryptedEvent(const mtx::events::collections::TimelineEvents &event);
 
         //! Retrieve all the user ids from a room.
         std::vector<std::string> roomMembers(const std::string &room_id);
@@ -117,77 +405,193 @@ public:
         bool hasEnoughPowerLevel(const std::vector<mtx::events::EventType> &eventTypes,
                                  const std::string &room_id,
                                  const std::string &user_id);
+        //! The power levels of the room, which the push rules check the senders against. None, if
+        //! the room has no power levels.
+        std::optional<NotificationLevels> notificationLevels(const std::string &room_id);
 
-        //! Retrieves the saved room avatar.
-        QImage getRoomAvatar(const QString &id);
-        QImage getRoomAvatar(const std::string &id);
-
-        //! Adds a user to the read list for the given event.
-        //!
-        //! There should be only one user id present in a receipt list per room.
-        //! The user id should be removed from any other lists.
+        //! Replaces the receipts of the users with newer ones. Only the newest receipt of every
+        //! user is stored.
         using Receipts = std::map<std::string, std::map<std::string, uint64_t>>;
         void updateReadReceipt(lmdb::txn &txn,
                                const std::string &room_id,
                                const Receipts &receipts);
 
-        //! Retrieve all the read receipts for the given event id and room.
+        //! Mark the device keys of the users with changed devices as outdated and drop the keys of
+        //! the users, who don't share a room with us anymore.
+        void updateDeviceLists(lmdb::txn &txn,
+                               const std::vector<std::string> &changed,
+                               const std::vector<std::string> &left);
+
+        //! The newest receipt of every user of the room, user_id -> (event_id, timestamp).
+        std::map<std::string, std::pair<std::string, uint64_t>> roomReceipts(
+          lmdb::txn &txn,
+          const std::string &room_id);
+        //! The key of a stored event in the messages db of the room, which orders the events by
+        //! time. Empty, if the event isn't stored.
+        std::string eventOrderKey(lmdb::txn &txn,
+                                  const std::string &room_id,
+                                  const std::string &event_id);
+
+        //! Retrieve the users, who read the given event of the room, i.e. whose newest read
+        //! receipt is for it or a later event.
         //!
         //! Returns a map of user ids and the time of the read receipt in milliseconds.
         using UserReceipts = std::multimap<uint64_t, std::string, std::greater<uint64_t>>;
         UserReceipts readReceipts(const QString &event_id, const QString &room_id);
+        //! The newest receipt of every user in the room, event_id -> {user_id -> timestamp}.
+        Receipts latestReadReceipts(const std::string &room_id);
 
         //! Filter the events that have at least one read receipt.
         std::vector<QString> filterReadEvents(const QString &room_id,
                                               const std::vector<QString> &event_ids,
                                               const std::string &excluded_user);
+        //! Filter the events that have a read receipt of someone other than excluded_user,
+        //! using a single cursor.
+        std::vector<QString> filterReadEvents(lmdb::txn &txn,
+                                              const std::string &room_id,
+                                              const std::vector<QString> &event_ids,
+                                              const std::string &excluded_user);
         //! Add event for which we are expecting some read receipts.
         void addPendingReceipt(const QString &room_id, const QString &event_id);
         void removePendingReceipt(lmdb::txn &txn,
                                   const std::string &room_id,
                                   const std::string &event_id);
         void notifyForReadReceipts(const std::string &room_id);
+        void notifyForReadReceipts(lmdb::txn &txn, const std::string &room_id);
         std::vector<QString> pendingReceiptsEvents(lmdb::txn &txn, const std::string &room_id);
 
-        QByteArray image(const QString &url) const;
+        QByteArray image(const QString &url);
         QByteArray image(lmdb::txn &txn, const std::string &url) const;
         void saveImage(const std::string &url, const std::string &data);
         void saveImage(const QString &url, const QByteArray &data);
 
+        //! Path of the file holding the media stored under key, or an empty string.
+        QString mediaPath(const QString &key);
+        //! Store media in the media store and return the path of its file.
+        QString saveMedia(const QString &key,
+                          const QByteArray &data,
+                          const QString &suffix = QString());
+        //! The path, where the file of the media stored under key is written.
+        QString mediaFileFor(const QString &key, const QString &suffix);
+        //! Add a file, which was written to mediaFileFor(key, suffix), to the media store and
+        //! return its path.
+        QString addMediaFile(const QString &key, const QString &suffix, uint64_t size);
+
+        //! The colors of the user names on a background by hue, or nothing, if they weren't saved
+        //! yet.
+        std::vector<uint32_t> userColors(const QString &background);
+        void saveUserColors(const QString &background, const std::vector<uint32_t> &colors);
+
+        //! The dimensions probed from the header of an image, or an invalid size.
+        QSize imageDimensions(const QString &mxcUrl);
+        void saveImageDimensions(const QString &mxcUrl, const QSize &size);
+
+        //! Keep a message until the server acknowledged it. The event id of the message is its
+        //! transaction id.
+        void saveOutboxMessage(const std::string &room_id,
+                               const mtx::events::collections::TimelineEvents &event);
+        void removeOutboxMessage(const std::string &room_id, const std::string &txn_id);
+        //! The unsent messages of a room, oldest first.
+        std::vector<mtx::events::collections::TimelineEvents> outboxMessages(
+          const std::string &room_id);
+        //! The rooms with unsent messages.
+        std::vector<std::string> outboxRooms();
+
         RoomInfo singleRoomInfo(const std::string &room_id);
         std::vector<std::string> roomsWithStateUpdates(const mtx::responses::Sync &res);
-        std::vector<std::string> roomsWithTagUpdates(const mtx::responses::Sync &res);
+        //! The joined rooms, which are named after their members, since they have neither a name,
+        //! an alias nor a summary with heroes.
+        std::vector<std::string> roomsNamedByMembers(const std::vector<std::string> &rooms);
+        //! The tagged rooms by tag, from the tag index.
+        std::map<std::string, std::set<std::string>> roomsByTag();
         std::map<QString, RoomInfo> getRoomInfo(const std::vector<std::string> &rooms);
 
         //! Calculates which the read status of a room.
         //! Whether all the events in the timeline have been read.
         bool calculateRoomReadStatus(const std::string &room_id);
+        //! Emit the read status of all joined rooms. The stored status is used, so only new
+        //! rooms are calculated.
         void calculateRoomReadStatus();
 
         std::vector<SearchResult> searchUsers(const std::string &room_id,
                                               const std::string &query,
                                               std::uint8_t max_items = 5);
-        std::vector<RoomSearchResult> searchRooms(const std::string &query,
-                                                  std::uint8_t max_items = 5);
-
-        void markSentNotification(const std::string &event_id);
-        //! Removes an event from the sent notifications.
-        void removeReadNotification(const std::string &event_id);
-        //! Check if we have sent a desktop notification for the given event id.
-        bool isNotificationSent(const std::string &event_id);
 
-        //! Add all notifications containing a user mention to the db.
-        void saveTimelineMentions(const mtx::responses::Notifications &res);
+        //! Lookup a timeline event of a room by its id, if it is in the cache.
+        std::optional<mtx::events::collections::TimelineEvents> getEvent(
+          const std::string &room_id,
+          const std::string &event_id);
+        //! Store the events of a /messages response, which continue the stored timeline before the
+        //! event before_event_id. Returns whether the response reached older stored events.
+        bool saveOldMessages(const std::string &room_id,
+                             const std::string &before_event_id,
+                             const mtx::responses::Messages &res);
+        //! Store an event retrieved outside of the timeline, e.g. the target of a reply.
+        void storeFetchedEvent(const std::string &room_id,
+                               const mtx::events::collections::TimelineEvents &event);
+
+        //! Retrieve up to limit cached events older than the given event, newest first.
+        //! Starts with the newest event of the room, if before_event_id is empty.
+        TimelineWindow getTimelineMessages(const std::string &room_id,
+                                           const std::string &before_event_id,
+                                           std::size_t limit);
+        //! Retrieve up to limit cached events newer than the given event, oldest first.
+        NewerTimelineWindow getTimelineMessagesAfter(const std::string &room_id,
+                                                     const std::string &after_event_id,
+                                                     std::size_t limit);
+        //! The event and up to limit events on each side of it, if it is in the stored
+        //! timeline.
+        std::optional<TimelineContext> getTimelineContext(const std::string &room_id,
+                                                          const std::string &event_id,
+                                                          std::size_t limit);
+        //! Store the events around an event, newest first, as returned by /context.
+        void saveTimelineContext(
+          const std::string &room_id,
+          const std::vector<mtx::events::collections::TimelineEvents> &events,
+          const std::string &start);
+
+        //! Remove the read events from the sent notifications and add the unread ones. Returns
+        //! the unread events, which weren't sent yet.
+        std::vector<std::string> updateSentNotifications(const std::vector<std::string> &unread,
+                                                         const std::vector<std::string> &read);
+
+        //! Add the notifications containing a user mention to the db, which aren't stored yet, and
+        //! return them.
+        std::vector<mtx::responses::Notification> saveTimelineMentions(
+          const mtx::responses::Notifications &res);
 
         //! Remove old unused data.
         void deleteOldMessages();
         void deleteOldData() noexcept;
+        //! Double the size of the map, after a write failed with MDB_MAP_FULL. Returns false, if
+        //! the map has reached its maximum size. Must not be called during a transaction.
+        bool growMapSize();
+        MapSizeInfo mapSizeInfo();
+        //! How much of the maps of the cache and the crypto db is resident in memory.
+        std::size_t residentMapSize();
+        //! Change the durability of the commits to "full", "relaxed" or "fast".
+        void setDurability(const QString &mode);
+        //! Sync the commits to disk, unless every commit is synced anyway.
+        void flushToDisk();
+        CacheStats stats();
+        //! Trim the messages of the room furthest over its quota, in small transactions, until
+        //! the deadline passes. Returns false, if no room needs to be trimmed.
+        bool compactMessages(std::chrono::steady_clock::time_point deadline);
+        //! Delete the databases of the left rooms, in small transactions, until the deadline
+        //! passes. Returns false, if no left room is waiting for it.
+        bool reclaimRemovedRooms(std::chrono::steady_clock::time_point deadline);
         //! Retrieve all saved room ids.
         std::vector<std::string> getRoomIds(lmdb::txn &txn);
 
         //! Mark a room that uses e2e encryption.
         void setEncryptedRoom(lmdb::txn &txn, const std::string &room_id);
+        //! Doesn't touch the db, the encrypted rooms are kept in memory.
         bool isRoomEncrypted(const std::string &room_id);
+        //! Whether the room has at least user/large_room_members members. Large rooms don't keep
+        //! every receipt, don't send typing notifications and search their members on the server
+        //! as well.
+        bool isLargeRoom(const std::string &room_id);
+        bool isLargeRoom(lmdb::txn &txn, const std::string &room_id);
 
         //! Check if a user is a member of the room.
         bool isRoomMember(const std::string &user_id, const std::string &room_id);
@@ -199,28 +603,64 @@ public:
                                        const OutboundGroupSessionData &data,
                                        mtx::crypto::OutboundGroupSessionPtr session);
         OutboundGroupSessionDataRef getOutboundMegolmSession(const std::string &room_id);
+        //! Record the devices, which received the session. Ignored, if it was replaced meanwhile.
+        void addOutboundMegolmSessionRecipients(
+          const std::string &room_id,
+          const std::string &session_id,
+          const std::map<std::string, std::set<std::string>> &devices);
         bool outboundMegolmSessionExists(const std::string &room_id) noexcept;
+        //! Advance the message index of a session. The session is saved every few messages.
         void updateOutboundMegolmSession(const std::string &room_id, int message_index);
+        //! Save the sessions, whose message index advanced since they were saved.
+        void saveOutboundMegolmSessions();
 
-        void importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys);
-        mtx::crypto::ExportedSessionKeys exportSessionKeys();
+        bool importSessionKeys(const mtx::crypto::ExportedSessionKeys &keys,
+                               const std::function<bool(std::size_t, std::size_t)> &progress);
+        std::optional<mtx::crypto::ExportedSessionKeys> exportSessionKeys(
+          const std::function<bool(std::size_t, std::size_t)> &progress);
 
         //
         // Inbound Megolm Sessions
         //
         void saveInboundMegolmSession(const MegolmSessionIndex &index,
                                       mtx::crypto::InboundGroupSessionPtr session);
-        OlmInboundGroupSession *getInboundMegolmSession(const MegolmSessionIndex &index);
+        //! Save several sessions in one transaction, e.g. the room keys of a sync.
+        void saveInboundMegolmSessions(
+          std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>> sessions);
+        std::shared_ptr<InboundGroupSession> getInboundMegolmSession(
+          const MegolmSessionIndex &index);
         bool inboundMegolmSessionExists(const MegolmSessionIndex &index);
+        InboundGroupSessionStats inboundMegolmSessionStats();
+        //! The estimated memory of the unpickled inbound megolm sessions.
+        std::size_t inboundMegolmSessionUsage();
+        //! Pickle the least recently used inbound megolm sessions, until the others use at most
+        //! bytes.
+        void trimInboundMegolmSessions(std::size_t bytes);
+        //! The estimated memory of the members of the rooms in memory.
+        std::size_t memberCacheUsage() { return members_.size() * MEMBER_BYTES; }
+        //! Drop the members of the least recently used rooms, until the others use at most bytes.
+        void trimMemberCache(std::size_t bytes) { members_.trim(bytes / MEMBER_BYTES); }
+        //! Read the budgets of the members and the inbound megolm sessions from the memory
+        //! profile again and evict what is over them.
+        void updateMemoryBudgets();
 
         //
         // Olm Sessions
         //
         void saveOlmSession(const std::string &curve25519, mtx::crypto::OlmSessionPtr session);
+        //! The ids of the sessions with a device, the most recently used first.
         std::vector<std::string> getOlmSessions(const std::string &curve25519);
         std::optional<mtx::crypto::OlmSessionPtr> getOlmSession(const std::string &curve25519,
                                                                 const std::string &session_id);
 
+        //
+        // Device keys
+        //
+        //! The stored device keys of the users. Users, whose devices were never queried, are
+        //! missing.
+        std::map<std::string, UserDeviceKeys> deviceKeys(const std::vector<std::string> &user_ids);
+        void saveDeviceKeys(const std::map<std::string, UserDeviceKeys> &keys);
+
         void saveOlmAccount(const std::string &pickled);
         std::string restoreOlmAccount();
 
@@ -230,6 +670,13 @@ signals:
         void newReadReceipts(const QString &room_id, const std::vector<QString> &event_ids);
         void roomReadStatus(const std::map<QString, bool> &status);
         void removeNotification(const QString &room_id, const QString &event_id);
+        //! The invites, which were accepted, declined or withdrawn by a sync.
+        void invitesRemoved(const std::vector<QString> &room_ids);
+        //! The rooms, which were tagged or untagged by a sync or left.
+        void tagsChanged(const TagChanges &changes);
+        //! Inbound megolm sessions of a room were saved, e.g. received or imported. Emitted from
+        //! the thread, which saved them.
+        void inboundMegolmSessionsReceived(const QString &room_id, const QStringList &session_ids);
 
 private:
         //! Save an invited room.
@@ -238,14 +685,16 @@ private:
                         lmdb::dbi &membersdb,
                         const mtx::responses::InvitedRoom &room);
 
-        //! Add a notification containing a user mention to the db.
-        void saveTimelineMentions(lmdb::txn &txn,
-                                  const std::string &room_id,
-                                  const QList<mtx::responses::Notification> &res);
+        //! The member of a room or empty, if the user isn't one.
+        std::optional<MemberCache::Member> member(const QString &room_id, const QString &user_id);
+        //! Update the member of a room in memory and in the search index of its members.
+        void insertMember(const QString &room_id,
+                          const QString &user_id,
+                          const QString &display_name,
+                          const QString &avatar_url);
+        void removeMember(const QString &room_id, const QString &user_id);
 
-        //! Get timeline items that a user was mentions in for a given room
-        mtx::responses::Notifications getTimelineMentionsForRoom(lmdb::txn &txn,
-                                                                 const std::string &room_id);
+        MentionsSummary mentionsSummary(lmdb::txn &txn);
 
         QString getInviteRoomName(lmdb::txn &txn, lmdb::dbi &statesdb, lmdb::dbi &membersdb);
         QString getInviteRoomTopic(lmdb::txn &txn, lmdb::dbi &statesdb);
@@ -253,23 +702,123 @@ private:
 
         std::string getLastEventId(lmdb::txn &txn, const std::string &room_id);
         DescInfo getLastMessageInfo(lmdb::txn &txn, const std::string &room_id);
+        //! Store the summary of the newest message of a room, which the room list shows.
+        void saveLastMessageInfo(lmdb::txn &txn, const std::string &room_id, const DescInfo &info);
+        //! Describe the newest stored message of a room again, e.g. after it was redacted.
+        void updateLastMessageInfo(lmdb::txn &txn, const std::string &room_id);
+        //! Whether a room has unread messages according to the receipts of its last event.
+        bool readStatusFromReceipts(const std::string &room_id);
+        //! Store the read status of rooms, so the next start doesn't calculate it again.
+        void saveReadStatus(const std::map<QString, bool> &status);
+        //! The untimed step of compactMessages, so deleteOldMessages doesn't count its steps as
+        //! background compactions too.
+        bool trimMessages(std::chrono::steady_clock::time_point deadline);
+
+        //! Read the info of a joined or invited room from the db.
+        std::optional<RoomInfo> readRoomInfo(lmdb::txn &txn, const std::string &room_id);
+        //! The members of a joined room, also those, which weren't lazy loaded.
+        int memberCount(lmdb::txn &txn, const std::string &room_id);
+        //! The shard of the session storage, which keeps the inbound megolm session of the key.
+        InboundGroupSessionShard &inboundMegolmShard(const std::string &key);
+        //! Look up an inbound megolm session, unpickling it from the db if it isn't in memory.
+        //! Requires the mutex of the shard.
+        InboundGroupSessionEntry *findInboundMegolmSession(InboundGroupSessionShard &shard,
+                                                           const std::string &key);
+        //! Keep an unpickled inbound megolm session in memory and evict the least recently
+        //! used ones of the shard. Requires the mutex of the shard.
+        InboundGroupSessionEntry *cacheInboundMegolmSession(
+          InboundGroupSessionShard &shard,
+          const std::string &key,
+          mtx::crypto::InboundGroupSessionPtr session);
+        //! Evict the least recently used inbound megolm sessions of the shard, until it keeps at
+        //! most maxSessions. Requires the mutex of the shard.
+        void evictInboundMegolmSessions(InboundGroupSessionShard &shard, std::size_t maxSessions);
+
+        //! Pickle and save the outbound megolm sessions of the rooms.
+        void persistOutboundMegolmSessions(const std::vector<std::string> &room_ids);
+
+        //! Fill the room info table from the db, if that didn't happen yet.
+        void loadRoomInfoTable();
+        //! Re-read the info of the given rooms into the table and drop the rooms that are gone.
+        void refreshRoomInfo(const std::vector<std::string> &rooms);
+        //! Save the state, the timeline and the room info of a joined room.
+        void saveJoinedRoom(lmdb::txn &txn,
+                            const std::string &room_id,
+                            const mtx::responses::JoinedRoom &room,
+                            const RoomSummary &summary,
+                            TagChanges &tagChanges,
+                            const nlohmann::json &rawEvents = nullptr);
+        //! Move a room in the tag index from the tags before to the tags after.
+        void updateTagIndex(lmdb::txn &txn,
+                            const std::string &room_id,
+                            const std::vector<std::string> &before,
+                            const std::vector<std::string> &after,
+                            TagChanges &changes);
+        //! Merge the summary of a sync into the stored one. Returns whether it changed.
+        bool saveRoomSummary(lmdb::txn &txn, lmdb::dbi &statesdb, const RoomSummary &summary);
+        //! The stored summary of a joined room, which is empty, if the server never sent one.
+        RoomSummary getRoomSummary(lmdb::txn &txn, lmdb::dbi &statesdb);
+        //! A stored member of a joined room. Lazy loading only stores some of them.
+        std::optional<MemberInfo> getMemberInfo(lmdb::txn &txn,
+                                                lmdb::dbi &membersdb,
+                                                const std::string &user_id);
+        //! rawEvents are the received JSON of the timeline events, if they are available.
         void saveTimelineMessages(lmdb::txn &txn,
                                   const std::string &room_id,
-                                  const mtx::responses::Timeline &res);
-
-        mtx::responses::Timeline getTimelineMessages(lmdb::txn &txn, const std::string &room_id);
+                                  const mtx::responses::Timeline &res,
+                                  const nlohmann::json &rawEvents = nullptr);
+        //! Strip the stored event, which the redaction redacts, like the server does, and drop
+        //! its media and plaintext.
+        void redactStoredEvent(lmdb::txn &txn,
+                               const std::string &room_id,
+                               const std::string &event_id,
+                               const nlohmann::json &redaction);
+        //! Remove the media stored for an mxc url, in full and as thumbnails. The files are
+        //! deleted by deleteRemovedMedia, once txn is committed.
+        void removeMedia(lmdb::txn &txn, const std::string &mxcUrl);
+        //! Delete the files of the removed media, whose entries are gone from the index.
+        void deleteRemovedMedia();
+        //! Queue the bodies of the messages and the redactions for the message index.
+        void indexMessages(const std::string &room_id,
+                           const std::vector<mtx::events::collections::TimelineEvents> &events);
+        //! Write the queued messages into the message index, after they were committed.
+        void flushMessageIndex();
+        //! Write the plaintext of the events, which were decrypted since the last flush.
+        void flushDecryptedEvents();
+
+        TimelineWindow getTimelineMessages(lmdb::txn &txn,
+                                           const std::string &room_id,
+                                           const std::string &before_event_id,
+                                           std::size_t limit);
+        NewerTimelineWindow getTimelineMessagesAfter(lmdb::txn &txn,
+                                                     const std::string &room_id,
+                                                     const std::string &after_event_id,
+                                                     std::size_t limit);
+        std::optional<mtx::events::collections::TimelineEvents> getFetchedEvent(
+          const std::string &room_id,
+          const std::string &event_id);
 
         //! Remove a room from the cache.
         // void removeLeftRoom(lmdb::txn &txn, const std::string &room_id);
+        //! Returns whether the events may change the name, topic, avatar or version of the room.
         template<class T>
-        void saveStateEvents(lmdb::txn &txn,
+        bool saveStateEvents(lmdb::txn &txn,
                              const lmdb::dbi &statesdb,
                              const lmdb::dbi &membersdb,
                              const std::string &room_id,
                              const std::vector<T> &events)
         {
-                for (const auto &e : events)
+                using Create = mtx::events::StateEvent<mtx::events::state::Create>;
+
+                bool summaryChanged = false;
+                for (const auto &e : events) {
                         saveStateEvent(txn, statesdb, membersdb, room_id, e);
+
+                        if (containsStateUpdates(e) || std::holds_alternative<Create>(e))
+                                summaryChanged = true;
+                }
+
+                return summaryChanged;
         }
 
         template<class T>
@@ -299,15 +848,12 @@ private:
                                 lmdb::dbi_put(txn,
                                               membersdb,
                                               lmdb::val(e->state_key),
-                                              lmdb::val(json(tmp).dump()));
-
-                                insertDisplayName(QString::fromStdString(room_id),
-                                                  QString::fromStdString(e->state_key),
-                                                  QString::fromStdString(display_name));
+                                              lmdb::val(encodeValue(tmp)));
 
-                                insertAvatarUrl(QString::fromStdString(room_id),
-                                                QString::fromStdString(e->state_key),
-                                                QString::fromStdString(e->content.avatar_url));
+                                insertMember(QString::fromStdString(room_id),
+                                             QString::fromStdString(e->state_key),
+                                             QString::fromStdString(display_name),
+                                             QString::fromStdString(e->content.avatar_url));
 
                                 break;
                         }
@@ -315,10 +861,8 @@ private:
                                 lmdb::dbi_del(
                                   txn, membersdb, lmdb::val(e->state_key), lmdb::val(""));
 
-                                removeDisplayName(QString::fromStdString(room_id),
-                                                  QString::fromStdString(e->state_key));
-                                removeAvatarUrl(QString::fromStdString(room_id),
-                                                QString::fromStdString(e->state_key));
+                                removeMember(QString::fromStdString(room_id),
+                                             QString::fromStdString(e->state_key));
 
                                 break;
                         }
@@ -344,112 +888,122 @@ private:
         template<class T>
         bool isStateEvent(const T &e)
         {
-                using namespace mtx::events;
-                using namespace mtx::events::state;
-
-                return std::holds_alternative<StateEvent<Aliases>>(e) ||
-                       std::holds_alternative<StateEvent<state::Avatar>>(e) ||
-                       std::holds_alternative<StateEvent<CanonicalAlias>>(e) ||
-                       std::holds_alternative<StateEvent<Create>>(e) ||
-                       std::holds_alternative<StateEvent<GuestAccess>>(e) ||
-                       std::holds_alternative<StateEvent<HistoryVisibility>>(e) ||
-                       std::holds_alternative<StateEvent<JoinRules>>(e) ||
-                       std::holds_alternative<StateEvent<Name>>(e) ||
-                       std::holds_alternative<StateEvent<Member>>(e) ||
-                       std::holds_alternative<StateEvent<PowerLevels>>(e) ||
-                       std::holds_alternative<StateEvent<Topic>>(e);
+                return event_traits::isState(e);
         }
 
         template<class T>
         bool containsStateUpdates(const T &e)
         {
-                using namespace mtx::events;
-                using namespace mtx::events::state;
-
-                return std::holds_alternative<StateEvent<state::Avatar>>(e) ||
-                       std::holds_alternative<StateEvent<CanonicalAlias>>(e) ||
-                       std::holds_alternative<StateEvent<Name>>(e) ||
-                       std::holds_alternative<StateEvent<Member>>(e) ||
-                       std::holds_alternative<StateEvent<Topic>>(e);
+                return event_traits::updatesSummary(e);
         }
 
-        bool containsStateUpdates(const mtx::events::collections::StrippedEvents &e)
+        //! The invites, which a write txn saved or removed. They are applied to invites_, once it
+        //! was committed.
+        struct InviteChanges
         {
-                using namespace mtx::events;
-                using namespace mtx::events::state;
-
-                return std::holds_alternative<StrippedEvent<state::Avatar>>(e) ||
-                       std::holds_alternative<StrippedEvent<CanonicalAlias>>(e) ||
-                       std::holds_alternative<StrippedEvent<Name>>(e) ||
-                       std::holds_alternative<StrippedEvent<Member>>(e) ||
-                       std::holds_alternative<StrippedEvent<Topic>>(e);
-        }
+                //! The saved invites with the digest of their invite state.
+                std::map<std::string, std::size_t> saved;
+                std::vector<std::string> removed;
+        };
 
+        //! Save the invites, whose invite state changed since it was saved last.
         void saveInvites(lmdb::txn &txn,
-                         const std::map<std::string, mtx::responses::InvitedRoom> &rooms);
-
-        //! Sends signals for the rooms that are removed.
-        void removeLeftRooms(lmdb::txn &txn,
-                             const std::map<std::string, mtx::responses::LeftRoom> &rooms)
+                         const std::map<std::string, mtx::responses::InvitedRoom> &rooms,
+                         InviteChanges &changes);
+        //! Remove the invites of the rooms, which were joined or left, if they are invites.
+        template<class Rooms>
+        void removeInvites(lmdb::txn &txn, const Rooms &rooms, InviteChanges &changes)
         {
                 for (const auto &room : rooms) {
-                        removeRoom(txn, room.first);
+                        {
+                                std::unique_lock<std::mutex> lock(invitesMutex_);
+                                if (!invites_.count(room.first))
+                                        continue;
+                        }
 
-                        // Clean up leftover invites.
                         removeInvite(txn, room.first);
+                        changes.removed.push_back(room.first);
                 }
         }
+        //! Update invites_ after the txn with the changes was committed and tell the room list
+        //! about the removed invites.
+        void applyInviteChanges(const InviteChanges &changes);
 
+        //! Sends signals for the rooms that are removed.
+        void removeLeftRooms(lmdb::txn &txn,
+                             const std::map<std::string, mtx::responses::LeftRoom> &rooms,
+                             TagChanges &tagChanges)
+        {
+                for (const auto &room : rooms)
+                        removeRoom(txn, room.first, tagChanges);
+        }
+
+        //! Events we expect read receipts for, keyed by receiptKey.
         lmdb::dbi getPendingReceiptsDb(lmdb::txn &txn)
         {
-                return lmdb::dbi::open(txn, "pending_receipts", MDB_CREATE);
+                return openDb(txn, "pending_receipts");
         }
 
+        //! Timeline events of a room, keyed by messageKey. Oldest events come first.
         lmdb::dbi getMessagesDb(lmdb::txn &txn, const std::string &room_id)
         {
-                auto db =
-                  lmdb::dbi::open(txn, std::string(room_id + "/messages").c_str(), MDB_CREATE);
-                lmdb::dbi_set_compare(txn, db, numeric_key_comparison);
+                return openDb(txn, room_id + "/messages");
+        }
 
-                return db;
+        //! Index of the timeline events of a room.
+        //! Format: event_id -> key of the event in the messages db.
+        lmdb::dbi getEventIndexDb(lmdb::txn &txn, const std::string &room_id)
+        {
+                return openDb(txn, room_id + "/event_index");
+        }
+
+        //! Events of a room, which were retrieved one by one and aren't part of the stored
+        //! timeline. Format: event_id -> event
+        lmdb::dbi getFetchedEventsDb(lmdb::txn &txn, const std::string &room_id)
+        {
+                return openDb(txn, room_id + "/fetched_events");
         }
 
         lmdb::dbi getInviteStatesDb(lmdb::txn &txn, const std::string &room_id)
         {
-                return lmdb::dbi::open(
-                  txn, std::string(room_id + "/invite_state").c_str(), MDB_CREATE);
+                return openDb(txn, room_id + "/invite_state");
         }
 
         lmdb::dbi getInviteMembersDb(lmdb::txn &txn, const std::string &room_id)
         {
-                return lmdb::dbi::open(
-                  txn, std::string(room_id + "/invite_members").c_str(), MDB_CREATE);
+                return openDb(txn, room_id + "/invite_members");
         }
 
         lmdb::dbi getStatesDb(lmdb::txn &txn, const std::string &room_id)
         {
-                return lmdb::dbi::open(txn, std::string(room_id + "/state").c_str(), MDB_CREATE);
+                return openDb(txn, room_id + "/state");
         }
 
         lmdb::dbi getMembersDb(lmdb::txn &txn, const std::string &room_id)
         {
-                return lmdb::dbi::open(txn, std::string(room_id + "/members").c_str(), MDB_CREATE);
-        }
-
-        lmdb::dbi getMentionsDb(lmdb::txn &txn, const std::string &room_id)
-        {
-                return lmdb::dbi::open(txn, std::string(room_id + "/mentions").c_str(), MDB_CREATE);
+                return openDb(txn, room_id + "/members");
         }
 
         //! Retrieves or creates the database that stores the open OLM sessions between our device
         //! and the given curve25519 key which represents another device.
         //!
         //! Each entry is a map from the session_id to the pickled representation of the session.
+        //! It is part of the crypto environment, so txn must be a crypto write transaction.
         lmdb::dbi getOlmSessionsDb(lmdb::txn &txn, const std::string &curve25519_key)
         {
-                return lmdb::dbi::open(
-                  txn, std::string("olm_sessions/" + curve25519_key).c_str(), MDB_CREATE);
+                const auto name = "olm_sessions/" + curve25519_key;
+                if (auto dbi = cryptoDbis_.find(name))
+                        return lmdb::dbi(*dbi);
+
+                auto db = lmdb::dbi::open(txn, name.c_str(), MDB_CREATE);
+                cryptoDbis_.opened(txn.handle(), name, db.handle());
+
+                return db;
         }
+        //! The olm sessions database, if it exists. A database, which wasn't opened before, is
+        //! opened by a crypto write transaction of its own, so this must not be called during
+        //! one.
+        std::optional<lmdb::dbi> findOlmSessionsDb(const std::string &curve25519_key);
 
         QString getDisplayName(const mtx::events::StateEvent<mtx::events::state::Member> &event)
         {
@@ -459,28 +1013,254 @@ private:
                 return QString::fromStdString(event.state_key);
         }
 
+        //! A step from one cache format to the next.
+        struct Migration
+        {
+                std::string version;
+                std::function<bool()> run;
+                //! Deferred until after the startup.
+                bool background;
+        };
+        std::vector<Migration> migrations();
+        //! The formats, whose deferred migrations didn't finish yet.
+        std::vector<std::string> pendingMigrations();
+        void savePendingMigrations(lmdb::txn &txn, const std::vector<std::string> &versions);
+
+        //! Convert the message keys from the decimal timestamps to messageKey.
+        bool migrateMessageKeys();
+        //! Populate the event index from the existing messages.
+        bool buildEventIndex();
+        //! Re-encode the JSON values of the databases using encodeValue.
+        bool encodeValues();
+        //! Train the dictionary of the compression, if there is none, and compress the stored
+        //! messages with it.
+        bool compressMessages();
+        //! Fill the last messages db from the newest messages of every room.
+        bool buildLastMessages();
+        //! Fill the tag index from the tags in the room infos.
+        bool buildTagIndex();
+        //! Convert the JSON keys of the read and pending receipts to receiptKey.
+        bool migrateReceiptKeys();
+        //! Move the media blobs of the media db into the media store.
+        bool migrateMedia();
+        //! Move the mentions of the per room dbs into the time ordered mentions dbs.
+        bool migrateMentions();
+        //! Keep only the newest receipt of every user from the receipts per event.
+        bool migrateUserReceipts();
+        //! Move the olm account and the olm and megolm sessions into the crypto environment.
+        bool migrateCryptoEnvironment();
+
+        //! Lookup the media store entry of key, without updating its access time.
+        std::optional<nlohmann::json> mediaEntry(lmdb::txn &txn, const std::string &key) const;
+        //! Set the access time of the entry of key, or remove it, if atime is 0. Nothing
+        //! happens, if the entry points to another file by now.
+        void updateMediaEntry(const std::string &key, const std::string &file, qint64 atime);
+        //! Remove the least recently used media, until the store is within its budget.
+        void evictMedia();
+
         void setNextBatchToken(lmdb::txn &txn, const std::string &token);
         void setNextBatchToken(lmdb::txn &txn, const QString &token);
+        //! Keep the to-device messages of a sync, until they are handled.
+        void savePendingToDevice(lmdb::txn &txn, const std::vector<nlohmann::json> &msgs);
+
+        MapTxn beginTxn(unsigned int flags = 0)
+        {
+                return MapTxn(env_, mapMutex_, dbis_, readers_, flags, NHEKO_METRIC("write txn"));
+        }
+
+        //! Open a named database, reusing its handle if it was opened before.
+        lmdb::dbi openDb(lmdb::txn &txn, const std::string &name)
+        {
+                if (auto dbi = dbis_.find(name))
+                        return lmdb::dbi(*dbi);
+
+                auto db = lmdb::dbi::open(txn, name.c_str(), MDB_CREATE);
+                dbis_.opened(txn.handle(), name, db.handle());
+
+                return db;
+        }
+        //! Delete a named database, which closes its handle.
+        void dropDb(lmdb::txn &txn, const std::string &name)
+        {
+                lmdb::dbi_drop(txn, openDb(txn, name), true);
+                dbis_.dropped(txn.handle(), name);
+        }
+        //! Open a named database in a read-only transaction, if it exists.
+        std::optional<lmdb::dbi> findDb(lmdb::txn &txn, const std::string &name)
+        {
+                if (auto dbi = dbis_.find(name))
+                        return lmdb::dbi(*dbi);
+
+                auto dbi = openExistingDb(txn, name);
+                if (dbi)
+                        dbis_.opened(txn.handle(), name, dbi->handle());
+                return dbi;
+        }
+        static std::optional<lmdb::dbi> openExistingDb(lmdb::txn &txn, const std::string &name)
+        {
+                MDB_dbi dbi;
+                const int err = mdb_dbi_open(txn.handle(), name.c_str(), 0, &dbi);
+                if (err == MDB_NOTFOUND)
+                        return std::nullopt;
+                if (err != MDB_SUCCESS)
+                        lmdb::error::raise("mdb_dbi_open", err);
+
+                return lmdb::dbi(dbi);
+        }
+
+        //! A transaction of the crypto environment. Its commits are small and synced right away,
+        //! so saving a key never waits for a large commit of the room state.
+        //!
+        //! Nothing is committed to both environments at once. The sync token is saved with the
+        //! room state, and the keys a sync delivers are saved by their own commits, which are
+        //! durable once they return. The olm account and the outbound sessions are saved before
+        //! anything encrypted with them is sent.
+        MapTxn beginCryptoTxn(unsigned int flags = 0)
+        {
+                return MapTxn(cryptoEnv_,
+                              cryptoMapMutex_,
+                              cryptoDbis_,
+                              cryptoReaders_,
+                              flags,
+                              NHEKO_METRIC("crypto write txn"));
+        }
+        //! Commit the writes in a crypto transaction, growing the map and retrying them, if it is
+        //! full. They may run twice, so they must not have other side effects.
+        void writeCrypto(const std::function<void(lmdb::txn &)> &write);
+        //! Double the size of the crypto map, like growMapSize.
+        bool growCryptoMapSize();
+        static MapSizeInfo mapSizeInfo(lmdb::env &env);
 
         lmdb::env env_;
+        //! Held shared by every transaction, and exclusively to resize the map.
+        std::shared_mutex mapMutex_;
+        DbiRegistry dbis_;
+        //! Declared after env_, so the pooled transactions are aborted before it is closed.
+        ReaderPool readers_;
+        //! The olm account and the olm and megolm sessions, see beginCryptoTxn.
+        lmdb::env cryptoEnv_;
+        std::shared_mutex cryptoMapMutex_;
+        DbiRegistry cryptoDbis_;
+        //! Declared after cryptoEnv_, like readers_.
+        ReaderPool cryptoReaders_;
+        //! Commits are not synced to disk, until flushToDisk is called.
+        std::atomic_bool relaxedDurability_{false};
         lmdb::dbi syncStateDb_;
         lmdb::dbi roomsDb_;
         lmdb::dbi invitesDb_;
-        lmdb::dbi mediaDb_;
-        lmdb::dbi readReceiptsDb_;
+        lmdb::dbi removedRoomsDb_;
+        lmdb::dbi mediaIndexDb_;
+        lmdb::dbi userReceiptsDb_;
         lmdb::dbi notificationsDb_;
+        lmdb::dbi readStatusDb_;
+        lmdb::dbi lastMessagesDb_;
+        lmdb::dbi userColorsDb_;
+        lmdb::dbi imageDimensionsDb_;
+        lmdb::dbi pendingToDeviceDb_;
+        lmdb::dbi outboxDb_;
+        lmdb::dbi mentionsDb_;
+        lmdb::dbi roomMentionsDb_;
+        lmdb::dbi communitiesDb_;
+        lmdb::dbi tagsDb_;
 
         lmdb::dbi devicesDb_;
         lmdb::dbi deviceKeysDb_;
 
         lmdb::dbi inboundMegolmSessionDb_;
         lmdb::dbi outboundMegolmSessionDb_;
+        lmdb::dbi olmSessionUsageDb_;
+        lmdb::dbi cryptoStateDb_;
+        lmdb::dbi encryptedRoomsDb_;
+        lmdb::dbi decryptedEventsDb_;
+        lmdb::dbi decryptedEventsOrderDb_;
 
         QString localUserId_;
         QString cacheDirectory_;
+        QString mediaDirectory_;
+
+        //! How many bytes the media store may use.
+        uint64_t mediaBudget_ = 0;
+        //! The members, which make a room a large room, or 0.
+        int largeRoomMembers_ = 0;
+        //! Whether the rooms, which were checked, are large rooms. A sync drops the rooms it
+        //! changed, so their members are counted at most once per sync.
+        std::unordered_map<std::string, bool> largeRooms_;
+        std::mutex largeRoomsMutex_;
+        //! How many bytes the files of the media store use.
+        std::atomic<uint64_t> mediaSize_{0};
+        std::atomic<bool> evictingMedia_{false};
+        //! The media removed by transactions, which may not be committed yet.
+        //! Format: key -> (file, size)
+        std::map<std::string, std::pair<std::string, uint64_t>> removedMedia_;
+        std::mutex removedMediaMutex_;
+
+        //! The info of all joined and invited rooms. Only the rooms changed by a sync are read
+        //! from the db again, the other lookups are answered from here.
+        std::map<std::string, RoomInfo> roomInfoTable_;
+        bool roomInfoTableLoaded_ = false;
+        std::shared_mutex roomInfoMutex_;
+        //! The full-text index of the messages, unless it is disabled.
+        std::unique_ptr<MessageIndex> messageIndex_;
+
+        //! The key of DECRYPTED_EVENTS_DB. Empty, if the plaintext isn't kept.
+        QByteArray plaintextKey_;
+        //! The sealed plaintext by event id, which wasn't written yet. Decryptions finish one by
+        //! one, so they are written in batches.
+        std::map<std::string, std::string> pendingPlaintext_;
+        std::mutex plaintextMutex_;
+
+        //! Serializes the compaction and the room it is trimming, which may take several calls.
+        std::mutex compactionMutex_;
+        std::string compactionRoom_;
+
+        //! The parsed power levels of the rooms, which were checked, and the stored event they
+        //! were parsed from. A check only parses the event again, if the stored one differs.
+        struct ParsedPowerLevels
+        {
+                std::string event;
+                mtx::events::state::PowerLevels levels;
+                //! notifications.room, which mtxclient doesn't parse.
+                int64_t notifyRoom = 50;
+        };
+        std::unordered_map<std::string, ParsedPowerLevels> powerLevels_;
+        std::mutex powerLevelsMutex_;
+        //! The parsed power levels of the room, parsed again if the stored event changed. Needs
+        //! powerLevelsMutex_. Null, if the room has no power levels.
+        const ParsedPowerLevels *parsedPowerLevels(lmdb::txn &txn, const std::string &room_id);
+        //! The encrypted rooms, read at startup. Encryption can't be turned off again, so the set
+        //! only grows. It is replaced by a copy with the new room, so a lookup doesn't wait for
+        //! the writers or a transaction. Loading the pointer isn't lock-free, though: libstdc++
+        //! guards it with a mutex from a small pool and counts a reference.
+        std::shared_ptr<const std::unordered_set<std::string>> encryptedRooms_ =
+          std::make_shared<const std::unordered_set<std::string>>();
+        //! Serializes the additions to the encrypted rooms.
+        std::mutex encryptedRoomsMutex_;
+        //! The invited rooms with the digest of their invite state, or 0, if it wasn't saved since
+        //! the start. A sync only writes the invites, which are new or changed.
+        std::map<std::string, std::size_t> invites_;
+        std::mutex invitesMutex_;
+
+        //! The estimated memory of a member in members_: the strings, the interned user id and
+        //! the hash nodes.
+        static constexpr std::size_t MEMBER_BYTES = 200;
+        //! The members of the recently used rooms, within the budget of the memory profile.
+        MemberCache members_{memory::budget(memory::Layer::Members) / MEMBER_BYTES};
+        //! The estimated memory of an unpickled inbound megolm session with its entry.
+        static constexpr std::size_t MEGOLM_SESSION_BYTES = 512;
+        //! How many inbound megolm sessions each shard of the session storage may keep
+        //! unpickled in the current memory profile.
+        static std::size_t inboundMegolmSessionsPerShard()
+        {
+                return std::max<std::size_t>(memory::budget(memory::Layer::MegolmSessions) /
+                                               MEGOLM_SESSION_BYTES / INBOUND_GROUP_SESSION_SHARDS,
+                                             1);
+        }
+        std::atomic<std::size_t> maxInboundMegolmSessionsPerShard_{inboundMegolmSessionsPerShard()};
 
-        static QHash<QString, QString> DisplayNames;
-        static QHash<QString, QString> AvatarUrls;
+        //! The display names of the members of every room, that was searched already. The
+        //! index of a room is built on its first search and kept up to date afterwards.
+        static std::map<std::string, SearchIndex> MemberSearchIndex;
+        static std::shared_mutex MemberSearchMutex;
 
         OlmSessionStorage session_storage;
 };
@@ -15,29 +15,51 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+#include <atomic>
+#include <map>
+#include <optional>
+#include <unordered_set>
+
 #include <QApplication>
+#include <QBuffer>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
 #include <QImageReader>
 #include <QSettings>
 #include <QShortcut>
+#include <QFutureWatcher>
+#include <QThread>
 #include <QtConcurrent>
 
 #include "AvatarProvider.h"
 #include "Cache.h"
 #include "Cache_p.h"
 #include "ChatPage.h"
+#include "EventAccessors.h"
 #include "Logging.h"
 #include "MainWindow.h"
 #include "MatrixClient.h"
+#include "MediaUpload.h"
+#include "MemoryGovernor.h"
+#include "NetworkUsage.h"
 #include "Olm.h"
+#include "PerfReport.h"
+#include "PushRuleEvaluator.h"
 #include "QuickSwitcher.h"
+#include "RequestScheduler.h"
 #include "RoomList.h"
 #include "SideBarActions.h"
+#include "Startup.h"
 #include "Splitter.h"
 #include "TextInputWidget.h"
 #include "TopRoomBar.h"
+#include "Trace.h"
 #include "UserInfoWidget.h"
 #include "UserSettingsPage.h"
 #include "Utils.h"
+#include "Wakeups.h"
 #include "ui/OverlayModal.h"
 #include "ui/Theme.h"
 
@@ -45,6 +67,7 @@
 
 #include "dialogs/ReadReceipts.h"
 #include "popups/UserMentions.h"
+#include "timeline/TimelineModel.h"
 #include "timeline/TimelineViewManager.h"
 
 #include "blurhash.hpp"
@@ -52,13 +75,317 @@
 // TODO: Needs to be updated with an actual secret.
 static const std::string STORAGE_SECRET_KEY("secret");
 
+QString ChatPage::replayDirectory_;
+QString ChatPage::recordDirectory_;
 ChatPage *ChatPage::instance_             = nullptr;
+int ChatPage::replayInterval_             = 0;
+bool ChatPage::quitAfterReplay_           = false;
 constexpr int CHECK_CONNECTIVITY_INTERVAL = 15'000;
-constexpr int RETRY_TIMEOUT               = 5'000;
+constexpr int COMPACTION_INTERVAL         = 1'000;
+//! How long a single compaction step may keep the database busy.
+constexpr int COMPACTION_STEP_BUDGET = 50;
+//! How many one-time keys the server should have and below which count they are refilled. The
+//! keys are generated in large batches, instead of one for every key the server handed out.
 constexpr size_t MAX_ONETIME_KEYS         = 50;
+constexpr size_t REFILL_ONETIME_KEYS      = 25;
+//! After how many syncs the room list snapshot is refreshed.
+constexpr int ROOM_LIST_SNAPSHOT_INTERVAL = 100;
+//! After how many syncs the sync timings are logged.
+constexpr int SYNC_STATS_INTERVAL = 100;
+//! How often the commits are synced to disk, if the cache doesn't sync every commit.
+constexpr int DISK_SYNC_INTERVAL = 5'000;
+//! The unread count is shown at most this often.
+constexpr int UNREAD_COUNT_INTERVAL = 1'000;
+//! How many events of every room the initial sync and the later syncs return by default. See
+//! user/sync/initial_timeline_limit and user/sync/timeline_limit.
+constexpr int INITIAL_SYNC_TIMELINE_LIMIT = 10;
+constexpr int SYNC_TIMELINE_LIMIT         = 50;
+//! The most events of a loaded room, which are queued while the window is hidden.
+constexpr std::size_t HIDDEN_TIMELINE_LIMIT = 500;
+//! Above how many new notifications of a room a single summary is shown instead.
+constexpr std::size_t NOTIFICATION_SUMMARY_THRESHOLD = 3;
+//! The size of the room avatars in the desktop notifications.
+constexpr int NOTIFICATION_ICON_SIZE = 128;
+//! How many mentions are requested at once. Older pages are only requested, while all mentions of
+//! a page are new, up to the total.
+constexpr int MENTIONS_PAGE_SIZE   = 50;
+constexpr int MAX_FETCHED_MENTIONS = 1000;
+
+namespace {
+//! The blurhash only describes the rough colors of an image, so it is computed from a tiny copy.
+constexpr int BLURHASH_SIZE = 32;
+
+QString
+imageBlurhash(const QImage &image)
+{
+        if (image.isNull())
+                return QString();
+
+        const auto img = image
+                           .scaled(BLURHASH_SIZE,
+                                   BLURHASH_SIZE,
+                                   Qt::KeepAspectRatio,
+                                   Qt::SmoothTransformation)
+                           .convertToFormat(QImage::Format_RGB888);
+
+        // The rows of a QImage are padded, the encoder expects packed RGB.
+        std::vector<unsigned char> data;
+        data.reserve(img.width() * img.height() * 3);
+        for (int y = 0; y < img.height(); y++) {
+                const auto line = img.constScanLine(y);
+                data.insert(data.end(), line, line + img.width() * 3);
+        }
+
+        return QString::fromStdString(
+          blurhash::encode(data.data(), img.width(), img.height(), 4, 3));
+}
+
+//! The bounds of the thumbnail, which is uploaded along with a larger image.
+constexpr int THUMBNAIL_WIDTH  = 800;
+constexpr int THUMBNAIL_HEIGHT = 600;
+
+//! The info of an image to upload and its thumbnail, computed in the background.
+struct ImagePreview
+{
+        mtx::common::ImageInfo info;
+        //! Empty, if the image is small enough to be shown itself.
+        QByteArray thumbnail;
+        mtx::common::ThumbnailInfo thumbnailInfo;
+};
+
+ImagePreview
+imagePreview(QByteArray data)
+{
+        ImagePreview preview;
+
+        const auto dimensions = utils::imageSize(&data);
+        preview.info.w        = dimensions.width();
+        preview.info.h        = dimensions.height();
+        preview.info.blurhash =
+          imageBlurhash(utils::readImage(&data, QSize(BLURHASH_SIZE, BLURHASH_SIZE)))
+            .toStdString();
+
+        if (dimensions.width() <= THUMBNAIL_WIDTH && dimensions.height() <= THUMBNAIL_HEIGHT)
+                return preview;
+
+        const auto image = utils::readImage(&data, QSize(THUMBNAIL_WIDTH, THUMBNAIL_HEIGHT))
+                             .scaled(THUMBNAIL_WIDTH,
+                                     THUMBNAIL_HEIGHT,
+                                     Qt::KeepAspectRatio,
+                                     Qt::SmoothTransformation);
+        if (image.isNull())
+                return preview;
+
+        auto thumbnail = utils::encodeImage(image);
+        // E.g. a large, but well compressed PNG.
+        if (thumbnail.size() >= data.size())
+                return preview;
+
+        preview.thumbnail              = std::move(thumbnail);
+        preview.thumbnailInfo.w        = image.width();
+        preview.thumbnailInfo.h        = image.height();
+        preview.thumbnailInfo.size     = preview.thumbnail.size();
+        preview.thumbnailInfo.mimetype = image.hasAlphaChannel() ? "image/png" : "image/jpeg";
+        return preview;
+}
+
+int64_t
+steadyMicroseconds()
+{
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+}
+
+//! The number of rooms and events in a sync response.
+void
+recordSyncCounts(const mtx::responses::Sync &res)
+{
+        uint64_t events = 0;
+        for (const auto &room : res.rooms.join)
+                events += room.second.state.events.size() + room.second.timeline.events.size();
+        for (const auto &room : res.rooms.leave)
+                events += room.second.state.events.size() + room.second.timeline.events.size();
+
+        cache::recordCount(NHEKO_METRIC("sync rooms"),
+                           res.rooms.join.size() + res.rooms.invite.size() +
+                             res.rooms.leave.size());
+        cache::recordCount(NHEKO_METRIC("sync events"), events);
+        cache::recordCount(NHEKO_METRIC("sync to-device messages"), res.to_device.size());
+}
+
+//! The members of the rooms are lazy loaded and the events we don't show are left out. The lite
+//! filter also leaves out the typing notifications.
+nlohmann::json
+syncFilterDefinition(int timeline_limit, bool lite)
+{
+        nlohmann::json definition = {
+          {"presence", {{"not_types", {"*"}}}},
+          {"room",
+           {{"state", {{"lazy_load_members", true}}},
+            {"timeline", {{"limit", timeline_limit}, {"lazy_load_members", true}}}}},
+        };
+
+        if (lite)
+                definition["room"]["ephemeral"] = {{"not_types", {"m.typing"}}};
+
+        return definition;
+}
+
+//! Write a sync response to directory, named by the order of the syncs, so the replay reads them
+//! in the same order.
+void
+recordSync(const QString &directory, const nlohmann::json &raw)
+{
+        static std::atomic<int> recorded = 0;
+
+        const auto path = QString("%1/%2-%3.json")
+                            .arg(directory)
+                            .arg(QDateTime::currentMSecsSinceEpoch())
+                            .arg(recorded++, 6, 10, QChar('0'));
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly)) {
+                nhlog::net()->warn("failed to record the sync to {}", path.toStdString());
+                return;
+        }
+        file.write(QByteArray::fromStdString(raw.dump()));
+}
+
+//! The same request as mtx::http::Client::sync, but the response keeps the room summaries, which
+//! mtxclient drops. They name the rooms without a name, since the members are lazy loaded. The
+//! callback also gets the response as it was received, so the events can be stored without
+//! serializing them again. With a record directory, the response is recorded, see recordSync.
+void
+requestSync(
+  const mtx::http::SyncOpts &opts,
+  const QString &record,
+  std::function<void(const SyncResponse &, const nlohmann::json &, mtx::http::RequestErr)> callback)
+{
+        std::map<std::string, std::string> params;
+        if (!opts.filter.empty())
+                params.emplace("filter", opts.filter);
+        if (!opts.since.empty())
+                params.emplace("since", opts.since);
+        if (opts.full_state)
+                params.emplace("full_state", "true");
+        params.emplace("timeout", std::to_string(opts.timeout));
+
+        http::client()->get<nlohmann::json>(
+          "/client/r0/sync?" + mtx::client::utils::query_params(params),
+          [record, callback = std::move(callback)](
+            const nlohmann::json &raw, mtx::http::HeaderFields, mtx::http::RequestErr err) {
+                  if (err) {
+                          callback({}, nullptr, err);
+                          return;
+                  }
+
+                  // The body isn't handed out, so its size is that of the compact json. The
+                  // server may send it formatted or compressed.
+                  http::countBytes(http::Traffic::Sync, raw.dump().size());
+
+                  if (!record.isEmpty())
+                          recordSync(record, raw);
+
+                  SyncResponse res;
+                  try {
+                          res = raw.get<SyncResponse>();
+                  } catch (const nlohmann::json::exception &e) {
+                          mtx::http::ClientError error;
+                          error.parse_error = e.what();
+                          callback({}, nullptr, error);
+                          return;
+                  }
+                  callback(res, raw, err);
+          });
+}
+
+//! Handle the to-device messages, which were saved with the syncs, also those a crash left
+//! behind. They are only forgotten, once they are handled.
+void
+handlePendingToDevice()
+{
+        const auto pending = cache::pendingToDeviceMessages();
+
+        // Still does the deferred save of the account.
+        if (pending.empty())
+                olm::handle_to_device_messages({});
+
+        for (const auto &[key, msgs] : pending) {
+                olm::handle_to_device_messages(msgs);
+                cache::removePendingToDeviceMessages(key);
+        }
+}
+
+//! Add the rooms of a sync to the ones queued while the window is hidden. The timelines of the
+//! rooms, which aren't loaded, only keep the newest events, since they only show the last
+//! message. A loaded room, which queued more than HIDDEN_TIMELINE_LIMIT events, is added to
+//! reloads and queues no more events, since it is reloaded from the cache instead.
+template<class IsLoaded>
+void
+mergeRooms(mtx::responses::Rooms &merged,
+           std::set<std::string> &reloads,
+           const mtx::responses::Rooms &rooms,
+           IsLoaded isLoaded)
+{
+        const auto stateKey = [](const mtx::events::collections::StateEvents &event) {
+                return std::visit(
+                  [](const auto &e) { return std::make_pair(to_string(e.type), e.state_key); },
+                  event);
+        };
+
+        for (const auto &[room_id, room] : rooms.join) {
+                merged.leave.erase(room_id);
+
+                auto [it, inserted] = merged.join.emplace(room_id, room);
+                auto &joined        = it->second;
+                if (!inserted) {
+                        // The newer state replaces the state of the same type and key.
+                        auto &state = joined.state.events;
+                        for (const auto &event : room.state.events) {
+                                const auto key = stateKey(event);
+                                auto old = std::find_if(state.begin(), state.end(), [&](auto &e) {
+                                        return stateKey(e) == key;
+                                });
+                                if (old != state.end())
+                                        *old = event;
+                                else
+                                        state.push_back(event);
+                        }
+
+                        joined.timeline.events.insert(joined.timeline.events.end(),
+                                                      room.timeline.events.begin(),
+                                                      room.timeline.events.end());
+                        for (const auto &[event_id, users] : room.ephemeral.receipts)
+                                for (const auto &[user_id, ts] : users)
+                                        joined.ephemeral.receipts[event_id][user_id] = ts;
+                        joined.ephemeral.typing     = room.ephemeral.typing;
+                        joined.unread_notifications = room.unread_notifications;
+                }
+
+                auto &events = joined.timeline.events;
+                if (!isLoaded(QString::fromStdString(room_id))) {
+                        const auto kept = static_cast<std::size_t>(SYNC_TIMELINE_LIMIT);
+                        if (events.size() > kept)
+                                events.erase(events.begin(), events.end() - kept);
+                } else if (reloads.count(room_id) || events.size() > HIDDEN_TIMELINE_LIMIT) {
+                        reloads.insert(room_id);
+                        events.clear();
+                }
+        }
+
+        for (const auto &[room_id, room] : rooms.leave) {
+                merged.join.erase(room_id);
+                merged.leave[room_id] = room;
+                reloads.erase(room_id);
+        }
+}
+}
 
 Q_DECLARE_METATYPE(std::optional<mtx::crypto::EncryptedFile>)
 Q_DECLARE_METATYPE(std::optional<RelatedInfo>)
+Q_DECLARE_METATYPE(SyncRooms)
+Q_DECLARE_METATYPE(RoomInfoUpdates)
+Q_DECLARE_METATYPE(TagChanges)
 
 ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
   : QWidget(parent)
@@ -70,6 +397,9 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
 
         qRegisterMetaType<std::optional<mtx::crypto::EncryptedFile>>();
         qRegisterMetaType<std::optional<RelatedInfo>>();
+        qRegisterMetaType<SyncRooms>();
+        qRegisterMetaType<RoomInfoUpdates>();
+        qRegisterMetaType<TagChanges>();
 
         topLayout_ = new QHBoxLayout(this);
         topLayout_->setSpacing(0);
@@ -134,6 +464,7 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
 
         typingRefresher_ = new QTimer(this);
         typingRefresher_->setInterval(TYPING_REFRESH_TIMEOUT);
+        wakeups::manage(typingRefresher_, "typing refresh");
 
         connect(this, &ChatPage::connectionLost, this, [this]() {
                 nhlog::net()->info("connectivity lost");
@@ -149,6 +480,8 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                 // Drop all pending connections.
                 http::client()->shutdown();
                 trySync();
+
+                view_manager_->drainOutbox();
         });
 
         connect(
@@ -167,32 +500,97 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                         user_mentions_popup_->hide();
                 } else {
                         showNotificationsDialog(mentionsPos);
-                        http::client()->notifications(
-                          1000,
-                          "",
-                          "highlight",
-                          [this, mentionsPos](const mtx::responses::Notifications &res,
-                                              mtx::http::RequestErr err) {
-                                  if (err) {
-                                          nhlog::net()->warn(
-                                            "failed to retrieve notifications: {} ({})",
-                                            err->matrix_error.error,
-                                            static_cast<int>(err->status_code));
-                                          return;
-                                  }
+                        fetchMentions("", 0);
+                }
+        });
 
-                                  emit highlightedNotifsRetrieved(std::move(res), mentionsPos);
-                          });
+        // A single thread keeps the sync responses in order.
+        syncWorker_.setMaxThreadCount(1);
+        syncWorker_.setExpiryTimeout(-1);
+
+        compactionTimer_.setInterval(COMPACTION_INTERVAL);
+        wakeups::manage(&compactionTimer_, "compaction");
+        connect(&compactionTimer_, &QTimer::timeout, this, [this]() {
+                // Leave the database to the sync, while it saves a response.
+                if (syncsInProgress_ > 0 || isCompacting_)
+                        return;
+
+                isCompacting_ = true;
+
+                QtConcurrent::run([this]() {
+                        bool hasMoreWork = false;
+
+                        try {
+                                const auto deadline =
+                                  std::chrono::steady_clock::now() +
+                                  std::chrono::milliseconds(COMPACTION_STEP_BUDGET);
+
+                                // Nothing reads the databases of the left rooms anymore.
+                                hasMoreWork = cache::reclaimRemovedRooms(deadline) ||
+                                              cache::compactMessages(deadline);
+                        } catch (const lmdb::error &e) {
+                                nhlog::db()->error("failed to compact the cache: {}", e.what());
+                        }
+
+                        isCompacting_ = false;
+
+                        if (!hasMoreWork)
+                                emit compactionFinished();
+                });
+        });
+        connect(this,
+                &ChatPage::compactionNeeded,
+                &compactionTimer_,
+                QOverload<>::of(&QTimer::start));
+        connect(this, &ChatPage::compactionFinished, &compactionTimer_, &QTimer::stop);
+
+        // Started by a sync, so an idle client doesn't wake up to flush nothing.
+        diskSyncTimer_.setSingleShot(true);
+        diskSyncTimer_.setInterval(DISK_SYNC_INTERVAL);
+        wakeups::manage(&diskSyncTimer_, "disk sync");
+        connect(&diskSyncTimer_, &QTimer::timeout, this, []() {
+                QtConcurrent::run([]() { cache::flushToDisk(); });
+        });
+
+        // The next start shows the room list of this session, while it restores the cache.
+        connect(QApplication::instance(), &QApplication::aboutToQuit, this, [this]() {
+                if (cache::client()) {
+                        cache::saveRoomListSnapshot();
+                        cache::saveOutboundMegolmSessions();
+                        // The account is only used from the sync worker.
+                        QtConcurrent::run(&syncWorker_, []() { olm::save_account(true); })
+                          .waitForFinished();
                 }
         });
 
+        unreadCountTimer_.setSingleShot(true);
+        unreadCountTimer_.setInterval(UNREAD_COUNT_INTERVAL);
+        wakeups::manage(&unreadCountTimer_, "unread count");
+        connect(&unreadCountTimer_, &QTimer::timeout, this, [this]() {
+                if (!unreadCountPending_)
+                        return;
+
+                unreadCountPending_ = false;
+                updateUnreadCount();
+                unreadCountTimer_.start();
+        });
+
+        memory::start();
+        perf::start();
+
         connectivityTimer_.setInterval(CHECK_CONNECTIVITY_INTERVAL);
+        wakeups::manage(&connectivityTimer_, "connectivity");
         connect(&connectivityTimer_, &QTimer::timeout, this, [=]() {
                 if (http::client()->access_token().empty()) {
                         connectivityTimer_.stop();
                         return;
                 }
 
+                // A sync got through, so there is no need to ask the server.
+                if (isConnected_ && syncScheduler_.succeededWithin(
+                                      std::chrono::milliseconds(CHECK_CONNECTIVITY_INTERVAL)))
+                        return;
+
                 http::client()->versions(
                   [this](const mtx::responses::Versions &, mtx::http::RequestErr err) {
                           if (err) {
@@ -238,6 +636,8 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
         connect(room_list_, &RoomList::roomChanged, text_input_, &TextInputWidget::focusLineEdit);
         connect(
           room_list_, &RoomList::roomChanged, view_manager_, &TimelineViewManager::setHistoryView);
+        connect(
+          room_list_, &RoomList::prefetchRoom, view_manager_, &TimelineViewManager::prefetchRoom);
 
         connect(room_list_, &RoomList::acceptInvite, this, [this](const QString &room_id) {
                 view_manager_->addRoom(room_id);
@@ -259,9 +659,10 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
 
                 typingRefresher_->stop();
 
-                if (current_room_.isEmpty())
+                if (current_room_.isEmpty() || cache::isLargeRoom(current_room_.toStdString()))
                         return;
 
+                http::countRequest(http::Traffic::Typing);
                 http::client()->stop_typing(
                   current_room_.toStdString(), [](mtx::http::RequestErr err) {
                           if (err) {
@@ -310,72 +711,119 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                           return;
                   }
 
-                  auto bin = dev->readAll();
                   QMimeDatabase db;
-                  QMimeType mime = db.mimeTypeForData(bin);
-
-                  auto payload = std::string(bin.data(), bin.size());
-                  std::optional<mtx::crypto::EncryptedFile> encryptedFile;
-                  if (cache::isRoomEncrypted(current_room_.toStdString())) {
-                          mtx::crypto::BinaryBuf buf;
-                          std::tie(buf, encryptedFile) = mtx::crypto::encrypt_file(payload);
-                          payload                      = mtx::crypto::to_string(buf);
-                  }
-
-                  QSize dimensions;
-                  QString blurhash;
-                  if (mimeClass == "image") {
-                          QImage img = utils::readImage(&bin);
-
-                          dimensions = img.size();
-                          if (img.height() > 200 && img.width() > 360)
-                                  img = img.scaled(360, 200, Qt::KeepAspectRatioByExpanding);
-                          std::vector<unsigned char> data;
-                          for (int y = 0; y < img.height(); y++) {
-                                  for (int x = 0; x < img.width(); x++) {
-                                          auto p = img.pixel(x, y);
-                                          data.push_back(static_cast<unsigned char>(qRed(p)));
-                                          data.push_back(static_cast<unsigned char>(qGreen(p)));
-                                          data.push_back(static_cast<unsigned char>(qBlue(p)));
-                                  }
-                          }
-                          blurhash = QString::fromStdString(
-                            blurhash::encode(data.data(), img.width(), img.height(), 4, 3));
+                  QMimeType mime = db.mimeTypeForData(dev.data());
+
+                  const auto room_id = current_room_;
+                  const bool encrypt = cache::isRoomEncrypted(room_id.toStdString());
+
+                  // The file is read, encrypted and sent in chunks, so it never has to fit into
+                  // memory.
+                  auto uploadFile = [this,
+                                     dev,
+                                     room_id,
+                                     encrypt,
+                                     filename = fn,
+                                     mimeClass,
+                                     mime = mime.name()](const mtx::common::ImageInfo &info) {
+                          const auto type = encrypt ? "application/octet-stream" : mime;
+                          auto upload = new MediaUpload(
+                            dev, QFileInfo(filename).fileName(), type, encrypt, this);
+
+                          connect(upload,
+                                  &MediaUpload::progress,
+                                  text_input_,
+                                  &TextInputWidget::setUploadProgress);
+                          connect(upload, &MediaUpload::failed, this, [this](const QString &) {
+                                  emit uploadFailed(
+                                    tr("Failed to upload media. Please try again."));
+                          });
+                          connect(
+                            upload,
+                            &MediaUpload::finished,
+                            this,
+                            [this, room_id, filename, mimeClass, mime, size = dev->size(), info](
+                              const QString &content_uri,
+                              std::optional<mtx::crypto::EncryptedFile> encryptedFile) {
+                                    emit mediaUploaded(room_id,
+                                                       filename,
+                                                       encryptedFile,
+                                                       content_uri,
+                                                       mimeClass,
+                                                       mime,
+                                                       size,
+                                                       info);
+                            });
+
+                          upload->start();
+                  };
+
+                  if (mimeClass != "image") {
+                          uploadFile({});
+                          return;
                   }
 
-                  http::client()->upload(
-                    payload,
-                    encryptedFile ? "application/octet-stream" : mime.name().toStdString(),
-                    QFileInfo(fn).fileName().toStdString(),
-                    [this,
-                     room_id  = current_room_,
-                     filename = fn,
-                     encryptedFile,
-                     mimeClass,
-                     mime = mime.name(),
-                     size = payload.size(),
-                     dimensions,
-                     blurhash](const mtx::responses::ContentURI &res, mtx::http::RequestErr err) {
-                            if (err) {
-                                    emit uploadFailed(
-                                      tr("Failed to upload media. Please try again."));
-                                    nhlog::net()->warn("failed to upload media: {} {} ({})",
-                                                       err->matrix_error.error,
-                                                       to_string(err->matrix_error.errcode),
-                                                       static_cast<int>(err->status_code));
+                  // Only images are read completely, for their size, blurhash and thumbnail,
+                  // which are computed in the background.
+                  auto watcher = new QFutureWatcher<ImagePreview>(this);
+                  connect(
+                    watcher,
+                    &QFutureWatcher<ImagePreview>::finished,
+                    this,
+                    [this, watcher, encrypt, uploadFile]() {
+                            watcher->deleteLater();
+                            const auto preview = watcher->result();
+                            if (preview.thumbnail.isEmpty()) {
+                                    uploadFile(preview.info);
                                     return;
                             }
 
-                            emit mediaUploaded(room_id,
-                                               filename,
-                                               encryptedFile,
-                                               QString::fromStdString(res.content_uri),
-                                               mimeClass,
-                                               mime,
-                                               size,
-                                               dimensions,
-                                               blurhash);
+                            // The thumbnail is uploaded first, so other clients and the timeline
+                            // don't have to download the whole image to show it. It is encrypted
+                            // like the image.
+                            auto buffer = QSharedPointer<QBuffer>::create();
+                            buffer->setData(preview.thumbnail);
+                            buffer->open(QIODevice::ReadOnly);
+
+                            const auto mimetype = QString::fromStdString(
+                              preview.thumbnailInfo.mimetype);
+                            auto upload = new MediaUpload(
+                              buffer,
+                              mimetype == "image/png" ? "thumbnail.png" : "thumbnail.jpg",
+                              encrypt ? "application/octet-stream" : mimetype,
+                              encrypt,
+                              this);
+
+                            connect(upload,
+                                    &MediaUpload::failed,
+                                    this,
+                                    [uploadFile, info = preview.info](const QString &) {
+                                            nhlog::net()->warn(
+                                              "failed to upload the thumbnail, sending the image "
+                                              "without it");
+                                            uploadFile(info);
+                                    });
+                            connect(upload,
+                                    &MediaUpload::finished,
+                                    this,
+                                    [uploadFile, preview](
+                                      const QString &content_uri,
+                                      std::optional<mtx::crypto::EncryptedFile> encryptedFile) {
+                                            auto info           = preview.info;
+                                            info.thumbnail_info = preview.thumbnailInfo;
+                                            if (encryptedFile) {
+                                                    encryptedFile->url = content_uri.toStdString();
+                                                    info.thumbnail_file = encryptedFile;
+                                            } else {
+                                                    info.thumbnail_url = content_uri.toStdString();
+                                            }
+
+                                            uploadFile(info);
+                                    });
+
+                            upload->start();
                     });
+                  watcher->setFuture(QtConcurrent::run(imagePreview, dev->peek(dev->size())));
           });
 
         connect(this, &ChatPage::uploadFailed, this, [this](const QString &msg) {
@@ -392,8 +840,7 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                        QString mimeClass,
                        QString mime,
                        qint64 dsize,
-                       QSize dimensions,
-                       QString blurhash) {
+                       mtx::common::ImageInfo info) {
                         text_input_->hideUploadSpinner();
 
                         if (encryptedFile)
@@ -406,8 +853,7 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                                                                  url,
                                                                  mime,
                                                                  dsize,
-                                                                 dimensions,
-                                                                 blurhash);
+                                                                 info);
                         else if (mimeClass == "audio")
                                 view_manager_->queueAudioMessage(
                                   roomid, filename, encryptedFile, url, mime, dsize);
@@ -429,12 +875,63 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
         connect(this,
                 &ChatPage::highlightedNotifsRetrieved,
                 this,
-                [](const mtx::responses::Notifications &notif) {
+                [this](const mtx::responses::Notifications &notif,
+                       const std::string &from,
+                       int fetched) {
+                        std::vector<mtx::responses::Notification> added;
+                        try {
+                                added = cache::saveTimelineMentions(notif);
+                        } catch (const lmdb::error &e) {
+                                nhlog::db()->error("failed to save mentions: {}", e.what());
+                                return;
+                        }
+
+                        if (!added.empty())
+                                user_mentions_popup_->addMentions(added);
+
+                        // Older pages are only fetched, until they reach the stored mentions.
+                        // The token of the next page is stored, so a fetch, which is
+                        // interrupted, is resumed by the next one, instead of leaving a gap.
+                        fetched += static_cast<int>(notif.notifications.size());
+                        const bool reachedStored = added.size() < notif.notifications.size();
+                        if (!reachedStored && !notif.next_token.empty() &&
+                            fetched < MAX_FETCHED_MENTIONS) {
+                                cache::saveMentionsToken(notif.next_token);
+                                fetchMentions(notif.next_token, fetched);
+                                return;
+                        }
+
+                        const auto resume = cache::mentionsToken();
+                        if (reachedStored && !resume.empty() && resume != from &&
+                            fetched < MAX_FETCHED_MENTIONS) {
+                                fetchMentions(resume, fetched);
+                                return;
+                        }
+
+                        cache::saveMentionsToken("");
+                });
+
+        connect(this,
+                &ChatPage::pushRulesEvaluated,
+                this,
+                [this](const mtx::responses::Notifications &notifications,
+                       const mtx::responses::Notifications &mentions) {
+                        if (!notifications.notifications.empty() &&
+                            userSettings_->hasDesktopNotifications())
+                                sendDesktopNotifications(notifications);
+
+                        if (mentions.notifications.empty())
+                                return;
+
+                        std::vector<mtx::responses::Notification> added;
                         try {
-                                cache::saveTimelineMentions(notif);
+                                added = cache::saveTimelineMentions(mentions);
                         } catch (const lmdb::error &e) {
                                 nhlog::db()->error("failed to save mentions: {}", e.what());
                         }
+
+                        if (!added.empty())
+                                user_mentions_popup_->addMentions(added);
                 });
 
         connect(communitiesList_,
@@ -448,6 +945,13 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                         else
                                 room_list_->applyFilter(communitiesList_->roomList(groupId));
                 });
+        connect(communitiesList_,
+                &CommunitiesList::roomsChanged,
+                this,
+                [this](const QString &groupId) {
+                        if (groupId == current_community_)
+                                room_list_->applyFilter(communitiesList_->roomList(groupId));
+                });
 
         connect(&notificationsManager,
                 &NotificationsManager::notificationClicked,
@@ -470,23 +974,22 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                 &ChatPage::initializeViews,
                 view_manager_,
                 [this](const mtx::responses::Rooms &rooms) { view_manager_->sync(rooms); });
-        connect(this,
-                &ChatPage::initializeEmptyViews,
-                view_manager_,
-                &TimelineViewManager::initWithMessages);
-        connect(this,
-                &ChatPage::initializeMentions,
-                user_mentions_popup_,
-                &popups::UserMentions::initializeMentions);
-        connect(this, &ChatPage::syncUI, this, [this](const mtx::responses::Rooms &rooms) {
-                try {
-                        room_list_->cleanupInvites(cache::invites());
-                } catch (const lmdb::error &e) {
-                        nhlog::db()->error("failed to retrieve invites: {}", e.what());
-                }
+        connect(this, &ChatPage::syncUI, this, [this](SyncRooms snapshot) {
+                cache::LatencyTimer timer(NHEKO_METRIC("syncUI"));
 
-                view_manager_->sync(rooms);
-                removeLeftRooms(rooms.leave);
+                const auto &rooms = *snapshot;
+
+                // The messages left over from the last session are sent after the first sync.
+                if (windowHidden_ && !view_manager_->isInitialSync()) {
+                        mergeRooms(
+                          hiddenRooms_, hiddenReloads_, rooms, [this](const QString &room_id) {
+                                  return view_manager_->isLoaded(room_id);
+                          });
+                        hiddenSyncs_++;
+                } else {
+                        view_manager_->sync(rooms);
+                        removeLeftRooms(rooms.leave);
+                }
 
                 bool hasNotifications = false;
                 for (const auto &room : rooms.join) {
@@ -500,7 +1003,9 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                                 hasNotifications = true;
                 }
 
-                if (hasNotifications && userSettings_->hasDesktopNotifications())
+                // The server is only asked, until the push rules are evaluated locally.
+                if (hasNotifications && userSettings_->hasDesktopNotifications() &&
+                    !pushRules_.evaluator())
                         http::client()->notifications(
                           5,
                           "",
@@ -518,13 +1023,27 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
                                   emit notificationsRetrieved(std::move(res));
                           });
         });
-        connect(this, &ChatPage::syncRoomlist, room_list_, &RoomList::sync);
-        connect(this, &ChatPage::syncTags, communitiesList_, &CommunitiesList::syncTags);
-        connect(
-          this, &ChatPage::syncTopBar, this, [this](const std::map<QString, RoomInfo> &updates) {
-                  if (updates.find(currentRoom()) != updates.end())
-                          changeTopRoomInfo(currentRoom());
-          });
+        connect(this, &ChatPage::syncRoomlist, room_list_, [this](RoomInfoUpdates updates) {
+                if (!windowHidden_) {
+                        room_list_->sync(*updates);
+                        return;
+                }
+
+                for (const auto &[room_id, info] : *updates)
+                        hiddenRoomInfo_[room_id] = info;
+        });
+        connect(this, &ChatPage::syncTags, communitiesList_, [this](const TagChanges &changes) {
+                if (!windowHidden_) {
+                        communitiesList_->syncTags(changes);
+                        return;
+                }
+
+                hiddenTags_.merge(changes);
+        });
+        connect(this, &ChatPage::syncTopBar, this, [this](RoomInfoUpdates updates) {
+                if (updates->find(currentRoom()) != updates->end())
+                        changeTopRoomInfo(currentRoom());
+        });
 
         // Callbacks to update the user info (top left corner of the page).
         connect(this, &ChatPage::setUserAvatar, user_info_widget_, &UserInfoWidget::setAvatar);
@@ -537,7 +1056,11 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
         connect(this, &ChatPage::tryInitialSyncCb, this, &ChatPage::tryInitialSync);
         connect(this, &ChatPage::trySyncCb, this, &ChatPage::trySync);
         connect(this, &ChatPage::tryDelayedSyncCb, this, [this]() {
-                QTimer::singleShot(RETRY_TIMEOUT, this, &ChatPage::trySync);
+                const auto delay = syncScheduler_.failed();
+                nhlog::net()->info("retrying the sync in {} ms, after {} failures",
+                                   delay.count(),
+                                   syncScheduler_.failures());
+                QTimer::singleShot(delay, this, &ChatPage::trySync);
         });
 
         connect(this, &ChatPage::dropToLoginPageCb, this, &ChatPage::dropToLoginPage);
@@ -548,12 +1071,17 @@ ChatPage::ChatPage(QSharedPointer<UserSettings> userSettings, QWidget *parent)
 void
 ChatPage::logout()
 {
+        syncWorker_.clear();
+        syncWorker_.waitForDone();
+
         deleteConfigs();
 
         resetUI();
 
         emit closing();
         connectivityTimer_.stop();
+        compactionTimer_.stop();
+        diskSyncTimer_.stop();
 }
 
 void
@@ -561,11 +1089,16 @@ ChatPage::dropToLoginPage(const QString &msg)
 {
         nhlog::ui()->info("dropping to the login page: {}", msg.toStdString());
 
+        syncWorker_.clear();
+        syncWorker_.waitForDone();
+
         deleteConfigs();
         resetUI();
 
         http::client()->shutdown();
         connectivityTimer_.stop();
+        compactionTimer_.stop();
+        diskSyncTimer_.stop();
 
         emit showLoginPage(msg);
 }
@@ -610,6 +1143,8 @@ ChatPage::bootstrap(QString userid, QString homeserver, QString token)
 {
         using namespace mtx::identifiers;
 
+        trace::Span span("bootstrap");
+
         try {
                 http::client()->set_user(parse<User>(userid.toStdString()));
         } catch (const std::invalid_argument &e) {
@@ -636,6 +1171,16 @@ ChatPage::bootstrap(QString userid, QString homeserver, QString token)
                 connect(
                   cache::client(), &Cache::roomReadStatus, room_list_, &RoomList::updateReadStatus);
 
+                connect(
+                  cache::client(), &Cache::invitesRemoved, room_list_, &RoomList::removeInvites);
+
+                connect(cache::client(), &Cache::tagsChanged, this, &ChatPage::syncTags);
+
+                connect(cache::client(),
+                        &Cache::inboundMegolmSessionsReceived,
+                        view_manager_,
+                        &TimelineViewManager::receivedInboundMegolmSessions);
+
                 connect(cache::client(),
                         &Cache::removeNotification,
                         &notificationsManager,
@@ -647,6 +1192,11 @@ ChatPage::bootstrap(QString userid, QString homeserver, QString token)
                 if (!isInitialized) {
                         cache::setCurrentFormat();
                 } else if (isInitialized && !isValid) {
+                        if (cache::runMigrations()) {
+                                loadStateFromCache();
+                                return;
+                        }
+
                         // TODO: Deleting session data but keep using the
                         //	 same device doesn't work.
                         cache::deleteData();
@@ -681,6 +1231,7 @@ ChatPage::bootstrap(QString userid, QString homeserver, QString token)
         }
 
         getProfileInfo();
+        pushRules_.fetch();
         tryInitialSync();
 }
 
@@ -722,18 +1273,38 @@ ChatPage::changeTopRoomInfo(const QString &room_id)
         }
 
         current_room_ = room_id;
+        cache::pinMembers(room_id);
 }
 
 void
 ChatPage::showUnreadMessageNotification(int count)
 {
-        emit unreadMessages(count);
+        unreadCount_ = count;
+
+        // The first change is shown right away, the ones after it once the interval is over.
+        if (unreadCountTimer_.isActive()) {
+                unreadCountPending_ = true;
+                return;
+        }
+
+        updateUnreadCount();
+        unreadCountTimer_.start();
+}
+
+void
+ChatPage::updateUnreadCount()
+{
+        if (unreadCount_ == shownUnreadCount_)
+                return;
+
+        shownUnreadCount_ = unreadCount_;
+        emit unreadMessages(unreadCount_);
 
         // TODO: Make the default title a const.
-        if (count == 0)
+        if (unreadCount_ == 0)
                 emit changeWindowTitle("nheko");
         else
-                emit changeWindowTitle(QString("nheko (%1)").arg(count));
+                emit changeWindowTitle(QString("nheko (%1)").arg(unreadCount_));
 }
 
 void
@@ -744,33 +1315,93 @@ ChatPage::loadStateFromCache()
         nhlog::db()->info("restoring state from cache");
 
         getProfileInfo();
+        pushRules_.fetch();
+
+        // The restore phases use their own read transactions and run concurrently. Syncing
+        // only waits for the olm account. The room list is restored on the sync worker, which
+        // processes the sync responses in order, so a response always lands on a restored list.
+        //
+        // A failed phase drops to the login page, unless the sync already started. Then the
+        // session is in use and is only reported as broken, so it isn't deleted under the sync.
+        enum Restore
+        {
+                Restoring,
+                Failed,
+                Syncing,
+        };
+        auto state = std::make_shared<std::atomic<int>>(Restoring);
+        auto fail  = [this, state](const QString &msg) {
+                int expected = Restoring;
+                if (state->compare_exchange_strong(expected, Failed))
+                        emit dropToLoginPageCb(msg);
+                else if (expected == Syncing)
+                        emit showNotification(msg);
+        };
 
-        QtConcurrent::run([this]() {
+        QtConcurrent::run(&syncWorker_, [this, fail]() {
                 try {
-                        cache::restoreSessions();
-                        olm::client()->load(cache::restoreOlmAccount(), STORAGE_SECRET_KEY);
+                        // Show the room list of the last session right away, it is reconciled
+                        // with the cache once that is restored.
+                        std::optional<QMap<QString, RoomInfo>> snapshot;
+                        {
+                                trace::Span span("roomListSnapshot");
+                                snapshot = cache::roomListSnapshot();
+                        }
+                        if (snapshot)
+                                emit initializeRoomList(*snapshot);
 
-                        cache::populateMembers();
+                        QMap<QString, RoomInfo> rooms;
+                        {
+                                trace::Span span("roomInfo");
+                                rooms = cache::roomInfo();
+                        }
+                        auto updates = std::make_shared<const std::map<QString, RoomInfo>>(
+                          rooms.toStdMap());
+                        if (snapshot && snapshot->keys() == rooms.keys())
+                                emit syncRoomlist(updates);
+                        else
+                                emit initializeRoomList(rooms);
 
-                        emit initializeEmptyViews(cache::roomMessages());
-                        emit initializeRoomList(cache::roomInfo());
-                        emit initializeMentions(cache::getTimelineMentions());
-                        emit syncTags(cache::roomInfo().toStdMap());
+                        TagChanges tags;
+                        tags.added = cache::roomsByTag();
+                        emit syncTags(tags);
 
-                        cache::calculateRoomReadStatus();
+                        {
+                                trace::Span span("calculateRoomReadStatus");
+                                cache::calculateRoomReadStatus();
+                        }
+
+                        if (startup::benchmarking() || TimelineStats::benchmarkOnStart())
+                                openBenchmarkRoom();
+                } catch (const lmdb::error &e) {
+                        nhlog::db()->critical("failed to restore cache: {}", e.what());
+                        fail(tr("Failed to restore save data. Please login again."));
+                } catch (const json::exception &e) {
+                        nhlog::db()->critical("failed to parse cache data: {}", e.what());
+                }
+        });
+
+        QtConcurrent::run([fail]() {
+                try {
+                        cache::LatencyTimer timer(NHEKO_METRIC("restoreSessions"));
+                        cache::restoreSessions();
+                } catch (const lmdb::error &e) {
+                        nhlog::db()->critical("failed to restore megolm sessions: {}", e.what());
+                        fail(tr("Failed to restore save data. Please login again."));
+                }
+        });
 
+        QtConcurrent::run([this, fail, state]() {
+                try {
+                        trace::Span span("restoreOlmAccount");
+                        olm::client()->load(cache::restoreOlmAccount(), STORAGE_SECRET_KEY);
                 } catch (const mtx::crypto::olm_exception &e) {
                         nhlog::crypto()->critical("failed to restore olm account: {}", e.what());
-                        emit dropToLoginPageCb(
-                          tr("Failed to restore OLM account. Please login again."));
+                        fail(tr("Failed to restore OLM account. Please login again."));
                         return;
                 } catch (const lmdb::error &e) {
                         nhlog::db()->critical("failed to restore cache: {}", e.what());
-                        emit dropToLoginPageCb(
-                          tr("Failed to restore save data. Please login again."));
-                        return;
-                } catch (const json::exception &e) {
-                        nhlog::db()->critical("failed to parse cache data: {}", e.what());
+                        fail(tr("Failed to restore save data. Please login again."));
                         return;
                 }
 
@@ -778,7 +1409,33 @@ ChatPage::loadStateFromCache()
                 nhlog::crypto()->info("curve25519: {}", olm::client()->identity_keys().curve25519);
 
                 // Start receiving events.
-                emit trySyncCb();
+                int expected = Restoring;
+                if (state->compare_exchange_strong(expected, Syncing))
+                        emit trySyncCb();
+        });
+
+        // The data, which an upgrade of the cache format only has to rebuild, is rebuilt while
+        // the client already runs. The room list shows the rebuilt last messages afterwards.
+        QtConcurrent::run([this]() {
+                try {
+                        if (!cache::runPendingMigrations())
+                                return;
+                } catch (const lmdb::error &e) {
+                        nhlog::db()->critical("failed to run the deferred migrations: {}",
+                                              e.what());
+                        return;
+                }
+
+                QtConcurrent::run(&syncWorker_, [this]() {
+                        try {
+                                emit syncRoomlist(
+                                  std::make_shared<const std::map<QString, RoomInfo>>(
+                                    cache::roomInfo().toStdMap()));
+                        } catch (const lmdb::error &e) {
+                                nhlog::db()->warn("failed to refresh the room list: {}",
+                                                  e.what());
+                        }
+                });
         });
 }
 
@@ -788,6 +1445,8 @@ ChatPage::showQuickSwitcher()
         auto dialog = new QuickSwitcher(this);
 
         connect(dialog, &QuickSwitcher::roomSelected, room_list_, &RoomList::highlightSelectedRoom);
+        connect(
+          dialog, &QuickSwitcher::prefetchRoom, view_manager_, &TimelineViewManager::prefetchRoom);
         connect(dialog, &QuickSwitcher::closing, this, [this]() {
                 MainWindow::instance()->hideOverlay();
                 text_input_->setFocus(Qt::FocusReason::PopupFocusReason);
@@ -802,6 +1461,7 @@ ChatPage::removeRoom(const QString &room_id)
         try {
                 cache::removeRoom(room_id);
                 cache::removeInvite(room_id.toStdString());
+                emit compactionNeeded();
         } catch (const lmdb::error &e) {
                 nhlog::db()->critical("failure while removing room: {}", e.what());
                 // TODO: Notify the user.
@@ -832,6 +1492,57 @@ ChatPage::setGroupViewState(bool isEnabled)
         communitiesList_->show();
 }
 
+void
+ChatPage::setWindowHidden(bool hidden)
+{
+        if (windowHidden_ == hidden)
+                return;
+
+        windowHidden_ = hidden;
+        wakeups::setWindowHidden(hidden);
+        if (!hidden)
+                applyHiddenUpdates();
+}
+
+void
+ChatPage::applyHiddenUpdates()
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("applyHiddenUpdates"));
+
+        if (!hiddenRoomInfo_.empty())
+                room_list_->sync(hiddenRoomInfo_);
+        if (!hiddenTags_.empty())
+                communitiesList_->syncTags(hiddenTags_);
+
+        // Their events are stored, so they are loaded like after a restart.
+        for (const auto &room_id : hiddenReloads_)
+                view_manager_->reloadFromCache(QString::fromStdString(room_id));
+
+        view_manager_->sync(hiddenRooms_);
+        removeLeftRooms(hiddenRooms_.leave);
+
+        // The rooms, which were added to the room list just now, didn't have a count yet.
+        for (const auto &[room_id, room] : hiddenRooms_.join)
+                updateRoomNotificationCount(QString::fromStdString(room_id),
+                                            room.unread_notifications.notification_count,
+                                            room.unread_notifications.highlight_count);
+
+        if (hiddenRoomInfo_.count(currentRoom()))
+                changeTopRoomInfo(currentRoom());
+
+        nhlog::ui()->debug(
+          "applied {} syncs of {} rooms, which arrived while hidden, reloaded {} rooms",
+          hiddenSyncs_,
+          hiddenRooms_.join.size(),
+          hiddenReloads_.size());
+
+        hiddenRooms_    = {};
+        hiddenReloads_  = {};
+        hiddenRoomInfo_ = {};
+        hiddenTags_     = {};
+        hiddenSyncs_    = 0;
+}
+
 void
 ChatPage::updateRoomNotificationCount(const QString &room_id,
                                       uint16_t notification_count,
@@ -843,40 +1554,106 @@ ChatPage::updateRoomNotificationCount(const QString &room_id,
 void
 ChatPage::sendDesktopNotifications(const mtx::responses::Notifications &res)
 {
+        std::vector<std::string> unread, read;
+        for (const auto &item : res.notifications)
+                (item.read ? read : unread).push_back(utils::event_id(item.event));
+
+        std::unordered_set<std::string> unsent;
+        try {
+                const auto events = cache::updateSentNotifications(unread, read);
+                unsent.insert(events.begin(), events.end());
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("error while sending desktop notifications: {}", e.what());
+                return;
+        }
+
+        // The new notifications by room, newest first like the response.
+        std::map<QString, std::vector<const mtx::responses::Notification *>> rooms;
         for (const auto &item : res.notifications) {
-                const auto event_id = utils::event_id(item.event);
+                if (item.read || unsent.count(utils::event_id(item.event)) == 0)
+                        continue;
 
-                try {
-                        if (item.read) {
-                                cache::removeReadNotification(event_id);
-                                continue;
-                        }
+                const auto room_id = QString::fromStdString(item.room_id);
 
-                        if (!cache::isNotificationSent(event_id)) {
-                                const auto room_id = QString::fromStdString(item.room_id);
-                                const auto user_id = utils::event_sender(item.event);
+                // Don't send a notification when the current room is opened.
+                if (isRoomActive(room_id))
+                        continue;
 
-                                // We should only sent one notification per event.
-                                cache::markSentNotification(event_id);
+                rooms[room_id].push_back(&item);
+        }
 
-                                // Don't send a notification when the current room is opened.
-                                if (isRoomActive(room_id))
-                                        continue;
+        for (const auto &[room_id, items] : rooms) {
+                try {
+                        const auto info = cache::singleRoomInfo(room_id.toStdString());
+
+                        // The notifications don't wait for the avatar of the room. Until it is in
+                        // memory, they show the icon of nheko instead.
+                        const auto avatarUrl = QString::fromStdString(info.avatar_url);
+                        const auto icon =
+                          AvatarProvider::cached(avatarUrl, NOTIFICATION_ICON_SIZE).toImage();
+                        if (icon.isNull())
+                                AvatarProvider::resolve(
+                                  avatarUrl, NOTIFICATION_ICON_SIZE, this, [](QPixmap) {});
+
+                        DesktopNotification notification;
+                        notification.roomId   = room_id;
+                        notification.roomName = QString::fromStdString(info.name);
+                        notification.icon     = icon;
+
+                        if (items.size() <= NOTIFICATION_SUMMARY_THRESHOLD) {
+                                for (auto it = items.rbegin(); it != items.rend(); ++it) {
+                                        const auto &event = (*it)->event;
+
+                                        notification.eventId =
+                                          QString::fromStdString(utils::event_id(event));
+                                        notification.senderName =
+                                          cache::displayName(room_id, utils::event_sender(event));
+                                        notification.text = utils::event_body(event);
+                                        notificationsManager.postNotification(notification);
+                                }
+                                continue;
+                        }
 
-                                notificationsManager.postNotification(
-                                  room_id,
-                                  QString::fromStdString(event_id),
-                                  QString::fromStdString(cache::singleRoomInfo(item.room_id).name),
-                                  cache::displayName(room_id, user_id),
-                                  utils::event_body(item.event),
-                                  cache::getRoomAvatar(room_id));
+                        // A burst in a room is summarized. Reading its newest event closes it.
+                        QStringList senders;
+                        for (const auto item : items) {
+                                const auto sender =
+                                  cache::displayName(room_id, utils::event_sender(item->event));
+                                if (!senders.contains(sender))
+                                        senders << sender;
                         }
+
+                        notification.eventId =
+                          QString::fromStdString(utils::event_id(items.front()->event));
+                        notification.senderName = senders.join(", ");
+                        notification.text = tr("%n new message(s)", "", (int)items.size());
+                        notificationsManager.postNotification(notification);
                 } catch (const lmdb::error &e) {
                         nhlog::db()->warn("error while sending desktop notification: {}", e.what());
                 }
         }
 }
 
+void
+ChatPage::fetchMentions(const std::string &from, int fetched)
+{
+        http::client()->notifications(
+          MENTIONS_PAGE_SIZE,
+          from,
+          "highlight",
+          [this, from, fetched](const mtx::responses::Notifications &res,
+                                mtx::http::RequestErr err) {
+                  if (err) {
+                          nhlog::net()->warn("failed to retrieve notifications: {} ({})",
+                                             err->matrix_error.error,
+                                             static_cast<int>(err->status_code));
+                          return;
+                  }
+
+                  emit highlightedNotifsRetrieved(std::move(res), from, fetched);
+          });
+}
+
 void
 ChatPage::showNotificationsDialog(const QPoint &widgetPos)
 {
@@ -895,10 +1672,25 @@ ChatPage::tryInitialSync()
         nhlog::crypto()->info("ed25519   : {}", olm::client()->identity_keys().ed25519);
         nhlog::crypto()->info("curve25519: {}", olm::client()->identity_keys().curve25519);
 
+        // The replay stands in for the server: nothing is uploaded and its first response is the
+        // initial sync. This fills the empty cache of a temporary profile or a new fixture.
+        if (!replayDirectory_.isEmpty()) {
+                emit trySyncCb();
+                emit contentLoaded();
+                return;
+        }
+
         // Upload one time keys for the device.
         nhlog::crypto()->info("generating one time keys");
         olm::client()->generate_one_time_keys(MAX_ONETIME_KEYS);
 
+        olm::mark_account_changed();
+        if (!olm::save_account(true)) {
+                emit dropToLoginPageCb(tr("Failed to save the encryption keys."));
+                return;
+        }
+
+        http::countRequest(http::Traffic::Keys);
         http::client()->upload_keys(
           olm::client()->create_upload_keys_request(),
           [this](const mtx::responses::UploadKeys &res, mtx::http::RequestErr err) {
@@ -938,32 +1730,130 @@ void
 ChatPage::startInitialSync()
 {
         nhlog::net()->info("trying initial sync");
+        startup::reached(startup::Milestone::FirstSync);
 
         mtx::http::SyncOpts opts;
         opts.timeout = 0;
-        http::client()->sync(
+        opts.filter  = syncFilter(
+          "initial_sync",
+          QSettings()
+            .value("user/sync/initial_timeline_limit", INITIAL_SYNC_TIMELINE_LIMIT)
+            .toInt());
+        http::countRequest(http::Traffic::Sync);
+        requestSync(
           opts,
-          std::bind(
-            &ChatPage::initialSyncHandler, this, std::placeholders::_1, std::placeholders::_2));
+          recordDirectory_,
+          std::bind(&ChatPage::initialSyncHandler,
+                    this,
+                    std::placeholders::_1,
+                    std::placeholders::_2,
+                    std::placeholders::_3));
+}
+
+std::string
+ChatPage::syncFilter(const std::string &name, int timeline_limit, bool lite)
+{
+        const auto definition = syncFilterDefinition(timeline_limit, lite).dump();
+        if (auto filter_id = cache::syncFilterId(name, definition); !filter_id.empty())
+                return filter_id;
+
+        // Until the filter was uploaded, it is passed inline.
+        http::schedule(http::Priority::Sync, [name, definition](auto slot) {
+                http::client()->upload_filter(
+                  nlohmann::json::parse(definition),
+                  [slot, name, definition](const mtx::responses::FilterId &res,
+                                           mtx::http::RequestErr err) {
+                          if (slot.retry(err))
+                                  return;
+
+                          if (err) {
+                                  nhlog::net()->warn("failed to upload the sync filter {}: {}",
+                                                     name,
+                                                     err->matrix_error.error);
+                                  return;
+                          }
+
+                          cache::saveSyncFilterId(name, definition, res.filter_id);
+                  });
+        });
+
+        return definition;
+}
+
+void
+ChatPage::setReplayDirectory(const QString &directory, int interval_ms, bool quit)
+{
+        replayDirectory_ = directory;
+        replayInterval_  = interval_ms;
+        quitAfterReplay_ = quit;
+}
+
+void
+ChatPage::setRecordDirectory(const QString &directory)
+{
+        if (!QDir().mkpath(directory)) {
+                nhlog::net()->warn("failed to create {}, the syncs aren't recorded",
+                                   directory.toStdString());
+                return;
+        }
+
+        recordDirectory_ = directory;
 }
 
 void
 ChatPage::trySync()
 {
+        if (!replayDirectory_.isEmpty()) {
+                if (!replaying_) {
+                        replaying_ = true;
+                        replaySyncs();
+                }
+                return;
+        }
+
+        startup::reached(startup::Milestone::FirstSync);
+
         mtx::http::SyncOpts opts;
 
         if (!connectivityTimer_.isActive())
                 connectivityTimer_.start();
 
+        if (!diskSyncTimer_.isActive())
+                diskSyncTimer_.start();
+
         try {
                 opts.since = cache::nextBatchToken();
         } catch (const lmdb::error &e) {
                 nhlog::db()->error("failed to retrieve next batch token: {}", e.what());
                 return;
         }
+        const bool lite = syncScheduler_.lite();
+        opts.filter     = syncFilter(
+          lite ? "sync_lite" : "sync",
+          QSettings().value("user/sync/timeline_limit", SYNC_TIMELINE_LIMIT).toInt(),
+          lite);
+        opts.timeout =
+          syncScheduler_.serverTimeout(QApplication::applicationState() == Qt::ApplicationActive);
+
+        const auto requested = steadyMicroseconds();
+        if (const auto received = syncResponseReceived_.exchange(0))
+                cache::recordLatency(NHEKO_METRIC("sync next request"),
+                                     std::chrono::microseconds(requested - received));
+
+        http::countRequest(http::Traffic::Sync);
+        requestSync(
+          opts,
+          recordDirectory_,
+          [this, requested](const SyncResponse &response,
+                            const nlohmann::json &raw,
+                            mtx::http::RequestErr err) {
+                  // The response is parsed, before it is handed to us, so the wait includes the
+                  // parsing.
+                  const auto received = steadyMicroseconds();
+                  const auto &res     = response.sync;
+                  cache::recordLatency(NHEKO_METRIC("sync wait"),
+                                       std::chrono::microseconds(received - requested));
 
-        http::client()->sync(
-          opts, [this](const mtx::responses::Sync &res, mtx::http::RequestErr err) {
                   if (err) {
                           const auto error      = QString::fromStdString(err->matrix_error.error);
                           const auto msg        = tr("Please try to login again: %1").arg(error);
@@ -982,42 +1872,359 @@ ChatPage::trySync()
                   }
 
                   nhlog::net()->debug("sync completed: {}", res.next_batch);
+                  syncScheduler_.succeeded();
 
-                  // Ensure that we have enough one-time keys available.
-                  ensureOneTimeKeyCount(res.device_one_time_keys_count);
+                  syncsInProgress_ += 1;
 
                   // TODO: fine grained error handling
                   try {
-                          cache::saveState(res);
-                          olm::handle_to_device_messages(res.to_device);
-
-                          emit syncUI(res.rooms);
-
-                          auto updates = cache::roomUpdates(res);
-
-                          emit syncTopBar(updates);
-                          emit syncRoomlist(updates);
-
-                          emit syncTags(cache::roomTagUpdates(res));
-
-                          // if we process a lot of syncs (1 every 200ms), this means we clean the
-                          // db every 100s
-                          static int syncCounter = 0;
-                          if (syncCounter++ >= 500) {
-                                  cache::deleteOldData();
-                                  syncCounter = 0;
+                          try {
+                                  cache::saveState(res, response.summaries, raw);
+                          } catch (const lmdb::map_full_error &e) {
+                                  // The failed transaction was aborted, so it is simply retried
+                                  // in the larger map.
+                                  nhlog::db()->warn("lmdb is full: {}", e.what());
+                                  if (!cache::growMapSize())
+                                          throw;
+                                  cache::saveState(res, response.summaries, raw);
                           }
                   } catch (const lmdb::map_full_error &e) {
                           nhlog::db()->error("lmdb is full: {}", e.what());
                           cache::deleteOldData();
+
+                          syncsInProgress_ -= 1;
+                          emit trySyncCb();
+                          return;
                   } catch (const lmdb::error &e) {
                           nhlog::db()->error("saving sync response: {}", e.what());
+
+                          syncsInProgress_ -= 1;
+                          emit trySyncCb();
+                          return;
                   }
 
+                  recordSyncCounts(res);
+                  olm::refresh_device_keys(res.device_lists.changed);
+
+                  // The next batch token is saved together with the to-device messages, so we can
+                  // already wait for the next response, while the worker handles this one.
+                  syncResponseReceived_ = received;
                   emit trySyncCb();
+
+                  // The response is copied once and shared by everyone, who processes it.
+                  auto shared = std::make_shared<const mtx::responses::Sync>(res);
+                  QtConcurrent::run(&syncWorker_, [this, shared]() {
+                          processSyncResponse(shared);
+                          syncsInProgress_ -= 1;
+                  });
           });
 }
 
+void
+ChatPage::replaySyncs()
+{
+        const auto files =
+          QDir(replayDirectory_).entryInfoList({"*.json"}, QDir::Files, QDir::Name);
+        nhlog::net()->info(
+          "replaying {} sync responses from {}", files.size(), replayDirectory_.toStdString());
+
+        QtConcurrent::run(&syncWorker_, [this, files]() {
+                const auto start = std::chrono::steady_clock::now();
+                int replayed     = 0;
+
+                for (const auto &file : files) {
+                        QFile f(file.absoluteFilePath());
+                        if (!f.open(QIODevice::ReadOnly)) {
+                                nhlog::net()->warn("failed to open {}",
+                                                   file.absoluteFilePath().toStdString());
+                                continue;
+                        }
+
+                        json raw;
+                        std::shared_ptr<const mtx::responses::Sync> sync;
+                        std::map<std::string, RoomSummary> summaries;
+                        try {
+                                raw           = json::parse(f.readAll().toStdString());
+                                auto response = raw.get<SyncResponse>();
+                                sync          = std::make_shared<const mtx::responses::Sync>(
+                                  std::move(response.sync));
+                                summaries = std::move(response.summaries);
+                        } catch (const json::exception &e) {
+                                nhlog::net()->warn("failed to parse {}: {}",
+                                                   file.absoluteFilePath().toStdString(),
+                                                   e.what());
+                                continue;
+                        }
+
+                        // The same stages as a sync with the server, but in one thread. The
+                        // events are stored as they are in the file.
+                        try {
+                                cache::saveState(*sync, summaries, raw);
+                        } catch (const lmdb::error &e) {
+                                nhlog::db()->error("saving sync response: {}", e.what());
+                                continue;
+                        }
+
+                        recordSyncCounts(*sync);
+                        processSyncResponse(sync);
+                        replayed++;
+
+                        if (replayInterval_ > 0)
+                                QThread::msleep(replayInterval_);
+                }
+
+                const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                  std::chrono::steady_clock::now() - start);
+
+                logSyncStats();
+                nhlog::net()->info("replayed {} sync responses in {} ms, peak memory {}",
+                                   replayed,
+                                   elapsed.count(),
+                                   utils::humanReadableFileSize(utils::peakMemoryUsage())
+                                     .toStdString());
+
+                // A benchmark with a replay waits for the responses to be saved.
+                startup::reached(startup::Milestone::FirstSync);
+                if (startup::benchmarking() || TimelineStats::benchmarkOnStart())
+                        openBenchmarkRoom();
+
+                if (quitAfterReplay_)
+                        QMetaObject::invokeMethod(
+                          QCoreApplication::instance(), []() { QCoreApplication::quit(); });
+        });
+}
+
+void
+ChatPage::openBenchmarkRoom()
+{
+        const auto joined = cache::joinedRooms();
+        if (joined.empty())
+                return;
+
+        QMetaObject::invokeMethod(
+          this,
+          [this, room_id = QString::fromStdString(joined.front())]() {
+                  if (!view_manager_->activeTimeline())
+                          room_list_->highlightSelectedRoom(room_id);
+          },
+          Qt::QueuedConnection);
+}
+
+void
+ChatPage::retrieveMembersOfUnnamedRooms(const mtx::responses::Rooms &rooms)
+{
+        std::vector<std::string> room_ids;
+        for (const auto &room : rooms.join)
+                if (!membersRetrieved_.count(room.first))
+                        room_ids.push_back(room.first);
+
+        if (room_ids.empty())
+                return;
+
+        for (const auto &room_id : cache::roomsNamedByMembers(room_ids)) {
+                membersRetrieved_.insert(room_id);
+
+                http::client()->members(
+                  room_id,
+                  [this, room_id](const mtx::responses::Members &res, mtx::http::RequestErr err) {
+                          if (err) {
+                                  nhlog::net()->warn("failed to retrieve the members of {}: {}",
+                                                     room_id,
+                                                     err->matrix_error.error);
+                                  return;
+                          }
+
+                          try {
+                                  cache::saveMembers(room_id, res.chunk);
+                          } catch (const lmdb::error &e) {
+                                  nhlog::db()->warn(
+                                    "failed to save the members of {}: {}", room_id, e.what());
+                                  return;
+                          }
+
+                          const auto updates = std::make_shared<const std::map<QString, RoomInfo>>(
+                            cache::getRoomInfo({room_id}));
+                          emit syncTopBar(updates);
+                          emit syncRoomlist(updates);
+                  });
+        }
+}
+
+void
+ChatPage::processSyncResponse(const std::shared_ptr<const mtx::responses::Sync> &sync)
+{
+        const auto &res = *sync;
+
+        trace::Span span("processSyncResponse");
+
+        // The olm account is only used from the worker, while we sync.
+        // Ensure that we have enough one-time keys available.
+        ensureOneTimeKeyCount(res.device_one_time_keys_count);
+
+        try {
+                {
+                        cache::LatencyTimer timer(NHEKO_METRIC("sync to-device"));
+                        handlePendingToDevice();
+                }
+
+                // Shares the ownership of the whole response.
+                emit syncUI(SyncRooms(sync, &sync->rooms));
+
+                evaluatePushRules(res.rooms);
+
+                {
+                        cache::LatencyTimer timer(NHEKO_METRIC("sync room updates"));
+
+                        // The tags were passed on by the cache, while the sync was saved.
+                        const auto updates = std::make_shared<const std::map<QString, RoomInfo>>(
+                          cache::getRoomInfo(cache::roomsWithStateUpdates(res)));
+
+                        emit syncTopBar(updates);
+                        emit syncRoomlist(updates);
+                }
+
+                retrieveMembersOfUnnamedRooms(res.rooms);
+
+                // if we process a lot of syncs (1 every 200ms), this means we check the db every
+                // 100s. The compaction itself runs in small steps, while no sync is processed.
+                // The databases of the left rooms are reclaimed soon.
+                static int syncCounter = 0;
+                if (syncCounter++ >= 500 || !res.rooms.leave.empty()) {
+                        emit compactionNeeded();
+                        syncCounter = 0;
+                }
+
+                static int snapshotCounter = 0;
+                if (snapshotCounter++ >= ROOM_LIST_SNAPSHOT_INTERVAL) {
+                        cache::saveRoomListSnapshot();
+                        snapshotCounter = 0;
+                }
+
+                static int statsCounter = 0;
+                if (++statsCounter >= SYNC_STATS_INTERVAL) {
+                        logSyncStats();
+                        statsCounter = 0;
+                }
+        } catch (const lmdb::map_full_error &e) {
+                nhlog::db()->error("lmdb is full: {}", e.what());
+                if (!cache::growMapSize())
+                        cache::deleteOldData();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->error("processing sync response: {}", e.what());
+        }
+}
+
+bool
+ChatPage::evaluatePushRules(const mtx::responses::Rooms &rooms)
+{
+        using namespace mtx::events;
+
+        const auto evaluator = pushRules_.evaluator();
+        if (!evaluator)
+                return false;
+
+        cache::LatencyTimer timer(NHEKO_METRIC("sync push rules"));
+
+        const auto local_user = utils::localUser().toStdString();
+
+        mtx::responses::Notifications notifications, mentions;
+        for (const auto &[room_id, room] : rooms.join) {
+                // Nothing is unread, e.g. because the events were read on another device.
+                if (room.unread_notifications.notification_count == 0 &&
+                    room.unread_notifications.highlight_count == 0)
+                        continue;
+
+                std::optional<PushRuleEvaluator::Room> context;
+                std::optional<NotificationLevels> levels;
+
+                // Newest first, like the notifications of the server.
+                const auto &events = room.timeline.events;
+                for (auto it = events.rbegin(); it != events.rend(); ++it) {
+                        if (mtx::accessors::sender_view(*it) == local_user)
+                                continue;
+
+                        collections::TimelineEvents event = *it;
+                        if (auto encrypted =
+                              std::get_if<EncryptedEvent<msg::Encrypted>>(&event)) {
+                                // A message, which can't be decrypted yet, is evaluated as it
+                                // is, which matches the rule of the encrypted messages.
+                                auto result = TimelineModel::decryptAndKeep(room_id, *encrypted);
+                                if (result.isDecrypted)
+                                        event = std::move(result.event);
+                        }
+
+                        if (!context) {
+                                const auto user = QString::fromStdString(local_user);
+                                context         = PushRuleEvaluator::Room{
+                                  room_id,
+                                  cache::displayName(QString::fromStdString(room_id), user),
+                                  static_cast<int>(cache::singleRoomInfo(room_id).member_count)};
+
+                                levels = cache::notificationLevels(room_id);
+                                if (levels)
+                                        context->roomNotificationLevel = levels->room;
+                        }
+
+                        // Without power levels, everyone may notify the room.
+                        if (levels)
+                                context->senderPowerLevel = levels->levels.user_level(
+                                  std::string(mtx::accessors::sender_view(*it)));
+
+                        const auto actions = evaluator->evaluate(event, *context);
+                        if (!actions.notify)
+                                continue;
+
+                        mtx::responses::Notification notification;
+                        notification.room_id = room_id;
+                        notification.read    = false;
+                        notification.ts =
+                          mtx::accessors::origin_server_ts(event).toMSecsSinceEpoch();
+                        notification.event = std::move(event);
+
+                        if (actions.highlight)
+                                mentions.notifications.push_back(notification);
+                        notifications.notifications.push_back(std::move(notification));
+                }
+        }
+
+        if (!notifications.notifications.empty())
+                emit pushRulesEvaluated(notifications, mentions);
+
+        return true;
+}
+
+void
+ChatPage::logSyncStats()
+{
+        auto log = [this](const std::map<std::string, LatencyHistogram> &histograms,
+                          const char *unit) {
+                for (const auto &[operation, histogram] : histograms) {
+                        if (operation.rfind("sync", 0) != 0 && operation != "saveState")
+                                continue;
+
+                        const auto recent = histogram.since(loggedSyncStats_[operation]);
+                        loggedSyncStats_[operation] = histogram;
+
+                        if (recent.count == 0)
+                                continue;
+
+                        nhlog::net()->info("{}: {} calls, mean {}{}, p50 {}{}, p99 {}{}",
+                                           operation,
+                                           recent.count,
+                                           recent.total_us / recent.count,
+                                           unit,
+                                           recent.quantile(0.5),
+                                           unit,
+                                           recent.quantile(0.99),
+                                           unit);
+                }
+        };
+
+        nhlog::net()->info("sync stats of the last {} syncs", SYNC_STATS_INTERVAL);
+        log(cache::latencies(), " us");
+        log(cache::counts(), "");
+}
+
 void
 ChatPage::joinRoom(const QString &room)
 {
@@ -1165,6 +2372,11 @@ ChatPage::sendTypingNotifications()
         if (!userSettings_->isTypingNotificationsEnabled())
                 return;
 
+        // The server would send them to every member of a large room.
+        if (cache::isLargeRoom(current_room_.toStdString()))
+                return;
+
+        http::countRequest(http::Traffic::Typing);
         http::client()->start_typing(
           current_room_.toStdString(), 10'000, [](mtx::http::RequestErr err) {
                   if (err) {
@@ -1175,8 +2387,12 @@ ChatPage::sendTypingNotifications()
 }
 
 void
-ChatPage::initialSyncHandler(const mtx::responses::Sync &res, mtx::http::RequestErr err)
+ChatPage::initialSyncHandler(const SyncResponse &response,
+                             const nlohmann::json &raw,
+                             mtx::http::RequestErr err)
 {
+        const auto &res = response.sync;
+
         // TODO: Initial Sync should include mentions as well...
 
         if (err) {
@@ -1210,16 +2426,27 @@ ChatPage::initialSyncHandler(const mtx::responses::Sync &res, mtx::http::Request
         nhlog::net()->info("initial sync completed");
 
         try {
-                cache::saveState(res);
+                cache::saveInitialState(
+                  res, response.summaries, raw, [this](std::size_t saved, std::size_t total) {
+                          emit initialSyncProgress(static_cast<int>(saved),
+                                                   static_cast<int>(total));
+                  });
 
-                olm::handle_to_device_messages(res.to_device);
+                handlePendingToDevice();
 
-                emit initializeViews(std::move(res.rooms));
+                // The views only need the timelines, not another copy of the state of every room.
+                mtx::responses::Rooms timelines;
+                for (const auto &[room_id, room] : res.rooms.join)
+                        timelines.join[room_id].timeline = room.timeline;
+                emit initializeViews(std::move(timelines));
                 emit initializeRoomList(cache::roomInfo());
-                emit initializeMentions(cache::getTimelineMentions());
 
                 cache::calculateRoomReadStatus();
-                emit syncTags(cache::roomInfo().toStdMap());
+                TagChanges tags;
+                tags.added = cache::roomsByTag();
+                emit syncTags(tags);
+
+                cache::saveRoomListSnapshot();
         } catch (const lmdb::error &e) {
                 nhlog::db()->error("failed to save state after initial sync: {}", e.what());
                 startInitialSync();
@@ -1233,28 +2460,48 @@ ChatPage::initialSyncHandler(const mtx::responses::Sync &res, mtx::http::Request
 void
 ChatPage::ensureOneTimeKeyCount(const std::map<std::string, uint16_t> &counts)
 {
-        for (const auto &entry : counts) {
-                if (entry.second < MAX_ONETIME_KEYS) {
-                        const int nkeys = MAX_ONETIME_KEYS - entry.second;
+        // The counts of the next syncs don't include the keys of a running upload yet.
+        if (uploadingOneTimeKeys_)
+                return;
 
-                        nhlog::crypto()->info("uploading {} {} keys", nkeys, entry.first);
-                        olm::client()->generate_one_time_keys(nkeys);
+        // The server leaves out algorithms without any keys left.
+        const auto it           = counts.find(mtx::crypto::SIGNED_CURVE25519);
+        const std::size_t count = it != counts.end() ? it->second : 0;
+        if (count >= REFILL_ONETIME_KEYS)
+                return;
 
-                        http::client()->upload_keys(
-                          olm::client()->create_upload_keys_request(),
-                          [](const mtx::responses::UploadKeys &, mtx::http::RequestErr err) {
-                                  if (err) {
-                                          nhlog::crypto()->warn(
-                                            "failed to update one-time keys: {} {}",
-                                            err->matrix_error.error,
-                                            static_cast<int>(err->status_code));
-                                          return;
-                                  }
+        const auto nkeys      = MAX_ONETIME_KEYS - count;
+        uploadingOneTimeKeys_ = true;
 
-                                  olm::mark_keys_as_published();
-                          });
-                }
+        nhlog::crypto()->info("uploading {} one-time keys, {} left", nkeys, count);
+        olm::client()->generate_one_time_keys(nkeys);
+
+        // The server must never hand out keys, which a crash would lose.
+        olm::mark_account_changed();
+        if (!olm::save_account(true)) {
+                uploadingOneTimeKeys_ = false;
+                return;
         }
+
+        http::countRequest(http::Traffic::Keys);
+        http::client()->upload_keys(
+          olm::client()->create_upload_keys_request(),
+          [this](const mtx::responses::UploadKeys &, mtx::http::RequestErr err) {
+                  if (err) {
+                          nhlog::crypto()->warn("failed to update one-time keys: {} {}",
+                                                err->matrix_error.error,
+                                                static_cast<int>(err->status_code));
+                          uploadingOneTimeKeys_ = false;
+                          return;
+                  }
+
+                  // The account is only used from the sync worker, so it is saved there, once
+                  // for the whole batch.
+                  QtConcurrent::run(&syncWorker_, [this]() {
+                          olm::mark_keys_as_published();
+                          uploadingOneTimeKeys_ = false;
+                  });
+          });
 }
 
 void
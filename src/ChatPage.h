@@ -18,24 +18,30 @@
 #pragma once
 
 #include <atomic>
+#include <memory>
 #include <optional>
+#include <set>
 #include <variant>
 
 #include <mtx/common.hpp>
 #include <mtx/requests.hpp>
 #include <mtx/responses.hpp>
 #include <mtxclient/http/errors.hpp>
+#include <nlohmann/json.hpp>
 
 #include <QFrame>
 #include <QHBoxLayout>
 #include <QMap>
 #include <QPixmap>
 #include <QPoint>
+#include <QThreadPool>
 #include <QTimer>
 #include <QWidget>
 
 #include "CacheStructs.h"
 #include "CommunitiesList.h"
+#include "PushRules.h"
+#include "SyncScheduler.h"
 #include "Utils.h"
 #include "notifications/Manager.h"
 #include "popups/UserMentions.h"
@@ -60,6 +66,11 @@ namespace mtx::http {
 using RequestErr = const std::optional<mtx::http::ClientError> &;
 }
 
+//! The rooms of a sync response and the changed room infos are passed to the views as immutable
+//! snapshots, so the queued connections share them instead of copying every event.
+using SyncRooms       = std::shared_ptr<const mtx::responses::Rooms>;
+using RoomInfoUpdates = std::shared_ptr<const std::map<QString, RoomInfo>>;
+
 class ChatPage : public QWidget
 {
         Q_OBJECT
@@ -73,8 +84,18 @@ public:
         QString currentRoom() const { return current_room_; }
 
         static ChatPage *instance() { return instance_; }
+        //! Replay the sync responses in the json files of directory, in the order of their
+        //! names, instead of syncing with the server. interval_ms is waited between them, 0
+        //! replays them as fast as possible. With quit, nheko quits after the last one.
+        static void setReplayDirectory(const QString &directory, int interval_ms, bool quit);
+        //! Write every sync response of the server to directory, as a file the replay reads.
+        static void setRecordDirectory(const QString &directory);
 
         QSharedPointer<UserSettings> userSettings() { return userSettings_; }
+        TimelineViewManager *timelineManager() { return view_manager_; }
+        PushRules &pushRules() { return pushRules_; }
+        //! The state of the sync scheduling, for the diagnostics.
+        SyncScheduler::State syncState() const { return syncScheduler_.state(); }
         void deleteConfigs();
 
         //! Calculate the width of the message timeline.
@@ -86,6 +107,10 @@ public:
         void showSideBars();
         void initiateLogout();
         void focusMessageInput();
+        //! While the window is hidden, the syncs only update the unread counts and send the
+        //! notifications. The changes of the timelines and the room list are queued and applied
+        //! at once, when it is shown again.
+        void setWindowHidden(bool hidden);
 
 public slots:
         void leaveRoom(const QString &room_id);
@@ -101,8 +126,13 @@ signals:
         void connectionRestored();
 
         void notificationsRetrieved(const mtx::responses::Notifications &);
+        //! A page of the mentions, after fetched of them were received already.
         void highlightedNotifsRetrieved(const mtx::responses::Notifications &,
-                                        const QPoint widgetPos);
+                                        const std::string &from,
+                                        int fetched);
+        //! The events of a sync, which notify by the push rules, and the highlighted ones of them.
+        void pushRulesEvaluated(const mtx::responses::Notifications &notifications,
+                                const mtx::responses::Notifications &mentions);
 
         void uploadFailed(const QString &msg);
         void mediaUploaded(const QString &roomid,
@@ -112,8 +142,7 @@ signals:
                            const QString &mimeClass,
                            const QString &mime,
                            qint64 dsize,
-                           const QSize &dimensions,
-                           const QString &blurhash);
+                           const mtx::common::ImageInfo &info);
 
         void contentLoaded();
         void closing();
@@ -123,6 +152,8 @@ signals:
         void showLoginPage(const QString &msg);
         void showUserSettingsPage();
         void showOverlayProgressBar();
+        //! The initial sync saved that many of its joined rooms. Emitted from the network thread.
+        void initialSyncProgress(int saved, int total);
 
         void ownProfileOk();
         void setUserDisplayName(const QString &name);
@@ -131,17 +162,17 @@ signals:
 
         void trySyncCb();
         void tryDelayedSyncCb();
+        void compactionNeeded();
+        void compactionFinished();
         void tryInitialSyncCb();
         void leftRoom(const QString &room_id);
 
         void initializeRoomList(QMap<QString, RoomInfo>);
         void initializeViews(const mtx::responses::Rooms &rooms);
-        void initializeEmptyViews(const std::map<QString, mtx::responses::Timeline> &msgs);
-        void initializeMentions(const QMap<QString, mtx::responses::Notifications> &notifs);
-        void syncUI(const mtx::responses::Rooms &rooms);
-        void syncRoomlist(const std::map<QString, RoomInfo> &updates);
-        void syncTags(const std::map<QString, RoomInfo> &updates);
-        void syncTopBar(const std::map<QString, RoomInfo> &updates);
+        void syncUI(SyncRooms rooms);
+        void syncRoomlist(RoomInfoUpdates updates);
+        void syncTags(const TagChanges &changes);
+        void syncTopBar(RoomInfoUpdates updates);
         void dropToLoginPageCb(const QString &msg);
 
         void notifyMessage(const QString &roomid,
@@ -168,13 +199,39 @@ private slots:
 
 private:
         static ChatPage *instance_;
+        static QString replayDirectory_;
+        static int replayInterval_;
+        static bool quitAfterReplay_;
+        static QString recordDirectory_;
 
         //! Handler callback for initial sync. It doesn't run on the main thread so all
         //! communication with the GUI should be done through signals.
-        void initialSyncHandler(const mtx::responses::Sync &res, mtx::http::RequestErr err);
+        void initialSyncHandler(const SyncResponse &response,
+                                const nlohmann::json &raw,
+                                mtx::http::RequestErr err);
+        //! Show the latest unread count in the tray and the title.
+        void updateUnreadCount();
         void startInitialSync();
         void tryInitialSync();
         void trySync();
+        //! Save and process the responses of the replay directory on the sync worker and log
+        //! their timings.
+        void replaySyncs();
+        //! Nobody selects a room during the startup or the scroll benchmark, so the first joined
+        //! room is opened, unless one is open already. Can be called from any thread.
+        void openBenchmarkRoom();
+        //! The id of the uploaded sync filter, or its definition, until it was uploaded.
+        std::string syncFilter(const std::string &name, int timeline_limit, bool lite = false);
+        //! Second stage of a sync, after its state was saved. Runs on the sync worker.
+        void processSyncResponse(const std::shared_ptr<const mtx::responses::Sync> &sync);
+        //! Evaluate the push rules against the new events of the joined rooms, decrypting them
+        //! first. Runs on the sync worker. False, if the rules weren't fetched yet.
+        bool evaluatePushRules(const mtx::responses::Rooms &rooms);
+        //! Retrieve the members of the joined rooms, which are named after them, once, since the
+        //! syncs only contain the members, which sent something. Runs on the sync worker.
+        void retrieveMembersOfUnnamedRooms(const mtx::responses::Rooms &rooms);
+        //! Log the percentiles of the sync timings, since they were logged the last time.
+        void logSyncStats();
         void ensureOneTimeKeyCount(const std::map<std::string, uint16_t> &counts);
         void getProfileInfo();
 	friend class TextInputWidget;
@@ -208,6 +265,10 @@ private:
         void sendDesktopNotifications(const mtx::responses::Notifications &);
 
         void showNotificationsDialog(const QPoint &point);
+        //! Request the page of the mentions before the token from, or the newest page.
+        void fetchMentions(const std::string &from, int fetched);
+        //! Apply the syncs, which arrived while the window was hidden, in one pass.
+        void applyHiddenUpdates();
 
         QHBoxLayout *topLayout_;
         Splitter *splitter;
@@ -232,6 +293,47 @@ private:
         QTimer connectivityTimer_;
         std::atomic_bool isConnected_;
 
+        //! Trims the cache in small steps, while there is work left.
+        QTimer compactionTimer_;
+        std::atomic_bool isCompacting_{false};
+        //! How many sync responses are being saved or processed.
+        std::atomic_int syncsInProgress_{0};
+
+        //! Syncs the cache to disk periodically, if it doesn't sync every commit.
+        QTimer diskSyncTimer_;
+
+        //! Limits the updates of the unread count of the tray and the title, which changes with
+        //! almost every sync of a busy account.
+        QTimer unreadCountTimer_;
+        int unreadCount_         = 0;
+        int shownUnreadCount_    = -1;
+        bool unreadCountPending_ = false;
+
+        //! Processes the saved sync responses in order, while the next one is requested.
+        QThreadPool syncWorker_;
+        SyncScheduler syncScheduler_;
+        //! Whether one-time keys are being uploaded. At most one batch is uploaded at a time.
+        std::atomic_bool uploadingOneTimeKeys_{false};
+        //! The rooms, whose members were retrieved to name them. Only used on the sync worker.
+        std::set<std::string> membersRetrieved_;
+
+        //! When the last sync response arrived, in microseconds of the steady clock, or 0.
+        std::atomic<int64_t> syncResponseReceived_{0};
+        //! The sync histograms at the last summary. Only used by the sync worker.
+        std::map<std::string, LatencyHistogram> loggedSyncStats_;
+        //! Whether the replay started. It runs once and the server isn't synced afterwards.
+        bool replaying_ = false;
+
+        bool windowHidden_ = false;
+        //! The rooms of the syncs since the window was hidden, with their timelines merged.
+        mtx::responses::Rooms hiddenRooms_;
+        //! The loaded rooms, which queued too many events, and are reloaded from the cache.
+        std::set<std::string> hiddenReloads_;
+        //! The newest info of the rooms, which changed since the window was hidden.
+        std::map<QString, RoomInfo> hiddenRoomInfo_;
+        TagChanges hiddenTags_;
+        std::size_t hiddenSyncs_ = 0;
+
         QString current_room_;
         QString current_community_;
 
@@ -245,6 +347,7 @@ private:
         QSharedPointer<UserSettings> userSettings_;
 
         NotificationsManager notificationsManager;
+        PushRules pushRules_;
 };
 
 template<class Collection>
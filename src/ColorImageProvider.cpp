@@ -1,27 +1,102 @@
 #include "ColorImageProvider.h"
 
 #include <QPainter>
+#include <QSet>
 
-QPixmap
-ColorImageProvider::requestPixmap(const QString &id, QSize *size, const QSize &)
+#include <atomic>
+
+namespace {
+std::atomic<uint64_t> cache_hits_{0};
+std::atomic<uint64_t> renders_{0};
+std::atomic<uint64_t> invalidated_{0};
+
+//! The color of a cache key, which looks like path?color_WxH. Invalid for uncolored icons.
+QColor
+keyColor(const QString &key)
 {
+        const auto start = key.indexOf('?');
+        const auto end   = key.lastIndexOf('_');
+        if (start == -1 || end <= start)
+                return QColor();
+
+        return QColor(key.mid(start + 1, end - start - 1));
+}
+}
+
+QImage
+ColorImageProvider::requestImage(const QString &id, QSize *size, const QSize &requestedSize)
+{
+        const auto key =
+          QString("%1_%2x%3").arg(id).arg(requestedSize.width()).arg(requestedSize.height());
+
+        {
+                std::unique_lock<std::mutex> lock(cacheMtx_);
+                if (auto cached = cache_.object(key)) {
+                        cache_hits_++;
+                        if (size)
+                                *size = cached->size();
+                        return *cached;
+                }
+        }
+
+        renders_++;
+
         auto args = id.split('?');
 
-        QPixmap source(args[0]);
+        // The icons are returned as images at the size of the item, instead of pixmaps, so they
+        // are small enough for the texture atlas of the scene graph and can load in its thread.
+        QImage source(args[0]);
+        if (requestedSize.isValid() && !source.isNull())
+                source =
+                  source.scaled(requestedSize, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+        if (args.size() >= 2) {
+                QColor color(args[1]);
+
+                source = source.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+                QPainter painter(&source);
+                painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
+                painter.fillRect(source.rect(), color);
+                painter.end();
+        }
 
         if (size)
-                *size = QSize(source.width(), source.height());
+                *size = source.size();
+
+        std::unique_lock<std::mutex> lock(cacheMtx_);
+        cache_.insert(key, new QImage(source));
 
-        if (args.size() < 2)
-                return source;
+        return source;
+}
 
-        QColor color(args[1]);
+void
+ColorImageProvider::invalidateColors(const QPalette &palette)
+{
+        QSet<QRgb> colors;
+        for (int group = 0; group < QPalette::NColorGroups; group++)
+                for (int role = 0; role < QPalette::NColorRoles; role++)
+                        colors.insert(
+                          palette
+                            .color(static_cast<QPalette::ColorGroup>(group),
+                                   static_cast<QPalette::ColorRole>(role))
+                            .rgba());
 
-        QPixmap colorized = source;
-        QPainter painter(&colorized);
-        painter.setCompositionMode(QPainter::CompositionMode_SourceIn);
-        painter.fillRect(colorized.rect(), color);
-        painter.end();
+        std::unique_lock<std::mutex> lock(cacheMtx_);
+        for (const auto &key : cache_.keys()) {
+                const auto color = keyColor(key);
+                if (color.isValid() && !colors.contains(color.rgba())) {
+                        cache_.remove(key);
+                        invalidated_++;
+                }
+        }
+}
 
-        return colorized;
+ColorImageStats
+ColorImageProvider::stats()
+{
+        ColorImageStats stats;
+        stats.cache_hits  = cache_hits_;
+        stats.renders     = renders_;
+        stats.invalidated = invalidated_;
+        return stats;
 }
@@ -1,11 +1,39 @@
+#pragma once
+
+#include <QCache>
+#include <QPalette>
 #include <QQuickImageProvider>
 
+#include <cstdint>
+#include <mutex>
+
+struct ColorImageStats
+{
+        //! Requests answered from the cache.
+        uint64_t cache_hits = 0;
+        //! Icons, which were loaded and recolored.
+        uint64_t renders = 0;
+        //! Cached icons dropped, because their color left the palette.
+        uint64_t invalidated = 0;
+};
+
 class ColorImageProvider : public QQuickImageProvider
 {
 public:
         ColorImageProvider()
-          : QQuickImageProvider(QQuickImageProvider::Pixmap)
+          : QQuickImageProvider(QQuickImageProvider::Image)
         {}
 
-        QPixmap requestPixmap(const QString &id, QSize *size, const QSize &requestedSize) override;
+        QImage requestImage(const QString &id, QSize *size, const QSize &requestedSize) override;
+
+        //! Drop the cached icons in colors, which aren't part of the palette anymore.
+        void invalidateColors(const QPalette &palette);
+
+        //! The counters of all providers.
+        static ColorImageStats stats();
+
+private:
+        //! The recolored icons by id and size, so every delegate shares the same image.
+        std::mutex cacheMtx_;
+        QCache<QString, QImage> cache_{64};
 };
@@ -2,12 +2,19 @@
 #include "Cache.h"
 #include "Logging.h"
 #include "MatrixClient.h"
+#include "NetworkUsage.h"
+#include "RequestScheduler.h"
 #include "Splitter.h"
+#include "Wakeups.h"
 
 #include <mtx/responses/groups.hpp>
 
+#include <QDateTime>
 #include <QLabel>
 
+//! The age, after which the profile and rooms of a community are fetched again.
+constexpr uint64_t COMMUNITY_MAX_AGE_MS = 60 * 60 * 1000;
+
 CommunitiesList::CommunitiesList(QWidget *parent)
   : QWidget(parent)
 {
@@ -42,25 +49,38 @@ CommunitiesList::CommunitiesList(QWidget *parent)
 
         connect(
           this, &CommunitiesList::avatarRetrieved, this, &CommunitiesList::updateCommunityAvatar);
+        connect(this, &CommunitiesList::groupProfileRetrieved, this, &CommunitiesList::setProfile);
+        connect(this, &CommunitiesList::groupRoomsRetrieved, this, &CommunitiesList::setRooms);
+
+        revalidateTimer_.setInterval(COMMUNITY_MAX_AGE_MS / 6);
+        connect(&revalidateTimer_, &QTimer::timeout, this, &CommunitiesList::revalidate);
+        revalidateTimer_.start();
+        wakeups::manage(&revalidateTimer_, "communities", true);
 }
 
 void
 CommunitiesList::setCommunities(const mtx::responses::JoinedGroups &response)
 {
-        // remove all non-tag communities
+        std::set<QString> groups;
+        for (const auto &group : response.groups)
+                groups.insert(QString::fromStdString(group));
+
+        // Remove the communities, which were left. The others are kept as they are.
         auto it = communities_.begin();
         while (it != communities_.end()) {
-                if (it->second->is_tag()) {
+                if (!isCommunity(it->first) || groups.count(it->first)) {
                         ++it;
-                } else {
-                        it = communities_.erase(it);
+                        continue;
                 }
-        }
 
-        addGlobalItem();
+                cache::removeCommunity(it->first.toStdString());
+                fetchedAt_.erase(it->first);
+                it = communities_.erase(it);
+        }
 
-        for (const auto &group : response.groups)
-                addCommunity(group);
+        for (const auto &group : groups)
+                if (!communityExists(group))
+                        addCommunity(group.toStdString());
 
         communities_["world"]->setPressedState(true);
         emit communityChanged("world");
@@ -68,18 +88,11 @@ CommunitiesList::setCommunities(const mtx::responses::JoinedGroups &response)
 }
 
 void
-CommunitiesList::syncTags(const std::map<QString, RoomInfo> &info)
+CommunitiesList::syncTags(const TagChanges &changes)
 {
-        for (const auto &room : info)
-                setTagsForRoom(room.first, room.second.tags);
-        sortEntries();
-}
+        std::set<QString> changed;
 
-void
-CommunitiesList::setTagsForRoom(const QString &room_id, const std::vector<std::string> &tags)
-{
-        // create missing tag if any
-        for (const auto &tag : tags) {
+        for (const auto &[tag, rooms] : changes.added) {
                 // filter out tags we should ignore according to the spec
                 // https://matrix.org/docs/spec/client_server/r0.4.0.html#id154
                 // nheko currently does not make use of internal tags
@@ -88,36 +101,47 @@ CommunitiesList::setTagsForRoom(const QString &room_id, const std::vector<std::s
                 if (tag.find(".") != ::std::string::npos && tag.compare(0, 2, "m.") &&
                     tag.compare(0, 2, "u."))
                         continue;
-                QString name = QString("tag:") + QString::fromStdString(tag);
-                if (!communityExists(name)) {
-                        addCommunity(std::string("tag:") + tag);
+
+                const auto id = QString::fromStdString("tag:" + tag);
+                if (!communityExists(id))
+                        addCommunity("tag:" + tag);
+
+                auto &item = communities_.at(id);
+                for (const auto &room_id : rooms) {
+                        const auto room = QString::fromStdString(room_id);
+                        if (item->hasRoom(room))
+                                continue;
+
+                        item->addRoom(room);
+                        changed.insert(id);
                 }
         }
-        // update membership of the room for all tags
-        auto it = communities_.begin();
-        while (it != communities_.end()) {
-                // Skip if the community is not a tag
-                if (!it->second->is_tag()) {
-                        ++it;
+
+        for (const auto &[tag, rooms] : changes.removed) {
+                const auto id = QString::fromStdString("tag:" + tag);
+                auto item     = communities_.find(id);
+                if (item == communities_.end())
                         continue;
+
+                for (const auto &room_id : rooms) {
+                        const auto room = QString::fromStdString(room_id);
+                        if (!item->second->hasRoom(room))
+                                continue;
+
+                        item->second->delRoom(room);
+                        changed.insert(id);
                 }
-                // insert or remove the room from the tag as appropriate
-                std::string current_tag =
-                  it->first.right(it->first.size() - strlen("tag:")).toStdString();
-                if (std::find(tags.begin(), tags.end(), current_tag) != tags.end()) {
-                        // the room has this tag
-                        it->second->addRoom(room_id);
-                } else {
-                        // the room does not have this tag
-                        it->second->delRoom(room_id);
-                }
-                // Check if the tag is now empty, if yes delete it
-                if (it->second->rooms().empty()) {
-                        it = communities_.erase(it);
-                } else {
-                        ++it;
-                }
+
+                // A tag without rooms is gone.
+                if (!item->second->hasRooms())
+                        communities_.erase(item);
         }
+
+        sortEntries();
+
+        for (const auto &id : changed)
+                if (communityExists(id))
+                        emit roomsChanged(id);
 }
 
 void
@@ -129,54 +153,126 @@ CommunitiesList::addCommunity(const std::string &group_id)
         communities_.emplace(id, QSharedPointer<CommunitiesListItem>(list_item));
         contentsLayout_->insertWidget(contentsLayout_->count() - 1, list_item);
 
-        connect(this,
-                &CommunitiesList::groupProfileRetrieved,
-                this,
-                [this](const QString &id, const mtx::responses::GroupProfile &profile) {
-                        if (communities_.find(id) == communities_.end())
-                                return;
-
-                        communities_.at(id)->setName(QString::fromStdString(profile.name));
-
-                        if (!profile.avatar_url.empty())
-                                fetchCommunityAvatar(id,
-                                                     QString::fromStdString(profile.avatar_url));
-                });
-        connect(this,
-                &CommunitiesList::groupRoomsRetrieved,
-                this,
-                [this](const QString &id, const std::map<QString, bool> &rooms) {
-                        if (communities_.find(id) == communities_.end())
-                                return;
-
-                        communities_.at(id)->setRooms(rooms);
-                });
         connect(list_item,
                 &CommunitiesListItem::clicked,
                 this,
                 &CommunitiesList::highlightSelectedCommunity);
 
-        http::client()->group_profile(
-          group_id, [id, this](const mtx::responses::GroupProfile &res, mtx::http::RequestErr err) {
-                  if (err) {
-                          return;
-                  }
+        // Tags and all rooms are known locally.
+        if (!isCommunity(id))
+                return;
 
-                  emit groupProfileRetrieved(id, res);
-          });
+        const auto cached = cache::community(group_id);
+        if (!cached) {
+                fetchCommunity(id);
+                return;
+        }
+
+        list_item->setName(QString::fromStdString(cached->name));
+        if (!cached->avatar_url.empty())
+                fetchCommunityAvatar(id, QString::fromStdString(cached->avatar_url));
 
-        http::client()->group_rooms(
-          group_id, [id, this](const nlohmann::json &res, mtx::http::RequestErr err) {
-                  if (err) {
-                          return;
-                  }
+        std::map<QString, bool> rooms;
+        for (const auto &room_id : cached->rooms)
+                rooms.emplace(QString::fromStdString(room_id), true);
+        list_item->setRooms(std::move(rooms));
+
+        fetchedAt_[id] = cached->fetched_at;
+        if (cached->fetched_at + COMMUNITY_MAX_AGE_MS <
+            static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch()))
+                fetchCommunity(id);
+}
+
+void
+CommunitiesList::fetchCommunity(const QString &id)
+{
+        const auto group_id = id.toStdString();
+
+        fetchedAt_[id] = QDateTime::currentMSecsSinceEpoch();
+
+        // Both requests are sent at once, their results are stored as they arrive.
+        http::schedule(http::Priority::Background, [group_id, id, this](auto slot) {
+                http::client()->group_profile(
+                  group_id,
+                  [slot, id, this](const mtx::responses::GroupProfile &res,
+                                   mtx::http::RequestErr err) {
+                          if (slot.retry(err) || err)
+                                  return;
+
+                          emit groupProfileRetrieved(id, res);
+                  });
+        });
+
+        http::schedule(http::Priority::Background, [group_id, id, this](auto slot) {
+                http::client()->group_rooms(
+                  group_id,
+                  [slot, id, this](const nlohmann::json &res, mtx::http::RequestErr err) {
+                          if (slot.retry(err) || err)
+                                  return;
+
+                          std::map<QString, bool> room_ids;
+                          for (const auto &room : res.at("chunk"))
+                                  room_ids.emplace(QString::fromStdString(room.at("room_id")),
+                                                   true);
+
+                          emit groupRoomsRetrieved(id, room_ids);
+                  });
+        });
+}
 
-                  std::map<QString, bool> room_ids;
-                  for (const auto &room : res.at("chunk"))
-                          room_ids.emplace(QString::fromStdString(room.at("room_id")), true);
+void
+CommunitiesList::revalidate()
+{
+        const auto now = static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch());
 
-                  emit groupRoomsRetrieved(id, room_ids);
-          });
+        for (const auto &[id, fetchedAt] : fetchedAt_)
+                if (fetchedAt + COMMUNITY_MAX_AGE_MS < now)
+                        fetchCommunity(id);
+}
+
+void
+CommunitiesList::setProfile(const QString &id, const mtx::responses::GroupProfile &profile)
+{
+        if (!communityExists(id))
+                return;
+
+        const auto group_id = id.toStdString();
+
+        auto info = cache::community(group_id).value_or(CommunityInfo{});
+
+        communities_.at(id)->setName(QString::fromStdString(profile.name));
+        if (!profile.avatar_url.empty() && profile.avatar_url != info.avatar_url)
+                fetchCommunityAvatar(id, QString::fromStdString(profile.avatar_url));
+
+        info.name       = profile.name;
+        info.avatar_url = profile.avatar_url;
+        info.fetched_at = QDateTime::currentMSecsSinceEpoch();
+        cache::saveCommunity(group_id, info);
+}
+
+void
+CommunitiesList::setRooms(const QString &id, const std::map<QString, bool> &rooms)
+{
+        if (!communityExists(id))
+                return;
+
+        const auto group_id = id.toStdString();
+
+        auto info = cache::community(group_id).value_or(CommunityInfo{});
+
+        info.rooms.clear();
+        for (const auto &room : rooms)
+                info.rooms.push_back(room.first.toStdString());
+        info.fetched_at = QDateTime::currentMSecsSinceEpoch();
+        cache::saveCommunity(group_id, info);
+
+        // The room list is only filtered again, if the rooms changed.
+        auto &item = communities_.at(id);
+        if (item->rooms() == rooms)
+                return;
+
+        item->setRooms(rooms);
+        emit roomsChanged(id);
 }
 
 void
@@ -227,25 +323,33 @@ CommunitiesList::fetchCommunityAvatar(const QString &id, const QString &avatarUr
 
         mtx::http::ThumbOpts opts;
         opts.mxc_url = avatarUrl.toStdString();
-        http::client()->get_thumbnail(
-          opts, [this, opts, id](const std::string &res, mtx::http::RequestErr err) {
-                  if (err) {
-                          nhlog::net()->warn("failed to download avatar: {} - ({} {})",
-                                             opts.mxc_url,
-                                             mtx::errors::to_string(err->matrix_error.errcode),
-                                             err->matrix_error.error);
-                          return;
-                  }
-
-                  cache::saveImage(opts.mxc_url, res);
-
-                  auto data = QByteArray(res.data(), res.size());
-
-                  QPixmap pix;
-                  pix.loadFromData(data);
-
-                  emit avatarRetrieved(id, pix);
-          });
+        http::schedule(http::Priority::Visible, [this, opts, id](auto slot) {
+                http::countRequest(http::Traffic::Thumbnail);
+                http::client()->get_thumbnail(
+                  opts, [slot, this, opts, id](const std::string &res, mtx::http::RequestErr err) {
+                          http::countBytes(http::Traffic::Thumbnail, res.size());
+                          if (slot.retry(err))
+                                  return;
+
+                          if (err) {
+                                  nhlog::net()->warn(
+                                    "failed to download avatar: {} - ({} {})",
+                                    opts.mxc_url,
+                                    mtx::errors::to_string(err->matrix_error.errcode),
+                                    err->matrix_error.error);
+                                  return;
+                          }
+
+                          cache::saveImage(opts.mxc_url, res);
+
+                          auto data = QByteArray(res.data(), res.size());
+
+                          QPixmap pix;
+                          pix.loadFromData(data);
+
+                          emit avatarRetrieved(id, pix);
+                  });
+        });
 }
 
 std::map<QString, bool>
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <set>
+
 #include <QScrollArea>
 #include <QSharedPointer>
+#include <QTimer>
 #include <QVBoxLayout>
 
 #include "CacheStructs.h"
@@ -13,6 +16,10 @@ struct GroupProfile;
 struct JoinedGroups;
 }
 
+//! The joined communities and the tags of the rooms, which filter the room list.
+//!
+//! The profiles and rooms of the communities are kept in the cache, so a start shows them without
+//! waiting for the server. They are fetched again, once they are older than an hour.
 class CommunitiesList : public QWidget
 {
         Q_OBJECT
@@ -26,11 +33,14 @@ public:
         void removeCommunity(const QString &id) { communities_.erase(id); };
         std::map<QString, bool> roomList(const QString &id) const;
 
-        void syncTags(const std::map<QString, RoomInfo> &info);
-        void setTagsForRoom(const QString &id, const std::vector<std::string> &tags);
+        //! Add and remove the rooms of the tags. Tags are created with their first room and
+        //! removed with their last one.
+        void syncTags(const TagChanges &changes);
 
 signals:
         void communityChanged(const QString &id);
+        //! The rooms of a community or tag changed.
+        void roomsChanged(const QString &id);
         void avatarRetrieved(const QString &id, const QPixmap &img);
         void groupProfileRetrieved(const QString &group_id, const mtx::responses::GroupProfile &);
         void groupRoomsRetrieved(const QString &group_id, const std::map<QString, bool> &res);
@@ -42,6 +52,17 @@ public slots:
 
 private:
         void fetchCommunityAvatar(const QString &id, const QString &avatarUrl);
+        //! Fetch the profile and the rooms of a community at once.
+        void fetchCommunity(const QString &id);
+        //! Fetch the communities, which weren't fetched for an hour.
+        void revalidate();
+        void setProfile(const QString &id, const mtx::responses::GroupProfile &profile);
+        void setRooms(const QString &id, const std::map<QString, bool> &rooms);
+        //! Whether id is a community of the server, rather than a tag or all rooms.
+        static bool isCommunity(const QString &id)
+        {
+                return id != "world" && !id.startsWith("tag:");
+        }
         void addGlobalItem() { addCommunity("world"); }
         void sortEntries();
 
@@ -56,4 +77,7 @@ private:
         QScrollArea *scrollArea_;
 
         std::map<QString, QSharedPointer<CommunitiesListItem>> communities_;
+        //! When the communities were fetched, in ms since the epoch.
+        std::map<QString, uint64_t> fetchedAt_;
+        QTimer revalidateTimer_;
 };
@@ -32,6 +32,8 @@ public:
         void setRooms(std::map<QString, bool> room_ids) { room_ids_ = std::move(room_ids); }
         void addRoom(const QString &id) { room_ids_[id] = true; }
         void delRoom(const QString &id) { room_ids_.erase(id); }
+        bool hasRoom(const QString &id) const { return room_ids_.count(id) != 0; }
+        bool hasRooms() const { return !room_ids_.empty(); }
         std::map<QString, bool> rooms() const { return room_ids_; }
 
         bool is_tag() const { return groupId_.startsWith("tag:"); }
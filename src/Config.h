@@ -1,6 +1,5 @@
 #pragma once
 
-#include <QRegularExpression>
 #include <QString>
 
 // Non-theme app configuration. Layouts, fonts spacing etc.
@@ -49,15 +48,6 @@ constexpr auto LABEL_MEDIUM_SIZE_RATIO = 1.3;
 constexpr auto LABEL_BIG_SIZE_RATIO    = 2;
 }
 
-namespace strings {
-const QString url_html = "<a href=\"\\1\">\\1</a>";
-const QRegularExpression url_regex(
-  // match an URL, that is not quoted, i.e.
-  // vvvvvv match quote via negative lookahead/lookbehind                    vv
-  //       vvvv atomic match url -> fail if there is a " before or after          vvv
-  R"((?<!")(?>((www\.(?!\.)|[a-z][a-z0-9+.-]*://)[^\s<>'"]+[^!,\.\s<>'"\]\)\:]))(?!"))");
-}
-
 // Window geometry.
 namespace window {
 constexpr int height        = 600;
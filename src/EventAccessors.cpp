@@ -46,22 +46,22 @@ struct EventMsgType
 struct EventRoomName
 {
         template<class T>
-        std::string operator()(const T &e)
+        std::string_view operator()(const T &e)
         {
                 if constexpr (std::is_same_v<mtx::events::StateEvent<mtx::events::state::Name>, T>)
                         return e.content.name;
-                return "";
+                return {};
         }
 };
 
 struct EventRoomTopic
 {
         template<class T>
-        std::string operator()(const T &e)
+        std::string_view operator()(const T &e)
         {
                 if constexpr (std::is_same_v<mtx::events::StateEvent<mtx::events::state::Topic>, T>)
                         return e.content.topic;
-                return "";
+                return {};
         }
 };
 
@@ -70,11 +70,11 @@ struct EventBody
         template<class C>
         using body_t = decltype(C::body);
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &e)
+        std::string_view operator()(const mtx::events::Event<T> &e)
         {
                 if constexpr (is_detected<body_t, T>::value)
                         return e.content.body;
-                return "";
+                return {};
         }
 };
 
@@ -83,11 +83,11 @@ struct EventFormattedBody
         template<class C>
         using formatted_body_t = decltype(C::formatted_body);
         template<class T>
-        std::string operator()(const mtx::events::RoomEvent<T> &e)
+        std::string_view operator()(const mtx::events::RoomEvent<T> &e)
         {
                 if constexpr (is_detected<formatted_body_t, T>::value)
                         return e.content.formatted_body;
-                return "";
+                return {};
         }
 };
 
@@ -109,14 +109,29 @@ struct EventUrl
         template<class Content>
         using url_t = decltype(Content::url);
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &e)
+        std::string_view operator()(const mtx::events::Event<T> &e)
         {
                 if constexpr (is_detected<url_t, T>::value) {
-                        if (auto file = EventFile{}(e))
-                                return file->url;
+                        if constexpr (is_detected<EventFile::file_t, T>::value) {
+                                if (e.content.file)
+                                        return e.content.file->url;
+                        }
                         return e.content.url;
                 }
-                return "";
+                return {};
+        }
+};
+
+struct EventThumbnailFile
+{
+        template<class Content>
+        using thumbnail_file_t = decltype(Content::info.thumbnail_file);
+        template<class T>
+        std::optional<mtx::crypto::EncryptedFile> operator()(const mtx::events::Event<T> &e)
+        {
+                if constexpr (is_detected<thumbnail_file_t, T>::value)
+                        return e.content.info.thumbnail_file;
+                return std::nullopt;
         }
 };
 
@@ -125,12 +140,16 @@ struct EventThumbnailUrl
         template<class Content>
         using thumbnail_url_t = decltype(Content::info.thumbnail_url);
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &e)
+        std::string_view operator()(const mtx::events::Event<T> &e)
         {
                 if constexpr (is_detected<thumbnail_url_t, T>::value) {
+                        if constexpr (is_detected<EventThumbnailFile::thumbnail_file_t, T>::value) {
+                                if (e.content.info.thumbnail_file)
+                                        return e.content.info.thumbnail_file->url;
+                        }
                         return e.content.info.thumbnail_url;
                 }
-                return "";
+                return {};
         }
 };
 
@@ -139,38 +158,38 @@ struct EventBlurhash
         template<class Content>
         using blurhash_t = decltype(Content::info.blurhash);
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &e)
+        std::string_view operator()(const mtx::events::Event<T> &e)
         {
                 if constexpr (is_detected<blurhash_t, T>::value) {
                         return e.content.info.blurhash;
                 }
-                return "";
+                return {};
         }
 };
 
 struct EventFilename
 {
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &)
+        std::string_view operator()(const mtx::events::Event<T> &)
         {
-                return "";
+                return {};
         }
-        std::string operator()(const mtx::events::RoomEvent<mtx::events::msg::Audio> &e)
+        std::string_view operator()(const mtx::events::RoomEvent<mtx::events::msg::Audio> &e)
         {
                 // body may be the original filename
                 return e.content.body;
         }
-        std::string operator()(const mtx::events::RoomEvent<mtx::events::msg::Video> &e)
+        std::string_view operator()(const mtx::events::RoomEvent<mtx::events::msg::Video> &e)
         {
                 // body may be the original filename
                 return e.content.body;
         }
-        std::string operator()(const mtx::events::RoomEvent<mtx::events::msg::Image> &e)
+        std::string_view operator()(const mtx::events::RoomEvent<mtx::events::msg::Image> &e)
         {
                 // body may be the original filename
                 return e.content.body;
         }
-        std::string operator()(const mtx::events::RoomEvent<mtx::events::msg::File> &e)
+        std::string_view operator()(const mtx::events::RoomEvent<mtx::events::msg::File> &e)
         {
                 // body may be the original filename
                 if (!e.content.filename.empty())
@@ -184,12 +203,12 @@ struct EventMimeType
         template<class Content>
         using mimetype_t = decltype(Content::info.mimetype);
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &e)
+        std::string_view operator()(const mtx::events::Event<T> &e)
         {
                 if constexpr (is_detected<mimetype_t, T>::value) {
                         return e.content.info.mimetype;
                 }
-                return "";
+                return {};
         }
 };
 
@@ -212,24 +231,24 @@ struct EventInReplyTo
         template<class Content>
         using related_ev_id_t = decltype(Content::relates_to.in_reply_to.event_id);
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &e)
+        std::string_view operator()(const mtx::events::Event<T> &e)
         {
                 if constexpr (is_detected<related_ev_id_t, T>::value) {
                         return e.content.relates_to.in_reply_to.event_id;
                 }
-                return "";
+                return {};
         }
 };
 
 struct EventTransactionId
 {
         template<class T>
-        std::string operator()(const mtx::events::RoomEvent<T> &e)
+        std::string_view operator()(const mtx::events::RoomEvent<T> &e)
         {
                 return e.unsigned_data.transaction_id;
         }
         template<class T>
-        std::string operator()(const mtx::events::Event<T> &e)
+        std::string_view operator()(const mtx::events::Event<T> &e)
         {
                 return e.unsigned_data.transaction_id;
         }
@@ -277,34 +296,55 @@ eventPropHeight(const mtx::events::RoomEvent<T> &e)
 }
 }
 
+std::string_view
+mtx::accessors::event_id_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit([](const auto &e) -> std::string_view { return e.event_id; }, event);
+}
+std::string_view
+mtx::accessors::room_id_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit([](const auto &e) -> std::string_view { return e.room_id; }, event);
+}
+std::string_view
+mtx::accessors::sender_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit([](const auto &e) -> std::string_view { return e.sender; }, event);
+}
+
 std::string
 mtx::accessors::event_id(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit([](const auto e) { return e.event_id; }, event);
+        return std::string(event_id_view(event));
 }
 std::string
 mtx::accessors::room_id(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit([](const auto e) { return e.room_id; }, event);
+        return std::string(room_id_view(event));
 }
 
 std::string
 mtx::accessors::sender(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit([](const auto e) { return e.sender; }, event);
+        return std::string(sender_view(event));
 }
 
 QDateTime
 mtx::accessors::origin_server_ts(const mtx::events::collections::TimelineEvents &event)
 {
         return QDateTime::fromMSecsSinceEpoch(
-          std::visit([](const auto e) { return e.origin_server_ts; }, event));
+          std::visit([](const auto &e) { return e.origin_server_ts; }, event));
 }
 
+std::string_view
+mtx::accessors::filename_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventFilename{}, event);
+}
 std::string
 mtx::accessors::filename(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventFilename{}, event);
+        return std::string(filename_view(event));
 }
 
 mtx::events::MessageType
@@ -312,37 +352,57 @@ mtx::accessors::msg_type(const mtx::events::collections::TimelineEvents &event)
 {
         return std::visit(EventMsgType{}, event);
 }
+std::string_view
+mtx::accessors::room_name_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventRoomName{}, event);
+}
 std::string
 mtx::accessors::room_name(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventRoomName{}, event);
+        return std::string(room_name_view(event));
+}
+std::string_view
+mtx::accessors::room_topic_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventRoomTopic{}, event);
 }
 std::string
 mtx::accessors::room_topic(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventRoomTopic{}, event);
+        return std::string(room_topic_view(event));
 }
 
+std::string_view
+mtx::accessors::body_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventBody{}, event);
+}
 std::string
 mtx::accessors::body(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventBody{}, event);
+        return std::string(body_view(event));
 }
 
+std::string_view
+mtx::accessors::formatted_body_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventFormattedBody{}, event);
+}
 std::string
 mtx::accessors::formatted_body(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventFormattedBody{}, event);
+        return std::string(formatted_body_view(event));
 }
 
 QString
 mtx::accessors::formattedBodyWithFallback(const mtx::events::collections::TimelineEvents &event)
 {
-        auto formatted = formatted_body(event);
+        auto formatted = formatted_body_view(event);
         if (!formatted.empty())
-                return QString::fromStdString(formatted);
+                return toQString(formatted);
         else
-                return QString::fromStdString(body(event)).toHtmlEscaped().replace("\n", "<br>");
+                return toQString(body_view(event)).toHtmlEscaped().replace("\n", "<br>");
 }
 
 std::optional<mtx::crypto::EncryptedFile>
@@ -350,37 +410,72 @@ mtx::accessors::file(const mtx::events::collections::TimelineEvents &event)
 {
         return std::visit(EventFile{}, event);
 }
+std::optional<mtx::crypto::EncryptedFile>
+mtx::accessors::thumbnail_file(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventThumbnailFile{}, event);
+}
 
+std::string_view
+mtx::accessors::url_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventUrl{}, event);
+}
 std::string
 mtx::accessors::url(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventUrl{}, event);
+        return std::string(url_view(event));
+}
+std::string_view
+mtx::accessors::thumbnail_url_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventThumbnailUrl{}, event);
 }
 std::string
 mtx::accessors::thumbnail_url(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventThumbnailUrl{}, event);
+        return std::string(thumbnail_url_view(event));
+}
+std::string_view
+mtx::accessors::blurhash_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventBlurhash{}, event);
 }
 std::string
 mtx::accessors::blurhash(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventBlurhash{}, event);
+        return std::string(blurhash_view(event));
+}
+std::string_view
+mtx::accessors::mimetype_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventMimeType{}, event);
 }
 std::string
 mtx::accessors::mimetype(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventMimeType{}, event);
+        return std::string(mimetype_view(event));
+}
+std::string_view
+mtx::accessors::in_reply_to_event_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventInReplyTo{}, event);
 }
 std::string
 mtx::accessors::in_reply_to_event(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventInReplyTo{}, event);
+        return std::string(in_reply_to_event_view(event));
 }
 
+std::string_view
+mtx::accessors::transaction_id_view(const mtx::events::collections::TimelineEvents &event)
+{
+        return std::visit(EventTransactionId{}, event);
+}
 std::string
 mtx::accessors::transaction_id(const mtx::events::collections::TimelineEvents &event)
 {
-        return std::visit(EventTransactionId{}, event);
+        return std::string(transaction_id_view(event));
 }
 
 int64_t
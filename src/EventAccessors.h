@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 
 #include <QDateTime>
 #include <QString>
@@ -8,52 +9,85 @@
 #include <mtx/events/collections.hpp>
 
 namespace mtx::accessors {
+//! The accessors returning strings copy them out of the event. The _view variants borrow them
+//! instead and stay valid only as long as the event does.
+
 std::string
 event_id(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+event_id_view(const mtx::events::collections::TimelineEvents &event);
 
 std::string
 room_id(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+room_id_view(const mtx::events::collections::TimelineEvents &event);
 
 std::string
 sender(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+sender_view(const mtx::events::collections::TimelineEvents &event);
 
 QDateTime
 origin_server_ts(const mtx::events::collections::TimelineEvents &event);
 
 std::string
 filename(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+filename_view(const mtx::events::collections::TimelineEvents &event);
 
 mtx::events::MessageType
 msg_type(const mtx::events::collections::TimelineEvents &event);
 std::string
 room_name(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+room_name_view(const mtx::events::collections::TimelineEvents &event);
 std::string
 room_topic(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+room_topic_view(const mtx::events::collections::TimelineEvents &event);
 
 std::string
 body(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+body_view(const mtx::events::collections::TimelineEvents &event);
 
 std::string
 formatted_body(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+formatted_body_view(const mtx::events::collections::TimelineEvents &event);
 
 QString
 formattedBodyWithFallback(const mtx::events::collections::TimelineEvents &event);
 
 std::optional<mtx::crypto::EncryptedFile>
 file(const mtx::events::collections::TimelineEvents &event);
+std::optional<mtx::crypto::EncryptedFile>
+thumbnail_file(const mtx::events::collections::TimelineEvents &event);
 
 std::string
 url(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+url_view(const mtx::events::collections::TimelineEvents &event);
 std::string
 thumbnail_url(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+thumbnail_url_view(const mtx::events::collections::TimelineEvents &event);
 std::string
 blurhash(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+blurhash_view(const mtx::events::collections::TimelineEvents &event);
 std::string
 mimetype(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+mimetype_view(const mtx::events::collections::TimelineEvents &event);
 std::string
 in_reply_to_event(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+in_reply_to_event_view(const mtx::events::collections::TimelineEvents &event);
 std::string
 transaction_id(const mtx::events::collections::TimelineEvents &event);
+std::string_view
+transaction_id_view(const mtx::events::collections::TimelineEvents &event);
 
 int64_t
 filesize(const mtx::events::collections::TimelineEvents &event);
@@ -63,4 +97,11 @@ media_height(const mtx::events::collections::TimelineEvents &event);
 
 uint64_t
 media_width(const mtx::events::collections::TimelineEvents &event);
+
+//! A QString of a borrowed UTF-8 string.
+inline QString
+toQString(std::string_view str)
+{
+        return QString::fromUtf8(str.data(), static_cast<int>(str.size()));
+}
 }
@@ -0,0 +1,139 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+#include <mtx/events/collections.hpp>
+
+//! Properties of the alternatives of the event variants, computed at compile time.
+//!
+//! A property is a struct with a `static constexpr value<T>()` for every alternative T. Looking
+//! it up for an event is a single index into a table built from the variant, so the table always
+//! has one entry per alternative of the mtxclient variant.
+namespace event_traits {
+//! Whether T is one of Ts.
+template<class T, class... Ts>
+constexpr bool isOneOf = (std::is_same_v<T, Ts> || ...);
+
+//! Whether T is an alternative of the variant.
+template<class T, class Variant>
+struct IsAlternative;
+template<class T, class... Ts>
+struct IsAlternative<T, std::variant<Ts...>> : std::bool_constant<isOneOf<T, Ts...>>
+{};
+
+template<class Property, class Variant>
+struct Table;
+template<class Property, class... Ts>
+struct Table<Property, std::variant<Ts...>>
+{
+        using Value = std::common_type_t<decltype(Property::template value<Ts>())...>;
+        static constexpr std::array<Value, sizeof...(Ts)> values = {
+          Property::template value<Ts>()...};
+};
+
+//! The property of the alternative held by the event.
+template<class Property, class Variant>
+constexpr auto
+lookup(const Variant &event)
+{
+        return Table<Property, Variant>::values[event.index()];
+}
+
+//! A property, which is true for the listed types.
+template<class... Types>
+struct OneOf
+{
+        using List = std::tuple<Types...>;
+
+        template<class T>
+        static constexpr bool value()
+        {
+                return isOneOf<T, Types...>;
+        }
+};
+
+//! Whether all types of the list are alternatives of the variant.
+template<class List, class Variant>
+struct AllAlternatives;
+template<class... Ts, class Variant>
+struct AllAlternatives<std::tuple<Ts...>, Variant>
+  : std::bool_constant<(IsAlternative<Ts, Variant>::value && ...)>
+{};
+
+namespace detail {
+template<template<class> class Event>
+using States = OneOf<Event<mtx::events::state::Aliases>,
+                     Event<mtx::events::state::Avatar>,
+                     Event<mtx::events::state::CanonicalAlias>,
+                     Event<mtx::events::state::Create>,
+                     Event<mtx::events::state::GuestAccess>,
+                     Event<mtx::events::state::HistoryVisibility>,
+                     Event<mtx::events::state::JoinRules>,
+                     Event<mtx::events::state::Name>,
+                     Event<mtx::events::state::Member>,
+                     Event<mtx::events::state::PowerLevels>,
+                     Event<mtx::events::state::Topic>>;
+
+template<template<class> class Event>
+using SummaryStates = OneOf<Event<mtx::events::state::Avatar>,
+                            Event<mtx::events::state::CanonicalAlias>,
+                            Event<mtx::events::state::Name>,
+                            Event<mtx::events::state::Member>,
+                            Event<mtx::events::state::Topic>>;
+}
+
+//! The state events, which are stored in the state db of a room.
+using IsState = detail::States<mtx::events::StateEvent>;
+
+//! The state events, which may change the name, topic or avatar of a room in the room list.
+using UpdatesSummary         = detail::SummaryStates<mtx::events::StateEvent>;
+using StrippedUpdatesSummary = detail::SummaryStates<mtx::events::StrippedEvent>;
+
+//! The events, which are described as the last message of a room.
+using IsMessage = OneOf<mtx::events::RoomEvent<mtx::events::msg::Audio>,
+                        mtx::events::RoomEvent<mtx::events::msg::Emote>,
+                        mtx::events::RoomEvent<mtx::events::msg::File>,
+                        mtx::events::RoomEvent<mtx::events::msg::Image>,
+                        mtx::events::RoomEvent<mtx::events::msg::Notice>,
+                        mtx::events::RoomEvent<mtx::events::msg::Text>,
+                        mtx::events::RoomEvent<mtx::events::msg::Video>,
+                        mtx::events::Sticker,
+                        mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>>;
+
+// The listed types must stay alternatives of the mtxclient variants, or the tables would
+// silently stop matching them.
+static_assert(AllAlternatives<IsState::List, mtx::events::collections::StateEvents>::value);
+static_assert(AllAlternatives<IsState::List, mtx::events::collections::TimelineEvents>::value);
+static_assert(AllAlternatives<UpdatesSummary::List, mtx::events::collections::StateEvents>::value);
+static_assert(
+  AllAlternatives<StrippedUpdatesSummary::List, mtx::events::collections::StrippedEvents>::value);
+static_assert(AllAlternatives<IsMessage::List, mtx::events::collections::TimelineEvents>::value);
+
+template<class Variant>
+constexpr bool
+isState(const Variant &event)
+{
+        return lookup<IsState>(event);
+}
+constexpr bool
+updatesSummary(const mtx::events::collections::StrippedEvents &event)
+{
+        return lookup<StrippedUpdatesSummary>(event);
+}
+template<class Variant>
+constexpr bool
+updatesSummary(const Variant &event)
+{
+        return lookup<UpdatesSummary>(event);
+}
+template<class Variant>
+constexpr bool
+isMessage(const Variant &event)
+{
+        return lookup<IsMessage>(event);
+}
+}
@@ -0,0 +1,218 @@
+#include "ImageDimensions.h"
+
+#include <memory>
+
+#include <QBuffer>
+#include <QFile>
+#include <QImageReader>
+#include <QMetaObject>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+
+#include <openssl/evp.h>
+
+#include "Cache.h"
+#include "Logging.h"
+#include "MatrixClient.h"
+#include "NetworkUsage.h"
+#include "RequestScheduler.h"
+#include "WorkerPools.h"
+
+//! The bytes requested of an image. The dimensions of a JPEG follow its metadata, which is
+//! rarely larger.
+constexpr qint64 PROBE_SIZE = 64 * 1024;
+//! The dimensions of the images kept in memory.
+constexpr int MAX_DIMENSIONS = 4096;
+
+namespace {
+//! The dimensions in the header of an image, or an invalid size.
+QSize
+readDimensions(QIODevice *device)
+{
+        // Reads the header only, like utils::readImage it ignores the orientation.
+        QImageReader reader(device);
+        return reader.size();
+}
+
+//! Decrypt the start of an encrypted file. Empty, if the encryption info is invalid.
+QByteArray
+decryptStart(const QByteArray &data, const mtx::crypto::EncryptedFile &encryptionInfo)
+{
+        const auto key = QByteArray::fromBase64(QByteArray::fromStdString(encryptionInfo.key.k),
+                                                QByteArray::Base64UrlEncoding);
+        const auto iv  = QByteArray::fromBase64(QByteArray::fromStdString(encryptionInfo.iv));
+        if (key.size() != 32 || iv.size() != 16)
+                return {};
+
+        std::unique_ptr<EVP_CIPHER_CTX, decltype(&EVP_CIPHER_CTX_free)> cipher(
+          EVP_CIPHER_CTX_new(), &EVP_CIPHER_CTX_free);
+
+        QByteArray plaintext(data.size(), Qt::Uninitialized);
+        int length = 0;
+        if (!cipher ||
+            EVP_DecryptInit_ex(cipher.get(),
+                               EVP_aes_256_ctr(),
+                               nullptr,
+                               reinterpret_cast<const unsigned char *>(key.constData()),
+                               reinterpret_cast<const unsigned char *>(iv.constData())) != 1 ||
+            EVP_DecryptUpdate(cipher.get(),
+                              reinterpret_cast<unsigned char *>(plaintext.data()),
+                              &length,
+                              reinterpret_cast<const unsigned char *>(data.constData()),
+                              data.size()) != 1)
+                return {};
+
+        plaintext.resize(length);
+        return plaintext;
+}
+}
+
+ImageDimensions &
+ImageDimensions::instance()
+{
+        static ImageDimensions dimensions;
+        return dimensions;
+}
+
+QSize
+ImageDimensions::dimensions(const QString &mxcUrl,
+                            const std::optional<mtx::crypto::EncryptedFile> &encryptionInfo)
+{
+        if (!mxcUrl.startsWith("mxc://"))
+                return {};
+
+        if (auto it = dimensions_.constFind(mxcUrl); it != dimensions_.constEnd())
+                return *it;
+
+        if (probing_.contains(mxcUrl) || failed_.contains(mxcUrl))
+                return {};
+
+        probing_.insert(mxcUrl);
+
+        workers::run(workers::Pool::Decode,
+                     workers::Priority::Visible,
+                     [this, mxcUrl, encryptionInfo]() {
+                             auto size = cache::imageDimensions(mxcUrl);
+
+                             // A stored image has its header on disk, whether it was encrypted
+                             // or not.
+                             if (!size.isValid()) {
+                                     const auto path =
+                                       cache::mediaPath(QString(mxcUrl).remove("mxc://"));
+                                     QFile file(path);
+                                     if (!path.isEmpty() && file.open(QIODevice::ReadOnly))
+                                             size = readDimensions(&file);
+                                     if (size.isValid())
+                                             cache::saveImageDimensions(mxcUrl, size);
+                             }
+
+                             QMetaObject::invokeMethod(
+                               this,
+                               [this, mxcUrl, encryptionInfo, size]() {
+                                       if (size.isValid())
+                                               finish(mxcUrl, size);
+                                       else
+                                               probe(mxcUrl, encryptionInfo);
+                               },
+                               Qt::QueuedConnection);
+                     });
+
+        return {};
+}
+
+void
+ImageDimensions::probe(const QString &mxcUrl,
+                       const std::optional<mtx::crypto::EncryptedFile> &encryptionInfo)
+{
+        const auto url = http::mediaDownloadUrl(mxcUrl);
+        if (!url.isValid()) {
+                finish(mxcUrl, {});
+                return;
+        }
+
+        http::schedule(http::Priority::Visible, [this, url, mxcUrl, encryptionInfo](auto slot) {
+                // The scheduler may start the request from another thread.
+                QMetaObject::invokeMethod(
+                  this,
+                  [this, slot, url, mxcUrl, encryptionInfo]() {
+                          QNetworkRequest request(url);
+                          request.setAttribute(QNetworkRequest::FollowRedirectsAttribute, true);
+                          request.setRawHeader("Authorization",
+                                               "Bearer " + QByteArray::fromStdString(
+                                                             http::client()->access_token()));
+                          // A server, which ignores the range, sends the whole file, which is
+                          // aborted after the first bytes.
+                          request.setRawHeader("Range",
+                                               QString("bytes=0-%1").arg(PROBE_SIZE - 1).toUtf8());
+
+                          http::countRequest(http::Traffic::Download);
+                          auto reply = http::networkManager()->get(request);
+                          reply->setReadBufferSize(PROBE_SIZE);
+
+                          auto data = std::make_shared<QByteArray>();
+                          connect(reply, &QNetworkReply::readyRead, this, [reply, data]() {
+                                  const auto chunk = reply->read(PROBE_SIZE - data->size());
+                                  http::countBytes(http::Traffic::Download, chunk.size());
+                                  data->append(chunk);
+                                  if (data->size() >= PROBE_SIZE)
+                                          reply->abort();
+                          });
+                          connect(reply,
+                                  &QNetworkReply::finished,
+                                  this,
+                                  [this, slot, reply, data, mxcUrl, encryptionInfo]() {
+                                          reply->deleteLater();
+
+                                          if (data->isEmpty())
+                                                  nhlog::net()->debug(
+                                                    "failed to probe the dimensions of {}: {}",
+                                                    mxcUrl.toStdString(),
+                                                    reply->errorString().toStdString());
+
+                                          readHeader(mxcUrl, *data, encryptionInfo);
+                                  });
+                  },
+                  Qt::QueuedConnection);
+        });
+}
+
+void
+ImageDimensions::readHeader(const QString &mxcUrl,
+                            QByteArray header,
+                            const std::optional<mtx::crypto::EncryptedFile> &encryptionInfo)
+{
+        workers::run(
+          workers::Pool::Decode,
+          workers::Priority::Visible,
+          [this, mxcUrl, header = std::move(header), encryptionInfo]() mutable {
+                  if (encryptionInfo)
+                          header = decryptStart(header, *encryptionInfo);
+
+                  QBuffer buffer(&header);
+                  buffer.open(QIODevice::ReadOnly);
+                  const auto size = readDimensions(&buffer);
+                  if (size.isValid())
+                          cache::saveImageDimensions(mxcUrl, size);
+
+                  QMetaObject::invokeMethod(
+                    this, [this, mxcUrl, size]() { finish(mxcUrl, size); }, Qt::QueuedConnection);
+          });
+}
+
+void
+ImageDimensions::finish(const QString &mxcUrl, const QSize &size)
+{
+        probing_.remove(mxcUrl);
+
+        if (!size.isValid()) {
+                failed_.insert(mxcUrl);
+                emit failed(mxcUrl);
+                return;
+        }
+
+        if (dimensions_.size() >= MAX_DIMENSIONS)
+                dimensions_.clear();
+        dimensions_.insert(mxcUrl, size);
+
+        emit probed(mxcUrl, size);
+}
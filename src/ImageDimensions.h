@@ -0,0 +1,60 @@
+#pragma once
+
+#include <optional>
+
+#include <QByteArray>
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QSize>
+#include <QString>
+
+#include <mtx/common.hpp>
+
+//! The dimensions of the images, whose events don't have them, so the timeline lays out their
+//! rows at the final height, before the images are loaded.
+//!
+//! Only the header of an image is read: from the media store, if the image is stored in full, or
+//! with a range request of the first bytes of the file. Encrypted files are decrypted as they
+//! arrive, AES-CTR doesn't need the rest of the file for that. The dimensions are kept in the
+//! cache, an image, whose header doesn't have them, is probed once per session. The cache, the
+//! files and the headers are read by the decode pool.
+//!
+//! Used from the main thread.
+class ImageDimensions : public QObject
+{
+        Q_OBJECT
+
+public:
+        static ImageDimensions &instance();
+
+        //! The dimensions of the image, if they are known in memory. Otherwise they are probed
+        //! and probed() or failed() is emitted, once the probe is done.
+        QSize dimensions(const QString &mxcUrl,
+                         const std::optional<mtx::crypto::EncryptedFile> &encryptionInfo);
+        //! Whether the dimensions of the image are probed right now.
+        bool probing(const QString &mxcUrl) const { return probing_.contains(mxcUrl); }
+
+signals:
+        void probed(const QString &mxcUrl, const QSize &size);
+        //! Neither the cache nor the header of the image have its dimensions.
+        void failed(const QString &mxcUrl);
+
+private:
+        ImageDimensions() = default;
+
+        void probe(const QString &mxcUrl,
+                   const std::optional<mtx::crypto::EncryptedFile> &encryptionInfo);
+        //! Read the dimensions from the header in the decode pool and finish the probe.
+        void readHeader(const QString &mxcUrl,
+                        QByteArray header,
+                        const std::optional<mtx::crypto::EncryptedFile> &encryptionInfo);
+        //! Finish the probe on the main thread. An invalid size, if it failed.
+        void finish(const QString &mxcUrl, const QSize &size);
+
+        QHash<QString, QSize> dimensions_;
+        //! The images, which are probed right now.
+        QSet<QString> probing_;
+        //! The images, whose header didn't have their dimensions.
+        QSet<QString> failed_;
+};
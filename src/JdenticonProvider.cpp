@@ -0,0 +1,151 @@
+#include "JdenticonProvider.h"
+
+#include <algorithm>
+#include <mutex>
+
+#include <QBuffer>
+#include <QCache>
+#include <QCryptographicHash>
+#include <QPainter>
+#include <QSvgRenderer>
+#include <QUrl>
+
+#include "Cache.h"
+#include "Logging.h"
+#include "Utils.h"
+#include "jdenticoninterface.h"
+
+//! Identicons are flat and small, so a few MiB hold the ones of a big room.
+constexpr int CACHE_BYTES = 8 * 1024 * 1024;
+//! Nobody needs a larger identicon, so larger requests are scaled up by QML.
+constexpr int MAX_SIZE     = 512;
+constexpr int DEFAULT_SIZE = 64;
+
+namespace {
+std::atomic<JdenticonInterface *> generator_{nullptr};
+//! The plugin isn't known to be thread safe, so only one identicon is rendered at a time.
+std::mutex generator_mtx_;
+
+std::mutex cache_mtx_;
+QCache<QString, QImage> cache_(CACHE_BYTES);
+
+QImage
+render(const QString &userId, int size)
+{
+        QString svg;
+        {
+                std::unique_lock<std::mutex> lock(generator_mtx_);
+                svg = generator_.load()->generate(userId, static_cast<uint16_t>(size));
+        }
+
+        QSvgRenderer renderer(svg.toUtf8());
+        if (!renderer.isValid())
+                return QImage();
+
+        QImage image(size, size, QImage::Format_ARGB32_Premultiplied);
+        image.fill(Qt::transparent);
+
+        QPainter painter(&image);
+        renderer.render(&painter);
+        painter.end();
+
+        return image;
+}
+}
+
+void
+JdenticonProvider::setGenerator(JdenticonInterface *generator)
+{
+        generator_ = generator;
+}
+
+bool
+JdenticonProvider::available()
+{
+        return generator_ != nullptr;
+}
+
+std::size_t
+JdenticonProvider::memoryUsage()
+{
+        std::unique_lock<std::mutex> lock(cache_mtx_);
+        return static_cast<std::size_t>(cache_.totalCost());
+}
+
+QQuickImageResponse *
+JdenticonProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+        // The same ?radius= as the avatars of the MxcImageProvider.
+        auto userId  = id;
+        qreal radius = 0;
+        if (const auto query = id.indexOf("?radius="); query != -1) {
+                radius = id.midRef(query + 8).toDouble();
+                userId.truncate(query);
+        }
+
+        auto response =
+          new JdenticonResponse(QUrl::fromPercentEncoding(userId.toUtf8()), requestedSize, radius);
+        pool.start(response);
+        return response;
+}
+
+void
+JdenticonResponse::run()
+{
+        // A cancelled response still has to finish, so the engine deletes it.
+        if (m_cancelled) {
+                m_error = QStringLiteral("Cancelled");
+                emit finished();
+                return;
+        }
+
+        if (!JdenticonProvider::available()) {
+                m_error = QStringLiteral("No jdenticon plugin");
+                emit finished();
+                return;
+        }
+
+        const int requested = std::max(m_requestedSize.width(), m_requestedSize.height());
+        const int size      = requested > 0 ? std::min(requested, MAX_SIZE) : DEFAULT_SIZE;
+        const auto hash     = QString::fromLatin1(
+          QCryptographicHash::hash(m_userId.toUtf8(), QCryptographicHash::Sha256).toHex());
+        const auto key      = QStringLiteral("jdenticon/%1/%2").arg(hash).arg(size);
+
+        QImage image;
+        {
+                std::unique_lock<std::mutex> lock(cache_mtx_);
+                if (auto cached = cache_.object(key))
+                        image = *cached;
+        }
+
+        if (image.isNull()) {
+                if (image.loadFromData(cache::image(key)) && image.width() != size)
+                        image = QImage();
+        }
+
+        if (image.isNull()) {
+                image = render(m_userId, size);
+                if (image.isNull()) {
+                        nhlog::ui()->warn("jdenticon failed for {}", m_userId.toStdString());
+                        m_error = QStringLiteral("Failed to render the identicon");
+                        emit finished();
+                        return;
+                }
+
+                QByteArray png;
+                QBuffer buffer(&png);
+                buffer.open(QIODevice::WriteOnly);
+                image.save(&buffer, "PNG");
+                cache::saveImage(key, png);
+        }
+
+        {
+                std::unique_lock<std::mutex> lock(cache_mtx_);
+                if (!cache_.contains(key))
+                        cache_.insert(
+                          key, new QImage(image), image.bytesPerLine() * image.height());
+        }
+
+        m_image = utils::roundedImage(image, m_radius);
+        emit finished();
+}
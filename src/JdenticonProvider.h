@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+
+#include <QQuickAsyncImageProvider>
+#include <QQuickImageResponse>
+
+#include <QImage>
+#include <QThreadPool>
+
+class JdenticonInterface;
+
+class JdenticonResponse
+  : public QQuickImageResponse
+  , public QRunnable
+{
+public:
+        JdenticonResponse(const QString &userId, const QSize &requestedSize, qreal radius)
+          : m_userId(userId)
+          , m_requestedSize(requestedSize)
+          , m_radius(radius)
+        {
+                setAutoDelete(false);
+        }
+
+        QQuickTextureFactory *textureFactory() const override
+        {
+                return QQuickTextureFactory::textureFactoryForImage(m_image);
+        }
+        QString errorString() const override { return m_error; }
+
+        void run() override;
+        //! Skip the rendering, if it didn't start yet.
+        void cancel() override { m_cancelled = true; }
+
+        QString m_userId, m_error;
+        QSize m_requestedSize;
+        QImage m_image;
+        //! The radius of the corners, which are cut off the image.
+        qreal m_radius = 0;
+
+private:
+        std::atomic_bool m_cancelled{false};
+};
+
+//! The identicons of users without an avatar, rendered by the jdenticon plugin.
+//!
+//! The plugin renders an svg for every request, so the rendered images are kept by a hash of the
+//! user id and their size, in memory and in the media store. The sizes are the buckets of
+//! TimelineViewManager::imageSourceSize, so a big room of default avatars renders a few images.
+class JdenticonProvider
+  : public QObject
+  , public QQuickAsyncImageProvider
+{
+        Q_OBJECT
+public:
+        //! Set the plugin, once it is loaded. It isn't deleted.
+        static void setGenerator(JdenticonInterface *generator);
+        //! Whether the plugin is loaded, otherwise every request fails.
+        static bool available();
+        //! The bytes of the rendered identicons in memory.
+        static std::size_t memoryUsage();
+
+public slots:
+        QQuickImageResponse *requestImageResponse(const QString &id,
+                                                  const QSize &requestedSize) override;
+
+private:
+        QThreadPool pool;
+};
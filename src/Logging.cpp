@@ -1,10 +1,12 @@
 #include "Logging.h"
 #include "config/nheko.h"
 
+#include "spdlog/async.h"
 #include "spdlog/sinks/rotating_file_sink.h"
 #include "spdlog/sinks/stdout_color_sinks.h"
 #include <iostream>
 
+#include <QSettings>
 #include <QString>
 #include <QtGlobal>
 
@@ -17,6 +19,49 @@ std::shared_ptr<spdlog::logger> qml_logger    = nullptr;
 
 constexpr auto MAX_FILE_SIZE = 1024 * 1024 * 6;
 constexpr auto MAX_LOG_FILES = 3;
+//! How many messages wait for the logging thread at most. A burst beyond that overwrites the
+//! oldest ones, instead of blocking the threads logging it.
+constexpr std::size_t LOG_QUEUE_SIZE = 8192;
+
+bool
+debugLogging()
+{
+        return nheko::enable_debug_log || nhlog::enable_debug_log_from_commandline;
+}
+
+spdlog::level::level_enum
+parseLevel(const std::string &level, spdlog::level::level_enum fallback)
+{
+        static const std::pair<const char *, spdlog::level::level_enum> levels[] = {
+          {"trace", spdlog::level::trace},
+          {"debug", spdlog::level::debug},
+          {"info", spdlog::level::info},
+          {"warn", spdlog::level::warn},
+          {"error", spdlog::level::err},
+          {"critical", spdlog::level::critical},
+          {"off", spdlog::level::off},
+        };
+
+        for (const auto &[name, value] : levels)
+                if (level == name)
+                        return value;
+
+        return fallback;
+}
+
+std::shared_ptr<spdlog::logger>
+makeLogger(const std::string &name, const std::vector<spdlog::sink_ptr> &sinks, bool async)
+{
+        if (!async)
+                return std::make_shared<spdlog::logger>(name, sinks.begin(), sinks.end());
+
+        return std::make_shared<spdlog::async_logger>(
+          name,
+          sinks.begin(),
+          sinks.end(),
+          spdlog::thread_pool(),
+          spdlog::async_overflow_policy::overrun_oldest);
+}
 
 void
 qmlMessageHandler(QtMsgType type, const QMessageLogContext &context, const QString &msg)
@@ -72,49 +117,77 @@ init(const std::string &file_path)
         sinks.push_back(file_sink);
         sinks.push_back(console_sink);
 
-        net_logger = std::make_shared<spdlog::logger>("net", std::begin(sinks), std::end(sinks));
-        ui_logger  = std::make_shared<spdlog::logger>("ui", std::begin(sinks), std::end(sinks));
-        db_logger  = std::make_shared<spdlog::logger>("db", std::begin(sinks), std::end(sinks));
-        crypto_logger =
-          std::make_shared<spdlog::logger>("crypto", std::begin(sinks), std::end(sinks));
-        qml_logger = std::make_shared<spdlog::logger>("qml", std::begin(sinks), std::end(sinks));
-
-        if (nheko::enable_debug_log || enable_debug_log_from_commandline) {
-                db_logger->set_level(spdlog::level::trace);
-                ui_logger->set_level(spdlog::level::trace);
-                crypto_logger->set_level(spdlog::level::trace);
-                net_logger->set_level(spdlog::level::trace);
-                qml_logger->set_level(spdlog::level::trace);
-        }
+        // The messages before a crash must reach the file, when debugging.
+        const bool async =
+          !debugLogging() && QSettings().value("user/logging/async", true).toBool();
+        if (async)
+                spdlog::init_thread_pool(LOG_QUEUE_SIZE, 1);
+
+        net_logger    = makeLogger("net", sinks, async);
+        ui_logger     = makeLogger("ui", sinks, async);
+        db_logger     = makeLogger("db", sinks, async);
+        crypto_logger = makeLogger("crypto", sinks, async);
+        qml_logger    = makeLogger("qml", sinks, async);
+
+        setLevel(QSettings().value("user/logging/level", "info").toString().toStdString());
 
         qInstallMessageHandler(qmlMessageHandler);
 }
 
-std::shared_ptr<spdlog::logger>
+void
+setLevel(const std::string &level)
+{
+        const std::pair<const char *, spdlog::logger *> loggers[] = {
+          {"ui", ui_logger.get()},
+          {"net", net_logger.get()},
+          {"db", db_logger.get()},
+          {"crypto", crypto_logger.get()},
+          {"qml", qml_logger.get()},
+        };
+
+        const auto fallback = parseLevel(level, spdlog::level::info);
+
+        QSettings settings;
+        for (const auto &[category, logger] : loggers) {
+                if (!logger)
+                        continue;
+
+                if (debugLogging()) {
+                        logger->set_level(spdlog::level::trace);
+                        continue;
+                }
+
+                const auto key = QString("user/logging/%1_level").arg(category);
+                logger->set_level(
+                  parseLevel(settings.value(key).toString().toStdString(), fallback));
+        }
+}
+
+const std::shared_ptr<spdlog::logger> &
 ui()
 {
         return ui_logger;
 }
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 net()
 {
         return net_logger;
 }
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 db()
 {
         return db_logger;
 }
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 crypto()
 {
         return crypto_logger;
 }
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 qml()
 {
         return qml_logger;
@@ -4,22 +4,30 @@
 #include <spdlog/spdlog.h>
 
 namespace nhlog {
+//! Set up the loggers. Unless debug logging is enabled, the messages are written by a logging
+//! thread, so a log call only queues its message. See user/logging/async.
 void
 init(const std::string &file);
 
-std::shared_ptr<spdlog::logger>
+//! Set the level of every category to one of "trace", "debug", "info", "warn", "error",
+//! "critical" or "off". The levels of single categories can be set by
+//! user/logging/<category>_level, e.g. user/logging/crypto_level. Debug logging overrides them.
+void
+setLevel(const std::string &level);
+
+const std::shared_ptr<spdlog::logger> &
 ui();
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 net();
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 db();
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 crypto();
 
-std::shared_ptr<spdlog::logger>
+const std::shared_ptr<spdlog::logger> &
 qml();
 
 extern bool enable_debug_log_from_commandline;
@@ -16,6 +16,7 @@
  */
 
 #include <QApplication>
+#include <QHideEvent>
 #include <QLayout>
 #include <QPluginLoader>
 #include <QSettings>
@@ -26,6 +27,7 @@
 #include "Cache.h"
 #include "ChatPage.h"
 #include "Config.h"
+#include "JdenticonProvider.h"
 #include "Logging.h"
 #include "LoginPage.h"
 #include "MainWindow.h"
@@ -40,12 +42,14 @@
 #include "ui/OverlayModal.h"
 #include "ui/SnackBar.h"
 
+#include "dialogs/CacheStatistics.h"
 #include "dialogs/CreateRoom.h"
 #include "dialogs/InviteUsers.h"
 #include "dialogs/JoinRoom.h"
 #include "dialogs/LeaveRoom.h"
 #include "dialogs/Logout.h"
 #include "dialogs/MemberList.h"
+#include "dialogs/MemoryStatistics.h"
 #include "dialogs/ReadReceipts.h"
 #include "dialogs/RoomSettings.h"
 
@@ -101,6 +105,8 @@ MainWindow::MainWindow(QWidget *parent)
         connect(chat_page_, &ChatPage::closing, this, &MainWindow::showWelcomePage);
         connect(
           chat_page_, &ChatPage::showOverlayProgressBar, this, &MainWindow::showOverlayProgressBar);
+        connect(
+          chat_page_, &ChatPage::initialSyncProgress, this, &MainWindow::showOverlayProgress);
         connect(
           chat_page_, SIGNAL(changeWindowTitle(QString)), this, SLOT(setWindowTitle(QString)));
         connect(chat_page_, SIGNAL(unreadMessages(int)), trayIcon_, SLOT(setUnreadCount(int)));
@@ -146,6 +152,20 @@ MainWindow::MainWindow(QWidget *parent)
                         chat_page_->showQuickSwitcher();
         });
 
+        // Hidden debug page, to see where the time in the cache goes.
+        QShortcut *cacheStatsShortcut = new QShortcut(QKeySequence("Ctrl+Shift+Alt+D"), this);
+        connect(cacheStatsShortcut, &QShortcut::activated, this, [this]() {
+                if (chat_page_->isVisible())
+                        (new dialogs::CacheStatistics(this))->show();
+        });
+
+        // Hidden debug page, to see which cache or setting the memory goes to.
+        QShortcut *memoryStatsShortcut = new QShortcut(QKeySequence("Ctrl+Shift+Alt+M"), this);
+        connect(memoryStatsShortcut, &QShortcut::activated, this, [this]() {
+                if (chat_page_->isVisible())
+                        (new dialogs::MemoryStatistics(this))->show();
+        });
+
         QSettings settings;
 
         trayIcon_->setVisible(userSettings_->isTrayEnabled());
@@ -181,6 +201,19 @@ MainWindow::showEvent(QShowEvent *event)
 {
         adjustSideBars();
         QMainWindow::showEvent(event);
+
+        chat_page_->setWindowHidden(false);
+}
+
+void
+MainWindow::hideEvent(QHideEvent *event)
+{
+        QMainWindow::hideEvent(event);
+
+        // Spontaneous hide events come from minimizing, which still shows the window in the
+        // taskbar.
+        if (!event->spontaneous())
+                chat_page_->setWindowHidden(true);
 }
 
 void
@@ -370,6 +403,24 @@ MainWindow::showOverlayProgressBar()
         showSolidOverlayModal(spinner_);
 }
 
+void
+MainWindow::showOverlayProgress(int value, int maximum)
+{
+        // Replaces the spinner, once the progress is known.
+        if (!progressBar_) {
+                progressBar_ = new QProgressBar(this);
+                progressBar_->setFixedWidth(300);
+                progressBar_->setFormat(tr("Saving rooms %v / %m"));
+
+                // Deleted by the modal, when the progress bar replaces it.
+                spinner_ = nullptr;
+                showSolidOverlayModal(progressBar_);
+        }
+
+        progressBar_->setMaximum(maximum);
+        progressBar_->setValue(value);
+}
+
 void
 MainWindow::openInviteUsersDialog(std::function<void(const QStringList &invitees)> callback)
 {
@@ -502,6 +553,7 @@ MainWindow::loadJdenticonPlugin()
                                 jdenticonInteface_ = qobject_cast<JdenticonInterface *>(plugin);
                                 if (jdenticonInteface_) {
                                         nhlog::ui()->info("Found jdenticon plugin.");
+                                        JdenticonProvider::setGenerator(jdenticonInteface_);
                                         return true;
                                 }
                         }
@@ -20,6 +20,8 @@
 #include <functional>
 
 #include <QMainWindow>
+#include <QPointer>
+#include <QProgressBar>
 #include <QSharedPointer>
 #include <QStackedWidget>
 #include <QSystemTrayIcon>
@@ -90,6 +92,7 @@ protected:
         void closeEvent(QCloseEvent *event) override;
         void resizeEvent(QResizeEvent *event) override;
         void showEvent(QShowEvent *event) override;
+        void hideEvent(QHideEvent *event) override;
 
 private slots:
         //! Show or hide the sidebars based on window's size.
@@ -113,6 +116,8 @@ private slots:
         void showChatPage();
 
         void showOverlayProgressBar();
+        //! Show the progress of loading, instead of the spinner of showOverlayProgressBar.
+        void showOverlayProgress(int value, int maximum);
         void removeOverlayProgressBar();
 
 private:
@@ -147,6 +152,8 @@ private:
         //! Overlay modal used to project other widgets.
         OverlayModal *modal_       = nullptr;
         LoadingIndicator *spinner_ = nullptr;
+        //! Deleted by the modal, when it shows another widget.
+        QPointer<QProgressBar> progressBar_;
 
         JdenticonInterface *jdenticonInteface_ = nullptr;
 };
@@ -2,13 +2,21 @@
 
 #include <memory>
 
+#include <QCoreApplication>
 #include <QMetaType>
+#include <QNetworkAccessManager>
 #include <QObject>
+#include <QPointer>
+#include <QSettings>
 #include <QString>
+#include <QUrl>
 
 #include "nlohmann/json.hpp"
 #include <mtx/responses.hpp>
 
+#include "NetworkUsage.h"
+#include "RequestScheduler.h"
+
 Q_DECLARE_METATYPE(mtx::responses::Login)
 Q_DECLARE_METATYPE(mtx::responses::Messages)
 Q_DECLARE_METATYPE(mtx::responses::Notifications)
@@ -34,6 +42,32 @@ client()
         return client_.get();
 }
 
+QNetworkAccessManager *
+networkManager()
+{
+        static QPointer<QNetworkAccessManager> manager;
+        if (!manager)
+                manager = new QNetworkAccessManager(QCoreApplication::instance());
+        return manager;
+}
+
+QUrl
+mediaDownloadUrl(const QString &mxcUrl)
+{
+        const auto mxc = mtx::client::utils::parse_mxc_url(mxcUrl.toStdString());
+        if (mxc.server.empty() || mxc.media_id.empty())
+                return {};
+
+        QUrl url;
+        url.setScheme("https");
+        url.setHost(QString::fromStdString(client_->server()));
+        url.setPort(client_->port());
+        url.setPath(QString("/_matrix/media/r0/download/%1/%2")
+                      .arg(QString::fromStdString(mxc.server))
+                      .arg(QString::fromStdString(mxc.media_id)));
+        return url;
+}
+
 bool
 is_logged_in()
 {
@@ -55,6 +89,11 @@ init()
         qRegisterMetaType<std::vector<std::string>>();
         qRegisterMetaType<std::vector<QString>>();
         qRegisterMetaType<std::map<QString, bool>>("std::map<QString, bool>");
+
+        QSettings settings;
+        setMaxDownloads(settings.value("user/network/parallel_downloads", 6).toInt());
+        setTrafficBudget(settings.value("user/network/hourly_budget_mb", 0).toULongLong() * 1024 *
+                         1024);
 }
 
 } // namespace http
@@ -2,10 +2,25 @@
 
 #include <mtxclient/http/client.hpp>
 
+class QNetworkAccessManager;
+class QString;
+class QUrl;
+
 namespace http {
 mtx::http::Client *
 client();
 
+//! The network access manager of the media requests, which the client can't make, like range
+//! requests and downloads, which are written to disk as they arrive. Owned by the application, so
+//! it is destroyed before it. Used from the main thread.
+QNetworkAccessManager *
+networkManager();
+
+//! The url of the media repository of the server, which downloads the media of an mxc url. An
+//! invalid url, if it isn't one.
+QUrl
+mediaDownloadUrl(const QString &mxcUrl);
+
 bool
 is_logged_in();
 
@@ -0,0 +1,172 @@
+#include "MediaDownload.h"
+
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QUrl>
+
+#include <openssl/evp.h>
+
+#include "Logging.h"
+#include "MatrixClient.h"
+#include "NetworkUsage.h"
+
+//! The received data is processed in chunks of this size, so the buffer of the reply stays small.
+constexpr qint64 CHUNK_SIZE = 256 * 1024;
+
+MediaDownload::MediaDownload(const QString &mxcUrl,
+                             const QString &path,
+                             std::optional<mtx::crypto::EncryptedFile> encryptionInfo,
+                             QObject *parent)
+  : QObject(parent)
+  , mxcUrl_(mxcUrl)
+  , path_(path)
+  , encryptionInfo_(std::move(encryptionInfo))
+  , file_(path)
+{}
+
+MediaDownload::~MediaDownload()
+{
+        if (cipher_)
+                EVP_CIPHER_CTX_free(cipher_);
+}
+
+void
+MediaDownload::start()
+{
+        if (!file_.open(QIODevice::WriteOnly)) {
+                fail(file_.errorString());
+                return;
+        }
+
+        if (encryptionInfo_) {
+                const auto key = QByteArray::fromBase64(
+                  QByteArray::fromStdString(encryptionInfo_->key.k), QByteArray::Base64UrlEncoding);
+                const auto iv =
+                  QByteArray::fromBase64(QByteArray::fromStdString(encryptionInfo_->iv));
+
+                cipher_ = EVP_CIPHER_CTX_new();
+                if (key.size() != 32 || iv.size() != 16 || !cipher_ ||
+                    EVP_DecryptInit_ex(cipher_,
+                                       EVP_aes_256_ctr(),
+                                       nullptr,
+                                       reinterpret_cast<const unsigned char *>(key.constData()),
+                                       reinterpret_cast<const unsigned char *>(iv.constData())) !=
+                      1) {
+                        fail("invalid encryption info");
+                        return;
+                }
+        }
+
+        const auto url = http::mediaDownloadUrl(mxcUrl_);
+        if (!url.isValid()) {
+                fail("invalid mxc url");
+                return;
+        }
+
+        QNetworkRequest request(url);
+        request.setAttribute(QNetworkRequest::FollowRedirectsAttribute, true);
+        request.setRawHeader(
+          "Authorization",
+          "Bearer " + QByteArray::fromStdString(http::client()->access_token()));
+
+        http::countRequest(http::Traffic::Download);
+        reply_ = http::networkManager()->get(request);
+        reply_->setReadBufferSize(CHUNK_SIZE);
+
+        connect(reply_, &QNetworkReply::readyRead, this, &MediaDownload::readChunk);
+        connect(reply_, &QNetworkReply::downloadProgress, this, &MediaDownload::progress);
+        connect(reply_, &QNetworkReply::finished, this, &MediaDownload::complete);
+}
+
+void
+MediaDownload::readChunk()
+{
+        if (done_)
+                return;
+
+        while (reply_->bytesAvailable() > 0) {
+                auto chunk = reply_->read(CHUNK_SIZE);
+                http::countBytes(http::Traffic::Download, chunk.size());
+
+                if (cipher_) {
+                        // The hash of an encrypted file is the hash of the ciphertext.
+                        hash_.addData(chunk);
+
+                        // CTR mode doesn't pad, so the plaintext has the size of the ciphertext.
+                        QByteArray plain(chunk.size(), Qt::Uninitialized);
+                        int length = 0;
+                        if (EVP_DecryptUpdate(
+                              cipher_,
+                              reinterpret_cast<unsigned char *>(plain.data()),
+                              &length,
+                              reinterpret_cast<const unsigned char *>(chunk.constData()),
+                              chunk.size()) != 1) {
+                                fail("failed to decrypt the file");
+                                return;
+                        }
+                        plain.resize(length);
+                        chunk = plain;
+                }
+
+                if (file_.write(chunk) != chunk.size()) {
+                        fail(file_.errorString());
+                        return;
+                }
+                written_ += chunk.size();
+        }
+}
+
+void
+MediaDownload::complete()
+{
+        if (done_)
+                return;
+
+        if (reply_->error() != QNetworkReply::NoError) {
+                fail(reply_->errorString());
+                return;
+        }
+
+        readChunk();
+        if (done_)
+                return;
+
+        if (encryptionInfo_) {
+                auto expected = encryptionInfo_->hashes.find("sha256");
+                if (expected == encryptionInfo_->hashes.end() ||
+                    QByteArray::fromBase64(QByteArray::fromStdString(expected->second)) !=
+                      hash_.result()) {
+                        fail("the hash of the file doesn't match");
+                        return;
+                }
+        }
+
+        if (!file_.commit()) {
+                fail(file_.errorString());
+                return;
+        }
+
+        done_ = true;
+        emit finished(path_, written_);
+
+        reply_->deleteLater();
+        deleteLater();
+}
+
+void
+MediaDownload::fail(const QString &error)
+{
+        nhlog::net()->warn(
+          "failed to download {}: {}", mxcUrl_.toStdString(), error.toStdString());
+
+        done_ = true;
+        file_.cancelWriting();
+        emit failed(error);
+
+        if (reply_) {
+                reply_->abort();
+                reply_->deleteLater();
+        }
+        deleteLater();
+}
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+
+#include <QCryptographicHash>
+#include <QObject>
+#include <QSaveFile>
+#include <QString>
+
+#include <mtx/common.hpp>
+
+class QNetworkReply;
+
+typedef struct evp_cipher_ctx_st EVP_CIPHER_CTX;
+
+//! Downloads a media file straight into a file on disk.
+//!
+//! Encrypted files are decrypted and their SHA-256 hash is checked chunk by chunk, while they are
+//! received, so the memory used doesn't depend on the size of the file. The file only replaces
+//! the destination, if it was received completely and its hash matched.
+class MediaDownload : public QObject
+{
+        Q_OBJECT
+
+public:
+        MediaDownload(const QString &mxcUrl,
+                      const QString &path,
+                      std::optional<mtx::crypto::EncryptedFile> encryptionInfo,
+                      QObject *parent = nullptr);
+        ~MediaDownload() override;
+
+        //! Start the download. The object deletes itself after finished or failed.
+        void start();
+
+signals:
+        //! total is -1, if the server didn't send the size of the file.
+        void progress(qint64 received, qint64 total);
+        void finished(QString path, qint64 size);
+        void failed(QString error);
+
+private:
+        void readChunk();
+        void complete();
+        void fail(const QString &error);
+
+        QString mxcUrl_;
+        QString path_;
+        std::optional<mtx::crypto::EncryptedFile> encryptionInfo_;
+
+        QNetworkReply *reply_ = nullptr;
+        QSaveFile file_;
+        QCryptographicHash hash_{QCryptographicHash::Sha256};
+        EVP_CIPHER_CTX *cipher_ = nullptr;
+        qint64 written_         = 0;
+        bool done_              = false;
+};
@@ -0,0 +1,197 @@
+#include "MediaUpload.h"
+
+#include <QCryptographicHash>
+#include <QIODevice>
+#include <QNetworkAccessManager>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QUrl>
+#include <QUrlQuery>
+
+#include <nlohmann/json.hpp>
+#include <openssl/evp.h>
+#include <openssl/rand.h>
+
+#include "Logging.h"
+#include "MatrixClient.h"
+#include "NetworkUsage.h"
+
+namespace {
+std::string
+toBase64(const QByteArray &data, QByteArray::Base64Options options = QByteArray::Base64Encoding)
+{
+        return data.toBase64(options | QByteArray::OmitTrailingEquals).toStdString();
+}
+}
+
+//! Reads the file for the upload and encrypts every chunk, when it is read.
+class MediaUpload::EncryptingDevice : public QIODevice
+{
+public:
+        EncryptingDevice(QIODevice *source, bool encrypt, QObject *parent)
+          : QIODevice(parent)
+          , source_(source)
+        {
+                if (!encrypt)
+                        return;
+
+                // The lower half of the counter block starts at 0, as the spec recommends.
+                key_ = QByteArray(32, Qt::Uninitialized);
+                iv_  = QByteArray(16, '\0');
+                if (RAND_bytes(reinterpret_cast<unsigned char *>(key_.data()), key_.size()) != 1 ||
+                    RAND_bytes(reinterpret_cast<unsigned char *>(iv_.data()), 8) != 1)
+                        return;
+
+                cipher_ = EVP_CIPHER_CTX_new();
+                if (cipher_ &&
+                    EVP_EncryptInit_ex(cipher_,
+                                       EVP_aes_256_ctr(),
+                                       nullptr,
+                                       reinterpret_cast<const unsigned char *>(key_.constData()),
+                                       reinterpret_cast<const unsigned char *>(iv_.constData())) !=
+                      1) {
+                        EVP_CIPHER_CTX_free(cipher_);
+                        cipher_ = nullptr;
+                }
+        }
+        ~EncryptingDevice() override
+        {
+                if (cipher_)
+                        EVP_CIPHER_CTX_free(cipher_);
+        }
+
+        //! Whether the encryption couldn't be set up, although it was requested.
+        bool failed(bool encrypt) const { return encrypt && !cipher_; }
+        bool isSequential() const override { return true; }
+        qint64 bytesAvailable() const override
+        {
+                return QIODevice::bytesAvailable() + source_->bytesAvailable();
+        }
+        bool atEnd() const override { return QIODevice::atEnd() && source_->atEnd(); }
+
+        //! The description of the encrypted file, after all of it was read.
+        mtx::crypto::EncryptedFile encryptedFile() const
+        {
+                mtx::crypto::EncryptedFile file;
+                file.v           = "v2";
+                file.iv          = toBase64(iv_);
+                file.key.kty     = "oct";
+                file.key.key_ops = {"encrypt", "decrypt"};
+                file.key.alg     = "A256CTR";
+                file.key.k       = toBase64(key_, QByteArray::Base64UrlEncoding);
+                file.key.ext     = true;
+
+                file.hashes["sha256"] = toBase64(hash_.result());
+                return file;
+        }
+
+protected:
+        qint64 readData(char *data, qint64 maxSize) override
+        {
+                const auto read = source_->read(data, maxSize);
+                if (read <= 0 || !cipher_)
+                        return read;
+
+                // CTR mode is a stream cipher, so the chunk can be encrypted in place.
+                auto buf   = reinterpret_cast<unsigned char *>(data);
+                int length = 0;
+                if (EVP_EncryptUpdate(cipher_, buf, &length, buf, static_cast<int>(read)) != 1)
+                        return -1;
+
+                hash_.addData(data, length);
+                return length;
+        }
+        qint64 writeData(const char *, qint64) override { return -1; }
+
+private:
+        QIODevice *source_;
+        QByteArray key_, iv_;
+        EVP_CIPHER_CTX *cipher_ = nullptr;
+        QCryptographicHash hash_{QCryptographicHash::Sha256};
+};
+
+MediaUpload::MediaUpload(QSharedPointer<QIODevice> data,
+                         const QString &filename,
+                         const QString &mimetype,
+                         bool encrypt,
+                         QObject *parent)
+  : QObject(parent)
+  , data_(std::move(data))
+  , filename_(filename)
+  , mimetype_(mimetype)
+  , encrypt_(encrypt)
+{}
+
+void
+MediaUpload::start()
+{
+        body_ = new EncryptingDevice(data_.data(), encrypt_, this);
+        if (body_->failed(encrypt_) || !body_->open(QIODevice::ReadOnly)) {
+                nhlog::net()->warn("failed to prepare the upload of {}", filename_.toStdString());
+                emit failed(tr("Failed to encrypt the file."));
+                deleteLater();
+                return;
+        }
+
+        QUrl url;
+        url.setScheme("https");
+        url.setHost(QString::fromStdString(http::client()->server()));
+        url.setPort(http::client()->port());
+        url.setPath("/_matrix/media/r0/upload");
+        QUrlQuery query;
+        query.addQueryItem("filename", filename_);
+        url.setQuery(query);
+
+        // With a known length Qt sends the body as it is read, instead of buffering all of it.
+        QNetworkRequest request(url);
+        request.setHeader(QNetworkRequest::ContentTypeHeader, mimetype_);
+        request.setHeader(QNetworkRequest::ContentLengthHeader, data_->size() - data_->pos());
+        request.setAttribute(QNetworkRequest::DoNotBufferUploadDataAttribute, true);
+        request.setRawHeader(
+          "Authorization",
+          "Bearer " + QByteArray::fromStdString(http::client()->access_token()));
+
+        // The body is counted, when it is handed to Qt, so a failed upload counts, too.
+        http::countRequest(http::Traffic::Upload);
+        http::countBytes(http::Traffic::Upload, data_->size() - data_->pos());
+        reply_ = http::networkManager()->post(request, body_);
+
+        connect(reply_, &QNetworkReply::uploadProgress, this, &MediaUpload::progress);
+        connect(reply_, &QNetworkReply::finished, this, &MediaUpload::complete);
+}
+
+void
+MediaUpload::complete()
+{
+        reply_->deleteLater();
+        deleteLater();
+
+        const auto response = reply_->readAll().toStdString();
+
+        std::string content_uri;
+        try {
+                const auto obj = nlohmann::json::parse(response);
+                if (reply_->error() != QNetworkReply::NoError || obj.count("content_uri") == 0) {
+                        nhlog::net()->warn("failed to upload media: {} {} ({})",
+                                           obj.value("error", ""),
+                                           obj.value("errcode", ""),
+                                           reply_->errorString().toStdString());
+                        emit failed(reply_->errorString());
+                        return;
+                }
+
+                content_uri = obj.at("content_uri").get<std::string>();
+        } catch (const nlohmann::json::exception &e) {
+                nhlog::net()->warn("failed to upload media: {} ({})",
+                                   e.what(),
+                                   reply_->errorString().toStdString());
+                emit failed(reply_->errorString());
+                return;
+        }
+
+        std::optional<mtx::crypto::EncryptedFile> encryptedFile;
+        if (encrypt_)
+                encryptedFile = body_->encryptedFile();
+
+        emit finished(QString::fromStdString(content_uri), encryptedFile);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <optional>
+
+#include <QObject>
+#include <QSharedPointer>
+#include <QString>
+
+#include <mtx/common.hpp>
+
+class QIODevice;
+class QNetworkReply;
+
+//! Uploads a file to the media repository without reading it into memory.
+//!
+//! The file is read, encrypted and sent in chunks, while the SHA-256 hash of the ciphertext is
+//! computed on the fly, so the memory used doesn't depend on the size of the file.
+class MediaUpload : public QObject
+{
+        Q_OBJECT
+
+public:
+        //! data has to be opened for reading. The file is encrypted, if encrypt is set.
+        MediaUpload(QSharedPointer<QIODevice> data,
+                    const QString &filename,
+                    const QString &mimetype,
+                    bool encrypt,
+                    QObject *parent = nullptr);
+
+        //! Start the upload. The object deletes itself after finished or failed.
+        void start();
+
+signals:
+        void progress(qint64 sent, qint64 total);
+        //! The file was uploaded. encryptedFile describes the key and the hash of an encrypted
+        //! file, but its url isn't set.
+        void finished(QString contentUri, std::optional<mtx::crypto::EncryptedFile> encryptedFile);
+        void failed(QString error);
+
+private:
+        void complete();
+
+        QSharedPointer<QIODevice> data_;
+        QString filename_;
+        QString mimetype_;
+        bool encrypt_;
+
+        class EncryptingDevice;
+        EncryptingDevice *body_ = nullptr;
+        QNetworkReply *reply_   = nullptr;
+};
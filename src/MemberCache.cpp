@@ -0,0 +1,148 @@
+#include "MemberCache.h"
+
+MemberCache::MemberCache(std::size_t maxMembers)
+  : maxMembers_(maxMembers)
+{}
+
+bool
+MemberCache::find(const QString &room_id, const QString &user_id, std::optional<Member> &member)
+{
+        std::lock_guard lock(mutex_);
+
+        auto room = rooms_.find(room_id);
+        if (room == rooms_.end())
+                return false;
+
+        room->lastUse = ++uses_;
+
+        auto it = room->members.constFind(user_id);
+        if (it != room->members.constEnd())
+                member = *it;
+        else
+                member.reset();
+
+        return true;
+}
+
+void
+MemberCache::load(const QString &room_id, std::vector<std::pair<QString, Member>> members)
+{
+        std::lock_guard lock(mutex_);
+
+        // Another thread loaded it in the meantime, maybe with newer members.
+        if (rooms_.contains(room_id))
+                return;
+
+        auto &room   = rooms_[room_id];
+        room.lastUse = ++uses_;
+        room.members.reserve(static_cast<int>(members.size()));
+
+        for (auto &[user_id, member] : members)
+                room.members.insert(intern(user_id), std::move(member));
+
+        size_ += room.members.size();
+        evict(room_id, maxMembers_);
+}
+
+void
+MemberCache::insert(const QString &room_id, const QString &user_id, Member member)
+{
+        std::lock_guard lock(mutex_);
+
+        auto room = rooms_.find(room_id);
+        if (room == rooms_.end())
+                return;
+
+        auto it = room->members.find(user_id);
+        if (it != room->members.end()) {
+                *it = std::move(member);
+                return;
+        }
+
+        room->members.insert(intern(user_id), std::move(member));
+        ++size_;
+        evict(room_id, maxMembers_);
+}
+
+void
+MemberCache::remove(const QString &room_id, const QString &user_id)
+{
+        std::lock_guard lock(mutex_);
+
+        auto room = rooms_.find(room_id);
+        if (room == rooms_.end() || !room->members.remove(user_id))
+                return;
+
+        release(user_id);
+        --size_;
+}
+
+void
+MemberCache::pin(const QString &room_id)
+{
+        std::lock_guard lock(mutex_);
+        pinned_ = room_id;
+}
+
+std::size_t
+MemberCache::size() const
+{
+        std::lock_guard lock(mutex_);
+        return size_;
+}
+
+void
+MemberCache::trim(std::size_t maxMembers)
+{
+        std::lock_guard lock(mutex_);
+        evict(QString(), maxMembers);
+}
+
+void
+MemberCache::setMaxMembers(std::size_t maxMembers)
+{
+        std::lock_guard lock(mutex_);
+        maxMembers_ = maxMembers;
+        evict(QString(), maxMembers_);
+}
+
+QString
+MemberCache::intern(const QString &user_id)
+{
+        auto it = userIds_.find(user_id);
+        if (it == userIds_.end())
+                it = userIds_.insert(user_id, 0);
+
+        ++*it;
+        return it.key();
+}
+
+void
+MemberCache::release(const QString &user_id)
+{
+        auto it = userIds_.find(user_id);
+        if (it != userIds_.end() && --*it == 0)
+                userIds_.erase(it);
+}
+
+void
+MemberCache::evict(const QString &keep, std::size_t maxMembers)
+{
+        while (size_ > maxMembers && rooms_.size() > 1) {
+                auto oldest = rooms_.end();
+                for (auto it = rooms_.begin(); it != rooms_.end(); ++it) {
+                        if (it.key() != keep && it.key() != pinned_ &&
+                            (oldest == rooms_.end() || it->lastUse < oldest->lastUse))
+                                oldest = it;
+                }
+
+                if (oldest == rooms_.end())
+                        break;
+
+                for (auto it = oldest->members.cbegin(); it != oldest->members.cend(); ++it)
+                        release(it.key());
+
+                size_ -= oldest->members.size();
+                rooms_.erase(oldest);
+        }
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include <QHash>
+#include <QString>
+
+//! The display names and avatars of the members of the rooms in memory. A room is loaded as a
+//! whole from its member db and the least recently used rooms are dropped again, when the rooms
+//! hold more members than the budget.
+//!
+//! The user ids are interned, so a user in many rooms is stored once. Safe to use from several
+//! threads.
+class MemberCache
+{
+public:
+        struct Member
+        {
+                //! Null, if it is the user id.
+                QString name;
+                QString avatarUrl;
+        };
+
+        explicit MemberCache(std::size_t maxMembers);
+
+        //! Whether the members of the room are loaded. If they are, member is set to the one
+        //! of user_id or empty, if the user isn't a member.
+        bool find(const QString &room_id, const QString &user_id, std::optional<Member> &member);
+        //! Set the members of a room read from its member db, unless it is loaded already.
+        void load(const QString &room_id, std::vector<std::pair<QString, Member>> members);
+
+        //! Update a member of a loaded room. The other rooms read it, when they are loaded.
+        void insert(const QString &room_id, const QString &user_id, Member member);
+        void remove(const QString &room_id, const QString &user_id);
+
+        //! Keep the members of the room, e.g. the open one, when other rooms are loaded. Only one
+        //! room is pinned at a time.
+        void pin(const QString &room_id);
+
+        //! The members of all loaded rooms.
+        std::size_t size() const;
+        //! Drop the least recently used rooms, until they have at most maxMembers members. The
+        //! budget for later loads stays the same.
+        void trim(std::size_t maxMembers);
+        //! Change the budget, e.g. after the memory profile changed, and drop the rooms over it.
+        void setMaxMembers(std::size_t maxMembers);
+
+private:
+        struct Room
+        {
+                //! By interned user id.
+                QHash<QString, Member> members;
+                quint64 lastUse = 0;
+        };
+
+        QString intern(const QString &user_id);
+        void release(const QString &user_id);
+        //! Drop the least recently used rooms except keep and the pinned one, until at most
+        //! maxMembers are left.
+        void evict(const QString &keep, std::size_t maxMembers);
+
+        std::size_t maxMembers_;
+
+        mutable std::mutex mutex_;
+        QHash<QString, Room> rooms_;
+        QString pinned_;
+        //! The interned user ids and the number of rooms they are a member of.
+        QHash<QString, int> userIds_;
+        std::size_t size_ = 0;
+        quint64 uses_     = 0;
+};
@@ -0,0 +1,183 @@
+#include "MemoryGovernor.h"
+
+#include <array>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QSettings>
+#include <QTimer>
+
+#include "AvatarProvider.h"
+#include "Cache.h"
+#include "ChatPage.h"
+#include "Logging.h"
+#include "Wakeups.h"
+#include "timeline/TimelineViewManager.h"
+
+//! How often the layers are checked against the budget of the process. Every layer enforces its
+//! own budget, when it grows, so this only catches the sum.
+constexpr int CHECK_INTERVAL = 30 * 1000;
+
+constexpr std::size_t MiB = 1024 * 1024;
+
+namespace {
+struct LayerInfo
+{
+        memory::Layer layer;
+        const char *name;
+        //! The setting in MiB, which overrides the budget of the profile.
+        const char *setting;
+        std::size_t normalBudget;
+        std::size_t lowMemoryBudget;
+};
+
+// The normal budgets are the limits, the layers had before the profiles.
+const std::array<LayerInfo, 4> layers_ = {{
+  {memory::Layer::Timelines, "timelines", "user/timeline/memory_budget", 128 * MiB, 32 * MiB},
+  {memory::Layer::Avatars, "avatars", "user/avatar_memory_budget_mb", 32 * MiB, 8 * MiB},
+  {memory::Layer::Members, "members", "user/memory/members_mb", 10 * MiB, 2 * MiB},
+  {memory::Layer::MegolmSessions, "megolm sessions", "user/memory/megolm_mb", MiB / 2, MiB / 8},
+}};
+
+//! The budget of the layers together. The normal profile has none beyond the sum of the layers.
+constexpr std::size_t LOW_MEMORY_BUDGET = 40 * MiB;
+
+bool
+lowMemory()
+{
+        return QSettings().value("user/low_memory", false).toBool();
+}
+
+std::size_t
+used(memory::Layer layer)
+{
+        switch (layer) {
+        case memory::Layer::Timelines: {
+                std::size_t sum = 0;
+                if (auto page = ChatPage::instance())
+                        for (const auto &timeline : page->timelineManager()->memoryUsage())
+                                sum += timeline.total();
+                return sum;
+        }
+        case memory::Layer::Avatars:
+                return AvatarProvider::memoryUsage();
+        case memory::Layer::Members:
+                return cache::client() ? cache::memberCacheUsage() : 0;
+        case memory::Layer::MegolmSessions:
+                return cache::client() ? cache::inboundMegolmSessionUsage() : 0;
+        }
+
+        return 0;
+}
+
+void
+trim(memory::Layer layer, std::size_t bytes)
+{
+        switch (layer) {
+        case memory::Layer::Timelines:
+                if (auto page = ChatPage::instance())
+                        page->timelineManager()->trimModels(bytes);
+                break;
+        case memory::Layer::Avatars:
+                AvatarProvider::trim(bytes);
+                break;
+        case memory::Layer::Members:
+                if (cache::client())
+                        cache::trimMemberCache(bytes);
+                break;
+        case memory::Layer::MegolmSessions:
+                if (cache::client())
+                        cache::trimInboundMegolmSessions(bytes);
+                break;
+        }
+}
+}
+
+namespace memory {
+std::size_t
+budget(Layer layer)
+{
+        const auto &info = layers_[static_cast<std::size_t>(layer)];
+
+        QSettings settings;
+        if (settings.contains(info.setting))
+                return settings.value(info.setting).toULongLong() * MiB;
+
+        return lowMemory() ? info.lowMemoryBudget : info.normalBudget;
+}
+
+void
+start()
+{
+        static QTimer *timer = nullptr;
+        if (timer)
+                return;
+
+        timer = new QTimer(QCoreApplication::instance());
+        timer->setInterval(CHECK_INTERVAL);
+        wakeups::manage(timer, "memory governor");
+        QObject::connect(timer, &QTimer::timeout, []() { enforce(); });
+        timer->start();
+}
+
+void
+enforce()
+{
+        // The avatars and the timelines read their budgets, whenever they evict.
+        if (cache::client())
+                cache::updateMemoryBudgets();
+
+        auto layers = usage();
+
+        // Each layer over its own budget first, then all of them over the budget of the process.
+        std::size_t total = 0;
+        for (std::size_t i = 0; i < layers.size(); i++) {
+                if (layers[i].used > layers[i].budget) {
+                        trim(layers_[i].layer, layers[i].budget);
+                        layers[i].used = used(layers_[i].layer);
+                }
+                total += layers[i].used;
+        }
+
+        const auto processBudget =
+          QSettings().value("user/memory/budget_mb", lowMemory() ? LOW_MEMORY_BUDGET / MiB : 0)
+            .toULongLong() *
+          MiB;
+        if (processBudget == 0 || total <= processBudget)
+                return;
+
+        nhlog::ui()->info("the caches use {} bytes of a budget of {}, trimming them",
+                          total,
+                          processBudget);
+
+        // Each layer evicts its own least recently used data to get to its share.
+        const double ratio = static_cast<double>(processBudget) / static_cast<double>(total);
+        for (std::size_t i = 0; i < layers.size(); i++)
+                trim(layers_[i].layer, static_cast<std::size_t>(layers[i].used * ratio));
+}
+
+std::vector<Usage>
+usage()
+{
+        std::vector<Usage> result;
+        for (const auto &info : layers_)
+                result.push_back({info.name, used(info.layer), budget(info.layer)});
+
+        return result;
+}
+
+std::size_t
+resident()
+{
+        QFile status("/proc/self/status");
+        if (!status.open(QIODevice::ReadOnly | QIODevice::Text))
+                return 0;
+
+        for (auto line = status.readLine(); !line.isEmpty(); line = status.readLine()) {
+                if (line.startsWith("VmRSS:"))
+                        return line.mid(6).trimmed().split(' ').front().toULongLong() * 1024;
+        }
+
+        return 0;
+}
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+//! Keeps the caches and models in memory within their byte budgets.
+//!
+//! Every layer evicts its least recently used data on its own, once it is over its budget. The
+//! budgets come from the memory profile in user/low_memory, unless a layer has its own setting.
+//! On top of that, the governor checks the layers together periodically against the budget of
+//! the process and trims all of them in proportion to their usage, when they hold more.
+namespace memory {
+enum class Layer
+{
+        //! The loaded timelines, their events and decrypted events.
+        Timelines,
+        //! The avatar pixmaps.
+        Avatars,
+        //! The display names and avatar urls of the members of the recently used rooms.
+        Members,
+        //! The unpickled inbound megolm sessions.
+        MegolmSessions,
+};
+
+//! The bytes the layer may use in the current profile.
+std::size_t
+budget(Layer layer);
+//! Start the periodic check. Only call it from the main thread.
+void
+start();
+//! Apply the budgets of the current profile and check them now, e.g. after the profile changed.
+void
+enforce();
+
+struct Usage
+{
+        const char *name;
+        std::size_t used   = 0;
+        std::size_t budget = 0;
+};
+//! The usage of every layer.
+std::vector<Usage>
+usage();
+//! The resident memory of the process, or 0, if the system doesn't tell.
+std::size_t
+resident();
+}
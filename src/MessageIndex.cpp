@@ -0,0 +1,353 @@
+#include <algorithm>
+#include <string_view>
+#include <unordered_set>
+
+#include <QDir>
+
+#include <nlohmann/json.hpp>
+
+#include "Logging.h"
+#include "MessageIndex.h"
+
+//! The index starts small and doubles, when it is full.
+constexpr size_t INITIAL_INDEX_SIZE = 64ULL * 1024ULL * 1024ULL;
+constexpr size_t MAX_INDEX_SIZE     = 16ULL * 1024ULL * 1024ULL * 1024ULL;
+
+//! The length of a posting list partition, one week in milliseconds.
+constexpr uint64_t PARTITION_MS = 7ULL * 24ULL * 60ULL * 60ULL * 1000ULL;
+
+//! Longer words are cut, so the keys stay below the key size limit of LMDB.
+constexpr int MAX_TOKEN_BYTES            = 64;
+constexpr int MIN_TOKEN_LENGTH           = 2;
+constexpr std::size_t MAX_TOKENS_PER_MSG = 256;
+//! The ids of the larger entries don't fit into a duplicate value of LMDB.
+constexpr std::size_t MAX_ENTRY_BYTES = 480;
+
+static constexpr const char *POSTINGS_DB  = "postings";
+static constexpr const char *DOCUMENTS_DB = "documents";
+
+namespace {
+void
+appendBigEndian(std::string &out, uint64_t value, std::size_t bytes)
+{
+        for (std::size_t i = 0; i < bytes; i++)
+                out.push_back(static_cast<char>((value >> (8 * (bytes - 1 - i))) & 0xff));
+}
+
+uint64_t
+readBigEndian(std::string_view in, std::size_t bytes)
+{
+        uint64_t value = 0;
+        for (std::size_t i = 0; i < bytes; i++)
+                value = (value << 8) | static_cast<unsigned char>(in[i]);
+        return value;
+}
+
+//! The posting list of a word in the week of the timestamp. The newest week sorts first.
+std::string
+postingKey(const std::string &token, uint64_t timestamp)
+{
+        std::string key = token;
+        key.push_back('\0');
+        appendBigEndian(key, ~static_cast<uint32_t>(timestamp / PARTITION_MS), 4);
+        return key;
+}
+
+//! An entry of a posting list. The newest message sorts first.
+std::string
+postingEntry(const std::string &room_id, const std::string &event_id, uint64_t timestamp)
+{
+        std::string entry;
+        appendBigEndian(entry, ~timestamp, 8);
+        entry += room_id;
+        entry.push_back('\0');
+        entry += event_id;
+        return entry;
+}
+
+MessageSearchResult
+parseEntry(std::string_view entry)
+{
+        MessageSearchResult result;
+        result.timestamp = ~readBigEndian(entry, 8);
+
+        const auto ids = entry.substr(8);
+        const auto sep = ids.find('\0');
+        result.room_id = std::string(ids.substr(0, sep));
+        if (sep != std::string_view::npos)
+                result.event_id = std::string(ids.substr(sep + 1));
+
+        return result;
+}
+
+std::string
+documentKey(const std::string &room_id, const std::string &event_id)
+{
+        return room_id + '\0' + event_id;
+}
+}
+
+MessageIndex::MessageIndex(const QString &path)
+{
+        if (!QDir().mkpath(path))
+                throw std::runtime_error(
+                  ("Unable to create search index directory:" + path).toStdString());
+
+        env_ = lmdb::env::create();
+        env_.set_mapsize(INITIAL_INDEX_SIZE);
+        env_.set_max_dbs(2);
+        env_.open(path.toStdString().c_str());
+
+        auto txn     = lmdb::txn::begin(env_);
+        postingsDb_  = lmdb::dbi::open(txn, POSTINGS_DB, MDB_CREATE | MDB_DUPSORT);
+        documentsDb_ = lmdb::dbi::open(txn, DOCUMENTS_DB, MDB_CREATE);
+        txn.commit();
+}
+
+std::vector<std::string>
+MessageIndex::tokenize(const QString &text)
+{
+        std::vector<std::string> tokens;
+        std::unordered_set<std::string> seen;
+
+        QString word;
+        auto finishWord = [&]() {
+                if (word.size() >= MIN_TOKEN_LENGTH && tokens.size() < MAX_TOKENS_PER_MSG) {
+                        auto token = word.toUtf8();
+                        // Don't cut in the middle of a multibyte character.
+                        if (token.size() > MAX_TOKEN_BYTES) {
+                                int end = MAX_TOKEN_BYTES;
+                                while (end > 0 &&
+                                       (static_cast<unsigned char>(token[end]) & 0xc0) == 0x80)
+                                        end--;
+                                token.truncate(end);
+                        }
+
+                        if (auto [it, isNew] = seen.insert(token.toStdString()); isNew)
+                                tokens.push_back(*it);
+                }
+                word.clear();
+        };
+
+        for (const auto &c : text.toCaseFolded()) {
+                if (c.isLetterOrNumber() || c.isMark())
+                        word.append(c);
+                else
+                        finishWord();
+        }
+        finishWord();
+
+        return tokens;
+}
+
+void
+MessageIndex::add(const std::string &room_id,
+                  const std::string &event_id,
+                  uint64_t timestamp,
+                  const QString &body)
+{
+        Change change;
+        change.room_id   = room_id;
+        change.event_id  = event_id;
+        change.timestamp = timestamp;
+        change.tokens    = tokenize(body);
+
+        if (change.tokens.empty() || room_id.size() + event_id.size() + 9 > MAX_ENTRY_BYTES)
+                return;
+
+        std::unique_lock<std::mutex> lock(pendingMtx_);
+        pending_.push_back(std::move(change));
+}
+
+void
+MessageIndex::remove(const std::string &room_id, const std::string &event_id)
+{
+        Change change;
+        change.room_id  = room_id;
+        change.event_id = event_id;
+        change.remove   = true;
+
+        std::unique_lock<std::mutex> lock(pendingMtx_);
+        pending_.push_back(std::move(change));
+}
+
+std::size_t
+MessageIndex::pending() const
+{
+        std::unique_lock<std::mutex> lock(pendingMtx_);
+        return pending_.size();
+}
+
+void
+MessageIndex::flush()
+{
+        std::vector<Change> changes;
+        {
+                std::unique_lock<std::mutex> lock(pendingMtx_);
+                changes.swap(pending_);
+        }
+
+        if (changes.empty())
+                return;
+
+        for (;;) {
+                try {
+                        std::shared_lock lock(mapMutex_);
+
+                        auto txn = lmdb::txn::begin(env_);
+                        for (const auto &change : changes)
+                                apply(txn, change);
+                        txn.commit();
+
+                        return;
+                } catch (const lmdb::map_full_error &e) {
+                        // The failed transaction was aborted, so it is simply retried.
+                        if (!growMapSize()) {
+                                nhlog::db()->error("the search index is full: {}", e.what());
+                                return;
+                        }
+                }
+        }
+}
+
+void
+MessageIndex::apply(lmdb::txn &txn, const Change &change)
+{
+        const auto doc = documentKey(change.room_id, change.event_id);
+
+        if (change.remove) {
+                removeDocument(txn, doc);
+                return;
+        }
+
+        // Edits and fetched events bring messages again, which are already indexed.
+        lmdb::val unused;
+        if (lmdb::dbi_get(txn, documentsDb_, lmdb::val(doc), unused))
+                return;
+
+        const auto entry = postingEntry(change.room_id, change.event_id, change.timestamp);
+        for (const auto &token : change.tokens) {
+                const auto key = postingKey(token, change.timestamp);
+                lmdb::dbi_put(txn, postingsDb_, lmdb::val(key), lmdb::val(entry));
+        }
+
+        // The words are kept to remove the message again.
+        const auto value =
+          nlohmann::json{{"ts", change.timestamp}, {"tokens", change.tokens}}.dump();
+        lmdb::dbi_put(txn, documentsDb_, lmdb::val(doc), lmdb::val(value));
+}
+
+void
+MessageIndex::removeDocument(lmdb::txn &txn, const std::string &doc)
+{
+        lmdb::val value;
+        if (!lmdb::dbi_get(txn, documentsDb_, lmdb::val(doc), value))
+                return;
+
+        try {
+                const auto obj    = nlohmann::json::parse(std::string(value.data(), value.size()));
+                const uint64_t ts = obj.at("ts");
+                const auto sep    = doc.find('\0');
+                const auto entry  = postingEntry(doc.substr(0, sep), doc.substr(sep + 1), ts);
+
+                lmdb::val entryValue(entry);
+
+                for (const std::string token : obj.at("tokens")) {
+                        const auto key = postingKey(token, ts);
+                        lmdb::dbi_del(txn, postingsDb_, lmdb::val(key), &entryValue);
+                }
+        } catch (const nlohmann::json::exception &e) {
+                nhlog::db()->warn("failed to parse indexed message: {}", e.what());
+        }
+
+        lmdb::dbi_del(txn, documentsDb_, lmdb::val(doc), nullptr);
+}
+
+std::vector<MessageSearchResult>
+MessageIndex::search(const QString &query, const std::string &room_id, std::size_t max_results)
+{
+        std::vector<MessageSearchResult> results;
+
+        const auto tokens = tokenize(query);
+        if (tokens.empty() || max_results == 0)
+                return results;
+
+        std::shared_lock lock(mapMutex_);
+
+        auto txn    = lmdb::txn::begin(env_, nullptr, MDB_RDONLY);
+        auto cursor = lmdb::cursor::open(txn, postingsDb_);
+
+        // Every week of the first word, then only the same week of the other words.
+        std::string prefix = tokens.front();
+        prefix.push_back('\0');
+
+        lmdb::val key(prefix.data(), prefix.size()), value;
+        bool found = cursor.get(key, value, MDB_SET_RANGE);
+        while (found && results.size() < max_results) {
+                std::string_view k(key.data(), key.size());
+                if (k.size() != prefix.size() + 4 || k.substr(0, prefix.size()) != prefix)
+                        break;
+
+                const auto partition = std::string(k.substr(prefix.size()));
+
+                std::vector<std::string> entries;
+                for (bool dup = true; dup; dup = cursor.get(key, value, MDB_NEXT_DUP))
+                        entries.emplace_back(value.data(), value.size());
+
+                for (std::size_t i = 1; i < tokens.size() && !entries.empty(); i++) {
+                        std::unordered_set<std::string> other;
+
+                        auto otherCursor        = lmdb::cursor::open(txn, postingsDb_);
+                        const auto otherKeyData = tokens[i] + '\0' + partition;
+                        lmdb::val otherKey(otherKeyData.data(), otherKeyData.size()), otherValue;
+                        for (bool dup = otherCursor.get(otherKey, otherValue, MDB_SET_KEY); dup;
+                             dup = otherCursor.get(otherKey, otherValue, MDB_NEXT_DUP))
+                                other.emplace(otherValue.data(), otherValue.size());
+                        otherCursor.close();
+
+                        entries.erase(std::remove_if(entries.begin(),
+                                                     entries.end(),
+                                                     [&other](const std::string &e) {
+                                                             return other.count(e) == 0;
+                                                     }),
+                                      entries.end());
+                }
+
+                for (const auto &entry : entries) {
+                        auto result = parseEntry(entry);
+                        if (!room_id.empty() && result.room_id != room_id)
+                                continue;
+
+                        results.push_back(std::move(result));
+                        if (results.size() >= max_results)
+                                break;
+                }
+
+                found = cursor.get(key, value, MDB_NEXT_NODUP);
+        }
+
+        cursor.close();
+        txn.commit();
+
+        return results;
+}
+
+bool
+MessageIndex::growMapSize()
+{
+        // Waits for the searches of the other threads, since LMDB remaps the file.
+        std::unique_lock lock(mapMutex_);
+
+        MDB_envinfo info;
+        mdb_env_info(env_.handle(), &info);
+
+        if (info.me_mapsize >= MAX_INDEX_SIZE)
+                return false;
+
+        const auto size = std::min<size_t>(info.me_mapsize * 2, MAX_INDEX_SIZE);
+        env_.set_mapsize(size);
+
+        nhlog::db()->info("resized the search index from {} to {} bytes", info.me_mapsize, size);
+
+        return true;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <vector>
+
+#include <QString>
+
+#if __has_include(<lmdbxx/lmdb++.h>)
+#include <lmdbxx/lmdb++.h>
+#else
+#include <lmdb++.h>
+#endif
+
+//! A message found by the full-text search.
+struct MessageSearchResult
+{
+        std::string room_id;
+        std::string event_id;
+        uint64_t timestamp = 0;
+};
+
+//! Inverted index over the bodies of the messages, including the decrypted ones, in its own LMDB
+//! environment, so the server isn't needed to search encrypted rooms.
+//!
+//! Every word of a message has a posting list per week, whose entries are sorted newest first.
+//! A query walks the weeks of its first word from the newest one and only looks up the same week
+//! of the other words, so it can stop as soon as it has enough results.
+class MessageIndex
+{
+public:
+        explicit MessageIndex(const QString &path);
+
+        //! Queue a message for the next flush. The words are split in the calling thread.
+        void add(const std::string &room_id,
+                 const std::string &event_id,
+                 uint64_t timestamp,
+                 const QString &body);
+        //! Queue the removal of a message, e.g. after it was redacted.
+        void remove(const std::string &room_id, const std::string &event_id);
+        //! How many changes are waiting for the next flush.
+        std::size_t pending() const;
+        //! Write the queued changes in one transaction.
+        void flush();
+
+        //! The messages, which contain every word of the query, newest first. An empty room_id
+        //! searches all rooms.
+        std::vector<MessageSearchResult> search(const QString &query,
+                                                const std::string &room_id,
+                                                std::size_t max_results);
+
+        //! The lowercased words of a text, without duplicates.
+        static std::vector<std::string> tokenize(const QString &text);
+
+private:
+        struct Change
+        {
+                std::string room_id;
+                std::string event_id;
+                uint64_t timestamp = 0;
+                std::vector<std::string> tokens;
+                bool remove = false;
+        };
+
+        void apply(lmdb::txn &txn, const Change &change);
+        void removeDocument(lmdb::txn &txn, const std::string &doc);
+        bool growMapSize();
+
+        lmdb::env env_{nullptr};
+        lmdb::dbi postingsDb_{0};
+        lmdb::dbi documentsDb_{0};
+
+        //! Remapping the file has to wait for the running transactions.
+        std::shared_mutex mapMutex_;
+
+        mutable std::mutex pendingMtx_;
+        std::vector<Change> pending_;
+};
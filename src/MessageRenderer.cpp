@@ -0,0 +1,116 @@
+#include "MessageRenderer.h"
+
+#include <QFutureInterface>
+#include <QMutexLocker>
+#include <QThreadPool>
+#include <QtConcurrent>
+
+#include "CacheStats.h"
+#include "Utils.h"
+
+//! How many characters of inputs and results each cache keeps.
+constexpr int RENDER_CACHE_SIZE = 4 * 1024 * 1024;
+
+namespace {
+QString
+renderMarkdown(const QString &text)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("renderMarkdown"));
+        return utils::markdownToHtml(text);
+}
+
+QString
+renderFormattedBody(const QString &html)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("renderFormattedBody"));
+        return utils::linkifyAndReplaceEmoji(utils::escapeBlacklistedHtml(html));
+}
+}
+
+MessageRenderer &
+MessageRenderer::instance()
+{
+        static MessageRenderer renderer;
+        return renderer;
+}
+
+MessageRenderer::MessageRenderer()
+{
+        markdown_.setMaxCost(RENDER_CACHE_SIZE);
+        formattedBodies_.setMaxCost(RENDER_CACHE_SIZE);
+}
+
+QString
+MessageRenderer::markdown(const QString &text)
+{
+        return render(markdown_, renderMarkdown, text);
+}
+
+QFuture<QString>
+MessageRenderer::markdownLater(const QString &text)
+{
+        return renderLater(markdown_, renderMarkdown, text);
+}
+
+QString
+MessageRenderer::formattedBody(const QString &html)
+{
+        return render(formattedBodies_, renderFormattedBody, html);
+}
+
+void
+MessageRenderer::prerenderFormattedBody(const QString &html)
+{
+        if (!html.isEmpty())
+                renderLater(formattedBodies_, renderFormattedBody, html);
+}
+
+void
+MessageRenderer::clear()
+{
+        QMutexLocker lock(&mutex_);
+        generation_++;
+        markdown_.clear();
+        formattedBodies_.clear();
+}
+
+QString
+MessageRenderer::render(QCache<QString, QString> &cache, Render render, const QString &input)
+{
+        quint64 generation;
+        {
+                QMutexLocker lock(&mutex_);
+                if (auto cached = cache.object(input))
+                        return *cached;
+
+                generation = generation_;
+        }
+
+        // Rendered without the lock, so other threads can use the cache meanwhile. The same input
+        // may be rendered twice, if it is requested again before it is done.
+        auto rendered = render(input);
+
+        QMutexLocker lock(&mutex_);
+        if (generation == generation_)
+                cache.insert(input, new QString(rendered), input.size() + rendered.size());
+        return rendered;
+}
+
+QFuture<QString>
+MessageRenderer::renderLater(QCache<QString, QString> &cache, Render render, const QString &input)
+{
+        {
+                QMutexLocker lock(&mutex_);
+                if (auto cached = cache.object(input)) {
+                        QFutureInterface<QString> result;
+                        result.reportStarted();
+                        result.reportResult(*cached);
+                        result.reportFinished();
+                        return result.future();
+                }
+        }
+
+        return QtConcurrent::run(QThreadPool::globalInstance(), [this, &cache, render, input]() {
+                return this->render(cache, render, input);
+        });
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QCache>
+#include <QFuture>
+#include <QMutex>
+#include <QString>
+
+//! Renders message bodies to html: markdown of sent messages and the formatted bodies of received
+//! messages, which are sanitized, linkified and get their emoji replaced.
+//!
+//! The rendering can run on the global thread pool. Results are memoized by their input, so
+//! rendering the same text again, e.g. when a timeline row is recomputed, is a lookup.
+class MessageRenderer
+{
+public:
+        static MessageRenderer &instance();
+
+        //! utils::markdownToHtml of the text. Renders it in the calling thread, if it isn't cached.
+        QString markdown(const QString &text);
+        //! Render the markdown in the background.
+        QFuture<QString> markdownLater(const QString &text);
+
+        //! The html of a received formatted body, as the timeline shows it.
+        QString formattedBody(const QString &html);
+        //! Render a received formatted body in the background, so formattedBody finds it later.
+        void prerenderFormattedBody(const QString &html);
+
+        //! Forget the rendered bodies, after a setting, which changes them, like the emoji font.
+        void clear();
+
+private:
+        MessageRenderer();
+
+        using Render = QString (*)(const QString &);
+
+        QString render(QCache<QString, QString> &cache, Render render, const QString &input);
+        QFuture<QString> renderLater(QCache<QString, QString> &cache,
+                                     Render render,
+                                     const QString &input);
+
+        QMutex mutex_;
+        //! Incremented by clear, so the renders, which started before, aren't cached.
+        quint64 generation_ = 0;
+        QCache<QString, QString> markdown_;
+        QCache<QString, QString> formattedBodies_;
+};
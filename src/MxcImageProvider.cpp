@@ -1,95 +1,553 @@
 #include "MxcImageProvider.h"
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+
 #include "Cache.h"
 #include "Logging.h"
 #include "MatrixClient.h"
+#include "NetworkUsage.h"
+#include "RequestScheduler.h"
 #include "Utils.h"
+#include "WorkerPools.h"
+
+namespace {
+using FetchCallback = std::function<void(const QImage &image, const QString &error)>;
+
+//! A response waiting for a fetch. The prefetches wait without an owner.
+struct Waiter
+{
+        const void *owner;
+        FetchCallback callback;
+};
+
+struct Fetch
+{
+        std::vector<Waiter> waiters;
+        //! The download, once it is scheduled.
+        http::RequestId request = 0;
+};
+
+//! Responses for the same image and size, which wait for the same download and decode.
+std::mutex fetches_mtx_;
+QHash<QString, Fetch> fetches_;
+
+std::atomic<uint64_t> cache_hits_{0};
+std::atomic<uint64_t> downloads_{0};
+std::atomic<uint64_t> coalesced_{0};
+std::atomic<uint64_t> prefetches_cancelled_{0};
+std::atomic<uint64_t> responses_requested_{0};
+std::atomic<uint64_t> responses_completed_{0};
+std::atomic<uint64_t> responses_cancelled_{0};
+std::atomic<uint64_t> downloads_discarded_{0};
+
+//! The downloads of the prefetches, which may still wait in the request scheduler.
+std::mutex prefetch_requests_mtx_;
+std::vector<http::RequestId> prefetch_requests_;
+
+//! Wait for the fetch of key. Returns true, if no fetch of it is running and the caller has to
+//! start it.
+bool
+attachToFetch(const QString &key, const void *owner, FetchCallback callback)
+{
+        std::unique_lock<std::mutex> lock(fetches_mtx_);
+
+        auto it = fetches_.find(key);
+        if (it != fetches_.end()) {
+                it->waiters.push_back({owner, std::move(callback)});
+                coalesced_++;
+                return false;
+        }
+
+        fetches_[key].waiters.push_back({owner, std::move(callback)});
+        return true;
+}
+
+//! Stop waiting for the fetch of key. The fetch is dropped, once nothing waits for it anymore, and
+//! its download is cancelled, if it didn't start yet. Returns false, if the fetch finished already.
+bool
+detachFromFetch(const QString &key, const void *owner)
+{
+        http::RequestId request = 0;
+        {
+                std::unique_lock<std::mutex> lock(fetches_mtx_);
 
+                auto it = fetches_.find(key);
+                if (it == fetches_.end())
+                        return false;
+
+                auto &waiters = it->waiters;
+                auto waiter =
+                  std::find_if(waiters.begin(), waiters.end(), [owner](const Waiter &w) {
+                          return w.owner == owner;
+                  });
+                if (waiter == waiters.end())
+                        return false;
+
+                waiters.erase(waiter);
+                if (waiters.empty()) {
+                        request = it->request;
+                        fetches_.erase(it);
+                }
+        }
+
+        // Outside of the lock, since the scheduler calls back into the fetches.
+        if (request)
+                http::cancel(request);
+        return true;
+}
+
+//! Remember the download of the fetch of key, so it can be cancelled.
 void
-MxcImageResponse::run()
+setFetchRequest(const QString &key, http::RequestId request)
+{
+        std::unique_lock<std::mutex> lock(fetches_mtx_);
+
+        auto it = fetches_.find(key);
+        if (it != fetches_.end())
+                it->request = request;
+}
+
+//! Whether anything still waits for the fetch of key. If not, its result is thrown away without
+//! decrypting or decoding it.
+bool
+isWanted(const QString &key)
 {
-        if (m_requestedSize.isValid() && !m_encryptionInfo) {
-                QString fileName = QString("%1_%2x%3_crop")
-                                     .arg(m_id)
-                                     .arg(m_requestedSize.width())
-                                     .arg(m_requestedSize.height());
+        std::unique_lock<std::mutex> lock(fetches_mtx_);
+
+        if (fetches_.contains(key))
+                return true;
+
+        downloads_discarded_++;
+        return false;
+}
 
+//! Hand the result of the fetch of key to every response waiting for it.
+void
+finishFetch(const QString &key, const QImage &image, const QString &error = {})
+{
+        std::vector<Waiter> waiters;
+        {
+                std::unique_lock<std::mutex> lock(fetches_mtx_);
+                waiters = fetches_.take(key).waiters;
+        }
+
+        // QImage is implicitly shared, so the responses don't copy the pixels.
+        for (const auto &waiter : waiters)
+                waiter.callback(image, error);
+}
+
+//! Drop the fetch of key, if nothing but the prefetch waits for it. Returns false, if a response
+//! attached to it in the meantime.
+bool
+dropPrefetch(const QString &key)
+{
+        std::unique_lock<std::mutex> lock(fetches_mtx_);
+
+        auto it = fetches_.find(key);
+        if (it != fetches_.end() && it->waiters.size() > 1)
+                return false;
+
+        fetches_.remove(key);
+        return true;
+}
+
+//! The prefetches wait behind the visible images in the pools as well.
+workers::Priority
+workerPriority(http::Priority priority)
+{
+        return priority == http::Priority::Background ? workers::Priority::Background
+                                                      : workers::Priority::Visible;
+}
+
+//! Decode a downloaded image, which isn't downscaled, in the decode pool.
+void
+decodeDownload(const QString &id,
+               const std::string &res,
+               const std::string &originalFilename,
+               workers::Priority priority)
+{
+        workers::run(workers::Pool::Decode, priority, [id, res, originalFilename]() {
+                if (!isWanted(id))
+                        return;
+
+                auto data = QByteArray(res.data(), res.size());
+                cache::saveImage(id, data);
+                cache::LatencyTimer timer(NHEKO_METRIC("decode image"));
+                auto image = utils::readImage(&data);
+                image.setText("original filename", QString::fromStdString(originalFilename));
+                image.setText("mxc url", "mxc://" + id);
+
+                finishFetch(id, image);
+        });
+}
+
+//! The key of an image in the fetch registry and the media cache.
+QString
+fetchKey(const QString &id,
+         const QSize &requestedSize,
+         const boost::optional<mtx::crypto::EncryptedFile> &encryptionInfo)
+{
+        if (requestedSize.isValid() && !encryptionInfo)
+                return QString("%1_%2x%3_crop")
+                  .arg(id)
+                  .arg(requestedSize.width())
+                  .arg(requestedSize.height());
+
+        return id;
+}
+
+//! Read the image from the cache or download it and hand it to the responses waiting for key.
+//! Returns the scheduled download or 0, if the image was cached.
+http::RequestId
+fetch(const QString &id,
+      const QSize &requestedSize,
+      const boost::optional<mtx::crypto::EncryptedFile> &encryptionInfo,
+      http::Priority priority)
+{
+        const auto fileName = fetchKey(id, requestedSize, encryptionInfo);
+
+        // A cancelled prefetch is fetched anyway, if a response waits for it by now.
+        std::function<void()> cancelled;
+        if (priority == http::Priority::Background)
+                cancelled = [id, requestedSize, encryptionInfo, fileName]() {
+                        prefetches_cancelled_++;
+                        if (!dropPrefetch(fileName))
+                                fetch(id, requestedSize, encryptionInfo, http::Priority::Visible);
+                };
+
+        if (requestedSize.isValid() && !encryptionInfo) {
+                // Downscaled thumbnails are stored, so a cache hit only decodes a small image.
                 auto data = cache::image(fileName);
                 if (!data.isNull()) {
-                        m_image = utils::readImage(&data);
-                        m_image = m_image.scaled(m_requestedSize, Qt::KeepAspectRatio);
-                        m_image.setText("mxc url", "mxc://" + m_id);
+                        cache::LatencyTimer timer(NHEKO_METRIC("decode cached image"));
+                        auto image = utils::readImage(&data, requestedSize);
+                        image      = image.scaled(requestedSize, Qt::KeepAspectRatio);
+                        image.setText("mxc url", "mxc://" + id);
 
-                        if (!m_image.isNull()) {
-                                emit finished();
-                                return;
+                        if (!image.isNull()) {
+                                cache_hits_++;
+                                finishFetch(fileName, image);
+                                return 0;
                         }
                 }
 
+                downloads_++;
+
                 mtx::http::ThumbOpts opts;
-                opts.mxc_url = "mxc://" + m_id.toStdString();
-                opts.width   = m_requestedSize.width() > 0 ? m_requestedSize.width() : -1;
-                opts.height  = m_requestedSize.height() > 0 ? m_requestedSize.height() : -1;
+                opts.mxc_url = "mxc://" + id.toStdString();
+                opts.width   = requestedSize.width() > 0 ? requestedSize.width() : -1;
+                opts.height  = requestedSize.height() > 0 ? requestedSize.height() : -1;
                 opts.method  = "crop";
-                http::client()->get_thumbnail(
-                  opts, [this, fileName](const std::string &res, mtx::http::RequestErr err) {
-                          if (err) {
-                                  nhlog::net()->error("Failed to download image {}",
-                                                      m_id.toStdString());
-                                  m_error = "Failed download";
-                                  emit finished();
-
-                                  return;
-                          }
-
-                          auto data = QByteArray(res.data(), res.size());
-                          cache::saveImage(fileName, data);
-                          m_image = utils::readImage(&data);
-                          m_image.setText("mxc url", "mxc://" + m_id);
-
-                          emit finished();
-                  });
+                const auto request = http::schedule(
+                  priority,
+                  [opts, id, fileName, size = requestedSize, priority](auto slot) {
+                        http::countRequest(http::Traffic::Thumbnail);
+                        http::client()->get_thumbnail(
+                          opts,
+                          [slot, id, fileName, size, priority](const std::string &res,
+                                                               mtx::http::RequestErr err) {
+                                  http::countBytes(http::Traffic::Thumbnail, res.size());
+                                  if (slot.retry(err))
+                                          return;
+
+                                  if (err) {
+                                          nhlog::net()->error("Failed to download image {}",
+                                                              id.toStdString());
+                                          finishFetch(fileName, {}, "Failed download");
+                                          return;
+                                  }
+
+                                  // Servers may send a much larger image than requested. It is
+                                  // decoded in the pool instead of the network thread.
+                                  workers::run(
+                                    workers::Pool::Decode,
+                                    workerPriority(priority),
+                                    [id, fileName, size, res]() {
+                                            if (!isWanted(fileName))
+                                                    return;
+
+                                            auto data = QByteArray(res.data(), res.size());
+
+                                            cache::LatencyTimer timer(NHEKO_METRIC("decode image"));
+                                            bool downscaled = false;
+                                            auto image =
+                                              utils::readImage(&data, size, &downscaled);
+                                            cache::saveImage(
+                                              fileName,
+                                              downscaled ? utils::encodeImage(image) : data);
+                                            image.setText("mxc url", "mxc://" + id);
+
+                                            finishFetch(fileName, image);
+                                    });
+                          });
+                  },
+                  cancelled);
+                setFetchRequest(fileName, request);
+                return request;
         } else {
-                auto data = cache::image(m_id);
+                auto data = cache::image(id);
 
                 if (!data.isNull()) {
-                        m_image = utils::readImage(&data);
-                        m_image.setText("mxc url", "mxc://" + m_id);
+                        cache::LatencyTimer timer(NHEKO_METRIC("decode cached image"));
+                        auto image = utils::readImage(&data);
+                        image.setText("mxc url", "mxc://" + id);
 
-                        if (!m_image.isNull()) {
-                                emit finished();
-                                return;
+                        if (!image.isNull()) {
+                                cache_hits_++;
+                                finishFetch(fileName, image);
+                                return 0;
                         }
                 }
 
-                http::client()->download(
-                  "mxc://" + m_id.toStdString(),
-                  [this](const std::string &res,
-                         const std::string &,
-                         const std::string &originalFilename,
-                         mtx::http::RequestErr err) {
-                          if (err) {
-                                  nhlog::net()->error("Failed to download image {}",
-                                                      m_id.toStdString());
-                                  m_error = "Failed download";
-                                  emit finished();
-
-                                  return;
-                          }
-
-                          auto temp = res;
-                          if (m_encryptionInfo)
-                                  temp = mtx::crypto::to_string(
-                                    mtx::crypto::decrypt_file(temp, m_encryptionInfo.value()));
-
-                          auto data = QByteArray(temp.data(), temp.size());
-                          cache::saveImage(m_id, data);
-                          m_image = utils::readImage(&data);
-                          m_image.setText("original filename",
-                                          QString::fromStdString(originalFilename));
-                          m_image.setText("mxc url", "mxc://" + m_id);
-
-                          emit finished();
-                  });
+                downloads_++;
+
+                const auto request = http::schedule(
+                  priority,
+                  [id, encryptionInfo, priority](auto slot) {
+                        http::countRequest(http::Traffic::Download);
+                        http::client()->download(
+                          "mxc://" + id.toStdString(),
+                          [slot, id, encryptionInfo, priority](const std::string &res,
+                                                               const std::string &,
+                                                               const std::string &originalFilename,
+                                                               mtx::http::RequestErr err) {
+                                  http::countBytes(http::Traffic::Download, res.size());
+                                  if (slot.retry(err))
+                                          return;
+
+                                  if (err) {
+                                          nhlog::net()->error("Failed to download image {}",
+                                                              id.toStdString());
+                                          finishFetch(id, {}, "Failed download");
+                                          return;
+                                  }
+
+                                  // The network thread only hands the download over, so it can
+                                  // go on with the next one.
+                                  if (!encryptionInfo) {
+                                          decodeDownload(
+                                            id, res, originalFilename, workerPriority(priority));
+                                          return;
+                                  }
+
+                                  workers::run(
+                                    workers::Pool::Crypto,
+                                    workerPriority(priority),
+                                    [id, res, encryptionInfo, originalFilename, priority]() {
+                                            if (!isWanted(id))
+                                                    return;
+
+                                            std::string plaintext;
+                                            try {
+                                                    cache::LatencyTimer timer(
+                                                      NHEKO_METRIC("decrypt image"));
+                                                    plaintext = mtx::crypto::to_string(
+                                                      mtx::crypto::decrypt_file(
+                                                        res, encryptionInfo.value()));
+                                            } catch (const std::exception &e) {
+                                                    nhlog::crypto()->warn(
+                                                      "failed to decrypt image {}: {}",
+                                                      id.toStdString(),
+                                                      e.what());
+                                                    finishFetch(id, {}, "Failed decryption");
+                                                    return;
+                                            }
+
+                                            decodeDownload(id,
+                                                           plaintext,
+                                                           originalFilename,
+                                                           workerPriority(priority));
+                                    });
+                          });
+                  },
+                  cancelled);
+                setFetchRequest(id, request);
+                return request;
+        }
+}
+
+class PrefetchJob
+{
+public:
+        PrefetchJob(const QString &id,
+                    const QSize &size,
+                    boost::optional<mtx::crypto::EncryptedFile> encryptionInfo,
+                    const std::atomic<uint64_t> &generation)
+          : id_(id)
+          , size_(size)
+          , encryptionInfo_(std::move(encryptionInfo))
+          , generation_(generation)
+          , queuedIn_(generation.load())
+        {}
+
+        void run()
+        {
+                // The view moved on, before the prefetch started.
+                if (generation_ != queuedIn_) {
+                        prefetches_cancelled_++;
+                        return;
+                }
+
+                // Nothing waits for the result, it only fills the cache.
+                if (!attachToFetch(fetchKey(id_, size_, encryptionInfo_),
+                                   nullptr,
+                                   [](const QImage &, const QString &) {}))
+                        return;
+
+                if (auto request = fetch(id_, size_, encryptionInfo_, http::Priority::Background)) {
+                        std::unique_lock<std::mutex> lock(prefetch_requests_mtx_);
+                        prefetch_requests_.push_back(request);
+                }
+        }
+
+private:
+        QString id_;
+        QSize size_;
+        boost::optional<mtx::crypto::EncryptedFile> encryptionInfo_;
+        const std::atomic<uint64_t> &generation_;
+        uint64_t queuedIn_;
+};
+}
+
+MxcImageStats
+MxcImageProvider::stats()
+{
+        MxcImageStats stats;
+        stats.cache_hits           = cache_hits_;
+        stats.downloads            = downloads_;
+        stats.coalesced            = coalesced_;
+        stats.prefetches_cancelled = prefetches_cancelled_;
+        stats.responses_requested  = responses_requested_;
+        stats.responses_completed  = responses_completed_;
+        stats.responses_cancelled  = responses_cancelled_;
+        stats.downloads_discarded  = downloads_discarded_;
+        return stats;
+}
+
+QQuickImageResponse *
+MxcImageProvider::requestImageResponse(const QString &id, const QSize &requestedSize)
+{
+        // Avatars ask for their rounded corners with ?radius=, so QML doesn't need a layer with a
+        // mask per avatar, which would keep the scene graph from batching them.
+        auto mxcId   = id;
+        qreal radius = 0;
+        if (const auto query = id.indexOf("?radius="); query != -1) {
+                radius = id.midRef(query + 8).toDouble();
+                mxcId.truncate(query);
+        }
+
+        auto response =
+          new MxcImageResponse(mxcId, requestedSize, encryptionInfo("mxc://" + mxcId), radius);
+        responses_requested_++;
+        workers::run(
+          workers::Pool::Decode, workers::Priority::Visible, [response]() { response->run(); });
+        return response;
+}
+
+void
+MxcImageProvider::addEncryptionInfo(mtx::crypto::EncryptedFile info)
+{
+        std::unique_lock<std::mutex> lock(infosMtx_);
+        infos.insert(QString::fromStdString(info.url), info);
+}
+
+boost::optional<mtx::crypto::EncryptedFile>
+MxcImageProvider::encryptionInfo(const QString &mxcUrl)
+{
+        std::unique_lock<std::mutex> lock(infosMtx_);
+
+        auto it = infos.find(mxcUrl);
+        if (it == infos.end())
+                return boost::none;
+
+        return *it;
+}
+
+void
+MxcImageProvider::prefetch(const std::vector<std::pair<QString, QSize>> &images)
+{
+        prefetchGeneration_++;
+
+        std::vector<http::RequestId> requests;
+        {
+                std::unique_lock<std::mutex> lock(prefetch_requests_mtx_);
+                requests.swap(prefetch_requests_);
+        }
+        // Outside of the lock, since a cancelled prefetch may be fetched again right away.
+        for (auto request : requests)
+                http::cancel(request);
+
+        for (const auto &[mxcUrl, size] : images) {
+                if (!mxcUrl.startsWith("mxc://"))
+                        continue;
+
+                auto job = std::make_shared<PrefetchJob>(QString(mxcUrl).remove(0, 6),
+                                                         size,
+                                                         encryptionInfo(mxcUrl),
+                                                         prefetchGeneration_);
+                workers::run(
+                  workers::Pool::Decode, workers::Priority::Background, [job]() { job->run(); });
+        }
+}
+
+void
+MxcImageResponse::run()
+{
+        // The response may be deleted, as soon as it is attached, so the fetch uses copies.
+        const auto id             = m_id;
+        const auto requestedSize  = m_requestedSize;
+        const auto encryptionInfo = m_encryptionInfo;
+
+        auto callback = [this](const QImage &image, const QString &error) {
+                m_image = utils::roundedImage(image, m_radius);
+                m_error = error;
+                responses_completed_++;
+                emit finished();
+        };
+
+        bool attached = false, first = false;
+        {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (!m_cancelled) {
+                        m_attached = attached = true;
+                        // The first response of an image fetches it, the others only wait for
+                        // its result.
+                        first = attachToFetch(
+                          fetchKey(id, requestedSize, encryptionInfo), this, std::move(callback));
+                }
+        }
+
+        if (!attached) {
+                responses_cancelled_++;
+                m_error = QStringLiteral("Cancelled");
+                emit finished();
+                return;
+        }
+
+        if (first)
+                fetch(id, requestedSize, encryptionInfo, http::Priority::Visible);
+}
+
+void
+MxcImageResponse::cancel()
+{
+        {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_cancelled = true;
+                // Otherwise run() finishes the response, once it starts.
+                if (!m_attached)
+                        return;
+        }
+
+        // The engine needs finished() exactly once, so it is only emitted here, if the fetch
+        // didn't hand its result to the response already.
+        if (detachFromFetch(fetchKey(m_id, m_requestedSize, m_encryptionInfo), this)) {
+                responses_cancelled_++;
+                m_error = QStringLiteral("Cancelled");
+                emit finished();
         }
 }
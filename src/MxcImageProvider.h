@@ -1,29 +1,53 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 #include <QQuickAsyncImageProvider>
 #include <QQuickImageResponse>
 
+#include <QHash>
 #include <QImage>
-#include <QThreadPool>
 
 #include <mtx/common.hpp>
 
 #include <boost/optional.hpp>
 
-class MxcImageResponse
-  : public QQuickImageResponse
-  , public QRunnable
+//! How the image requests of the timeline were served.
+struct MxcImageStats
+{
+        uint64_t cache_hits = 0;
+        uint64_t downloads  = 0;
+        //! Requests, which waited for the same image requested by another response.
+        uint64_t coalesced = 0;
+        //! Prefetches, which were cancelled before they started.
+        uint64_t prefetches_cancelled = 0;
+        //! Responses, which QML requested.
+        uint64_t responses_requested = 0;
+        //! Responses, which were handed their image or error.
+        uint64_t responses_completed = 0;
+        //! Responses, which QML dropped before their image arrived.
+        uint64_t responses_cancelled = 0;
+        //! Downloads, which finished after everything waiting for them was cancelled, so they
+        //! were neither decrypted nor decoded.
+        uint64_t downloads_discarded = 0;
+};
+
+class MxcImageResponse : public QQuickImageResponse
 {
 public:
         MxcImageResponse(const QString &id,
                          const QSize &requestedSize,
-                         boost::optional<mtx::crypto::EncryptedFile> encryptionInfo)
+                         boost::optional<mtx::crypto::EncryptedFile> encryptionInfo,
+                         qreal radius = 0)
           : m_id(id)
           , m_requestedSize(requestedSize)
           , m_encryptionInfo(encryptionInfo)
-        {
-                setAutoDelete(false);
-        }
+          , m_radius(radius)
+        {}
 
         QQuickTextureFactory *textureFactory() const override
         {
@@ -31,12 +55,24 @@ public:
         }
         QString errorString() const override { return m_error; }
 
-        void run() override;
+        //! Attach to the fetch of the image, in the decode pool.
+        void run();
+        //! Stop waiting for the image. Its download is cancelled, if no other response waits for
+        //! it and it didn't start yet.
+        void cancel() override;
 
         QString m_id, m_error;
         QSize m_requestedSize;
         QImage m_image;
         boost::optional<mtx::crypto::EncryptedFile> m_encryptionInfo;
+        //! The radius of the corners, which are cut off the image.
+        qreal m_radius = 0;
+
+private:
+        //! QML cancels the response from its thread, while run() may attach it in the pool.
+        std::mutex m_mutex;
+        bool m_cancelled = false;
+        bool m_attached  = false;
 };
 
 class MxcImageProvider
@@ -44,26 +80,27 @@ class MxcImageProvider
   , public QQuickAsyncImageProvider
 {
         Q_OBJECT
+public:
+        //! The counters of all providers.
+        static MxcImageStats stats();
+
+        //! Fetch images by their mxc url and requested size, which will probably be shown soon,
+        //! with a low priority. The prefetches of the previous call, which didn't start yet, are
+        //! cancelled.
+        void prefetch(const std::vector<std::pair<QString, QSize>> &images);
+
 public slots:
         QQuickImageResponse *requestImageResponse(const QString &id,
-                                                  const QSize &requestedSize) override
-        {
-                boost::optional<mtx::crypto::EncryptedFile> info;
-                auto temp = infos.find("mxc://" + id);
-                if (temp != infos.end())
-                        info = *temp;
-
-                MxcImageResponse *response = new MxcImageResponse(id, requestedSize, info);
-                pool.start(response);
-                return response;
-        }
+                                                  const QSize &requestedSize) override;
 
-        void addEncryptionInfo(mtx::crypto::EncryptedFile info)
-        {
-                infos.insert(QString::fromStdString(info.url), info);
-        }
+        void addEncryptionInfo(mtx::crypto::EncryptedFile info);
 
 private:
-        QThreadPool pool;
+        boost::optional<mtx::crypto::EncryptedFile> encryptionInfo(const QString &mxcUrl);
+
+        //! QML requests the images from its own thread.
+        std::mutex infosMtx_;
         QHash<QString, mtx::crypto::EncryptedFile> infos;
+        //! Prefetches of an older generation are skipped, when they start.
+        std::atomic<uint64_t> prefetchGeneration_{0};
 };
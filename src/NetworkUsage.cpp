@@ -0,0 +1,183 @@
+#include "NetworkUsage.h"
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <string>
+
+#include "Logging.h"
+#include "RequestScheduler.h"
+
+//! How many hours are kept for the statistics page.
+constexpr std::size_t KEPT_HOURS = 24;
+constexpr int64_t HOUR_SECONDS   = 3600;
+
+namespace {
+std::mutex mutex_;
+http::TrafficCounters session_{};
+std::deque<http::HourlyTraffic> hours_;
+uint64_t budget_ = 0;
+//! Read by the request scheduler on every dispatch, so it doesn't take the mutex.
+std::atomic_bool overBudget_{false};
+
+std::size_t
+index(http::Traffic category)
+{
+        return static_cast<std::size_t>(category);
+}
+
+uint64_t
+totalBytes(const http::TrafficCounters &traffic)
+{
+        uint64_t bytes = 0;
+        for (const auto &counter : traffic)
+                bytes += counter.bytes;
+        return bytes;
+}
+
+void
+logHour(const http::HourlyTraffic &hour)
+{
+        std::string summary;
+        for (std::size_t category = 0; category < http::TRAFFIC_CATEGORIES; category++) {
+                const auto &counter = hour.traffic[category];
+                if (!counter.requests && !counter.bytes)
+                        continue;
+
+                if (!summary.empty())
+                        summary += ", ";
+                summary += http::trafficName(static_cast<http::Traffic>(category));
+                summary += " " + std::to_string(counter.requests) + " requests " +
+                           std::to_string(counter.bytes) + " bytes";
+        }
+
+        nhlog::net()->info("traffic of the last hour: {}", summary.empty() ? "none" : summary);
+}
+
+//! The counters of the current hour. Starts a new hour, if the clock passed the last one, and
+//! sets budgetReset then, if the budget of the last one was exceeded. Needs the mutex.
+http::TrafficCounters &
+currentHour(bool &budgetReset)
+{
+        const auto now =
+          std::chrono::duration_cast<std::chrono::seconds>(
+            std::chrono::system_clock::now().time_since_epoch())
+            .count();
+        const auto start = now - now % HOUR_SECONDS;
+
+        budgetReset = false;
+        if (hours_.empty() || hours_.back().start != start) {
+                if (!hours_.empty())
+                        logHour(hours_.back());
+
+                hours_.push_back({start, {}});
+                while (hours_.size() > KEPT_HOURS)
+                        hours_.pop_front();
+
+                budgetReset = overBudget_.exchange(false);
+        }
+
+        return hours_.back().traffic;
+}
+
+void
+count(http::Traffic category, uint64_t requests, uint64_t bytes)
+{
+        bool budgetReset = false, budgetExceeded = false;
+        uint64_t budget  = 0;
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+
+                auto &hour = currentHour(budgetReset);
+                hour[index(category)].requests += requests;
+                hour[index(category)].bytes += bytes;
+                session_[index(category)].requests += requests;
+                session_[index(category)].bytes += bytes;
+
+                if (budget_ && !overBudget_ && totalBytes(hour) > budget_)
+                        budgetExceeded = overBudget_ = true;
+                budget = budget_;
+        }
+
+        if (budgetExceeded)
+                nhlog::net()->warn("the traffic of this hour exceeds the budget of {} bytes, "
+                                   "pausing the prefetches",
+                                   budget);
+
+        // Outside of the lock, since the scheduler asks whether the budget is exceeded.
+        if (budgetReset)
+                http::resume();
+}
+}
+
+namespace http {
+const char *
+trafficName(Traffic category)
+{
+        switch (category) {
+        case Traffic::Sync:
+                return "sync";
+        case Traffic::Download:
+                return "download";
+        case Traffic::Thumbnail:
+                return "thumbnail";
+        case Traffic::Upload:
+                return "upload";
+        case Traffic::Keys:
+                return "keys";
+        case Traffic::Receipts:
+                return "receipts";
+        case Traffic::Typing:
+                return "typing";
+        }
+
+        return "unknown";
+}
+
+void
+countRequest(Traffic category)
+{
+        count(category, 1, 0);
+}
+
+void
+countBytes(Traffic category, uint64_t bytes)
+{
+        count(category, 0, bytes);
+}
+
+TrafficStats
+trafficStats()
+{
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        TrafficStats stats;
+        stats.session = session_;
+        stats.hours   = hours_;
+        stats.budget  = budget_;
+        return stats;
+}
+
+void
+setTrafficBudget(uint64_t bytesPerHour)
+{
+        bool resumed = false;
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+                budget_ = bytesPerHour;
+
+                const bool over =
+                  budget_ && !hours_.empty() && totalBytes(hours_.back().traffic) > budget_;
+                resumed = overBudget_.exchange(over) && !over;
+        }
+
+        if (resumed)
+                http::resume();
+}
+
+bool
+overTrafficBudget()
+{
+        return overBudget_;
+}
+}
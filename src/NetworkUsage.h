@@ -0,0 +1,71 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+//! Accounts the traffic to the homeserver by what it was for, for the whole session and by hour.
+//!
+//! Requests are counted when they are sent. Bytes are counted, where the body is at hand, i.e.
+//! for media and uploads, and for syncs by the size of their json. mtxclient parses the other
+//! responses, before they are handed out, so their size is unknown.
+namespace http {
+enum class Traffic
+{
+        Sync,
+        Download,
+        Thumbnail,
+        Upload,
+        Keys,
+        Receipts,
+        Typing,
+};
+constexpr std::size_t TRAFFIC_CATEGORIES = 7;
+
+//! The name of the category in the log and on the statistics page.
+const char *
+trafficName(Traffic category);
+
+struct TrafficCounter
+{
+        uint64_t requests = 0;
+        uint64_t bytes    = 0;
+};
+using TrafficCounters = std::array<TrafficCounter, TRAFFIC_CATEGORIES>;
+
+//! The traffic of one hour of the wall clock.
+struct HourlyTraffic
+{
+        //! The start of the hour in seconds since the epoch.
+        int64_t start = 0;
+        TrafficCounters traffic{};
+};
+
+struct TrafficStats
+{
+        TrafficCounters session{};
+        //! The last hours, oldest first. The last one is the current hour.
+        std::deque<HourlyTraffic> hours;
+        //! 0, if the traffic isn't limited.
+        uint64_t budget = 0;
+};
+
+//! Count a request of the category.
+void
+countRequest(Traffic category);
+//! Count bytes sent or received by a request of the category.
+void
+countBytes(Traffic category, uint64_t bytes);
+
+TrafficStats
+trafficStats();
+
+//! Pause the background requests for the rest of an hour, once its traffic exceeds the bytes. 0
+//! removes the limit.
+void
+setTrafficBudget(uint64_t bytesPerHour);
+//! Whether the traffic of the current hour exceeds the budget.
+bool
+overTrafficBudget();
+}
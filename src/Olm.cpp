@@ -1,17 +1,125 @@
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <unordered_map>
 #include <variant>
 
+#include <QCoreApplication>
+#include <QTimer>
+
 #include "Olm.h"
 
 #include "Cache.h"
 #include "Logging.h"
 #include "MatrixClient.h"
+#include "NetworkUsage.h"
 #include "Utils.h"
 
 static const std::string STORAGE_SECRET_KEY("secret");
 constexpr auto MEGOLM_ALGO = "m.megolm.v1.aes-sha2";
 
+namespace olm {
+struct ToDeviceBatch
+{
+        //! The sessions of the room key events.
+        std::vector<std::pair<MegolmSessionIndex, mtx::crypto::InboundGroupSessionPtr>> room_keys;
+        //! Whether one time keys were used up, so the account has to be saved.
+        bool account_changed = false;
+};
+}
+
 namespace {
 auto client_ = std::make_unique<mtx::crypto::OlmClient>();
+
+std::atomic<uint64_t> decrypted_messages_{0};
+std::atomic<uint64_t> decryption_attempts_{0};
+
+//! Every pre-key message uses up a one-time key of the account. While a key share storm lasts,
+//! the account is saved at most once per interval, instead of after every batch.
+constexpr std::chrono::seconds ACCOUNT_SAVE_INTERVAL{10};
+
+//! Whether the account changed since it was saved. Only used from the sync worker, like the
+//! account.
+bool account_dirty_ = false;
+std::chrono::steady_clock::time_point account_saved_;
+
+//! The same key request isn't answered twice in an interval and a device may only make a few
+//! requests per interval, so a misbehaving client can't keep us encrypting keys.
+constexpr std::chrono::seconds KEY_REQUEST_INTERVAL{60};
+constexpr int MAX_KEY_REQUESTS_PER_INTERVAL = 10;
+//! Our own requests for a session are sent once and retried after a while, if the key didn't
+//! arrive.
+constexpr std::chrono::seconds KEY_REQUEST_RETRY_INTERVAL{60};
+constexpr int MAX_KEY_REQUEST_RETRIES = 3;
+//! Above this many entries, the expired ones are removed.
+constexpr std::size_t MAX_KEY_REQUEST_ENTRIES = 256;
+
+struct KeyRequestBroker
+{
+        using Clock = std::chrono::steady_clock;
+
+        struct DeviceRequests
+        {
+                Clock::time_point since;
+                int count = 0;
+        };
+
+        std::mutex mtx;
+        //! When the incoming requests were answered, by room, session and requesting device.
+        std::map<std::string, Clock::time_point> answered;
+        //! The incoming requests of every device in its current interval.
+        std::map<std::string, DeviceRequests> devices;
+        //! How often we requested the sessions, by session id.
+        std::map<std::string, int> requested;
+};
+
+KeyRequestBroker key_requests_;
+
+//! Whether an incoming request should be answered, counts it against the requesting device.
+bool
+accept_key_request(const mtx::events::msg::KeyRequest &req)
+{
+        const auto now    = KeyRequestBroker::Clock::now();
+        const auto device = req.sender + "|" + req.requesting_device_id;
+        const auto key    = req.room_id + "|" + req.session_id + "|" + device;
+
+        std::unique_lock<std::mutex> lock(key_requests_.mtx);
+
+        auto &requests = key_requests_.devices[device];
+        if (now - requests.since > KEY_REQUEST_INTERVAL)
+                requests = {now, 0};
+        if (++requests.count > MAX_KEY_REQUESTS_PER_INTERVAL)
+                return false;
+
+        auto [answered, isNew] = key_requests_.answered.try_emplace(key, now);
+        if (!isNew) {
+                if (now - answered->second < KEY_REQUEST_INTERVAL)
+                        return false;
+                answered->second = now;
+        }
+
+        if (key_requests_.answered.size() > MAX_KEY_REQUEST_ENTRIES) {
+                for (auto it = key_requests_.answered.begin();
+                     it != key_requests_.answered.end();) {
+                        if (now - it->second > KEY_REQUEST_INTERVAL)
+                                it = key_requests_.answered.erase(it);
+                        else
+                                ++it;
+                }
+        }
+        if (key_requests_.devices.size() > MAX_KEY_REQUEST_ENTRIES) {
+                for (auto it = key_requests_.devices.begin();
+                     it != key_requests_.devices.end();) {
+                        if (now - it->second.since > KEY_REQUEST_INTERVAL)
+                                it = key_requests_.devices.erase(it);
+                        else
+                                ++it;
+                }
+        }
+
+        return true;
+}
 }
 
 namespace olm {
@@ -25,15 +133,28 @@ client()
 void
 handle_to_device_messages(const std::vector<nlohmann::json> &msgs)
 {
-        if (msgs.empty())
+        if (msgs.empty()) {
+                // A deferred save of the account is done by one of the next syncs.
+                save_account(false);
                 return;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        const bool debug = nhlog::crypto()->should_log(spdlog::level::debug);
 
-        nhlog::crypto()->info("received {} to_device messages", msgs.size());
+        // The messages of a sender key are handled one after the other, in the order they were
+        // sent, so its olm sessions are looked up once per batch.
+        std::vector<std::string> sender_keys;
+        std::unordered_map<std::string, std::vector<OlmMessage>> olm_messages;
+        std::size_t unhandled = 0;
+
+        ToDeviceBatch batch;
 
         for (const auto &msg : msgs) {
                 if (msg.count("type") == 0) {
-                        nhlog::crypto()->warn("received message with no type field: {}",
-                                              msg.dump(2));
+                        nhlog::crypto()->warn("received message with no type field");
+                        if (debug)
+                                nhlog::crypto()->debug("message: {}", msg.dump(2));
                         continue;
                 }
 
@@ -42,42 +163,82 @@ handle_to_device_messages(const std::vector<nlohmann::json> &msgs)
                 if (msg_type == to_string(mtx::events::EventType::RoomEncrypted)) {
                         try {
                                 OlmMessage olm_msg = msg;
-                                handle_olm_message(std::move(olm_msg));
+
+                                auto [it, isNew] = olm_messages.try_emplace(olm_msg.sender_key);
+                                if (isNew)
+                                        sender_keys.push_back(olm_msg.sender_key);
+                                it->second.push_back(std::move(olm_msg));
                         } catch (const nlohmann::json::exception &e) {
-                                nhlog::crypto()->warn(
-                                  "parsing error for olm message: {} {}", e.what(), msg.dump(2));
+                                nhlog::crypto()->warn("parsing error for olm message: {}",
+                                                      e.what());
+                                if (debug)
+                                        nhlog::crypto()->debug("message: {}", msg.dump(2));
                         } catch (const std::invalid_argument &e) {
-                                nhlog::crypto()->warn(
-                                  "validation error for olm message: {} {}", e.what(), msg.dump(2));
+                                nhlog::crypto()->warn("validation error for olm message: {}",
+                                                      e.what());
+                                if (debug)
+                                        nhlog::crypto()->debug("message: {}", msg.dump(2));
                         }
 
                 } else if (msg_type == to_string(mtx::events::EventType::RoomKeyRequest)) {
-                        nhlog::crypto()->warn("handling key request event: {}", msg.dump(2));
+                        if (debug)
+                                nhlog::crypto()->debug("handling key request event: {}",
+                                                       msg.dump(2));
                         try {
                                 mtx::events::msg::KeyRequest req = msg;
                                 if (req.action == mtx::events::msg::RequestAction::Request)
                                         handle_key_request_message(std::move(req));
                                 else
-                                        nhlog::crypto()->warn(
+                                        nhlog::crypto()->debug(
                                           "ignore key request (unhandled action): {}",
                                           req.request_id);
                         } catch (const nlohmann::json::exception &e) {
-                                nhlog::crypto()->warn(
-                                  "parsing error for key_request message: {} {}",
-                                  e.what(),
-                                  msg.dump(2));
+                                nhlog::crypto()->warn("parsing error for key_request message: {}",
+                                                      e.what());
                         }
                 } else {
-                        nhlog::crypto()->warn("unhandled event: {}", msg.dump(2));
+                        unhandled++;
+                        if (debug)
+                                nhlog::crypto()->debug("unhandled event: {}", msg.dump(2));
                 }
         }
+
+        for (const auto &sender_key : sender_keys) {
+                for (const auto &olm_msg : olm_messages[sender_key])
+                        handle_olm_message(olm_msg, batch);
+        }
+
+        const auto room_keys = batch.room_keys.size();
+        if (batch.account_changed)
+                mark_account_changed();
+        else
+                save_account(false);
+
+        try {
+                cache::saveInboundMegolmSessions(std::move(batch.room_keys));
+        } catch (const lmdb::error &e) {
+                nhlog::crypto()->critical("failed to save the room keys of {} messages: {}",
+                                          msgs.size(),
+                                          e.what());
+                return;
+        }
+
+        const auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start);
+        nhlog::crypto()->info("handled {} to_device messages from {} sender keys in {} ms, "
+                              "{} room keys, {} unhandled",
+                              msgs.size(),
+                              sender_keys.size(),
+                              duration.count(),
+                              room_keys,
+                              unhandled);
 }
 
 void
-handle_olm_message(const OlmMessage &msg)
+handle_olm_message(const OlmMessage &msg, ToDeviceBatch &batch)
 {
-        nhlog::crypto()->info("sender    : {}", msg.sender);
-        nhlog::crypto()->info("sender_key: {}", msg.sender_key);
+        nhlog::crypto()->debug("sender    : {}", msg.sender);
+        nhlog::crypto()->debug("sender_key: {}", msg.sender_key);
 
         const auto my_key = olm::client()->identity_keys().curve25519;
 
@@ -87,13 +248,15 @@ handle_olm_message(const OlmMessage &msg)
                         continue;
 
                 const auto type = cipher.second.type;
-                nhlog::crypto()->info("type: {}", type == 0 ? "OLM_PRE_KEY" : "OLM_MESSAGE");
+                nhlog::crypto()->debug("type: {}", type == 0 ? "OLM_PRE_KEY" : "OLM_MESSAGE");
 
                 auto payload = try_olm_decryption(msg.sender_key, cipher.second);
 
                 if (!payload.is_null()) {
-                        nhlog::crypto()->debug("decrypted olm payload: {}", payload.dump(2));
-                        create_inbound_megolm_session(msg.sender, msg.sender_key, payload);
+                        if (nhlog::crypto()->should_log(spdlog::level::debug))
+                                nhlog::crypto()->debug("decrypted olm payload: {}",
+                                                       payload.dump(2));
+                        create_inbound_megolm_session(msg.sender, msg.sender_key, payload, batch);
                         return;
                 }
 
@@ -103,16 +266,18 @@ handle_olm_message(const OlmMessage &msg)
                         return;
                 }
 
-                handle_pre_key_olm_message(msg.sender, msg.sender_key, cipher.second);
+                handle_pre_key_olm_message(msg.sender, msg.sender_key, cipher.second, batch);
         }
 }
 
 void
 handle_pre_key_olm_message(const std::string &sender,
                            const std::string &sender_key,
-                           const mtx::events::msg::OlmCipherContent &content)
+                           const mtx::events::msg::OlmCipherContent &content,
+                           ToDeviceBatch &batch)
 {
         nhlog::crypto()->info("opening olm session with {}", sender);
+        cache::LatencyTimer timer(NHEKO_METRIC("olm pre-key message"));
 
         mtx::crypto::OlmSessionPtr inbound_session = nullptr;
         try {
@@ -120,8 +285,9 @@ handle_pre_key_olm_message(const std::string &sender,
                   olm::client()->create_inbound_session_from(sender_key, content.body);
 
                 // We also remove the one time key used to establish that
-                // session so we'll have to update our copy of the account object.
-                cache::saveOlmAccount(olm::client()->save("secret"));
+                // session so we'll have to update our copy of the account object, once the
+                // batch is done.
+                batch.account_changed = true;
         } catch (const mtx::crypto::olm_exception &e) {
                 nhlog::crypto()->critical(
                   "failed to create inbound session with {}: {}", sender, e.what());
@@ -146,7 +312,8 @@ handle_pre_key_olm_message(const std::string &sender,
         }
 
         auto plaintext = json::parse(std::string((char *)output.data(), output.size()));
-        nhlog::crypto()->debug("decrypted message: \n {}", plaintext.dump(2));
+        if (nhlog::crypto()->should_log(spdlog::level::debug))
+                nhlog::crypto()->debug("decrypted message: \n {}", plaintext.dump(2));
 
         try {
                 cache::saveOlmSession(sender_key, std::move(inbound_session));
@@ -155,7 +322,7 @@ handle_pre_key_olm_message(const std::string &sender,
                   "failed to save inbound olm session from {}: {}", sender, e.what());
         }
 
-        create_inbound_megolm_session(sender, sender_key, plaintext);
+        create_inbound_megolm_session(sender, sender_key, plaintext, batch);
 }
 
 mtx::events::msg::Encrypted
@@ -170,9 +337,14 @@ encrypt_group_message(const std::string &room_id, const std::string &device_id,
                 body["content"].erase("m.relates_to");
         }
 
+        cache::LatencyTimer timer(NHEKO_METRIC("megolm encrypt"));
+
+        const auto plaintext = body.dump();
+        cache::recordCount(NHEKO_METRIC("megolm encrypt bytes"), plaintext.size());
+
         // Always check before for existence.
         auto res     = cache::getOutboundMegolmSession(room_id);
-        auto payload = olm::client()->encrypt_group_message(res.session, body.dump());
+        auto payload = olm::client()->encrypt_group_message(res.session, plaintext);
 
         // Prepare the m.room.encrypted event.
         msg::Encrypted data;
@@ -192,14 +364,21 @@ encrypt_group_message(const std::string &room_id, const std::string &device_id,
         return data;
 }
 
+OlmDecryptionStats
+decryption_stats()
+{
+        return OlmDecryptionStats{decrypted_messages_, decryption_attempts_};
+}
+
 nlohmann::json
 try_olm_decryption(const std::string &sender_key, const mtx::events::msg::OlmCipherContent &msg)
 {
         auto session_ids = cache::getOlmSessions(sender_key);
 
-        nhlog::crypto()->info("attempt to decrypt message with {} known session_ids",
-                              session_ids.size());
+        nhlog::crypto()->debug("attempt to decrypt message with {} known session_ids",
+                               session_ids.size());
 
+        uint64_t attempts = 0;
         for (const auto &id : session_ids) {
                 auto session = cache::getOlmSession(sender_key, id);
 
@@ -208,9 +387,12 @@ try_olm_decryption(const std::string &sender_key, const mtx::events::msg::OlmCip
 
                 mtx::crypto::BinaryBuf text;
 
+                attempts++;
+                decryption_attempts_++;
+
                 try {
                         text = olm::client()->decrypt_message(session->get(), msg.type, msg.body);
-                        cache::saveOlmSession(id, std::move(session.value()));
+                        cache::saveOlmSession(sender_key, std::move(session.value()));
                 } catch (const mtx::crypto::olm_exception &e) {
                         nhlog::crypto()->debug("failed to decrypt olm message ({}, {}) with {}: {}",
                                                msg.type,
@@ -223,6 +405,9 @@ try_olm_decryption(const std::string &sender_key, const mtx::events::msg::OlmCip
                         return {};
                 }
 
+                decrypted_messages_++;
+                nhlog::crypto()->debug("decrypted olm message after {} attempts", attempts);
+
                 try {
                         return json::parse(std::string((char *)text.data(), text.size()));
                 } catch (const json::exception &e) {
@@ -237,7 +422,8 @@ try_olm_decryption(const std::string &sender_key, const mtx::events::msg::OlmCip
 void
 create_inbound_megolm_session(const std::string &sender,
                               const std::string &sender_key,
-                              const nlohmann::json &payload)
+                              const nlohmann::json &payload,
+                              ToDeviceBatch &batch)
 {
         std::string room_id, session_id, session_key;
 
@@ -246,8 +432,9 @@ create_inbound_megolm_session(const std::string &sender,
                 session_id  = payload.at("content").at("session_id");
                 session_key = payload.at("content").at("session_key");
         } catch (const nlohmann::json::exception &e) {
-                nhlog::crypto()->critical(
-                  "failed to parse plaintext olm message: {} {}", e.what(), payload.dump(2));
+                nhlog::crypto()->critical("failed to parse plaintext olm message: {}", e.what());
+                if (nhlog::crypto()->should_log(spdlog::level::debug))
+                        nhlog::crypto()->debug("payload: {}", payload.dump(2));
                 return;
         }
 
@@ -257,24 +444,50 @@ create_inbound_megolm_session(const std::string &sender,
         index.sender_key = sender_key;
 
         try {
-                auto megolm_session = olm::client()->init_inbound_group_session(session_key);
-                cache::saveInboundMegolmSession(index, std::move(megolm_session));
-        } catch (const lmdb::error &e) {
-                nhlog::crypto()->critical("failed to save inbound megolm session: {}", e.what());
-                return;
+                batch.room_keys.emplace_back(
+                  index, olm::client()->init_inbound_group_session(session_key));
         } catch (const mtx::crypto::olm_exception &e) {
                 nhlog::crypto()->critical("failed to create inbound megolm session: {}", e.what());
                 return;
         }
 
-        nhlog::crypto()->info("established inbound megolm session ({}, {})", room_id, sender);
+        nhlog::crypto()->debug("established inbound megolm session ({}, {})", room_id, sender);
 }
 
 void
 mark_keys_as_published()
 {
         olm::client()->mark_keys_as_published();
-        cache::saveOlmAccount(olm::client()->save(STORAGE_SECRET_KEY));
+
+        // Otherwise the next start would upload the same keys again.
+        mark_account_changed();
+        save_account(true);
+}
+
+void
+mark_account_changed()
+{
+        account_dirty_ = true;
+        save_account(false);
+}
+
+bool
+save_account(bool force)
+{
+        const auto now = std::chrono::steady_clock::now();
+        if (!account_dirty_ || (!force && now - account_saved_ < ACCOUNT_SAVE_INTERVAL))
+                return true;
+
+        try {
+                cache::saveOlmAccount(olm::client()->save(STORAGE_SECRET_KEY));
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("failed to save the olm account: {}", e.what());
+                return false;
+        }
+
+        account_dirty_ = false;
+        account_saved_ = now;
+        return true;
 }
 
 void
@@ -309,35 +522,86 @@ void
 send_key_request_for(const std::string &room_id,
                      const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e)
 {
-        using namespace mtx::events;
+        {
+                std::unique_lock<std::mutex> lock(key_requests_.mtx);
+                if (!key_requests_.requested.try_emplace(e.content.session_id, 0).second) {
+                        nhlog::crypto()->debug("the keys of session {} are already requested",
+                                               e.content.session_id);
+                        return;
+                }
+        }
+
+        send_key_request(
+          room_id, e.sender, e.content.device_id, e.content.sender_key, e.content.session_id);
+}
 
-        nhlog::crypto()->debug("sending key request: {}", json(e).dump(2));
+void
+send_key_request(const std::string &room_id,
+                 const std::string &sender,
+                 const std::string &device_id,
+                 const std::string &sender_key,
+                 const std::string &session_id)
+{
         auto payload = json{{"action", "request"},
                             {"request_id", http::client()->generate_txn_id()},
                             {"requesting_device_id", http::client()->device_id()},
                             {"body",
                              {{"algorithm", MEGOLM_ALGO},
                               {"room_id", room_id},
-                              {"sender_key", e.content.sender_key},
-                              {"session_id", e.content.session_id}}}};
+                              {"sender_key", sender_key},
+                              {"session_id", session_id}}}};
 
         json body;
-        body["messages"][e.sender]                      = json::object();
-        body["messages"][e.sender][e.content.device_id] = payload;
+        body["messages"][sender]            = json::object();
+        body["messages"][sender][device_id] = payload;
 
         nhlog::crypto()->debug("m.room_key_request: {}", body.dump(2));
 
-        http::client()->send_to_device("m.room_key_request", body, [e](mtx::http::RequestErr err) {
-                if (err) {
-                        nhlog::net()->warn("failed to send "
-                                           "send_to_device "
-                                           "message: {}",
-                                           err->matrix_error.error);
-                }
+        http::countRequest(http::Traffic::Keys);
+        http::client()->send_to_device(
+          "m.room_key_request", body, [sender, device_id, session_id](mtx::http::RequestErr err) {
+                  if (err) {
+                          nhlog::net()->warn("failed to send "
+                                             "send_to_device "
+                                             "message: {}",
+                                             err->matrix_error.error);
+
+                          // The next undecryptable event of the session requests it again.
+                          std::unique_lock<std::mutex> lock(key_requests_.mtx);
+                          key_requests_.requested.erase(session_id);
+                          return;
+                  }
+
+                  nhlog::net()->info("m.room_key_request sent to {}:{}", sender, device_id);
+          });
+
+        // The timer has to run on a thread with an event loop.
+        QTimer::singleShot(
+          KEY_REQUEST_RETRY_INTERVAL,
+          QCoreApplication::instance(),
+          [room_id, sender, device_id, sender_key, session_id]() {
+                  MegolmSessionIndex index;
+                  index.room_id    = room_id;
+                  index.session_id = session_id;
+                  index.sender_key = sender_key;
+
+                  const bool received = cache::inboundMegolmSessionExists(index);
+
+                  {
+                          std::unique_lock<std::mutex> lock(key_requests_.mtx);
+                          auto it = key_requests_.requested.find(session_id);
+                          if (it == key_requests_.requested.end())
+                                  return;
+
+                          if (received || ++it->second > MAX_KEY_REQUEST_RETRIES) {
+                                  key_requests_.requested.erase(it);
+                                  return;
+                          }
+                  }
 
-                nhlog::net()->info(
-                  "m.room_key_request sent to {}:{}", e.sender, e.content.device_id);
-        });
+                  nhlog::crypto()->info("requesting the keys of session {} again", session_id);
+                  send_key_request(room_id, sender, device_id, sender_key, session_id);
+          });
 }
 
 void
@@ -350,6 +614,15 @@ handle_key_request_message(const mtx::events::msg::KeyRequest &req)
                 return;
         }
 
+        // Before any lookup or encryption.
+        if (!accept_key_request(req)) {
+                nhlog::crypto()->debug("ignoring repeated key request {} from {}:{}",
+                                       req.request_id,
+                                       req.sender,
+                                       req.requesting_device_id);
+                return;
+        }
+
         // Check if we were the sender of the session being requested.
         if (req.sender_key != olm::client()->identity_keys().curve25519) {
                 nhlog::crypto()->debug("ignoring key request {} because we were not the sender: "
@@ -400,6 +673,113 @@ handle_key_request_message(const mtx::events::msg::KeyRequest &req)
         send_megolm_key_to_device(req.sender, req.requesting_device_id, payload);
 }
 
+void
+query_device_keys(const std::vector<std::string> &user_ids,
+                  std::function<void(UserDevices devices, bool failed)> callback)
+{
+        UserDevices devices;
+        mtx::requests::QueryKeys req;
+        const auto known = cache::deviceKeys(user_ids);
+        for (const auto &user_id : user_ids) {
+                auto keys = known.find(user_id);
+                if (keys != known.end() && !keys->second.outdated)
+                        devices[user_id] = keys->second.devices;
+                else
+                        req.device_keys[user_id] = {};
+        }
+
+        nhlog::crypto()->debug(
+          "querying the devices of {} of {} users", req.device_keys.size(), user_ids.size());
+
+        if (req.device_keys.empty()) {
+                callback(std::move(devices), false);
+                return;
+        }
+
+        http::countRequest(http::Traffic::Keys);
+        http::client()->query_keys(
+          req,
+          [devices = std::move(devices), callback = std::move(callback)](
+            const mtx::responses::QueryKeys &res, mtx::http::RequestErr err) mutable {
+                  if (err) {
+                          nhlog::net()->warn("failed to query device keys: {} {}",
+                                             err->matrix_error.error,
+                                             static_cast<int>(err->status_code));
+                          callback(std::move(devices), true);
+                          return;
+                  }
+
+                  std::map<std::string, UserDeviceKeys> queried;
+                  for (const auto &user : res.device_keys) {
+                          // The devices with valid identity keys.
+                          auto &deviceKeys = queried[user.first].devices;
+
+                          for (const auto &dev : user.second) {
+                                  const auto user_id   = UserId(dev.second.user_id);
+                                  const auto device_id = DeviceId(dev.second.device_id);
+
+                                  const auto device_keys = dev.second.keys;
+                                  const auto curveKey    = "curve25519:" + device_id.get();
+                                  const auto edKey       = "ed25519:" + device_id.get();
+
+                                  if ((device_keys.find(curveKey) == device_keys.end()) ||
+                                      (device_keys.find(edKey) == device_keys.end())) {
+                                          nhlog::net()->debug(
+                                            "ignoring malformed keys for device {}",
+                                            device_id.get());
+                                          continue;
+                                  }
+
+                                  DevicePublicKeys pks;
+                                  pks.ed25519      = device_keys.at(edKey);
+                                  pks.curve25519   = device_keys.at(curveKey);
+                                  pks.display_name = dev.second.unsigned_info.device_display_name;
+
+                                  try {
+                                          if (!mtx::crypto::verify_identity_signature(
+                                                json(dev.second), device_id, user_id)) {
+                                                  nhlog::crypto()->warn(
+                                                    "failed to verify identity keys: {}",
+                                                    json(dev.second).dump(2));
+                                                  continue;
+                                          }
+                                  } catch (const json::exception &e) {
+                                          nhlog::crypto()->warn(
+                                            "failed to parse device key json: {}", e.what());
+                                          continue;
+                                  } catch (const mtx::crypto::olm_exception &e) {
+                                          nhlog::crypto()->warn(
+                                            "failed to verify device key json: {}", e.what());
+                                          continue;
+                                  }
+
+                                  deviceKeys.emplace(device_id.get(), pks);
+                          }
+
+                          devices[user.first] = deviceKeys;
+                  }
+
+                  cache::saveDeviceKeys(queried);
+
+                  callback(std::move(devices), false);
+          });
+}
+
+void
+refresh_device_keys(const std::vector<std::string> &changed)
+{
+        std::vector<std::string> outdated;
+        for (const auto &[user_id, keys] : cache::deviceKeys(changed))
+                if (keys.outdated)
+                        outdated.push_back(user_id);
+
+        if (outdated.empty())
+                return;
+
+        // A failed query leaves the marks, so the next message queries them again.
+        query_device_keys(outdated, [](UserDevices, bool) {});
+}
+
 void
 send_megolm_key_to_device(const std::string &user_id,
                           const std::string &device_id,
@@ -408,6 +788,7 @@ send_megolm_key_to_device(const std::string &user_id,
         mtx::requests::QueryKeys req;
         req.device_keys[user_id] = {device_id};
 
+        http::countRequest(http::Traffic::Keys);
         http::client()->query_keys(
           req,
           [payload, user_id, device_id](const mtx::responses::QueryKeys &res,
@@ -466,6 +847,7 @@ send_megolm_key_to_device(const std::string &user_id,
                                     ->create_room_key_event(UserId(user_id), pks.ed25519, payload)
                                     .dump();
 
+                  http::countRequest(http::Traffic::Keys);
                   http::client()->claim_keys(
                     user_id,
                     {device_id},
@@ -530,6 +912,7 @@ send_megolm_key_to_device(const std::string &user_id,
 
                             nhlog::net()->info(
                               "sending m.room_key event to {}:{}", user_id, device_id);
+                            http::countRequest(http::Traffic::Keys);
                             http::client()->send_to_device(
                               "m.room.encrypted", body, [user_id](mtx::http::RequestErr err) {
                                       if (err) {
@@ -539,7 +922,7 @@ send_megolm_key_to_device(const std::string &user_id,
                                                                  err->matrix_error.error);
                                       }
 
-                                      nhlog::net()->info("m.room_key send to {}", user_id);
+                                      nhlog::net()->debug("m.room_key send to {}", user_id);
                               });
                     });
           });
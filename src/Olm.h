@@ -2,15 +2,21 @@
 
 #include <boost/optional.hpp>
 
+#include <functional>
 #include <memory>
 #include <mtx/events.hpp>
 #include <mtx/events/encrypted.hpp>
 #include <mtxclient/crypto/client.hpp>
 
+#include "CacheCryptoStructs.h"
+
 constexpr auto OLM_ALGO = "m.olm.v1.curve25519-aes-sha2";
 
 namespace olm {
 
+//! The results of a batch of to-device messages, which are saved together.
+struct ToDeviceBatch;
+
 struct OlmMessage
 {
         std::string sender_key;
@@ -39,26 +45,42 @@ from_json(const nlohmann::json &obj, OlmMessage &msg)
 mtx::crypto::OlmClient *
 client();
 
+//! Handles the messages grouped by their sender key and saves all their room keys in one
+//! transaction.
 void
 handle_to_device_messages(const std::vector<nlohmann::json> &msgs);
 
+//! Tries the sessions with the sender, the most recently used first.
 nlohmann::json
 try_olm_decryption(const std::string &sender_key,
                    const mtx::events::msg::OlmCipherContent &content);
 
+//! How many sessions were tried to decrypt the olm messages so far.
+struct OlmDecryptionStats
+{
+        uint64_t decrypted = 0;
+        uint64_t attempts  = 0;
+};
+
+OlmDecryptionStats
+decryption_stats();
+
 void
-handle_olm_message(const OlmMessage &msg);
+handle_olm_message(const OlmMessage &msg, ToDeviceBatch &batch);
 
-//! Establish a new inbound megolm session with the decrypted payload from olm.
+//! Establish a new inbound megolm session with the decrypted payload from olm. It is saved with
+//! the rest of the batch.
 void
 create_inbound_megolm_session(const std::string &sender,
                               const std::string &sender_key,
-                              const nlohmann::json &payload);
+                              const nlohmann::json &payload,
+                              ToDeviceBatch &batch);
 
 void
 handle_pre_key_olm_message(const std::string &sender,
                            const std::string &sender_key,
-                           const mtx::events::msg::OlmCipherContent &content);
+                           const mtx::events::msg::OlmCipherContent &content,
+                           ToDeviceBatch &batch);
 
 mtx::events::msg::Encrypted
 encrypt_group_message(const std::string &room_id,
@@ -68,17 +90,52 @@ encrypt_group_message(const std::string &room_id,
 void
 mark_keys_as_published();
 
+//! Mark the olm account as changed, e.g. after one-time keys were used up or generated. It is
+//! saved right away, unless it was saved less than an interval ago. Then save_account saves it
+//! later.
+void
+mark_account_changed();
+//! Save the olm account, if it changed since it was saved last. Unless forced, only once the
+//! interval since the last save passed. Forced before one-time keys are uploaded and at
+//! shutdown, so the server never hands out keys, which we lost. Returns false, if the save
+//! failed.
+bool
+save_account(bool force);
+
 //! Request the encryption keys from sender's device for the given event.
 void
 request_keys(const std::string &room_id, const std::string &event_id);
 
+//! Request the keys of the session of the event, unless they are already requested. The request
+//! is repeated a few times, until the keys arrive.
 void
 send_key_request_for(const std::string &room_id,
                      const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &);
 
+void
+send_key_request(const std::string &room_id,
+                 const std::string &sender,
+                 const std::string &device_id,
+                 const std::string &sender_key,
+                 const std::string &session_id);
+
 void
 handle_key_request_message(const mtx::events::msg::KeyRequest &);
 
+//! user_id -> device_id -> verified keys
+using UserDevices = std::map<std::string, std::map<std::string, DevicePublicKeys>>;
+
+//! Get the verified devices of the users. The devices are taken from the cache and only the
+//! users, which aren't cached or whose devices changed since they were queried, are queried from
+//! the server. The callback is called on the network thread, if a query was made.
+void
+query_device_keys(const std::vector<std::string> &user_ids,
+                  std::function<void(UserDevices devices, bool failed)> callback);
+//! Query the devices of the users of a sync's device_lists.changed, whose keys are cached, so
+//! the cache doesn't keep them marked as outdated until the next message needs them.
+void
+refresh_device_keys(const std::vector<std::string> &changed);
+
 void
 send_megolm_key_to_device(const std::string &user_id,
                           const std::string &device_id,
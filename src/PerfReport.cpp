@@ -0,0 +1,156 @@
+#include "PerfReport.h"
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QDir>
+#include <QFile>
+#include <QSettings>
+#include <QStandardPaths>
+#include <QTimer>
+
+#include "BlurhashProvider.h"
+#include "Cache.h"
+#include "ChatPage.h"
+#include "ColorImageProvider.h"
+#include "Logging.h"
+#include "MemoryGovernor.h"
+#include "MxcImageProvider.h"
+#include "NetworkUsage.h"
+#include "Wakeups.h"
+
+//! How often a snapshot is appended, while they are enabled.
+constexpr int SNAPSHOT_INTERVAL = 5 * 60 * 1000;
+//! Like the log files, the snapshots are rotated once, when they reach this size.
+constexpr qint64 MAX_SNAPSHOTS_SIZE = 1024 * 1024 * 6;
+
+namespace {
+QString
+snapshotsPath()
+{
+        return QDir(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
+          .filePath("perf-snapshots.json");
+}
+
+nlohmann::json
+histograms(const std::map<std::string, LatencyHistogram> &operations)
+{
+        auto result = nlohmann::json::object();
+        for (const auto &[operation, histogram] : operations)
+                result[operation] = {
+                  {"count", histogram.count},
+                  {"mean", histogram.count ? histogram.total_us / histogram.count : 0},
+                  {"p50", histogram.quantile(0.5)},
+                  {"p90", histogram.quantile(0.9)},
+                  {"p99", histogram.quantile(0.99)},
+                  {"max", histogram.max_us},
+                };
+
+        return result;
+}
+
+nlohmann::json
+hitRate(uint64_t hits, uint64_t misses)
+{
+        return {{"hits", hits},
+                {"misses", misses},
+                {"rate", hits + misses ? static_cast<double>(hits) / (hits + misses) : 0.0}};
+}
+
+void
+appendSnapshot()
+{
+        // The timer keeps running, when the snapshots are disabled again.
+        if (!QSettings().value("user/perf_snapshots", false).toBool())
+                return;
+
+        const auto path = snapshotsPath();
+        if (QFile(path).size() >= MAX_SNAPSHOTS_SIZE) {
+                QFile::remove(path + ".1");
+                QFile::rename(path, path + ".1");
+        }
+
+        QFile file(path);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text)) {
+                nhlog::ui()->warn("failed to write the performance snapshot to {}",
+                                  path.toStdString());
+                return;
+        }
+
+        file.write(QByteArray::fromStdString(perf::snapshot().dump() + "\n"));
+}
+}
+
+namespace perf {
+nlohmann::json
+snapshot()
+{
+        nlohmann::json result;
+        result["time"] = QDateTime::currentSecsSinceEpoch();
+
+        // Latencies in us, counts in their own unit.
+        result["latencies"] = histograms(cache::latencies());
+        result["counts"]    = histograms(cache::counts());
+
+        auto layers        = nlohmann::json::object();
+        layers["resident"] = memory::resident();
+        for (const auto &layer : memory::usage())
+                layers[layer.name] = {{"used", layer.used}, {"budget", layer.budget}};
+        layers["blurhashes"] = BlurhashProvider::stats().memory;
+        result["memory"]     = std::move(layers);
+
+        const auto traffic = http::trafficStats();
+        auto requests      = nlohmann::json::object();
+        for (std::size_t category = 0; category < http::TRAFFIC_CATEGORIES; category++)
+                requests[http::trafficName(static_cast<http::Traffic>(category))] = {
+                  {"requests", traffic.session[category].requests},
+                  {"bytes", traffic.session[category].bytes}};
+        result["requests"] = std::move(requests);
+
+        const auto images     = MxcImageProvider::stats();
+        const auto blurhashes = BlurhashProvider::stats();
+        const auto icons      = ColorImageProvider::stats();
+        auto caches           = nlohmann::json::object();
+        caches["images"]      = hitRate(images.cache_hits, images.downloads);
+        caches["blurhashes"]  = hitRate(blurhashes.cache_hits, blurhashes.decoded);
+        caches["icons"]       = hitRate(icons.cache_hits, icons.renders);
+        if (cache::client()) {
+                const auto sessions       = cache::inboundMegolmSessionStats();
+                caches["megolm sessions"] = hitRate(sessions.hits, sessions.misses);
+        }
+        result["caches"] = std::move(caches);
+
+        auto rates = nlohmann::json::object();
+        for (const auto &rate : wakeups::rates())
+                rates[rate.name] = rate.perSecond;
+        result["wakeups"] = std::move(rates);
+
+        return result;
+}
+
+void
+start()
+{
+        static QTimer *timer = nullptr;
+        if (timer || !QSettings().value("user/perf_snapshots", false).toBool())
+                return;
+
+        timer = new QTimer(QCoreApplication::instance());
+        timer->setInterval(SNAPSHOT_INTERVAL);
+        wakeups::manage(timer, "performance snapshots");
+        QObject::connect(timer, &QTimer::timeout, []() { appendSnapshot(); });
+        timer->start();
+}
+
+void
+writeReport(const QString &file)
+{
+        QFile out(file);
+        if (!out.open(QIODevice::WriteOnly | QIODevice::Truncate | QIODevice::Text)) {
+                nhlog::ui()->warn("failed to write the performance report to {}",
+                                  file.toStdString());
+                return;
+        }
+
+        out.write(QByteArray::fromStdString(snapshot().dump(2) + "\n"));
+}
+}
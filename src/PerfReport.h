@@ -0,0 +1,24 @@
+#pragma once
+
+#include <QString>
+
+#include <nlohmann/json.hpp>
+
+//! Machine readable snapshots of the numbers of the statistics pages: the latencies of the sync
+//! stages and the cache, the memory of every layer, the requests per category and the hit rates
+//! of the caches.
+//!
+//! With user/perf_snapshots enabled, a snapshot is appended to perf-snapshots.json in the log
+//! directory every few minutes, one per line. Nothing is sent anywhere.
+namespace perf {
+//! The numbers right now.
+nlohmann::json
+snapshot();
+//! Start the periodic snapshots, if they are enabled. Call it again after enabling them. Only
+//! call it from the main thread.
+void
+start();
+//! Write the current snapshot to file, e.g. on exit.
+void
+writeReport(const QString &file);
+}
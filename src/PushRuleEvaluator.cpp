@@ -0,0 +1,226 @@
+#include "PushRuleEvaluator.h"
+
+#include <variant>
+
+#include <mtx/pushrules.hpp>
+
+#include "Logging.h"
+
+namespace {
+//! Translate the glob of a push rule into a regular expression. A glob, which matches
+//! content.body, matches whole words, all other globs match the whole value.
+QRegularExpression
+globToRegex(const std::string &glob, bool words)
+{
+        QString regex;
+        for (const auto c : QString::fromStdString(glob)) {
+                if (c == '*')
+                        regex += ".*";
+                else if (c == '?')
+                        regex += ".";
+                else
+                        regex += QRegularExpression::escape(c);
+        }
+
+        regex = words ? QString("(^|\\W)%1($|\\W)").arg(regex) : QString("^%1$").arg(regex);
+        return QRegularExpression(regex,
+                                  QRegularExpression::CaseInsensitiveOption |
+                                    QRegularExpression::DotMatchesEverythingOption |
+                                    QRegularExpression::UseUnicodePropertiesOption);
+}
+
+//! The value at the dotted path of the event, if it is a string.
+const std::string *
+stringAt(const nlohmann::json &event, const std::vector<std::string> &key)
+{
+        const nlohmann::json *value = &event;
+        for (const auto &part : key) {
+                if (!value->is_object())
+                        return nullptr;
+
+                auto it = value->find(part);
+                if (it == value->end())
+                        return nullptr;
+                value = &*it;
+        }
+
+        return value->is_string() ? value->get_ptr<const std::string *>() : nullptr;
+}
+}
+
+PushRuleEvaluator::PushRuleEvaluator(const mtx::pushrules::GlobalRuleset &rules)
+{
+        const auto &global = rules.global;
+
+        for (const auto &rule : global.override_)
+                if (rule.enabled)
+                        rules_.push_back(compile(rule));
+
+        for (const auto &rule : global.content) {
+                if (!rule.enabled)
+                        continue;
+
+                auto compiled = compile(rule);
+                compiled.conditions.push_back(eventMatch("content.body", rule.pattern));
+                rules_.push_back(std::move(compiled));
+        }
+
+        // The room and sender rules are named by the room and the user they match.
+        for (const auto &rule : global.room) {
+                if (!rule.enabled)
+                        continue;
+
+                auto compiled = compile(rule);
+                compiled.conditions.push_back(eventMatch("room_id", rule.rule_id));
+                rules_.push_back(std::move(compiled));
+        }
+
+        for (const auto &rule : global.sender) {
+                if (!rule.enabled)
+                        continue;
+
+                auto compiled = compile(rule);
+                compiled.conditions.push_back(eventMatch("sender", rule.rule_id));
+                rules_.push_back(std::move(compiled));
+        }
+
+        for (const auto &rule : global.underride)
+                if (rule.enabled)
+                        rules_.push_back(compile(rule));
+
+        nhlog::net()->debug("compiled {} push rules", rules_.size());
+}
+
+PushRuleEvaluator::Rule
+PushRuleEvaluator::compile(const mtx::pushrules::PushRule &rule)
+{
+        using namespace mtx::pushrules;
+
+        Rule compiled;
+        for (const auto &action : rule.actions) {
+                if (std::holds_alternative<actions::notify>(action))
+                        compiled.actions.notify = true;
+                else if (auto highlight = std::get_if<actions::set_tweak_highlight>(&action))
+                        compiled.actions.highlight = highlight->value;
+        }
+
+        for (const auto &condition : rule.conditions) {
+                if (condition.kind == "event_match") {
+                        compiled.conditions.push_back(eventMatch(condition.key, condition.pattern));
+                } else if (condition.kind == "contains_display_name") {
+                        Condition c;
+                        c.kind = Condition::Kind::ContainsDisplayName;
+                        compiled.conditions.push_back(std::move(c));
+                } else if (condition.kind == "room_member_count") {
+                        // is looks like 2, ==2 or >=2.
+                        const auto is = QString::fromStdString(condition.is);
+                        int digits    = 0;
+                        while (digits < is.size() && !is[digits].isDigit())
+                                digits++;
+
+                        Condition c;
+                        c.kind       = Condition::Kind::RoomMemberCount;
+                        c.comparison = digits ? is.left(digits) : QString("==");
+                        c.count      = is.mid(digits).toInt();
+                        compiled.conditions.push_back(std::move(c));
+                } else if (condition.kind == "sender_notification_permission" &&
+                           condition.key == "room") {
+                        // room is the only kind of notification, which needs a power level.
+                        Condition c;
+                        c.kind = Condition::Kind::SenderNotificationPermission;
+                        compiled.conditions.push_back(std::move(c));
+                } else {
+                        compiled.conditions.push_back(Condition{});
+                }
+        }
+
+        return compiled;
+}
+
+PushRuleEvaluator::Condition
+PushRuleEvaluator::eventMatch(const std::string &key, const std::string &pattern)
+{
+        Condition c;
+        c.kind = Condition::Kind::EventMatch;
+
+        std::size_t start = 0;
+        for (auto dot = key.find('.'); dot != std::string::npos; dot = key.find('.', start)) {
+                c.key.push_back(key.substr(start, dot - start));
+                start = dot + 1;
+        }
+        c.key.push_back(key.substr(start));
+
+        c.pattern = globToRegex(pattern, key == "content.body");
+        return c;
+}
+
+bool
+PushRuleEvaluator::matches(const Condition &condition,
+                           const nlohmann::json &event,
+                           const Room &room)
+{
+        switch (condition.kind) {
+        case Condition::Kind::EventMatch: {
+                const auto value = stringAt(event, condition.key);
+                return value &&
+                       condition.pattern.match(QString::fromStdString(*value)).hasMatch();
+        }
+        case Condition::Kind::ContainsDisplayName: {
+                const auto body = stringAt(event, {"content", "body"});
+                if (!body || room.displayName.isEmpty())
+                        return false;
+
+                const QRegularExpression name(
+                  QString("(^|\\W)%1($|\\W)").arg(QRegularExpression::escape(room.displayName)),
+                  QRegularExpression::CaseInsensitiveOption |
+                    QRegularExpression::UseUnicodePropertiesOption);
+                return name.match(QString::fromStdString(*body)).hasMatch();
+        }
+        case Condition::Kind::RoomMemberCount: {
+                const auto &op    = condition.comparison;
+                const auto count  = room.memberCount;
+                const auto target = condition.count;
+                if (op == "<")
+                        return count < target;
+                if (op == ">")
+                        return count > target;
+                if (op == "<=")
+                        return count <= target;
+                if (op == ">=")
+                        return count >= target;
+                return count == target;
+        }
+        case Condition::Kind::SenderNotificationPermission:
+                return room.senderPowerLevel >= room.roomNotificationLevel;
+        case Condition::Kind::Unknown:
+                return false;
+        }
+
+        return false;
+}
+
+PushRuleEvaluator::Actions
+PushRuleEvaluator::evaluate(const mtx::events::collections::TimelineEvents &event,
+                            const Room &room) const
+{
+        auto json = std::visit([](const auto &e) { return nlohmann::json(e); }, event);
+
+        // The room rules and the rules muting a room match the room id.
+        if (!room.id.empty())
+                json["room_id"] = room.id;
+
+        for (const auto &rule : rules_) {
+                bool matched = true;
+                for (const auto &condition : rule.conditions) {
+                        if (!matches(condition, json, room)) {
+                                matched = false;
+                                break;
+                        }
+                }
+
+                if (matched)
+                        return rule.actions;
+        }
+
+        return {};
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <QRegularExpression>
+
+#include <mtx/events/collections.hpp>
+#include <nlohmann/json.hpp>
+
+namespace mtx::pushrules {
+struct GlobalRuleset;
+struct PushRule;
+}
+
+//! Evaluates the push rules of the account against the events of a sync, so the notifications
+//! and mentions don't have to be requested from the server, and encrypted messages are evaluated
+//! with their plaintext.
+//!
+//! The rules are compiled into matchers once, when they change. Evaluating doesn't change the
+//! evaluator, so one can be shared by the threads.
+class PushRuleEvaluator
+{
+public:
+        struct Actions
+        {
+                bool notify    = false;
+                bool highlight = false;
+        };
+
+        //! What the conditions know about the room of an event.
+        struct Room
+        {
+                //! The id of the room, which the events of a sync don't contain.
+                std::string id;
+                //! The display name of the local user in the room.
+                QString displayName;
+                int memberCount = 0;
+                //! The power level of the sender of the evaluated event.
+                int64_t senderPowerLevel = 0;
+                //! The power level needed to notify the whole room, notifications.room of the
+                //! power levels.
+                int64_t roomNotificationLevel = 0;
+        };
+
+        explicit PushRuleEvaluator(const mtx::pushrules::GlobalRuleset &rules);
+
+        //! The actions of the first enabled rule, which matches the event. None, if no rule does.
+        Actions evaluate(const mtx::events::collections::TimelineEvents &event,
+                         const Room &room) const;
+
+private:
+        struct Condition
+        {
+                enum class Kind
+                {
+                        EventMatch,
+                        ContainsDisplayName,
+                        RoomMemberCount,
+                        //! Whether the power level of the sender is enough to notify the whole
+                        //! room.
+                        SenderNotificationPermission,
+                        //! A condition of a newer spec, which is never met.
+                        Unknown,
+                };
+
+                Kind kind = Kind::Unknown;
+                //! The field of the event, split at the dots, e.g. content and body.
+                std::vector<std::string> key;
+                QRegularExpression pattern;
+                //! The comparison of the member count, e.g. >= and 2.
+                QString comparison;
+                int count = 0;
+        };
+
+        struct Rule
+        {
+                std::vector<Condition> conditions;
+                Actions actions;
+        };
+
+        static Rule compile(const mtx::pushrules::PushRule &rule);
+        static Condition eventMatch(const std::string &key, const std::string &pattern);
+        static bool matches(const Condition &condition,
+                            const nlohmann::json &event,
+                            const Room &room);
+
+        //! The enabled rules in the order of their kinds: override, content, room, sender and
+        //! underride. The content, room and sender rules are compiled into event_match
+        //! conditions.
+        std::vector<Rule> rules_;
+};
@@ -0,0 +1,146 @@
+#include "PushRules.h"
+
+#include <atomic>
+#include <memory>
+
+#include <mtx/pushrules.hpp>
+
+#include "Logging.h"
+#include "MatrixClient.h"
+#include "PushRuleEvaluator.h"
+
+Q_DECLARE_METATYPE(mtx::pushrules::GlobalRuleset)
+
+PushRules::PushRules(QObject *parent)
+  : QObject(parent)
+{
+        qRegisterMetaType<mtx::pushrules::GlobalRuleset>();
+
+        connect(this, &PushRules::rulesetRetrieved, this, &PushRules::setRuleset);
+}
+
+void
+PushRules::fetch()
+{
+        http::client()->get_pushrules(
+          [this](const mtx::pushrules::GlobalRuleset &rules, mtx::http::RequestErr err) {
+                  if (err) {
+                          nhlog::net()->warn("failed to fetch the push rules: {} {}",
+                                             static_cast<int>(err->status_code),
+                                             err->matrix_error.error);
+                          return;
+                  }
+
+                  emit rulesetRetrieved(rules);
+          });
+}
+
+void
+PushRules::setRuleset(const mtx::pushrules::GlobalRuleset &rules)
+{
+        // The rules of a room are named by its id.
+        overrideRules_.clear();
+        for (const auto &rule : rules.global.override_)
+                overrideRules_.insert(QString::fromStdString(rule.rule_id), rule.enabled);
+
+        roomRules_.clear();
+        for (const auto &rule : rules.global.room)
+                roomRules_.insert(QString::fromStdString(rule.rule_id), rule.enabled);
+
+        auto evaluator = std::make_shared<const PushRuleEvaluator>(rules);
+        {
+                std::lock_guard lock(evaluatorMutex_);
+                evaluator_ = std::move(evaluator);
+        }
+
+        loaded_ = true;
+        emit rulesChanged();
+}
+
+std::shared_ptr<const PushRuleEvaluator>
+PushRules::evaluator() const
+{
+        std::lock_guard lock(evaluatorMutex_);
+        return evaluator_;
+}
+
+PushRules::RoomLevel
+PushRules::roomLevel(const QString &room_id) const
+{
+        if (auto rule = overrideRules_.constFind(room_id); rule != overrideRules_.constEnd())
+                return *rule ? RoomLevel::Muted : RoomLevel::AllMessages;
+
+        if (roomRules_.value(room_id, false))
+                return RoomLevel::MentionsOnly;
+
+        return RoomLevel::AllMessages;
+}
+
+void
+PushRules::setRoomLevel(const QString &room_id, RoomLevel level)
+{
+        const auto id = room_id.toStdString();
+
+        auto logError = [id](mtx::http::RequestErr &err) {
+                if (err)
+                        nhlog::net()->error("failed to change a pushrule of room {}: {} {}",
+                                            id,
+                                            static_cast<int>(err->status_code),
+                                            err->matrix_error.error);
+        };
+
+        const bool hasOverride = overrideRules_.contains(room_id);
+        const bool hasRoom     = roomRules_.contains(room_id);
+
+        // The requests of a change are independent of each other. The rules are fetched again,
+        // once all of them are done.
+        auto pending = std::make_shared<std::atomic_int>(0);
+        auto done    = [this, pending, logError](mtx::http::RequestErr &err) {
+                logError(err);
+                if (--*pending == 0)
+                        fetch();
+        };
+
+        mtx::pushrules::PushRule rule;
+        rule.actions = {mtx::pushrules::actions::dont_notify{}};
+
+        switch (level) {
+        case RoomLevel::Muted: {
+                mtx::pushrules::PushCondition condition;
+                condition.kind    = "event_match";
+                condition.key     = "room_id";
+                condition.pattern = id;
+                rule.conditions   = {condition};
+
+                *pending = hasRoom ? 2 : 1;
+                http::client()->put_pushrules("global", "override", id, rule, done);
+                if (hasRoom)
+                        http::client()->delete_pushrules("global", "room", id, done);
+
+                overrideRules_.insert(room_id, true);
+                roomRules_.remove(room_id);
+                break;
+        }
+        case RoomLevel::MentionsOnly:
+                *pending = hasOverride ? 2 : 1;
+                http::client()->put_pushrules("global", "room", id, rule, done);
+                if (hasOverride)
+                        http::client()->delete_pushrules("global", "override", id, done);
+
+                roomRules_.insert(room_id, true);
+                overrideRules_.remove(room_id);
+                break;
+        case RoomLevel::AllMessages:
+                *pending = (hasOverride ? 1 : 0) + (hasRoom ? 1 : 0);
+                if (hasOverride)
+                        http::client()->delete_pushrules("global", "override", id, done);
+                if (hasRoom)
+                        http::client()->delete_pushrules("global", "room", id, done);
+
+                overrideRules_.remove(room_id);
+                roomRules_.remove(room_id);
+                break;
+        }
+
+        emit rulesChanged();
+}
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+
+#include <QHash>
+#include <QObject>
+#include <QString>
+
+namespace mtx::pushrules {
+struct GlobalRuleset;
+}
+
+class PushRuleEvaluator;
+
+//! The push rules of the account, as far as they decide the notification level of the rooms.
+//!
+//! The rules are fetched once after the login and kept up to date by the changes of the client,
+//! so the room settings open without waiting for the server. A change is sent as one batch of
+//! parallel requests and the rules are fetched again afterwards, in case one of them failed.
+//!
+//! The rules are compiled into an evaluator, whenever they change, so the notifications of a sync
+//! are decided locally.
+class PushRules : public QObject
+{
+        Q_OBJECT
+
+public:
+        //! The notification levels of a room, in the order of the room settings.
+        enum class RoomLevel
+        {
+                Muted        = 0,
+                MentionsOnly = 1,
+                AllMessages  = 2,
+        };
+
+        explicit PushRules(QObject *parent = nullptr);
+
+        //! Fetch the rules of the account. Safe from any thread.
+        void fetch();
+        //! Whether the rules were fetched once.
+        bool loaded() const { return loaded_; }
+
+        RoomLevel roomLevel(const QString &room_id) const;
+        void setRoomLevel(const QString &room_id, RoomLevel level);
+
+        //! The compiled rules, null until they were fetched. Safe from any thread.
+        std::shared_ptr<const PushRuleEvaluator> evaluator() const;
+
+signals:
+        void rulesChanged();
+        void rulesetRetrieved(const mtx::pushrules::GlobalRuleset &rules);
+
+private:
+        void setRuleset(const mtx::pushrules::GlobalRuleset &rules);
+
+        bool loaded_ = false;
+        //! Whether the override and room rules of the rooms are enabled by room id. Rooms without
+        //! a rule aren't in them.
+        QHash<QString, bool> overrideRules_;
+        QHash<QString, bool> roomRules_;
+
+        mutable std::mutex evaluatorMutex_;
+        std::shared_ptr<const PushRuleEvaluator> evaluator_;
+};
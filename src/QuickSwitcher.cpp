@@ -16,11 +16,11 @@
  */
 
 #include <QCompleter>
+#include <QDebug>
 #include <QPainter>
 #include <QStringListModel>
 #include <QStyleOption>
 #include <QTimer>
-#include <QtConcurrent>
 
 #include "Cache.h"
 #include "QuickSwitcher.h"
@@ -28,6 +28,9 @@
 
 Q_DECLARE_METATYPE(std::vector<RoomSearchResult>)
 
+//! The number of rooms the popup suggests.
+constexpr std::size_t MAX_RESULTS = 5;
+
 RoomSearchInput::RoomSearchInput(QWidget *parent)
   : TextField(parent)
 {}
@@ -76,6 +79,12 @@ QuickSwitcher::QuickSwitcher(QWidget *parent)
         topLayout_ = new QVBoxLayout(this);
         topLayout_->addWidget(roomSearch_);
 
+        try {
+                matcher_.setRooms(cache::roomInfo(false));
+        } catch (const lmdb::error &e) {
+                qWarning() << "failed to load the rooms for the quick switcher:" << e.what();
+        }
+
         connect(this,
                 &QuickSwitcher::queryResults,
                 this,
@@ -86,6 +95,9 @@ QuickSwitcher::QuickSwitcher(QWidget *parent)
                         popup_.addRooms(rooms);
                         popup_.move(pos.x() - topLayout_->margin(), pos.y() + topLayout_->margin());
                         popup_.show();
+
+                        if (!rooms.empty())
+                                emit prefetchRoom(QString::fromStdString(rooms.front().room_id));
                 });
 
         connect(roomSearch_, &QLineEdit::textEdited, this, [this](const QString &query) {
@@ -94,13 +106,9 @@ QuickSwitcher::QuickSwitcher(QWidget *parent)
                         return;
                 }
 
-                QtConcurrent::run([this, query = query.toLower()]() {
-                        try {
-                                emit queryResults(cache::searchRooms(query.toStdString()));
-                        } catch (const lmdb::error &e) {
-                                qWarning() << "room search failed:" << e.what();
-                        }
-                });
+                // Matching is cheap enough to stay on the GUI thread, so the results of the
+                // keystrokes can't arrive out of order.
+                emit queryResults(matcher_.match(query, MAX_RESULTS));
         });
 
         connect(roomSearch_,
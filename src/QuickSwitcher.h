@@ -22,6 +22,7 @@
 #include <QVBoxLayout>
 #include <QWidget>
 
+#include "RoomMatcher.h"
 #include "popups/SuggestionsPopup.h"
 #include "ui/TextField.h"
 
@@ -52,6 +53,8 @@ public:
 signals:
         void closing();
         void roomSelected(const QString &roomid);
+        //! The best match of the query, which is likely selected.
+        void prefetchRoom(const QString &roomid);
         void queryResults(const std::vector<RoomSearchResult> &rooms);
 
 protected:
@@ -69,6 +72,9 @@ private:
         // Current highlighted selection from the completer.
         int selection_ = -1;
 
+        //! Matches the rooms as of the opening of the switcher.
+        RoomMatcher matcher_;
+
         QVBoxLayout *topLayout_;
         RoomSearchInput *roomSearch_;
 
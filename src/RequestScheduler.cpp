@@ -0,0 +1,232 @@
+#include "RequestScheduler.h"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+#include <QCoreApplication>
+#include <QTimer>
+
+#include "Logging.h"
+#include "NetworkUsage.h"
+
+using namespace std::chrono_literals;
+
+constexpr std::size_t CLASSES = 4;
+//! How many requests of the classes, which are not media, run at once.
+constexpr std::array<int, CLASSES> MAX_RUNNING = {8, 4, 0, 0};
+//! How many media requests of both media classes run at once, unless the user configured it.
+constexpr int DEFAULT_MAX_RUNNING_MEDIA = 6;
+//! The share of the media budget the background requests may take.
+constexpr int BACKGROUND_SHARE = 3;
+//! The pause of a class after a rate limited request. It doubles with every rate limit in a row.
+//! mtxclient doesn't hand out the retry_after_ms of the error, so it is always estimated.
+constexpr std::chrono::milliseconds RATE_LIMIT_DELAY     = 1s;
+constexpr std::chrono::milliseconds MAX_RATE_LIMIT_DELAY = 60s;
+
+namespace {
+struct Queued
+{
+        http::RequestId id = 0;
+        http::Request request;
+        std::function<void()> cancelled;
+};
+
+std::mutex mutex_;
+std::array<std::deque<Queued>, CLASSES> queues_;
+std::array<int, CLASSES> running_{};
+//! A rate limited class doesn't start requests until then.
+std::array<std::chrono::steady_clock::time_point, CLASSES> pausedUntil_{};
+std::array<int, CLASSES> rateLimits_{};
+http::RequestId nextId_ = 1;
+int maxRunningMedia_    = DEFAULT_MAX_RUNNING_MEDIA;
+
+bool
+isMedia(std::size_t priority)
+{
+        return priority >= static_cast<std::size_t>(http::Priority::Visible);
+}
+
+//! How many requests of the class run at once. Needs the mutex.
+int
+maxRunning(std::size_t priority)
+{
+        switch (static_cast<http::Priority>(priority)) {
+        case http::Priority::Visible:
+                return maxRunningMedia_;
+        case http::Priority::Background:
+                return std::max(1, maxRunningMedia_ / BACKGROUND_SHARE);
+        default:
+                return MAX_RUNNING[priority];
+        }
+}
+
+void
+dispatch();
+}
+
+namespace http {
+struct RequestSlot::State
+{
+        std::size_t priority;
+        Queued queued;
+        bool rateLimited = false;
+
+        //! Free the slot or queue the request again, if it was rate limited.
+        ~State()
+        {
+                std::chrono::milliseconds delay{0};
+                {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        running_[priority]--;
+
+                        if (rateLimited) {
+                                const int doublings = std::min(rateLimits_[priority]++, 6);
+                                delay = std::min<std::chrono::milliseconds>(
+                                  RATE_LIMIT_DELAY * (1 << doublings), MAX_RATE_LIMIT_DELAY);
+                                pausedUntil_[priority] = std::chrono::steady_clock::now() + delay;
+                                queues_[priority].push_front(std::move(queued));
+                        } else {
+                                rateLimits_[priority] = 0;
+                        }
+                }
+
+                if (!rateLimited) {
+                        dispatch();
+                        return;
+                }
+
+                nhlog::net()->warn("rate limited, pausing the requests of class {} for {} ms",
+                                   priority,
+                                   delay.count());
+
+                // The callbacks run on the threads of mtxclient, which have no event loop.
+                QMetaObject::invokeMethod(
+                  QCoreApplication::instance(),
+                  [delay]() { QTimer::singleShot(delay, QCoreApplication::instance(), dispatch); },
+                  Qt::QueuedConnection);
+        }
+};
+
+bool
+RequestSlot::retry(mtx::http::RequestErr err) const
+{
+        if (!err || static_cast<int>(err->status_code) != 429)
+                return false;
+
+        state_->rateLimited = true;
+        return true;
+}
+
+RequestId
+schedule(Priority priority, Request request, std::function<void()> cancelled)
+{
+        RequestId id;
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+                id = nextId_++;
+                queues_[static_cast<std::size_t>(priority)].push_back(
+                  {id, std::move(request), std::move(cancelled)});
+        }
+
+        dispatch();
+        return id;
+}
+
+void
+resume()
+{
+        dispatch();
+}
+
+void
+setMaxDownloads(int count)
+{
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+                maxRunningMedia_ = std::max(1, count);
+        }
+
+        // A larger budget starts the waiting requests right away.
+        dispatch();
+}
+
+bool
+cancel(RequestId id)
+{
+        Queued dropped;
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+                for (auto &queue : queues_) {
+                        auto it = std::find_if(queue.begin(), queue.end(), [id](const Queued &q) {
+                                return q.id == id;
+                        });
+                        if (it != queue.end()) {
+                                dropped = std::move(*it);
+                                queue.erase(it);
+                                break;
+                        }
+                }
+        }
+
+        if (!dropped.id)
+                return false;
+
+        if (dropped.cancelled)
+                dropped.cancelled();
+        return true;
+}
+}
+
+namespace {
+//! Start the queued requests, which fit into the limits, most urgent first.
+void
+dispatch()
+{
+        std::vector<std::shared_ptr<http::RequestSlot::State>> starting;
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+                const auto now = std::chrono::steady_clock::now();
+
+                int media = 0;
+                for (std::size_t priority = 0; priority < CLASSES; priority++)
+                        if (isMedia(priority))
+                                media += running_[priority];
+
+                for (std::size_t priority = 0; priority < CLASSES; priority++) {
+                        if (pausedUntil_[priority] > now)
+                                continue;
+                        if (static_cast<http::Priority>(priority) == http::Priority::Background &&
+                            http::overTrafficBudget())
+                                continue;
+
+                        auto &queue = queues_[priority];
+                        while (!queue.empty() && running_[priority] < maxRunning(priority) &&
+                               (!isMedia(priority) || media < maxRunningMedia_)) {
+                                auto state      = std::make_shared<http::RequestSlot::State>();
+                                state->priority = priority;
+                                state->queued   = std::move(queue.front());
+                                queue.pop_front();
+
+                                running_[priority]++;
+                                if (isMedia(priority))
+                                        media++;
+                                starting.push_back(std::move(state));
+                        }
+
+                        // The prefetches wait, while media in view does.
+                        if (isMedia(priority) && !queue.empty())
+                                break;
+                }
+        }
+
+        // Outside of the lock, since a request may finish right away.
+        for (auto &state : starting) {
+                auto request = state->queued.request;
+                request(http::RequestSlot(std::move(state)));
+        }
+}
+}
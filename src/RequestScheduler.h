@@ -0,0 +1,68 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <utility>
+
+#include <mtxclient/http/client.hpp>
+
+//! Decides, which requests to the homeserver run at the same time.
+//!
+//! Every request belongs to a class. A class only runs a few requests at once, and the media
+//! classes share a budget, in which a less urgent request only starts, while no more urgent one
+//! waits. So a flood of avatars on startup neither delays the media in view nor a pagination. A
+//! rate limited request is queued again and its class pauses with an exponential backoff.
+namespace http {
+//! The classes of the requests, most urgent first.
+enum class Priority
+{
+        //! Requests the user waits for, e.g. a pagination.
+        Interactive,
+        //! Requests of the sync processing, e.g. the keys of changed devices.
+        Sync,
+        //! Media, which is shown right now.
+        Visible,
+        //! Prefetches and other requests nobody waits for. They pause, while the traffic exceeds
+        //! its budget.
+        Background,
+};
+
+using RequestId = uint64_t;
+
+//! Held by a running request. Its slot is free again, once the last copy is destroyed, which is
+//! usually the callback of the request, after it ran.
+class RequestSlot
+{
+public:
+        //! Queue the request again, if the server rate limited it. The callback should return
+        //! without handling the error then.
+        bool retry(mtx::http::RequestErr err) const;
+
+        struct State;
+        explicit RequestSlot(std::shared_ptr<State> state)
+          : state_(std::move(state))
+        {}
+
+private:
+        std::shared_ptr<State> state_;
+};
+
+//! Starts the request with a slot, which its callback holds.
+using Request = std::function<void(RequestSlot slot)>;
+
+//! Queue a request. It starts, once its class has a free slot. Safe from any thread.
+RequestId
+schedule(Priority priority, Request request, std::function<void()> cancelled = {});
+//! Start the queued requests, which may run now, e.g. once the traffic budget of a new hour
+//! allows the background requests again.
+void
+resume();
+//! Limit how many media requests of both media classes run at once. The default is 6.
+void
+setMaxDownloads(int count);
+//! Drop a request, which didn't start yet, and call its cancelled callback. Returns false, if it
+//! already started.
+bool
+cancel(RequestId id);
+}
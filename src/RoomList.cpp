@@ -15,22 +15,33 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <limits>
-#include <set>
+#include <algorithm>
 
+#include <QElapsedTimer>
 #include <QObject>
 #include <QPainter>
+#include <QScrollBar>
 #include <QScroller>
 #include <QTimer>
+#include <QtConcurrent>
 
+#include "AvatarProvider.h"
+#include "Cache.h"
 #include "Logging.h"
 #include "MainWindow.h"
-#include "RoomInfoListItem.h"
 #include "RoomList.h"
+#include "RoomListModel.h"
+#include "RoomListView.h"
+#include "Startup.h"
 #include "UserSettingsPage.h"
 #include "Utils.h"
 #include "ui/OverlayModal.h"
 
+//! The time, which adding the pending rooms may take per iteration of the event loop.
+constexpr qint64 POPULATE_BUDGET_MS = 8;
+//! The rooms, which are added at once.
+constexpr std::size_t POPULATE_CHUNK = 32;
+
 RoomList::RoomList(QSharedPointer<UserSettings> userSettings, QWidget *parent)
   : QWidget(parent)
   , settings(userSettings)
@@ -39,56 +50,104 @@ RoomList::RoomList(QSharedPointer<UserSettings> userSettings, QWidget *parent)
         topLayout_->setSpacing(0);
         topLayout_->setMargin(0);
 
-        scrollArea_ = new QScrollArea(this);
-        scrollArea_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-        scrollArea_->setSizeAdjustPolicy(QAbstractScrollArea::AdjustToContents);
-        scrollArea_->setWidgetResizable(true);
-        scrollArea_->setAlignment(Qt::AlignLeading | Qt::AlignTop | Qt::AlignVCenter);
+        // Only the rooms in view are painted, so the list doesn't need a widget per room.
+        model_       = new RoomListModel(userSettings, this);
+        filterModel_ = new RoomListFilterModel(this);
+        filterModel_->setSourceModel(model_);
+
+        view_ = new RoomListView(userSettings, this);
+        view_->setObjectName("roomlist_area");
+        view_->setModel(filterModel_);
+        view_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 
-        QScroller::grabGesture(scrollArea_, QScroller::TouchGesture);
+        QScroller::grabGesture(view_, QScroller::TouchGesture);
 
         // The scrollbar on macOS will hide itself when not active so it won't interfere
         // with the content.
 #if not defined(Q_OS_MAC)
-        scrollArea_->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+        view_->setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
 #endif
 
-        scrollAreaContents_ = new QWidget(this);
-        scrollAreaContents_->setObjectName("roomlist_area");
+        topLayout_->addWidget(view_);
 
-        contentsLayout_ = new QVBoxLayout(scrollAreaContents_);
-        contentsLayout_->setAlignment(Qt::AlignTop);
-        contentsLayout_->setSpacing(0);
-        contentsLayout_->setMargin(0);
-
-        scrollArea_->setWidget(scrollAreaContents_);
-        topLayout_->addWidget(scrollArea_);
+        connect(view_, &RoomListView::roomClicked, this, &RoomList::highlightSelectedRoom);
+        connect(view_, &RoomListView::leaveRoom, this, [](const QString &room_id) {
+                MainWindow::instance()->openLeaveRoomDialog(room_id);
+        });
+        connect(view_, &RoomListView::acceptInvite, this, &RoomList::acceptInvite);
+        connect(view_, &RoomListView::declineInvite, this, &RoomList::declineInvite);
+        connect(view_, &RoomListView::roomHovered, this, &RoomList::prefetchRoom);
+
+        prefetchTimer_ = new QTimer(this);
+        prefetchTimer_->setSingleShot(true);
+        prefetchTimer_->setInterval(100);
+        connect(prefetchTimer_, &QTimer::timeout, this, &RoomList::prefetch);
+        connect(view_->verticalScrollBar(),
+                &QScrollBar::valueChanged,
+                prefetchTimer_,
+                static_cast<void (QTimer::*)()>(&QTimer::start));
+
+        populateTimer_ = new QTimer(this);
+        populateTimer_->setSingleShot(true);
+        populateTimer_->setInterval(0);
+        connect(populateTimer_, &QTimer::timeout, this, &RoomList::addPendingRooms);
 
         connect(this, &RoomList::updateRoomAvatarCb, this, &RoomList::updateRoomAvatar);
-        connect(userSettings.data(),
-                &UserSettings::roomSortingChanged,
-                this,
-                &RoomList::sortRoomsByLastMessage);
+        connect(userSettings.data(), &UserSettings::roomSortingChanged, this, [this]() {
+                model_->resort();
+        });
+}
+
+bool
+RoomList::roomExists(const QString &room_id) const
+{
+        return model_->contains(room_id);
+}
+
+bool
+RoomList::ensureRoom(const QString &room_id)
+{
+        if (roomExists(room_id))
+                return true;
+
+        auto it = pendingRooms_.find(room_id);
+        if (it == pendingRooms_.end())
+                return false;
+
+        const auto info = it.value();
+        addRoom(room_id, info);
+        return true;
 }
 
 void
-RoomList::addRoom(const QString &room_id, const RoomInfo &info)
+RoomList::clearPendingRooms()
 {
-        auto room_item = new RoomInfoListItem(room_id, info, settings, scrollArea_);
-        room_item->setRoomName(QString::fromStdString(std::move(info.name)));
+        populateTimer_->stop();
+        pendingRooms_.clear();
+        pendingOrder_.clear();
+        nextPending_ = 0;
+        pendingReadStatus_.clear();
+}
 
-        connect(room_item, &RoomInfoListItem::clicked, this, &RoomList::highlightSelectedRoom);
-        connect(room_item, &RoomInfoListItem::leaveRoom, this, [](const QString &room_id) {
-                MainWindow::instance()->openLeaveRoomDialog(room_id);
-        });
+void
+RoomList::clear()
+{
+        clearPendingRooms();
+        model_->clear();
+}
 
-        rooms_.emplace(room_id, QSharedPointer<RoomInfoListItem>(room_item));
+void
+RoomList::addRoom(const QString &room_id, const RoomInfo &info)
+{
+        pendingRooms_.remove(room_id);
+        model_->addRoom(room_id, info);
+        if (auto status = pendingReadStatus_.find(room_id); status != pendingReadStatus_.end()) {
+                model_->setReadState(room_id, status.value());
+                pendingReadStatus_.erase(status);
+        }
 
         if (!info.avatar_url.empty())
                 updateAvatar(room_id, QString::fromStdString(info.avatar_url));
-
-        int pos = contentsLayout_->count() - 1;
-        contentsLayout_->insertWidget(pos, room_item);
 }
 
 void
@@ -97,35 +156,82 @@ RoomList::updateAvatar(const QString &room_id, const QString &url)
         emit updateRoomAvatarCb(room_id, url);
 }
 
+void
+RoomList::prefetch()
+{
+        // The rooms within one screenful above and below the visible ones.
+        const auto viewport = view_->viewport()->rect();
+        const auto first    = view_->indexAt(viewport.topLeft());
+        if (!first.isValid())
+                return;
+
+        auto last = view_->indexAt(viewport.bottomLeft());
+        if (!last.isValid())
+                last = filterModel_->index(filterModel_->rowCount() - 1, 0);
+
+        const auto screen = last.row() - first.row() + 1;
+        const auto from   = std::max(0, first.row() - screen);
+        const auto to     = std::min(filterModel_->rowCount() - 1, last.row() + screen);
+
+        std::vector<std::pair<QString, int>> avatars;
+        for (int row = from; row <= to; row++) {
+                const auto url =
+                  filterModel_->index(row, 0).data(RoomListModel::AvatarUrl).toString();
+                if (!url.isEmpty())
+                        avatars.emplace_back(url, view_->avatarSize());
+        }
+
+        AvatarProvider::prefetch(avatars);
+
+        std::vector<QString> rooms;
+        for (int row = first.row(); row <= last.row(); row++) {
+                // Invites have no member db.
+                const auto index = filterModel_->index(row, 0);
+                if (!index.data(RoomListModel::IsInvite).toBool())
+                        rooms.push_back(index.data(RoomListModel::RoomId).toString());
+        }
+
+        // Reading the members of a big room takes a while, so the first lookups of the timeline
+        // shouldn't do it in the GUI thread.
+        QtConcurrent::run([rooms = std::move(rooms)]() { cache::loadMembers(rooms); });
+}
+
 void
 RoomList::removeRoom(const QString &room_id, bool reset)
 {
-        rooms_.erase(room_id);
+        pendingRooms_.remove(room_id);
 
-        if (rooms_.empty() || !reset)
-                return;
+        const auto total = model_->totalUnreadCount();
+        model_->removeRoom(room_id);
+        if (model_->totalUnreadCount() != total)
+                calculateUnreadMessageCount();
 
-        auto room = firstRoom();
+        if (model_->rowCount() == 0 || !reset)
+                return;
 
-        if (room.second.isNull())
+        const auto room = firstRoom();
+        if (room.isEmpty())
                 return;
 
-        room.second->setPressedState(true);
-        emit roomChanged(room.first);
+        view_->setSelectedRoom(room);
+        selectedRoom_ = room;
+        emit roomChanged(room);
 }
 
 void
 RoomList::updateUnreadMessageCount(const QString &roomid, int count, int highlightedCount)
 {
-        if (!roomExists(roomid)) {
+        if (!ensureRoom(roomid)) {
                 nhlog::ui()->warn("updateUnreadMessageCount: unknown room_id {}",
                                   roomid.toStdString());
                 return;
         }
 
-        rooms_[roomid]->updateUnreadMessageCount(count, highlightedCount);
-
-        calculateUnreadMessageCount();
+        // Only a changed total updates the tray icon and the window title.
+        const auto total = model_->totalUnreadCount();
+        model_->setUnreadCount(roomid, count, highlightedCount);
+        if (model_->totalUnreadCount() != total)
+                calculateUnreadMessageCount();
 
         sortRoomsByLastMessage();
 }
@@ -133,14 +239,7 @@ RoomList::updateUnreadMessageCount(const QString &roomid, int count, int highlig
 void
 RoomList::calculateUnreadMessageCount()
 {
-        int total_unread_msgs = 0;
-
-        for (const auto &room : rooms_) {
-                if (!room.second.isNull())
-                        total_unread_msgs += room.second->unreadMessageCount();
-        }
-
-        emit totalUnreadMessageCountUpdated(total_unread_msgs);
+        emit totalUnreadMessageCountUpdated(model_->totalUnreadCount());
 }
 
 void
@@ -148,50 +247,62 @@ RoomList::initialize(const QMap<QString, RoomInfo> &info)
 {
         nhlog::ui()->info("initialize room list");
 
-        rooms_.clear();
-
-        setUpdatesEnabled(false);
+        clearPendingRooms();
+        model_->clear();
 
+        // The unread counts aren't known yet, so the rooms are in the order of the list without
+        // them: invites first, then the most recent.
+        struct Key
+        {
+                QString room_id;
+                bool is_invite;
+                qint64 recency;
+        };
+        std::vector<Key> keys;
+        keys.reserve(info.size());
         for (auto it = info.begin(); it != info.end(); it++) {
-                if (it.value().is_invite)
-                        addInvitedRoom(it.key(), it.value());
-                else
-                        addRoom(it.key(), it.value());
+                const auto &msg = it.value().msgInfo;
+                keys.push_back({it.key(),
+                                it.value().is_invite,
+                                msg.userid.isEmpty() ? 0 : msg.datetime.toMSecsSinceEpoch()});
         }
+        std::stable_sort(keys.begin(), keys.end(), [](const Key &a, const Key &b) {
+                if (a.is_invite != b.is_invite)
+                        return a.is_invite;
+                return a.recency > b.recency;
+        });
 
-        for (auto it = info.begin(); it != info.end(); it++)
-                updateRoomDescription(it.key(), it.value().msgInfo);
+        pendingRooms_ = info;
+        pendingOrder_.reserve(keys.size());
+        for (auto &key : keys)
+                pendingOrder_.push_back(std::move(key.room_id));
 
-        setUpdatesEnabled(true);
+        // The first rooms are shown with the first frame.
+        addPendingRooms();
+        startup::reached(startup::Milestone::RoomListShown);
 
-        if (rooms_.empty())
+        if (model_->rowCount() == 0)
                 return;
 
-        sortRoomsByLastMessage();
-
-        auto room = firstRoom();
-        if (room.second.isNull())
+        const auto room = firstRoom();
+        if (room.isEmpty())
                 return;
 
-        room.second->setPressedState(true);
-        emit roomChanged(room.first);
+        view_->setSelectedRoom(room);
+        selectedRoom_ = room;
+        emit roomChanged(room);
 }
 
 void
-RoomList::cleanupInvites(const std::map<QString, bool> &invites)
+RoomList::removeInvites(const std::vector<QString> &room_ids)
 {
-        if (invites.size() == 0)
-                return;
-
-        utils::erase_if(rooms_, [invites](auto &room) {
-                auto room_id = room.first;
-                auto item    = room.second;
-
-                if (!item)
-                        return false;
+        for (const auto &room_id : room_ids) {
+                auto pending = pendingRooms_.find(room_id);
+                if (pending != pendingRooms_.end() && pending.value().is_invite)
+                        pendingRooms_.erase(pending);
+        }
 
-                return item->isInvite() && (invites.find(room_id) == invites.end());
-        });
+        model_->removeInvites(room_ids);
 }
 
 void
@@ -210,102 +321,65 @@ RoomList::highlightSelectedRoom(const QString &room_id)
 {
         emit roomChanged(room_id);
 
-        if (!roomExists(room_id)) {
+        if (!ensureRoom(room_id)) {
                 nhlog::ui()->warn("roomlist: clicked unknown room_id");
                 return;
         }
 
-        for (auto const &room : rooms_) {
-                if (room.second.isNull())
-                        continue;
-
-                if (room.first != room_id) {
-                        room.second->setPressedState(false);
-                } else {
-                        room.second->setPressedState(true);
-                        scrollArea_->ensureWidgetVisible(room.second.data());
-                }
-        }
+        view_->setSelectedRoom(room_id);
+        view_->scrollTo(filterModel_->indexOf(room_id));
 
         selectedRoom_ = room_id;
 }
 
 void
-RoomList::nextRoom()
+RoomList::selectNeighbour(int offset)
 {
-        for (int ii = 0; ii < contentsLayout_->count() - 1; ++ii) {
-                auto room = qobject_cast<RoomInfoListItem *>(contentsLayout_->itemAt(ii)->widget());
+        const auto current = filterModel_->indexOf(selectedRoom_);
+        if (!current.isValid())
+                return;
 
-                if (!room)
-                        continue;
+        const auto next = filterModel_->index(current.row() + offset, 0);
 
-                if (room->roomId() == selectedRoom_) {
-                        auto nextRoom = qobject_cast<RoomInfoListItem *>(
-                          contentsLayout_->itemAt(ii + 1)->widget());
+        // Not a room message.
+        if (!next.isValid() || next.data(RoomListModel::IsInvite).toBool())
+                return;
 
-                        // Not a room message.
-                        if (!nextRoom || nextRoom->isInvite())
-                                return;
+        const auto room_id = next.data(RoomListModel::RoomId).toString();
+        emit roomChanged(room_id);
 
-                        emit roomChanged(nextRoom->roomId());
-                        if (!roomExists(nextRoom->roomId())) {
-                                nhlog::ui()->warn("roomlist: clicked unknown room_id");
-                                return;
-                        }
+        view_->setSelectedRoom(room_id);
+        view_->scrollTo(next);
+        selectedRoom_ = room_id;
 
-                        room->setPressedState(false);
-                        nextRoom->setPressedState(true);
+        // The next key press likely goes on in the same direction.
+        const auto ahead = filterModel_->index(next.row() + offset, 0);
+        if (ahead.isValid() && !ahead.data(RoomListModel::IsInvite).toBool())
+                emit prefetchRoom(ahead.data(RoomListModel::RoomId).toString());
+}
 
-                        scrollArea_->ensureWidgetVisible(nextRoom);
-                        selectedRoom_ = nextRoom->roomId();
-                        return;
-                }
-        }
+void
+RoomList::nextRoom()
+{
+        selectNeighbour(1);
 }
 
 void
 RoomList::previousRoom()
 {
-        for (int ii = 1; ii < contentsLayout_->count(); ++ii) {
-                auto room = qobject_cast<RoomInfoListItem *>(contentsLayout_->itemAt(ii)->widget());
-
-                if (!room)
-                        continue;
-
-                if (room->roomId() == selectedRoom_) {
-                        auto nextRoom = qobject_cast<RoomInfoListItem *>(
-                          contentsLayout_->itemAt(ii - 1)->widget());
-
-                        // Not a room message.
-                        if (!nextRoom || nextRoom->isInvite())
-                                return;
-
-                        emit roomChanged(nextRoom->roomId());
-                        if (!roomExists(nextRoom->roomId())) {
-                                nhlog::ui()->warn("roomlist: clicked unknown room_id");
-                                return;
-                        }
-
-                        room->setPressedState(false);
-                        nextRoom->setPressedState(true);
-
-                        scrollArea_->ensureWidgetVisible(nextRoom);
-                        selectedRoom_ = nextRoom->roomId();
-                        return;
-                }
-        }
+        selectNeighbour(-1);
 }
 
 void
 RoomList::updateRoomAvatar(const QString &roomid, const QString &img)
 {
-        if (!roomExists(roomid)) {
+        if (!ensureRoom(roomid)) {
                 nhlog::ui()->warn("avatar update on non-existent room_id: {}",
                                   roomid.toStdString());
                 return;
         }
 
-        rooms_[roomid]->setAvatar(img);
+        model_->setAvatarUrl(roomid, img);
 
         // Used to inform other widgets for the new image data.
         emit roomAvatarChanged(roomid, img);
@@ -314,14 +388,14 @@ RoomList::updateRoomAvatar(const QString &roomid, const QString &img)
 void
 RoomList::updateRoomDescription(const QString &roomid, const DescInfo &info)
 {
-        if (!roomExists(roomid)) {
+        if (!ensureRoom(roomid)) {
                 nhlog::ui()->warn("description update on non-existent room_id: {}, {}",
                                   roomid.toStdString(),
                                   info.body.toStdString());
                 return;
         }
 
-        rooms_[roomid]->setDescriptionMessage(info);
+        model_->setLastMessage(roomid, info);
 
         if (underMouse()) {
                 // When the user hover out of the roomlist a sort will be triggered.
@@ -334,60 +408,15 @@ RoomList::updateRoomDescription(const QString &roomid, const DescInfo &info)
         emit sortRoomsByLastMessage();
 }
 
-struct room_sort
-{
-        bool operator()(const RoomInfoListItem *a, const RoomInfoListItem *b) const
-        {
-                // Sort by "importance" (i.e. invites before mentions before
-                // notifs before new events before old events), then secondly
-                // by recency.
-
-                // Checking importance first
-                const auto a_importance = a->calculateImportance();
-                const auto b_importance = b->calculateImportance();
-                if (a_importance != b_importance) {
-                        return a_importance > b_importance;
-                }
-
-                // Now sort by recency
-                // Zero if empty, otherwise the time that the event occured
-                const uint64_t a_recency = a->lastMessageInfo().userid.isEmpty()
-                                             ? 0
-                                             : a->lastMessageInfo().datetime.toMSecsSinceEpoch();
-                const uint64_t b_recency = b->lastMessageInfo().userid.isEmpty()
-                                             ? 0
-                                             : b->lastMessageInfo().datetime.toMSecsSinceEpoch();
-                return a_recency > b_recency;
-        }
-};
-
 void
 RoomList::sortRoomsByLastMessage()
 {
         isSortPending_ = false;
 
-        std::multiset<RoomInfoListItem *, room_sort> times;
-
-        for (int ii = 0; ii < contentsLayout_->count(); ++ii) {
-                auto room = qobject_cast<RoomInfoListItem *>(contentsLayout_->itemAt(ii)->widget());
+        model_->sort();
 
-                if (!room)
-                        continue;
-                else
-                        times.insert(room);
-        }
-
-        for (auto it = times.cbegin(); it != times.cend(); ++it) {
-                const auto roomWidget   = *it;
-                const auto currentIndex = contentsLayout_->indexOf(roomWidget);
-                const auto newIndex     = std::distance(times.cbegin(), it);
-
-                if (currentIndex == newIndex)
-                        continue;
-
-                contentsLayout_->removeWidget(roomWidget);
-                contentsLayout_->insertWidget(newIndex, roomWidget);
-        }
+        // Other rooms are next to the visible ones now.
+        prefetchTimer_->start();
 }
 
 void
@@ -411,38 +440,13 @@ RoomList::closeJoinRoomDialog(bool isJoining, QString roomAlias)
 void
 RoomList::removeFilter()
 {
-        setUpdatesEnabled(false);
-        for (int i = 0; i < contentsLayout_->count(); i++) {
-                auto widget =
-                  qobject_cast<RoomInfoListItem *>(contentsLayout_->itemAt(i)->widget());
-                if (widget)
-                        widget->show();
-        }
-        setUpdatesEnabled(true);
+        filterModel_->removeRoomFilter();
 }
 
 void
 RoomList::applyFilter(const std::map<QString, bool> &filter)
 {
-        // Disabling paint updates will resolve issues with screen flickering on big room lists.
-        setUpdatesEnabled(false);
-
-        for (int i = 0; i < contentsLayout_->count(); i++) {
-                // If filter contains the room for the current RoomInfoListItem,
-                // show the list item, otherwise hide it
-                auto listitem =
-                  qobject_cast<RoomInfoListItem *>(contentsLayout_->itemAt(i)->widget());
-
-                if (!listitem)
-                        continue;
-
-                if (filter.find(listitem->roomId()) != filter.end())
-                        listitem->show();
-                else
-                        listitem->hide();
-        }
-
-        setUpdatesEnabled(true);
+        filterModel_->setRoomFilter(filter);
 
         // If the already selected room is part of the group, make sure it's visible.
         if (!selectedRoom_.isEmpty() && (filter.find(selectedRoom_) != filter.end()))
@@ -454,14 +458,9 @@ RoomList::applyFilter(const std::map<QString, bool> &filter)
 void
 RoomList::selectFirstVisibleRoom()
 {
-        for (int i = 0; i < contentsLayout_->count(); i++) {
-                auto item = qobject_cast<RoomInfoListItem *>(contentsLayout_->itemAt(i)->widget());
-
-                if (item && item->isVisible()) {
-                        highlightSelectedRoom(item->roomId());
-                        break;
-                }
-        }
+        const auto room = firstRoom();
+        if (!room.isEmpty())
+                highlightSelectedRoom(room);
 }
 
 void
@@ -476,6 +475,12 @@ RoomList::paintEvent(QPaintEvent *)
 void
 RoomList::updateRoom(const QString &room_id, const RoomInfo &info)
 {
+        // A pending room is added with the new info in its turn.
+        if (auto it = pendingRooms_.find(room_id); it != pendingRooms_.end()) {
+                it.value() = info;
+                return;
+        }
+
         if (!roomExists(room_id)) {
                 if (info.is_invite)
                         addInvitedRoom(room_id, info);
@@ -485,53 +490,75 @@ RoomList::updateRoom(const QString &room_id, const RoomInfo &info)
                 return;
         }
 
-        auto room = rooms_[room_id];
         updateAvatar(room_id, QString::fromStdString(info.avatar_url));
-        room->setRoomName(QString::fromStdString(info.name));
-        room->setRoomType(info.is_invite);
-        room->update();
+        model_->updateRoom(room_id, info);
 }
 
 void
 RoomList::addInvitedRoom(const QString &room_id, const RoomInfo &info)
 {
-        auto room_item = new RoomInfoListItem(room_id, info, settings, scrollArea_);
-
-        connect(room_item, &RoomInfoListItem::acceptInvite, this, &RoomList::acceptInvite);
-        connect(room_item, &RoomInfoListItem::declineInvite, this, &RoomList::declineInvite);
-
-        rooms_.emplace(room_id, QSharedPointer<RoomInfoListItem>(room_item));
+        pendingRooms_.remove(room_id);
+        model_->addRoom(room_id, info);
 
         updateAvatar(room_id, QString::fromStdString(info.avatar_url));
-
-        int pos = contentsLayout_->count() - 1;
-        contentsLayout_->insertWidget(pos, room_item);
 }
 
-std::pair<QString, QSharedPointer<RoomInfoListItem>>
+QString
 RoomList::firstRoom() const
 {
-        for (int i = 0; i < contentsLayout_->count(); i++) {
-                auto item = qobject_cast<RoomInfoListItem *>(contentsLayout_->itemAt(i)->widget());
-
-                if (item) {
-                        return std::pair<QString, QSharedPointer<RoomInfoListItem>>(
-                          item->roomId(), rooms_.at(item->roomId()));
-                }
-        }
-
-        return {};
+        return filterModel_->roomAt(0);
 }
 
 void
 RoomList::updateReadStatus(const std::map<QString, bool> &status)
 {
         for (const auto &room : status) {
-                if (roomExists(room.first)) {
-                        auto item = rooms_.at(room.first);
+                if (pendingRooms_.contains(room.first))
+                        pendingReadStatus_.insert(room.first, room.second);
+                else
+                        model_->setReadState(room.first, room.second);
+        }
+}
 
-                        if (item)
-                                item->setReadState(room.second);
+void
+RoomList::addPendingRooms()
+{
+        QElapsedTimer elapsed;
+        elapsed.start();
+
+        std::vector<std::pair<QString, RoomInfo>> rooms;
+        while (nextPending_ < pendingOrder_.size() && !elapsed.hasExpired(POPULATE_BUDGET_MS)) {
+                rooms.clear();
+                for (; nextPending_ < pendingOrder_.size() && rooms.size() < POPULATE_CHUNK;
+                     nextPending_++) {
+                        // Skip the rooms, which were added out of turn or removed since.
+                        auto it = pendingRooms_.find(pendingOrder_[nextPending_]);
+                        if (it == pendingRooms_.end())
+                                continue;
+
+                        rooms.emplace_back(it.key(), it.value());
+                        pendingRooms_.erase(it);
+                }
+
+                model_->addRooms(rooms);
+
+                for (const auto &[room_id, info] : rooms) {
+                        if (!info.avatar_url.empty())
+                                updateAvatar(room_id, QString::fromStdString(info.avatar_url));
+
+                        if (auto status = pendingReadStatus_.find(room_id);
+                            status != pendingReadStatus_.end()) {
+                                model_->setReadState(room_id, status.value());
+                                pendingReadStatus_.erase(status);
+                        }
                 }
         }
+
+        // Only the rooms, which were updated in between, are out of place.
+        sortRoomsByLastMessage();
+
+        if (nextPending_ < pendingOrder_.size())
+                populateTimer_->start();
+        else
+                clearPendingRooms();
 }
@@ -17,8 +17,12 @@
 
 #pragma once
 
+#include <cstddef>
+#include <vector>
+
+#include <QHash>
+#include <QMap>
 #include <QPushButton>
-#include <QScrollArea>
 #include <QSharedPointer>
 #include <QVBoxLayout>
 #include <QWidget>
@@ -28,7 +32,10 @@
 
 class LeaveRoomDialog;
 class OverlayModal;
-class RoomInfoListItem;
+class QTimer;
+class RoomListModel;
+class RoomListFilterModel;
+class RoomListView;
 class Sync;
 struct DescInfo;
 struct RoomInfo;
@@ -40,10 +47,12 @@ class RoomList : public QWidget
 public:
         explicit RoomList(QSharedPointer<UserSettings> userSettings, QWidget *parent = nullptr);
 
+        //! Replace the rooms. The rooms are added over several iterations of the event loop,
+        //! the ones at the top of the list first, so the window stays usable.
         void initialize(const QMap<QString, RoomInfo> &info);
         void sync(const std::map<QString, RoomInfo> &info);
 
-        void clear() { rooms_.clear(); };
+        void clear();
         void updateAvatar(const QString &room_id, const QString &url);
 
         void addRoom(const QString &room_id, const RoomInfo &info);
@@ -54,7 +63,8 @@ public:
         //! Show all the available rooms.
         void removeFilter();
         void updateRoom(const QString &room_id, const RoomInfo &info);
-        void cleanupInvites(const std::map<QString, bool> &invites);
+        //! Remove the invites, which were accepted, declined or withdrawn.
+        void removeInvites(const std::vector<QString> &room_ids);
 
 signals:
         void roomChanged(const QString &room_id);
@@ -64,6 +74,8 @@ signals:
         void roomAvatarChanged(const QString &room_id, const QString &img);
         void joinRoom(const QString &room_id);
         void updateRoomAvatarCb(const QString &room_id, const QString &img);
+        //! The room is likely opened next, e.g. because it is hovered.
+        void prefetchRoom(const QString &room_id);
 
 public slots:
         void updateRoomAvatar(const QString &roomid, const QString &img);
@@ -81,25 +93,44 @@ protected:
 
 private slots:
         void sortRoomsByLastMessage();
+        //! Prefetch the avatars of the rooms next to the visible ones and the members of the
+        //! visible rooms, which are likely opened next.
+        void prefetch();
+        //! Add the next pending rooms of initialize(), until the frame budget is spent.
+        void addPendingRooms();
 
 private:
-        //! Return the first non-null room.
-        std::pair<QString, QSharedPointer<RoomInfoListItem>> firstRoom() const;
+        //! Return the first visible room.
+        QString firstRoom() const;
         void calculateUnreadMessageCount();
-        bool roomExists(const QString &room_id) { return rooms_.find(room_id) != rooms_.end(); }
+        bool roomExists(const QString &room_id) const;
+        //! Whether the room is in the list. A pending room is added right away, so it can be
+        //! updated.
+        bool ensureRoom(const QString &room_id);
+        void clearPendingRooms();
         //! Select the first visible room in the room list.
         void selectFirstVisibleRoom();
+        //! Select the room offset rows away from the selected one, unless it is an invite.
+        void selectNeighbour(int offset);
 
         QVBoxLayout *topLayout_;
-        QVBoxLayout *contentsLayout_;
-        QScrollArea *scrollArea_;
-        QWidget *scrollAreaContents_;
+        RoomListModel *model_;
+        RoomListFilterModel *filterModel_;
+        RoomListView *view_;
+        QTimer *prefetchTimer_;
+        QTimer *populateTimer_;
+
+        //! The rooms of initialize(), which aren't in the model yet, and the order to add them.
+        QMap<QString, RoomInfo> pendingRooms_;
+        std::vector<QString> pendingOrder_;
+        std::size_t nextPending_ = 0;
+        //! The read status of the pending rooms.
+        QHash<QString, bool> pendingReadStatus_;
 
         QPushButton *joinRoomButton_;
 
         OverlayModal *joinRoomModal_;
 
-        std::map<QString, QSharedPointer<RoomInfoListItem>> rooms_;
         QString selectedRoom_;
 
         bool isSortPending_ = false;
@@ -0,0 +1,585 @@
+#include <algorithm>
+#include <functional>
+#include <iterator>
+
+#include "RoomListModel.h"
+
+#include "UserSettingsPage.h"
+
+//! Every moved room shifts the rows between its old and new place, so many changed rooms are
+//! sorted at once.
+constexpr int MAX_INCREMENTAL_MOVES = 16;
+//! Likewise, a filter switch, which shows or hides many rooms, filters all rooms at once.
+constexpr int MAX_INCREMENTAL_FILTER = 64;
+
+enum NotificationImportance : short
+{
+        ImportanceDisabled = -1,
+        AllEventsRead      = 0,
+        NewMessage         = 1,
+        NewMentions        = 2,
+        Invite             = 3
+};
+
+RoomListModel::RoomListModel(QSharedPointer<UserSettings> settings, QObject *parent)
+  : QAbstractListModel(parent)
+  , settings_(settings)
+{}
+
+QHash<int, QByteArray>
+RoomListModel::roleNames() const
+{
+        return {
+          {Qt::DisplayRole, "name"},
+          {RoomId, "roomId"},
+          {AvatarUrl, "avatarUrl"},
+          {IsInvite, "isInvite"},
+          {LastMessage, "lastMessage"},
+          {Timestamp, "timestamp"},
+          {Recency, "recency"},
+          {UnreadCount, "unreadCount"},
+          {HighlightCount, "highlightCount"},
+          {HasUnreadMessages, "hasUnreadMessages"},
+          {Slot, "slot"},
+        };
+}
+
+int
+RoomListModel::rowCount(const QModelIndex &parent) const
+{
+        if (parent.isValid())
+                return 0;
+
+        return static_cast<int>(rooms_.size());
+}
+
+QVariant
+RoomListModel::data(const QModelIndex &index, int role) const
+{
+        if (!index.isValid() || index.row() < 0 || index.row() >= rowCount())
+                return QVariant();
+
+        const auto &room = rooms_[index.row()];
+
+        switch (role) {
+        case Qt::DisplayRole:
+        case Qt::ToolTipRole:
+                return room.name;
+        case RoomId:
+                return room.room_id;
+        case AvatarUrl:
+                return room.avatar_url;
+        case IsInvite:
+                return room.is_invite;
+        case LastMessage:
+                return room.last_message.body;
+        case Timestamp:
+                return room.last_message.timestamp;
+        case Recency:
+                // Zero if empty, otherwise the time that the event occured
+                return room.last_message.userid.isEmpty()
+                         ? qulonglong(0)
+                         : qulonglong(room.last_message.datetime.toMSecsSinceEpoch());
+        case UnreadCount:
+                return room.unread_count;
+        case HighlightCount:
+                return room.highlight_count;
+        case HasUnreadMessages:
+                return room.has_unread_messages;
+        case Slot:
+                return room.slot;
+        default:
+                return QVariant();
+        }
+}
+
+RoomListModel::Room
+RoomListModel::makeRoom(const QString &room_id, const RoomInfo &info)
+{
+        Room room;
+        room.room_id      = room_id;
+        room.slot         = slotOf(room_id);
+        room.name         = QString::fromStdString(info.name);
+        room.avatar_url   = QString::fromStdString(info.avatar_url);
+        room.is_invite    = info.is_invite;
+        room.last_message = info.msgInfo;
+        updateSortKey(room);
+        return room;
+}
+
+bool
+RoomListModel::updateSortKey(Room &room) const
+{
+        // The degree of importance of the unread messages in the room.
+        // If sorting by importance is disabled in settings, this only ever
+        // is ImportanceDisabled or Invite
+        short int importance;
+        if (room.is_invite)
+                importance = Invite;
+        else if (!settings_->isSortByImportanceEnabled())
+                importance = ImportanceDisabled;
+        else if (room.highlight_count)
+                importance = NewMentions;
+        else if (room.unread_count)
+                importance = NewMessage;
+        else
+                importance = AllEventsRead;
+
+        // Zero if empty, otherwise the time that the event occured
+        const uint64_t recency = room.last_message.userid.isEmpty()
+                                   ? 0
+                                   : room.last_message.datetime.toMSecsSinceEpoch();
+
+        if (importance == room.importance && recency == room.recency)
+                return false;
+
+        room.importance = importance;
+        room.recency    = recency;
+        return true;
+}
+
+bool
+RoomListModel::before(const Room &a, const Room &b)
+{
+        // Sort by "importance" (i.e. invites before mentions before
+        // notifs before new events before old events), then secondly
+        // by recency.
+        if (a.importance != b.importance)
+                return a.importance > b.importance;
+
+        return a.recency > b.recency;
+}
+
+template<class Fn>
+void
+RoomListModel::change(const QString &room_id, const QVector<int> &roles, Fn fn)
+{
+        if (!contains(room_id))
+                return;
+
+        const auto row = rows_.value(room_id);
+        fn(rooms_[row]);
+
+        if (updateSortKey(rooms_[row]))
+                unsorted_.insert(room_id);
+
+        const auto idx = index(row);
+        emit dataChanged(idx, idx, roles);
+}
+
+void
+RoomListModel::setRooms(const QMap<QString, RoomInfo> &info)
+{
+        beginResetModel();
+
+        rooms_.clear();
+        rooms_.reserve(info.size());
+        for (auto it = info.begin(); it != info.end(); it++)
+                rooms_.push_back(makeRoom(it.key(), it.value()));
+        std::stable_sort(rooms_.begin(), rooms_.end(), before);
+        reindex(0);
+        unsorted_.clear();
+        totalUnread_ = 0;
+
+        endResetModel();
+}
+
+void
+RoomListModel::addRoom(const QString &room_id, const RoomInfo &info)
+{
+        if (updateRoom(room_id, info))
+                return;
+
+        auto room = makeRoom(room_id, info);
+
+        const auto pos = std::upper_bound(rooms_.begin(), rooms_.end(), room, before);
+        const auto row = static_cast<int>(pos - rooms_.begin());
+
+        beginInsertRows(QModelIndex(), row, row);
+        rooms_.insert(pos, std::move(room));
+        reindex(row);
+        endInsertRows();
+}
+
+void
+RoomListModel::addRooms(const std::vector<std::pair<QString, RoomInfo>> &rooms)
+{
+        std::vector<Room> added;
+        for (const auto &[room_id, info] : rooms) {
+                if (!updateRoom(room_id, info))
+                        added.push_back(makeRoom(room_id, info));
+        }
+
+        if (added.empty())
+                return;
+
+        std::stable_sort(added.begin(), added.end(), before);
+
+        const auto first = rowCount();
+        for (const auto &room : added) {
+                if (first > 0 && before(room, rooms_[first - 1]))
+                        unsorted_.insert(room.room_id);
+        }
+
+        beginInsertRows(QModelIndex(), first, first + static_cast<int>(added.size()) - 1);
+        std::move(added.begin(), added.end(), std::back_inserter(rooms_));
+        reindex(first);
+        endInsertRows();
+}
+
+bool
+RoomListModel::updateRoom(const QString &room_id, const RoomInfo &info)
+{
+        if (!contains(room_id))
+                return false;
+
+        change(room_id, {Qt::DisplayRole, Qt::ToolTipRole, IsInvite}, [&info](Room &room) {
+                room.name      = QString::fromStdString(info.name);
+                room.is_invite = info.is_invite;
+        });
+        return true;
+}
+
+void
+RoomListModel::removeRoom(const QString &room_id)
+{
+        if (!contains(room_id))
+                return;
+
+        const auto row = rows_.value(room_id);
+        beginRemoveRows(QModelIndex(), row, row);
+        totalUnread_ -= rooms_[row].unread_count;
+        unsorted_.remove(room_id);
+        rows_.remove(room_id);
+        rooms_.erase(rooms_.begin() + row);
+        reindex(row);
+        endRemoveRows();
+}
+
+void
+RoomListModel::removeInvites(const std::vector<QString> &room_ids)
+{
+        for (const auto &room_id : room_ids) {
+                if (contains(room_id) && rooms_[rows_.value(room_id)].is_invite)
+                        removeRoom(room_id);
+        }
+}
+
+void
+RoomListModel::clear()
+{
+        beginResetModel();
+        rooms_.clear();
+        rows_.clear();
+        unsorted_.clear();
+        totalUnread_ = 0;
+        endResetModel();
+}
+
+QModelIndex
+RoomListModel::indexOf(const QString &room_id) const
+{
+        if (!contains(room_id))
+                return QModelIndex();
+
+        return index(rows_.value(room_id));
+}
+
+void
+RoomListModel::setAvatarUrl(const QString &room_id, const QString &url)
+{
+        change(room_id, {AvatarUrl}, [&url](Room &room) { room.avatar_url = url; });
+}
+
+void
+RoomListModel::setLastMessage(const QString &room_id, const DescInfo &info)
+{
+        change(room_id, {LastMessage, Timestamp, Recency}, [&info](Room &room) {
+                room.last_message = info;
+        });
+}
+
+void
+RoomListModel::setUnreadCount(const QString &room_id, int count, int highlightCount)
+{
+        change(room_id, {UnreadCount, HighlightCount}, [this, count, highlightCount](Room &room) {
+                totalUnread_ += count - room.unread_count;
+
+                room.unread_count    = count;
+                room.highlight_count = highlightCount;
+        });
+}
+
+void
+RoomListModel::setReadState(const QString &room_id, bool hasUnreadMessages)
+{
+        // The status of every synced room is sent again, but only few change.
+        if (!contains(room_id) ||
+            rooms_[rows_.value(room_id)].has_unread_messages == hasUnreadMessages)
+                return;
+
+        change(room_id, {HasUnreadMessages}, [=](Room &room) {
+                room.has_unread_messages = hasUnreadMessages;
+        });
+}
+
+int
+RoomListModel::slotOf(const QString &room_id)
+{
+        if (auto it = slots_.constFind(room_id); it != slots_.constEnd())
+                return it.value();
+
+        const auto slot = slotCount();
+        slots_.insert(room_id, slot);
+        slotRooms_.push_back(room_id);
+        return slot;
+}
+
+void
+RoomListModel::refilter(const QBitArray &roomSlots)
+{
+        for (int slot = 0; slot < std::min(roomSlots.size(), slotCount()); slot++) {
+                if (!roomSlots.testBit(slot) || !contains(slotRooms_[slot]))
+                        continue;
+
+                const auto idx = index(rows_.value(slotRooms_[slot]));
+                emit dataChanged(idx, idx, {Slot});
+        }
+}
+
+void
+RoomListModel::sort()
+{
+        if (unsorted_.isEmpty())
+                return;
+
+        if (unsorted_.size() > MAX_INCREMENTAL_MOVES) {
+                sortAll();
+                return;
+        }
+
+        std::vector<int> rows;
+        for (const auto &room_id : unsorted_)
+                rows.push_back(rows_.value(room_id));
+        std::sort(rows.begin(), rows.end(), std::greater<int>());
+
+        // The closest room above or below a row, which stays where it is. The rooms, which
+        // weren't checked yet or will move, are skipped.
+        QSet<QString> moving;
+        auto neighbour = [this, &moving](int row, int step) {
+                for (row += step; row >= 0 && row < rowCount(); row += step)
+                        if (!unsorted_.contains(rooms_[row].room_id) &&
+                            !moving.contains(rooms_[row].room_id))
+                                return row;
+                return -1;
+        };
+
+        // The rooms, which are still in order with their neighbours, stay where they are. The
+        // others are moved, from the last row up.
+        std::vector<int> moved;
+        for (const auto row : rows) {
+                const auto &room = rooms_[row];
+                unsorted_.remove(room.room_id);
+
+                const auto prev = neighbour(row, -1);
+                const auto next = neighbour(row, 1);
+                if ((prev == -1 || !before(room, rooms_[prev])) &&
+                    (next == -1 || !before(rooms_[next], room)))
+                        continue;
+
+                moving.insert(room.room_id);
+                moved.push_back(row);
+        }
+
+        if (moved.empty())
+                return;
+
+        // The rooms, which stay in place, are in order, so the place of a moved room among them
+        // is found by a binary search.
+        std::vector<int> staying;
+        staying.reserve(rowCount() - moved.size());
+        for (int row = 0, next = static_cast<int>(moved.size()) - 1; row < rowCount(); row++) {
+                if (next >= 0 && moved[next] == row)
+                        next--;
+                else
+                        staying.push_back(row);
+        }
+
+        auto rowBefore = [this](int a, int b) { return before(rooms_[a], rooms_[b]); };
+        std::reverse(moved.begin(), moved.end());
+        std::stable_sort(moved.begin(), moved.end(), rowBefore);
+
+        std::vector<std::size_t> places;
+        for (const auto row : moved)
+                places.push_back(std::upper_bound(staying.begin(), staying.end(), row, rowBefore) -
+                                 staying.begin());
+
+        // The rows shift with every move, so a row from before the moves is moved along.
+        std::vector<std::pair<int, int>> moves;
+        auto current = [&moves](int row) {
+                for (const auto &[from, to] : moves) {
+                        if (row == from)
+                                row = to;
+                        else if (from < row && row <= to)
+                                row--;
+                        else if (to <= row && row < from)
+                                row++;
+                }
+                return row;
+        };
+
+        // The rooms are moved in their order in front of the room, which stays and sorts after
+        // them, so every room lands behind the ones moved before it. The moves keep the
+        // selection and the delegates of the views.
+        int first = rowCount();
+        for (std::size_t i = 0; i < moved.size(); i++) {
+                const auto from = current(moved[i]);
+                const auto to =
+                  places[i] == staying.size() ? rowCount() : current(staying[places[i]]);
+
+                // Qt rejects moves, which don't change the order.
+                if (to == from || to == from + 1)
+                        continue;
+
+                const auto row = to > from ? to - 1 : to;
+                beginMoveRows(QModelIndex(), from, from, QModelIndex(), to);
+                auto room = std::move(rooms_[from]);
+                rooms_.erase(rooms_.begin() + from);
+                rooms_.insert(rooms_.begin() + row, std::move(room));
+                endMoveRows();
+
+                moves.emplace_back(from, row);
+                first = std::min({first, from, row});
+        }
+
+        if (first < rowCount())
+                reindex(first);
+}
+
+void
+RoomListModel::resort()
+{
+        for (auto &room : rooms_)
+                updateSortKey(room);
+
+        sortAll();
+}
+
+void
+RoomListModel::sortAll()
+{
+        emit layoutAboutToBeChanged();
+
+        const auto persistent = persistentIndexList();
+        QStringList persistentRooms;
+        for (const auto &idx : persistent)
+                persistentRooms.push_back(rooms_[idx.row()].room_id);
+
+        std::stable_sort(rooms_.begin(), rooms_.end(), before);
+        reindex(0);
+        unsorted_.clear();
+
+        QModelIndexList updated;
+        for (const auto &room_id : persistentRooms)
+                updated.push_back(index(rows_.value(room_id)));
+        changePersistentIndexList(persistent, updated);
+
+        emit layoutChanged();
+}
+
+void
+RoomListModel::reindex(int from)
+{
+        if (from == 0)
+                rows_.clear();
+
+        for (int row = from; row < rowCount(); row++)
+                rows_.insert(rooms_[row].room_id, row);
+}
+
+RoomListFilterModel::RoomListFilterModel(QObject *parent)
+  : QSortFilterProxyModel(parent)
+{
+        // The filter only depends on the slot, so a changed room is only filtered again, when
+        // the filter changed it.
+        setFilterRole(RoomListModel::Slot);
+}
+
+void
+RoomListFilterModel::setRoomFilter(const std::map<QString, bool> &filter)
+{
+        auto model = roomModel();
+        if (!model)
+                return;
+
+        // Every room gets a slot, also the ones, which aren't joined yet, so they are shown
+        // once they are. The bitset is sized after all slots are given out.
+        std::vector<int> roomSlots;
+        roomSlots.reserve(filter.size());
+        for (const auto &room : filter)
+                roomSlots.push_back(model->slotOf(room.first));
+
+        QBitArray bits(model->slotCount());
+        for (const auto slot : roomSlots)
+                bits.setBit(slot);
+
+        changeFilter(bits, true);
+}
+
+void
+RoomListFilterModel::removeRoomFilter()
+{
+        changeFilter(QBitArray(), false);
+}
+
+void
+RoomListFilterModel::changeFilter(const QBitArray &filter, bool filtering)
+{
+        auto model = roomModel();
+        if (!model)
+                return;
+
+        // The filter of all rooms, so both can be compared bit by bit.
+        auto previous   = filtering_ ? filter_ : QBitArray(model->slotCount(), true);
+        auto next       = filtering ? filter : QBitArray(model->slotCount(), true);
+        const auto size = std::max(previous.size(), next.size());
+        previous.resize(size);
+        next.resize(size);
+
+        const auto changed = previous ^ next;
+
+        filter_    = filter;
+        filtering_ = filtering;
+
+        if (changed.count(true) > MAX_INCREMENTAL_FILTER)
+                invalidateFilter();
+        else
+                model->refilter(changed);
+}
+
+QString
+RoomListFilterModel::roomAt(int row) const
+{
+        return index(row, 0).data(RoomListModel::RoomId).toString();
+}
+
+QModelIndex
+RoomListFilterModel::indexOf(const QString &room_id) const
+{
+        auto model = qobject_cast<RoomListModel *>(sourceModel());
+        if (!model)
+                return QModelIndex();
+
+        return mapFromSource(model->indexOf(room_id));
+}
+
+bool
+RoomListFilterModel::filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const
+{
+        if (!filtering_)
+                return true;
+
+        const auto slot =
+          sourceModel()->index(sourceRow, 0, sourceParent).data(RoomListModel::Slot).toInt();
+        return slot < filter_.size() && filter_.testBit(slot);
+}
@@ -0,0 +1,162 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <QAbstractListModel>
+#include <QBitArray>
+#include <QHash>
+#include <QSet>
+#include <QSharedPointer>
+#include <QSortFilterProxyModel>
+
+#include "CacheStructs.h"
+
+class UserSettings;
+
+//! The rooms of the room list. Only the rows in view are painted by the delegate of the
+//! RoomListView, so the model can hold thousands of rooms cheaply.
+//!
+//! The rooms are kept sorted by importance and recency. A change of a room's sort key only marks
+//! it, sort() then moves just the marked rooms to their place by a binary search, so a new message
+//! doesn't resort the whole list.
+class RoomListModel : public QAbstractListModel
+{
+        Q_OBJECT
+
+public:
+        enum Roles
+        {
+                RoomId = Qt::UserRole,
+                AvatarUrl,
+                IsInvite,
+                LastMessage,
+                Timestamp,
+                //! The time of the last message in ms or 0, if there is none.
+                Recency,
+                UnreadCount,
+                HighlightCount,
+                HasUnreadMessages,
+                //! The dense index of the room, see slotOf().
+                Slot,
+        };
+
+        explicit RoomListModel(QSharedPointer<UserSettings> settings, QObject *parent = nullptr);
+
+        QHash<int, QByteArray> roleNames() const override;
+        int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+        //! Replace all rooms in one reset.
+        void setRooms(const QMap<QString, RoomInfo> &info);
+        void addRoom(const QString &room_id, const RoomInfo &info);
+        //! Add many rooms at once. They are appended in one insertion and only the ones out of
+        //! place are marked for the next sort(), so rooms added in their order cost no moves.
+        void addRooms(const std::vector<std::pair<QString, RoomInfo>> &rooms);
+        //! Update the name and type of a room. Returns false, if the room doesn't exist.
+        bool updateRoom(const QString &room_id, const RoomInfo &info);
+        void removeRoom(const QString &room_id);
+        //! Remove the rooms, which are still shown as invites.
+        void removeInvites(const std::vector<QString> &room_ids);
+        void clear();
+
+        bool contains(const QString &room_id) const { return rows_.contains(room_id); }
+        QModelIndex indexOf(const QString &room_id) const;
+
+        void setAvatarUrl(const QString &room_id, const QString &url);
+        void setLastMessage(const QString &room_id, const DescInfo &info);
+        void setUnreadCount(const QString &room_id, int count, int highlightCount);
+        void setReadState(const QString &room_id, bool hasUnreadMessages);
+
+        //! The dense index of a room. It stays the same for the session and is also given to
+        //! rooms, which aren't in the list (yet), so a set of rooms can be a bitset.
+        int slotOf(const QString &room_id);
+        int slotCount() const { return static_cast<int>(slotRooms_.size()); }
+        //! Emit dataChanged for the Slot role of the rooms set in roomSlots, so a filter tests
+        //! them again.
+        void refilter(const QBitArray &roomSlots);
+
+        //! The sum of the unread messages of all rooms. It is kept up to date by the changes of
+        //! the counts.
+        int totalUnreadCount() const { return totalUnread_; }
+
+        //! Move the rooms, whose sort key changed since the last call, to their place.
+        void sort();
+        //! Recompute the sort keys of all rooms, e.g. after the sort settings changed.
+        void resort();
+
+private:
+        struct Room
+        {
+                QString room_id;
+                int slot = 0;
+                QString name;
+                QString avatar_url;
+                bool is_invite = false;
+                DescInfo last_message;
+                int unread_count         = 0;
+                int highlight_count      = 0;
+                bool has_unread_messages = true;
+
+                //! The degree of importance of the unread messages and the time of the last
+                //! message, as of the last sort.
+                short int importance = 0;
+                uint64_t recency     = 0;
+        };
+
+        Room makeRoom(const QString &room_id, const RoomInfo &info);
+        //! Update the sort key of a room. Returns true, if it changed.
+        bool updateSortKey(Room &room) const;
+        static bool before(const Room &a, const Room &b);
+        //! Sort all rooms and keep the persistent indexes, when many rooms changed.
+        void sortAll();
+        //! Emit dataChanged for the row of room_id, after fn changed it.
+        template<class Fn>
+        void change(const QString &room_id, const QVector<int> &roles, Fn fn);
+        void reindex(int from);
+
+        QSharedPointer<UserSettings> settings_;
+
+        std::vector<Room> rooms_;
+        //! The row of every room.
+        QHash<QString, int> rows_;
+        //! The rooms, which may not be at their place anymore.
+        QSet<QString> unsorted_;
+        int totalUnread_ = 0;
+
+        QHash<QString, int> slots_;
+        std::vector<QString> slotRooms_;
+};
+
+//! Hides the rooms outside of the community filter. The order is the one of the RoomListModel.
+//!
+//! A filter is a bitset by the slots of the rooms. Switching it only tests the rooms again, whose
+//! bit differs, unless that are many.
+class RoomListFilterModel : public QSortFilterProxyModel
+{
+        Q_OBJECT
+
+public:
+        explicit RoomListFilterModel(QObject *parent = nullptr);
+
+        //! Only show the rooms in filter.
+        void setRoomFilter(const std::map<QString, bool> &filter);
+        void removeRoomFilter();
+
+        //! The room at row or an empty string.
+        QString roomAt(int row) const;
+        QModelIndex indexOf(const QString &room_id) const;
+
+protected:
+        bool filterAcceptsRow(int sourceRow, const QModelIndex &sourceParent) const override;
+
+private:
+        RoomListModel *roomModel() const { return qobject_cast<RoomListModel *>(sourceModel()); }
+        //! Test the rooms in old ^ filter again or all of them.
+        void changeFilter(const QBitArray &filter, bool filtering);
+
+        QBitArray filter_;
+        bool filtering_ = false;
+};
@@ -0,0 +1,552 @@
+/*
+ * nheko Copyright (C) 2017  Konstantinos Sideris <siderisk@auth.gr>
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <cmath>
+#include <memory>
+
+#include <QContextMenuEvent>
+#include <QHelpEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPainterPath>
+#include <QToolTip>
+
+#include "AvatarProvider.h"
+#include "RoomListModel.h"
+#include "RoomListView.h"
+#include "Splitter.h"
+#include "UserSettingsPage.h"
+#include "Utils.h"
+#include "ui/Menu.h"
+#include "ui/Theme.h"
+
+constexpr int MaxUnreadCountDisplayed = 99;
+//! How long the mouse has to rest on a room, before it is prefetched.
+constexpr int HoverPrefetchDelay = 150;
+
+namespace {
+struct WidgetMetrics
+{
+        int maxHeight;
+        int iconSize;
+        int padding;
+        int unit;
+
+        int unreadLineWidth;
+        int unreadLineOffset;
+
+        int inviteBtnX;
+        int inviteBtnY;
+};
+
+WidgetMetrics
+getMetrics(const QFont &font)
+{
+        WidgetMetrics m;
+
+        const int height = QFontMetrics(font).lineSpacing();
+
+        m.unit             = height;
+        m.maxHeight        = std::ceil((double)height * 3.8);
+        m.iconSize         = std::ceil((double)height * 2.8);
+        m.padding          = std::ceil((double)height / 2.0);
+        m.unreadLineWidth  = m.padding - m.padding / 3;
+        m.unreadLineOffset = m.padding - m.padding / 4;
+
+        m.inviteBtnX = m.iconSize + 2 * m.padding;
+        m.inviteBtnY = m.iconSize / 2.0 + m.padding + m.padding / 3.0;
+
+        return m;
+}
+}
+
+RoomListView::RoomListView(QSharedPointer<UserSettings> userSettings, QWidget *parent)
+  : QListView(parent)
+  , settings_(userSettings)
+{
+        // Every row has the same height, so the view doesn't have to measure the rooms.
+        setUniformItemSizes(true);
+        setSelectionMode(QAbstractItemView::NoSelection);
+        setVerticalScrollMode(QAbstractItemView::ScrollPerPixel);
+        setFrameShape(QFrame::NoFrame);
+        setMouseTracking(true);
+        viewport()->setAttribute(Qt::WA_Hover);
+
+        delegate_ = new RoomListDelegate(this);
+        setItemDelegate(delegate_);
+
+        menu_      = new Menu(this);
+        leaveRoom_ = new QAction(tr("Leave room"), this);
+        connect(leaveRoom_, &QAction::triggered, this, [this]() { emit leaveRoom(menuRoom_); });
+        menu_->addAction(leaveRoom_);
+
+        // Only rooms, which the mouse stops at, not every room it passes over.
+        hoverTimer_ = new QTimer(this);
+        hoverTimer_->setSingleShot(true);
+        hoverTimer_->setInterval(HoverPrefetchDelay);
+        connect(hoverTimer_, &QTimer::timeout, this, [this]() {
+                if (!hoveredRoom_.isEmpty() && hoveredRoom_ != selectedRoom_)
+                        emit roomHovered(hoveredRoom_);
+        });
+}
+
+void
+RoomListView::setSelectedRoom(const QString &room_id)
+{
+        if (selectedRoom_ == room_id)
+                return;
+
+        selectedRoom_ = room_id;
+        viewport()->update();
+}
+
+int
+RoomListView::avatarSize() const
+{
+        return static_cast<int>(getMetrics(QFont{}).iconSize * devicePixelRatioF());
+}
+
+bool
+RoomListView::avatarCircles() const
+{
+        return settings_->isAvatarCirclesEnabled();
+}
+
+QPixmap
+RoomListView::avatar(const QString &avatarUrl)
+{
+        if (avatarUrl.isEmpty() || loadingAvatars_.contains(avatarUrl))
+                return QPixmap();
+
+        // Avatars in memory are returned right away, the others repaint the view, once they
+        // are loaded.
+        auto painting = std::make_shared<bool>(true);
+        auto result   = std::make_shared<QPixmap>();
+
+        loadingAvatars_.insert(avatarUrl);
+        AvatarProvider::resolve(
+          avatarUrl, avatarSize(), this, [this, avatarUrl, painting, result](QPixmap pm) {
+                  loadingAvatars_.remove(avatarUrl);
+
+                  if (*painting)
+                          *result = pm;
+                  else
+                          viewport()->update();
+          });
+        *painting = false;
+
+        return *result;
+}
+
+void
+RoomListView::changeEvent(QEvent *event)
+{
+        // The colors and fonts of the painted rows changed with the theme.
+        switch (event->type()) {
+        case QEvent::StyleChange:
+        case QEvent::PaletteChange:
+        case QEvent::FontChange:
+                delegate_->clearCache();
+                break;
+        default:
+                break;
+        }
+
+        QListView::changeEvent(event);
+}
+
+void
+RoomListView::mouseMoveEvent(QMouseEvent *event)
+{
+        QListView::mouseMoveEvent(event);
+
+        const auto index   = indexAt(event->pos());
+        const auto room_id = index.isValid() && !index.data(RoomListModel::IsInvite).toBool()
+                               ? index.data(RoomListModel::RoomId).toString()
+                               : QString();
+        if (room_id == hoveredRoom_)
+                return;
+
+        hoveredRoom_ = room_id;
+        if (room_id.isEmpty())
+                hoverTimer_->stop();
+        else
+                hoverTimer_->start();
+}
+
+void
+RoomListView::leaveEvent(QEvent *event)
+{
+        hoveredRoom_.clear();
+        hoverTimer_->stop();
+
+        QListView::leaveEvent(event);
+}
+
+void
+RoomListView::mousePressEvent(QMouseEvent *event)
+{
+        if (event->buttons() == Qt::RightButton) {
+                QListView::mousePressEvent(event);
+                return;
+        }
+
+        const auto index = indexAt(event->pos());
+        if (!index.isValid())
+                return;
+
+        const auto room_id = index.data(RoomListModel::RoomId).toString();
+
+        if (index.data(RoomListModel::IsInvite).toBool()) {
+                const auto rect    = visualRect(index);
+                const auto point   = event->pos() - rect.topLeft();
+                const auto buttons = RoomListDelegate::inviteButtons(rect.width());
+
+                if (buttons.first.contains(point))
+                        emit acceptInvite(room_id);
+
+                if (buttons.second.contains(point))
+                        emit declineInvite(room_id);
+
+                return;
+        }
+
+        emit roomClicked(room_id);
+}
+
+void
+RoomListView::contextMenuEvent(QContextMenuEvent *event)
+{
+        const auto index = indexAt(event->pos());
+        if (!index.isValid() || index.data(RoomListModel::IsInvite).toBool())
+                return;
+
+        menuRoom_ = index.data(RoomListModel::RoomId).toString();
+        menu_->popup(event->globalPos());
+}
+
+RoomListDelegate::RoomListDelegate(RoomListView *view)
+  : QStyledItemDelegate(view)
+  , view_(view)
+{
+        unreadCountFont_.setPointSizeF(unreadCountFont_.pointSizeF() * 0.8);
+        unreadCountFont_.setBold(true);
+
+        bubbleDiameter_ = QFontMetrics(unreadCountFont_).averageCharWidth() * 3;
+}
+
+QSize
+RoomListDelegate::sizeHint(const QStyleOptionViewItem &, const QModelIndex &) const
+{
+        // The rows span the width of the view.
+        return QSize(view_->viewport()->width(), getMetrics(QFont{}).maxHeight);
+}
+
+std::pair<QRectF, QRectF>
+RoomListDelegate::inviteButtons(int width)
+{
+        const auto wm      = getMetrics(QFont{});
+        const int btnWidth = (width - wm.iconSize - 6 * wm.padding) / 2;
+
+        return {QRectF(wm.inviteBtnX, wm.inviteBtnY, btnWidth, 20),
+                QRectF(wm.inviteBtnX + btnWidth + 2 * wm.padding, wm.inviteBtnY, btnWidth, 20)};
+}
+
+bool
+RoomListDelegate::helpEvent(QHelpEvent *event,
+                            QAbstractItemView *view,
+                            const QStyleOptionViewItem &option,
+                            const QModelIndex &index)
+{
+        // The name is only shown as a tooltip, when the sidebar is too small for it.
+        if (option.rect.width() > splitter::calculateSidebarSizes(QFont{}).small) {
+                QToolTip::hideText();
+                event->ignore();
+                return true;
+        }
+
+        return QStyledItemDelegate::helpEvent(event, view, option, index);
+}
+
+void
+RoomListDelegate::clearCache()
+{
+        rowCache_.clear();
+}
+
+void
+RoomListDelegate::paint(QPainter *painter,
+                        const QStyleOptionViewItem &option,
+                        const QModelIndex &index) const
+{
+        const auto room_id   = index.data(RoomListModel::RoomId).toString();
+        const bool isPressed = room_id == view_->selectedRoom();
+        const bool hovered   = option.state & QStyle::State_MouseOver;
+
+        RowContent content;
+        content.name        = index.data(Qt::DisplayRole).toString();
+        content.lastMessage = index.data(RoomListModel::LastMessage).toString();
+        content.timestamp   = index.data(RoomListModel::Timestamp).toString();
+        content.avatarUrl   = index.data(RoomListModel::AvatarUrl).toString();
+        content.avatar      = view_->avatar(content.avatarUrl);
+        content.unread      = index.data(RoomListModel::UnreadCount).toInt();
+        content.highlights  = index.data(RoomListModel::HighlightCount).toInt();
+        content.isInvite    = index.data(RoomListModel::IsInvite).toBool();
+        content.hasUnread   = index.data(RoomListModel::HasUnreadMessages).toBool();
+        content.circles     = view_->avatarCircles();
+
+        // Every state of a row is kept on its own, so moving the mouse over the list only blits.
+        const auto key = QString("%1_%2_%3")
+                           .arg(room_id)
+                           .arg(option.rect.width())
+                           .arg(isPressed ? 2 : hovered ? 1 : 0);
+        const auto dpr = painter->device()->devicePixelRatioF();
+
+        if (auto row = rowCache_.object(key);
+            row && row->pixmap.devicePixelRatioF() == dpr && row->content == content) {
+                painter->drawPixmap(option.rect.topLeft(), row->pixmap);
+                return;
+        }
+
+        QPixmap pixmap(option.rect.size() * dpr);
+        pixmap.setDevicePixelRatio(dpr);
+        pixmap.fill(Qt::transparent);
+
+        QPainter p(&pixmap);
+        paintRow(p, option.rect.size(), content, isPressed, hovered);
+        p.end();
+
+        painter->drawPixmap(option.rect.topLeft(), pixmap);
+
+        const int cost = pixmap.width() * pixmap.height() * 4;
+        rowCache_.insert(key, new CachedRow{pixmap, std::move(content)}, cost);
+}
+
+void
+RoomListDelegate::paintRow(QPainter &p,
+                           const QSize &size,
+                           const RowContent &content,
+                           bool isPressed,
+                           bool hovered) const
+{
+        p.setRenderHint(QPainter::TextAntialiasing);
+        p.setRenderHint(QPainter::SmoothPixmapTransform);
+        p.setRenderHint(QPainter::Antialiasing);
+
+        const int width  = size.width();
+        const int height = size.height();
+        const auto rect  = QRect(0, 0, width, height);
+
+        const auto &roomName  = content.name;
+        const auto &timestamp = content.timestamp;
+        const auto &avatar    = content.avatar;
+        const auto isInvite   = content.isInvite;
+        const auto unread     = content.unread;
+        const auto highlights = content.highlights;
+
+        QFontMetrics metrics(QFont{});
+
+        QPen titlePen(view_->titleColor());
+        QPen subtitlePen(view_->subtitleColor());
+
+        auto wm = getMetrics(QFont{});
+
+        if (isPressed) {
+                p.fillRect(rect, view_->highlightedBackgroundColor());
+                titlePen.setColor(view_->highlightedTitleColor());
+                subtitlePen.setColor(view_->highlightedSubtitleColor());
+        } else if (hovered) {
+                p.fillRect(rect, view_->hoverBackgroundColor());
+                titlePen.setColor(view_->hoverTitleColor());
+                subtitlePen.setColor(view_->hoverSubtitleColor());
+        } else {
+                p.fillRect(rect, view_->backgroundColor());
+                titlePen.setColor(view_->titleColor());
+                subtitlePen.setColor(view_->subtitleColor());
+        }
+
+        // Avatar, or the first letter of the name, if there is none.
+        {
+                const QRect avatarRect(wm.padding, wm.padding, wm.iconSize, wm.iconSize);
+
+                QPainterPath clip;
+                if (content.circles)
+                        clip.addEllipse(avatarRect);
+                else
+                        clip.addRoundedRect(avatarRect, 3, 3);
+
+                p.save();
+                if (!avatar.isNull()) {
+                        p.setClipPath(clip);
+                        p.drawPixmap(avatarRect, avatar);
+                } else {
+                        p.setPen(Qt::NoPen);
+                        p.fillPath(clip, view_->avatarBgColor());
+
+                        QFont letterFont;
+                        letterFont.setPointSizeF(ui::FontSize);
+                        p.setFont(letterFont);
+                        p.setPen(view_->avatarFgColor());
+                        p.drawText(avatarRect.translated(0, -1),
+                                   Qt::AlignCenter,
+                                   utils::firstChar(roomName));
+                }
+                p.restore();
+        }
+
+        // Description line with the default font.
+        int bottom_y = wm.maxHeight - wm.padding - metrics.ascent() / 2;
+
+        const auto sidebarSizes = splitter::calculateSidebarSizes(QFont{});
+
+        if (width > sidebarSizes.small) {
+                QFont headingFont;
+                headingFont.setWeight(QFont::Medium);
+                p.setFont(headingFont);
+                p.setPen(titlePen);
+
+                QFont tsFont;
+                tsFont.setPointSizeF(tsFont.pointSizeF() * 0.9);
+#if QT_VERSION < QT_VERSION_CHECK(5, 11, 0)
+                const int msgStampWidth = QFontMetrics(tsFont).width(timestamp) + 4;
+#else
+                const int msgStampWidth = QFontMetrics(tsFont).horizontalAdvance(timestamp) + 4;
+#endif
+                // We use the full width of the widget if there is no unread msg bubble.
+                const int bottomLineWidthLimit = (unread > 0) ? msgStampWidth : 0;
+
+                // Name line.
+                QFontMetrics fontNameMetrics(headingFont);
+                int top_y = 2 * wm.padding + fontNameMetrics.ascent() / 2;
+
+                const auto name =
+                  metrics.elidedText(roomName,
+                                     Qt::ElideRight,
+                                     (width - wm.iconSize - 2 * wm.padding - msgStampWidth) * 0.8);
+                p.drawText(QPoint(2 * wm.padding + wm.iconSize, top_y), name);
+
+                if (!isInvite) {
+                        p.setFont(QFont{});
+                        p.setPen(subtitlePen);
+
+                        int descriptionLimit = std::max(
+                          0, width - 3 * wm.padding - bottomLineWidthLimit - wm.iconSize);
+                        auto description =
+                          metrics.elidedText(content.lastMessage, Qt::ElideRight, descriptionLimit);
+                        p.drawText(QPoint(2 * wm.padding + wm.iconSize, bottom_y), description);
+
+                        // We show the last message timestamp.
+                        p.save();
+                        if (isPressed) {
+                                p.setPen(QPen(view_->highlightedTimestampColor()));
+                        } else if (hovered) {
+                                p.setPen(QPen(view_->hoverTimestampColor()));
+                        } else {
+                                p.setPen(QPen(view_->timestampColor()));
+                        }
+
+                        p.setFont(tsFont);
+                        p.drawText(QPoint(width - wm.padding - msgStampWidth, top_y), timestamp);
+                        p.restore();
+                } else {
+                        const auto [acceptBtnRegion, declineBtnRegion] = inviteButtons(width);
+                        const int btnWidth = acceptBtnRegion.width();
+
+                        QPainterPath acceptPath;
+                        acceptPath.addRoundedRect(acceptBtnRegion, 10, 10);
+
+                        p.setPen(Qt::NoPen);
+                        p.fillPath(acceptPath, view_->btnColor());
+                        p.drawPath(acceptPath);
+
+                        QPainterPath declinePath;
+                        declinePath.addRoundedRect(declineBtnRegion, 10, 10);
+
+                        p.setPen(Qt::NoPen);
+                        p.fillPath(declinePath, view_->btnColor());
+                        p.drawPath(declinePath);
+
+                        p.setPen(QPen(view_->btnTextColor()));
+                        p.setFont(QFont{});
+                        p.drawText(acceptBtnRegion,
+                                   Qt::AlignCenter,
+                                   metrics.elidedText(tr("Accept"), Qt::ElideRight, btnWidth));
+                        p.drawText(declineBtnRegion,
+                                   Qt::AlignCenter,
+                                   metrics.elidedText(tr("Decline"), Qt::ElideRight, btnWidth));
+                }
+        }
+
+        p.setPen(Qt::NoPen);
+
+        if (unread > 0) {
+                QBrush brush;
+                brush.setStyle(Qt::SolidPattern);
+                if (highlights > 0) {
+                        brush.setColor(view_->mentionedColor());
+                } else {
+                        brush.setColor(view_->bubbleBgColor());
+                }
+
+                if (isPressed)
+                        brush.setColor(view_->bubbleFgColor());
+
+                p.setBrush(brush);
+                p.setPen(Qt::NoPen);
+                p.setFont(unreadCountFont_);
+
+                // Extra space on the x-axis to accomodate the extra character space
+                // inside the bubble.
+                const int x_width = unread > MaxUnreadCountDisplayed
+                                      ? QFontMetrics(p.font()).averageCharWidth()
+                                      : 0;
+
+                QRectF r(width - bubbleDiameter_ - wm.padding - x_width,
+                         bottom_y - bubbleDiameter_ / 2 - 5,
+                         bubbleDiameter_ + x_width,
+                         bubbleDiameter_);
+
+                if (width == sidebarSizes.small)
+                        r = QRectF(width - bubbleDiameter_ - 5,
+                                   height - bubbleDiameter_ - 5,
+                                   bubbleDiameter_ + x_width,
+                                   bubbleDiameter_);
+
+                p.setPen(Qt::NoPen);
+                p.drawEllipse(r);
+
+                p.setPen(QPen(view_->bubbleFgColor()));
+
+                if (isPressed)
+                        p.setPen(QPen(view_->bubbleBgColor()));
+
+                auto countTxt = unread > MaxUnreadCountDisplayed ? QString("99+")
+                                                                 : QString::number(unread);
+
+                p.setBrush(Qt::NoBrush);
+                p.drawText(r.translated(0, -0.5), Qt::AlignCenter, countTxt);
+        }
+
+        if (!isPressed && content.hasUnread) {
+                QPen pen;
+                pen.setWidth(wm.unreadLineWidth);
+                pen.setColor(view_->highlightedBackgroundColor());
+
+                p.setPen(pen);
+                p.drawLine(0, wm.unreadLineOffset, 0, height - wm.unreadLineOffset);
+        }
+}
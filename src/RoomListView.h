@@ -17,21 +17,24 @@
 
 #pragma once
 
-#include <QAction>
-#include <QDateTime>
-#include <QSharedPointer>
-#include <QWidget>
-
-#include <mtx/responses.hpp>
+#include <utility>
 
-#include "CacheStructs.h"
-#include "UserSettingsPage.h"
-#include "ui/Avatar.h"
+#include <QCache>
+#include <QColor>
+#include <QListView>
+#include <QPixmap>
+#include <QSet>
+#include <QSharedPointer>
+#include <QStyledItemDelegate>
+#include <QTimer>
 
 class Menu;
-class RippleOverlay;
+class QAction;
+class RoomListDelegate;
+class UserSettings;
 
-class RoomInfoListItem : public QWidget
+//! The rooms of the room list. The colors are set by the style sheets.
+class RoomListView : public QListView
 {
         Q_OBJECT
         Q_PROPERTY(QColor highlightedBackgroundColor READ highlightedBackgroundColor WRITE
@@ -63,24 +66,21 @@ class RoomInfoListItem : public QWidget
         Q_PROPERTY(QColor btnColor READ btnColor WRITE setBtnColor)
         Q_PROPERTY(QColor btnTextColor READ btnTextColor WRITE setBtnTextColor)
 
-public:
-        RoomInfoListItem(QString room_id,
-                         const RoomInfo &info,
-                         QSharedPointer<UserSettings> userSettings,
-                         QWidget *parent = nullptr);
-
-        void updateUnreadMessageCount(int count, int highlightedCount);
-        void clearUnreadMessageCount() { updateUnreadMessageCount(0, 0); };
+        Q_PROPERTY(QColor avatarBgColor READ avatarBgColor WRITE setAvatarBgColor)
+        Q_PROPERTY(QColor avatarFgColor READ avatarFgColor WRITE setAvatarFgColor)
 
-        short int calculateImportance() const;
+public:
+        RoomListView(QSharedPointer<UserSettings> userSettings, QWidget *parent = nullptr);
 
-        QString roomId() { return roomId_; }
-        bool isPressed() const { return isPressed_; }
-        int unreadMessageCount() const { return unreadMsgCount_; }
+        QString selectedRoom() const { return selectedRoom_; }
+        void setSelectedRoom(const QString &room_id);
 
-        void setAvatar(const QString &avatar_url);
-        void setDescriptionMessage(const DescInfo &info);
-        DescInfo lastMessageInfo() const { return lastMsgInfo_; }
+        //! The avatar of a room at its size in the list, if it is in memory. Otherwise it is
+        //! loaded and the view repainted afterwards.
+        QPixmap avatar(const QString &avatarUrl);
+        //! The size of the avatars in the list in device pixels.
+        int avatarSize() const;
+        bool avatarCircles() const;
 
         QColor highlightedBackgroundColor() const { return highlightedBackgroundColor_; }
         QColor hoverBackgroundColor() const { return hoverBackgroundColor_; }
@@ -103,6 +103,9 @@ public:
         QColor bubbleBgColor() const { return bubbleBgColor_; }
         QColor mentionedColor() const { return mentionedFontColor_; }
 
+        QColor avatarBgColor() const { return avatarBgColor_; }
+        QColor avatarFgColor() const { return avatarFgColor_; }
+
         void setHighlightedBackgroundColor(QColor &color) { highlightedBackgroundColor_ = color; }
         void setHoverBackgroundColor(QColor &color) { hoverBackgroundColor_ = color; }
         void setHoverSubtitleColor(QColor &color) { hoverSubtitleColor_ = color; }
@@ -125,70 +128,37 @@ public:
         void setBubbleBgColor(QColor &color) { bubbleBgColor_ = color; }
         void setMentionedColor(QColor &color) { mentionedFontColor_ = color; }
 
-        void setRoomName(const QString &name) { roomName_ = name; }
-        void setRoomType(bool isInvite)
-        {
-                if (isInvite)
-                        roomType_ = RoomType::Invited;
-                else
-                        roomType_ = RoomType::Joined;
-        }
-
-        bool isInvite() const { return roomType_ == RoomType::Invited; }
-        void setReadState(bool hasUnreadMessages)
-        {
-                if (hasUnreadMessages_ != hasUnreadMessages) {
-                        hasUnreadMessages_ = hasUnreadMessages;
-                        update();
-                }
-        }
+        void setAvatarBgColor(QColor &color) { avatarBgColor_ = color; }
+        void setAvatarFgColor(QColor &color) { avatarFgColor_ = color; }
 
 signals:
-        void clicked(const QString &room_id);
+        void roomClicked(const QString &room_id);
         void leaveRoom(const QString &room_id);
         void acceptInvite(const QString &room_id);
         void declineInvite(const QString &room_id);
-
-public slots:
-        void setPressedState(bool state);
+        //! The mouse rested on a joined room for a moment, so it is likely opened next.
+        void roomHovered(const QString &room_id);
 
 protected:
+        void changeEvent(QEvent *event) override;
         void mousePressEvent(QMouseEvent *event) override;
-        void paintEvent(QPaintEvent *event) override;
-        void resizeEvent(QResizeEvent *event) override;
+        void mouseMoveEvent(QMouseEvent *event) override;
+        void leaveEvent(QEvent *event) override;
         void contextMenuEvent(QContextMenuEvent *event) override;
 
 private:
-        void init(QWidget *parent);
-        QString roomName() { return roomName_; }
-
-        RippleOverlay *ripple_overlay_;
-        Avatar *avatar_;
-
-        enum class RoomType
-        {
-                Joined,
-                Invited,
-        };
-
-        RoomType roomType_ = RoomType::Joined;
-
-        // State information for the invited rooms.
-        mtx::responses::InvitedRoom invitedRoom_;
-
-        QString roomId_;
-        QString roomName_;
-
-        DescInfo lastMsgInfo_;
+        QSharedPointer<UserSettings> settings_;
+        RoomListDelegate *delegate_;
+        QString selectedRoom_;
+        QString hoveredRoom_;
+        QTimer *hoverTimer_;
+        //! The avatars, which are loading. A failed one isn't requested again by every paint.
+        QSet<QString> loadingAvatars_;
 
         Menu *menu_;
         QAction *leaveRoom_;
-
-        bool isPressed_         = false;
-        bool hasUnreadMessages_ = true;
-
-        int unreadMsgCount_            = 0;
-        int unreadHighlightedMsgCount_ = 0;
+        //! The room of the open context menu.
+        QString menuRoom_;
 
         QColor highlightedBackgroundColor_;
         QColor hoverBackgroundColor_;
@@ -206,13 +176,7 @@ private:
         QColor btnColor_;
         QColor btnTextColor_;
 
-        QRectF acceptBtnRegion_;
-        QRectF declineBtnRegion_;
-
-        // Fonts
         QColor mentionedFontColor_;
-        QFont unreadCountFont_;
-        int bubbleDiameter_;
 
         QColor timestampColor_;
         QColor highlightedTimestampColor_;
@@ -221,5 +185,80 @@ private:
         QColor bubbleBgColor_;
         QColor bubbleFgColor_;
 
-        QSharedPointer<UserSettings> settings;
+        QColor avatarBgColor_ = QColor("white");
+        QColor avatarFgColor_ = QColor("black");
+};
+
+//! Paints a room of the RoomListView: its avatar, name, last message, timestamp and unread
+//! badge or the buttons of an invite.
+//!
+//! The painted rows are cached as pixmaps, so a repaint of a row, which didn't change, is a
+//! single blit.
+class RoomListDelegate : public QStyledItemDelegate
+{
+        Q_OBJECT
+
+public:
+        explicit RoomListDelegate(RoomListView *view);
+
+        void paint(QPainter *painter,
+                   const QStyleOptionViewItem &option,
+                   const QModelIndex &index) const override;
+        QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+        bool helpEvent(QHelpEvent *event,
+                       QAbstractItemView *view,
+                       const QStyleOptionViewItem &option,
+                       const QModelIndex &index) override;
+
+        //! The accept and decline buttons of an invite in a row of width, relative to the row.
+        static std::pair<QRectF, QRectF> inviteButtons(int width);
+
+        //! Drop the painted rows, e.g. after the theme changed.
+        void clearCache();
+
+private:
+        //! Everything a row is painted from, besides its size and state.
+        struct RowContent
+        {
+                QString name;
+                QString lastMessage;
+                QString timestamp;
+                QString avatarUrl;
+                //! Null, while the avatar loads.
+                QPixmap avatar;
+                int unread     = 0;
+                int highlights = 0;
+                bool isInvite  = false;
+                bool hasUnread = false;
+                bool circles   = false;
+
+                //! The avatar of a url doesn't change, so only whether it is loaded matters.
+                bool operator==(const RowContent &other) const
+                {
+                        return name == other.name && lastMessage == other.lastMessage &&
+                               timestamp == other.timestamp && avatarUrl == other.avatarUrl &&
+                               avatar.isNull() == other.avatar.isNull() &&
+                               unread == other.unread && highlights == other.highlights &&
+                               isInvite == other.isInvite && hasUnread == other.hasUnread &&
+                               circles == other.circles;
+                }
+        };
+
+        struct CachedRow
+        {
+                QPixmap pixmap;
+                RowContent content;
+        };
+
+        void paintRow(QPainter &p,
+                      const QSize &size,
+                      const RowContent &content,
+                      bool isPressed,
+                      bool hovered) const;
+
+        RoomListView *view_;
+        //! The painted rows by room, width and state. The cost is in bytes.
+        mutable QCache<QString, CachedRow> rowCache_{16 * 1024 * 1024};
+        QFont unreadCountFont_;
+        int bubbleDiameter_;
 };
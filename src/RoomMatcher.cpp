@@ -0,0 +1,130 @@
+#include <algorithm>
+
+#include <QDateTime>
+
+#include "Cache.h"
+#include "RoomMatcher.h"
+
+namespace {
+//! Points per matched character and the extra points of a match at a word start or right after
+//! the previous one.
+constexpr int MATCH_POINTS       = 1;
+constexpr int NAME_START_POINTS  = 8;
+constexpr int WORD_START_POINTS  = 6;
+constexpr int CONSECUTIVE_POINTS = 4;
+
+constexpr uint64_t DAY_MS = 24 * 60 * 60 * 1000ULL;
+}
+
+void
+RoomMatcher::setRooms(const QMap<QString, RoomInfo> &rooms)
+{
+        rooms_.clear();
+        rooms_.reserve(rooms.size());
+
+        for (auto it = rooms.begin(); it != rooms.end(); ++it) {
+                Room room;
+                room.room_id = it.key().toStdString();
+                room.info    = it.value();
+                room.name    = QString::fromStdString(it.value().name).toLower();
+                room.recency = it.value().msgInfo.userid.isEmpty()
+                                 ? 0
+                                 : it.value().msgInfo.datetime.toMSecsSinceEpoch();
+                rooms_.push_back(std::move(room));
+        }
+
+        query_.clear();
+        matches_.clear();
+}
+
+int
+RoomMatcher::score(const QString &query, const QString &name)
+{
+        int points   = 0;
+        int previous = -2;
+        int q        = 0;
+
+        for (int i = 0; i < name.size() && q < query.size(); i++) {
+                if (name.at(i) != query.at(q))
+                        continue;
+
+                points += MATCH_POINTS;
+                if (i == 0)
+                        points += NAME_START_POINTS;
+                else if (!name.at(i - 1).isLetterOrNumber())
+                        points += WORD_START_POINTS;
+                if (previous == i - 1)
+                        points += CONSECUTIVE_POINTS;
+
+                previous = i;
+                q++;
+        }
+
+        return q == query.size() ? points : -1;
+}
+
+int
+RoomMatcher::recencyBonus(uint64_t recency, uint64_t now)
+{
+        if (recency == 0 || recency > now)
+                return 0;
+
+        const auto age = now - recency;
+        if (age < DAY_MS)
+                return 4;
+        if (age < 7 * DAY_MS)
+                return 2;
+        if (age < 30 * DAY_MS)
+                return 1;
+        return 0;
+}
+
+std::vector<RoomSearchResult>
+RoomMatcher::match(const QString &query, std::size_t max_items)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("matchRooms"));
+
+        const auto lowered = query.toLower();
+
+        // The rooms matching a longer query are a subset of the ones matching its prefix.
+        std::vector<std::size_t> candidates;
+        if (!query_.isEmpty() && lowered.startsWith(query_)) {
+                candidates = std::move(matches_);
+        } else {
+                candidates.resize(rooms_.size());
+                for (std::size_t i = 0; i < rooms_.size(); i++)
+                        candidates[i] = i;
+        }
+
+        const auto now = static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch());
+
+        std::vector<std::pair<int, std::size_t>> ranked;
+        matches_.clear();
+        for (const auto i : candidates) {
+                const auto points = score(lowered, rooms_[i].name);
+                if (points < 0)
+                        continue;
+
+                matches_.push_back(i);
+                ranked.emplace_back(points + recencyBonus(rooms_[i].recency, now), i);
+        }
+        query_ = lowered;
+
+        const auto count = std::min(max_items, ranked.size());
+        std::partial_sort(ranked.begin(),
+                          ranked.begin() + count,
+                          ranked.end(),
+                          [this](const auto &a, const auto &b) {
+                                  if (a.first != b.first)
+                                          return a.first > b.first;
+                                  return rooms_[a.second].recency > rooms_[b.second].recency;
+                          });
+
+        std::vector<RoomSearchResult> results;
+        for (std::size_t i = 0; i < count; i++) {
+                const auto &room = rooms_[ranked[i].second];
+                results.push_back(RoomSearchResult{room.room_id, room.info});
+        }
+
+        return results;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+#include <QMap>
+#include <QString>
+
+#include "CacheStructs.h"
+
+//! Fuzzy matcher for the quick switcher. A query matches a room, if its characters appear in
+//! the name in order. The matches of a query are kept, so the next keystroke only scores them
+//! again instead of every room.
+class RoomMatcher
+{
+public:
+        //! Replace the rooms, e.g. when the quick switcher opens.
+        void setRooms(const QMap<QString, RoomInfo> &rooms);
+
+        //! Up to max_items rooms, best matches first. Matches of the same quality are ranked by
+        //! the time of their last message.
+        std::vector<RoomSearchResult> match(const QString &query, std::size_t max_items);
+
+private:
+        struct Room
+        {
+                std::string room_id;
+                RoomInfo info;
+                //! The lowercased name.
+                QString name;
+                //! The time of the last message in ms or 0, if there is none.
+                uint64_t recency = 0;
+        };
+
+        //! How well query matches name or -1, if it doesn't.
+        static int score(const QString &query, const QString &name);
+        //! Extra points for the rooms with recent messages.
+        static int recencyBonus(uint64_t recency, uint64_t now);
+
+        std::vector<Room> rooms_;
+
+        //! The last query and the rooms, which matched it.
+        QString query_;
+        std::vector<std::size_t> matches_;
+};
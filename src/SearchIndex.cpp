@@ -0,0 +1,99 @@
+#include <algorithm>
+
+#include <QStringList>
+
+#include "SearchIndex.h"
+#include "Utils.h"
+
+//! Only the names sharing the most trigrams with the query are ranked by their edit distance.
+constexpr std::size_t SHORTLIST_FACTOR = 8;
+constexpr std::size_t MIN_SHORTLIST    = 32;
+
+std::unordered_set<std::string>
+SearchIndex::trigrams(const QString &name)
+{
+        std::unordered_set<std::string> grams;
+
+        const auto words = name.toLower().split(' ', QString::SkipEmptyParts);
+        for (const auto &word : words) {
+                const auto padded = QString("  ") + word;
+
+                for (int i = 0; i + 3 <= padded.size(); i++)
+                        grams.insert(padded.mid(i, 3).toStdString());
+        }
+
+        return grams;
+}
+
+void
+SearchIndex::insert(const std::string &id, const QString &name)
+{
+        remove(id);
+
+        for (const auto &gram : trigrams(name))
+                postings_[gram].insert(id);
+
+        names_.emplace(id, name.toLower());
+}
+
+void
+SearchIndex::remove(const std::string &id)
+{
+        auto it = names_.find(id);
+        if (it == names_.end())
+                return;
+
+        for (const auto &gram : trigrams(it->second)) {
+                auto posting = postings_.find(gram);
+                if (posting == postings_.end())
+                        continue;
+
+                posting->second.erase(id);
+                if (posting->second.empty())
+                        postings_.erase(posting);
+        }
+
+        names_.erase(it);
+}
+
+std::vector<std::string>
+SearchIndex::search(const QString &query, std::size_t max_items) const
+{
+        std::unordered_map<std::string, std::size_t> hits;
+        for (const auto &gram : trigrams(query)) {
+                auto posting = postings_.find(gram);
+                if (posting == postings_.end())
+                        continue;
+
+                for (const auto &id : posting->second)
+                        hits[id]++;
+        }
+
+        std::vector<std::pair<std::string, std::size_t>> candidates(hits.begin(), hits.end());
+
+        const auto shortlist =
+          std::min(candidates.size(), std::max(max_items * SHORTLIST_FACTOR, MIN_SHORTLIST));
+        std::partial_sort(candidates.begin(),
+                          candidates.begin() + shortlist,
+                          candidates.end(),
+                          [](const auto &a, const auto &b) { return a.second > b.second; });
+        candidates.resize(shortlist);
+
+        const utils::FuzzyNeedle needle(query.toLower());
+
+        std::vector<std::pair<int, std::string>> ranked;
+        for (const auto &candidate : candidates) {
+                const auto &id = candidate.first;
+                ranked.emplace_back(needle.distance(names_.at(id), needle.size()), id);
+        }
+
+        std::stable_sort(ranked.begin(), ranked.end(), [](const auto &a, const auto &b) {
+                return a.first < b.first;
+        });
+
+        std::vector<std::string> ids;
+        for (std::size_t i = 0; i < ranked.size() && i < max_items; i++)
+                ids.push_back(ranked[i].second);
+
+        return ids;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include <QString>
+
+//! Trigram index over a set of names. It finds the names closest to a query, without computing
+//! the edit distance between the query and every name.
+class SearchIndex
+{
+public:
+        //! Add the name of an item, replacing its previous name.
+        void insert(const std::string &id, const QString &name);
+        void remove(const std::string &id);
+
+        std::size_t size() const { return names_.size(); }
+
+        //! The ids of up to max_items names, best matches first.
+        std::vector<std::string> search(const QString &query, std::size_t max_items) const;
+
+private:
+        //! The trigrams of every word of the name. Each word is padded in front, so that a
+        //! prefix of one or two characters has trigrams too.
+        static std::unordered_set<std::string> trigrams(const QString &name);
+
+        //! The lowercased name of every item.
+        std::unordered_map<std::string, QString> names_;
+        //! The ids of the items, whose name contains the trigram.
+        std::unordered_map<std::string, std::unordered_set<std::string>> postings_;
+};
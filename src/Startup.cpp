@@ -0,0 +1,123 @@
+#include "Startup.h"
+
+#include <array>
+#include <chrono>
+#include <mutex>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QMetaObject>
+#include <QTimer>
+
+#include <nlohmann/json.hpp>
+
+#include "Logging.h"
+#include "Trace.h"
+
+//! A benchmark, which doesn't reach a milestone, e.g. because the fixture has no rooms, still
+//! writes its report and quits after this long.
+constexpr int BENCHMARK_TIMEOUT = 60 * 1000;
+
+namespace {
+//! Taken during the static initialization, which is as close to the start of the process as we
+//! get without asking the system.
+const auto processStart_ = std::chrono::steady_clock::now();
+
+constexpr std::array<const char *, 4> names_ = {
+  "startup: first frame",
+  "startup: room list shown",
+  "startup: first timeline",
+  "startup: first sync",
+};
+
+std::mutex mutex_;
+std::array<std::chrono::steady_clock::time_point, 4> reached_;
+std::array<bool, 4> taken_{};
+QString report_;
+
+//! Write the report and quit. Called on the main thread.
+void
+finishBenchmark()
+{
+        using std::chrono::duration;
+
+        nlohmann::json milestones;
+        {
+                std::lock_guard lock(mutex_);
+                if (report_.isEmpty())
+                        return;
+
+                for (std::size_t i = 0; i < names_.size(); i++)
+                        milestones[names_[i]] =
+                          taken_[i] ? nlohmann::json(
+                                        duration<double, std::milli>(reached_[i] - processStart_)
+                                          .count())
+                                    : nlohmann::json(nullptr);
+        }
+
+        QFile file(report_);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+                nhlog::ui()->warn("failed to write the startup report to {}",
+                                  report_.toStdString());
+        else
+                file.write(QByteArray::fromStdString(milestones.dump() + "\n"));
+
+        report_.clear();
+        QCoreApplication::quit();
+}
+}
+
+namespace startup {
+void
+reached(Milestone milestone)
+{
+        const auto now   = std::chrono::steady_clock::now();
+        const auto index = static_cast<std::size_t>(milestone);
+
+        bool complete = true;
+        {
+                std::lock_guard lock(mutex_);
+                if (taken_[index])
+                        return;
+
+                taken_[index]   = true;
+                reached_[index] = now;
+
+                for (auto taken : taken_)
+                        complete = complete && taken;
+                complete = complete && !report_.isEmpty();
+        }
+
+        nhlog::ui()->info(
+          "{} after {} ms",
+          names_[index],
+          std::chrono::duration_cast<std::chrono::milliseconds>(now - processStart_).count());
+        if (trace::enabled())
+                trace::record(names_[index], processStart_, now);
+
+        if (complete)
+                QMetaObject::invokeMethod(
+                  QCoreApplication::instance(), []() { finishBenchmark(); }, Qt::QueuedConnection);
+}
+
+void
+benchmark(const QString &file)
+{
+        {
+                std::lock_guard lock(mutex_);
+                report_ = file;
+        }
+
+        QTimer::singleShot(BENCHMARK_TIMEOUT, QCoreApplication::instance(), []() {
+                nhlog::ui()->warn("the startup benchmark timed out");
+                finishBenchmark();
+        });
+}
+
+bool
+benchmarking()
+{
+        std::lock_guard lock(mutex_);
+        return !report_.isEmpty();
+}
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <QString>
+
+//! The milestones of the startup, timed from the start of the process.
+//!
+//! Each milestone is taken once, logged and recorded as a span of the trace. With --startup-
+//! benchmark the times are appended to a report and nheko quits, once all of them are reached,
+//! so scripts/startup_benchmark.py can start it over and over against a cache fixture.
+namespace startup {
+enum class Milestone
+{
+        //! The timeline view drew its first frame.
+        FirstFrame,
+        //! The first rooms of the room list are shown.
+        RoomListShown,
+        //! The timeline of the selected room is rendered.
+        FirstTimeline,
+        //! The first sync was requested, or the replayed responses are processed.
+        FirstSync,
+};
+
+//! Take the milestone, if it wasn't taken yet. Can be called from any thread.
+void
+reached(Milestone milestone);
+
+//! Append the times of the milestones to file as a line of json and quit, once all of them are
+//! reached or the benchmark timed out.
+void
+benchmark(const QString &file);
+
+//! Whether the startup benchmark runs. It is unattended, so nheko opens a room itself.
+bool
+benchmarking();
+}
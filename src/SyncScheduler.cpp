@@ -0,0 +1,79 @@
+#include <algorithm>
+
+#include <QSettings>
+
+#include "SyncScheduler.h"
+
+//! The first retry waits about this long, every following one twice as long.
+constexpr std::chrono::milliseconds MIN_RETRY_DELAY{2'000};
+constexpr std::chrono::milliseconds MAX_RETRY_DELAY{5 * 60'000};
+
+//! How long the server may hold a sync, while the window is active and while it isn't.
+constexpr uint16_t ACTIVE_SERVER_TIMEOUT   = 30'000;
+constexpr uint16_t INACTIVE_SERVER_TIMEOUT = 60'000;
+
+namespace {
+int64_t
+steadyMilliseconds()
+{
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                 std::chrono::steady_clock::now().time_since_epoch())
+          .count();
+}
+}
+
+std::chrono::milliseconds
+SyncScheduler::failed()
+{
+        const int failures = std::min(failures_++, 16);
+
+        const auto delay =
+          std::min<std::chrono::milliseconds>(MIN_RETRY_DELAY * (int64_t{1} << failures),
+                                              MAX_RETRY_DELAY);
+
+        // Wait somewhere between half and the full delay.
+        std::uniform_int_distribution<int64_t> jitter(delay.count() / 2, delay.count());
+        const auto jittered = std::chrono::milliseconds(jitter(rng_));
+        lastDelay_          = jittered.count();
+
+        return jittered;
+}
+
+void
+SyncScheduler::succeeded()
+{
+        failures_    = 0;
+        lastDelay_   = 0;
+        lastSuccess_ = steadyMilliseconds();
+}
+
+bool
+SyncScheduler::succeededWithin(std::chrono::milliseconds interval) const
+{
+        return lastSuccess_ != 0 && steadyMilliseconds() - lastSuccess_ < interval.count();
+}
+
+uint16_t
+SyncScheduler::serverTimeout(bool active)
+{
+        serverTimeout_ = active ? ACTIVE_SERVER_TIMEOUT : INACTIVE_SERVER_TIMEOUT;
+        return serverTimeout_;
+}
+
+bool
+SyncScheduler::lite() const
+{
+        return QSettings().value("user/sync/lite", false).toBool();
+}
+
+SyncScheduler::State
+SyncScheduler::state() const
+{
+        State state;
+        state.failures       = failures_;
+        state.last_delay     = std::chrono::milliseconds(lastDelay_);
+        state.server_timeout = serverTimeout_;
+        state.lite           = lite();
+
+        return state;
+}
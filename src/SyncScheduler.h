@@ -0,0 +1,50 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+//! Decides when and how the next sync is requested.
+//!
+//! Failed syncs are retried with an exponential backoff and random jitter, so clients don't
+//! reconnect in lockstep, when a homeserver comes back. The server holds a sync longer, while the
+//! window isn't active, and the lite mode leaves out the typing notifications.
+class SyncScheduler
+{
+public:
+        //! A snapshot for the diagnostics.
+        struct State
+        {
+                int failures = 0;
+                std::chrono::milliseconds last_delay{0};
+                uint16_t server_timeout = 0;
+                bool lite               = false;
+        };
+
+        //! Record a failed sync and return how long to wait before the next try. Called on the
+        //! GUI thread.
+        std::chrono::milliseconds failed();
+        //! Record a successful sync, which resets the backoff. Safe from any thread.
+        void succeeded();
+        //! The number of failures in a row.
+        int failures() const { return failures_; }
+        //! Whether a sync succeeded in the last interval.
+        bool succeededWithin(std::chrono::milliseconds interval) const;
+
+        //! How long the server may hold a sync, depending on the state of the window.
+        uint16_t serverTimeout(bool active);
+        //! Whether the lite mode is enabled, see user/sync/lite.
+        bool lite() const;
+
+        State state() const;
+
+private:
+        std::atomic_int failures_{0};
+        std::atomic<int64_t> lastDelay_{0};
+        std::atomic<uint16_t> serverTimeout_{0};
+        //! When the last sync succeeded, in milliseconds of the steady clock.
+        std::atomic<int64_t> lastSuccess_{0};
+
+        std::mt19937 rng_{std::random_device{}()};
+};
@@ -15,20 +15,25 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <algorithm>
+
 #include <QAbstractTextDocumentLayout>
 #include <QBuffer>
 #include <QClipboard>
+#include <QCoreApplication>
 #include <QFileDialog>
 #include <QMimeData>
 #include <QMimeDatabase>
 #include <QMimeType>
 #include <QPainter>
+#include <QPointer>
 #include <QStyleOption>
 #include <QtConcurrent>
 
 #include "Cache.h"
 #include "ChatPage.h"
 #include "Logging.h"
+#include "MatrixClient.h"
 #include "TextInputWidget.h"
 #include "Utils.h"
 #include "ui/FlatButton.h"
@@ -42,6 +47,90 @@ static constexpr size_t INPUT_HISTORY_SIZE = 127;
 static constexpr int MAX_TEXTINPUT_HEIGHT  = 120;
 static constexpr int ButtonHeight          = 22;
 
+//! The pause in typing in ms, after which the users matching the query are searched.
+static constexpr int SUGGESTION_DELAY = 150;
+//! How many users the suggestions show.
+static constexpr std::size_t MAX_SUGGESTIONS = 5;
+
+namespace {
+//! The users of the user directory of the server, which match a query.
+struct UserDirectory
+{
+        std::vector<SearchResult> results;
+};
+
+void
+from_json(const nlohmann::json &j, UserDirectory &directory)
+{
+        for (const auto &user : j.at("results")) {
+                const auto user_id = user.at("user_id").get<std::string>();
+                const auto name    = user.find("display_name");
+                directory.results.push_back(
+                  {QString::fromStdString(user_id),
+                   QString::fromStdString(name != user.end() && name->is_string()
+                                            ? name->get<std::string>()
+                                            : user_id),
+                   true});
+        }
+}
+
+//! Show the results of a search off the GUI thread. The input is only checked on the GUI
+//! thread, where it is deleted.
+void
+deliverResults(QPointer<FilteredTextEdit> input,
+               std::vector<SearchResult> results,
+               quint64 generation)
+{
+        QMetaObject::invokeMethod(
+          QCoreApplication::instance(),
+          [input, results = std::move(results), generation]() {
+                  if (input)
+                          emit input->resultsRetrieved(results, generation);
+          });
+}
+
+//! Add the users of the user directory to the suggestions, which are shown already. The
+//! directory covers the whole server, so its users are marked as such.
+void
+searchUserDirectory(QPointer<FilteredTextEdit> input,
+                    const std::string &query,
+                    std::vector<SearchResult> results,
+                    std::shared_ptr<const std::atomic<quint64>> latest,
+                    quint64 generation)
+{
+        const nlohmann::json request = {{"search_term", query}, {"limit", MAX_SUGGESTIONS}};
+
+        http::client()->post<nlohmann::json, UserDirectory>(
+          "/client/r0/user_directory/search",
+          request,
+          [input, results = std::move(results), latest, generation](
+            const UserDirectory &directory, mtx::http::RequestErr err) {
+                  if (err) {
+                          nhlog::net()->warn("failed to search the user directory: {}",
+                                             err->matrix_error.error);
+                          return;
+                  }
+
+                  if (*latest != generation)
+                          return;
+
+                  // The members found in the cache come first.
+                  auto merged = results;
+                  for (const auto &user : directory.results) {
+                          if (merged.size() >= MAX_SUGGESTIONS)
+                                  break;
+                          if (std::none_of(merged.begin(), merged.end(), [&user](const auto &r) {
+                                      return r.user_id == user.user_id;
+                              }))
+                                  merged.push_back(user);
+                  }
+
+                  if (merged.size() > results.size())
+                          deliverResults(input, std::move(merged), generation);
+          });
+}
+}
+
 FilteredTextEdit::FilteredTextEdit(QWidget *parent)
   : QTextEdit{parent}
   , history_index_{0}
@@ -66,6 +155,15 @@ FilteredTextEdit::FilteredTextEdit(QWidget *parent)
         typingTimer_->setSingleShot(true);
 
         connect(typingTimer_, &QTimer::timeout, this, &FilteredTextEdit::stopTyping);
+
+        suggestionTimer_ = new QTimer(this);
+        suggestionTimer_->setInterval(SUGGESTION_DELAY);
+        suggestionTimer_->setSingleShot(true);
+
+        connect(suggestionTimer_, &QTimer::timeout, this, [this]() {
+                emit showSuggestions(pendingQuery_, ++*latestQuery_);
+        });
+
         connect(&previewDialog_,
                 &dialogs::PreviewUploadOverlay::confirmUpload,
                 this,
@@ -102,8 +200,12 @@ FilteredTextEdit::FilteredTextEdit(QWidget *parent)
 }
 
 void
-FilteredTextEdit::showResults(const std::vector<SearchResult> &results)
+FilteredTextEdit::showResults(const std::vector<SearchResult> &results, quint64 generation)
 {
+        // The query changed or the completion closed, while the search ran.
+        if (generation != *latestQuery_ || !isAnchorValid())
+                return;
+
         QPoint pos;
 
         if (isAnchorValid()) {
@@ -188,7 +290,9 @@ FilteredTextEdit::keyPressEvent(QKeyEvent *event)
                         atTriggerPosition_ = startOfWord;
                         anchorType_        = AnchorType::Tab;
 
-                        emit showSuggestions(word);
+                        // Tab asks for the completion, so it doesn't wait for a pause.
+                        suggestionTimer_->stop();
+                        emit showSuggestions(word, ++*latestQuery_);
                 } else {
                         QTextEdit::keyPressEvent(event);
                 }
@@ -260,7 +364,7 @@ FilteredTextEdit::keyPressEvent(QKeyEvent *event)
                                 return;
                         }
 
-                        emit showSuggestions(word);
+                        requestSuggestions(word);
                 } else {
                         resetAnchor();
                         closeSuggestions();
@@ -284,9 +388,12 @@ FilteredTextEdit::insertFromMimeData(const QMimeData *source)
         const auto audio   = formats.filter("audio/", Qt::CaseInsensitive);
         const auto video   = formats.filter("video/", Qt::CaseInsensitive);
 
-        if (source->hasImage()) {
+        if (!image.empty() && source->hasFormat(image.front())) {
+                // Already encoded, so it is uploaded as it is and only decoded for the preview.
+                showPreview(source, image);
+        } else if (source->hasImage()) {
                 QImage img = qvariant_cast<QImage>(source->imageData());
-                previewDialog_.setPreview(img, image.front());
+                previewDialog_.setPreview(img, image.empty() ? "image/png" : image.front());
         } else if (!audio.empty()) {
                 showPreview(source, audio);
         } else if (!video.empty()) {
@@ -485,19 +592,45 @@ TextInputWidget::TextInputWidget(QWidget *parent)
 
                         emit heightChanged(widgetHeight);
                 });
-        connect(input_, &FilteredTextEdit::showSuggestions, this, [this](const QString &q) {
-                if (q.isEmpty())
-                        return;
+        connect(input_,
+                &FilteredTextEdit::showSuggestions,
+                this,
+                [this](const QString &q, quint64 generation) {
+                        if (q.isEmpty())
+                                return;
 
-                QtConcurrent::run([this, q = q.toLower().toStdString()]() {
-                        try {
-                                emit input_->resultsRetrieved(cache::searchUsers(
-                                  ChatPage::instance()->currentRoom().toStdString(), q));
-                        } catch (const lmdb::error &e) {
-                                nhlog::db()->error("Suggestion retrieval failed: {}", e.what());
-                        }
+                        const auto room_id = ChatPage::instance()->currentRoom().toStdString();
+
+                        QtConcurrent::run([input  = QPointer<FilteredTextEdit>(input_),
+                                           q      = q.toLower().toStdString(),
+                                           room_id,
+                                           latest = input_->latestQuery(),
+                                           generation]() {
+                                // A newer query was made, while this one waited for a thread.
+                                if (*latest != generation)
+                                        return;
+
+                                try {
+                                        auto results =
+                                          cache::searchUsers(room_id, q, MAX_SUGGESTIONS);
+                                        deliverResults(input, results, generation);
+
+                                        // Lazy loading only stores the members of a large room,
+                                        // which were seen in its timeline, so the server is
+                                        // asked for the others.
+                                        if (results.size() < MAX_SUGGESTIONS &&
+                                            cache::isLargeRoom(room_id))
+                                                searchUserDirectory(input,
+                                                                    q,
+                                                                    std::move(results),
+                                                                    latest,
+                                                                    generation);
+                                } catch (const lmdb::error &e) {
+                                        nhlog::db()->error("Suggestion retrieval failed: {}",
+                                                           e.what());
+                                }
+                        });
                 });
-        });
 
         sendMessageBtn_ = new FlatButton(this);
         sendMessageBtn_->setToolTip(tr("Send a message"));
@@ -630,6 +763,21 @@ TextInputWidget::hideUploadSpinner()
         topLayout_->insertWidget(0, sendFileBtn_);
         sendFileBtn_->show();
         spinner_->stop();
+        spinner_->setProgress(-1);
+        spinner_->setToolTip(QString());
+}
+
+void
+TextInputWidget::setUploadProgress(qint64 sent, qint64 total)
+{
+        if (total <= 0)
+                return;
+
+        const auto progress = static_cast<qreal>(sent) / static_cast<qreal>(total);
+        spinner_->setProgress(progress);
+        spinner_->setToolTip(tr("Uploaded %1 of %2")
+                               .arg(utils::humanReadableFileSize(sent))
+                               .arg(utils::humanReadableFileSize(total)));
 }
 
 void
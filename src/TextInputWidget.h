@@ -17,8 +17,12 @@
 
 #pragma once
 
+#include <atomic>
 #include <deque>
+#include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 #include <QCoreApplication>
 #include <QHBoxLayout>
@@ -58,15 +62,20 @@ signals:
         void command(QString name, QString args);
         void media(QSharedPointer<QIODevice> data, QString mimeClass, const QString &filename);
 
-        //! Trigger the suggestion popup.
-        void showSuggestions(const QString &query);
-        void resultsRetrieved(const std::vector<SearchResult> &results);
+        //! Trigger the suggestion popup. The results carry the generation of their query.
+        void showSuggestions(const QString &query, quint64 generation);
+        void resultsRetrieved(const std::vector<SearchResult> &results, quint64 generation);
         void selectNextSuggestion();
         void selectPreviousSuggestion();
         void selectHoveredSuggestion();
 
 public slots:
-        void showResults(const std::vector<SearchResult> &results);
+        void showResults(const std::vector<SearchResult> &results, quint64 generation);
+
+public:
+        //! The generation of the latest query. The searches in the thread pool share it, so
+        //! they can skip the queries, which are outdated when they start.
+        std::shared_ptr<const std::atomic<quint64>> latestQuery() const { return latestQuery_; }
 
 protected:
         void keyPressEvent(QKeyEvent *event) override;
@@ -82,6 +91,11 @@ private:
         std::deque<QString> true_history_, working_history_;
         size_t history_index_;
         QTimer *typingTimer_;
+        //! Waits for a pause in typing, before the users are searched.
+        QTimer *suggestionTimer_;
+        QString pendingQuery_;
+        std::shared_ptr<std::atomic<quint64>> latestQuery_ =
+          std::make_shared<std::atomic<quint64>>(0);
 
         SuggestionsPopup suggestionsPopup_;
 
@@ -95,7 +109,19 @@ private:
 
         int anchorWidth(AnchorType anchor) { return static_cast<int>(anchor); }
 
-        void closeSuggestions() { suggestionsPopup_.hide(); }
+        //! Hide the popup and drop the results of the running searches.
+        void closeSuggestions()
+        {
+                suggestionTimer_->stop();
+                ++*latestQuery_;
+                suggestionsPopup_.hide();
+        }
+        //! Search the users for query, once typing pauses.
+        void requestSuggestions(const QString &query)
+        {
+                pendingQuery_ = query;
+                suggestionTimer_->start();
+        }
         void resetAnchor() { atTriggerPosition_ = -1; }
         bool isAnchorValid() { return atTriggerPosition_ != -1; }
         bool hasAnchor(int pos, AnchorType anchor)
@@ -148,6 +174,8 @@ public:
 public slots:
         void openFileSelection();
         void hideUploadSpinner();
+        //! Show how much of the file was uploaded. total is 0 or -1, if it is unknown.
+        void setUploadProgress(qint64 sent, qint64 total);
         void focusLineEdit() { input_->setFocus(); }
 
 private slots:
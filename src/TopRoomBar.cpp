@@ -206,9 +206,8 @@ TopRoomBar::updateRoomName(const QString &name)
 void
 TopRoomBar::updateRoomTopic(QString topic)
 {
-        topic.replace(conf::strings::url_regex, conf::strings::url_html);
         topicLabel_->clearLinks();
-        topicLabel_->setHtml(topic);
+        topicLabel_->setHtml(utils::linkifyMessage(topic));
         update();
 }
 
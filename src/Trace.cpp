@@ -0,0 +1,115 @@
+#include "Trace.h"
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "Logging.h"
+
+//! The spans recorded at most, so a long session doesn't grow without bounds.
+constexpr std::size_t MAX_SPANS = 200'000;
+
+namespace {
+struct RecordedSpan
+{
+        const char *name;
+        int thread;
+        int64_t start_us;
+        int64_t duration_us;
+};
+
+std::mutex mutex_;
+std::string file_;
+std::chrono::steady_clock::time_point origin_;
+std::vector<RecordedSpan> spans_;
+std::size_t dropped_ = 0;
+std::atomic<int> threads_{0};
+
+//! A small id of the calling thread, which is easier to read in the trace than a native one.
+int
+threadId()
+{
+        thread_local const int id = threads_++;
+        return id;
+}
+}
+
+namespace trace {
+namespace detail {
+std::atomic<bool> enabled{false};
+}
+
+void
+start(const std::string &file)
+{
+        std::lock_guard lock(mutex_);
+
+        file_   = file;
+        origin_ = std::chrono::steady_clock::now();
+        spans_.reserve(4096);
+
+        // The thread starting the trace is the first one.
+        threadId();
+        detail::enabled = true;
+}
+
+void
+record(const char *name,
+       std::chrono::steady_clock::time_point start,
+       std::chrono::steady_clock::time_point end)
+{
+        using std::chrono::duration_cast;
+        using std::chrono::microseconds;
+
+        const auto thread = threadId();
+
+        std::lock_guard lock(mutex_);
+
+        if (!detail::enabled)
+                return;
+
+        if (spans_.size() >= MAX_SPANS) {
+                dropped_++;
+                return;
+        }
+
+        spans_.push_back({name,
+                          thread,
+                          duration_cast<microseconds>(start - origin_).count(),
+                          duration_cast<microseconds>(end - start).count()});
+}
+
+void
+finish()
+{
+        std::lock_guard lock(mutex_);
+
+        if (!detail::enabled)
+                return;
+
+        detail::enabled = false;
+
+        auto events = nlohmann::json::array();
+        for (const auto &span : spans_)
+                events.push_back({{"name", span.name},
+                                  {"ph", "X"},
+                                  {"pid", 1},
+                                  {"tid", span.thread},
+                                  {"ts", span.start_us},
+                                  {"dur", span.duration_us}});
+
+        std::ofstream out(file_);
+        out << nlohmann::json{{"traceEvents", std::move(events)}, {"displayTimeUnit", "ms"}};
+
+        if (!out)
+                nhlog::ui()->warn("failed to write the trace to {}", file_);
+        else
+                nhlog::ui()->info(
+                  "wrote {} spans to {}, {} dropped", spans_.size(), file_, dropped_);
+
+        spans_.clear();
+}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <string>
+
+//! Records spans of the startup and the sync loop, which are written as a Chrome trace (see
+//! chrome://tracing) on exit. Enabled by --trace, otherwise a span only tests a flag.
+namespace trace {
+namespace detail {
+extern std::atomic<bool> enabled;
+}
+
+//! Start recording the spans, which are written to file by finish().
+void
+start(const std::string &file);
+//! Write the recorded spans and stop recording.
+void
+finish();
+
+inline bool
+enabled()
+{
+        return detail::enabled.load(std::memory_order_relaxed);
+}
+
+//! Record a span of the calling thread. name has to outlive the recording, e.g. a literal.
+void
+record(const char *name,
+       std::chrono::steady_clock::time_point start,
+       std::chrono::steady_clock::time_point end);
+
+//! Records the time from its construction to its destruction as a span, if tracing is enabled.
+class Span
+{
+public:
+        explicit Span(const char *name)
+          : name_(enabled() ? name : nullptr)
+        {
+                if (name_)
+                        start_ = std::chrono::steady_clock::now();
+        }
+        ~Span()
+        {
+                if (name_)
+                        record(name_, start_, std::chrono::steady_clock::now());
+        }
+
+        Span(const Span &) = delete;
+        Span &operator=(const Span &) = delete;
+
+private:
+        const char *name_;
+        std::chrono::steady_clock::time_point start_;
+};
+}
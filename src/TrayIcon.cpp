@@ -28,17 +28,46 @@
 #include <QtMacExtras>
 #endif
 
+//! The composed pixmaps kept. The tray asks for a few sizes of the recent counts.
+constexpr int PIXMAP_CACHE_SIZE = 32;
+//! Larger counts don't fit the bubble anyway.
+constexpr int MAX_SHOWN_COUNT = 99;
+
 MsgCountComposedIcon::MsgCountComposedIcon(const QString &filename)
   : QIconEngine()
+  , pixmaps_(std::make_shared<QCache<QString, QPixmap>>(PIXMAP_CACHE_SIZE))
 {
         icon_ = QIcon(filename);
 }
 
+QString
+MsgCountComposedIcon::countText(int count)
+{
+        if (count <= 0)
+                return {};
+        if (count > MAX_SHOWN_COUNT)
+                return QString::number(MAX_SHOWN_COUNT) + "+";
+        return QString::number(count);
+}
+
 void
 MsgCountComposedIcon::paint(QPainter *painter,
                             const QRect &rect,
                             QIcon::Mode mode,
                             QIcon::State state)
+{
+        const qreal ratio = painter->device() ? painter->device()->devicePixelRatioF() : 1;
+
+        auto composed = pixmap(rect.size() * ratio, mode, state);
+        composed.setDevicePixelRatio(ratio);
+        painter->drawPixmap(rect, composed);
+}
+
+void
+MsgCountComposedIcon::render(QPainter *painter,
+                             const QRect &rect,
+                             QIcon::Mode mode,
+                             QIcon::State state)
 {
         painter->setRenderHint(QPainter::TextAntialiasing);
         painter->setRenderHint(QPainter::SmoothPixmapTransform);
@@ -46,7 +75,8 @@ MsgCountComposedIcon::paint(QPainter *painter,
 
         icon_.paint(painter, rect, Qt::AlignCenter, mode, state);
 
-        if (msgCount <= 0)
+        const auto text = countText(msgCount);
+        if (text.isEmpty())
                 return;
 
         QColor backgroundColor("red");
@@ -71,7 +101,7 @@ MsgCountComposedIcon::paint(QPainter *painter,
         painter->drawEllipse(bubble);
         painter->setPen(QPen(textColor));
         painter->setBrush(Qt::NoBrush);
-        painter->drawText(bubble, Qt::AlignCenter, QString::number(msgCount));
+        painter->drawText(bubble, Qt::AlignCenter, text);
 }
 
 QIconEngine *
@@ -98,13 +128,25 @@ MsgCountComposedIcon::availableSizes(QIcon::Mode mode, QIcon::State state) const
 QPixmap
 MsgCountComposedIcon::pixmap(const QSize &size, QIcon::Mode mode, QIcon::State state)
 {
+        // The size is in device pixels already, so it covers the device pixel ratio.
+        const auto key = QStringLiteral("%1/%2x%3/%4/%5")
+                           .arg(countText(msgCount))
+                           .arg(size.width())
+                           .arg(size.height())
+                           .arg(static_cast<int>(mode))
+                           .arg(static_cast<int>(state));
+        if (auto cached = pixmaps_->object(key))
+                return *cached;
+
         QImage img(size, QImage::Format_ARGB32);
         img.fill(qRgba(0, 0, 0, 0));
         QPixmap result = QPixmap::fromImage(img, Qt::NoFormatConversion);
         {
                 QPainter painter(&result);
-                paint(&painter, QRect(QPoint(0, 0), size), mode, state);
+                render(&painter, QRect(QPoint(0, 0), size), mode, state);
         }
+
+        pixmaps_->insert(key, new QPixmap(result));
         return result;
 }
 
@@ -149,7 +191,9 @@ TrayIcon::setUnreadCount(int count)
 #elif defined(Q_OS_WIN)
 // FIXME: Find a way to use Windows apis for the badge counter (if any).
 #else
-        if (count == icon_->msgCount)
+        // Only drawn again, if the bubble changes.
+        if (MsgCountComposedIcon::countText(count) ==
+            MsgCountComposedIcon::countText(icon_->msgCount))
                 return;
 
         // Custom drawing on Linux.
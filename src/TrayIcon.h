@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <memory>
+
+#include <QCache>
 #include <QIcon>
 #include <QIconEngine>
 #include <QRect>
@@ -25,6 +28,10 @@
 class QAction;
 class QPainter;
 
+//! The tray icon with a bubble of the unread messages.
+//!
+//! The composed pixmaps are cached by the shown count, size and mode, and the cache is shared
+//! with the clones, so a count, which was shown before, isn't drawn again.
 class MsgCountComposedIcon : public QIconEngine
 {
 public:
@@ -35,12 +42,19 @@ public:
         QList<QSize> availableSizes(QIcon::Mode mode, QIcon::State state) const override;
         QPixmap pixmap(const QSize &size, QIcon::Mode mode, QIcon::State state) override;
 
+        //! The text of the bubble for a count. Large counts share one.
+        static QString countText(int count);
+
         int msgCount = 0;
 
 private:
+        //! Draw the icon and the bubble.
+        void render(QPainter *painter, const QRect &rect, QIcon::Mode mode, QIcon::State state);
+
         const int BubbleDiameter = 17;
 
         QIcon icon_;
+        std::shared_ptr<QCache<QString, QPixmap>> pixmaps_;
 };
 
 class TrayIcon : public QSystemTrayIcon
@@ -15,6 +15,8 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <mutex>
+
 #include <QApplication>
 #include <QComboBox>
 #include <QFileDialog>
@@ -25,19 +27,28 @@
 #include <QMessageBox>
 #include <QPainter>
 #include <QProcessEnvironment>
+#include <QProgressDialog>
 #include <QPushButton>
 #include <QResizeEvent>
+#include <QSaveFile>
 #include <QScrollArea>
 #include <QScroller>
 #include <QSettings>
 #include <QStandardPaths>
 #include <QString>
 #include <QTextStream>
+#include <QtConcurrent>
 
 #include "Cache.h"
 #include "Config.h"
+#include "Logging.h"
 #include "MatrixClient.h"
+#include "MemoryGovernor.h"
+#include "MessageRenderer.h"
+#include "NetworkUsage.h"
 #include "Olm.h"
+#include "PerfReport.h"
+#include "RequestScheduler.h"
 #include "UserSettingsPage.h"
 #include "Utils.h"
 #include "ui/FlatButton.h"
@@ -45,8 +56,45 @@
 
 #include "config/nheko.h"
 
+namespace {
+std::mutex snapshotMutex_;
+std::shared_ptr<const SettingsSnapshot> snapshot_ = std::make_shared<SettingsSnapshot>();
+}
+
 UserSettings::UserSettings() { load(); }
 
+std::shared_ptr<const SettingsSnapshot>
+UserSettings::snapshot()
+{
+        std::unique_lock<std::mutex> lock(snapshotMutex_);
+        return snapshot_;
+}
+
+void
+UserSettings::reloadSnapshot()
+{
+        // Default to system theme if QT_QPA_PLATFORMTHEME var is set.
+        const QString defaultTheme =
+          QProcessEnvironment::systemEnvironment().value("QT_QPA_PLATFORMTHEME", "").isEmpty()
+            ? "light"
+            : "system";
+
+        QSettings settings;
+        auto snapshot           = std::make_shared<SettingsSnapshot>();
+        snapshot->avatarCircles = settings.value("user/avatar_circles", true).toBool();
+        snapshot->emojiFont     = settings.value("user/emoji_font_family", "emoji").toString();
+        snapshot->theme         = settings.value("user/theme", defaultTheme).toString();
+
+        settings.beginGroup("rooms/respond_to_key_requests");
+        for (const auto &room : settings.childKeys())
+                if (settings.value(room, false).toBool())
+                        snapshot->keyRequestRooms.insert(room);
+        settings.endGroup();
+
+        std::unique_lock<std::mutex> lock(snapshotMutex_);
+        snapshot_ = std::move(snapshot);
+}
+
 void
 UserSettings::load()
 {
@@ -64,9 +112,16 @@ UserSettings::load()
         font_                         = settings.value("user/font_family", "default").toString();
         avatarCircles_                = settings.value("user/avatar_circles", true).toBool();
         decryptSidebar_               = settings.value("user/decrypt_sidebar", true).toBool();
-        emojiFont_    = settings.value("user/emoji_font_family", "default").toString();
-        baseFontSize_ = settings.value("user/font_size", QFont().pointSizeF()).toDouble();
-
+        lowMemory_                    = settings.value("user/low_memory", false).toBool();
+        perfSnapshots_                = settings.value("user/perf_snapshots", false).toBool();
+        emojiFont_       = settings.value("user/emoji_font_family", "default").toString();
+        baseFontSize_    = settings.value("user/font_size", QFont().pointSizeF()).toDouble();
+        cacheDurability_ = settings.value("user/cache_durability", "full").toString();
+        logLevel_        = settings.value("user/logging/level", "info").toString();
+        maxDownloads_    = settings.value("user/network/parallel_downloads", 6).toInt();
+        trafficBudget_   = settings.value("user/network/hourly_budget_mb", 0).toInt();
+
+        reloadSnapshot();
         applyTheme();
 }
 
@@ -89,6 +144,9 @@ UserSettings::setEmojiFontFamily(QString family)
 {
         emojiFont_ = family;
         save();
+
+        // The rendered bodies contain the font of their emoji.
+        MessageRenderer::instance().clear();
 }
 
 void
@@ -169,6 +227,8 @@ UserSettings::save()
 
         settings.setValue("avatar_circles", avatarCircles_);
         settings.setValue("decrypt_sidebar", decryptSidebar_);
+        settings.setValue("low_memory", lowMemory_);
+        settings.setValue("perf_snapshots", perfSnapshots_);
         settings.setValue("font_size", baseFontSize_);
         settings.setValue("typing_notifications", isTypingNotificationsEnabled_);
         settings.setValue("minor_events", sortByImportance_);
@@ -179,8 +239,14 @@ UserSettings::save()
         settings.setValue("theme", theme());
         settings.setValue("font_family", font_);
         settings.setValue("emoji_font_family", emojiFont_);
+        settings.setValue("cache_durability", cacheDurability_);
+        settings.setValue("logging/level", logLevel_);
+        settings.setValue("network/parallel_downloads", maxDownloads_);
+        settings.setValue("network/hourly_budget_mb", trafficBudget_);
 
         settings.endGroup();
+
+        reloadSnapshot();
 }
 
 HorizontalLine::HorizontalLine(QWidget *parent)
@@ -232,6 +298,8 @@ UserSettingsPage::UserSettingsPage(QSharedPointer<UserSettings> settings, QWidge
         startInTrayToggle_       = new Toggle{this};
         avatarCircles_           = new Toggle{this};
         decryptSidebar_          = new Toggle(this);
+        lowMemory_               = new Toggle{this};
+        perfSnapshots_           = new Toggle{this};
         groupViewToggle_         = new Toggle{this};
         timelineButtonsToggle_   = new Toggle{this};
         typingNotifications_     = new Toggle{this};
@@ -287,6 +355,54 @@ UserSettingsPage::UserSettingsPage(QSharedPointer<UserSettings> settings, QWidge
         int themeIndex = themeCombo_->findText(themeStr);
         themeCombo_->setCurrentIndex(themeIndex);
 
+        cacheDurabilityCombo_ = new QComboBox{this};
+        cacheDurabilityCombo_->addItem(tr("Full"), "full");
+        cacheDurabilityCombo_->addItem(tr("Relaxed"), "relaxed");
+        cacheDurabilityCombo_->addItem(tr("Fast"), "fast");
+        cacheDurabilityCombo_->setToolTip(
+          tr("Full writes every change to disk immediately. Relaxed and Fast write less often, "
+             "which is faster on slow disks. After a power loss, Relaxed may undo the latest "
+             "changes and Fast may corrupt the cache, which then has to be cleared. Encryption "
+             "keys are always written immediately."));
+        cacheDurabilityCombo_->setCurrentIndex(
+          cacheDurabilityCombo_->findData(settings_->cacheDurability()));
+
+        lowMemory_->setToolTip(
+          tr("Keep fewer timelines, avatars, members and encryption keys in memory, for machines "
+             "with little memory. Rooms, which weren't viewed recently, load a bit slower."));
+        perfSnapshots_->setToolTip(
+          tr("Write the performance statistics to perf-snapshots.json in the log directory "
+             "every five minutes. They stay on this device."));
+
+        logLevelCombo_ = new QComboBox{this};
+        logLevelCombo_->addItem(tr("Debug"), "debug");
+        logLevelCombo_->addItem(tr("Info"), "info");
+        logLevelCombo_->addItem(tr("Warning"), "warn");
+        logLevelCombo_->addItem(tr("Error"), "error");
+        logLevelCombo_->setToolTip(tr("The least severe messages written to the log. Debug "
+                                      "messages on the command line override it."));
+        logLevelCombo_->setCurrentIndex(logLevelCombo_->findData(settings_->logLevel()));
+
+        maxDownloadsCombo_ = new QComboBox{this};
+        for (int count : {2, 4, 6, 8, 12, 16})
+                maxDownloadsCombo_->addItem(QString::number(count), count);
+        maxDownloadsCombo_->setToolTip(
+          tr("How many images and avatars are downloaded at once. More downloads fill the "
+             "timeline faster on a fast connection, but may be rate limited by the server. "
+             "Messages and the sync don't wait for them."));
+        maxDownloadsCombo_->setCurrentIndex(
+          maxDownloadsCombo_->findData(settings_->maxDownloads()));
+
+        trafficBudgetCombo_ = new QComboBox{this};
+        trafficBudgetCombo_->addItem(tr("Unlimited"), 0);
+        for (int megabytes : {10, 50, 100, 500})
+                trafficBudgetCombo_->addItem(tr("%1 MB").arg(megabytes), megabytes);
+        trafficBudgetCombo_->setToolTip(
+          tr("Once the traffic of an hour exceeds this, images are only downloaded, when they are "
+             "shown, until the next hour. For metered connections."));
+        trafficBudgetCombo_->setCurrentIndex(
+          trafficBudgetCombo_->findData(settings_->trafficBudget()));
+
         auto encryptionLabel_ = new QLabel{tr("ENCRYPTION"), this};
         encryptionLabel_->setFixedHeight(encryptionLabel_->minimumHeight() + LayoutTopMargin);
         encryptionLabel_->setAlignment(Qt::AlignBottom);
@@ -363,6 +479,12 @@ UserSettingsPage::UserSettingsPage(QSharedPointer<UserSettings> settings, QWidge
 #endif
 
         boxWrap(tr("Theme"), themeCombo_);
+        boxWrap(tr("Cache durability"), cacheDurabilityCombo_);
+        boxWrap(tr("Low memory profile"), lowMemory_);
+        boxWrap(tr("Performance snapshots"), perfSnapshots_);
+        boxWrap(tr("Log level"), logLevelCombo_);
+        boxWrap(tr("Parallel downloads"), maxDownloadsCombo_);
+        boxWrap(tr("Hourly traffic budget"), trafficBudgetCombo_);
         formLayout_->addRow(encryptionLabel_);
         formLayout_->addRow(new HorizontalLine{this});
         boxWrap(tr("Device ID"), deviceIdValue_);
@@ -400,6 +522,34 @@ UserSettingsPage::UserSettingsPage(QSharedPointer<UserSettings> settings, QWidge
                         settings_->setTheme(text.toLower());
                         emit themeChanged();
                 });
+        connect(cacheDurabilityCombo_,
+                static_cast<void (QComboBox::*)(int)>(&QComboBox::activated),
+                [this](int index) {
+                        const auto mode = cacheDurabilityCombo_->itemData(index).toString();
+                        settings_->setCacheDurability(mode);
+                        cache::setDurability(mode);
+                });
+        connect(logLevelCombo_,
+                static_cast<void (QComboBox::*)(int)>(&QComboBox::activated),
+                [this](int index) {
+                        const auto level = logLevelCombo_->itemData(index).toString();
+                        settings_->setLogLevel(level);
+                        nhlog::setLevel(level.toStdString());
+                });
+        connect(maxDownloadsCombo_,
+                static_cast<void (QComboBox::*)(int)>(&QComboBox::activated),
+                [this](int index) {
+                        const auto count = maxDownloadsCombo_->itemData(index).toInt();
+                        settings_->setMaxDownloads(count);
+                        http::setMaxDownloads(count);
+                });
+        connect(trafficBudgetCombo_,
+                static_cast<void (QComboBox::*)(int)>(&QComboBox::activated),
+                [this](int index) {
+                        const auto megabytes = trafficBudgetCombo_->itemData(index).toInt();
+                        settings_->setTrafficBudget(megabytes);
+                        http::setTrafficBudget(uint64_t(megabytes) * 1024 * 1024);
+                });
         connect(scaleFactorCombo_,
                 static_cast<void (QComboBox::*)(const QString &)>(&QComboBox::activated),
                 [](const QString &factor) { utils::setScaleFactor(factor.toFloat()); });
@@ -435,6 +585,16 @@ UserSettingsPage::UserSettingsPage(QSharedPointer<UserSettings> settings, QWidge
                 emit decryptSidebarChanged();
         });
 
+        connect(lowMemory_, &Toggle::toggled, this, [this](bool isDisabled) {
+                settings_->setLowMemory(!isDisabled);
+                memory::enforce();
+        });
+
+        connect(perfSnapshots_, &Toggle::toggled, this, [this](bool isDisabled) {
+                settings_->setPerfSnapshots(!isDisabled);
+                perf::start();
+        });
+
         connect(avatarCircles_, &Toggle::toggled, this, [this](bool isDisabled) {
                 settings_->setAvatarCircles(!isDisabled);
         });
@@ -488,6 +648,8 @@ UserSettingsPage::showEvent(QShowEvent *)
         startInTrayToggle_->setState(!settings_->isStartInTrayEnabled());
         groupViewToggle_->setState(!settings_->isGroupViewEnabled());
         decryptSidebar_->setState(!settings_->isDecryptSidebarEnabled());
+        lowMemory_->setState(!settings_->isLowMemoryEnabled());
+        perfSnapshots_->setState(!settings_->isPerfSnapshotsEnabled());
         avatarCircles_->setState(!settings_->isAvatarCirclesEnabled());
         typingNotifications_->setState(!settings_->isTypingNotificationsEnabled());
         sortByImportance_->setState(!settings_->isSortByImportanceEnabled());
@@ -513,6 +675,9 @@ UserSettingsPage::paintEvent(QPaintEvent *)
 void
 UserSettingsPage::importSessionKeys()
 {
+        if (sessionKeysBusy_)
+                return;
+
         const QString homeFolder = QStandardPaths::writableLocation(QStandardPaths::HomeLocation);
         const QString fileName =
           QFileDialog::getOpenFileName(this, tr("Open Sessions File"), homeFolder, "");
@@ -525,6 +690,7 @@ UserSettingsPage::importSessionKeys()
 
         auto bin     = file.peek(file.size());
         auto payload = std::string(bin.data(), bin.size());
+        bin.clear();
 
         bool ok;
         auto password = QInputDialog::getText(this,
@@ -541,22 +707,37 @@ UserSettingsPage::importSessionKeys()
                 return;
         }
 
-        try {
-                auto sessions =
-                  mtx::crypto::decrypt_exported_sessions(payload, password.toStdString());
-                cache::importSessionKeys(std::move(sessions));
-        } catch (const mtx::crypto::sodium_exception &e) {
-                QMessageBox::warning(this, tr("Error"), e.what());
-        } catch (const lmdb::error &e) {
-                QMessageBox::warning(this, tr("Error"), e.what());
-        } catch (const nlohmann::json::exception &e) {
-                QMessageBox::warning(this, tr("Error"), e.what());
-        }
+        showSessionKeysProgress(tr("Importing session keys..."));
+
+        QtConcurrent::run([this, payload = std::move(payload), password]() {
+                QString error;
+                try {
+                        const auto sessions =
+                          mtx::crypto::decrypt_exported_sessions(payload, password.toStdString());
+                        cache::importSessionKeys(
+                          sessions, [this](std::size_t done, std::size_t total) {
+                                  emit sessionKeysProgress(static_cast<int>(done),
+                                                           static_cast<int>(total));
+                                  return !cancelSessionKeys_;
+                          });
+                } catch (const mtx::crypto::sodium_exception &e) {
+                        error = e.what();
+                } catch (const lmdb::error &e) {
+                        error = e.what();
+                } catch (const nlohmann::json::exception &e) {
+                        error = e.what();
+                }
+
+                emit sessionKeysFinished(error);
+        });
 }
 
 void
 UserSettingsPage::exportSessionKeys()
 {
+        if (sessionKeysBusy_)
+                return;
+
         // Open password dialog.
         bool ok;
         auto password = QInputDialog::getText(this,
@@ -578,30 +759,84 @@ UserSettingsPage::exportSessionKeys()
         const QString fileName =
           QFileDialog::getSaveFileName(this, tr("File to save the exported session keys"), "", "");
 
-        QFile file(fileName);
-        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
-                QMessageBox::warning(this, tr("Error"), file.errorString());
+        if (fileName.isEmpty())
                 return;
-        }
 
-        // Export sessions & save to file.
-        try {
-                auto encrypted_blob = mtx::crypto::encrypt_exported_sessions(
-                  cache::exportSessionKeys(), password.toStdString());
-
-                QString b64 = QString::fromStdString(mtx::crypto::bin2base64(encrypted_blob));
-
-                QString prefix("-----BEGIN MEGOLM SESSION DATA-----");
-                QString suffix("-----END MEGOLM SESSION DATA-----");
-                QString newline("\n");
-                QTextStream out(&file);
-                out << prefix << newline << b64 << newline << suffix;
-                file.close();
-        } catch (const mtx::crypto::sodium_exception &e) {
-                QMessageBox::warning(this, tr("Error"), e.what());
-        } catch (const lmdb::error &e) {
-                QMessageBox::warning(this, tr("Error"), e.what());
-        } catch (const nlohmann::json::exception &e) {
-                QMessageBox::warning(this, tr("Error"), e.what());
-        }
+        showSessionKeysProgress(tr("Exporting session keys..."));
+
+        // Export sessions & save to file. The file is only replaced, once all keys are written.
+        QtConcurrent::run([this, fileName, password]() {
+                QString error;
+                try {
+                        QSaveFile file(fileName);
+                        if (!file.open(QIODevice::WriteOnly | QIODevice::Text)) {
+                                emit sessionKeysFinished(file.errorString());
+                                return;
+                        }
+
+                        const auto sessions = cache::exportSessionKeys(
+                          [this](std::size_t done, std::size_t total) {
+                                  emit sessionKeysProgress(static_cast<int>(done),
+                                                           static_cast<int>(total));
+                                  return !cancelSessionKeys_;
+                          });
+
+                        if (!sessions) {
+                                file.cancelWriting();
+                                emit sessionKeysFinished(error);
+                                return;
+                        }
+
+                        auto encrypted_blob =
+                          mtx::crypto::encrypt_exported_sessions(*sessions, password.toStdString());
+
+                        QTextStream out(&file);
+                        out << "-----BEGIN MEGOLM SESSION DATA-----\n"
+                            << QString::fromStdString(mtx::crypto::bin2base64(encrypted_blob))
+                            << "\n-----END MEGOLM SESSION DATA-----";
+                        out.flush();
+
+                        if (!file.commit())
+                                error = file.errorString();
+                } catch (const mtx::crypto::sodium_exception &e) {
+                        error = e.what();
+                } catch (const lmdb::error &e) {
+                        error = e.what();
+                } catch (const nlohmann::json::exception &e) {
+                        error = e.what();
+                }
+
+                emit sessionKeysFinished(error);
+        });
+}
+
+void
+UserSettingsPage::showSessionKeysProgress(const QString &label)
+{
+        sessionKeysBusy_   = true;
+        cancelSessionKeys_ = false;
+
+        auto dialog = new QProgressDialog(label, tr("Cancel"), 0, 0, this);
+        dialog->setAttribute(Qt::WA_DeleteOnClose, true);
+        dialog->setWindowModality(Qt::WindowModal);
+        dialog->setMinimumDuration(0);
+
+        connect(dialog, &QProgressDialog::canceled, this, [this]() { cancelSessionKeys_ = true; });
+        connect(
+          this, &UserSettingsPage::sessionKeysProgress, dialog, [dialog](int done, int total) {
+                  dialog->setMaximum(total);
+                  dialog->setValue(done);
+          });
+        connect(this,
+                &UserSettingsPage::sessionKeysFinished,
+                dialog,
+                [this, dialog](const QString &error) {
+                        sessionKeysBusy_ = false;
+                        dialog->close();
+
+                        if (!error.isEmpty())
+                                QMessageBox::warning(this, tr("Error"), error);
+                });
+
+        dialog->show();
 }
@@ -17,6 +17,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <memory>
+
 #include <QComboBox>
 #include <QFontDatabase>
 #include <QFormLayout>
@@ -24,6 +27,7 @@
 #include <QLabel>
 #include <QLayout>
 #include <QProcessEnvironment>
+#include <QSet>
 #include <QSharedPointer>
 #include <QWidget>
 
@@ -33,6 +37,18 @@ constexpr int OptionMargin       = 6;
 constexpr int LayoutTopMargin    = 50;
 constexpr int LayoutBottomMargin = LayoutTopMargin;
 
+//! The settings, which are read while painting, for every message or for every key request.
+//! QSettings locks and may stat the file on every read, so these are read from a copy, which is
+//! replaced, whenever the settings are saved.
+struct SettingsSnapshot
+{
+        bool avatarCircles = true;
+        QString emojiFont  = "emoji";
+        QString theme;
+        //! The rooms, in which the keys are shared with the devices of other users.
+        QSet<QString> keyRequestRooms;
+};
+
 class UserSettings : public QObject
 {
         Q_OBJECT
@@ -42,6 +58,10 @@ public:
 
         void save();
         void load();
+        //! The current settings of the hot paths. Safe from any thread.
+        static std::shared_ptr<const SettingsSnapshot> snapshot();
+        //! Read the settings of the snapshot again, after they were written outside of this class.
+        static void reloadSnapshot();
         void applyTheme();
         void setTheme(QString theme);
         void setTray(bool state)
@@ -117,12 +137,52 @@ public:
                 save();
         }
 
+        void setLowMemory(bool state)
+        {
+                lowMemory_ = state;
+                save();
+        }
+
+        void setPerfSnapshots(bool state)
+        {
+                perfSnapshots_ = state;
+                save();
+        }
+
+        void setCacheDurability(QString mode)
+        {
+                cacheDurability_ = mode;
+                save();
+        }
+
+        void setLogLevel(QString level)
+        {
+                logLevel_ = level;
+                save();
+        }
+
+        void setMaxDownloads(int count)
+        {
+                maxDownloads_ = count;
+                save();
+        }
+
+        void setTrafficBudget(int megabytes)
+        {
+                trafficBudget_ = megabytes;
+                save();
+        }
+
         QString theme() const { return !theme_.isEmpty() ? theme_ : defaultTheme_; }
         bool isTrayEnabled() const { return isTrayEnabled_; }
         bool isStartInTrayEnabled() const { return isStartInTrayEnabled_; }
         bool isGroupViewEnabled() const { return isGroupViewEnabled_; }
         bool isAvatarCirclesEnabled() const { return avatarCircles_; }
         bool isDecryptSidebarEnabled() const { return decryptSidebar_; }
+        //! Whether the caches and models use the smaller budgets of the low memory profile.
+        bool isLowMemoryEnabled() const { return lowMemory_; }
+        //! Whether snapshots of the performance statistics are written to the log directory.
+        bool isPerfSnapshotsEnabled() const { return perfSnapshots_; }
         bool isMarkdownEnabled() const { return isMarkdownEnabled_; }
         bool isTypingNotificationsEnabled() const { return isTypingNotificationsEnabled_; }
         bool isSortByImportanceEnabled() const { return sortByImportance_; }
@@ -132,6 +192,11 @@ public:
         double fontSize() const { return baseFontSize_; }
         QString font() const { return font_; }
         QString emojiFont() const { return emojiFont_; }
+        QString cacheDurability() const { return cacheDurability_; }
+        QString logLevel() const { return logLevel_; }
+        int maxDownloads() const { return maxDownloads_; }
+        //! MiB per hour, 0 if unlimited.
+        int trafficBudget() const { return trafficBudget_; }
 
 signals:
         void groupViewStateChanged(bool state);
@@ -155,9 +220,15 @@ private:
         bool hasDesktopNotifications_;
         bool avatarCircles_;
         bool decryptSidebar_;
+        bool lowMemory_;
+        bool perfSnapshots_;
         double baseFontSize_;
         QString font_;
         QString emojiFont_;
+        QString cacheDurability_;
+        QString logLevel_;
+        int maxDownloads_;
+        int trafficBudget_;
 };
 
 class HorizontalLine : public QFrame
@@ -185,11 +256,19 @@ signals:
         void themeChanged();
         void decryptSidebarChanged();
 
+        //! Progress of the running export or import of the session keys, from its thread.
+        void sessionKeysProgress(int done, int total);
+        //! The export or import finished, failed with the error or was cancelled.
+        void sessionKeysFinished(const QString &error);
+
 private slots:
         void importSessionKeys();
         void exportSessionKeys();
 
 private:
+        //! Show the progress of an export or import of the session keys, which can cancel it.
+        void showSessionKeysProgress(const QString &label);
+
         // Layouts
         QVBoxLayout *topLayout_;
         QHBoxLayout *topBarLayout_;
@@ -209,14 +288,23 @@ private:
         Toggle *desktopNotifications_;
         Toggle *avatarCircles_;
         Toggle *decryptSidebar_;
+        Toggle *lowMemory_;
+        Toggle *perfSnapshots_;
         QLabel *deviceFingerprintValue_;
         QLabel *deviceIdValue_;
 
         QComboBox *themeCombo_;
+        QComboBox *cacheDurabilityCombo_;
+        QComboBox *logLevelCombo_;
+        QComboBox *maxDownloadsCombo_;
+        QComboBox *trafficBudgetCombo_;
         QComboBox *scaleFactorCombo_;
         QComboBox *fontSizeCombo_;
         QComboBox *fontSelectionCombo_;
         QComboBox *emojiFontSelectionCombo_;
 
         int sideMargin_ = 0;
+
+        std::atomic_bool sessionKeysBusy_{false};
+        std::atomic_bool cancelSessionKeys_{false};
 };
@@ -6,20 +6,32 @@
 #include <QDesktopWidget>
 #include <QGuiApplication>
 #include <QImageReader>
-#include <QProcessEnvironment>
+#include <QPainter>
+#include <QPainterPath>
 #include <QScreen>
 #include <QSettings>
 #include <QTextDocument>
 #include <QXmlStreamReader>
 
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <cmath>
+#include <iterator>
+#include <string_view>
 #include <variant>
 
+#if defined(Q_OS_UNIX)
+#include <sys/resource.h>
+#endif
+
 #include <cmark.h>
 
 #include "Cache.h"
 #include "Config.h"
+#include "EventTraits.h"
 #include "MatrixClient.h"
+#include "UserSettingsPage.h"
 
 using TimelineEvent = mtx::events::collections::TimelineEvents;
 
@@ -50,39 +62,192 @@ utils::localUser()
         return QString::fromStdString(http::client()->user_id().to_string());
 }
 
-QString
-utils::replaceEmoji(const QString &body)
+namespace {
+//! \s of the url regex, which matched only ascii white space.
+constexpr bool
+isAsciiSpace(ushort c)
 {
-        QString fmtBody = "";
+        return c == ' ' || (c >= '\t' && c <= '\r');
+}
 
-        QVector<uint> utf32_string = body.toUcs4();
+constexpr bool
+isUrlCharacter(ushort c)
+{
+        return !isAsciiSpace(c) && c != '<' && c != '>' && c != '\'' && c != '"';
+}
 
-        QSettings settings;
-        QString userFontFamily = settings.value("user/emoji_font_family", "emoji").toString();
-
-        bool insideFontBlock = false;
-        for (auto &code : utf32_string) {
-                // TODO: Be more precise here.
-                if ((code >= 0x2600 && code <= 0x27bf) || (code >= 0x1f300 && code <= 0x1f3ff) ||
-                    (code >= 0x1f000 && code <= 0x1faff)) {
-                        if (!insideFontBlock) {
-                                fmtBody += QString("<font face=\"" + userFontFamily + "\">");
-                                insideFontBlock = true;
+//! Punctuation, which ends a sentence rather than the url before it.
+constexpr bool
+isTrailingPunctuation(ushort c)
+{
+        return c == '!' || c == ',' || c == '.' || c == ']' || c == ')' || c == ':';
+}
+
+constexpr bool
+isLowerAscii(ushort c)
+{
+        return c >= 'a' && c <= 'z';
+}
+
+constexpr bool
+isSchemeCharacter(ushort c)
+{
+        return isLowerAscii(c) || (c >= '0' && c <= '9') || c == '+' || c == '.' || c == '-';
+}
+
+//! The emoji the emoji font is used for.
+constexpr bool
+isEmoji(uint code)
+{
+        // TODO: Be more precise here.
+        return (code >= 0x2600 && code <= 0x27bf) || (code >= 0x1f000 && code <= 0x1faff);
+}
+
+//! The end of a url, whose address after the scheme starts at begin, or -1. The url doesn't end
+//! in punctuation and mustn't be quoted, so links in html aren't linkified again.
+int
+urlEnd(const ushort *text, int size, int begin)
+{
+        int end = begin;
+        while (end < size && isUrlCharacter(text[end]))
+                end++;
+
+        int last = end - 1;
+        while (last > begin && isTrailingPunctuation(text[last]))
+                last--;
+
+        if (last <= begin || (last + 1 < size && text[last + 1] == '"'))
+                return -1;
+        return last + 1;
+}
+
+constexpr char16_t MATRIX_TO_PREFIX[] = u"https://matrix.to/#/";
+}
+
+std::vector<utils::MessageSpan>
+utils::findMessageSpans(const QString &body, bool urls, bool emoji)
+{
+        const ushort *text = body.utf16();
+        const int size     = body.size();
+
+        std::vector<MessageSpan> spans;
+
+        // The scheme characters and the url after a "://" are the same for every start of the
+        // url in the scheme, so they are only scanned once.
+        int schemeEnd = 0, addressBegin = -1, addressEnd = -1;
+        auto addressEndAt = [&](int begin) {
+                if (begin != addressBegin) {
+                        addressBegin = begin;
+                        addressEnd   = urlEnd(text, size, begin);
+                }
+                return addressEnd;
+        };
+
+        for (int i = 0; i < size;) {
+                const ushort c = text[i];
+
+                if (urls && isLowerAscii(c) && (i == 0 || text[i - 1] != '"')) {
+                        int end = -1;
+                        if (c == 'w' && i + 4 < size && text[i + 1] == 'w' && text[i + 2] == 'w' &&
+                            text[i + 3] == '.' && text[i + 4] != '.')
+                                end = addressEndAt(i + 4);
+
+                        if (end < 0) {
+                                for (schemeEnd = std::max(schemeEnd, i);
+                                     schemeEnd < size && isSchemeCharacter(text[schemeEnd]);)
+                                        schemeEnd++;
+                                if (schemeEnd + 3 <= size && text[schemeEnd] == ':' &&
+                                    text[schemeEnd + 1] == '/' && text[schemeEnd + 2] == '/')
+                                        end = addressEndAt(schemeEnd + 3);
                         }
 
-                } else {
-                        if (insideFontBlock) {
-                                fmtBody += "</font>";
-                                insideFontBlock = false;
+                        if (end >= 0) {
+                                const auto length = static_cast<std::size_t>(end - i);
+                                const bool pill =
+                                  length > std::size(MATRIX_TO_PREFIX) - 1 &&
+                                  std::equal(std::begin(MATRIX_TO_PREFIX),
+                                             std::end(MATRIX_TO_PREFIX) - 1,
+                                             text + i);
+                                spans.push_back(
+                                  {pill ? MessageSpan::Pill : MessageSpan::Url, i, end - i});
+                                i = end;
+                                continue;
+                        }
+                }
+
+                if (emoji && c >= 0x2600) {
+                        uint code  = c;
+                        int length = 1;
+                        if (QChar::isHighSurrogate(c) && i + 1 < size &&
+                            QChar::isLowSurrogate(text[i + 1])) {
+                                code   = QChar::surrogateToUcs4(c, text[i + 1]);
+                                length = 2;
+                        }
+
+                        if (isEmoji(code)) {
+                                // Consecutive emoji share one span.
+                                if (!spans.empty() && spans.back().kind == MessageSpan::Emoji &&
+                                    spans.back().begin + spans.back().length == i)
+                                        spans.back().length += length;
+                                else
+                                        spans.push_back({MessageSpan::Emoji, i, length});
                         }
+
+                        i += length;
+                        continue;
                 }
-                fmtBody += QString::fromUcs4(&code, 1);
+
+                i++;
         }
-        if (insideFontBlock) {
-                fmtBody += "</font>";
+
+        return spans;
+}
+
+QString
+utils::applyMessageSpans(const QString &body, const std::vector<MessageSpan> &spans)
+{
+        if (spans.empty())
+                return body;
+
+        const bool hasEmoji =
+          std::any_of(spans.begin(), spans.end(), [](const MessageSpan &span) {
+                  return span.kind == MessageSpan::Emoji;
+          });
+
+        QString emojiFont;
+        if (hasEmoji)
+                emojiFont = "<font face=\"" + UserSettings::snapshot()->emojiFont + "\">";
+
+        QString result;
+        result.reserve(body.size() + static_cast<int>(spans.size()) * 32);
+
+        int pos = 0;
+        for (const auto &span : spans) {
+                result.append(body.midRef(pos, span.begin - pos));
+
+                const auto part = body.midRef(span.begin, span.length);
+                switch (span.kind) {
+                case MessageSpan::Url:
+                case MessageSpan::Pill:
+                        result.append("<a href=\"").append(part).append("\">");
+                        result.append(part).append("</a>");
+                        break;
+                case MessageSpan::Emoji:
+                        result.append(emojiFont).append(part).append("</font>");
+                        break;
+                }
+
+                pos = span.begin + span.length;
         }
+        result.append(body.midRef(pos));
 
-        return fmtBody;
+        return result;
+}
+
+QString
+utils::replaceEmoji(const QString &body)
+{
+        return applyMessageSpans(body, findMessageSpans(body, false, true));
 }
 
 void
@@ -114,8 +279,7 @@ utils::respondsToKeyRequests(const QString &roomId)
         if (roomId.isEmpty())
                 return false;
 
-        QSettings settings;
-        return settings.value("rooms/respond_to_key_requests/" + roomId, false).toBool();
+        return UserSettings::snapshot()->keyRequestRooms.contains(roomId);
 }
 
 void
@@ -126,6 +290,7 @@ utils::setKeyRequestsPreference(QString roomId, bool value)
 
         QSettings settings;
         settings.setValue("rooms/respond_to_key_requests/" + roomId, value);
+        UserSettings::reloadSnapshot();
 }
 
 QString
@@ -158,6 +323,10 @@ utils::getMessageDescription(const TimelineEvent &event,
         using Video     = mtx::events::RoomEvent<mtx::events::msg::Video>;
         using Encrypted = mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>;
 
+        // Most events aren't messages, so they skip testing every message type.
+        if (!event_traits::isMessage(event))
+                return DescInfo{};
+
         if (std::holds_alternative<Audio>(event)) {
                 return createDescriptionInfo<Audio>(event, localUser, room_id);
         } else if (std::holds_alternative<Emote>(event)) {
@@ -224,32 +393,106 @@ utils::humanReadableFileSize(uint64_t bytes)
         return QString::number(size, 'g', 4) + ' ' + units[u];
 }
 
-int
-utils::levenshtein_distance(const std::string &s1, const std::string &s2)
+uint64_t
+utils::peakMemoryUsage()
 {
-        const int nlen = s1.size();
-        const int hlen = s2.size();
+#if defined(Q_OS_UNIX)
+        struct rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) != 0)
+                return 0;
+
+#if defined(Q_OS_MAC)
+        return static_cast<uint64_t>(usage.ru_maxrss);
+#else
+        // in kilobytes
+        return static_cast<uint64_t>(usage.ru_maxrss) * 1024;
+#endif
+#else
+        return 0;
+#endif
+}
 
-        if (hlen == 0)
-                return -1;
-        if (nlen == 1)
-                return s2.find(s1);
+utils::FuzzyNeedle::FuzzyNeedle(const QString &needle)
+  : length_(std::min(needle.size(), 64))
+{
+        for (int i = 0; i < length_; ++i) {
+                const char16_t unit = needle.at(i).unicode();
+                const uint64_t bit  = uint64_t(1) << i;
 
-        std::vector<int> row1(hlen + 1, 0);
+                if (unit < ascii_.size()) {
+                        ascii_[unit] |= bit;
+                        continue;
+                }
 
-        for (int i = 0; i < nlen; ++i) {
-                std::vector<int> row2(1, i + 1);
+                auto slot = unit % other_.size();
+                while (other_[slot].peq != 0 && other_[slot].unit != unit)
+                        slot = (slot + 1) % other_.size();
 
-                for (int j = 0; j < hlen; ++j) {
-                        const int cost = s1[i] != s2[j];
-                        row2.push_back(
-                          std::min(row1[j + 1] + 1, std::min(row2[j] + 1, row1[j] + cost)));
-                }
+                other_[slot].unit = unit;
+                other_[slot].peq |= bit;
+        }
+}
+
+uint64_t
+utils::FuzzyNeedle::positions(char16_t unit) const
+{
+        if (unit < ascii_.size())
+                return ascii_[unit];
 
-                row1.swap(row2);
+        auto slot = unit % other_.size();
+        while (other_[slot].peq != 0) {
+                if (other_[slot].unit == unit)
+                        return other_[slot].peq;
+
+                slot = (slot + 1) % other_.size();
+        }
+
+        return 0;
+}
+
+int
+utils::FuzzyNeedle::distance(const QString &haystack, int maxDistance) const
+{
+        if (length_ == 0)
+                return 0;
+
+        // The vertical deltas of the column are kept as bits of positive and negative deltas. The
+        // top row is all zeros, so a match may start anywhere in the haystack.
+        const uint64_t last = uint64_t(1) << (length_ - 1);
+        uint64_t pv         = ~uint64_t(0);
+        uint64_t mv         = 0;
+        int score           = length_;
+        int best            = length_;
+
+        const int size  = haystack.size();
+        const auto data = haystack.constData();
+        for (int j = 0; j < size; ++j) {
+                const uint64_t eq = positions(data[j].unicode());
+                const uint64_t xv = eq | mv;
+                const uint64_t xh = (((eq & pv) + pv) ^ pv) | eq;
+
+                uint64_t ph = mv | ~(xh | pv);
+                uint64_t mh = pv & xh;
+                if (ph & last)
+                        ++score;
+                else if (mh & last)
+                        --score;
+
+                ph <<= 1;
+                mh <<= 1;
+                pv = mh | ~(xv | ph);
+                mv = ph & xv;
+
+                best = std::min(best, score);
+                if (best == 0)
+                        return 0;
+
+                // The score falls by at most one per code unit left.
+                if (best > maxDistance && score - (size - j - 1) > maxDistance)
+                        break;
         }
 
-        return *std::min_element(row1.begin(), row1.end());
+        return std::min(best, maxDistance + 1);
 }
 
 QString
@@ -332,58 +575,321 @@ utils::humanReadableFingerprint(const std::string &ed25519)
 QString
 utils::humanReadableFingerprint(const QString &ed25519)
 {
-        QStringList fingerprintList;
+        QString fingerprint;
+        fingerprint.reserve(ed25519.length() + ed25519.length() / 4);
         for (int i = 0; i < ed25519.length(); i = i + 4) {
-                fingerprintList << ed25519.mid(i, 4);
+                if (i > 0)
+                        fingerprint += ' ';
+                fingerprint += ed25519.midRef(i, 4);
         }
-        return fingerprintList.join(" ");
+        return fingerprint;
 }
 
 QString
 utils::linkifyMessage(const QString &body)
 {
-        // Convert to valid XML.
-        auto doc = body;
-        doc.replace(conf::strings::url_regex, conf::strings::url_html);
+        return applyMessageSpans(body, findMessageSpans(body, true, false));
+}
+
+QString
+utils::linkifyAndReplaceEmoji(const QString &body)
+{
+        return applyMessageSpans(body, findMessageSpans(body));
+}
+
+namespace {
+//! The attributes, which are kept on the tags allowing them. See the list of the spec at
+//! https://matrix.org/docs/spec/client_server/latest#m-room-message-msgtypes
+enum HtmlAttribute : uint16_t
+{
+        AttrColor     = 1 << 0,
+        AttrMxColor   = 1 << 1,
+        AttrMxBgColor = 1 << 2,
+        AttrName      = 1 << 3,
+        AttrTarget    = 1 << 4,
+        AttrHref      = 1 << 5,
+        AttrWidth     = 1 << 6,
+        AttrHeight    = 1 << 7,
+        AttrAlt       = 1 << 8,
+        AttrTitle     = 1 << 9,
+        AttrSrc       = 1 << 10,
+        AttrStart     = 1 << 11,
+        AttrClass     = 1 << 12,
+};
+
+constexpr std::array<std::pair<std::string_view, uint16_t>, 13> htmlAttributes = {{
+  {"color", AttrColor},
+  {"data-mx-color", AttrMxColor},
+  {"data-mx-bg-color", AttrMxBgColor},
+  {"name", AttrName},
+  {"target", AttrTarget},
+  {"href", AttrHref},
+  {"width", AttrWidth},
+  {"height", AttrHeight},
+  {"alt", AttrAlt},
+  {"title", AttrTitle},
+  {"src", AttrSrc},
+  {"start", AttrStart},
+  {"class", AttrClass},
+}};
+
+struct HtmlTag
+{
+        std::string_view name;
+        //! The HtmlAttributes kept on the tag.
+        uint16_t attributes = 0;
+};
+
+constexpr std::array allowedHtmlTags = {
+  HtmlTag{"font", AttrColor | AttrMxColor | AttrMxBgColor},
+  HtmlTag{"span", AttrMxColor | AttrMxBgColor},
+  HtmlTag{"a", AttrName | AttrTarget | AttrHref},
+  HtmlTag{"img", AttrWidth | AttrHeight | AttrAlt | AttrTitle | AttrSrc},
+  HtmlTag{"ol", AttrStart},
+  HtmlTag{"code", AttrClass},
+  HtmlTag{"del"},        HtmlTag{"h1"},      HtmlTag{"h2"},     HtmlTag{"h3"},
+  HtmlTag{"h4"},         HtmlTag{"h5"},      HtmlTag{"h6"},     HtmlTag{"blockquote"},
+  HtmlTag{"p"},          HtmlTag{"ul"},      HtmlTag{"sup"},    HtmlTag{"sub"},
+  HtmlTag{"li"},         HtmlTag{"b"},       HtmlTag{"i"},      HtmlTag{"u"},
+  HtmlTag{"strong"},     HtmlTag{"em"},      HtmlTag{"strike"}, HtmlTag{"hr"},
+  HtmlTag{"br"},         HtmlTag{"div"},     HtmlTag{"table"},  HtmlTag{"thead"},
+  HtmlTag{"tbody"},      HtmlTag{"tr"},      HtmlTag{"th"},     HtmlTag{"td"},
+  HtmlTag{"caption"},    HtmlTag{"pre"},
+};
+
+//! The longest allowed tag name, longer names are escaped without a lookup.
+constexpr std::size_t MAX_HTML_TAG_LENGTH = 10;
+constexpr uint32_t HTML_TAG_TABLE_BITS   = 6;
+constexpr std::size_t HTML_TAG_TABLE_SIZE = std::size_t(1) << HTML_TAG_TABLE_BITS;
+//! Chosen, so the allowed tags don't collide in the table.
+constexpr uint32_t HTML_TAG_HASH_SEED = 146'935;
+
+//! FNV-1a of the name, scattered over the table by multiplying with the seed.
+constexpr std::size_t
+htmlTagSlot(std::string_view name)
+{
+        uint32_t hash = 2166136261u;
+        for (char c : name)
+                hash = (hash ^ static_cast<uint8_t>(c)) * 16777619u;
+        return (hash * HTML_TAG_HASH_SEED) >> (32 - HTML_TAG_TABLE_BITS);
+}
+
+constexpr auto htmlTagTable = [] {
+        std::array<HtmlTag, HTML_TAG_TABLE_SIZE> table{};
+        for (const auto &tag : allowedHtmlTags)
+                table[htmlTagSlot(tag.name)] = tag;
+        return table;
+}();
+
+constexpr bool
+htmlTagTableIsPerfect()
+{
+        for (const auto &tag : allowedHtmlTags) {
+                if (tag.name.size() > MAX_HTML_TAG_LENGTH ||
+                    htmlTagTable[htmlTagSlot(tag.name)].name != tag.name)
+                        return false;
+        }
+        return true;
+}
+static_assert(htmlTagTableIsPerfect(), "the allowed html tags collide, change the seed");
+
+//! The allowed tag with the lower case name, or nullptr.
+const HtmlTag *
+findHtmlTag(std::string_view name)
+{
+        const auto &tag = htmlTagTable[htmlTagSlot(name)];
+        return !name.empty() && tag.name == name ? &tag : nullptr;
+}
+
+constexpr bool
+isHtmlSpace(char c)
+{
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f';
+}
 
-        return doc;
+constexpr char
+toLowerAscii(char c)
+{
+        return c >= 'A' && c <= 'Z' ? static_cast<char>(c - 'A' + 'a') : c;
+}
+
+bool
+startsWithIgnoreCase(std::string_view str, std::string_view prefix)
+{
+        if (str.size() < prefix.size())
+                return false;
+        for (std::size_t i = 0; i < prefix.size(); i++)
+                if (toLowerAscii(str[i]) != prefix[i])
+                        return false;
+        return true;
+}
+
+bool
+allowedAttributeValue(uint16_t attribute, std::string_view value)
+{
+        switch (attribute) {
+        case AttrHref: {
+                constexpr std::array schemes = {"https:", "http:", "ftp:", "mailto:", "magnet:"};
+                for (std::string_view scheme : schemes)
+                        if (startsWithIgnoreCase(value, scheme))
+                                return true;
+                return false;
+        }
+        case AttrSrc:
+                return startsWithIgnoreCase(value, "mxc://");
+        case AttrClass:
+                return startsWithIgnoreCase(value, "language-");
+        case AttrColor:
+        case AttrMxColor:
+        case AttrMxBgColor:
+                for (char c : value)
+                        if (!(c == '#' || (c >= '0' && c <= '9') || (c >= 'a' && c <= 'z') ||
+                              (c >= 'A' && c <= 'Z')))
+                                return false;
+                return true;
+        default:
+                return true;
+        }
+}
+
+//! Parse the tag starting with the '<' at data[pos]. If it is allowed, its sanitized version is
+//! appended to out and the position of its '>' returned. Otherwise nothing is appended and npos is
+//! returned.
+std::size_t
+appendSanitizedTag(std::string_view data, std::size_t pos, QByteArray &out)
+{
+        constexpr auto npos = std::string_view::npos;
+
+        std::size_t p = pos + 1;
+        const bool closing = p < data.size() && data[p] == '/';
+        if (closing)
+                p++;
+
+        char name[MAX_HTML_TAG_LENGTH];
+        std::size_t nameLength = 0;
+        for (; p < data.size() && std::isalnum(static_cast<unsigned char>(data[p])); p++) {
+                if (nameLength == MAX_HTML_TAG_LENGTH)
+                        return npos;
+                name[nameLength++] = toLowerAscii(data[p]);
+        }
+
+        if (p == data.size() || !(data[p] == '>' || data[p] == '/' || isHtmlSpace(data[p])))
+                return npos;
+
+        const auto tag = findHtmlTag(std::string_view(name, nameLength));
+        if (!tag)
+                return npos;
+
+        // Appended directly, and removed again, if the tag turns out to be malformed.
+        const auto start = out.size();
+        auto malformed   = [&out, start]() {
+                out.truncate(start);
+                return npos;
+        };
+
+        out.append(closing ? "</" : "<");
+        out.append(name, static_cast<int>(nameLength));
+
+        bool selfClosing = false;
+        while (true) {
+                while (p < data.size() && isHtmlSpace(data[p]))
+                        p++;
+                if (p == data.size())
+                        return malformed();
+                if (data[p] == '>')
+                        break;
+                if (data[p] == '/') {
+                        selfClosing = true;
+                        p++;
+                        continue;
+                }
+
+                const auto attrStart = p;
+                while (p < data.size() && !isHtmlSpace(data[p]) && data[p] != '=' &&
+                       data[p] != '>' && data[p] != '/')
+                        p++;
+                const auto attrName = data.substr(attrStart, p - attrStart);
+
+                while (p < data.size() && isHtmlSpace(data[p]))
+                        p++;
+
+                std::string_view value;
+                if (p < data.size() && data[p] == '=') {
+                        p++;
+                        while (p < data.size() && isHtmlSpace(data[p]))
+                                p++;
+                        if (p == data.size())
+                                return malformed();
+
+                        if (data[p] == '"' || data[p] == '\'') {
+                                const auto end = data.find(data[p], p + 1);
+                                if (end == npos)
+                                        return malformed();
+                                value = data.substr(p + 1, end - p - 1);
+                                p     = end + 1;
+                        } else {
+                                const auto valueStart = p;
+                                while (p < data.size() && !isHtmlSpace(data[p]) &&
+                                       data[p] != '>')
+                                        p++;
+                                value = data.substr(valueStart, p - valueStart);
+                        }
+                }
+
+                if (closing || !tag->attributes)
+                        continue;
+
+                for (const auto &[allowedName, attribute] : htmlAttributes) {
+                        if (!(tag->attributes & attribute) ||
+                            attrName.size() != allowedName.size() ||
+                            !startsWithIgnoreCase(attrName, allowedName))
+                                continue;
+
+                        if (allowedAttributeValue(attribute, value)) {
+                                out.append(' ');
+                                out.append(allowedName.data(),
+                                                 static_cast<int>(allowedName.size()));
+                                out.append("=\"");
+                                for (char c : value) {
+                                        if (c == '"')
+                                                out.append("&quot;");
+                                        else if (c == '<')
+                                                out.append("&lt;");
+                                        else if (c == '>')
+                                                out.append("&gt;");
+                                        else
+                                                out.append(c);
+                                }
+                                out.append('"');
+                        }
+                        break;
+                }
+        }
+
+        if (selfClosing && !closing)
+                out.append('/');
+        out.append('>');
+
+        return p;
+}
 }
 
 QString
 utils::escapeBlacklistedHtml(const QString &rawStr)
 {
-        static const std::array allowedTags = {
-          "font",       "/font",       "del",    "/del",    "h1",    "/h1",    "h2",     "/h2",
-          "h3",         "/h3",         "h4",     "/h4",     "h5",    "/h5",    "h6",     "/h6",
-          "blockquote", "/blockquote", "p",      "/p",      "a",     "/a",     "ul",     "/ul",
-          "ol",         "/ol",         "sup",    "/sup",    "sub",   "/sub",   "li",     "/li",
-          "b",          "/b",          "i",      "/i",      "u",     "/u",     "strong", "/strong",
-          "em",         "/em",         "strike", "/strike", "code",  "/code",  "hr",     "/hr",
-          "br",         "br/",         "div",    "/div",    "table", "/table", "thead",  "/thead",
-          "tbody",      "/tbody",      "tr",     "/tr",     "th",    "/th",    "td",     "/td",
-          "caption",    "/caption",    "pre",    "/pre",    "span",  "/span",  "img",    "/img"};
-        QByteArray data = rawStr.toUtf8();
+        const QByteArray utf8 = rawStr.toUtf8();
+        const std::string_view data(utf8.constData(), utf8.size());
+
         QByteArray buffer;
-        const size_t length = data.size();
-        buffer.reserve(length);
+        buffer.reserve(utf8.size());
         bool escapingTag = false;
-        for (size_t pos = 0; pos != length; ++pos) {
-                switch (data.at(pos)) {
+        for (std::size_t pos = 0; pos < data.size(); ++pos) {
+                switch (data[pos]) {
                 case '<': {
-                        bool oneTagMatched = false;
-                        size_t endPos      = std::min(static_cast<size_t>(data.indexOf('>', pos)),
-                                                 static_cast<size_t>(data.indexOf(' ', pos)));
-
-                        auto mid = data.mid(pos + 1, endPos - pos - 1);
-                        for (const auto &tag : allowedTags) {
-                                // TODO: Check src and href attribute
-                                if (mid.toLower() == tag) {
-                                        oneTagMatched = true;
-                                }
-                        }
-                        if (oneTagMatched)
-                                buffer.append('<');
-                        else {
+                        const auto end = appendSanitizedTag(data, pos, buffer);
+                        if (end != std::string_view::npos) {
+                                pos = end;
+                        } else {
                                 escapingTag = true;
                                 buffer.append("&lt;");
                         }
@@ -397,7 +903,7 @@ utils::escapeBlacklistedHtml(const QString &rawStr)
                                 buffer.append('>');
                         break;
                 default:
-                        buffer.append(data.at(pos));
+                        buffer.append(data[pos]);
                         break;
                 }
         }
@@ -488,13 +994,7 @@ utils::getQuoteBody(const RelatedInfo &related)
 QString
 utils::linkColor()
 {
-        QSettings settings;
-        // Default to system theme if QT_QPA_PLATFORMTHEME var is set.
-        QString defaultTheme =
-          QProcessEnvironment::systemEnvironment().value("QT_QPA_PLATFORMTHEME", "").isEmpty()
-            ? "light"
-            : "system";
-        const auto theme = settings.value("user/theme", defaultTheme).toString();
+        const auto theme = UserSettings::snapshot()->theme;
 
         if (theme == "light") {
                 return "#0077b5";
@@ -517,16 +1017,22 @@ utils::hashQString(const QString &input)
         return hash;
 }
 
-QString
-utils::generateContrastingHexColor(const QString &input, const QString &background)
+namespace {
+//! How many hues the colors of the users are picked from.
+constexpr int USER_HUES = 360;
+
+int
+userHue(const QString &user_id)
+{
+        return static_cast<int>(utils::hashQString(user_id) % USER_HUES);
+}
+
+//! A color of the hue, that has an acceptable contrast to the background.
+QColor
+contrastingColor(int userHue, const QColor &background)
 {
-        const QColor backgroundCol(background);
-        const qreal backgroundLum = luminance(background);
+        const qreal backgroundLum = utils::luminance(background);
 
-        // Create a color for the input
-        auto hash = hashQString(input);
-        // create a hue value based on the hash of the input.
-        auto userHue = static_cast<int>(qAbs(hash % 360));
         // start with moderate saturation and lightness values.
         auto sat       = 220;
         auto lightness = 125;
@@ -537,8 +1043,8 @@ utils::generateContrastingHexColor(const QString &input, const QString &backgrou
         // calculate the initial luminance and contrast of the
         // generated color.  It's possible that no additional
         // work will be necessary.
-        auto lum      = luminance(inputColor);
-        auto contrast = computeContrast(lum, backgroundLum);
+        auto lum      = utils::luminance(inputColor);
+        auto contrast = utils::computeContrast(lum, backgroundLum);
 
         // If the contrast doesn't meet our criteria,
         // try again and again until they do by modifying first
@@ -551,16 +1057,16 @@ utils::generateContrastingHexColor(const QString &input, const QString &backgrou
                         qreal newSat = qBound(26.0, sat * 1.25, 242.0);
 
                         inputColor.setHsl(userHue, qFloor(newSat), lightness);
-                        auto tmpLum         = luminance(inputColor);
-                        auto higherContrast = computeContrast(tmpLum, backgroundLum);
+                        auto tmpLum         = utils::luminance(inputColor);
+                        auto higherContrast = utils::computeContrast(tmpLum, backgroundLum);
                         if (higherContrast > contrast) {
                                 contrast = higherContrast;
                                 sat      = newSat;
                         } else {
                                 newSat = qBound(26.0, sat / 1.25, 242.0);
                                 inputColor.setHsl(userHue, qFloor(newSat), lightness);
-                                tmpLum             = luminance(inputColor);
-                                auto lowerContrast = computeContrast(tmpLum, backgroundLum);
+                                tmpLum             = utils::luminance(inputColor);
+                                auto lowerContrast = utils::computeContrast(tmpLum, backgroundLum);
                                 if (lowerContrast > contrast) {
                                         contrast = lowerContrast;
                                         sat      = newSat;
@@ -571,8 +1077,8 @@ utils::generateContrastingHexColor(const QString &input, const QString &backgrou
 
                         inputColor.setHsl(userHue, sat, qFloor(newLightness));
 
-                        auto tmpLum         = luminance(inputColor);
-                        auto higherContrast = computeContrast(tmpLum, backgroundLum);
+                        auto tmpLum         = utils::luminance(inputColor);
+                        auto higherContrast = utils::computeContrast(tmpLum, backgroundLum);
 
                         // Check to make sure we have actually improved contrast
                         if (higherContrast > contrast) {
@@ -582,8 +1088,8 @@ utils::generateContrastingHexColor(const QString &input, const QString &backgrou
                         } else {
                                 newLightness = qBound(13.0, lightness / 1.25, 242.0);
                                 inputColor.setHsl(userHue, sat, qFloor(newLightness));
-                                tmpLum             = luminance(inputColor);
-                                auto lowerContrast = computeContrast(tmpLum, backgroundLum);
+                                tmpLum             = utils::luminance(inputColor);
+                                auto lowerContrast = utils::computeContrast(tmpLum, backgroundLum);
                                 if (lowerContrast > contrast) {
                                         contrast  = lowerContrast;
                                         lightness = newLightness;
@@ -597,10 +1103,42 @@ utils::generateContrastingHexColor(const QString &input, const QString &backgrou
                         break;
         }
 
-        // get the hex value of the generated color.
-        auto colorHex = inputColor.name();
+        return inputColor;
+}
+}
+
+QString
+utils::generateContrastingHexColor(const QString &input, const QString &background)
+{
+        return contrastingColor(userHue(input), QColor(background)).name();
+}
+
+QColor
+utils::userColor(const QString &user_id, const QColor &background)
+{
+        // The color only depends on the hue derived from the id, so the colors of all hues are
+        // computed once per background and kept in the cache.
+        static QHash<QRgb, std::vector<QRgb>> tables;
+
+        auto table = tables.find(background.rgb());
+        if (table == tables.end()) {
+                std::vector<uint32_t> colors;
+                if (cache::client())
+                        colors = cache::userColors(background.name());
+
+                if (colors.size() != USER_HUES) {
+                        colors.clear();
+                        for (int hue = 0; hue < USER_HUES; hue++)
+                                colors.push_back(contrastingColor(hue, background).rgb());
+
+                        if (cache::client())
+                                cache::saveUserColors(background.name(), colors);
+                }
+
+                table = tables.insert(background.rgb(), colors);
+        }
 
-        return colorHex;
+        return QColor::fromRgb(table.value()[userHue(user_id)]);
 }
 
 qreal
@@ -668,3 +1206,85 @@ utils::readImage(QByteArray *data)
         reader.setAutoTransform(true);
         return reader.read();
 }
+
+QImage
+utils::readImage(QByteArray *data, const QSize &targetSize, bool *downscaled)
+{
+        if (downscaled)
+                *downscaled = false;
+
+        QBuffer buf(data);
+        QImageReader reader(&buf);
+        reader.setAutoTransform(true);
+
+        auto size = reader.size();
+        if (targetSize.isEmpty() || !size.isValid())
+                return reader.read();
+
+        // The size is scaled before the exif rotation is applied.
+        auto target = targetSize;
+        if (reader.transformation() & QImageIOHandler::TransformationRotate90)
+                target.transpose();
+
+        const auto scaled = size.scaled(target, Qt::KeepAspectRatioByExpanding);
+        if (scaled.width() < size.width() && scaled.height() < size.height()) {
+                reader.setScaledSize(scaled);
+                if (downscaled)
+                        *downscaled = true;
+        }
+
+        return reader.read();
+}
+
+QSize
+utils::imageSize(QByteArray *data)
+{
+        QBuffer buf(data);
+        QImageReader reader(&buf);
+        reader.setAutoTransform(true);
+
+        auto size = reader.size();
+        if (!size.isValid())
+                return QSize(0, 0);
+        if (reader.transformation() & QImageIOHandler::TransformationRotate90)
+                size.transpose();
+
+        return size;
+}
+
+QByteArray
+utils::encodeImage(const QImage &image)
+{
+        QByteArray data;
+        QBuffer buf(&data);
+        buf.open(QIODevice::WriteOnly);
+
+        if (image.hasAlphaChannel())
+                image.save(&buf, "PNG");
+        else
+                image.save(&buf, "JPEG", 90);
+
+        return data;
+}
+
+QImage
+utils::roundedImage(const QImage &image, qreal radius)
+{
+        if (image.isNull() || radius <= 0)
+                return image;
+
+        QImage rounded(image.size(), QImage::Format_ARGB32_Premultiplied);
+        rounded.fill(Qt::transparent);
+
+        QPainterPath path;
+        path.addRoundedRect(QRectF(rounded.rect()), radius, radius);
+
+        QPainter painter(&rounded);
+        painter.setRenderHint(QPainter::Antialiasing);
+        painter.setRenderHint(QPainter::SmoothPixmapTransform);
+        painter.setClipPath(path);
+        painter.drawImage(0, 0, image);
+        painter.end();
+
+        return rounded;
+}
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <array>
+#include <cstdint>
 #include <variant>
+#include <vector>
 
 #include <QCoreApplication>
 #include <QDateTime>
@@ -36,6 +39,34 @@ namespace utils {
 
 using TimelineEvent = mtx::events::collections::TimelineEvents;
 
+//! A part of a message body, which is shown differently from the text around it.
+struct MessageSpan
+{
+        enum Kind
+        {
+                Url,
+                //! A url of matrix.to, which refers to a user, room or event.
+                Pill,
+                //! Consecutive emoji, shown in the emoji font.
+                Emoji,
+        };
+
+        Kind kind;
+        //! Position and length in UTF-16 code units.
+        int begin;
+        int length;
+};
+
+//! Find the urls and emoji of a message in a single pass. Emoji inside of urls are part of the
+//! url. The spans are ordered and don't overlap.
+std::vector<MessageSpan>
+findMessageSpans(const QString &body, bool urls = true, bool emoji = true);
+
+//! Wrap the urls in links and the emoji in the emoji font.
+QString
+applyMessageSpans(const QString &body, const std::vector<MessageSpan> &spans);
+
+//! Show the emoji of a message in the emoji font.
 QString
 replaceEmoji(const QString &body);
 
@@ -75,6 +106,10 @@ firstChar(const QString &input);
 QString
 humanReadableFileSize(uint64_t bytes);
 
+//! The peak resident memory of the process in bytes or 0, if it isn't known on this platform.
+uint64_t
+peakMemoryUsage();
+
 QString
 event_body(const mtx::events::collections::TimelineEvents &event);
 
@@ -226,9 +261,41 @@ message_body(const mtx::events::collections::TimelineEvents &event)
         return QString::fromStdString(std::get<T>(event).content.body);
 }
 
-//! Calculate the Levenshtein distance between two strings with character skipping.
-int
-levenshtein_distance(const std::string &s1, const std::string &s2);
+//! The edit distance of a needle to its closest match in a part of a haystack, so a needle,
+//! which the haystack contains, has a distance of 0. It compares UTF-16 code units.
+//!
+//! The needle is prepared once and then matched against many haystacks with the bit-parallel
+//! algorithm of Myers, in the formulation of Hyyrö, which computes a column of the distance
+//! matrix per word operation and allocates nothing. Needles are cut to the first 64 code units,
+//! so a column fits a word.
+class FuzzyNeedle
+{
+public:
+        explicit FuzzyNeedle(const QString &needle);
+
+        //! The distance to the haystack, if it is at most maxDistance, otherwise maxDistance + 1.
+        //! The computation stops, once the distance can't be at most maxDistance anymore.
+        int distance(const QString &haystack, int maxDistance) const;
+
+        //! The length of the needle, which is also the largest distance.
+        int size() const { return length_; }
+
+private:
+        //! The bits of the positions of a code unit, which isn't ASCII, in the needle.
+        struct Slot
+        {
+                char16_t unit = 0;
+                uint64_t peq  = 0;
+        };
+
+        uint64_t positions(char16_t unit) const;
+
+        int length_ = 0;
+        std::array<uint64_t, 128> ascii_{};
+        //! Open addressed by the code unit. The needle has at most 64 different code units, so a
+        //! slot is always free.
+        std::array<Slot, 64> other_{};
+};
 
 QPixmap
 scaleImageToPixmap(const QImage &img, int size);
@@ -263,11 +330,16 @@ getMessageBody(const RoomMessageT &event)
 QString
 linkifyMessage(const QString &body);
 
+//! linkifyMessage and replaceEmoji in one pass over the message.
+QString
+linkifyAndReplaceEmoji(const QString &body);
+
 //! Convert the input markdown text to html.
 QString
 markdownToHtml(const QString &text);
 
-//! Escape every html tag, that was not whitelisted
+//! Escape every html tag, that was not whitelisted, and drop the attributes not allowed on it.
+//! Runs in a single pass over the input.
 QString
 escapeBlacklistedHtml(const QString &data);
 
@@ -292,6 +364,11 @@ hashQString(const QString &input);
 QString
 generateContrastingHexColor(const QString &input, const QString &background);
 
+//! The color of the name of a user on a background. Shared by all views and kept in the cache, so
+//! it is computed only once per background.
+QColor
+userColor(const QString &user_id, const QColor &background);
+
 //! Given two luminance values, compute the contrast ratio between them.
 qreal
 computeContrast(const qreal &one, const qreal &two);
@@ -310,4 +387,18 @@ restoreCombobox(QComboBox *combo, const QString &value);
 //! Read image respecting exif orientation
 QImage
 readImage(QByteArray *data);
+//! Read image respecting exif orientation at the smallest size, which still covers targetSize.
+//! Formats like JPEG scale while decoding, so the full resolution image is never allocated.
+//! downscaled is set, if the image is smaller than the original one.
+QImage
+readImage(QByteArray *data, const QSize &targetSize, bool *downscaled = nullptr);
+//! The size of an image after its exif rotation, without decoding it.
+QSize
+imageSize(QByteArray *data);
+//! Encode a decoded image for the media cache, as PNG, if it has transparency, or as JPEG.
+QByteArray
+encodeImage(const QImage &image);
+//! The image with transparent rounded corners. A radius of half the size gives a circle.
+QImage
+roundedImage(const QImage &image, qreal radius);
 }
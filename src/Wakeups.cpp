@@ -0,0 +1,100 @@
+#include "Wakeups.h"
+
+#include <algorithm>
+#include <chrono>
+#include <map>
+#include <mutex>
+
+#include <QPointer>
+#include <QTimer>
+
+//! Timers at least that long only need to be accurate to the second, which lets the system
+//! align them to the same second.
+constexpr int VERY_COARSE_INTERVAL = 1000;
+
+namespace {
+struct WindowTimer
+{
+        QPointer<QTimer> timer;
+        //! Whether it ran, when the window was hidden.
+        bool wasActive = false;
+};
+
+std::mutex mutex_;
+std::map<std::string, uint64_t> counts_;
+const auto start_ = std::chrono::steady_clock::now();
+
+//! Only used from the main thread, like the timers.
+std::vector<WindowTimer> windowTimers_;
+bool windowHidden_ = false;
+}
+
+namespace wakeups {
+void
+manage(QTimer *timer, const char *name, bool windowOnly)
+{
+        timer->setTimerType(timer->interval() >= VERY_COARSE_INTERVAL ? Qt::VeryCoarseTimer
+                                                                      : Qt::CoarseTimer);
+        QObject::connect(timer, &QTimer::timeout, [name]() { count(name); });
+
+        if (!windowOnly)
+                return;
+
+        windowTimers_.erase(std::remove_if(windowTimers_.begin(),
+                                           windowTimers_.end(),
+                                           [](const WindowTimer &t) { return !t.timer; }),
+                            windowTimers_.end());
+        windowTimers_.push_back({timer, false});
+
+        if (windowHidden_ && timer->isActive()) {
+                timer->stop();
+                windowTimers_.back().wasActive = true;
+        }
+}
+
+void
+count(const char *name)
+{
+        std::unique_lock<std::mutex> lock(mutex_);
+        counts_[name]++;
+}
+
+void
+setWindowHidden(bool hidden)
+{
+        if (windowHidden_ == hidden)
+                return;
+
+        windowHidden_ = hidden;
+        for (auto &t : windowTimers_) {
+                if (!t.timer)
+                        continue;
+
+                if (hidden) {
+                        t.wasActive = t.timer->isActive();
+                        t.timer->stop();
+                } else if (t.wasActive) {
+                        t.timer->start();
+                }
+        }
+}
+
+std::vector<Rate>
+rates()
+{
+        const auto seconds = std::max(
+          std::chrono::duration<double>(std::chrono::steady_clock::now() - start_).count(), 1.0);
+
+        std::vector<Rate> result;
+        {
+                std::unique_lock<std::mutex> lock(mutex_);
+                for (const auto &[name, wakeups] : counts_)
+                        result.push_back({name, wakeups, wakeups / seconds});
+        }
+
+        std::sort(result.begin(), result.end(), [](const Rate &a, const Rate &b) {
+                return a.wakeups > b.wakeups;
+        });
+        return result;
+}
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class QTimer;
+
+//! Keeps the timers, which run while nothing happens, from waking the process up more than
+//! needed.
+//!
+//! The periodic timers are registered here. They are made coarse, so timers with close deadlines
+//! fire in the same wakeup, and the ones only the window needs are stopped, while it is hidden.
+//! Every timeout is counted, so the statistics page shows how often each timer wakes us up.
+namespace wakeups {
+//! Coalesce and count the timeouts of the timer. The interval must be set already. A timer of
+//! the window is stopped, while it is hidden, and started again afterwards, if it was running,
+//! so its owner shouldn't stop it in between. The name must outlive the timer.
+void
+manage(QTimer *timer, const char *name, bool windowOnly = false);
+//! Count a wakeup, which doesn't come from a managed timer.
+void
+count(const char *name);
+//! Stop or start again the timers of the window.
+void
+setWindowHidden(bool hidden);
+
+struct Rate
+{
+        std::string name;
+        uint64_t wakeups = 0;
+        double perSecond = 0;
+};
+//! The wakeups since the start, most frequent first.
+std::vector<Rate>
+rates();
+}
@@ -0,0 +1,84 @@
+#include "WorkerPools.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+
+namespace {
+struct WorkerPool
+{
+        explicit WorkerPool(int threads) { pool.setMaxThreadCount(threads); }
+
+        QThreadPool pool;
+        std::atomic<int> queued{0};
+        std::atomic<int> running{0};
+        std::atomic<int> peakQueued{0};
+        std::atomic<uint64_t> jobs{0};
+};
+
+WorkerPool &
+workerPool(workers::Pool pool)
+{
+        // The GUI thread keeps its core, decoding takes the others. Decrypting is fast compared
+        // to the download, so a few threads keep up with it.
+        static WorkerPool decode(std::max(1, QThread::idealThreadCount() - 1));
+        static WorkerPool crypto(std::max(1, QThread::idealThreadCount() / 4));
+
+        return pool == workers::Pool::Crypto ? crypto : decode;
+}
+
+class Job : public QRunnable
+{
+public:
+        Job(WorkerPool &pool, std::function<void()> job)
+          : pool_(pool)
+          , job_(std::move(job))
+        {}
+
+        void run() override
+        {
+                pool_.queued--;
+                pool_.running++;
+                job_();
+                pool_.running--;
+        }
+
+private:
+        WorkerPool &pool_;
+        std::function<void()> job_;
+};
+}
+
+namespace workers {
+void
+run(Pool pool, Priority priority, std::function<void()> job)
+{
+        auto &p = workerPool(pool);
+
+        p.jobs++;
+        const int queued = ++p.queued;
+        int peak         = p.peakQueued;
+        while (queued > peak && !p.peakQueued.compare_exchange_weak(peak, queued)) {
+        }
+
+        // The visible delegates have the default priority of QThreadPool.
+        p.pool.start(new Job(p, std::move(job)), priority == Priority::Visible ? 0 : -1);
+}
+
+Stats
+stats(Pool pool)
+{
+        const auto &p = workerPool(pool);
+
+        Stats stats;
+        stats.queued     = p.queued;
+        stats.running    = p.running;
+        stats.threads    = p.pool.maxThreadCount();
+        stats.peakQueued = p.peakQueued;
+        stats.jobs       = p.jobs;
+        return stats;
+}
+}
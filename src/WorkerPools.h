@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+//! The thread pools of the image work, one for each kind of it.
+//!
+//! Decoding images and blurhashes, decrypting media and waiting for the network used to share
+//! the pools, so a burst of large images could take every core. Decoding gets the cores but the
+//! one of the GUI thread, decrypting the media a few threads of its own and the network callbacks
+//! only hand their result over to them. What the visible delegates wait for goes ahead of the
+//! prefetches. The queued and running jobs of each pool are counted for the timeline overlay.
+namespace workers {
+enum class Pool
+{
+        //! Reading, decoding and scaling images and blurhashes.
+        Decode,
+        //! Decrypting the encrypted media.
+        Crypto,
+};
+
+enum class Priority
+{
+        //! Prefetches, which only fill the cache.
+        Background,
+        //! What a visible delegate waits for.
+        Visible,
+};
+
+//! Run the job in the pool. Can be called from any thread.
+void
+run(Pool pool, Priority priority, std::function<void()> job);
+
+struct Stats
+{
+        //! The jobs waiting for a thread.
+        int queued  = 0;
+        int running = 0;
+        int threads = 0;
+        //! The most jobs, which waited at once.
+        int peakQueued = 0;
+        uint64_t jobs  = 0;
+};
+Stats
+stats(Pool pool);
+}
@@ -0,0 +1,220 @@
+#include <QDateTime>
+#include <QFontDatabase>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QShortcut>
+#include <QTextBrowser>
+#include <QVBoxLayout>
+
+#include "dialogs/CacheStatistics.h"
+
+#include "AvatarProvider.h"
+#include "BlurhashProvider.h"
+#include "Cache.h"
+#include "ChatPage.h"
+#include "ColorImageProvider.h"
+#include "Logging.h"
+#include "MxcImageProvider.h"
+#include "NetworkUsage.h"
+#include "Utils.h"
+#include "Wakeups.h"
+#include "timeline/TimelineViewManager.h"
+
+using namespace dialogs;
+
+CacheStatistics::CacheStatistics(QWidget *parent)
+  : QWidget{parent}
+{
+        setAutoFillBackground(true);
+        setWindowFlags(Qt::Tool | Qt::WindowStaysOnTopHint);
+        setAttribute(Qt::WA_DeleteOnClose, true);
+        setWindowTitle(tr("Cache statistics"));
+        setMinimumSize(640, 480);
+
+        auto layout = new QVBoxLayout{this};
+
+        viewer_ = new QTextBrowser{this};
+        viewer_->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+        viewer_->setLineWrapMode(QTextEdit::NoWrap);
+
+        auto refreshBtn = new QPushButton(tr("Refresh"), this);
+        auto closeBtn   = new QPushButton(tr("Close"), this);
+
+        auto buttonLayout = new QHBoxLayout();
+        buttonLayout->addStretch(1);
+        buttonLayout->addWidget(refreshBtn);
+        buttonLayout->addWidget(closeBtn);
+
+        layout->addWidget(viewer_);
+        layout->addLayout(buttonLayout);
+
+        connect(refreshBtn, &QPushButton::clicked, this, &CacheStatistics::refresh);
+        connect(closeBtn, &QPushButton::clicked, this, &CacheStatistics::close);
+
+        auto closeShortcut = new QShortcut(QKeySequence(QKeySequence::Cancel), this);
+        connect(closeShortcut, &QShortcut::activated, this, &CacheStatistics::close);
+
+        refresh();
+}
+
+void
+CacheStatistics::refresh()
+{
+        CacheStats stats;
+        try {
+                stats = cache::stats();
+        } catch (const lmdb::error &e) {
+                nhlog::db()->warn("failed to read the cache statistics: {}", e.what());
+                viewer_->setPlainText(tr("Failed to read the cache statistics: %1").arg(e.what()));
+                return;
+        }
+
+        QString text;
+
+        text += QString("map size: %1, used %2\n")
+                  .arg(utils::humanReadableFileSize(stats.map.map_size))
+                  .arg(utils::humanReadableFileSize(stats.map.used_size));
+        text += QString("media files: %1\n")
+                  .arg(utils::humanReadableFileSize(stats.media_files_size));
+        text += QString("megolm sessions in memory: %1, %2 hits, %3 misses\n")
+                  .arg(stats.megolm_sessions.size)
+                  .arg(stats.megolm_sessions.hits)
+                  .arg(stats.megolm_sessions.misses);
+
+        const auto images = MxcImageProvider::stats();
+        text += QString("avatars in memory: %1\n")
+                  .arg(utils::humanReadableFileSize(AvatarProvider::memoryUsage()));
+        text += QString("images: %1 cache hits, %2 downloads, %3 coalesced, %4 prefetches "
+                        "cancelled\n")
+                  .arg(images.cache_hits)
+                  .arg(images.downloads)
+                  .arg(images.coalesced)
+                  .arg(images.prefetches_cancelled);
+        text += QString("image responses: %1 completed, %2 cancelled, %3 downloads discarded\n")
+                  .arg(images.responses_completed)
+                  .arg(images.responses_cancelled)
+                  .arg(images.downloads_discarded);
+        const auto blurhashes = BlurhashProvider::stats();
+        text += QString("blurhashes: %1 decoded, %2 cache hits, %3 cancelled\n")
+                  .arg(blurhashes.decoded)
+                  .arg(blurhashes.cache_hits)
+                  .arg(blurhashes.cancelled);
+        const auto icons = ColorImageProvider::stats();
+        text += QString("icons: %1 cache hits, %2 renders, %3 invalidated\n\n")
+                  .arg(icons.cache_hits)
+                  .arg(icons.renders)
+                  .arg(icons.invalidated);
+
+        text += QString("%1 %2 %3 %4\n")
+                  .arg("database", -32)
+                  .arg("dbs", 8)
+                  .arg("entries", 12)
+                  .arg("size", 12);
+        for (const auto &db : stats.databases) {
+                text += QString("%1 %2 %3 %4\n")
+                          .arg(QString::fromStdString(db.name), -32)
+                          .arg(db.databases, 8)
+                          .arg(db.entries, 12)
+                          .arg(utils::humanReadableFileSize(db.bytes), 12);
+        }
+
+        text += QString("\n%1 %2 %3 %4 %5 %6\n")
+                  .arg("operation", -24)
+                  .arg("calls", 10)
+                  .arg("mean us", 10)
+                  .arg("p50 us", 10)
+                  .arg("p99 us", 10)
+                  .arg("max us", 10);
+        for (const auto &[operation, histogram] : stats.latencies) {
+                const auto mean = histogram.count ? histogram.total_us / histogram.count : 0;
+
+                text += QString("%1 %2 %3 %4 %5 %6\n")
+                          .arg(QString::fromStdString(operation), -24)
+                          .arg(histogram.count, 10)
+                          .arg(mean, 10)
+                          .arg(histogram.quantile(0.5), 10)
+                          .arg(histogram.quantile(0.99), 10)
+                          .arg(histogram.max_us, 10);
+        }
+
+        text += QString("\n%1 %2 %3 %4 %5 %6\n")
+                  .arg("count", -24)
+                  .arg("calls", 10)
+                  .arg("mean", 10)
+                  .arg("p50", 10)
+                  .arg("p99", 10)
+                  .arg("max", 10);
+        for (const auto &[operation, histogram] : stats.counts) {
+                const auto mean = histogram.count ? histogram.total_us / histogram.count : 0;
+
+                text += QString("%1 %2 %3 %4 %5 %6\n")
+                          .arg(QString::fromStdString(operation), -24)
+                          .arg(histogram.count, 10)
+                          .arg(mean, 10)
+                          .arg(histogram.quantile(0.5), 10)
+                          .arg(histogram.quantile(0.99), 10)
+                          .arg(histogram.max_us, 10);
+        }
+
+        const auto sync = ChatPage::instance()->syncState();
+        text += QString("\nsync: %1 failures, last retry after %2 ms, server timeout %3 ms%4\n")
+                  .arg(sync.failures)
+                  .arg(sync.last_delay.count())
+                  .arg(sync.server_timeout)
+                  .arg(sync.lite ? ", lite" : "");
+
+        const auto traffic = http::trafficStats();
+        const auto hour =
+          traffic.hours.empty() ? http::TrafficCounters{} : traffic.hours.back().traffic;
+
+        text += QString("\n%1 %2 %3 %4 %5\n")
+                  .arg("traffic", -24)
+                  .arg("requests", 10)
+                  .arg("bytes", 12)
+                  .arg("hour reqs", 10)
+                  .arg("hour bytes", 12);
+        for (std::size_t category = 0; category < http::TRAFFIC_CATEGORIES; category++) {
+                text += QString("%1 %2 %3 %4 %5\n")
+                          .arg(http::trafficName(static_cast<http::Traffic>(category)), -24)
+                          .arg(traffic.session[category].requests, 10)
+                          .arg(utils::humanReadableFileSize(traffic.session[category].bytes), 12)
+                          .arg(hour[category].requests, 10)
+                          .arg(utils::humanReadableFileSize(hour[category].bytes), 12);
+        }
+        text += QString("budget: %1%2\n")
+                  .arg(traffic.budget ? utils::humanReadableFileSize(traffic.budget) + " per hour"
+                                      : QString("unlimited"))
+                  .arg(http::overTrafficBudget() ? ", exceeded, prefetches paused" : "");
+        for (const auto &past : traffic.hours) {
+                uint64_t requests = 0, bytes = 0;
+                for (const auto &counter : past.traffic) {
+                        requests += counter.requests;
+                        bytes += counter.bytes;
+                }
+
+                const auto start = QDateTime::fromSecsSinceEpoch(past.start);
+                text += QString("%1 %2 %3\n")
+                          .arg(start.toString("yyyy-MM-dd hh:mm"), -24)
+                          .arg(requests, 10)
+                          .arg(utils::humanReadableFileSize(bytes), 12);
+        }
+
+        text += QString("\n%1 %2 %3\n").arg("wakeups", -24).arg("total", 10).arg("per second", 12);
+        for (const auto &rate : wakeups::rates()) {
+                text += QString("%1 %2 %3\n")
+                          .arg(QString::fromStdString(rate.name), -24)
+                          .arg(rate.wakeups, 10)
+                          .arg(rate.perSecond, 12, 'f', 3);
+        }
+
+        const auto timelines = ChatPage::instance()->timelineManager()->memoryUsage();
+
+        text += QString("\n%1 %2\n").arg("loaded timeline", -48).arg("size", 12);
+        for (auto it = timelines.begin(); it != timelines.end(); ++it) {
+                text += QString("%1 %2\n")
+                          .arg(it.key(), -48)
+                          .arg(utils::humanReadableFileSize(it.value().total()), 12);
+        }
+
+        viewer_->setPlainText(text);
+}
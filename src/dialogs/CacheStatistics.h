@@ -0,0 +1,23 @@
+#pragma once
+
+#include <QWidget>
+
+class QTextBrowser;
+
+namespace dialogs {
+
+//! Debug page with the sizes of the cache databases, the latencies of the cache calls and the
+//! memory used by the loaded timelines.
+class CacheStatistics : public QWidget
+{
+        Q_OBJECT
+public:
+        CacheStatistics(QWidget *parent = nullptr);
+
+public slots:
+        void refresh();
+
+private:
+        QTextBrowser *viewer_;
+};
+} // namespace dialogs
@@ -17,19 +17,19 @@
 
 #include <QApplication>
 #include <QDesktopWidget>
+#include <QFutureWatcher>
 #include <QGuiApplication>
 #include <QPainter>
 #include <QScreen>
+#include <QWindow>
+#include <QtConcurrent>
 
 #include "dialogs/ImageOverlay.h"
 
-#include "Utils.h"
-
 using namespace dialogs;
 
-ImageOverlay::ImageOverlay(QPixmap image, QWidget *parent)
+ImageOverlay::ImageOverlay(QWidget *parent)
   : QWidget{parent}
-  , originalImage_{image}
 {
         setMouseTracking(true);
         setParent(nullptr);
@@ -46,6 +46,52 @@ ImageOverlay::ImageOverlay(QPixmap image, QWidget *parent)
         raise();
 }
 
+void
+ImageOverlay::setPreview(QImage preview)
+{
+        // The image may have been faster, if it was cached.
+        if (generation_ > 0)
+                return;
+
+        image_       = std::move(preview);
+        scaledBound_ = QSize();
+        update();
+}
+
+void
+ImageOverlay::setImage(QImage image)
+{
+        if (image.isNull())
+                return;
+
+        const int generation = ++generation_;
+        const auto bound     = screenBound();
+
+        auto watcher = new QFutureWatcher<QImage>(this);
+        connect(watcher, &QFutureWatcher<QImage>::finished, this, [this, watcher, generation]() {
+                watcher->deleteLater();
+                if (generation != generation_)
+                        return;
+
+                image_       = watcher->result();
+                hasImage_    = true;
+                scaledBound_ = QSize();
+                update();
+        });
+        watcher->setFuture(QtConcurrent::run([image = std::move(image), bound]() {
+                if (image.width() <= bound.width() && image.height() <= bound.height())
+                        return image;
+                return image.scaled(bound, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        }));
+}
+
+QSize
+ImageOverlay::screenBound() const
+{
+        auto screen = windowHandle() ? windowHandle()->screen() : QGuiApplication::primaryScreen();
+        return screen->size() * screen->devicePixelRatio();
+}
+
 void
 ImageOverlay::paintEvent(QPaintEvent *event)
 {
@@ -65,18 +111,34 @@ ImageOverlay::paintEvent(QPaintEvent *event)
         int max_width  = width() - 2 * outer_margin;
         int max_height = height();
 
-        image_ = utils::scaleDown(max_width, max_height, originalImage_);
+        // Only scaled again, when the window or its device pixel ratio changes, not on every
+        // repaint. The preview is scaled up to fill the content, until the image is set.
+        const qreal ratio = devicePixelRatioF();
+        const QSize bound = QSize(max_width, max_height) * ratio;
+        if (bound != scaledBound_) {
+                scaledBound_ = bound;
+
+                QImage scaled = image_;
+                if (!hasImage_ || image_.width() > bound.width() ||
+                    image_.height() > bound.height())
+                        scaled =
+                          image_.scaled(bound, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+
+                scaled_ = QPixmap::fromImage(scaled);
+                scaled_.setDevicePixelRatio(ratio);
+        }
 
-        int diff_x = max_width - image_.width();
-        int diff_y = max_height - image_.height();
+        const QSize size = scaled_.size() / ratio;
+        int diff_x       = max_width - size.width();
+        int diff_y       = max_height - size.height();
 
-        content_ = QRect(outer_margin + diff_x / 2, diff_y / 2, image_.width(), image_.height());
+        content_ = QRect(outer_margin + diff_x / 2, diff_y / 2, size.width(), size.height());
         close_button_ = QRect(width() - margin - buttonSize, margin, buttonSize, buttonSize);
         save_button_ =
           QRect(width() - (2 * margin) - (2 * buttonSize), margin, buttonSize, buttonSize);
 
         // Draw main content_.
-        painter.drawPixmap(content_, image_);
+        painter.drawPixmap(content_, scaled_);
 
         // Draw top right corner X.
         QPen pen;
@@ -18,6 +18,7 @@
 #pragma once
 
 #include <QDialog>
+#include <QImage>
 #include <QMouseEvent>
 #include <QPixmap>
 
@@ -27,7 +28,13 @@ class ImageOverlay : public QWidget
 {
         Q_OBJECT
 public:
-        ImageOverlay(QPixmap image, QWidget *parent = nullptr);
+        ImageOverlay(QWidget *parent = nullptr);
+
+        //! Show a small version, usually the thumbnail of the timeline, until the image is set.
+        void setPreview(QImage preview);
+        //! Show the full image. It is scaled to the screen in the background and only the scaled
+        //! image is kept, so the full resolution isn't held while the overlay is open.
+        void setImage(QImage image);
 
 protected:
         void mousePressEvent(QMouseEvent *event) override;
@@ -38,8 +45,19 @@ signals:
         void saving();
 
 private:
-        QPixmap originalImage_;
-        QPixmap image_;
+        //! The largest size the image is shown at on the screen of the overlay, in device pixels.
+        QSize screenBound() const;
+
+        //! The screen sized image, or the preview until it is scaled.
+        QImage image_;
+        bool hasImage_ = false;
+        //! Counts the images set, so an outdated scale is dropped.
+        int generation_ = 0;
+
+        //! The image scaled to the content, which is only scaled again, if the size or the
+        //! device pixel ratio changes.
+        QPixmap scaled_;
+        QSize scaledBound_;
 
         QRect content_;
         QRect close_button_;
@@ -11,7 +11,6 @@
 #include "dialogs/MemberList.h"
 
 #include "Cache.h"
-#include "ChatPage.h"
 #include "Config.h"
 #include "Logging.h"
 #include "Utils.h"
@@ -32,7 +31,8 @@ MemberItem::MemberItem(const RoomMember &member, QWidget *parent)
         avatar_ = new Avatar(this, 44);
         avatar_->setLetter(utils::firstChar(member.display_name));
 
-        avatar_->setImage(ChatPage::instance()->currentRoom(), member.user_id);
+        if (!member.avatar_url.isEmpty())
+                avatar_->setImage(member.avatar_url);
 
         QFont nameFont;
         nameFont.setPointSizeF(nameFont.pointSizeF() * 1.1);
@@ -87,7 +87,11 @@ MemberList::MemberList(const QString &room_id, QWidget *parent)
         QFont font;
         font.setPointSizeF(font.pointSizeF() * conf::modals::LABEL_MEDIUM_SIZE_RATIO);
 
-        topLabel_ = new QLabel(tr("Room members"), this);
+        // Lazy loading only stores the members of a large room, which were seen in its timeline.
+        topLabel_ = new QLabel(cache::isLargeRoom(room_id.toStdString())
+                                 ? tr("Recently active members")
+                                 : tr("Room members"),
+                               this);
         topLabel_->setAlignment(Qt::AlignCenter);
         topLabel_->setFont(font);
 
@@ -108,23 +112,34 @@ MemberList::MemberList(const QString &room_id, QWidget *parent)
                 if (pos != list_->verticalScrollBar()->maximum())
                         return;
 
-                const size_t numMembers = list_->count() - 1;
-
-                if (numMembers > 0)
-                        addUsers(cache::getMembers(room_id_.toStdString(), numMembers));
+                loadMoreMembers();
         });
 
-        try {
-                addUsers(cache::getMembers(room_id_.toStdString()));
-        } catch (const lmdb::error &e) {
-                nhlog::db()->critical("Failed to retrieve members from cache: {}", e.what());
-        }
+        loadMoreMembers();
 
         auto closeShortcut = new QShortcut(QKeySequence(QKeySequence::Cancel), this);
         connect(closeShortcut, &QShortcut::activated, this, &MemberList::close);
         connect(okBtn, &QPushButton::clicked, this, &MemberList::close);
 }
 
+void
+MemberList::loadMoreMembers()
+{
+        if (allMembersLoaded_)
+                return;
+
+        try {
+                auto page = cache::getMembersPage(room_id_.toStdString(), nextMembers_);
+
+                nextMembers_      = page.next_token;
+                allMembersLoaded_ = nextMembers_.empty();
+
+                addUsers(page.members);
+        } catch (const lmdb::error &e) {
+                nhlog::db()->critical("Failed to retrieve members from cache: {}", e.what());
+        }
+}
+
 void
 MemberList::addUsers(const std::vector<RoomMember> &members)
 {
@@ -3,6 +3,8 @@
 #include <QFrame>
 #include <QListWidget>
 
+#include <string>
+
 class Avatar;
 class QPushButton;
 class QHBoxLayout;
@@ -46,7 +48,13 @@ public slots:
         void addUsers(const std::vector<RoomMember> &users);
 
 private:
+        //! Append the next page of members, if there are more.
+        void loadMoreMembers();
+
         QString room_id_;
+        //! Continues the member listing after the last loaded page.
+        std::string nextMembers_;
+        bool allMembersLoaded_ = false;
         QLabel *topLabel_;
         QListWidget *list_;
 };
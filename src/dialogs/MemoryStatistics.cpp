@@ -0,0 +1,135 @@
+#include <algorithm>
+#include <vector>
+
+#include <QFontDatabase>
+#include <QHBoxLayout>
+#include <QPushButton>
+#include <QScrollBar>
+#include <QShortcut>
+#include <QTextBrowser>
+#include <QVBoxLayout>
+
+#include "dialogs/MemoryStatistics.h"
+
+#include "BlurhashProvider.h"
+#include "Cache.h"
+#include "ChatPage.h"
+#include "JdenticonProvider.h"
+#include "MemoryGovernor.h"
+#include "Utils.h"
+#include "Wakeups.h"
+#include "timeline/TimelineViewManager.h"
+
+//! How often the open page reads the estimates again.
+constexpr int REFRESH_INTERVAL = 2 * 1000;
+//! The loaded timelines shown, largest first.
+constexpr std::size_t MAX_TIMELINES = 30;
+
+using namespace dialogs;
+
+namespace {
+QString
+row(const QString &name, std::size_t bytes, const QString &note = QString())
+{
+        return QString("%1 %2  %3\n")
+          .arg(name, -32)
+          .arg(utils::humanReadableFileSize(bytes), 12)
+          .arg(note);
+}
+}
+
+MemoryStatistics::MemoryStatistics(QWidget *parent)
+  : QWidget{parent}
+{
+        setAutoFillBackground(true);
+        setWindowFlags(Qt::Tool | Qt::WindowStaysOnTopHint);
+        setAttribute(Qt::WA_DeleteOnClose, true);
+        setWindowTitle(tr("Memory statistics"));
+        setMinimumSize(640, 480);
+
+        auto layout = new QVBoxLayout{this};
+
+        viewer_ = new QTextBrowser{this};
+        viewer_->setFont(QFontDatabase::systemFont(QFontDatabase::FixedFont));
+        viewer_->setLineWrapMode(QTextEdit::NoWrap);
+
+        auto closeBtn = new QPushButton(tr("Close"), this);
+
+        auto buttonLayout = new QHBoxLayout();
+        buttonLayout->addStretch(1);
+        buttonLayout->addWidget(closeBtn);
+
+        layout->addWidget(viewer_);
+        layout->addLayout(buttonLayout);
+
+        connect(closeBtn, &QPushButton::clicked, this, &MemoryStatistics::close);
+
+        auto closeShortcut = new QShortcut(QKeySequence(QKeySequence::Cancel), this);
+        connect(closeShortcut, &QShortcut::activated, this, &MemoryStatistics::close);
+
+        refreshTimer_.setInterval(REFRESH_INTERVAL);
+        wakeups::manage(&refreshTimer_, "memory statistics", true);
+        connect(&refreshTimer_, &QTimer::timeout, this, &MemoryStatistics::refresh);
+        refreshTimer_.start();
+
+        refresh();
+}
+
+void
+MemoryStatistics::refresh()
+{
+        QString text;
+        std::size_t accounted = 0;
+
+        const auto resident = memory::resident();
+        text += row("process resident", resident);
+
+        text += QString("\n%1 %2  %3\n").arg("layer", -32).arg("used", 12).arg("budget");
+        for (const auto &layer : memory::usage()) {
+                text += row(layer.name, layer.used, utils::humanReadableFileSize(layer.budget));
+                accounted += layer.used;
+        }
+
+        const auto blurhashes  = BlurhashProvider::stats().memory;
+        const auto identicons  = JdenticonProvider::memoryUsage();
+        const auto mapResident = cache::client() ? cache::residentMapSize() : 0;
+        text += row("blurhashes", blurhashes);
+        text += row("identicons", identicons);
+        text += row("lmdb maps resident", mapResident, "the system drops these pages first");
+        accounted += blurhashes + identicons + mapResident;
+
+        // Qt doesn't tell, how much memory the textures of the scene graph and the images of
+        // the QML image cache use, so they are part of the rest.
+        if (resident > 0)
+                text += row("rest",
+                            resident - std::min(resident, accounted),
+                            "heap, Qt, QML scene graph and textures, libraries");
+
+        auto timelines = ChatPage::instance()->timelineManager()->memoryUsage();
+        std::vector<std::pair<QString, TimelineMemoryUsage>> sorted;
+        for (auto it = timelines.begin(); it != timelines.end(); ++it)
+                sorted.emplace_back(it.key(), it.value());
+        std::sort(sorted.begin(), sorted.end(), [](const auto &a, const auto &b) {
+                return a.second.total() > b.second.total();
+        });
+        if (sorted.size() > MAX_TIMELINES)
+                sorted.resize(MAX_TIMELINES);
+
+        text += QString("\n%1 %2 %3 %4\n")
+                  .arg("loaded timeline", -48)
+                  .arg("events", 12)
+                  .arg("decrypted", 12)
+                  .arg("rows", 12);
+        for (const auto &[room_id, usage] : sorted) {
+                text += QString("%1 %2 %3 %4\n")
+                          .arg(room_id, -48)
+                          .arg(utils::humanReadableFileSize(usage.events), 12)
+                          .arg(utils::humanReadableFileSize(usage.decrypted), 12)
+                          .arg(utils::humanReadableFileSize(usage.rows), 12);
+        }
+
+        // Keep the position, while it refreshes.
+        const auto scroll = viewer_->verticalScrollBar()->value();
+        viewer_->setPlainText(text);
+        viewer_->verticalScrollBar()->setValue(scroll);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <QTimer>
+#include <QWidget>
+
+class QTextBrowser;
+
+namespace dialogs {
+
+//! Debug page with an estimate of the memory used by every cache and model, next to the budget,
+//! which limits it, and the resident memory of the process. Refreshed, while it is open.
+class MemoryStatistics : public QWidget
+{
+        Q_OBJECT
+public:
+        MemoryStatistics(QWidget *parent = nullptr);
+
+public slots:
+        void refresh();
+
+private:
+        QTextBrowser *viewer_;
+        QTimer refreshTimer_;
+};
+} // namespace dialogs
@@ -15,12 +15,17 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <utility>
+
 #include <QBuffer>
 #include <QFile>
 #include <QFileInfo>
+#include <QFutureWatcher>
 #include <QHBoxLayout>
+#include <QImageReader>
 #include <QMimeDatabase>
 #include <QVBoxLayout>
+#include <QtConcurrent>
 
 #include "dialogs/PreviewUploadOverlay.h"
 
@@ -57,22 +62,33 @@ PreviewUploadOverlay::PreviewUploadOverlay(QWidget *parent)
 
         upload_.setDefault(true);
         connect(&upload_, &QPushButton::clicked, [this]() {
-                emit confirmUpload(data_, mediaType_, fileName_.text());
+                // The upload keeps the only reference, so the data isn't copied or kept around.
+                emit confirmUpload(std::exchange(data_, {}), mediaType_, fileName_.text());
                 close();
         });
         connect(&cancel_, &QPushButton::clicked, this, &PreviewUploadOverlay::close);
 }
 
+QSize
+PreviewUploadOverlay::previewBound() const
+{
+        auto window = MainWindow::instance();
+        if (!window)
+                return QSize();
+
+        const auto winsize = window->frameGeometry().size();
+        return QSize(static_cast<int>(winsize.width() * 0.8),
+                     static_cast<int>(winsize.height() * 0.8));
+}
+
 void
 PreviewUploadOverlay::init()
 {
-        QSize winsize;
         QPoint center;
 
         auto window = MainWindow::instance();
         if (window) {
-                winsize = window->frameGeometry().size();
-                center  = window->frameGeometry().center();
+                center = window->frameGeometry().center();
         } else {
                 nhlog::ui()->warn("unable to retrieve MainWindow's size");
         }
@@ -98,11 +114,10 @@ PreviewUploadOverlay::init()
         if (isImage_) {
                 infoLabel_.setAlignment(Qt::AlignCenter);
 
-                const auto maxWidth  = winsize.width() * 0.8;
-                const auto maxHeight = winsize.height() * 0.8;
+                const auto bound = previewBound();
 
                 // Scale image preview to fit into the application window.
-                infoLabel_.setPixmap(utils::scaleDown(maxWidth, maxHeight, image_));
+                infoLabel_.setPixmap(utils::scaleDown(bound.width(), bound.height(), image_));
                 move(center.x() - (width() * 0.5), center.y() - (height() * 0.5));
         } else {
                 infoLabel_.setAlignment(Qt::AlignLeft);
@@ -116,7 +131,19 @@ void
 PreviewUploadOverlay::setLabels(const QString &type, const QString &mime, uint64_t upload_size)
 {
         if (mediaType_ == "image") {
-                if (!image_.loadFromData(data_)) {
+                // Only decoded at the size of the preview, which is much cheaper for large images.
+                QBuffer buffer(&data_);
+                buffer.open(QIODevice::ReadOnly);
+                QImageReader reader(&buffer);
+
+                const auto size  = reader.size();
+                const auto bound = previewBound();
+                if (size.isValid() && bound.isValid() &&
+                    (size.width() > bound.width() || size.height() > bound.height()))
+                        reader.setScaledSize(size.scaled(bound, Qt::KeepAspectRatio));
+
+                image_ = QPixmap::fromImage(reader.read());
+                if (image_.isNull()) {
                         titleLabel_.setText(QString{tr(ERR_MSG)}.arg(type));
                 } else {
                         titleLabel_.setText(QString{tr(DEFAULT)}.arg(mediaType_));
@@ -139,19 +166,50 @@ PreviewUploadOverlay::setPreview(const QImage &src, const QString &mime)
         auto const &split = mime.split('/');
         auto const &type  = split[1];
 
-        QBuffer buffer(&data_);
-        buffer.open(QIODevice::WriteOnly);
-        if (src.save(&buffer, type.toStdString().c_str()))
-                titleLabel_.setText(QString{tr(DEFAULT)}.arg("image"));
-        else
-                titleLabel_.setText(QString{tr(ERR_MSG)}.arg(type));
-
+        data_.clear();
         mediaType_ = split[0];
         filePath_  = "clipboard." + type;
-        image_.convertFromImage(src);
-        isImage_ = true;
+        isImage_   = true;
+
+        // Encoding a large screenshot takes long, so a quickly scaled preview is shown meanwhile.
+        const auto bound = previewBound();
+        if (bound.isValid() && (src.width() > bound.width() || src.height() > bound.height()))
+                image_ = QPixmap::fromImage(
+                  src.scaled(bound, Qt::KeepAspectRatio, Qt::FastTransformation));
+        else
+                image_ = QPixmap::fromImage(src);
+
+        titleLabel_.setText(tr("Preparing the image..."));
+        upload_.setEnabled(false);
+
+        const auto generation = ++generation_;
+        auto watcher          = new QFutureWatcher<QByteArray>(this);
+        connect(watcher,
+                &QFutureWatcher<QByteArray>::finished,
+                this,
+                [this, watcher, generation, type]() {
+                        watcher->deleteLater();
+                        if (generation != generation_)
+                                return;
+
+                        data_ = watcher->result();
+                        if (data_.isEmpty()) {
+                                titleLabel_.setText(QString{tr(ERR_MSG)}.arg(type));
+                                return;
+                        }
+
+                        titleLabel_.setText(QString{tr(DEFAULT)}.arg("image"));
+                        upload_.setEnabled(true);
+                });
+        watcher->setFuture(QtConcurrent::run([src, format = type.toUtf8()]() {
+                QByteArray data;
+                QBuffer buffer(&data);
+                buffer.open(QIODevice::WriteOnly);
+                if (!src.save(&buffer, format.constData()))
+                        return QByteArray();
+                return data;
+        }));
 
-        titleLabel_.setText(QString{tr(DEFAULT)}.arg("image"));
         init();
 }
 
@@ -166,6 +224,9 @@ PreviewUploadOverlay::setPreview(const QByteArray data, const QString &mime)
         filePath_  = "clipboard." + type;
         isImage_   = false;
 
+        ++generation_;
+        upload_.setEnabled(true);
+
         setLabels(type, mime, data_.size());
         init();
 }
@@ -198,6 +259,9 @@ PreviewUploadOverlay::setPreview(const QString &path)
         filePath_  = file.fileName();
         isImage_   = false;
 
+        ++generation_;
+        upload_.setEnabled(true);
+
         setLabels(split[1], mime.name(), data_.size());
         init();
 }
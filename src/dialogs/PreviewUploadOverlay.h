@@ -34,6 +34,8 @@ class PreviewUploadOverlay : public QWidget
 public:
         PreviewUploadOverlay(QWidget *parent = nullptr);
 
+        //! Show a pasted image, which is encoded as mime in the background. The upload is possible,
+        //! once it is encoded.
         void setPreview(const QImage &src, const QString &mime);
         void setPreview(const QByteArray data, const QString &mime);
         void setPreview(const QString &path);
@@ -43,6 +45,8 @@ signals:
 
 private:
         void init();
+        //! The size the preview is scaled to fit into.
+        QSize previewBound() const;
         void setLabels(const QString &type, const QString &mime, uint64_t upload_size);
 
         bool isImage_;
@@ -58,5 +62,8 @@ private:
 
         QPushButton upload_;
         QPushButton cancel_;
+
+        //! Counts the pasted images, so the encoding of a replaced one is dropped.
+        uint64_t generation_ = 0;
 };
 } // dialogs
@@ -1,82 +1,139 @@
+#include <QCoreApplication>
 #include <QDebug>
+#include <QHBoxLayout>
 #include <QIcon>
-#include <QListWidgetItem>
 #include <QPainter>
+#include <QPainterPath>
 #include <QPushButton>
 #include <QShortcut>
 #include <QStyleOption>
-#include <QTimer>
 #include <QVBoxLayout>
 
+#include <algorithm>
+#include <memory>
+
 #include "dialogs/ReadReceipts.h"
 
 #include "AvatarProvider.h"
 #include "Cache.h"
 #include "ChatPage.h"
 #include "Config.h"
+#include "UserSettingsPage.h"
 #include "Utils.h"
-#include "ui/Avatar.h"
 
 using namespace dialogs;
 
-ReceiptItem::ReceiptItem(QWidget *parent,
-                         const QString &user_id,
-                         uint64_t timestamp,
-                         const QString &room_id)
-  : QWidget(parent)
+//! The size of the avatars in the list.
+constexpr int AVATAR_SIZE = 44;
+//! The number of receipts added to the model at once.
+constexpr int RECEIPTS_PAGE_SIZE = 100;
+
+ReceiptsModel::ReceiptsModel(QObject *parent)
+  : QAbstractListModel(parent)
+{}
+
+void
+ReceiptsModel::setReceipts(
+  const QString &room_id,
+  const std::multimap<uint64_t, std::string, std::greater<uint64_t>> &users)
 {
-        topLayout_ = new QHBoxLayout(this);
-        topLayout_->setMargin(0);
+        beginResetModel();
+        room_id_ = room_id;
+        receipts_.clear();
+        receipts_.reserve(users.size());
+        for (const auto &[timestamp, user_id] : users)
+                receipts_.push_back({QString::fromStdString(user_id), timestamp});
+        rows_.clear();
+        shown_ = std::min(static_cast<int>(receipts_.size()), RECEIPTS_PAGE_SIZE);
+        endResetModel();
+}
 
-        textLayout_ = new QVBoxLayout;
-        textLayout_->setMargin(0);
-        textLayout_->setSpacing(conf::modals::TEXT_SPACING);
+void
+ReceiptsModel::clear()
+{
+        beginResetModel();
+        receipts_.clear();
+        rows_.clear();
+        shown_ = 0;
+        endResetModel();
+}
 
-        QFont nameFont;
-        nameFont.setPointSizeF(nameFont.pointSizeF() * 1.1);
+int
+ReceiptsModel::rowCount(const QModelIndex &parent) const
+{
+        return parent.isValid() ? 0 : shown_;
+}
 
-        auto displayName = cache::displayName(room_id, user_id);
+bool
+ReceiptsModel::canFetchMore(const QModelIndex &parent) const
+{
+        return !parent.isValid() && shown_ < static_cast<int>(receipts_.size());
+}
 
-        avatar_ = new Avatar(this, 44);
-        avatar_->setLetter(utils::firstChar(displayName));
+void
+ReceiptsModel::fetchMore(const QModelIndex &parent)
+{
+        if (!canFetchMore(parent))
+                return;
 
-        // If it's a matrix id we use the second letter.
-        if (displayName.size() > 1 && displayName.at(0) == '@')
-                avatar_->setLetter(QChar(displayName.at(1)));
+        const auto count =
+          std::min(static_cast<int>(receipts_.size()) - shown_, RECEIPTS_PAGE_SIZE);
 
-        userName_ = new QLabel(displayName, this);
-        userName_->setFont(nameFont);
+        beginInsertRows(QModelIndex(), shown_, shown_ + count - 1);
+        shown_ += count;
+        endInsertRows();
+}
 
-        timestamp_ = new QLabel(dateFormat(QDateTime::fromMSecsSinceEpoch(timestamp)), this);
+const ReceiptsModel::Row &
+ReceiptsModel::row(int index) const
+{
+        if (auto it = rows_.constFind(index); it != rows_.constEnd())
+                return *it;
 
-        textLayout_->addWidget(userName_);
-        textLayout_->addWidget(timestamp_);
+        const auto &receipt = receipts_[index];
 
-        topLayout_->addWidget(avatar_);
-        topLayout_->addLayout(textLayout_, 1);
+        Row row;
+        row.displayName = cache::displayName(room_id_, receipt.user_id);
+        row.timestamp   = dateFormat(QDateTime::fromMSecsSinceEpoch(receipt.timestamp));
+        row.avatarUrl   = cache::avatarUrl(room_id_, receipt.user_id);
 
-        avatar_->setImage(ChatPage::instance()->currentRoom(), user_id);
+        return *rows_.insert(index, row);
 }
 
-void
-ReceiptItem::paintEvent(QPaintEvent *)
+QVariant
+ReceiptsModel::data(const QModelIndex &index, int role) const
 {
-        QStyleOption opt;
-        opt.init(this);
-        QPainter p(this);
-        style()->drawPrimitive(QStyle::PE_Widget, &opt, &p, this);
+        if (!index.isValid() || index.row() >= shown_)
+                return {};
+
+        switch (role) {
+        case UserId:
+                return receipts_[index.row()].user_id;
+        case Qt::DisplayRole:
+        case DisplayName:
+                return row(index.row()).displayName;
+        case Timestamp:
+                return row(index.row()).timestamp;
+        case AvatarUrl:
+                return row(index.row()).avatarUrl;
+        default:
+                return {};
+        }
 }
 
+//! Uses the translations of the former receipt widgets.
 QString
-ReceiptItem::dateFormat(const QDateTime &then) const
+ReceiptsModel::dateFormat(const QDateTime &then)
 {
         auto now  = QDateTime::currentDateTime();
         auto days = then.daysTo(now);
 
         if (days == 0)
-                return tr("Today %1").arg(then.time().toString(Qt::DefaultLocaleShortDate));
+                return QCoreApplication::translate("dialogs::ReceiptItem", "Today %1")
+                  .arg(then.time().toString(Qt::DefaultLocaleShortDate));
         else if (days < 2)
-                return tr("Yesterday %1").arg(then.time().toString(Qt::DefaultLocaleShortDate));
+                return QCoreApplication::translate("dialogs::ReceiptItem", "Yesterday %1")
+                  .arg(then.time().toString(Qt::DefaultLocaleShortDate));
         else if (days < 7)
                 return QString("%1 %2")
                   .arg(then.toString("dddd"))
@@ -85,6 +142,121 @@ ReceiptItem::dateFormat(const QDateTime &then) const
         return then.toString(Qt::DefaultLocaleShortDate);
 }
 
+ReceiptDelegate::ReceiptDelegate(QListView *view)
+  : QStyledItemDelegate(view)
+  , view_(view)
+{}
+
+QPixmap
+ReceiptDelegate::avatar(const QString &avatarUrl) const
+{
+        if (avatarUrl.isEmpty() || loadingAvatars_.contains(avatarUrl))
+                return QPixmap();
+
+        // Avatars in memory are returned right away, the others repaint the view, once they
+        // are loaded.
+        auto painting = std::make_shared<bool>(true);
+        auto result   = std::make_shared<QPixmap>();
+
+        loadingAvatars_.insert(avatarUrl);
+        AvatarProvider::resolve(
+          avatarUrl,
+          static_cast<int>(AVATAR_SIZE * view_->devicePixelRatioF()),
+          view_,
+          [this, avatarUrl, painting, result](QPixmap pm) {
+                  loadingAvatars_.remove(avatarUrl);
+
+                  if (*painting)
+                          *result = pm;
+                  else
+                          view_->viewport()->update();
+          });
+        *painting = false;
+
+        return *result;
+}
+
+QSize
+ReceiptDelegate::sizeHint(const QStyleOptionViewItem &option, const QModelIndex &) const
+{
+        QFont nameFont(option.font);
+        nameFont.setPointSizeF(nameFont.pointSizeF() * 1.1);
+
+        const int textHeight = QFontMetrics(nameFont).height() + conf::modals::TEXT_SPACING +
+                               QFontMetrics(option.font).height();
+
+        return QSize(AVATAR_SIZE, std::max(AVATAR_SIZE, textHeight) + conf::modals::TEXT_SPACING);
+}
+
+void
+ReceiptDelegate::paint(QPainter *painter,
+                       const QStyleOptionViewItem &option,
+                       const QModelIndex &index) const
+{
+        const auto displayName = index.data(ReceiptsModel::DisplayName).toString();
+        const auto timestamp   = index.data(ReceiptsModel::Timestamp).toString();
+        const auto pixmap      = avatar(index.data(ReceiptsModel::AvatarUrl).toString());
+
+        const bool circles = UserSettings::snapshot()->avatarCircles;
+
+        painter->save();
+        painter->setRenderHint(QPainter::Antialiasing);
+        painter->setRenderHint(QPainter::SmoothPixmapTransform);
+
+        const auto &r = option.rect;
+        const QRect avatarRect(
+          r.left(), r.top() + (r.height() - AVATAR_SIZE) / 2, AVATAR_SIZE, AVATAR_SIZE);
+
+        QPainterPath clip;
+        if (circles)
+                clip.addEllipse(avatarRect);
+        else
+                clip.addRoundedRect(avatarRect, 3, 3);
+
+        if (!pixmap.isNull()) {
+                painter->save();
+                painter->setClipPath(clip);
+                painter->drawPixmap(avatarRect, pixmap);
+                painter->restore();
+        } else {
+                // If it's a matrix id we use the second letter.
+                auto letter = utils::firstChar(displayName);
+                if (displayName.size() > 1 && displayName.at(0) == '@')
+                        letter = QString(displayName.at(1));
+
+                painter->fillPath(clip, option.palette.color(QPalette::Mid));
+                painter->setPen(option.palette.color(QPalette::Text));
+                painter->drawText(avatarRect.translated(0, -1), Qt::AlignCenter, letter);
+        }
+
+        QFont nameFont(option.font);
+        nameFont.setPointSizeF(nameFont.pointSizeF() * 1.1);
+        const QFontMetrics nameMetrics(nameFont);
+        const QFontMetrics metrics(option.font);
+
+        const int textLeft  = avatarRect.right() + 1 + conf::modals::WIDGET_SPACING;
+        const int textWidth = r.right() - textLeft;
+        const int textTop   = r.top() + (r.height() - nameMetrics.height() -
+                                       conf::modals::TEXT_SPACING - metrics.height()) /
+                                        2;
+
+        painter->setPen(option.palette.color(QPalette::Text));
+        painter->setFont(nameFont);
+        painter->drawText(QRect(textLeft, textTop, textWidth, nameMetrics.height()),
+                          Qt::AlignLeft | Qt::AlignVCenter,
+                          nameMetrics.elidedText(displayName, Qt::ElideRight, textWidth));
+
+        painter->setFont(option.font);
+        painter->drawText(QRect(textLeft,
+                                textTop + nameMetrics.height() + conf::modals::TEXT_SPACING,
+                                textWidth,
+                                metrics.height()),
+                          Qt::AlignLeft | Qt::AlignVCenter,
+                          metrics.elidedText(timestamp, Qt::ElideRight, textWidth));
+
+        painter->restore();
+}
+
 ReadReceipts::ReadReceipts(QWidget *parent)
   : QFrame(parent)
 {
@@ -97,10 +269,17 @@ ReadReceipts::ReadReceipts(QWidget *parent)
         layout->setSpacing(conf::modals::WIDGET_SPACING);
         layout->setMargin(conf::modals::WIDGET_MARGIN);
 
-        userList_ = new QListWidget;
+        receipts_ = new ReceiptsModel(this);
+
+        // The rows all have the same height, so the view doesn't measure the thousands of
+        // readers of an event in a large room.
+        userList_ = new QListView;
         userList_->setFrameStyle(QFrame::NoFrame);
         userList_->setSelectionMode(QAbstractItemView::NoSelection);
         userList_->setSpacing(conf::modals::TEXT_SPACING);
+        userList_->setUniformItemSizes(true);
+        userList_->setItemDelegate(new ReceiptDelegate(userList_));
+        userList_->setModel(receipts_);
 
         QFont largeFont;
         largeFont.setPointSizeF(largeFont.pointSizeF() * 1.5);
@@ -137,22 +316,8 @@ ReadReceipts::ReadReceipts(QWidget *parent)
 void
 ReadReceipts::addUsers(const std::multimap<uint64_t, std::string, std::greater<uint64_t>> &receipts)
 {
-        // We want to remove any previous items that have been set.
-        userList_->clear();
-
-        for (const auto &receipt : receipts) {
-                auto user = new ReceiptItem(this,
-                                            QString::fromStdString(receipt.second),
-                                            receipt.first,
-                                            ChatPage::instance()->currentRoom());
-                auto item = new QListWidgetItem(userList_);
-
-                item->setSizeHint(user->minimumSizeHint());
-                item->setFlags(Qt::NoItemFlags);
-                item->setTextAlignment(Qt::AlignCenter);
-
-                userList_->setItemWidget(item, user);
-        }
+        // Replaces any previous readers.
+        receipts_->setReceipts(ChatPage::instance()->currentRoom(), receipts);
 }
 
 void
@@ -1,39 +1,93 @@
 #pragma once
 
+#include <QAbstractListModel>
 #include <QDateTime>
 #include <QFrame>
-#include <QHBoxLayout>
+#include <QHash>
 #include <QLabel>
-#include <QListWidget>
-#include <QVBoxLayout>
+#include <QListView>
+#include <QSet>
+#include <QStyledItemDelegate>
 
-class Avatar;
+#include <functional>
+#include <map>
+#include <string>
+#include <vector>
 
 namespace dialogs {
 
-class ReceiptItem : public QWidget
+//! The readers of an event, latest first. The rows are added a page at a time, as the view
+//! scrolls, and the name and date of a row are only looked up, when it is shown.
+class ReceiptsModel : public QAbstractListModel
 {
         Q_OBJECT
 
 public:
-        ReceiptItem(QWidget *parent,
-                    const QString &user_id,
-                    uint64_t timestamp,
-                    const QString &room_id);
+        enum Roles
+        {
+                UserId = Qt::UserRole,
+                DisplayName,
+                Timestamp,
+                AvatarUrl,
+        };
 
-protected:
-        void paintEvent(QPaintEvent *) override;
+        explicit ReceiptsModel(QObject *parent = nullptr);
+
+        void setReceipts(const QString &room_id,
+                         const std::multimap<uint64_t, std::string, std::greater<uint64_t>> &users);
+        void clear();
+
+        int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+        bool canFetchMore(const QModelIndex &parent) const override;
+        void fetchMore(const QModelIndex &parent) override;
 
 private:
-        QString dateFormat(const QDateTime &then) const;
+        struct Receipt
+        {
+                QString user_id;
+                uint64_t timestamp;
+        };
+
+        //! The name, date and avatar of a shown row.
+        struct Row
+        {
+                QString displayName;
+                QString timestamp;
+                QString avatarUrl;
+        };
 
-        QHBoxLayout *topLayout_;
-        QVBoxLayout *textLayout_;
+        static QString dateFormat(const QDateTime &then);
+        const Row &row(int index) const;
 
-        Avatar *avatar_;
+        QString room_id_;
+        std::vector<Receipt> receipts_;
+        //! The number of receipts in the model.
+        int shown_ = 0;
+        mutable QHash<int, Row> rows_;
+};
+
+//! Paints a reader with its avatar. The avatars are requested for the painted rows only.
+class ReceiptDelegate : public QStyledItemDelegate
+{
+        Q_OBJECT
+
+public:
+        explicit ReceiptDelegate(QListView *view);
+
+        void paint(QPainter *painter,
+                   const QStyleOptionViewItem &option,
+                   const QModelIndex &index) const override;
+        QSize sizeHint(const QStyleOptionViewItem &option, const QModelIndex &index) const override;
+
+private:
+        //! The avatar at its size in the list, if it is in memory. Otherwise it is loaded and the
+        //! view repainted afterwards.
+        QPixmap avatar(const QString &avatarUrl) const;
 
-        QLabel *userName_;
-        QLabel *timestamp_;
+        QListView *view_;
+        mutable QSet<QString> loadingAvatars_;
 };
 
 class ReadReceipts : public QFrame
@@ -49,13 +103,14 @@ protected:
         void paintEvent(QPaintEvent *event) override;
         void hideEvent(QHideEvent *event) override
         {
-                userList_->clear();
+                receipts_->clear();
                 QFrame::hideEvent(event);
         }
 
 private:
         QLabel *topLabel_;
 
-        QListWidget *userList_;
+        QListView *userList_;
+        ReceiptsModel *receipts_;
 };
 } // dialogs
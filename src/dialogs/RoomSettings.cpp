@@ -22,6 +22,7 @@
 #include "Config.h"
 #include "Logging.h"
 #include "MatrixClient.h"
+#include "NetworkUsage.h"
 #include "Utils.h"
 #include "ui/Avatar.h"
 #include "ui/FlatButton.h"
@@ -218,95 +219,25 @@ RoomSettings::RoomSettings(const QString &room_id, QWidget *parent)
         notifCombo->addItem(tr("Mentions only")); // {"actions":["dont_notify"]}
         notifCombo->addItem(tr("All messages"));  // delete rule
 
-        connect(this, &RoomSettings::notifChanged, notifCombo, &QComboBox::setCurrentIndex);
-        http::client()->get_pushrules(
-          "global",
-          "override",
-          room_id_.toStdString(),
-          [this](const mtx::pushrules::PushRule &rule, mtx::http::RequestErr &err) {
-                  if (err) {
-                          if (err->status_code == boost::beast::http::status::not_found)
-                                  http::client()->get_pushrules(
-                                    "global",
-                                    "room",
-                                    room_id_.toStdString(),
-                                    [this](const mtx::pushrules::PushRule &rule,
-                                           mtx::http::RequestErr &err) {
-                                            if (err) {
-                                                    emit notifChanged(2); // all messages
-                                                    return;
-                                            }
-
-                                            if (rule.enabled)
-                                                    emit notifChanged(1); // mentions only
-                                    });
-                          return;
-                  }
-
-                  if (rule.enabled)
-                          emit notifChanged(0); // muted
-                  else
-                          emit notifChanged(2); // all messages
-          });
-
-        connect(notifCombo, QOverload<int>::of(&QComboBox::activated), [this](int index) {
-                std::string room_id = room_id_.toStdString();
-                if (index == 0) {
-                        // mute room
-                        // delete old rule first, then add new rule
-                        mtx::pushrules::PushRule rule;
-                        rule.actions = {mtx::pushrules::actions::dont_notify{}};
-                        mtx::pushrules::PushCondition condition;
-                        condition.kind    = "event_match";
-                        condition.key     = "room_id";
-                        condition.pattern = room_id;
-                        rule.conditions   = {condition};
-
-                        http::client()->put_pushrules(
-                          "global",
-                          "override",
-                          room_id,
-                          rule,
-                          [room_id](mtx::http::RequestErr &err) {
-                                  if (err)
-                                          nhlog::net()->error(
-                                            "failed to set pushrule for room {}: {} {}",
-                                            room_id,
-                                            static_cast<int>(err->status_code),
-                                            err->matrix_error.error);
-                                  http::client()->delete_pushrules(
-                                    "global", "room", room_id, [room_id](mtx::http::RequestErr &) {
-                                    });
-                          });
-                } else if (index == 1) {
-                        // mentions only
-                        // delete old rule first, then add new rule
-                        mtx::pushrules::PushRule rule;
-                        rule.actions = {mtx::pushrules::actions::dont_notify{}};
-                        http::client()->put_pushrules(
-                          "global", "room", room_id, rule, [room_id](mtx::http::RequestErr &err) {
-                                  if (err)
-                                          nhlog::net()->error(
-                                            "failed to set pushrule for room {}: {} {}",
-                                            room_id,
-                                            static_cast<int>(err->status_code),
-                                            err->matrix_error.error);
-                                  http::client()->delete_pushrules(
-                                    "global",
-                                    "override",
-                                    room_id,
-                                    [room_id](mtx::http::RequestErr &) {});
-                          });
-                } else {
-                        // all messages
-                        http::client()->delete_pushrules(
-                          "global", "override", room_id, [room_id](mtx::http::RequestErr &) {
-                                  http::client()->delete_pushrules(
-                                    "global", "room", room_id, [room_id](mtx::http::RequestErr &) {
-                                    });
-                          });
-                }
-        });
+        // The dialog shows the cached rules. They are fetched again, if that failed so far, and
+        // the level is shown again, once they arrive.
+        auto pushRules = &ChatPage::instance()->pushRules();
+        if (!pushRules->loaded())
+                pushRules->fetch();
+
+        auto showLevel = [this, pushRules]() {
+                notifCombo->setCurrentIndex(static_cast<int>(pushRules->roomLevel(room_id_)));
+        };
+        showLevel();
+        connect(pushRules, &PushRules::rulesChanged, this, showLevel);
+
+        connect(notifCombo,
+                QOverload<int>::of(&QComboBox::activated),
+                this,
+                [this, pushRules](int index) {
+                        pushRules->setRoomLevel(room_id_,
+                                                static_cast<PushRules::RoomLevel>(index));
+                });
 
         auto notifOptionLayout_ = new QHBoxLayout;
         notifOptionLayout_->setMargin(0);
@@ -782,6 +713,8 @@ RoomSettings::updateAvatar()
 
         // First we need to create a new mxc URI
         // (i.e upload media to the Matrix content repository) for the new avatar.
+        http::countRequest(http::Traffic::Upload);
+        http::countBytes(http::Traffic::Upload, payload.size());
         http::client()->upload(
           payload,
           mime.name().toStdString(),
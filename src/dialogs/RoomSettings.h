@@ -119,7 +119,6 @@ signals:
         void enableEncryptionError(const QString &msg);
         void showErrorMessage(const QString &msg);
         void accessRulesUpdated();
-        void notifChanged(int index);
 
 protected:
         void showEvent(QShowEvent *event) override;
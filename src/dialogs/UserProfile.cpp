@@ -8,6 +8,7 @@
 #include "ChatPage.h"
 #include "Logging.h"
 #include "MatrixClient.h"
+#include "Olm.h"
 #include "Utils.h"
 #include "dialogs/UserProfile.h"
 #include "ui/Avatar.h"
@@ -232,43 +233,32 @@ UserProfile::init(const QString &userId, const QString &roomId)
                 ignoreBtn_->hide();
         }
 
-        mtx::requests::QueryKeys req;
-        req.device_keys[userId.toStdString()] = {};
-
         // A proxy object is used to emit the signal instead of the original object
         // which might be destroyed by the time the http call finishes.
         auto proxy = std::make_shared<Proxy>();
         QObject::connect(proxy.get(), &Proxy::done, this, &UserProfile::updateDeviceList);
 
-        http::client()->query_keys(
-          req,
-          [user_id = userId.toStdString(), proxy = std::move(proxy)](
-            const mtx::responses::QueryKeys &res, mtx::http::RequestErr err) {
-                  if (err) {
-                          nhlog::net()->warn("failed to query device keys: {} {}",
-                                             err->matrix_error.error,
-                                             static_cast<int>(err->status_code));
+        // The devices come from the cache, unless they changed since they were queried.
+        olm::query_device_keys(
+          {userId.toStdString()},
+          [user_id = userId.toStdString(), proxy = std::move(proxy)](olm::UserDevices devices,
+                                                                     bool failed) {
+                  if (failed) {
                           // TODO: Notify the UI.
                           return;
                   }
 
-                  if (res.device_keys.empty() ||
-                      (res.device_keys.find(user_id) == res.device_keys.end())) {
+                  auto devicesOfUser = devices.find(user_id);
+                  if (devicesOfUser == devices.end() || devicesOfUser->second.empty()) {
                           nhlog::net()->warn("no devices retrieved {}", user_id);
                           return;
                   }
 
-                  auto devices = res.device_keys.at(user_id);
-
                   std::vector<DeviceInfo> deviceInfo;
-                  for (const auto &d : devices) {
-                          auto device = d.second;
-
-                          // TODO: Verify signatures and ignore those that don't pass.
-                          deviceInfo.emplace_back(DeviceInfo{
-                            QString::fromStdString(d.first),
-                            QString::fromStdString(device.unsigned_info.device_display_name)});
-                  }
+                  for (const auto &[device_id, keys] : devicesOfUser->second)
+                          deviceInfo.emplace_back(
+                            DeviceInfo{QString::fromStdString(device_id),
+                                       QString::fromStdString(keys.display_name)});
 
                   std::sort(deviceInfo.begin(),
                             deviceInfo.end(),
@@ -276,8 +266,7 @@ UserProfile::init(const QString &userId, const QString &roomId)
                                     return a.device_id > b.device_id;
                             });
 
-                  if (!deviceInfo.empty())
-                          emit proxy->done(QString::fromStdString(user_id), deviceInfo);
+                  emit proxy->done(QString::fromStdString(user_id), deviceInfo);
           });
 }
 
@@ -25,24 +25,54 @@
 
 using namespace emoji;
 
-Category::Category(QString category, std::vector<Emoji> emoji, QWidget *parent)
+constexpr int EMOJI_SIZE = 48;
+
+EmojiModel::EmojiModel(const Emojis &emoji, int emojiSize, QObject *parent)
+  : QAbstractListModel(parent)
+  , emoji_(emoji)
+  , emojiSize_(emojiSize)
+{}
+
+int
+EmojiModel::rowCount(const QModelIndex &parent) const
+{
+        return parent.isValid() ? 0 : static_cast<int>(emoji_.size());
+}
+
+QVariant
+EmojiModel::data(const QModelIndex &index, int role) const
+{
+        if (!index.isValid() || index.row() >= rowCount())
+                return QVariant();
+
+        switch (role) {
+        case Qt::UserRole:
+                return QString::fromUtf8(emoji_.begin()[index.row()].unicode);
+        case Qt::SizeHintRole:
+                return QSize(emojiSize_, emojiSize_);
+        default:
+                return QVariant();
+        }
+}
+
+Category::Category(QString category, const Emojis &emoji, QWidget *parent)
   : QWidget(parent)
+  , emoji_(emoji)
 {
         mainLayout_ = new QVBoxLayout(this);
         mainLayout_->setMargin(0);
         mainLayout_->setSpacing(0);
 
         emojiListView_ = new QListView();
-        itemModel_     = new QStandardItemModel(this);
 
         delegate_ = new ItemDelegate(this);
-        data_     = new Emoji;
 
         emojiListView_->setItemDelegate(delegate_);
-        emojiListView_->setModel(itemModel_);
         emojiListView_->setViewMode(QListView::IconMode);
         emojiListView_->setFlow(QListView::LeftToRight);
         emojiListView_->setResizeMode(QListView::Adjust);
+        // Every emoji has the same size, so the layout doesn't ask each one for it.
+        emojiListView_->setUniformItemSizes(true);
         emojiListView_->setMouseTracking(true);
         emojiListView_->verticalScrollBar()->setEnabled(false);
         emojiListView_->horizontalScrollBar()->setEnabled(false);
@@ -50,26 +80,13 @@ Category::Category(QString category, std::vector<Emoji> emoji, QWidget *parent)
         const int cols = 7;
         const int rows = emoji.size() / 7 + 1;
 
-        const int emojiSize = 48;
-        const int gridSize  = emojiSize + 4;
+        const int gridSize = EMOJI_SIZE + 4;
         // TODO: Be precise here. Take the parent into consideration.
         emojiListView_->setFixedSize(cols * gridSize + 20, rows * gridSize);
         emojiListView_->setGridSize(QSize(gridSize, gridSize));
         emojiListView_->setDragEnabled(false);
         emojiListView_->setEditTriggers(QAbstractItemView::NoEditTriggers);
 
-        for (const auto &e : emoji) {
-                data_->unicode = e.unicode;
-
-                auto item = new QStandardItem;
-                item->setSizeHint(QSize(emojiSize, emojiSize));
-
-                QVariant unicode(data_->unicode);
-                item->setData(unicode.toString(), Qt::UserRole);
-
-                itemModel_->appendRow(item);
-        }
-
         QFont font;
         font.setWeight(QFont::Medium);
 
@@ -82,6 +99,23 @@ Category::Category(QString category, std::vector<Emoji> emoji, QWidget *parent)
         connect(emojiListView_, &QListView::clicked, this, &Category::clickIndex);
 }
 
+void
+Category::load()
+{
+        if (itemModel_)
+                return;
+
+        itemModel_ = new EmojiModel(emoji_, EMOJI_SIZE, this);
+        emojiListView_->setModel(itemModel_);
+}
+
+void
+Category::updateFont()
+{
+        delegate_->updateFont();
+        emojiListView_->viewport()->update();
+}
+
 void
 Category::paintEvent(QPaintEvent *)
 {
@@ -17,16 +17,32 @@
 
 #pragma once
 
+#include <QAbstractListModel>
 #include <QColor>
 #include <QLabel>
 #include <QLayout>
 #include <QListView>
-#include <QStandardItemModel>
 
 #include "ItemDelegate.h"
 
 namespace emoji {
 
+//! The emoji of a category. Their strings are only created for the rows, which are painted.
+class EmojiModel : public QAbstractListModel
+{
+        Q_OBJECT
+
+public:
+        EmojiModel(const Emojis &emoji, int emojiSize, QObject *parent = nullptr);
+
+        int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex &index, int role) const override;
+
+private:
+        Emojis emoji_;
+        int emojiSize_;
+};
+
 class Category : public QWidget
 {
         Q_OBJECT
@@ -34,10 +50,16 @@ class Category : public QWidget
           QColor hoverBackgroundColor READ hoverBackgroundColor WRITE setHoverBackgroundColor)
 
 public:
-        Category(QString category, std::vector<Emoji> emoji, QWidget *parent = nullptr);
+        Category(QString category, const Emojis &emoji, QWidget *parent = nullptr);
         QColor hoverBackgroundColor() const { return hoverBackgroundColor_; }
         void setHoverBackgroundColor(QColor color) { hoverBackgroundColor_ = color; }
 
+        //! Give the view its model. The panel does it, once the category is scrolled into view,
+        //! so the categories, which are never seen, cost only their layout.
+        void load();
+        //! Paint the emoji with the emoji font of the settings.
+        void updateFont();
+
 signals:
         void emojiSelected(const QString &emoji);
 
@@ -53,10 +75,10 @@ private slots:
 private:
         QVBoxLayout *mainLayout_;
 
-        QStandardItemModel *itemModel_;
+        Emojis emoji_;
+        EmojiModel *itemModel_ = nullptr;
         QListView *emojiListView_;
 
-        emoji::Emoji *data_;
         emoji::ItemDelegate *delegate_;
 
         QLabel *category_;
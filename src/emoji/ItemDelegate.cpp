@@ -14,7 +14,6 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
-
 #include <QPainter>
 #include <QSettings>
 
@@ -22,45 +21,73 @@
 
 using namespace emoji;
 
+//! Enough for a few screens of glyphs at a high device pixel ratio.
+constexpr int GLYPH_CACHE_BYTES = 8 * 1024 * 1024;
+constexpr int GLYPH_PIXEL_SIZE  = 36;
+
 ItemDelegate::ItemDelegate(QObject *parent)
   : QStyledItemDelegate(parent)
 {
-        data_ = new Emoji;
+        updateFont();
 }
 
-ItemDelegate::~ItemDelegate() { delete data_; }
+QCache<QString, QPixmap> &
+ItemDelegate::glyphs()
+{
+        static QCache<QString, QPixmap> cache(GLYPH_CACHE_BYTES);
+        return cache;
+}
 
 void
-ItemDelegate::paint(QPainter *painter,
-                    const QStyleOptionViewItem &option,
-                    const QModelIndex &index) const
+ItemDelegate::updateFont()
 {
-        Q_UNUSED(index);
-
-        painter->save();
-
-        QStyleOptionViewItem viewOption(option);
-
-        auto emoji = index.data(Qt::UserRole).toString();
-
         QSettings settings;
 
-        QFont font;
         QString userFontFamily = settings.value("user/emoji_font_family", "emoji").toString();
         if (!userFontFamily.isEmpty()) {
-                font.setFamily(userFontFamily);
+                font_.setFamily(userFontFamily);
         } else {
-                font.setFamily("emoji");
+                font_.setFamily("emoji");
         }
 
-        font.setPixelSize(36);
-        painter->setFont(font);
+        font_.setPixelSize(GLYPH_PIXEL_SIZE);
+}
+
+void
+ItemDelegate::paint(QPainter *painter,
+                    const QStyleOptionViewItem &option,
+                    const QModelIndex &index) const
+{
+        const auto emoji = index.data(Qt::UserRole).toString();
+        const auto dpr   = painter->device()->devicePixelRatioF();
+        const auto size  = option.rect.size();
+
         if (option.state & QStyle::State_MouseOver) {
-                painter->setBackgroundMode(Qt::OpaqueMode);
                 QColor hoverColor = parent()->property("hoverBackgroundColor").value<QColor>();
-                painter->setBackground(hoverColor);
+                painter->fillRect(option.rect, hoverColor);
+        }
+
+        const auto key = QString("%1_%2_%3x%4_%5")
+                           .arg(emoji)
+                           .arg(font_.family())
+                           .arg(size.width())
+                           .arg(size.height())
+                           .arg(dpr);
+
+        auto glyph = glyphs().object(key);
+        if (!glyph) {
+                QPixmap pixmap(size * dpr);
+                pixmap.setDevicePixelRatio(dpr);
+                pixmap.fill(Qt::transparent);
+
+                QPainter p(&pixmap);
+                p.setFont(font_);
+                p.drawText(QRect(QPoint(), size), Qt::AlignCenter, emoji);
+                p.end();
+
+                glyph = new QPixmap(pixmap);
+                glyphs().insert(key, glyph, pixmap.width() * pixmap.height() * 4);
         }
-        painter->drawText(viewOption.rect, Qt::AlignCenter, emoji);
 
-        painter->restore();
+        painter->drawPixmap(option.rect.topLeft(), *glyph);
 }
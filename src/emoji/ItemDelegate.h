@@ -14,30 +14,38 @@
  * You should have received a copy of the GNU General Public License
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
-
 #pragma once
 
+#include <QCache>
+#include <QFont>
 #include <QModelIndex>
-#include <QStandardItemModel>
+#include <QPixmap>
 #include <QStyledItemDelegate>
 
 #include "Provider.h"
 
 namespace emoji {
 
+//! Paints the emoji of a category. The glyphs are rendered once per font and size and then
+//! blitted from a cache, which all categories share.
 class ItemDelegate : public QStyledItemDelegate
 {
         Q_OBJECT
 
 public:
         explicit ItemDelegate(QObject *parent = nullptr);
-        ~ItemDelegate() override;
 
         void paint(QPainter *painter,
                    const QStyleOptionViewItem &option,
                    const QModelIndex &index) const override;
 
+        //! Read the emoji font from the settings again.
+        void updateFont();
+
 private:
-        Emoji *data_;
+        //! The rendered glyphs by emoji, font and device pixel size. The cost is in bytes.
+        static QCache<QString, QPixmap> &glyphs();
+
+        QFont font_;
 };
 } // namespace emoji
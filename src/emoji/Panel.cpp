@@ -18,6 +18,7 @@
 #include <QPainter>
 #include <QPushButton>
 #include <QScrollBar>
+#include <QTimer>
 #include <QVBoxLayout>
 
 #include "ui/DropShadow.h"
@@ -145,9 +146,23 @@ Panel::Panel(QWidget *parent)
         auto flagsEmoji = new Category(tr("Flags"), emoji_provider_.flags, scrollWidget);
         scrollLayout->addWidget(flagsEmoji);
 
+        categories_ = {peopleEmoji,
+                       natureEmoji,
+                       foodEmoji,
+                       activityEmoji,
+                       travelEmoji,
+                       objectsEmoji,
+                       symbolsEmoji,
+                       flagsEmoji};
+
         contentLayout->addWidget(scrollArea_);
         contentLayout->addWidget(emojiCategories);
 
+        connect(scrollArea_->verticalScrollBar(),
+                &QScrollBar::valueChanged,
+                this,
+                &Panel::loadVisibleCategories);
+
         connect(peopleEmoji, &Category::emojiSelected, this, &Panel::emojiSelected);
         connect(peopleCategory, &QPushButton::clicked, [this, peopleEmoji]() {
                 this->showCategory(peopleEmoji);
@@ -208,6 +223,33 @@ Panel::showCategory(const Category *category)
         this->scrollArea_->ensureVisible(0, posToGo, 0, 0);
 }
 
+void
+Panel::loadVisibleCategories()
+{
+        const auto screen = scrollArea_->viewport()->height();
+        const auto top    = scrollArea_->verticalScrollBar()->value() - screen;
+        const auto bottom = top + 3 * screen;
+
+        for (auto category : categories_) {
+                const auto geometry = category->geometry();
+                if (geometry.bottom() >= top && geometry.top() <= bottom)
+                        category->load();
+        }
+}
+
+void
+Panel::showEvent(QShowEvent *event)
+{
+        QWidget::showEvent(event);
+
+        // The font may have changed in the settings, while the panel was hidden.
+        for (auto category : categories_)
+                category->updateFont();
+
+        // The categories are laid out, once the event loop runs again.
+        QTimer::singleShot(0, this, &Panel::loadVisibleCategories);
+}
+
 void
 Panel::paintEvent(QPaintEvent *event)
 {
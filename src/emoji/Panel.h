@@ -19,6 +19,8 @@
 
 #include <QScrollArea>
 
+#include <vector>
+
 #include "Provider.h"
 
 namespace emoji {
@@ -44,16 +46,20 @@ protected:
         }
 
         void paintEvent(QPaintEvent *event) override;
+        void showEvent(QShowEvent *event) override;
 
 signals:
         void leaving();
 
 private:
         void showCategory(const Category *category);
+        //! Load the categories in view and the ones a screen below and above it.
+        void loadVisibleCategories();
 
         Provider emoji_provider_;
 
         QScrollArea *scrollArea_;
+        std::vector<Category *> categories_;
 
         int shadowMargin_;
 
@@ -17,29 +17,54 @@
 
 #pragma once
 
-#include <QString>
+#include <cstddef>
 #include <vector>
 
+#include <QString>
+
 namespace emoji {
 
 struct Emoji
 {
-        // Unicode code.
-        QString unicode;
+        // Unicode code as UTF-8.
+        const char *unicode;
         // Keyboard shortcut e.g :emoji:
-        QString shortname;
+        const char *shortname;
+};
+
+//! A list of emoji in constant storage. Unlike a vector, it needs no initialization at startup.
+class Emojis
+{
+public:
+        template<std::size_t N>
+        constexpr Emojis(const Emoji (&emoji)[N])
+          : begin_(emoji)
+          , end_(emoji + N)
+        {}
+
+        constexpr const Emoji *begin() const { return begin_; }
+        constexpr const Emoji *end() const { return end_; }
+        constexpr std::size_t size() const { return end_ - begin_; }
+
+private:
+        const Emoji *begin_;
+        const Emoji *end_;
 };
 
 class Provider
 {
 public:
-        static const std::vector<Emoji> people;
-        static const std::vector<Emoji> nature;
-        static const std::vector<Emoji> food;
-        static const std::vector<Emoji> activity;
-        static const std::vector<Emoji> travel;
-        static const std::vector<Emoji> objects;
-        static const std::vector<Emoji> symbols;
-        static const std::vector<Emoji> flags;
+        static const Emojis people;
+        static const Emojis nature;
+        static const Emojis food;
+        static const Emojis activity;
+        static const Emojis travel;
+        static const Emojis objects;
+        static const Emojis symbols;
+        static const Emojis flags;
+
+        //! Up to max_items emoji with a word of their shortname starting with prefix, for the
+        //! completion of :shortcodes. The index of the words is built by the first search.
+        static std::vector<const Emoji *> search(const QString &prefix, std::size_t max_items);
 };
 } // namespace emoji
@@ -15,13 +15,16 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <chrono>
 #include <iostream>
+#include <memory>
 
 #include <QApplication>
 #include <QCommandLineParser>
 #include <QDesktopWidget>
 #include <QDir>
 #include <QFile>
+#include <QFileInfo>
 #include <QFontDatabase>
 #include <QGuiApplication>
 #include <QLabel>
@@ -31,14 +34,20 @@
 #include <QScreen>
 #include <QSettings>
 #include <QStandardPaths>
+#include <QTemporaryDir>
 #include <QTranslator>
 
+#include "ChatPage.h"
 #include "Config.h"
 #include "Logging.h"
 #include "MainWindow.h"
 #include "MatrixClient.h"
+#include "PerfReport.h"
+#include "Startup.h"
+#include "Trace.h"
 #include "Utils.h"
 #include "config/nheko.h"
+#include "timeline/TimelineStats.h"
 #include "singleapplication.h"
 
 #if defined(Q_OS_MAC)
@@ -101,6 +110,24 @@ createCacheDirectory()
         }
 }
 
+//! Point the config, data and cache locations at dir, with a copy of the settings, so the session
+//! stays logged in, but starts with an empty cache. The profile itself isn't changed.
+void
+useTemporaryProfile(const QString &dir)
+{
+        const auto settings = QSettings().fileName();
+        const auto config   = dir + "/config";
+
+        qputenv("XDG_CONFIG_HOME", config.toUtf8());
+        qputenv("XDG_DATA_HOME", (dir + "/data").toUtf8());
+        qputenv("XDG_CACHE_HOME", (dir + "/cache").toUtf8());
+        QSettings::setPath(QSettings::NativeFormat, QSettings::UserScope, config);
+
+        const auto copy = QSettings().fileName();
+        QDir().mkpath(QFileInfo(copy).absolutePath());
+        QFile::copy(settings, copy);
+}
+
 int
 main(int argc, char *argv[])
 {
@@ -130,8 +157,75 @@ main(int argc, char *argv[])
         parser.addVersionOption();
         QCommandLineOption debugOption("debug", "Enable debug output");
         parser.addOption(debugOption);
+        QCommandLineOption traceOption(
+          "trace", "Write a Chrome trace of the startup and the syncs to <file> on exit", "file");
+        parser.addOption(traceOption);
+        QCommandLineOption replayOption(
+          "replay-syncs",
+          "Replay the sync responses in the json files of <directory> instead of syncing",
+          "directory");
+        parser.addOption(replayOption);
+        QCommandLineOption replayIntervalOption(
+          "replay-interval",
+          "Wait <ms> between the replayed sync responses, instead of replaying them at once",
+          "ms",
+          "0");
+        parser.addOption(replayIntervalOption);
+        QCommandLineOption replayIntoProfileOption(
+          "replay-into-profile",
+          "Save the replayed responses into the cache of the profile, instead of a temporary "
+          "profile, which starts with an empty cache");
+        parser.addOption(replayIntoProfileOption);
+        QCommandLineOption headlessOption(
+          "headless",
+          "Don't show the window and quit after the replay, run with -platform offscreen to "
+          "replay without a display");
+        parser.addOption(headlessOption);
+        QCommandLineOption recordOption(
+          "record-syncs",
+          "Write the sync responses of the server to <directory>, for --replay-syncs",
+          "directory");
+        parser.addOption(recordOption);
+        QCommandLineOption startupBenchmarkOption(
+          "startup-benchmark",
+          "Append the times of the startup milestones to <file> and quit, once they are reached",
+          "file");
+        parser.addOption(startupBenchmarkOption);
+        QCommandLineOption scrollBenchmarkOption(
+          "scroll-benchmark",
+          "Run the scroll benchmark of the timeline, once a room is shown, append its result to "
+          "<file> and quit",
+          "file");
+        parser.addOption(scrollBenchmarkOption);
+        QCommandLineOption perfReportOption(
+          "perf-report",
+          "Write a json snapshot of the performance statistics to <file> on exit",
+          "file");
+        parser.addOption(perfReportOption);
         parser.process(app);
 
+        if (parser.isSet(startupBenchmarkOption))
+                startup::benchmark(parser.value(startupBenchmarkOption));
+
+        if (parser.isSet(scrollBenchmarkOption))
+                TimelineStats::setBenchmarkReport(parser.value(scrollBenchmarkOption));
+
+        // Removed on exit.
+        std::unique_ptr<QTemporaryDir> temporaryProfile;
+        if (parser.isSet(replayOption)) {
+                ChatPage::setReplayDirectory(parser.value(replayOption),
+                                             parser.value(replayIntervalOption).toInt(),
+                                             parser.isSet(headlessOption));
+
+                if (!parser.isSet(replayIntoProfileOption)) {
+                        temporaryProfile = std::make_unique<QTemporaryDir>();
+                        useTemporaryProfile(temporaryProfile->path());
+                }
+        }
+
+        if (parser.isSet(traceOption))
+                trace::start(parser.value(traceOption).toStdString());
+
         app.setWindowIcon(QIcon(":/logos/nheko.png"));
 
         http::init();
@@ -152,6 +246,9 @@ main(int argc, char *argv[])
                 std::exit(1);
         }
 
+        if (parser.isSet(recordOption))
+                ChatPage::setRecordDirectory(parser.value(recordOption));
+
         QSettings settings;
 
         QFont font;
@@ -173,22 +270,32 @@ main(int argc, char *argv[])
         appTranslator.load("nheko_" + lang, ":/translations");
         app.installTranslator(&appTranslator);
 
+        const auto windowStart = std::chrono::steady_clock::now();
         MainWindow w;
+        if (trace::enabled())
+                trace::record("MainWindow", windowStart, std::chrono::steady_clock::now());
 
         // Move the MainWindow to the center
         w.move(screenCenter(w.width(), w.height()));
 
-        if (!settings.value("user/window/start_in_tray", false).toBool() ||
-            !settings.value("user/window/tray", true).toBool())
+        if (!parser.isSet(headlessOption) &&
+            (!settings.value("user/window/start_in_tray", false).toBool() ||
+             !settings.value("user/window/tray", true).toBool()))
                 w.show();
 
-        QObject::connect(&app, &QApplication::aboutToQuit, &w, [&w]() {
+        const auto perfReport = parser.value(perfReportOption);
+        QObject::connect(&app, &QApplication::aboutToQuit, &w, [&w, perfReport]() {
                 w.saveCurrentWindowSize();
+                // Before the client is closed, while the timelines are still loaded.
+                if (!perfReport.isEmpty())
+                        perf::writeReport(perfReport);
                 if (http::client() != nullptr) {
                         nhlog::net()->debug("shutting down all I/O threads & open connections");
                         http::client()->close(true);
                         nhlog::net()->debug("bye");
                 }
+
+                trace::finish();
         });
         QObject::connect(&app, &SingleApplication::instanceStarted, &w, [&w]() {
                 w.show();
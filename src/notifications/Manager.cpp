@@ -0,0 +1,49 @@
+#include "notifications/Manager.h"
+
+#include "Logging.h"
+
+//! How many notifications are shown in an interval of the rate limit at most.
+constexpr int MAX_NOTIFICATIONS_PER_INTERVAL = 3;
+constexpr int RATE_LIMIT_INTERVAL            = 2'000;
+//! How many notifications wait for the rate limit at most.
+constexpr std::size_t MAX_QUEUED_NOTIFICATIONS = 10;
+
+void
+NotificationsManager::setupRateLimit()
+{
+        rateLimitTimer_.setInterval(RATE_LIMIT_INTERVAL);
+        rateLimitTimer_.setSingleShot(true);
+
+        connect(&rateLimitTimer_, &QTimer::timeout, this, [this]() {
+                shownInInterval_ = 0;
+                showQueued();
+        });
+}
+
+void
+NotificationsManager::postNotification(const DesktopNotification &notification)
+{
+        queued_.push_back(notification);
+
+        if (queued_.size() > MAX_QUEUED_NOTIFICATIONS) {
+                nhlog::ui()->debug("dropping desktop notification of {}, too many are queued",
+                                   queued_.front().roomId.toStdString());
+                queued_.pop_front();
+        }
+
+        showQueued();
+}
+
+void
+NotificationsManager::showQueued()
+{
+        while (!queued_.empty() && shownInInterval_ < MAX_NOTIFICATIONS_PER_INTERVAL) {
+                displayNotification(queued_.front());
+                queued_.pop_front();
+                ++shownInInterval_;
+        }
+
+        // The interval starts with the first notification shown in it.
+        if (shownInInterval_ > 0 && !rateLimitTimer_.isActive())
+                rateLimitTimer_.start();
+}
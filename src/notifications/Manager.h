@@ -1,12 +1,18 @@
 #pragma once
 
+#include <deque>
+#include <optional>
+#include <vector>
+
+#include <QHash>
 #include <QImage>
 #include <QObject>
+#include <QSet>
 #include <QString>
+#include <QTimer>
 
 #if defined(Q_OS_LINUX) || defined(Q_OS_FREEBSD)
 #include <QtDBus/QDBusArgument>
-#include <QtDBus/QDBusInterface>
 #endif
 
 struct roomEventId
@@ -21,18 +27,42 @@ operator==(const roomEventId &a, const roomEventId &b)
         return a.roomId == b.roomId && a.eventId == b.eventId;
 }
 
+struct DesktopNotification
+{
+        QString roomId;
+        //! The event, whose read receipt closes the notification.
+        QString eventId;
+        QString roomName;
+        QString senderName;
+        QString text;
+        QImage icon;
+};
+
+#if defined(Q_OS_LINUX) || defined(Q_OS_FREEBSD)
+//! The image-data hint of org.freedesktop.Notifications, encoded from an image once.
+struct NotificationImage
+{
+        int width         = 0;
+        int height        = 0;
+        int rowstride     = 0;
+        bool hasAlpha     = false;
+        int bitsPerSample = 0;
+        int channels      = 0;
+        QByteArray data;
+};
+
+Q_DECLARE_METATYPE(NotificationImage)
+#endif
+
 class NotificationsManager : public QObject
 {
         Q_OBJECT
 public:
         NotificationsManager(QObject *parent = nullptr);
 
-        void postNotification(const QString &roomId,
-                              const QString &eventId,
-                              const QString &roomName,
-                              const QString &senderName,
-                              const QString &text,
-                              const QImage &icon);
+        //! Show a notification. Only a few are shown at once, the ones of a burst wait in a queue
+        //! and the oldest are dropped, if it gets long.
+        void postNotification(const DesktopNotification &notification);
 
 signals:
         void notificationClicked(const QString roomId, const QString eventId);
@@ -42,12 +72,33 @@ public slots:
 
 #if defined(Q_OS_LINUX) || defined(Q_OS_FREEBSD)
 public:
+        //! Close the notification of the room, e.g. once it was read.
         void closeNotifications(QString roomId);
 
 private:
-        QDBusInterface dbus;
-        uint showNotification(const QString summary, const QString text, const QImage image);
-        void closeNotification(uint id);
+        //! The calls are asynchronous, so a slow notification daemon doesn't block the ui. A room
+        //! has one notification, which newer ones replace, and a room with a call in flight keeps
+        //! only its newest notification, until the call returned the id to replace.
+        void sendNotification(const DesktopNotification &notification);
+        //! The avatar of the room scaled down and encoded, which is cached per room.
+        NotificationImage roomImage(const QString &roomId, const QImage &icon);
+        //! Send the queued CloseNotification calls together.
+        void sendCloses();
+
+        struct RoomImage
+        {
+                QImage icon;
+                NotificationImage encoded;
+        };
+        QHash<QString, RoomImage> roomImages_;
+        //! The id of the shown notification of a room.
+        QHash<QString, uint> roomNotifications_;
+        //! The rooms with a Notify call in flight and the notification waiting for it, if any.
+        QHash<QString, std::optional<DesktopNotification>> inFlight_;
+        //! The rooms, whose notification is closed, once its Notify call returns.
+        QSet<QString> closeOnReply_;
+        std::vector<uint> pendingCloses_;
+        QTimer closeTimer_;
 
         // notification ID to (room ID, event ID)
         QMap<uint, roomEventId> notificationIds;
@@ -58,11 +109,24 @@ private:
 private slots:
         void actionInvoked(uint id, QString action);
         void notificationClosed(uint id, uint reason);
+
+private:
+        //! Show a notification by the platform's means.
+        void displayNotification(const DesktopNotification &notification);
+        //! Called by the constructors of the platforms.
+        void setupRateLimit();
+        //! Show the queued notifications, which the rate limit allows.
+        void showQueued();
+
+        QTimer rateLimitTimer_;
+        //! The notifications shown in the current interval of the rate limit.
+        int shownInInterval_ = 0;
+        std::deque<DesktopNotification> queued_;
 };
 
 #if defined(Q_OS_LINUX) || defined(Q_OS_FREEBSD)
 QDBusArgument &
-operator<<(QDBusArgument &arg, const QImage &image);
+operator<<(QDBusArgument &arg, const NotificationImage &image);
 const QDBusArgument &
-operator>>(const QDBusArgument &arg, QImage &);
+operator>>(const QDBusArgument &arg, NotificationImage &);
 #endif
@@ -1,123 +1,220 @@
 #include "notifications/Manager.h"
 
-#include <QDebug>
 #include <QImage>
 #include <QtDBus/QDBusConnection>
 #include <QtDBus/QDBusMessage>
 #include <QtDBus/QDBusMetaType>
+#include <QtDBus/QDBusPendingCallWatcher>
+#include <QtDBus/QDBusPendingReply>
+
+#include "Logging.h"
+
+//! The largest image-data hint sent. Notification daemons show small icons anyway.
+constexpr int MAX_IMAGE_SIZE = 100;
+
+namespace {
+const QString SERVICE   = QStringLiteral("org.freedesktop.Notifications");
+const QString PATH      = QStringLiteral("/org/freedesktop/Notifications");
+const QString INTERFACE = QStringLiteral("org.freedesktop.Notifications");
+
+/**
+ * Encoding of a QImage for org.freedesktop.Notifications.Notify
+ *
+ * This function is from the Clementine project (see
+ * http://www.clementine-player.org) and licensed under the GNU General Public
+ * License, version 3 or later.
+ *
+ * Copyright 2010, David Sansome <me@davidsansome.com>
+ */
+NotificationImage
+encodeImage(const QImage &image)
+{
+        NotificationImage encoded;
+        if (image.isNull())
+                return encoded;
+
+        QImage scaled = image.scaled(
+          MAX_IMAGE_SIZE, MAX_IMAGE_SIZE, Qt::KeepAspectRatio, Qt::SmoothTransformation);
+        scaled = scaled.convertToFormat(QImage::Format_ARGB32);
+
+#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
+        // ABGR -> ARGB
+        QImage i = scaled.rgbSwapped();
+#else
+        // ABGR -> GBAR
+        QImage i(scaled.size(), scaled.format());
+        for (int y = 0; y < i.height(); ++y) {
+                QRgb *p   = (QRgb *)scaled.scanLine(y);
+                QRgb *q   = (QRgb *)i.scanLine(y);
+                QRgb *end = p + scaled.width();
+                while (p < end) {
+                        *q = qRgba(qGreen(*p), qBlue(*p), qAlpha(*p), qRed(*p));
+                        p++;
+                        q++;
+                }
+        }
+#endif
+
+        encoded.width         = i.width();
+        encoded.height        = i.height();
+        encoded.rowstride     = i.bytesPerLine();
+        encoded.hasAlpha      = i.hasAlphaChannel();
+        encoded.channels      = i.isGrayscale() ? 1 : (i.hasAlphaChannel() ? 4 : 3);
+        encoded.bitsPerSample = i.depth() / encoded.channels;
+#if QT_VERSION < QT_VERSION_CHECK(5, 10, 0)
+        encoded.data = QByteArray(reinterpret_cast<const char *>(i.bits()), i.byteCount());
+#else
+        encoded.data = QByteArray(reinterpret_cast<const char *>(i.bits()), i.sizeInBytes());
+#endif
+        return encoded;
+}
+}
 
 NotificationsManager::NotificationsManager(QObject *parent)
   : QObject(parent)
-  , dbus("org.freedesktop.Notifications",
-         "/org/freedesktop/Notifications",
-         "org.freedesktop.Notifications",
-         QDBusConnection::sessionBus(),
-         this)
 {
-        qDBusRegisterMetaType<QImage>();
+        qDBusRegisterMetaType<NotificationImage>();
 
-        QDBusConnection::sessionBus().connect("org.freedesktop.Notifications",
-                                              "/org/freedesktop/Notifications",
-                                              "org.freedesktop.Notifications",
+        QDBusConnection::sessionBus().connect(SERVICE,
+                                              PATH,
+                                              INTERFACE,
                                               "ActionInvoked",
                                               this,
                                               SLOT(actionInvoked(uint, QString)));
-        QDBusConnection::sessionBus().connect("org.freedesktop.Notifications",
-                                              "/org/freedesktop/Notifications",
-                                              "org.freedesktop.Notifications",
+        QDBusConnection::sessionBus().connect(SERVICE,
+                                              PATH,
+                                              INTERFACE,
                                               "NotificationClosed",
                                               this,
                                               SLOT(notificationClosed(uint, uint)));
+
+        // The closes of the rooms read in one pass of the event loop are sent together.
+        closeTimer_.setSingleShot(true);
+        closeTimer_.setInterval(0);
+        connect(&closeTimer_, &QTimer::timeout, this, &NotificationsManager::sendCloses);
+
+        setupRateLimit();
 }
 
 void
-NotificationsManager::postNotification(const QString &roomid,
-                                       const QString &eventid,
-                                       const QString &roomname,
-                                       const QString &sender,
-                                       const QString &text,
-                                       const QImage &icon)
+NotificationsManager::displayNotification(const DesktopNotification &n)
 {
-        uint id             = showNotification(roomname, sender + ": " + text, icon);
-        notificationIds[id] = roomEventId{roomid, eventid};
+        // Only the newest notification waits for the call in flight.
+        if (auto waiting = inFlight_.find(n.roomId); waiting != inFlight_.end()) {
+                *waiting = n;
+                closeOnReply_.remove(n.roomId);
+                return;
+        }
+
+        sendNotification(n);
 }
-/**
- * This function is based on code from
- * https://github.com/rohieb/StratumsphereTrayIcon
- * Copyright (C) 2012 Roland Hieber <rohieb@rohieb.name>
- * Licensed under the GNU General Public License, version 3
- */
-uint
-NotificationsManager::showNotification(const QString summary,
-                                       const QString text,
-                                       const QImage image)
+
+void
+NotificationsManager::sendNotification(const DesktopNotification &n)
 {
+        // The icon of nheko stands in for the avatar of the room, until it is loaded.
         QVariantMap hints;
-        hints["image-data"] = image;
+        if (!n.icon.isNull())
+                hints["image-data"] = QVariant::fromValue(roomImage(n.roomId, n.icon));
         hints["sound-name"] = "message-new-instant";
-        QList<QVariant> argumentList;
-        argumentList << "nheko";                             // app_name
-        argumentList << (uint)0;                             // replace_id
-        argumentList << "";                                  // app_icon
-        argumentList << summary;                             // summary
-        argumentList << text;                                // body
-        argumentList << (QStringList("default") << "reply"); // actions
-        argumentList << hints;                               // hints
-        argumentList << (int)-1;                             // timeout in ms
-
-        static QDBusInterface notifyApp("org.freedesktop.Notifications",
-                                        "/org/freedesktop/Notifications",
-                                        "org.freedesktop.Notifications");
-        QDBusMessage reply =
-          notifyApp.callWithArgumentList(QDBus::AutoDetect, "Notify", argumentList);
-        if (reply.type() == QDBusMessage::ErrorMessage) {
-                qDebug() << "D-Bus Error:" << reply.errorMessage();
-                return 0;
-        } else {
-                return reply.arguments().first().toUInt();
-        }
-        return true;
+
+        auto message = QDBusMessage::createMethodCall(SERVICE, PATH, INTERFACE, "Notify");
+        message << "nheko";                               // app_name
+        message << roomNotifications_.value(n.roomId, 0); // replace_id
+        message << (n.icon.isNull() ? "nheko" : "");      // app_icon
+        message << n.roomName;                            // summary
+        message << n.senderName + ": " + n.text;          // body
+        message << (QStringList("default") << "reply");   // actions
+        message << hints;                                 // hints
+        message << (int)-1;                               // timeout in ms
+
+        inFlight_.insert(n.roomId, std::nullopt);
+
+        auto watcher =
+          new QDBusPendingCallWatcher(QDBusConnection::sessionBus().asyncCall(message), this);
+        connect(watcher,
+                &QDBusPendingCallWatcher::finished,
+                this,
+                [this, roomId = n.roomId, eventId = n.eventId](QDBusPendingCallWatcher *call) {
+                        call->deleteLater();
+
+                        QDBusPendingReply<uint> reply = *call;
+                        if (reply.isError()) {
+                                nhlog::ui()->warn("failed to show a notification: {}",
+                                                  reply.error().message().toStdString());
+                        } else {
+                                const auto id = reply.value();
+                                notificationIds.remove(roomNotifications_.value(roomId, 0));
+                                roomNotifications_[roomId] = id;
+                                notificationIds[id]        = roomEventId{roomId, eventId};
+                        }
+
+                        const auto waiting = inFlight_.take(roomId);
+                        if (closeOnReply_.remove(roomId))
+                                closeNotifications(roomId);
+                        else if (waiting)
+                                sendNotification(*waiting);
+                });
+}
+
+NotificationImage
+NotificationsManager::roomImage(const QString &roomId, const QImage &icon)
+{
+        auto cached = roomImages_.find(roomId);
+        if (cached != roomImages_.end() && cached->icon == icon)
+                return cached->encoded;
+
+        auto encoded        = encodeImage(icon);
+        roomImages_[roomId] = {icon, encoded};
+        return encoded;
 }
 
 void
-NotificationsManager::closeNotification(uint id)
+NotificationsManager::closeNotifications(QString roomId)
 {
-        QList<QVariant> argumentList;
-        argumentList << (uint)id; // replace_id
-
-        static QDBusInterface closeCall("org.freedesktop.Notifications",
-                                        "/org/freedesktop/Notifications",
-                                        "org.freedesktop.Notifications");
-        QDBusMessage reply =
-          closeCall.callWithArgumentList(QDBus::AutoDetect, "CloseNotification", argumentList);
-        if (reply.type() == QDBusMessage::ErrorMessage) {
-                qDebug() << "D-Bus Error:" << reply.errorMessage();
+        // The notification in flight is closed, once its id is known.
+        if (auto waiting = inFlight_.find(roomId); waiting != inFlight_.end()) {
+                waiting->reset();
+                closeOnReply_.insert(roomId);
+                return;
         }
+
+        auto id = roomNotifications_.find(roomId);
+        if (id == roomNotifications_.end())
+                return;
+
+        pendingCloses_.push_back(id.value());
+        notificationIds.remove(id.value());
+        roomNotifications_.erase(id);
+
+        if (!closeTimer_.isActive())
+                closeTimer_.start();
 }
 
 void
-NotificationsManager::removeNotification(const QString &roomId, const QString &eventId)
+NotificationsManager::sendCloses()
 {
-        roomEventId reId = {roomId, eventId};
-        for (auto elem = notificationIds.begin(); elem != notificationIds.end(); ++elem) {
-                if (elem.value().roomId != roomId)
-                        continue;
-
-                // close all notifications matching the eventId or having a lower
-                // notificationId
-                // This relies on the notificationId not wrapping around. This allows for
-                // approximately 2,147,483,647 notifications, so it is a bit unlikely.
-                // Otherwise we would need to store a 64bit counter instead.
-                closeNotification(elem.key());
-
-                // FIXME: compare index of event id of the read receipt and the notification instead
-                // of just the id to prevent read receipts of events without notification clearing
-                // all notifications in that room!
-                if (elem.value() == reId)
-                        break;
+        std::vector<uint> ids;
+        ids.swap(pendingCloses_);
+
+        for (auto id : ids) {
+                auto message =
+                  QDBusMessage::createMethodCall(SERVICE, PATH, INTERFACE, "CloseNotification");
+                message << id;
+
+                // Nothing waits for the replies.
+                QDBusConnection::sessionBus().asyncCall(message);
         }
 }
 
+void
+NotificationsManager::removeNotification(const QString &roomId, const QString &)
+{
+        // A room only has a single notification. Every read receipt of the user in the room
+        // closes it, like it did, when a room had several.
+        closeNotifications(roomId);
+}
+
 void
 NotificationsManager::actionInvoked(uint id, QString action)
 {
@@ -131,68 +228,33 @@ void
 NotificationsManager::notificationClosed(uint id, uint reason)
 {
         Q_UNUSED(reason);
-        notificationIds.remove(id);
+
+        auto entry = notificationIds.find(id);
+        if (entry == notificationIds.end())
+                return;
+
+        if (roomNotifications_.value(entry->roomId, 0) == id)
+                roomNotifications_.remove(entry->roomId);
+        notificationIds.erase(entry);
 }
 
-/**
- * Automatic marshaling of a QImage for org.freedesktop.Notifications.Notify
- *
- * This function is from the Clementine project (see
- * http://www.clementine-player.org) and licensed under the GNU General Public
- * License, version 3 or later.
- *
- * Copyright 2010, David Sansome <me@davidsansome.com>
- */
 QDBusArgument &
-operator<<(QDBusArgument &arg, const QImage &image)
+operator<<(QDBusArgument &arg, const NotificationImage &image)
 {
-        if (image.isNull()) {
-                arg.beginStructure();
-                arg << 0 << 0 << 0 << false << 0 << 0 << QByteArray();
-                arg.endStructure();
-                return arg;
-        }
-
-        QImage scaled = image.scaledToHeight(100, Qt::SmoothTransformation);
-        scaled        = scaled.convertToFormat(QImage::Format_ARGB32);
-
-#if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
-        // ABGR -> ARGB
-        QImage i = scaled.rgbSwapped();
-#else
-        // ABGR -> GBAR
-        QImage i(scaled.size(), scaled.format());
-        for (int y = 0; y < i.height(); ++y) {
-                QRgb *p   = (QRgb *)scaled.scanLine(y);
-                QRgb *q   = (QRgb *)i.scanLine(y);
-                QRgb *end = p + scaled.width();
-                while (p < end) {
-                        *q = qRgba(qGreen(*p), qBlue(*p), qAlpha(*p), qRed(*p));
-                        p++;
-                        q++;
-                }
-        }
-#endif
-
         arg.beginStructure();
-        arg << i.width();
-        arg << i.height();
-        arg << i.bytesPerLine();
-        arg << i.hasAlphaChannel();
-        int channels = i.isGrayscale() ? 1 : (i.hasAlphaChannel() ? 4 : 3);
-        arg << i.depth() / channels;
-        arg << channels;
-#if QT_VERSION < QT_VERSION_CHECK(5, 10, 0)
-        arg << QByteArray(reinterpret_cast<const char *>(i.bits()), i.byteCount());
-#else
-        arg << QByteArray(reinterpret_cast<const char *>(i.bits()), i.sizeInBytes());
-#endif
+        arg << image.width;
+        arg << image.height;
+        arg << image.rowstride;
+        arg << image.hasAlpha;
+        arg << image.bitsPerSample;
+        arg << image.channels;
+        arg << image.data;
         arg.endStructure();
         return arg;
 }
 
 const QDBusArgument &
-operator>>(const QDBusArgument &arg, QImage &)
+operator>>(const QDBusArgument &arg, NotificationImage &)
 {
         // This is needed to link but shouldn't be called.
         Q_ASSERT(0);
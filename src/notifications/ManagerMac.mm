@@ -9,27 +9,17 @@
 
 NotificationsManager::NotificationsManager(QObject *parent): QObject(parent)
 {
-
+    setupRateLimit();
 }
 
 void
-NotificationsManager::postNotification(
-                const QString &roomId,
-                const QString &eventId,
-                const QString &roomName,
-                const QString &senderName,
-                const QString &text,
-                const QImage &icon)
+NotificationsManager::displayNotification(const DesktopNotification &n)
 {
-    Q_UNUSED(roomId);
-    Q_UNUSED(eventId);
-    Q_UNUSED(icon);
-
     NSUserNotification * notif = [[NSUserNotification alloc] init];
 
-    notif.title           = roomName.toNSString();
-    notif.subtitle        = QString("%1 sent a message").arg(senderName).toNSString();
-    notif.informativeText = text.toNSString();
+    notif.title           = n.roomName.toNSString();
+    notif.subtitle        = QString("%1 sent a message").arg(n.senderName).toNSString();
+    notif.informativeText = n.text.toNSString();
     notif.soundName       = NSUserNotificationDefaultSoundName;
 
     [[NSUserNotificationCenter defaultUserNotificationCenter] deliverNotification: notif];
@@ -29,31 +29,25 @@ init()
 
 NotificationsManager::NotificationsManager(QObject *parent)
   : QObject(parent)
-{}
+{
+        setupRateLimit();
+}
 
 void
-NotificationsManager::postNotification(const QString &room_id,
-                                       const QString &event_id,
-                                       const QString &room_name,
-                                       const QString &sender,
-                                       const QString &text,
-                                       const QImage &icon)
+NotificationsManager::displayNotification(const DesktopNotification &n)
 {
-        Q_UNUSED(room_id)
-        Q_UNUSED(event_id)
-        Q_UNUSED(icon)
-
         if (!isInitialized)
                 init();
 
         auto templ = WinToastTemplate(WinToastTemplate::ImageAndText02);
-        if (room_name != sender)
-                templ.setTextField(QString("%1 - %2").arg(sender).arg(room_name).toStdWString(),
-                                   WinToastTemplate::FirstLine);
+        if (n.roomName != n.senderName)
+                templ.setTextField(
+                  QString("%1 - %2").arg(n.senderName).arg(n.roomName).toStdWString(),
+                  WinToastTemplate::FirstLine);
         else
-                templ.setTextField(QString("%1").arg(sender).toStdWString(),
+                templ.setTextField(QString("%1").arg(n.senderName).toStdWString(),
                                    WinToastTemplate::FirstLine);
-        templ.setTextField(QString("%1").arg(text).toStdWString(), WinToastTemplate::SecondLine);
+        templ.setTextField(QString("%1").arg(n.text).toStdWString(), WinToastTemplate::SecondLine);
         // TODO: implement room or user avatar
         // templ.setImagePath(L"C:/example.png");
 
@@ -82,6 +82,18 @@ UserItem::updateItem(const QString &user_id)
         resolveAvatar(user_id);
 }
 
+void
+UserItem::setFromDirectory(bool fromDirectory)
+{
+        auto font = userName_->font();
+        font.setItalic(fromDirectory);
+        userName_->setFont(font);
+
+        setToolTip(fromDirectory ? tr("Found in the user directory of the server, may not be a "
+                                      "member of this room")
+                                 : QString());
+}
+
 void
 UserItem::resolveAvatar(const QString &user_id)
 {
@@ -53,6 +53,8 @@ public:
         UserItem(QWidget *parent, const QString &user_id);
         QString selectedText() const { return userId_; }
         void updateItem(const QString &user_id);
+        //! Mark a user of the user directory, who may not be a member of the room.
+        void setFromDirectory(bool fromDirectory);
 
 protected:
         void mousePressEvent(QMouseEvent *event) override;
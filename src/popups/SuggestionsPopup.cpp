@@ -81,13 +81,16 @@ SuggestionsPopup::addUsers(const std::vector<SearchResult> &users)
                 // layout position.
                 if (!item) {
                         auto user = new UserItem(this, users.at(i).user_id);
+                        user->setFromDirectory(users.at(i).from_directory);
                         connect(user, &UserItem::clicked, this, &SuggestionsPopup::itemSelected);
                         layout_->addWidget(user);
                 } else {
                         // Update the current widget with the new data.
                         auto userWidget = qobject_cast<UserItem *>(item->widget());
-                        if (userWidget)
+                        if (userWidget) {
                                 userWidget->updateItem(users.at(i).user_id);
+                                userWidget->setFromDirectory(users.at(i).from_directory);
+                        }
                 }
         }
 
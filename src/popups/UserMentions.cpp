@@ -1,19 +1,125 @@
+#include <algorithm>
+
+#include <QListView>
 #include <QPaintEvent>
 #include <QPainter>
-#include <QScrollArea>
 #include <QStyleOption>
 #include <QTabWidget>
-#include <QTimer>
 #include <QVBoxLayout>
 
 #include "Cache.h"
 #include "ChatPage.h"
 #include "Logging.h"
 #include "UserMentions.h"
-//#include "timeline/TimelineItem.h"
+#include "Utils.h"
 
 using namespace popups;
 
+//! The number of mentions read from the cache at once.
+constexpr std::size_t MENTIONS_PAGE_SIZE = 50;
+
+MentionsModel::MentionsModel(QObject *parent)
+  : QAbstractListModel(parent)
+{}
+
+void
+MentionsModel::reset(const QString &room_id)
+{
+        beginResetModel();
+        room_id_ = room_id.toStdString();
+        mentions_.clear();
+        rendered_.clear();
+        next_token_.clear();
+        atEnd_ = false;
+        endResetModel();
+}
+
+int
+MentionsModel::rowCount(const QModelIndex &parent) const
+{
+        return parent.isValid() ? 0 : static_cast<int>(mentions_.size());
+}
+
+QVariant
+MentionsModel::data(const QModelIndex &index, int role) const
+{
+        if (!index.isValid() || index.row() >= rowCount() || role != Qt::DisplayRole)
+                return {};
+
+        if (auto text = rendered_.constFind(index.row()); text != rendered_.constEnd())
+                return *text;
+
+        const auto &mention = mentions_[index.row()];
+        const auto room_id  = QString::fromStdString(mention.room_id);
+
+        auto text = QString("%1: %2").arg(
+          cache::displayName(room_id, utils::event_sender(mention.event)),
+          utils::event_body(mention.event));
+
+        // The list of all rooms names the room of every mention.
+        if (room_id_.empty())
+                text = QString("[%1] %2")
+                         .arg(QString::fromStdString(cache::singleRoomInfo(mention.room_id).name),
+                              text);
+
+        rendered_.insert(index.row(), text);
+        return text;
+}
+
+void
+MentionsModel::insertMentions(const std::vector<mtx::responses::Notification> &mentions)
+{
+        for (const auto &mention : mentions) {
+                if (!room_id_.empty() && mention.room_id != room_id_)
+                        continue;
+
+                const auto ts  = utils::event_timestamp(mention.event);
+                const auto pos = std::find_if(
+                  mentions_.begin(), mentions_.end(), [ts](const auto &m) {
+                          return utils::event_timestamp(m.event) < ts;
+                  });
+
+                // The older rows are read from the cache, once the view scrolls there.
+                if (pos == mentions_.end() && !atEnd_)
+                        continue;
+
+                const auto row = static_cast<int>(pos - mentions_.begin());
+                beginInsertRows(QModelIndex(), row, row);
+                mentions_.insert(pos, mention);
+                // The rendered rows moved.
+                rendered_.clear();
+                endInsertRows();
+        }
+}
+
+bool
+MentionsModel::canFetchMore(const QModelIndex &parent) const
+{
+        return !parent.isValid() && !atEnd_;
+}
+
+void
+MentionsModel::fetchMore(const QModelIndex &parent)
+{
+        if (!canFetchMore(parent))
+                return;
+
+        auto page = cache::getMentions(room_id_, next_token_, MENTIONS_PAGE_SIZE);
+
+        next_token_ = std::move(page.next_token);
+        atEnd_      = next_token_.empty();
+
+        if (page.mentions.empty())
+                return;
+
+        const auto first = static_cast<int>(mentions_.size());
+        beginInsertRows(QModelIndex(), first, first + static_cast<int>(page.mentions.size()) - 1);
+        mentions_.insert(mentions_.end(),
+                         std::make_move_iterator(page.mentions.begin()),
+                         std::make_move_iterator(page.mentions.end()));
+        endInsertRows();
+}
+
 UserMentions::UserMentions(QWidget *parent)
   : QWidget{parent}
 {
@@ -26,139 +132,66 @@ UserMentions::UserMentions(QWidget *parent)
         top_layout_->setSpacing(0);
         top_layout_->setMargin(0);
 
-        local_scroll_area_ = new QScrollArea(this);
-        local_scroll_area_->setWidgetResizable(true);
-        local_scroll_area_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-
-        local_scroll_widget_ = new QWidget(this);
-        local_scroll_widget_->setObjectName("local_scroll_widget");
-
-        all_scroll_area_ = new QScrollArea(this);
-        all_scroll_area_->setWidgetResizable(true);
-        all_scroll_area_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
-
-        all_scroll_widget_ = new QWidget(this);
-        all_scroll_widget_->setObjectName("all_scroll_widget");
-
-        // Height of the typing display.
-        QFont f;
-        f.setPointSizeF(f.pointSizeF() * 0.9);
-        const int bottomMargin = QFontMetrics(f).height() + 6;
-
-        local_scroll_layout_ = new QVBoxLayout(local_scroll_widget_);
-        local_scroll_layout_->setContentsMargins(4, 0, 15, bottomMargin);
-        local_scroll_layout_->setSpacing(0);
-        local_scroll_layout_->setObjectName("localscrollarea");
+        local_mentions_ = new MentionsModel(this);
+        all_mentions_   = new MentionsModel(this);
 
-        all_scroll_layout_ = new QVBoxLayout(all_scroll_widget_);
-        all_scroll_layout_->setContentsMargins(4, 0, 15, bottomMargin);
-        all_scroll_layout_->setSpacing(0);
-        all_scroll_layout_->setObjectName("allscrollarea");
+        // The rows are a line each, so the views don't have to measure every one of them.
+        local_view_ = new QListView(this);
+        local_view_->setObjectName("localscrollarea");
+        local_view_->setUniformItemSizes(true);
+        local_view_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+        local_view_->setModel(local_mentions_);
 
-        local_scroll_area_->setWidget(local_scroll_widget_);
-        local_scroll_area_->setAlignment(Qt::AlignBottom);
+        all_view_ = new QListView(this);
+        all_view_->setObjectName("allscrollarea");
+        all_view_->setUniformItemSizes(true);
+        all_view_->setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOff);
+        all_view_->setModel(all_mentions_);
 
-        all_scroll_area_->setWidget(all_scroll_widget_);
-        all_scroll_area_->setAlignment(Qt::AlignBottom);
-
-        tab_layout_->addTab(local_scroll_area_, tr("This Room"));
-        tab_layout_->addTab(all_scroll_area_, tr("All Rooms"));
+        tab_layout_->addTab(local_view_, tr("This Room"));
+        tab_layout_->addTab(all_view_, tr("All Rooms"));
         top_layout_->addWidget(tab_layout_);
 
         setLayout(top_layout_);
 }
 
 void
-UserMentions::initializeMentions(const QMap<QString, mtx::responses::Notifications> &notifs)
+UserMentions::showPopup()
 {
-        nhlog::ui()->debug("Initializing " + std::to_string(notifs.size()) + " notifications.");
-
-        for (const auto &item : notifs) {
-                for (const auto &notif : item.notifications) {
-                        const auto event_id = QString::fromStdString(utils::event_id(notif.event));
-
-                        try {
-                                const auto room_id = QString::fromStdString(notif.room_id);
-                                const auto user_id = utils::event_sender(notif.event);
-                                const auto body    = utils::event_body(notif.event);
-
-                                pushItem(event_id,
-                                         user_id,
-                                         body,
-                                         room_id,
-                                         ChatPage::instance()->currentRoom());
-
-                        } catch (const lmdb::error &e) {
-                                nhlog::db()->warn("error while sending desktop notification: {}",
-                                                  e.what());
-                        }
-                }
-        }
+        const auto room_id = ChatPage::instance()->currentRoom();
+
+        // Only the first page is read. The views fetch the rest, as they are scrolled.
+        local_mentions_->reset(room_id);
+        all_mentions_->reset(QString());
+        updateCounts();
+
+        show();
 }
 
 void
-UserMentions::showPopup()
+UserMentions::addMentions(const std::vector<mtx::responses::Notification> &mentions)
 {
-        for (auto widget : all_scroll_layout_->findChildren<QWidget *>()) {
-                delete widget;
-        }
-        for (auto widget : local_scroll_layout_->findChildren<QWidget *>()) {
-                delete widget;
-        }
-
-        auto notifs = cache::getTimelineMentions();
+        if (!isVisible())
+                return;
 
-        initializeMentions(notifs);
-        show();
+        local_mentions_->insertMentions(mentions);
+        all_mentions_->insertMentions(mentions);
+        updateCounts();
 }
 
 void
-UserMentions::pushItem(const QString &event_id,
-                       const QString &user_id,
-                       const QString &body,
-                       const QString &room_id,
-                       const QString &current_room_id)
+UserMentions::updateCounts()
 {
-        (void)event_id;
-        (void)user_id;
-        (void)body;
-        (void)room_id;
-        (void)current_room_id;
-        //        setUpdatesEnabled(false);
-        //
-        //        // Add to the 'all' section
-        //        TimelineItem *view_item = new TimelineItem(
-        //          mtx::events::MessageType::Text, user_id, body, true, room_id,
-        //          all_scroll_widget_);
-        //        view_item->setEventId(event_id);
-        //        view_item->hide();
-        //
-        //        all_scroll_layout_->addWidget(view_item);
-        //        QTimer::singleShot(0, this, [view_item, this]() {
-        //                view_item->show();
-        //                view_item->adjustSize();
-        //                setUpdatesEnabled(true);
-        //        });
-        //
-        //        // if it matches the current room... add it to the current room as well.
-        //        if (QString::compare(room_id, current_room_id, Qt::CaseInsensitive) == 0) {
-        //                // Add to the 'local' section
-        //                TimelineItem *local_view_item = new
-        //                TimelineItem(mtx::events::MessageType::Text,
-        //                                                                 user_id,
-        //                                                                 body,
-        //                                                                 true,
-        //                                                                 room_id,
-        //                                                                 local_scroll_widget_);
-        //                local_view_item->setEventId(event_id);
-        //                local_view_item->hide();
-        //                local_scroll_layout_->addWidget(local_view_item);
-        //
-        //                QTimer::singleShot(0, this, [local_view_item]() {
-        //                        local_view_item->show();
-        //                        local_view_item->adjustSize();
-        //                });
-        //        }
+        const auto room_id = ChatPage::instance()->currentRoom();
+        const auto summary = cache::mentionsSummary();
+        const auto room    = summary.rooms.find(room_id.toStdString());
+
+        tab_layout_->setTabText(
+          0,
+          tr("This Room (%1)").arg(room != summary.rooms.end() ? room->second : uint64_t(0)));
+        tab_layout_->setTabText(1, tr("All Rooms (%1)").arg(summary.total));
+
+        nhlog::ui()->debug("showing {} mentions", summary.total);
 }
 
 void
@@ -1,45 +1,72 @@
 #pragma once
 
-#include <mtx/responses.hpp>
-
-#include <QMap>
+#include <QAbstractListModel>
+#include <QHash>
 #include <QString>
 #include <QWidget>
 
+#include "CacheStructs.h"
+
+class QListView;
 class QPaintEvent;
 class QTabWidget;
-class QScrollArea;
 class QVBoxLayout;
 
 namespace popups {
 
+//! The stored mentions of a room or of all rooms, newest first. They are read from the cache a
+//! page at a time, as the view scrolls down, and a row is only rendered, when it is shown.
+class MentionsModel : public QAbstractListModel
+{
+        Q_OBJECT
+
+public:
+        explicit MentionsModel(QObject *parent = nullptr);
+
+        //! Start over with the mentions of room_id or of all rooms, if it is empty.
+        void reset(const QString &room_id);
+        //! Add the mentions, which were stored after the model was reset, at their position. The
+        //! ones of other rooms and the ones below the rows, which were read so far, are skipped.
+        void insertMentions(const std::vector<mtx::responses::Notification> &mentions);
+
+        int rowCount(const QModelIndex &parent = QModelIndex()) const override;
+        QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+
+        bool canFetchMore(const QModelIndex &parent) const override;
+        void fetchMore(const QModelIndex &parent) override;
+
+private:
+        std::string room_id_;
+        std::vector<mtx::responses::Notification> mentions_;
+        std::string next_token_;
+        bool atEnd_ = true;
+        //! The rendered rows by row.
+        mutable QHash<int, QString> rendered_;
+};
+
 class UserMentions : public QWidget
 {
         Q_OBJECT
 public:
         UserMentions(QWidget *parent = nullptr);
 
-        void initializeMentions(const QMap<QString, mtx::responses::Notifications> &notifs);
         void showPopup();
+        //! Show the newly stored mentions, if the popup is open.
+        void addMentions(const std::vector<mtx::responses::Notification> &mentions);
 
 protected:
         void paintEvent(QPaintEvent *) override;
 
 private:
-        void pushItem(const QString &event_id,
-                      const QString &user_id,
-                      const QString &body,
-                      const QString &room_id,
-                      const QString &current_room_id);
+        void updateCounts();
+
         QTabWidget *tab_layout_;
         QVBoxLayout *top_layout_;
-        QVBoxLayout *local_scroll_layout_;
-        QVBoxLayout *all_scroll_layout_;
 
-        QScrollArea *local_scroll_area_;
-        QWidget *local_scroll_widget_;
+        QListView *local_view_;
+        MentionsModel *local_mentions_;
 
-        QScrollArea *all_scroll_area_;
-        QWidget *all_scroll_widget_;
+        QListView *all_view_;
+        MentionsModel *all_mentions_;
 };
 }
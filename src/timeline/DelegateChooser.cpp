@@ -38,6 +38,16 @@ DelegateChoice::setRoleValue(const QVariant &value)
         }
 }
 
+void
+DelegateChoice::setAsynchronous(bool asynchronous)
+{
+        if (asynchronous != asynchronous_) {
+                asynchronous_ = asynchronous;
+                emit asynchronousChanged();
+                emit changed();
+        }
+}
+
 QVariant
 DelegateChooser::roleValue() const
 {
@@ -54,6 +64,15 @@ DelegateChooser::setRoleValue(const QVariant &value)
         }
 }
 
+void
+DelegateChooser::setPlaceholder(QQmlComponent *placeholder)
+{
+        if (placeholder != placeholder_) {
+                placeholder_ = placeholder;
+                emit placeholderChanged();
+        }
+}
+
 QQmlListProperty<DelegateChoice>
 DelegateChooser::choices()
 {
@@ -94,17 +113,93 @@ DelegateChooser::recalcChild()
         for (const auto choice : qAsConst(choices_)) {
                 auto choiceValue = choice->roleValue();
                 if (!roleValue_.isValid() || !choiceValue.isValid() || choiceValue == roleValue_) {
+                        if (choice == (child_ ? childChoice_ : incubating_))
+                                return;
+
+                        // The delegate of the previous role value isn't needed anymore.
+                        incubator.clear();
+                        asyncIncubator.clear();
+                        incubating_ = nullptr;
+
                         if (child_) {
-                                child_->setParentItem(nullptr);
-                                child_ = nullptr;
+                                hideItem(child_);
+                                pool_.insert(childChoice_, child_);
+                                setChild(nullptr, nullptr);
+                        }
+
+                        if (auto pooled = pool_.take(choice)) {
+                                setChild(choice, pooled);
+                                return;
+                        }
+
+                        auto context = QQmlEngine::contextForObject(this);
+                        incubating_  = choice;
+
+                        if (!choice->asynchronous() || !placeholder_) {
+                                choice->delegate()->create(incubator, context);
+                                return;
                         }
 
-                        choice->delegate()->create(incubator, QQmlEngine::contextForObject(this));
+                        if (auto item = createPlaceholder())
+                                showItem(item);
+
+                        choice->delegate()->create(asyncIncubator, context);
                         return;
                 }
         }
 }
 
+QQuickItem *
+DelegateChooser::createPlaceholder()
+{
+        if (placeholderItem_)
+                return placeholderItem_;
+
+        auto object      = placeholder_->create(QQmlEngine::contextForObject(this));
+        placeholderItem_ = qobject_cast<QQuickItem *>(object);
+        if (!placeholderItem_) {
+                nhlog::ui()->error("Placeholder has to be derived of Item!");
+                delete object;
+                return nullptr;
+        }
+
+        placeholderItem_->setParent(this);
+        connect(placeholderItem_, &QQuickItem::heightChanged, this, [this]() {
+                if (!child_)
+                        setHeight(placeholderItem_->height());
+        });
+
+        return placeholderItem_;
+}
+
+void
+DelegateChooser::setChild(DelegateChoice *choice, QQuickItem *item)
+{
+        child_       = item;
+        childChoice_ = choice;
+
+        if (item) {
+                if (placeholderItem_)
+                        hideItem(placeholderItem_);
+                showItem(item);
+        }
+
+        emit childChanged();
+}
+
+void
+DelegateChooser::showItem(QQuickItem *item)
+{
+        item->setParentItem(this);
+        setHeight(item->height());
+}
+
+void
+DelegateChooser::hideItem(QQuickItem *item)
+{
+        item->setParentItem(nullptr);
+}
+
 void
 DelegateChooser::componentComplete()
 {
@@ -116,22 +211,25 @@ void
 DelegateChooser::DelegateIncubator::statusChanged(QQmlIncubator::Status status)
 {
         if (status == QQmlIncubator::Ready) {
-                chooser.child_ = dynamic_cast<QQuickItem *>(object());
-                if (chooser.child_ == nullptr) {
+                auto choice         = chooser.incubating_;
+                chooser.incubating_ = nullptr;
+
+                auto item = dynamic_cast<QQuickItem *>(object());
+                if (item == nullptr) {
                         nhlog::ui()->error("Delegate has to be derived of Item!");
                         return;
                 }
 
-                chooser.child_->setParentItem(&chooser);
-                connect(chooser.child_, &QQuickItem::heightChanged, &chooser, [this]() {
-                        chooser.setHeight(chooser.child_->height());
+                // Owned by the chooser, so the delegates in the pool aren't collected.
+                item->setParent(&chooser);
+                connect(item, &QQuickItem::heightChanged, &chooser, [this, item]() {
+                        if (chooser.child_ == item)
+                                chooser.setHeight(item->height());
                 });
-                chooser.setHeight(chooser.child_->height());
-                QQmlEngine::setObjectOwnership(chooser.child_,
-                                               QQmlEngine::ObjectOwnership::JavaScriptOwnership);
-                emit chooser.childChanged();
+                chooser.setChild(choice, item);
 
         } else if (status == QQmlIncubator::Error) {
+                chooser.incubating_ = nullptr;
                 for (const auto &e : errors())
                         nhlog::ui()->error("Error instantiating delegate: {}",
                                            e.toString().toStdString());
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <QHash>
 #include <QQmlComponent>
 #include <QQmlIncubator>
 #include <QQmlListProperty>
@@ -20,6 +21,10 @@ class DelegateChoice : public QObject
 public:
         Q_PROPERTY(QVariant roleValue READ roleValue WRITE setRoleValue NOTIFY roleValueChanged)
         Q_PROPERTY(QQmlComponent *delegate READ delegate WRITE setDelegate NOTIFY delegateChanged)
+        //! Create the delegate in the background, while the placeholder of the chooser is shown.
+        //! For delegates, which are expensive to create, e.g. the media messages.
+        Q_PROPERTY(bool asynchronous READ asynchronous WRITE setAsynchronous NOTIFY
+                     asynchronousChanged)
 
         QQmlComponent *delegate() const;
         void setDelegate(QQmlComponent *delegate);
@@ -27,14 +32,19 @@ public:
         QVariant roleValue() const;
         void setRoleValue(const QVariant &value);
 
+        bool asynchronous() const { return asynchronous_; }
+        void setAsynchronous(bool asynchronous);
+
 signals:
         void delegateChanged();
         void roleValueChanged();
+        void asynchronousChanged();
         void changed();
 
 private:
         QVariant roleValue_;
         QQmlComponent *delegate_ = nullptr;
+        bool asynchronous_       = false;
 };
 
 class DelegateChooser : public QQuickItem
@@ -46,6 +56,10 @@ public:
         Q_PROPERTY(QQmlListProperty<DelegateChoice> choices READ choices CONSTANT)
         Q_PROPERTY(QVariant roleValue READ roleValue WRITE setRoleValue NOTIFY roleValueChanged)
         Q_PROPERTY(QQuickItem *child READ child NOTIFY childChanged)
+        //! Shown instead of the child, while an asynchronous delegate is created. It should be
+        //! cheap and about as high as the delegate.
+        Q_PROPERTY(QQmlComponent *placeholder READ placeholder WRITE setPlaceholder NOTIFY
+                     placeholderChanged)
 
         QQmlListProperty<DelegateChoice> choices();
 
@@ -54,6 +68,9 @@ public:
 
         QQuickItem *child() const { return child_; }
 
+        QQmlComponent *placeholder() const { return placeholder_; }
+        void setPlaceholder(QQmlComponent *placeholder);
+
         void recalcChild();
         void componentComplete() override;
 
@@ -61,12 +78,13 @@ signals:
         void roleChanged();
         void roleValueChanged();
         void childChanged();
+        void placeholderChanged();
 
 private:
         struct DelegateIncubator : public QQmlIncubator
         {
-                DelegateIncubator(DelegateChooser &parent)
-                  : QQmlIncubator(QQmlIncubator::AsynchronousIfNested)
+                DelegateIncubator(DelegateChooser &parent, QQmlIncubator::IncubationMode mode)
+                  : QQmlIncubator(mode)
                   , chooser(parent)
                 {}
                 void statusChanged(QQmlIncubator::Status status) override;
@@ -74,10 +92,26 @@ private:
                 DelegateChooser &chooser;
         };
 
+        //! Show item of choice as the child. With nullptr the chooser is empty.
+        void setChild(DelegateChoice *choice, QQuickItem *item);
+        //! The item of the placeholder. It is created once and reused.
+        QQuickItem *createPlaceholder();
+        void showItem(QQuickItem *item);
+        void hideItem(QQuickItem *item);
+
         QVariant roleValue_;
         QList<DelegateChoice *> choices_;
-        QQuickItem *child_ = nullptr;
-        DelegateIncubator incubator{*this};
+        QQuickItem *child_           = nullptr;
+        DelegateChoice *childChoice_ = nullptr;
+        //! The choice, whose delegate is incubating.
+        DelegateChoice *incubating_ = nullptr;
+        //! The delegates of the other choices, which were shown before. The role value of a row
+        //! changes e.g. when its event is decrypted or edited, and may change back.
+        QHash<DelegateChoice *, QQuickItem *> pool_;
+        QQmlComponent *placeholder_  = nullptr;
+        QQuickItem *placeholderItem_ = nullptr;
+        DelegateIncubator incubator{*this, QQmlIncubator::AsynchronousIfNested};
+        DelegateIncubator asyncIncubator{*this, QQmlIncubator::Asynchronous};
 
         static void appendChoice(QQmlListProperty<DelegateChoice> *, DelegateChoice *);
         static int choiceCount(QQmlListProperty<DelegateChoice> *);
@@ -0,0 +1,84 @@
+#include "EventFetcher.h"
+
+#include "Cache.h"
+#include "Logging.h"
+#include "MatrixClient.h"
+
+Q_DECLARE_METATYPE(std::optional<mtx::events::collections::TimelineEvents>)
+
+//! How many events of a room are requested at the same time.
+constexpr std::size_t MAX_RUNNING_REQUESTS = 4;
+
+EventFetcher::EventFetcher(QString room_id, QObject *parent)
+  : QObject(parent)
+  , room_id_(std::move(room_id))
+{
+        qRegisterMetaType<std::optional<mtx::events::collections::TimelineEvents>>();
+
+        connect(this, &EventFetcher::requestFinished, this, &EventFetcher::finishRequest);
+}
+
+std::optional<mtx::events::collections::TimelineEvents>
+EventFetcher::fetch(const std::string &event_id, const QString &requesting_event)
+{
+        if (auto cached = cache::getEvent(room_id_.toStdString(), event_id))
+                return cached;
+
+        auto [waiting, isNew] = waiting_.try_emplace(event_id);
+        if (!waiting->second.contains(requesting_event))
+                waiting->second.push_back(requesting_event);
+
+        if (isNew) {
+                queue_.push_back(event_id);
+                startRequests();
+        }
+
+        return std::nullopt;
+}
+
+void
+EventFetcher::finishRequest(const QString &event_id,
+                            const std::optional<mtx::events::collections::TimelineEvents> &event)
+{
+        running_--;
+
+        auto waiting = waiting_.find(event_id.toStdString());
+        if (waiting != waiting_.end()) {
+                auto requesting_events = waiting->second;
+                waiting_.erase(waiting);
+
+                if (event)
+                        emit fetched(requesting_events, *event);
+        }
+
+        startRequests();
+}
+
+void
+EventFetcher::startRequests()
+{
+        while (running_ < MAX_RUNNING_REQUESTS && !queue_.empty()) {
+                const auto event_id = queue_.front();
+                queue_.pop_front();
+                running_++;
+
+                const auto room_id = room_id_.toStdString();
+                http::client()->get_event(
+                  room_id,
+                  event_id,
+                  [this, room_id, event_id](const mtx::events::collections::TimelineEvents &event,
+                                            mtx::http::RequestErr err) {
+                          if (err) {
+                                  nhlog::net()->error("failed to retrieve event {} of room {}",
+                                                      event_id,
+                                                      room_id);
+                                  emit requestFinished(QString::fromStdString(event_id),
+                                                       std::nullopt);
+                                  return;
+                          }
+
+                          cache::storeFetchedEvent(room_id, event);
+                          emit requestFinished(QString::fromStdString(event_id), event);
+                  });
+        }
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <deque>
+#include <map>
+#include <optional>
+#include <string>
+
+#include <QObject>
+#include <QStringList>
+
+#include <mtx/events/collections.hpp>
+
+//! Retrieves events of a room, which a timeline shows but doesn't contain, e.g. the targets of
+//! replies.
+//!
+//! The cache is asked first. Otherwise one request is made per event, no matter how many events
+//! wait for it, and only a few requests run at the same time. Retrieved events are stored in the
+//! cache, so they aren't requested again after a restart.
+class EventFetcher : public QObject
+{
+        Q_OBJECT
+
+public:
+        EventFetcher(QString room_id, QObject *parent = nullptr);
+
+        //! The event, if it is in the cache. Otherwise it is requested and fetched() is emitted
+        //! with the requesting event, once it was retrieved.
+        std::optional<mtx::events::collections::TimelineEvents> fetch(
+          const std::string &event_id,
+          const QString &requesting_event);
+        //! Whether requests are waiting or running.
+        bool busy() const { return !waiting_.empty(); }
+
+signals:
+        //! An event was retrieved, which the given events requested.
+        void fetched(QStringList requesting_events, mtx::events::collections::TimelineEvents event);
+
+        //! Emitted from the network thread, when a request finished.
+        void requestFinished(QString event_id,
+                             std::optional<mtx::events::collections::TimelineEvents> event);
+
+private:
+        void finishRequest(const QString &event_id,
+                           const std::optional<mtx::events::collections::TimelineEvents> &event);
+        void startRequests();
+
+        QString room_id_;
+        //! The requested events, which weren't retrieved yet, and the events waiting for them.
+        std::map<std::string, QStringList> waiting_;
+        //! The requested events, which wait for a free request.
+        std::deque<std::string> queue_;
+        std::size_t running_ = 0;
+};
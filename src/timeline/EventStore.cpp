@@ -0,0 +1,265 @@
+#include "EventStore.h"
+
+#include <QCoreApplication>
+#include <QtConcurrent>
+
+#include "EventAccessors.h"
+#include "Logging.h"
+#include "Utils.h"
+
+EventStore::EventStore(std::string room_id)
+  : room_id_(std::move(room_id))
+{
+        QObject::connect(&encoding_, &QFutureWatcherBase::finished, [this]() {
+                applyEncoded();
+                encodeLater();
+        });
+}
+
+EventStore::Event
+EventStore::value(const QString &id) const
+{
+        auto it = slotIds_.constFind(id);
+        if (it == slotIds_.constEnd())
+                return {};
+
+        return restore(it.value());
+}
+
+const EventStore::Event *
+EventStore::find(const QString &id) const
+{
+        auto it = slotIds_.constFind(id);
+        if (it == slotIds_.constEnd())
+                return nullptr;
+
+        return parse(it.value());
+}
+
+void
+EventStore::insert(const QString &id, const Event &event)
+{
+        Slot slot;
+        slot.id        = id;
+        slot.type      = static_cast<uint16_t>(event.index());
+        slot.timestamp = mtx::accessors::origin_server_ts(event).toMSecsSinceEpoch();
+        slot.day       = static_cast<uint32_t>(
+          QDateTime::fromMSecsSinceEpoch(slot.timestamp).date().toJulianDay());
+        slot.sender    = internSender(std::string(mtx::accessors::sender_view(event)));
+        slot.unencoded = std::make_shared<const Event>(event);
+
+        uint32_t index;
+        auto it = slotIds_.find(id);
+        if (it != slotIds_.end()) {
+                index = it.value();
+                bytes_ -= slots_[index].data.capacity();
+
+                if (!slots_[index].unencoded)
+                        unencodedEvents_++;
+
+                slot.position = slots_[index].position;
+                slots_[index] = std::move(slot);
+                parsed_.remove(index);
+        } else {
+                index = static_cast<uint32_t>(slots_.size());
+                slotIds_.insert(id, index);
+                slots_.push_back(std::move(slot));
+                unencodedEvents_++;
+        }
+
+        unencoded_.push_back(index);
+        encodeLater();
+}
+
+void
+EventStore::rename(const QString &old_id, const QString &new_id)
+{
+        auto it = slotIds_.find(old_id);
+        if (it == slotIds_.end())
+                return;
+
+        const auto slot = it.value();
+        slotIds_.erase(it);
+
+        slots_[slot].id = new_id;
+        slotIds_.insert(new_id, slot);
+}
+
+const std::string &
+EventStore::senderAt(std::size_t row) const
+{
+        return senders_[slots_[order_[row]].sender];
+}
+
+QDateTime
+EventStore::timestampAt(std::size_t row) const
+{
+        return QDateTime::fromMSecsSinceEpoch(slots_[order_[row]].timestamp);
+}
+
+int
+EventStore::rowOf(const QString &id) const
+{
+        auto it = slotIds_.constFind(id);
+        if (it == slotIds_.constEnd())
+                return -1;
+
+        const auto position = slots_[it.value()].position;
+        if (position == NO_POSITION)
+                return -1;
+
+        return static_cast<int>(position - front_);
+}
+
+void
+EventStore::prepend(const std::vector<QString> &ids)
+{
+        for (const auto &id : ids) {
+                const auto slot       = slotIds_.value(id);
+                slots_[slot].position = --front_;
+                order_.push_front(slot);
+        }
+}
+
+void
+EventStore::append(const std::vector<QString> &ids)
+{
+        for (const auto &id : ids) {
+                const auto slot       = slotIds_.value(id);
+                slots_[slot].position = front_ + (int64_t)order_.size();
+                order_.push_back(slot);
+        }
+}
+
+void
+EventStore::insertAt(std::size_t row, const std::vector<QString> &ids)
+{
+        std::vector<uint32_t> inserted;
+        inserted.reserve(ids.size());
+        for (const auto &id : ids)
+                inserted.push_back(slotIds_.value(id));
+
+        order_.insert(order_.begin() + row, inserted.begin(), inserted.end());
+        for (auto r = row; r < order_.size(); r++)
+                slots_[order_[r]].position = front_ + (int64_t)r;
+}
+
+std::size_t
+EventStore::memoryUsage() const
+{
+        std::size_t senders = 0;
+        for (const auto &sender : senders_)
+                senders += sender.capacity();
+
+        return bytes_ + slots_.capacity() * sizeof(Slot) + order_.size() * sizeof(uint32_t) +
+               slotIds_.size() * (sizeof(QString) + sizeof(uint32_t)) + senders +
+               (parsed_.size() + unencodedEvents_) * sizeof(Event);
+}
+
+uint32_t
+EventStore::internSender(const std::string &sender)
+{
+        auto it = senderIds_.find(sender);
+        if (it != senderIds_.end())
+                return it->second;
+
+        const auto index = static_cast<uint32_t>(senders_.size());
+        senders_.push_back(sender);
+        senderIds_.emplace(sender, index);
+
+        return index;
+}
+
+EventStore::Event
+EventStore::restore(uint32_t index) const
+{
+        return *parse(index);
+}
+
+const EventStore::Event *
+EventStore::parse(uint32_t index) const
+{
+        const auto &slot = slots_[index];
+        if (slot.unencoded)
+                return slot.unencoded.get();
+
+        if (auto event = parsed_.object(index))
+                return event;
+
+        mtx::events::collections::TimelineEvent event;
+        try {
+                auto json      = nlohmann::json::from_cbor(slot.data);
+                json["sender"] = senders_[slot.sender];
+                if (slot.has_room_id)
+                        json["room_id"] = room_id_;
+
+                mtx::events::collections::from_json(json, event);
+        } catch (const nlohmann::json::exception &e) {
+                nhlog::db()->warn("failed to parse stored event {}: {}",
+                                  slot.id.toStdString(),
+                                  e.what());
+
+                // Shown like an event, which failed to decrypt, instead of an empty row.
+                auto body = QCoreApplication::translate("EventStore", "-- Broken event (%1) --");
+
+                mtx::events::RoomEvent<mtx::events::msg::Notice> broken;
+                broken.event_id         = slot.id.toStdString();
+                broken.room_id          = room_id_;
+                broken.sender           = senders_[slot.sender];
+                broken.origin_server_ts = slot.timestamp;
+                broken.content.body     = body.arg(e.what()).toStdString();
+                event.data              = std::move(broken);
+        }
+
+        auto parsed = new Event(std::move(event.data));
+        parsed_.insert(index, parsed);
+        return parsed;
+}
+
+void
+EventStore::encodeLater()
+{
+        if (encoding_.isRunning() || unencoded_.empty())
+                return;
+
+        std::vector<Encoded> batch;
+        for (auto index : unencoded_)
+                if (slots_[index].unencoded)
+                        batch.push_back({index, slots_[index].unencoded, {}, false});
+        unencoded_.clear();
+
+        encoding_.setFuture(
+          QtConcurrent::run([room_id = room_id_, batch = std::move(batch)]() mutable {
+                  for (auto &encoded : batch) {
+                          auto json = utils::serialize_event(*encoded.event);
+                          json.erase("sender");
+                          if (json.value("room_id", "") == room_id) {
+                                  encoded.has_room_id = true;
+                                  json.erase("room_id");
+                          }
+                          encoded.data = nlohmann::json::to_cbor(json);
+                          encoded.data.shrink_to_fit();
+                  }
+                  return batch;
+          }));
+}
+
+void
+EventStore::applyEncoded()
+{
+        auto batch = encoding_.result();
+        for (auto &encoded : batch) {
+                auto &slot = slots_[encoded.index];
+                if (slot.unencoded != encoded.event)
+                        continue;
+
+                slot.data        = std::move(encoded.data);
+                slot.has_room_id = encoded.has_room_id;
+                bytes_ += slot.data.capacity();
+
+                // A new event is most likely about to be shown.
+                parsed_.insert(encoded.index, new Event(*slot.unencoded));
+                slot.unencoded.reset();
+                unencodedEvents_--;
+        }
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+#include <QCache>
+#include <QDateTime>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QString>
+
+#include <mtx/events/collections.hpp>
+
+//! The events of a room, as shown by its timeline.
+//!
+//! Every event is stored once in a dense vector of slots. The event ids map to the slots and the
+//! timeline order, newest first, is a list of slot indices. The room id and the senders are
+//! interned, so the events in the slots don't carry their own copies of these strings.
+//!
+//! A slot keeps its event encoded as CBOR, next to the few fields needed without the content: the
+//! id, the type, the sender and the timestamp. Only the events read with value() or at() are
+//! parsed, and the most recently parsed ones are cached. Inserted events are encoded in the thread
+//! pool and kept parsed until then, so the GUI thread doesn't serialize them.
+//!
+//! Every slot in the timeline remembers its position. Prepending decrements the position of the
+//! first row, so the row of an event is its position minus that offset and stays valid without
+//! renumbering the other rows.
+class EventStore
+{
+public:
+        using Event = mtx::events::collections::TimelineEvents;
+
+        explicit EventStore(std::string room_id);
+
+        bool contains(const QString &id) const { return slotIds_.contains(id); }
+        //! The event with the id, or a default constructed event, if it is unknown. An event,
+        //! which can't be parsed, is replaced by a notice, which says so.
+        Event value(const QString &id) const;
+        //! The event with the id without copying it, or nullptr, if it is unknown. The pointer is
+        //! only valid until the next event is parsed, which may evict it, or the event loop stores
+        //! an encoded event.
+        const Event *find(const QString &id) const;
+        //! Store an event, or replace the event with the same id. It isn't added to the timeline.
+        void insert(const QString &id, const Event &event);
+        //! Give the event of old_id the new id, e.g. when a sent message got its event id.
+        void rename(const QString &old_id, const QString &new_id);
+
+        //! The number of events in the timeline.
+        std::size_t size() const { return order_.size(); }
+        bool empty() const { return order_.empty(); }
+        //! The id of the event in a row of the timeline, where row 0 is the newest event.
+        const QString &idAt(std::size_t row) const { return slots_[order_[row]].id; }
+        Event at(std::size_t row) const { return restore(order_[row]); }
+        //! The event in a row without copying it. Valid like the pointer of find().
+        const Event *findAt(std::size_t row) const { return parse(order_[row]); }
+        //! Whether the event in a row is of type T, without copying the event.
+        template<class T>
+        bool holdsAt(std::size_t row) const
+        {
+                return slots_[order_[row]].type == indexOf<T>();
+        }
+        //! Whether the event with the id is stored and of type T, without copying the event.
+        template<class T>
+        bool holds(const QString &id) const
+        {
+                auto it = slotIds_.constFind(id);
+                return it != slotIds_.constEnd() && slots_[it.value()].type == indexOf<T>();
+        }
+        //! Sender and timestamp of a row, without copying the event.
+        const std::string &senderAt(std::size_t row) const;
+        QDateTime timestampAt(std::size_t row) const;
+        //! The section of a row: its local day in the high and its sender in the low 32 bits.
+        //! Neighbouring rows with the same key are shown as one section.
+        uint64_t sectionKeyAt(std::size_t row) const
+        {
+                const auto &slot = slots_[order_[row]];
+                return static_cast<uint64_t>(slot.day) << 32 | slot.sender;
+        }
+        //! Whether the row is the first of its day, i.e. the older row is of another day. False for
+        //! the oldest row, since the older events may not be loaded yet.
+        bool startsDayAt(std::size_t row) const
+        {
+                return row + 1 < order_.size() &&
+                       slots_[order_[row]].day != slots_[order_[row + 1]].day;
+        }
+        //! The row of an event, or -1, if it isn't part of the timeline. Constant time.
+        int rowOf(const QString &id) const;
+
+        //! Add stored events, oldest first, before the newest event of the timeline.
+        void prepend(const std::vector<QString> &ids);
+        //! Add stored events, newest first, after the oldest event of the timeline.
+        void append(const std::vector<QString> &ids);
+        //! Add stored events, newest first, before a row. Renumbers the following rows.
+        void insertAt(std::size_t row, const std::vector<QString> &ids);
+        //! Rough estimate of the memory used by the stored events, in bytes.
+        std::size_t memoryUsage() const;
+
+        //! Remove the events from the timeline, whose id doesn't satisfy keep. They stay stored.
+        template<class Predicate>
+        void retain(Predicate keep)
+        {
+                std::deque<uint32_t> kept;
+                for (auto slot : order_) {
+                        if (keep(slots_[slot].id)) {
+                                slots_[slot].position = front_ + (int64_t)kept.size();
+                                kept.push_back(slot);
+                        } else {
+                                slots_[slot].position = NO_POSITION;
+                        }
+                }
+                order_.swap(kept);
+        }
+
+private:
+        static constexpr int64_t NO_POSITION = INT64_MIN;
+        //! How many parsed events are kept, usually enough for the visible part of the timeline.
+        static constexpr int PARSED_EVENTS = 128;
+
+        //! The index of T in the Event variant.
+        template<class T, class... Ts>
+        static constexpr std::size_t indexOf(const std::variant<Ts...> *)
+        {
+                constexpr bool matches[] = {std::is_same_v<T, Ts>...};
+                for (std::size_t i = 0; i < sizeof...(Ts); i++)
+                        if (matches[i])
+                                return i;
+                return sizeof...(Ts);
+        }
+        template<class T>
+        static constexpr std::size_t indexOf()
+        {
+                return indexOf<T>(static_cast<const Event *>(nullptr));
+        }
+
+        struct Slot
+        {
+                //! The event without sender and room id, encoded as CBOR.
+                std::vector<uint8_t> data;
+                //! The inserted event, until it was encoded.
+                std::shared_ptr<const Event> unencoded;
+                QString id;
+                //! front_ + row, if the event is part of the timeline.
+                int64_t position = NO_POSITION;
+                //! origin_server_ts in milliseconds.
+                int64_t timestamp = 0;
+                uint32_t sender   = 0;
+                //! The julian day of the timestamp in local time, computed once for the sections.
+                uint32_t day = 0;
+                //! The index of the alternative in the Event variant.
+                uint16_t type    = 0;
+                bool has_room_id = false;
+        };
+
+        //! The encoding of the event of a slot, made in the thread pool.
+        struct Encoded
+        {
+                uint32_t index;
+                //! The encoded event, which the slot may have replaced meanwhile.
+                std::shared_ptr<const Event> event;
+                std::vector<uint8_t> data;
+                bool has_room_id;
+        };
+
+        uint32_t internSender(const std::string &sender);
+        Event restore(uint32_t index) const;
+        //! The parsed event of a slot, or a notice, if it can't be parsed.
+        const Event *parse(uint32_t index) const;
+        //! Encode the inserted events in the thread pool, unless an encoding is running already.
+        void encodeLater();
+        //! Store the encoded events in their slots, unless they were replaced meanwhile.
+        void applyEncoded();
+
+        std::string room_id_;
+        std::vector<Slot> slots_;
+        QHash<QString, uint32_t> slotIds_;
+        std::deque<uint32_t> order_;
+        //! The position of the first row.
+        int64_t front_ = 0;
+
+        //! The sum of the sizes of the encoded events.
+        std::size_t bytes_ = 0;
+        //! Recently parsed events by slot, with sender and room id restored.
+        mutable QCache<uint32_t, Event> parsed_{PARSED_EVENTS};
+
+        std::vector<std::string> senders_;
+        std::unordered_map<std::string, uint32_t> senderIds_;
+
+        //! The slots, whose events were inserted, but not handed to the encoding yet.
+        std::vector<uint32_t> unencoded_;
+        //! The number of slots, whose events aren't encoded yet.
+        std::size_t unencodedEvents_ = 0;
+        QFutureWatcher<std::vector<Encoded>> encoding_;
+};
@@ -0,0 +1,89 @@
+#include "ReadMarker.h"
+
+#include <algorithm>
+
+#include "Logging.h"
+#include "MatrixClient.h"
+#include "NetworkUsage.h"
+
+//! How long the changes of the marker are collected, before it is sent.
+constexpr int READ_MARKER_DELAY_MS = 1'000;
+//! The first retry of a failed request. It doubles with every failure up to the maximum.
+constexpr int READ_MARKER_RETRY_MS     = 2'000;
+constexpr int MAX_READ_MARKER_RETRY_MS = 60'000;
+
+ReadMarker::ReadMarker(QString room_id, IsNewer isNewer, QObject *parent)
+  : QObject(parent)
+  , room_id_(std::move(room_id))
+  , isNewer_(std::move(isNewer))
+{
+        timer_.setSingleShot(true);
+
+        connect(&timer_, &QTimer::timeout, this, &ReadMarker::send);
+        connect(this, &ReadMarker::sendFinished, this, &ReadMarker::finishSend);
+}
+
+void
+ReadMarker::advance(const QString &event_id)
+{
+        if (event_id.isEmpty())
+                return;
+
+        const auto &current =
+          !pending_.isEmpty() ? pending_ : (!sending_.isEmpty() ? sending_ : sent_);
+        if (!current.isEmpty() && (current == event_id || !isNewer_(event_id, current)))
+                return;
+
+        pending_ = event_id;
+
+        // The timer isn't restarted, so a steady scroll still sends the marker regularly.
+        if (!timer_.isActive() && sending_.isEmpty())
+                timer_.start(READ_MARKER_DELAY_MS);
+}
+
+void
+ReadMarker::send()
+{
+        if (pending_.isEmpty() || !sending_.isEmpty())
+                return;
+
+        sending_ = pending_;
+        pending_.clear();
+
+        const auto room_id  = room_id_.toStdString();
+        const auto event_id = sending_;
+        http::countRequest(http::Traffic::Receipts);
+        http::client()->read_event(
+          room_id, event_id.toStdString(), [this, room_id, event_id](mtx::http::RequestErr err) {
+                  if (err) {
+                          nhlog::net()->warn("failed to read_event ({}, {})",
+                                             room_id,
+                                             event_id.toStdString());
+                  }
+
+                  emit sendFinished(event_id, static_cast<bool>(err));
+          });
+}
+
+void
+ReadMarker::finishSend(const QString &event_id, bool failed)
+{
+        sending_.clear();
+
+        if (failed) {
+                // A newer marker replaces the failed one.
+                if (pending_.isEmpty())
+                        pending_ = event_id;
+
+                failures_++;
+                timer_.start(std::min(READ_MARKER_RETRY_MS << std::min(failures_ - 1, 5),
+                                      MAX_READ_MARKER_RETRY_MS));
+                return;
+        }
+
+        failures_ = 0;
+        sent_     = event_id;
+
+        if (!pending_.isEmpty())
+                timer_.start(READ_MARKER_DELAY_MS);
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <functional>
+
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+//! Sends the read marker of a room. Every change of the newest visible event moves it, so the
+//! changes are collected for a short time and only the newest event is sent, as m.fully_read and
+//! m.read in one request.
+//!
+//! The marker only moves forward. A failed request is retried, unless a newer marker is waiting,
+//! so it survives lost connections. It belongs to the timeline, so it keeps going, while another
+//! room is shown.
+class ReadMarker : public QObject
+{
+        Q_OBJECT
+
+public:
+        //! Whether event is newer than the event than in the timeline of the room.
+        using IsNewer = std::function<bool(const QString &event, const QString &than)>;
+
+        ReadMarker(QString room_id, IsNewer isNewer, QObject *parent = nullptr);
+
+        //! Move the marker to event_id, if it is newer than the current one.
+        void advance(const QString &event_id);
+        //! Whether a marker waits to be sent or its request is in flight. The request uses the
+        //! marker, so it has to stay until then.
+        bool busy() const { return !pending_.isEmpty() || !sending_.isEmpty(); }
+
+signals:
+        //! Emitted from the network thread, when a request finished.
+        void sendFinished(QString event_id, bool failed);
+
+private:
+        void send();
+        void finishSend(const QString &event_id, bool failed);
+
+        QString room_id_;
+        IsNewer isNewer_;
+        QTimer timer_;
+
+        //! The marker, which waits to be sent, or empty.
+        QString pending_;
+        //! The marker of the running request or empty.
+        QString sending_;
+        //! The last marker the server accepted.
+        QString sent_;
+        int failures_ = 0;
+};
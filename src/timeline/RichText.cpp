@@ -0,0 +1,351 @@
+#include "RichText.h"
+
+#include <algorithm>
+
+#include <QAbstractTextDocumentLayout>
+#include <QCache>
+#include <QClipboard>
+#include <QGuiApplication>
+#include <QKeyEvent>
+#include <QMouseEvent>
+#include <QPainter>
+#include <QPalette>
+#include <QStyleHints>
+#include <QTextCursor>
+#include <QTextDocument>
+
+#include "CacheStats.h"
+
+//! How many laid out documents are kept for the delegates, which are created again.
+constexpr int DOCUMENT_CACHE_SIZE = 256;
+//! Documents are laid out for widths rounded down to a multiple of it, so a slightly resized
+//! timeline still finds them.
+constexpr int WIDTH_BUCKET = 8;
+
+namespace {
+struct Document
+{
+        //! The text of the document, since the key only has the event.
+        QString text;
+        std::shared_ptr<QTextDocument> document;
+};
+
+//! Only used from the gui thread. The render thread paints, while it is blocked.
+QCache<QString, Document> documents_(DOCUMENT_CACHE_SIZE);
+
+//! The plain text of html, which is only escaped text with line breaks, as the timeline makes it
+//! of messages without a formatted body. Empty, if it has markup.
+QString
+plainText(const QString &html)
+{
+        if (html.contains('\n'))
+                return {};
+
+        QString plain = html;
+        plain.replace("<br>", "\n");
+        if (plain.contains('<') || plain.contains('>'))
+                return {};
+
+        // Only the entities of QString::toHtmlEscaped.
+        for (int i = plain.indexOf('&'); i != -1; i = plain.indexOf('&', i + 1)) {
+                const auto rest = plain.midRef(i);
+                if (rest.startsWith("&lt;"))
+                        plain.replace(i, 4, '<');
+                else if (rest.startsWith("&gt;"))
+                        plain.replace(i, 4, '>');
+                else if (rest.startsWith("&quot;"))
+                        plain.replace(i, 6, '"');
+                else if (rest.startsWith("&amp;"))
+                        plain.replace(i, 5, '&');
+                else
+                        return {};
+        }
+
+        return plain;
+}
+
+std::shared_ptr<QTextDocument>
+layout(const QString &text, const QFont &font, const QColor &linkColor, int width)
+{
+        cache::LatencyTimer timer(NHEKO_METRIC("layoutRichText"));
+
+        auto document = std::make_shared<QTextDocument>();
+        document->setDocumentMargin(0);
+        document->setDefaultFont(font);
+
+        const auto plain = plainText(text);
+        if (!plain.isEmpty()) {
+                document->setPlainText(plain);
+        } else {
+                document->setDefaultStyleSheet(
+                  QStringLiteral("a { color: %1; }").arg(linkColor.name()));
+                document->setHtml(text);
+        }
+
+        document->setTextWidth(width);
+        // Lays out the whole document now, instead of when it is painted.
+        document->size();
+        return document;
+}
+}
+
+RichText::RichText(QQuickItem *parent)
+  : QQuickPaintedItem(parent)
+  , font_(QGuiApplication::font())
+  , color_(QGuiApplication::palette().color(QPalette::Text))
+  , linkColor_(QGuiApplication::palette().color(QPalette::Link))
+  , selectionColor_(QGuiApplication::palette().color(QPalette::Highlight))
+{
+        setAcceptedMouseButtons(Qt::LeftButton);
+        setAcceptHoverEvents(true);
+}
+
+void
+RichText::setText(const QString &text)
+{
+        if (text == text_)
+                return;
+
+        text_ = text;
+        updateDocument();
+        emit textChanged();
+}
+
+void
+RichText::setEventId(const QString &eventId)
+{
+        if (eventId == eventId_)
+                return;
+
+        eventId_ = eventId;
+        updateDocument();
+        emit eventIdChanged();
+}
+
+void
+RichText::setFont(const QFont &font)
+{
+        if (font == font_)
+                return;
+
+        font_ = font;
+        updateDocument();
+        emit fontChanged();
+}
+
+void
+RichText::setColor(const QColor &color)
+{
+        if (color == color_)
+                return;
+
+        // Painted with, so the documents don't depend on it.
+        color_ = color;
+        update();
+        emit colorChanged();
+}
+
+void
+RichText::setLinkColor(const QColor &color)
+{
+        if (color == linkColor_)
+                return;
+
+        linkColor_ = color;
+        updateDocument();
+        emit linkColorChanged();
+}
+
+void
+RichText::setSelectionColor(const QColor &color)
+{
+        if (color == selectionColor_)
+                return;
+
+        selectionColor_ = color;
+        update();
+        emit selectionColorChanged();
+}
+
+void
+RichText::componentComplete()
+{
+        QQuickPaintedItem::componentComplete();
+        updateDocument();
+}
+
+void
+RichText::geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry)
+{
+        QQuickPaintedItem::geometryChanged(newGeometry, oldGeometry);
+
+        if (newGeometry.width() != oldGeometry.width())
+                updateDocument();
+}
+
+void
+RichText::updateDocument()
+{
+        // QML sets the properties one by one.
+        if (!isComponentComplete())
+                return;
+
+        const int layoutWidth =
+          width() > 0 ? static_cast<int>(width()) / WIDTH_BUCKET * WIDTH_BUCKET : -1;
+        const auto key = QStringLiteral("%1\n%2\n%3\n%4")
+                           .arg(eventId_.isEmpty() ? text_ : eventId_,
+                                font_.key(),
+                                linkColor_.name(),
+                                QString::number(layoutWidth));
+
+        auto document = documents_.object(key);
+        if (!document || document->text != text_) {
+                document = new Document{text_, layout(text_, font_, linkColor_, layoutWidth)};
+                documents_.insert(key, document);
+        }
+
+        if (document_ == document->document)
+                return;
+
+        document_ = document->document;
+        clearSelection();
+        setHoveredLink({});
+        setImplicitWidth(document_->idealWidth());
+        setImplicitHeight(document_->size().height());
+        update();
+}
+
+void
+RichText::paint(QPainter *painter)
+{
+        if (!document_)
+                return;
+
+        QAbstractTextDocumentLayout::PaintContext context;
+        context.palette.setColor(QPalette::Text, color_);
+
+        if (selectionStart_ != selectionEnd_) {
+                QAbstractTextDocumentLayout::Selection selection;
+                selection.cursor = QTextCursor(document_.get());
+                selection.cursor.setPosition(selectionStart_);
+                selection.cursor.setPosition(selectionEnd_, QTextCursor::KeepAnchor);
+                selection.format.setBackground(selectionColor_);
+                context.selections.push_back(selection);
+        }
+
+        document_->documentLayout()->draw(painter, context);
+}
+
+int
+RichText::positionAt(const QPointF &pos) const
+{
+        if (!document_)
+                return 0;
+
+        return std::max(document_->documentLayout()->hitTest(pos, Qt::FuzzyHit), 0);
+}
+
+void
+RichText::setHoveredLink(const QString &link)
+{
+        if (link == hoveredLink_)
+                return;
+
+        hoveredLink_ = link;
+        emit hoveredLinkChanged();
+}
+
+void
+RichText::clearSelection()
+{
+        if (selectionStart_ == selectionEnd_)
+                return;
+
+        selectionStart_ = selectionEnd_ = 0;
+        update();
+}
+
+void
+RichText::mousePressEvent(QMouseEvent *event)
+{
+        pressPos_  = event->localPos();
+        selecting_ = false;
+        clearSelection();
+        selectionStart_ = selectionEnd_ = positionAt(pressPos_);
+
+        // For the copy shortcut.
+        forceActiveFocus(Qt::MouseFocusReason);
+        event->accept();
+}
+
+void
+RichText::mouseMoveEvent(QMouseEvent *event)
+{
+        if (!selecting_ && (event->localPos() - pressPos_).manhattanLength() >=
+                             QGuiApplication::styleHints()->startDragDistance()) {
+                // Keeps the timeline from scrolling instead.
+                selecting_ = true;
+                setKeepMouseGrab(true);
+        }
+
+        if (selecting_) {
+                selectionEnd_ = positionAt(event->localPos());
+                update();
+        }
+}
+
+void
+RichText::mouseReleaseEvent(QMouseEvent *event)
+{
+        setKeepMouseGrab(false);
+
+        if (!selecting_ && document_) {
+                const auto link = document_->documentLayout()->anchorAt(event->localPos());
+                if (!link.isEmpty())
+                        emit linkActivated(link);
+        }
+
+        selecting_ = false;
+}
+
+void
+RichText::hoverMoveEvent(QHoverEvent *event)
+{
+        if (document_)
+                setHoveredLink(document_->documentLayout()->anchorAt(event->posF()));
+}
+
+void
+RichText::hoverLeaveEvent(QHoverEvent *)
+{
+        setHoveredLink({});
+}
+
+void
+RichText::keyPressEvent(QKeyEvent *event)
+{
+        if (!document_) {
+                event->ignore();
+                return;
+        }
+
+        if (event == QKeySequence::SelectAll) {
+                selectionStart_ = 0;
+                selectionEnd_   = document_->characterCount() - 1;
+                update();
+        } else if (event == QKeySequence::Copy && selectionStart_ != selectionEnd_) {
+                QTextCursor cursor(document_.get());
+                cursor.setPosition(selectionStart_);
+                cursor.setPosition(selectionEnd_, QTextCursor::KeepAnchor);
+                QGuiApplication::clipboard()->setText(cursor.selection().toPlainText());
+        } else {
+                event->ignore();
+        }
+}
+
+void
+RichText::focusOutEvent(QFocusEvent *event)
+{
+        QQuickPaintedItem::focusOutEvent(event);
+        clearSelection();
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <memory>
+
+#include <QColor>
+#include <QFont>
+#include <QQuickPaintedItem>
+#include <QString>
+
+class QTextDocument;
+
+//! Shows the html of a message, like a read only TextEdit, whose text can be selected.
+//!
+//! A TextEdit parses and lays out its text again in every delegate, which makes scrolling through
+//! formatted history slow. The laid out documents are shared instead, by event, width, font and
+//! link color, so a delegate, which is created again, only paints. Text without markup is set as
+//! plain text, which skips the html parser.
+class RichText : public QQuickPaintedItem
+{
+        Q_OBJECT
+
+        Q_PROPERTY(QString text READ text WRITE setText NOTIFY textChanged)
+        //! The event of the text. Documents are shared between the delegates of an event.
+        Q_PROPERTY(QString eventId READ eventId WRITE setEventId NOTIFY eventIdChanged)
+        Q_PROPERTY(QFont font READ font WRITE setFont NOTIFY fontChanged)
+        Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+        Q_PROPERTY(QColor linkColor READ linkColor WRITE setLinkColor NOTIFY linkColorChanged)
+        Q_PROPERTY(QColor selectionColor READ selectionColor WRITE setSelectionColor NOTIFY
+                     selectionColorChanged)
+        Q_PROPERTY(QString hoveredLink READ hoveredLink NOTIFY hoveredLinkChanged)
+
+public:
+        RichText(QQuickItem *parent = nullptr);
+
+        QString text() const { return text_; }
+        void setText(const QString &text);
+        QString eventId() const { return eventId_; }
+        void setEventId(const QString &eventId);
+        QFont font() const { return font_; }
+        void setFont(const QFont &font);
+        QColor color() const { return color_; }
+        void setColor(const QColor &color);
+        QColor linkColor() const { return linkColor_; }
+        void setLinkColor(const QColor &color);
+        QColor selectionColor() const { return selectionColor_; }
+        void setSelectionColor(const QColor &color);
+        QString hoveredLink() const { return hoveredLink_; }
+
+        void paint(QPainter *painter) override;
+
+signals:
+        void textChanged();
+        void eventIdChanged();
+        void fontChanged();
+        void colorChanged();
+        void linkColorChanged();
+        void selectionColorChanged();
+        void hoveredLinkChanged();
+        void linkActivated(QString link);
+
+protected:
+        void componentComplete() override;
+        void geometryChanged(const QRectF &newGeometry, const QRectF &oldGeometry) override;
+        void mousePressEvent(QMouseEvent *event) override;
+        void mouseMoveEvent(QMouseEvent *event) override;
+        void mouseReleaseEvent(QMouseEvent *event) override;
+        void hoverMoveEvent(QHoverEvent *event) override;
+        void hoverLeaveEvent(QHoverEvent *event) override;
+        void keyPressEvent(QKeyEvent *event) override;
+        void focusOutEvent(QFocusEvent *event) override;
+
+private:
+        //! Take the shared document of the current properties and size to it.
+        void updateDocument();
+        int positionAt(const QPointF &pos) const;
+        void setHoveredLink(const QString &link);
+        void clearSelection();
+
+        QString text_;
+        QString eventId_;
+        QFont font_;
+        QColor color_;
+        QColor linkColor_;
+        QColor selectionColor_;
+        QString hoveredLink_;
+
+        std::shared_ptr<QTextDocument> document_;
+        //! The selected characters, empty if they are the same.
+        int selectionStart_ = 0;
+        int selectionEnd_   = 0;
+        QPointF pressPos_;
+        bool selecting_ = false;
+};
@@ -1,29 +1,81 @@
 #include "TimelineModel.h"
 
 #include <algorithm>
-#include <thread>
+#include <mutex>
+#include <optional>
+#include <set>
 #include <type_traits>
 
-#include <QCache>
+#include <QDateTime>
+#include <QElapsedTimer>
 #include <QFileDialog>
+#include <QFutureWatcher>
 #include <QMimeDatabase>
 #include <QRegularExpression>
+#include <QSet>
 #include <QSettings>
 #include <QStandardPaths>
+#include <QThread>
+#include <QThreadPool>
+#include <QUrl>
+#include <QtConcurrent>
 
 #include "ChatPage.h"
 #include "EventAccessors.h"
+#include "EventTraits.h"
+#include "ImageDimensions.h"
 #include "Logging.h"
 #include "MainWindow.h"
 #include "MatrixClient.h"
+#include "MediaDownload.h"
+#include "MessageRenderer.h"
 #include "MxcImageProvider.h"
+#include "NetworkUsage.h"
 #include "Olm.h"
+#include "RequestScheduler.h"
 #include "TimelineViewManager.h"
 #include "Utils.h"
 #include "dialogs/RawMessage.h"
 
 Q_DECLARE_METATYPE(QModelIndex)
 
+//! How many events are restored from the cache per fetchMore.
+constexpr std::size_t CACHED_EVENTS_PER_PAGE = 50;
+//! How many decrypted events a room keeps by default, see user/timeline/decrypted_events.
+constexpr int DECRYPTED_EVENTS_CACHE_SIZE = 1'000;
+//! How many rows before and after a requested encrypted row are decrypted in the background.
+constexpr int DECRYPT_AHEAD = 25;
+//! How long a decryption, which failed for a reason that may go away, is shown as failed, before
+//! it is tried again.
+constexpr int DECRYPT_RETRY_INTERVAL = 30 * 1000;
+//! How many of the newest rows are prepared, before a room is opened.
+constexpr int WARM_UP_ROWS = 20;
+//! How many rows keep their computed display values.
+constexpr int DISPLAY_ROWS_CACHE_SIZE = 500;
+//! How many formatted state events are kept.
+constexpr int FORMATTED_EVENTS_CACHE_SIZE = 2'000;
+//! How many texts of typing users are kept, since the same few users start and stop typing.
+constexpr int FORMATTED_TYPING_CACHE_SIZE = 16;
+//! How many rows before the oldest loaded event the next page is requested by default.
+constexpr int PREFETCH_DISTANCE = 50;
+//! How many messages of a room are sent at the same time by default. See user/timeline/send_window.
+//! The server orders the messages by their arrival, so only one is sent at a time, unless the
+//! setting allows more.
+constexpr int SEND_WINDOW = 1;
+//! The delay before a failed message is sent again. It doubles with every failure, up to the max.
+constexpr int SEND_RETRY_DELAY_MS     = 1'000;
+constexpr int MAX_SEND_RETRY_DELAY_MS = 60'000;
+//! How many users are asked for one-time keys at the same time, when sharing a megolm session.
+constexpr std::size_t MAX_RUNNING_KEY_CLAIMS = 8;
+//! The size of the room keys sent in one to_device request, well below the request size limits
+//! of the homeservers.
+constexpr std::size_t TO_DEVICE_BATCH_BYTES = 128 * 1024;
+
+//! A megolm session is replaced after that many messages or that long after it was created. These
+//! are the defaults of the spec, since mtxclient doesn't parse them from m.room.encryption.
+constexpr uint64_t MEGOLM_ROTATION_MESSAGES  = 100;
+constexpr uint64_t MEGOLM_ROTATION_PERIOD_MS = 7ULL * 24 * 60 * 60 * 1000;
+
 namespace std {
 inline uint
 qHash(const std::string &key, uint seed = 0)
@@ -32,7 +84,119 @@ qHash(const std::string &key, uint seed = 0)
 }
 }
 
+//! The state of sharing a new megolm session with the devices of a room.
+struct KeyDistribution
+{
+        std::mutex mutex;
+        //! The message, which is sent once the session was shared.
+        std::string txn_id;
+        //! The shared session.
+        std::string room_id;
+        std::string session_id;
+        //! The users, whose one-time keys weren't claimed yet, with their devices.
+        std::deque<std::pair<std::string, std::map<std::string, DevicePublicKeys>>> users;
+        //! The number of users the session is shared with.
+        std::size_t total      = 0;
+        //! The users, whose room keys weren't encrypted yet.
+        std::size_t remaining  = 0;
+        //! The users, whose room keys were sent or couldn't be encrypted.
+        std::size_t finished   = 0;
+        //! The encrypted room keys of the next to_device request, user_id -> device_id -> message.
+        nlohmann::json batch   = nlohmann::json::object();
+        std::size_t batchBytes = 0;
+        std::size_t batchUsers = 0;
+};
+
 namespace {
+//! The response of /context, which mtxclient doesn't have a call for.
+struct EventContext
+{
+        //! The event and the events around it, newest first.
+        std::vector<mtx::events::collections::TimelineEvents> events;
+        //! The token to request the events before them.
+        std::string start;
+};
+
+void
+from_json(const nlohmann::json &obj, EventContext &context)
+{
+        std::vector<mtx::events::collections::TimelineEvents> after;
+        if (obj.count("events_after") != 0)
+                mtx::responses::utils::parse_timeline_events(obj.at("events_after"), after);
+
+        // The newer events are in chronological order, the older ones in reverse.
+        context.events.assign(std::make_move_iterator(after.rbegin()),
+                              std::make_move_iterator(after.rend()));
+
+        mtx::events::collections::TimelineEvent event;
+        mtx::events::collections::from_json(obj.at("event"), event);
+        context.events.push_back(std::move(event.data));
+
+        if (obj.count("events_before") != 0)
+                mtx::responses::utils::parse_timeline_events(obj.at("events_before"),
+                                                             context.events);
+
+        context.start = obj.value("start", "");
+}
+
+//! The decryptions are timed by the size of the message, so the few large messages don't hide
+//! the cost of the usual small ones.
+const cache::Metric &
+megolmDecryptOperation(std::size_t bytes)
+{
+        if (bytes < 1024)
+                return NHEKO_METRIC("megolm decrypt <1k");
+        if (bytes < 16 * 1024)
+                return NHEKO_METRIC("megolm decrypt <16k");
+        return NHEKO_METRIC("megolm decrypt >=16k");
+}
+
+//! The threads decrypting the events of all rooms.
+struct CryptoPool : QThreadPool
+{
+        CryptoPool() { setMaxThreadCount(std::max(1, QThread::idealThreadCount() / 2)); }
+};
+
+QThreadPool *
+decryptionPool()
+{
+        static CryptoPool pool;
+        return &pool;
+}
+
+//! The threads encrypting the room keys of new megolm sessions, so sharing them doesn't delay
+//! the decryption of the timelines.
+QThreadPool *
+keySharingPool()
+{
+        static CryptoPool pool;
+        return &pool;
+}
+
+//! Why the outbound session of a room has to be replaced, or nullptr, if it may be used further.
+const char *
+megolmRotationReason(const OutboundGroupSessionData &data, const std::vector<std::string> &members)
+{
+        if (data.message_index >= MEGOLM_ROTATION_MESSAGES)
+                return "too many messages";
+
+        // Sessions of older versions don't know, with whom they were shared.
+        if (data.created_at == 0 && data.shared_with.empty())
+                return "unknown recipients";
+
+        const auto now = static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch());
+        if (data.created_at + MEGOLM_ROTATION_PERIOD_MS < now)
+                return "too old";
+
+        // Users, who left, must not read the following messages.
+        const std::set<std::string> joined(members.begin(), members.end());
+        for (const auto &[user_id, devices] : data.shared_with)
+                if (!joined.count(user_id))
+                        return "a member left";
+
+        return nullptr;
+}
+
 struct RoomEventType
 {
         template<class T>
@@ -122,11 +286,76 @@ struct RoomEventType
         // ::EventType::Type operator()(const Event<mtx::events::msg::Location> &e) { return
         // ::EventType::LocationMessage; }
 };
+
+//! The type of the alternatives, which don't need the type of the event to be classified.
+struct QmlEventType
+{
+        template<class T>
+        static constexpr std::optional<qml_mtx_events::EventType> value()
+        {
+                namespace ev = mtx::events;
+                using Type   = qml_mtx_events::EventType;
+
+                if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::Aliases>>)
+                        return Type::Aliases;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::Avatar>>)
+                        return Type::Avatar;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::CanonicalAlias>>)
+                        return Type::CanonicalAlias;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::Create>>)
+                        return Type::RoomCreate;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::Encryption>>)
+                        return Type::Encryption;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::GuestAccess>>)
+                        return Type::RoomGuestAccess;
+                else if constexpr (std::is_same_v<T,
+                                                  ev::StateEvent<ev::state::HistoryVisibility>>)
+                        return Type::RoomHistoryVisibility;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::JoinRules>>)
+                        return Type::RoomJoinRules;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::Member>>)
+                        return Type::Member;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::Name>>)
+                        return Type::Name;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::PowerLevels>>)
+                        return Type::PowerLevels;
+                else if constexpr (std::is_same_v<T, ev::StateEvent<ev::state::Topic>>)
+                        return Type::Topic;
+                else if constexpr (std::is_same_v<T, ev::EncryptedEvent<ev::msg::Encrypted>>)
+                        return Type::Encrypted;
+                else if constexpr (std::is_same_v<T, ev::RedactionEvent<ev::msg::Redaction>>)
+                        return Type::Redaction;
+                else if constexpr (std::is_same_v<T, ev::Sticker>)
+                        return Type::Sticker;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::Redacted>>)
+                        return Type::Redacted;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::Audio>>)
+                        return Type::AudioMessage;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::Emote>>)
+                        return Type::EmoteMessage;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::File>>)
+                        return Type::FileMessage;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::Image>>)
+                        return Type::ImageMessage;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::Notice>>)
+                        return Type::NoticeMessage;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::Text>>)
+                        return Type::TextMessage;
+                else if constexpr (std::is_same_v<T, ev::RoomEvent<ev::msg::Video>>)
+                        return Type::VideoMessage;
+                else
+                        return std::nullopt;
+        }
+};
 }
 
 qml_mtx_events::EventType
 toRoomEventType(const mtx::events::collections::TimelineEvents &event)
 {
+        if (auto type = event_traits::lookup<QmlEventType>(event))
+                return *type;
+
+        // The type of the other alternatives is only known from the event itself.
         return std::visit(RoomEventType{}, event);
 }
 
@@ -137,29 +366,155 @@ toRoomEventTypeString(const mtx::events::collections::TimelineEvents &event)
                           event);
 }
 
+//! The html of an event, before it is rendered for the timeline. Plain bodies are escaped and
+//! the fallbacks of replies removed.
+QString
+formattedBodySource(const mtx::events::collections::TimelineEvents &event)
+{
+        using namespace mtx::accessors;
+
+        const static QRegularExpression replyFallback(
+          "<mx-reply>.*</mx-reply>", QRegularExpression::DotMatchesEverythingOption);
+
+        bool isReply = !in_reply_to_event_view(event).empty();
+
+        auto formattedBody_ = toQString(formatted_body_view(event));
+        if (formattedBody_.isEmpty()) {
+                auto body_ = toQString(body_view(event));
+
+                if (isReply) {
+                        while (body_.startsWith("> "))
+                                body_ = body_.right(body_.size() - body_.indexOf('\n') - 1);
+                        if (body_.startsWith('\n'))
+                                body_ = body_.right(body_.size() - 1);
+                }
+                formattedBody_ = body_.toHtmlEscaped().replace('\n', "<br>");
+        } else {
+                if (isReply)
+                        formattedBody_ = formattedBody_.remove(replyFallback);
+        }
+
+        return formattedBody_;
+}
+
 TimelineModel::TimelineModel(TimelineViewManager *manager, QString room_id, QObject *parent)
   : QAbstractListModel(parent)
+  , events(room_id.toStdString())
   , room_id_(room_id)
+  , fetcher_(room_id)
+  , readMarker_(room_id,
+                [this](const QString &event, const QString &than) {
+                        // The older marker may have left the timeline, e.g. after a gap.
+                        const int row = idToIndex(event), thanRow = idToIndex(than);
+                        return thanRow < 0 || (row >= 0 && row < thanRow);
+                })
   , manager_(manager)
 {
+        decryptedEvents_.setMaxCost(
+          QSettings()
+            .value("user/timeline/decrypted_events", DECRYPTED_EVENTS_CACHE_SIZE)
+            .toInt());
+        displayRows_.setMaxCost(DISPLAY_ROWS_CACHE_SIZE);
+        formattedEvents_.setMaxCost(FORMATTED_EVENTS_CACHE_SIZE);
+        formattedTyping_.setMaxCost(FORMATTED_TYPING_CACHE_SIZE);
+        prefetchDistance_ =
+          QSettings().value("user/timeline/prefetch_distance", PREFETCH_DISTANCE).toInt();
+        collapseMemberEvents_ =
+          QSettings().value("user/timeline/collapse_member_events", true).toBool();
+        sendWindow_ =
+          std::max(1, QSettings().value("user/timeline/send_window", SEND_WINDOW).toInt());
+
         connect(
           this, &TimelineModel::oldMessagesRetrieved, this, &TimelineModel::addBackwardsEvents);
+        connect(&ImageDimensions::instance(),
+                &ImageDimensions::probed,
+                this,
+                &TimelineModel::receivedImageDimensions);
+        connect(&ImageDimensions::instance(),
+                &ImageDimensions::failed,
+                this,
+                [this](const QString &mxcUrl) { waitingForDimensions_.remove(mxcUrl); });
+        connect(this, &TimelineModel::contextRetrieved, this, [this](QString id, bool stored) {
+                contextRequests_--;
+                if (!stored)
+                        return;
+
+                if (const int row = idToIndex(id); row >= 0)
+                        emit scrollToIndex(row);
+                else if (!showCachedEvent(id))
+                        nhlog::ui()->warn("failed to show the context of {}", id.toStdString());
+        });
+        connect(this, &TimelineModel::newerGapFilled, this, [this](bool filled) {
+                fillingNewerGap_ = false;
+                if (filled)
+                        fetchNewer();
+        });
         connect(this, &TimelineModel::messageFailed, this, [this](QString txn_id) {
-                nhlog::ui()->error("Failed to send {}, retrying", txn_id.toStdString());
+                if (auto sending = sending_.take(txn_id); sending.isValid())
+                        cache::recordLatency(NHEKO_METRIC("sendMessageFailed"),
+                                             std::chrono::milliseconds(sending.elapsed()));
+
+                // Retried with the same transaction id, so the server drops duplicates.
+                const int failures = ++sendFailures_[txn_id];
+                const int delay    = std::min(SEND_RETRY_DELAY_MS << std::min(failures - 1, 6),
+                                           MAX_SEND_RETRY_DELAY_MS);
+                nhlog::ui()->error(
+                  "Failed to send {}, retrying in {} ms", txn_id.toStdString(), delay);
+
+                waitingForRetry_.insert(txn_id);
+                QTimer::singleShot(delay, this, [this, txn_id]() {
+                        waitingForRetry_.remove(txn_id);
+                        sendPendingMessages();
+                });
+        });
+        connect(this,
+                &TimelineModel::keySharingProgress,
+                this,
+                [this](QString txn_id, int finished, int total) {
+                        nhlog::crypto()->debug("shared the room key of {} with {} of {} users",
+                                               txn_id.toStdString(),
+                                               finished,
+                                               total);
+                        if (finished < total) {
+                                sharingKeys_.insert(txn_id);
+                                return;
+                        }
 
-                QTimer::singleShot(5000, this, [this]() { emit nextPendingMessage(); });
+                        sharingKeys_.remove(txn_id);
+                        sendPendingMessages();
+                });
+        connect(this, &TimelineModel::membersRetrieved, this, [this]() {
+                // Sent with the members from the syncs, if they couldn't be retrieved.
+                loadingMembers_ = false;
+                membersLoaded_  = true;
+
+                // The display names of the senders may have changed.
+                displayRows_.clear();
+                formattedEvents_.clear();
+                formattedTyping_.clear();
+                if (!events.empty())
+                        emit dataChanged(index(0, 0), index((int)events.size() - 1, 0));
+
+                sendPendingMessages();
         });
         connect(this, &TimelineModel::messageSent, this, [this](QString txn_id, QString event_id) {
+                if (auto sending = sending_.take(txn_id); sending.isValid())
+                        cache::recordLatency(NHEKO_METRIC("sendMessage"),
+                                             std::chrono::milliseconds(sending.elapsed()));
+                sendFailures_.remove(txn_id);
                 pending.removeOne(txn_id);
+                cache::removeOutboxMessage(room_id_.toStdString(), txn_id.toStdString());
+
+                // Keep the window full.
+                sendPendingMessages();
 
                 int idx = idToIndex(txn_id);
                 if (idx < 0) {
                         // transaction already received via sync
                         return;
                 }
-                eventOrder[idx] = event_id;
-                auto ev         = events.value(txn_id);
-                ev              = std::visit(
+                auto ev = events.value(txn_id);
+                ev      = std::visit(
                   [event_id](const auto &e) -> mtx::events::collections::TimelineEvents {
                           auto eventCopy     = e;
                           eventCopy.event_id = event_id.toStdString();
@@ -167,38 +522,49 @@ TimelineModel::TimelineModel(TimelineViewManager *manager, QString room_id, QObj
                   },
                   ev);
 
-                events.remove(txn_id);
+                events.rename(txn_id, event_id);
                 events.insert(event_id, ev);
+                invalidateRow(txn_id);
 
                 // mark our messages as read
-                readEvent(event_id.toStdString());
+                readMarker_.advance(event_id);
 
-                // ask to be notified for read receipts
-                cache::addPendingReceipt(room_id_, event_id);
+                // ask to be notified for read receipts. A large room doesn't keep the receipts
+                // of everybody, so its messages don't show, whether they were read.
+                if (!cache::isLargeRoom(room_id_.toStdString()))
+                        cache::addPendingReceipt(room_id_, event_id);
 
                 emit dataChanged(index(idx, 0), index(idx, 0));
-
-                if (pending.size() > 0)
-                        emit nextPendingMessage();
         });
         connect(this, &TimelineModel::redactionFailed, this, [](const QString &msg) {
                 emit ChatPage::instance()->showNotification(msg);
         });
 
-        connect(
-          this, &TimelineModel::nextPendingMessage, this, &TimelineModel::processOnePendingMessage);
         connect(this, &TimelineModel::newMessageToSend, this, &TimelineModel::addPendingMessage);
 
-        connect(this,
-                &TimelineModel::eventFetched,
+        connect(&fetcher_,
+                &EventFetcher::fetched,
                 this,
-                [this](QString requestingEvent, mtx::events::collections::TimelineEvents event) {
-                        events.insert(QString::fromStdString(mtx::accessors::event_id(event)),
-                                      event);
-                        auto idx = idToIndex(requestingEvent);
-                        if (idx >= 0)
-                                emit dataChanged(index(idx, 0), index(idx, 0));
+                [this](QStringList requestingEvents,
+                       mtx::events::collections::TimelineEvents event) {
+                        const auto id = QString::fromStdString(mtx::accessors::event_id(event));
+                        events.insert(id, event);
+                        invalidateRow(id);
+
+                        std::vector<int> rows;
+                        for (const auto &requestingEvent : requestingEvents) {
+                                invalidateRow(requestingEvent);
+
+                                auto idx = idToIndex(requestingEvent);
+                                if (idx >= 0)
+                                        rows.push_back(idx);
+                        }
+                        emitRowsChanged(std::move(rows));
                 });
+
+        restoreOutbox();
+
+        updateReceipts(cache::latestReadReceipts(room_id_.toStdString()));
 }
 
 QHash<int, QByteArray>
@@ -229,6 +595,8 @@ TimelineModel::roleNames() const
           {RoomId, "roomId"},
           {RoomName, "roomName"},
           {RoomTopic, "roomTopic"},
+          {CollapsedCount, "collapsedCount"},
+          {SectionHeader, "sectionHeader"},
           {Dump, "dump"},
         };
 }
@@ -236,7 +604,7 @@ int
 TimelineModel::rowCount(const QModelIndex &parent) const
 {
         Q_UNUSED(parent);
-        return (int)this->eventOrder.size();
+        return (int)this->events.size();
 }
 
 QVariantMap
@@ -247,105 +615,165 @@ TimelineModel::getDump(QString eventId) const
         return {};
 }
 
+const DisplayRow &
+TimelineModel::displayRow(const QString &id) const
+{
+        if (auto cached = displayRows_.object(id))
+                return *cached;
+
+        using namespace mtx::accessors;
+        using Encrypted = mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>;
+
+        // The event and its plaintext are borrowed from the caches, only the values of the row
+        // are copied.
+        static const mtx::events::collections::TimelineEvents unknown;
+        const auto *stored = events.find(id);
+        const auto &source = stored ? *stored : unknown;
+
+        auto row = new DisplayRow;
+
+        std::optional<DecryptionResult> placeholder;
+        const mtx::events::collections::TimelineEvents *plaintext = &source;
+        if (auto e = std::get_if<Encrypted>(&source)) {
+                row->isEncrypted = true;
+                if (auto decrypted = decryptedEvents_.object(e->event_id)) {
+                        plaintext = &decrypted->event;
+                } else {
+                        // Parses the events around it, which may evict the stored event.
+                        placeholder = decryptEventLater(*e);
+                        plaintext   = &placeholder->event;
+                }
+        }
+        const auto &event = *plaintext;
+
+        row->userId     = toQString(sender_view(event));
+        row->userName   = displayName(row->userId);
+        row->isOwn      = row->userId == utils::localUser();
+        row->timestamp  = origin_server_ts(event);
+        row->type       = toRoomEventType(event);
+        row->typeString = toRoomEventTypeString(event);
+        row->body       = utils::replaceEmoji(toQString(body_view(event)));
+
+        row->formattedBody = MessageRenderer::instance().formattedBody(formattedBodySource(event));
+
+        row->url          = toQString(url_view(event));
+        row->thumbnailUrl = toQString(thumbnail_url_view(event));
+        row->blurhash     = toQString(blurhash_view(event));
+        row->filename     = toQString(filename_view(event));
+        row->filesize     = utils::humanReadableFileSize(filesize(event));
+        row->mimetype     = toQString(mimetype_view(event));
+        row->height       = media_height(event);
+        row->width        = media_width(event);
+
+        // Otherwise the row would change its height, once the image is loaded.
+        if ((row->width == 0 || row->height == 0) &&
+            (row->type == qml_mtx_events::ImageMessage || row->type == qml_mtx_events::Sticker)) {
+                const auto size = ImageDimensions::instance().dimensions(row->url, file(event));
+                if (size.isValid()) {
+                        row->width  = size.width();
+                        row->height = size.height();
+                } else if (ImageDimensions::instance().probing(row->url)) {
+                        waitingForDimensions_[row->url].insert(id);
+                }
+        }
+
+        auto w = row->width;
+        if (w == 0)
+                w = 1;
+
+        double prop             = row->height / (double)w;
+        row->proportionalHeight = prop > 0 ? prop : 1.;
+
+        row->replyTo   = toQString(in_reply_to_event_view(event));
+        row->roomId    = toQString(room_id_view(event));
+        row->roomName  = toQString(room_name_view(event));
+        row->roomTopic = toQString(room_topic_view(event));
+
+        displayRows_.insert(id, row, 1);
+        return *row;
+}
+
 QVariant
 TimelineModel::data(const QString &id, int role) const
 {
-        using namespace mtx::accessors;
-        namespace acc                                  = mtx::accessors;
-        mtx::events::collections::TimelineEvents event = events.value(id);
+        if (role == Id)
+                return id;
 
-        if (auto e =
-              std::get_if<mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>>(&event)) {
-                event = decryptEvent(*e).event;
-        }
+        const auto &row = displayRow(id);
 
         switch (role) {
         case UserId:
-                return QVariant(QString::fromStdString(acc::sender(event)));
+                return QVariant(row.userId);
         case UserName:
-                return QVariant(displayName(QString::fromStdString(acc::sender(event))));
+                return QVariant(row.userName);
 
         case Timestamp:
-                return QVariant(origin_server_ts(event));
+                return QVariant(row.timestamp);
         case Type:
-                return QVariant(toRoomEventType(event));
+                return QVariant(row.type);
         case TypeString:
-                return QVariant(toRoomEventTypeString(event));
+                return QVariant(row.typeString);
         case Body:
-                return QVariant(utils::replaceEmoji(QString::fromStdString(body(event))));
-        case FormattedBody: {
-                const static QRegularExpression replyFallback(
-                  "<mx-reply>.*</mx-reply>", QRegularExpression::DotMatchesEverythingOption);
-
-                bool isReply = !in_reply_to_event(event).empty();
-
-                auto formattedBody_ = QString::fromStdString(formatted_body(event));
-                if (formattedBody_.isEmpty()) {
-                        auto body_ = QString::fromStdString(body(event));
-
-                        if (isReply) {
-                                while (body_.startsWith("> "))
-                                        body_ = body_.right(body_.size() - body_.indexOf('\n') - 1);
-                                if (body_.startsWith('\n'))
-                                        body_ = body_.right(body_.size() - 1);
-                        }
-                        formattedBody_ = body_.toHtmlEscaped().replace('\n', "<br>");
-                } else {
-                        if (isReply)
-                                formattedBody_ = formattedBody_.remove(replyFallback);
-                }
-                return QVariant(utils::replaceEmoji(
-                  utils::linkifyMessage(utils::escapeBlacklistedHtml(formattedBody_))));
-        }
+                return QVariant(row.body);
+        case FormattedBody:
+                return QVariant(row.formattedBody);
         case Url:
-                return QVariant(QString::fromStdString(url(event)));
+                return QVariant(row.url);
         case ThumbnailUrl:
-                return QVariant(QString::fromStdString(thumbnail_url(event)));
+                return QVariant(row.thumbnailUrl);
         case Blurhash:
-                return QVariant(QString::fromStdString(blurhash(event)));
+                return QVariant(row.blurhash);
         case Filename:
-                return QVariant(QString::fromStdString(filename(event)));
+                return QVariant(row.filename);
         case Filesize:
-                return QVariant(utils::humanReadableFileSize(filesize(event)));
+                return QVariant(row.filesize);
         case MimeType:
-                return QVariant(QString::fromStdString(mimetype(event)));
+                return QVariant(row.mimetype);
         case Height:
-                return QVariant(qulonglong{media_height(event)});
+                return QVariant(row.height);
         case Width:
-                return QVariant(qulonglong{media_width(event)});
-        case ProportionalHeight: {
-                auto w = media_width(event);
-                if (w == 0)
-                        w = 1;
-
-                double prop = media_height(event) / (double)w;
-
-                return QVariant(prop > 0 ? prop : 1.);
-        }
-        case Id:
-                return id;
+                return QVariant(row.width);
+        case ProportionalHeight:
+                return QVariant(row.proportionalHeight);
         case State:
                 // only show read receipts for messages not from us
-                if (acc::sender(event) != http::client()->user_id().to_string())
+                if (!row.isOwn)
                         return qml_mtx_events::Empty;
                 else if (pending.contains(id))
                         return qml_mtx_events::Sent;
-                else if (read.contains(id) || cache::readReceipts(id, room_id_).size() > 1)
+                else if (read.contains(id) || isReadByOthers(id))
                         return qml_mtx_events::Read;
                 else
                         return qml_mtx_events::Received;
-        case IsEncrypted: {
-                return std::holds_alternative<
-                  mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>>(events[id]);
-        }
+        case IsEncrypted:
+                return row.isEncrypted;
         case ReplyTo:
-                return QVariant(QString::fromStdString(in_reply_to_event(event)));
+                return QVariant(row.replyTo);
         case RoomId:
-                return QVariant(QString::fromStdString(room_id(event)));
+                return QVariant(row.roomId);
         case RoomName:
-                return QVariant(QString::fromStdString(room_name(event)));
+                return QVariant(row.roomName);
         case RoomTopic:
-                return QVariant(QString::fromStdString(room_topic(event)));
+                return QVariant(row.roomTopic);
+        case CollapsedCount: {
+                auto run = memberRuns_.constFind(id);
+                return run == memberRuns_.constEnd() ? 1 : (int)run->size();
+        }
+        case SectionHeader: {
+                // Only what the header shows, so it doesn't build the whole Dump.
+                QVariantMap m;
+                m.insert("timestamp", row.timestamp);
+                m.insert("userId", row.userId);
+                m.insert("userName", row.userName);
+                m.insert("avatarUrl", avatarUrl(row.userId));
+
+                // The oldest row only starts a day, if it is the start of the room.
+                const int r = events.rowOf(id);
+                m.insert("newDay",
+                         r >= 0 && (events.startsDayAt(r) ||
+                                    (r + 1 == (int)events.size() && !canFetchMore(QModelIndex()))));
+                return QVariant(m);
+        }
         case Dump: {
                 QVariantMap m;
                 auto names = roleNames();
@@ -384,54 +812,105 @@ TimelineModel::data(const QString &id, int role) const
 QVariant
 TimelineModel::data(const QModelIndex &index, int role) const
 {
-        using namespace mtx::accessors;
-        namespace acc = mtx::accessors;
-        if (index.row() < 0 && index.row() >= (int)eventOrder.size())
+        if (index.row() < 0 || index.row() >= (int)events.size())
                 return QVariant();
 
-        QString id = eventOrder[index.row()];
-
-        mtx::events::collections::TimelineEvents event = events.value(id);
-
-        if (role == Section) {
-                QDateTime date = origin_server_ts(event);
-                date.setTime(QTime());
-
-                std::string userId = acc::sender(event);
+        // The ListView compares the sections of neighbouring rows, so they are just the key.
+        if (role == Section)
+                return QString::number(events.sectionKeyAt(index.row()));
 
-                for (size_t r = index.row() + 1; r < eventOrder.size(); r++) {
-                        auto tempEv        = events.value(eventOrder[r]);
-                        QDateTime prevDate = origin_server_ts(tempEv);
-                        prevDate.setTime(QTime());
-                        if (prevDate != date)
-                                return QString("%2 %1")
-                                  .arg(date.toMSecsSinceEpoch())
-                                  .arg(QString::fromStdString(userId));
-
-                        std::string prevUserId = acc::sender(tempEv);
-                        if (userId != prevUserId)
-                                break;
-                }
-
-                return QString("%1").arg(QString::fromStdString(userId));
-        }
-
-        return data(id, role);
+        return data(events.idAt(index.row()), role);
 }
 
 bool
 TimelineModel::canFetchMore(const QModelIndex &) const
 {
-        if (eventOrder.empty())
+        if (events.empty())
                 return true;
         if (!std::holds_alternative<mtx::events::StateEvent<mtx::events::state::Create>>(
-              events[eventOrder.back()]))
+              events.at(events.size() - 1)))
                 return true;
         else
 
                 return false;
 }
 
+bool
+TimelineModel::restoreFromCache()
+{
+        if (cachedHistoryExhausted_)
+                return false;
+
+        return appendCachedWindow(cache::getTimelineMessages(
+          room_id_.toStdString(),
+          events.empty() ? "" : events.idAt(events.size() - 1).toStdString(),
+          CACHED_EVENTS_PER_PAGE));
+}
+
+bool
+TimelineModel::appendCachedWindow(const TimelineWindow &window)
+{
+        if (window.reached_end) {
+                cachedHistoryExhausted_ = true;
+
+                if (!window.prev_batch.empty())
+                        prev_batch_token_ = QString::fromStdString(window.prev_batch);
+        }
+
+        if (window.events.empty())
+                return false;
+
+        nhlog::ui()->debug("Restored {} events of room {} from the cache",
+                           window.events.size(),
+                           room_id_.toStdString());
+        appendEvents(window.events);
+        return true;
+}
+
+void
+TimelineModel::warmUp()
+{
+        if (!events.empty() || cachedHistoryExhausted_) {
+                warmUpNewestRows();
+                return;
+        }
+
+        if (warmingUp_)
+                return;
+        warmingUp_ = true;
+
+        // Hovering a room mustn't block the GUI thread, so the events are read in the thread pool.
+        auto watcher = new QFutureWatcher<TimelineWindow>(this);
+        connect(watcher, &QFutureWatcher<TimelineWindow>::finished, this, [this, watcher]() {
+                warmingUp_ = false;
+
+                // Opening the room or a sync may have added the newest events meanwhile.
+                if (events.empty())
+                        appendCachedWindow(watcher->result());
+                watcher->deleteLater();
+
+                warmUpNewestRows();
+        });
+        watcher->setFuture(QtConcurrent::run([room_id = room_id_.toStdString()]() {
+                return cache::getTimelineMessages(room_id, "", CACHED_EVENTS_PER_PAGE);
+        }));
+}
+
+void
+TimelineModel::warmUpNewestRows()
+{
+        // The newest rows are shown first.
+        decryptAround(0);
+        // Only known, once a timeline was shown.
+        const auto layout = manager_->mediaLayout();
+        if (layout.avatarSize > 0)
+                prefetchMedia(0,
+                              WARM_UP_ROWS - 1,
+                              layout.avatarSize,
+                              layout.mediaWidth,
+                              layout.mediaMaxHeight);
+}
+
 void
 TimelineModel::fetchMore(const QModelIndex &)
 {
@@ -440,6 +919,9 @@ TimelineModel::fetchMore(const QModelIndex &)
                 return;
         }
 
+        if (restoreFromCache())
+                return;
+
         paginationInProgress = true;
         mtx::http::MessagesOpts opts;
         opts.room_id = room_id_.toStdString();
@@ -447,21 +929,245 @@ TimelineModel::fetchMore(const QModelIndex &)
 
         nhlog::ui()->debug("Paginating room {}", opts.room_id);
 
-        http::client()->messages(
-          opts, [this, opts](const mtx::responses::Messages &res, mtx::http::RequestErr err) {
-                  if (err) {
-                          nhlog::net()->error("failed to call /messages ({}): {} - {} - {}",
-                                              opts.room_id,
-                                              mtx::errors::to_string(err->matrix_error.errcode),
-                                              err->matrix_error.error,
-                                              err->parse_error);
+        const auto oldest = events.empty() ? "" : events.idAt(events.size() - 1).toStdString();
+        http::schedule(http::Priority::Interactive, [this, opts, oldest](auto slot) {
+                http::client()->messages(
+                  opts,
+                  [slot, this, opts, oldest](const mtx::responses::Messages &res,
+                                             mtx::http::RequestErr err) {
+                          if (slot.retry(err))
+                                  return;
+
+                          if (err) {
+                                  nhlog::net()->error(
+                                    "failed to call /messages ({}): {} - {} - {}",
+                                    opts.room_id,
+                                    mtx::errors::to_string(err->matrix_error.errcode),
+                                    err->matrix_error.error,
+                                    err->parse_error);
+                                  paginationInProgress = false;
+                                  return;
+                          }
+
+                          // Keep the events, even if the room is unloaded before they are shown.
+                          // If they fill a gap, the history before them is in the cache already.
+                          const bool connected =
+                            !oldest.empty() && cache::saveOldMessages(opts.room_id, oldest, res);
+
+                          emit oldMessagesRetrieved(std::move(res), connected);
                           paginationInProgress = false;
-                          return;
-                  }
+                  });
+        });
+}
 
-                  emit oldMessagesRetrieved(std::move(res));
-                  paginationInProgress = false;
-          });
+void
+TimelineModel::showEvent(QString id)
+{
+        if (const int row = idToIndex(id); row >= 0) {
+                emit scrollToIndex(row);
+                return;
+        }
+
+        if (showCachedEvent(id))
+                return;
+
+        // About a page on each side. The events are stored, so the rows are loaded from the cache.
+        const auto room_id = room_id_.toStdString();
+        const auto path    = QStringLiteral("/client/r0/rooms/%1/context/%2?limit=%3")
+                            .arg(QString::fromUtf8(QUrl::toPercentEncoding(room_id_)),
+                                 QString::fromUtf8(QUrl::toPercentEncoding(id)))
+                            .arg(2 * CACHED_EVENTS_PER_PAGE)
+                            .toStdString();
+
+        nhlog::ui()->debug("Requesting the context of {} in room {}", id.toStdString(), room_id);
+
+        // The model stays loaded, until the request finished.
+        contextRequests_++;
+
+        http::schedule(http::Priority::Interactive, [this, id, room_id, path](auto slot) {
+                http::client()->get<EventContext>(
+                  path,
+                  [slot, this, id, room_id](const EventContext &res,
+                                            mtx::http::HeaderFields,
+                                            mtx::http::RequestErr err) {
+                          if (slot.retry(err))
+                                  return;
+
+                          if (err) {
+                                  nhlog::net()->error(
+                                    "failed to retrieve the context of {} ({}): {} - {}",
+                                    id.toStdString(),
+                                    room_id,
+                                    mtx::errors::to_string(err->matrix_error.errcode),
+                                    err->matrix_error.error);
+                                  emit contextRetrieved(id, false);
+                                  return;
+                          }
+
+                          cache::saveTimelineContext(room_id, res.events, res.start);
+                          emit contextRetrieved(id, true);
+                  });
+        });
+}
+
+bool
+TimelineModel::showCachedEvent(const QString &id)
+{
+        auto context = cache::getTimelineContext(
+          room_id_.toStdString(), id.toStdString(), CACHED_EVENTS_PER_PAGE);
+        if (!context)
+                return false;
+
+        std::vector<mtx::events::collections::TimelineEvents> window(
+          std::make_move_iterator(context->newer.events.rbegin()),
+          std::make_move_iterator(context->newer.events.rend()));
+        window.push_back(std::move(context->event));
+        window.insert(window.end(),
+                      std::make_move_iterator(context->older.events.begin()),
+                      std::make_move_iterator(context->older.events.end()));
+
+        nhlog::ui()->debug("Showing {} stored events around {} in room {}",
+                           window.size(),
+                           id.toStdString(),
+                           room_id_.toStdString());
+
+        // The rows are replaced by a window around the event. It grows in both directions, until
+        // it meets the newest events of the room again.
+        clearRows();
+        detached_               = true;
+        cachedHistoryExhausted_ = context->older.reached_end;
+        prev_batch_token_       = QString::fromStdString(context->older.prev_batch);
+        appendEvents(window);
+
+        if (context->newer.reached_newest) {
+                detached_ = false;
+                attachPending();
+        }
+
+        emit scrollToIndex(idToIndex(id));
+        return true;
+}
+
+void
+TimelineModel::showLatest()
+{
+        if (!detached_)
+                return;
+
+        reloadFromCache();
+        emit scrollToIndex(0);
+}
+
+void
+TimelineModel::reloadFromCache()
+{
+        clearRows();
+        detached_ = false;
+        restoreFromCache();
+        attachPending();
+        updateLastMessage();
+}
+
+void
+TimelineModel::fetchNewer()
+{
+        if (!detached_ || fillingNewerGap_ || events.empty())
+                return;
+
+        auto newer = cache::getTimelineMessagesAfter(
+          room_id_.toStdString(), events.idAt(0).toStdString(), CACHED_EVENTS_PER_PAGE);
+
+        if (!newer.events.empty()) {
+                auto ids = collapseMemberRuns(internalAddEvents(newer.events), false);
+                if (!ids.empty()) {
+                        beginInsertRows(QModelIndex(), 0, static_cast<int>(ids.size() - 1));
+                        events.prepend(ids);
+                        endInsertRows();
+                }
+        }
+
+        // The rows met the newest events of the room.
+        if (newer.reached_newest) {
+                detached_ = false;
+                attachPending();
+                return;
+        }
+
+        if (!newer.events.empty())
+                return;
+
+        // Nothing is known to follow the newest row.
+        if (newer.gap_event_id.empty()) {
+                showLatest();
+                return;
+        }
+
+        // The events before the gap are requested backwards from it, until they reach the rows.
+        fillingNewerGap_ = true;
+        mtx::http::MessagesOpts opts;
+        opts.room_id = room_id_.toStdString();
+        opts.from    = newer.gap_token;
+
+        const auto gap = newer.gap_event_id;
+        nhlog::ui()->debug("Filling the gap before {} in room {}", gap, opts.room_id);
+
+        http::schedule(http::Priority::Interactive, [this, opts, gap](auto slot) {
+                http::client()->messages(
+                  opts,
+                  [slot, this, opts, gap](const mtx::responses::Messages &res,
+                                          mtx::http::RequestErr err) {
+                          if (slot.retry(err))
+                                  return;
+
+                          if (err) {
+                                  nhlog::net()->error(
+                                    "failed to call /messages ({}): {} - {} - {}",
+                                    opts.room_id,
+                                    mtx::errors::to_string(err->matrix_error.errcode),
+                                    err->matrix_error.error,
+                                    err->parse_error);
+                                  emit newerGapFilled(false);
+                                  return;
+                          }
+
+                          cache::saveOldMessages(opts.room_id, gap, res);
+
+                          // An empty page with a token doesn't change the stored timeline.
+                          emit newerGapFilled(!res.chunk.empty() || res.end.empty());
+                  });
+        });
+}
+
+void
+TimelineModel::clearRows()
+{
+        // A running pagination belongs to the old rows.
+        if (paginationInProgress)
+                discardPagination_ = true;
+
+        beginResetModel();
+        events.retain([](const QString &) { return false; });
+        memberRuns_.clear();
+        collapsedInto_.clear();
+        expandedRuns_.clear();
+        cachedHistoryExhausted_ = false;
+        endResetModel();
+}
+
+void
+TimelineModel::attachPending()
+{
+        std::vector<QString> ids;
+        for (const auto &id : pending)
+                if (idToIndex(id) < 0)
+                        ids.push_back(id);
+
+        if (ids.empty())
+                return;
+
+        beginInsertRows(QModelIndex(), 0, static_cast<int>(ids.size() - 1));
+        events.prepend(ids);
+        endInsertRows();
 }
 
 void
@@ -470,16 +1176,36 @@ TimelineModel::addEvents(const mtx::responses::Timeline &timeline)
         if (isInitialSync) {
                 prev_batch_token_ = QString::fromStdString(timeline.prev_batch);
                 isInitialSync     = false;
+
+                // Events restored from the cache don't connect to a limited timeline, so start
+                // over with only the new events.
+                if (timeline.limited && !events.empty()) {
+                        beginResetModel();
+                        events.retain([this](const QString &id) { return pending.contains(id); });
+                        memberRuns_.clear();
+                        collapsedInto_.clear();
+                        expandedRuns_.clear();
+                        cachedHistoryExhausted_ = false;
+                        endResetModel();
+                }
         }
 
         if (timeline.events.empty())
                 return;
 
-        std::vector<QString> ids = internalAddEvents(timeline.events);
+        // The events are stored. They are loaded, once the rows reach the newest events again.
+        if (detached_) {
+                updateLastMessage(manager_, room_id_, timeline, decryptDescription);
+                return;
+        }
+
+        cache::LatencyTimer timer(NHEKO_METRIC("timeline addEvents"));
+
+        std::vector<QString> ids = collapseMemberRuns(internalAddEvents(timeline.events), false);
 
         if (!ids.empty()) {
                 beginInsertRows(QModelIndex(), 0, static_cast<int>(ids.size() - 1));
-                this->eventOrder.insert(this->eventOrder.begin(), ids.rbegin(), ids.rend());
+                this->events.prepend(ids);
                 endInsertRows();
         }
 
@@ -512,8 +1238,8 @@ isMessage(const mtx::events::EncryptedEvent<T> &)
 void
 TimelineModel::updateLastMessage()
 {
-        for (auto it = eventOrder.begin(); it != eventOrder.end(); ++it) {
-                auto event = events.value(*it);
+        for (std::size_t row = 0; row < events.size(); row++) {
+                auto event = events.at(row);
                 if (auto e = std::get_if<mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>>(
                       &event)) {
                         if (decryptDescription) {
@@ -531,41 +1257,105 @@ TimelineModel::updateLastMessage()
         }
 }
 
+void
+TimelineModel::updateLastMessage(TimelineViewManager *manager,
+                                 const QString &room_id,
+                                 const mtx::responses::Timeline &timeline,
+                                 bool decrypt)
+{
+        for (auto it = timeline.events.rbegin(); it != timeline.events.rend(); ++it) {
+                auto event = *it;
+                if (auto e = std::get_if<mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>>(
+                      &event)) {
+                        if (decrypt) {
+                                event = TimelineModel::decrypt(room_id.toStdString(), *e).event;
+                        }
+                }
+
+                if (!std::visit([](const auto &e) -> bool { return isMessage(e); }, event))
+                        continue;
+
+                auto description = utils::getMessageDescription(
+                  event, QString::fromStdString(http::client()->user_id().to_string()), room_id);
+                emit manager->updateRoomsLastMessage(room_id, description);
+                return;
+        }
+}
+
+TimelineMemoryUsage
+TimelineModel::memoryBreakdown() const
+{
+        // Decrypted events and display rows mostly share their strings with the stored events.
+        TimelineMemoryUsage usage;
+        usage.events    = events.memoryUsage();
+        usage.decrypted = decryptedEvents_.size() * sizeof(DecryptionResult);
+        usage.rows      = displayRows_.size() * sizeof(DisplayRow);
+        return usage;
+}
+
+bool
+TimelineModel::isBusy() const
+{
+        return !pending.isEmpty() || paginationInProgress || fetcher_.busy() || loadingMembers_ ||
+               fillingNewerGap_ || contextRequests_ > 0 || requestsInFlight_ > 0 ||
+               readMarker_.busy();
+}
+
 std::vector<QString>
 TimelineModel::internalAddEvents(
   const std::vector<mtx::events::collections::TimelineEvents> &timeline)
 {
         std::vector<QString> ids;
-        for (auto e : timeline) {
-                QString id = QString::fromStdString(mtx::accessors::event_id(e));
+        std::vector<int> changedRows;
+        uint64_t localEchoes = 0, redactions = 0;
+        for (const auto &e : timeline) {
+                QString id = mtx::accessors::toQString(mtx::accessors::event_id_view(e));
+
+                // The display names of the senders may have changed.
+                using Member = mtx::events::StateEvent<mtx::events::state::Member>;
+                if (std::holds_alternative<Member>(e)) {
+                        displayRows_.clear();
+                        formattedEvents_.clear();
+                        formattedTyping_.clear();
+                }
 
                 if (this->events.contains(id)) {
                         this->events.insert(id, e);
+                        invalidateRow(id);
                         int idx = idToIndex(id);
-                        emit dataChanged(index(idx, 0), index(idx, 0));
-                        continue;
+
+                        // Events only fetched as the target of a reply are not in the timeline
+                        // yet.
+                        if (idx >= 0) {
+                                changedRows.push_back(idx);
+                                continue;
+                        }
                 }
 
-                QString txid = QString::fromStdString(mtx::accessors::transaction_id(e));
+                QString txid = mtx::accessors::toQString(mtx::accessors::transaction_id_view(e));
                 if (this->pending.removeOne(txid)) {
+                        cache::removeOutboxMessage(room_id_.toStdString(), txid.toStdString());
+                        this->events.rename(txid, id);
                         this->events.insert(id, e);
-                        this->events.remove(txid);
-                        int idx = idToIndex(txid);
+                        invalidateRow(txid);
+                        int idx = idToIndex(id);
+                        localEchoes++;
+
+                        // The local echo isn't shown, while the timeline is detached.
                         if (idx < 0) {
-                                nhlog::ui()->warn("Received index out of range");
+                                ids.push_back(id);
                                 continue;
                         }
-                        eventOrder[idx] = id;
-                        emit dataChanged(index(idx, 0), index(idx, 0));
+                        changedRows.push_back(idx);
                         continue;
                 }
 
                 if (auto redaction =
                       std::get_if<mtx::events::RedactionEvent<mtx::events::msg::Redaction>>(&e)) {
                         QString redacts = QString::fromStdString(redaction->redacts);
-                        auto redacted   = std::find(eventOrder.begin(), eventOrder.end(), redacts);
+                        int row         = idToIndex(redacts);
 
-                        if (redacted != eventOrder.end()) {
+                        if (row >= 0) {
                                 auto redactedEvent = std::visit(
                                   [](const auto &ev)
                                     -> mtx::events::RoomEvent<mtx::events::msg::Redacted> {
@@ -580,14 +1370,16 @@ TimelineModel::internalAddEvents(
                                   },
                                   e);
                                 events.insert(redacts, redactedEvent);
+                                invalidateRow(redacts);
 
-                                int row = (int)std::distance(eventOrder.begin(), redacted);
-                                emit dataChanged(index(row, 0), index(row, 0));
+                                changedRows.push_back(row);
                         }
 
+                        redactions++;
                         continue; // don't insert redaction into timeline
                 }
 
+                // Render the body in the background, before the row is shown.
                 if (auto event =
                       std::get_if<mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>>(&e)) {
                         auto e_      = decryptEvent(*event).event;
@@ -595,35 +1387,52 @@ TimelineModel::internalAddEvents(
 
                         if (encInfo)
                                 emit newEncryptedImage(encInfo.value());
+                        if (auto thumbnail = mtx::accessors::thumbnail_file(e_))
+                                emit newEncryptedImage(thumbnail.value());
+
+                        MessageRenderer::instance().prerenderFormattedBody(formattedBodySource(e_));
+                } else {
+                        MessageRenderer::instance().prerenderFormattedBody(formattedBodySource(e));
                 }
 
                 this->events.insert(id, e);
                 ids.push_back(id);
 
-                auto replyTo  = mtx::accessors::in_reply_to_event(e);
-                auto qReplyTo = QString::fromStdString(replyTo);
-                if (!replyTo.empty() && !events.contains(qReplyTo)) {
-                        http::client()->get_event(
-                          this->room_id_.toStdString(),
-                          replyTo,
-                          [this, id, replyTo](
-                            const mtx::events::collections::TimelineEvents &timeline,
-                            mtx::http::RequestErr err) {
-                                  if (err) {
-                                          nhlog::net()->error(
-                                            "Failed to retrieve event with id {}, which was "
-                                            "requested to show the replyTo for event {}",
-                                            replyTo,
-                                            id.toStdString());
-                                          return;
-                                  }
-                                  emit eventFetched(id, timeline);
-                          });
+                auto replyTo = mtx::accessors::in_reply_to_event_view(e);
+                if (replyTo.empty())
+                        continue;
+
+                auto qReplyTo = mtx::accessors::toQString(replyTo);
+                if (!events.contains(qReplyTo)) {
+                        if (auto fetched = fetcher_.fetch(std::string(replyTo), id))
+                                events.insert(qReplyTo, *fetched);
                 }
         }
+
+        cache::recordCount(NHEKO_METRIC("timeline events"), timeline.size());
+        cache::recordCount(NHEKO_METRIC("timeline local echoes"), localEchoes);
+        cache::recordCount(NHEKO_METRIC("timeline redactions"), redactions);
+
+        emitRowsChanged(std::move(changedRows));
         return ids;
 }
 
+void
+TimelineModel::emitRowsChanged(std::vector<int> rows)
+{
+        std::sort(rows.begin(), rows.end());
+        rows.erase(std::unique(rows.begin(), rows.end()), rows.end());
+
+        for (std::size_t first = 0; first < rows.size();) {
+                auto last = first;
+                while (last + 1 < rows.size() && rows[last + 1] == rows[last] + 1)
+                        last++;
+
+                emit dataChanged(index(rows[first], 0), index(rows[last], 0));
+                first = last + 1;
+        }
+}
+
 void
 TimelineModel::setCurrentIndex(int index)
 {
@@ -631,38 +1440,148 @@ TimelineModel::setCurrentIndex(int index)
         currentId     = indexToId(index);
         emit currentIndexChanged(index);
 
+        // The newest rows of a detached timeline aren't the newest events of the room.
         if ((oldIndex > index || oldIndex == -1) && !pending.contains(currentId) &&
-            ChatPage::instance()->isActiveWindow()) {
-                readEvent(currentId.toStdString());
+            !detached_ && ChatPage::instance()->isActiveWindow()) {
+                readMarker_.advance(currentId);
+        }
+
+        if (detached_ && index <= prefetchDistance_)
+                QTimer::singleShot(0, this, &TimelineModel::fetchNewer);
+
+        const int remaining = (int)events.size() - 1 - index;
+        if (remaining <= prefetchDistance_) {
+                // Don't change the rows, while QML updates the bindings of the delegates.
+                QTimer::singleShot(0, this, [this]() {
+                        if (!paginationInProgress && canFetchMore(QModelIndex())) {
+                                nhlog::ui()->debug("Prefetching older messages of room {}",
+                                                   room_id_.toStdString());
+                                fetchMore(QModelIndex());
+                        }
+                });
+        } else if (paginationInProgress && remaining > 2 * prefetchDistance_) {
+                discardPagination_ = true;
         }
 }
 
 void
-TimelineModel::readEvent(const std::string &id)
+TimelineModel::addBackwardsEvents(const mtx::responses::Messages &msgs, bool connected)
 {
-        http::client()->read_event(room_id_.toStdString(), id, [this](mtx::http::RequestErr err) {
-                if (err) {
-                        nhlog::net()->warn("failed to read_event ({}, {})",
-                                           room_id_.toStdString(),
-                                           currentId.toStdString());
-                }
-        });
+        prev_batch_token_ = QString::fromStdString(msgs.end);
+        if (connected)
+                cachedHistoryExhausted_ = false;
+
+        // The user jumped away from the top of the timeline, while the messages were requested.
+        // They are in the cache, so the next fetchMore restores them from there.
+        if (discardPagination_) {
+                discardPagination_      = false;
+                cachedHistoryExhausted_ = false;
+                return;
+        }
+
+        appendEvents(msgs.chunk);
 }
 
 void
-TimelineModel::addBackwardsEvents(const mtx::responses::Messages &msgs)
+TimelineModel::appendEvents(const std::vector<mtx::events::collections::TimelineEvents> &timeline)
 {
-        std::vector<QString> ids = internalAddEvents(msgs.chunk);
+        cache::LatencyTimer timer(NHEKO_METRIC("timeline appendEvents"));
+
+        std::vector<QString> ids = collapseMemberRuns(internalAddEvents(timeline), true);
 
         if (!ids.empty()) {
+                const int oldest = static_cast<int>(this->events.size()) - 1;
+
                 beginInsertRows(QModelIndex(),
-                                static_cast<int>(this->eventOrder.size()),
-                                static_cast<int>(this->eventOrder.size() + ids.size() - 1));
-                this->eventOrder.insert(this->eventOrder.end(), ids.begin(), ids.end());
+                                static_cast<int>(this->events.size()),
+                                static_cast<int>(this->events.size() + ids.size() - 1));
+                this->events.append(ids);
                 endInsertRows();
+
+                // The previously oldest row may not start a day anymore, or start one now.
+                if (oldest >= 0)
+                        emit dataChanged(index(oldest, 0), index(oldest, 0), {SectionHeader});
         }
+}
 
-        prev_batch_token_ = QString::fromStdString(msgs.end);
+std::vector<QString>
+TimelineModel::collapseMemberRuns(const std::vector<QString> &ids, bool older)
+{
+        if (!collapseMemberEvents_)
+                return ids;
+
+        using Member = mtx::events::StateEvent<mtx::events::state::Member>;
+
+        // The row at the end of the timeline, which the new events are added to.
+        QString neighbour;
+        if (!events.empty())
+                neighbour = events.idAt(older ? events.size() - 1 : 0);
+
+        std::vector<QString> kept;
+        std::vector<int> changedRows;
+        for (const auto &id : ids) {
+                if (!kept.empty())
+                        neighbour = kept.back();
+
+                if (neighbour.isEmpty() || expandedRuns_.contains(neighbour) ||
+                    !events.holds<Member>(neighbour) || !events.holds<Member>(id)) {
+                        kept.push_back(id);
+                        continue;
+                }
+
+                auto &run = memberRuns_[neighbour];
+                if (run.empty())
+                        run.push_back(neighbour);
+                if (older)
+                        run.push_back(id);
+                else
+                        run.push_front(id);
+                collapsedInto_.insert(id, neighbour);
+
+                if (kept.empty())
+                        changedRows.push_back(events.rowOf(neighbour));
+        }
+
+        emitRowsChanged(std::move(changedRows));
+        return kept;
+}
+
+void
+TimelineModel::expandMemberRun(QString id)
+{
+        auto run = memberRuns_.find(id);
+        int row  = events.rowOf(id);
+        if (run == memberRuns_.end() || row < 0)
+                return;
+
+        std::vector<QString> newer, older;
+        bool afterRow = false;
+        for (const auto &member : run.value()) {
+                expandedRuns_.insert(member);
+                if (member == id) {
+                        afterRow = true;
+                        continue;
+                }
+
+                collapsedInto_.remove(member);
+                (afterRow ? older : newer).push_back(member);
+        }
+        memberRuns_.erase(run);
+
+        if (!older.empty()) {
+                beginInsertRows(QModelIndex(), row + 1, row + static_cast<int>(older.size()));
+                events.insertAt(row + 1, older);
+                endInsertRows();
+        }
+
+        if (!newer.empty()) {
+                beginInsertRows(QModelIndex(), row, row + static_cast<int>(newer.size() - 1));
+                events.insertAt(row, newer);
+                endInsertRows();
+                row += static_cast<int>(newer.size());
+        }
+
+        emit dataChanged(index(row, 0), index(row, 0));
 }
 
 QString
@@ -729,13 +1648,204 @@ TimelineModel::openUserProfile(QString userid) const
 DecryptionResult
 TimelineModel::decryptEvent(const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e) const
 {
-        static QCache<std::string, DecryptionResult> decryptedEvents{300};
+        if (auto cachedEvent = decryptedEvents_.object(e.event_id))
+                return *cachedEvent;
 
-        if (auto cachedEvent = decryptedEvents.object(e.event_id))
+        auto result = decrypt(room_id_.toStdString(), e);
+        waitForSession(e.event_id, e.content.session_id, result);
+        decryptedEvents_.insert(e.event_id, new DecryptionResult(result), 1);
+        return result;
+}
+
+DecryptionResult
+TimelineModel::decryptEventLater(
+  const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e) const
+{
+        if (auto cachedEvent = decryptedEvents_.object(e.event_id))
                 return *cachedEvent;
 
+        mtx::events::RoomEvent<mtx::events::msg::Notice> placeholder;
+        placeholder.origin_server_ts = e.origin_server_ts;
+        placeholder.event_id         = e.event_id;
+        placeholder.sender           = e.sender;
+        placeholder.content.body =
+          tr("-- Decrypting... --", "Placeholder, while the message is decrypted.").toStdString();
+
+        // e may be borrowed from the parsed events, which decryptAround replaces.
+        queueDecryption(e);
+        decryptAround(idToIndex(QString::fromStdString(placeholder.event_id)));
+
+        return {placeholder, false};
+}
+
+void
+TimelineModel::decryptAround(int row) const
+{
+        if (row < 0)
+                return;
+
+        const int last = std::min(row + DECRYPT_AHEAD, (int)events.size() - 1);
+        for (int r = std::max(row - DECRYPT_AHEAD, 0); r <= last; r++) {
+                using Encrypted = mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>;
+                if (!events.holdsAt<Encrypted>(r))
+                        continue;
+
+                auto e = std::get_if<Encrypted>(events.findAt(r));
+                if (e && !decryptedEvents_.contains(e->event_id))
+                        queueDecryption(*e);
+        }
+}
+
+void
+TimelineModel::queueDecryption(
+  const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e) const
+{
+        if (!decrypting_.emplace(e.event_id, e.content.session_id).second)
+                return;
+
+        // data() is const, but the model owns the pending decryptions and updates their rows.
+        auto self    = const_cast<TimelineModel *>(this);
+        auto watcher = new QFutureWatcher<DecryptionResult>(self);
+        connect(watcher,
+                &QFutureWatcher<DecryptionResult>::finished,
+                self,
+                [self, watcher, event_id = e.event_id, session_id = e.content.session_id]() {
+                        self->decryptionFinished(event_id, session_id, watcher->result());
+                        watcher->deleteLater();
+                });
+        watcher->setFuture(
+          QtConcurrent::run(decryptionPool(), [room_id = room_id_.toStdString(), e]() {
+                  return decryptAndKeep(room_id, e);
+          }));
+}
+
+DecryptionResult
+TimelineModel::decryptAndKeep(const std::string &room_id,
+                              const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e)
+{
+        // The kept plaintext was indexed, when it was decrypted.
+        if (auto stored = cache::getDecryptedEvent(e.event_id))
+                return DecryptionResult{*stored, true};
+
+        auto result = decryptWithSession(room_id, e);
+        // The server can't search encrypted rooms, so the plaintext is indexed here.
+        if (result.isDecrypted) {
+                cache::indexDecryptedMessage(room_id, result.event);
+                cache::saveDecryptedEvent(result.event);
+        }
+        return result;
+}
+
+void
+TimelineModel::decryptionFinished(const std::string &event_id,
+                                  const std::string &session_id,
+                                  const DecryptionResult &result)
+{
+        using Encrypted = mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>;
+
+        decrypting_.erase(event_id);
+
+        // The session may have been saved after the decryption looked it up.
+        if (sessionArrived_.erase(event_id) && !result.isDecrypted) {
+                const auto id = QString::fromStdString(event_id);
+                if (auto e = std::get_if<Encrypted>(events.find(id))) {
+                        queueDecryption(*e);
+                        return;
+                }
+        }
+
+        waitForSession(event_id, session_id, result);
+        decryptedEvents_.insert(event_id, new DecryptionResult(result), 1);
+        invalidateRow(QString::fromStdString(event_id));
+
+        int idx = idToIndex(QString::fromStdString(event_id));
+        if (idx >= 0)
+                emit dataChanged(index(idx, 0), index(idx, 0));
+}
+
+void
+TimelineModel::receivedImageDimensions(const QString &mxcUrl)
+{
+        const auto ids = waitingForDimensions_.take(mxcUrl);
+        for (const auto &id : ids) {
+                invalidateRow(id);
+
+                if (const int idx = idToIndex(id); idx >= 0)
+                        emit dataChanged(index(idx, 0), index(idx, 0));
+        }
+}
+
+void
+TimelineModel::waitForSession(const std::string &event_id,
+                              const std::string &session_id,
+                              const DecryptionResult &result) const
+{
+        // An older index of the session may still arrive, if it didn't know the message index.
+        if (result.missingSession || result.transient)
+                waitingForSession_[session_id].insert(event_id);
+
+        if (!result.transient)
+                return;
+
+        // Otherwise the failure is kept, until the room is unloaded.
+        auto self = const_cast<TimelineModel *>(this);
+        QTimer::singleShot(DECRYPT_RETRY_INTERVAL, self, [self, event_id]() {
+                if (!self->decryptedEvents_.remove(event_id))
+                        return;
+
+                const auto id = QString::fromStdString(event_id);
+                self->invalidateRow(id);
+                if (const int idx = self->idToIndex(id); idx >= 0)
+                        emit self->dataChanged(self->index(idx, 0), self->index(idx, 0));
+        });
+}
+
+void
+TimelineModel::receivedInboundMegolmSessions(const QStringList &session_ids)
+{
+        using Encrypted = mtx::events::EncryptedEvent<mtx::events::msg::Encrypted>;
+
+        for (const auto &session_id : session_ids) {
+                for (const auto &[event_id, session] : decrypting_)
+                        if (session == session_id.toStdString())
+                                sessionArrived_.insert(event_id);
+
+                auto waiting = waitingForSession_.find(session_id.toStdString());
+                if (waiting == waitingForSession_.end())
+                        continue;
+
+                // Only the rows of these events change, once they are decrypted.
+                for (const auto &event_id : waiting->second) {
+                        decryptedEvents_.remove(event_id);
+
+                        const auto id = QString::fromStdString(event_id);
+                        if (auto e = std::get_if<Encrypted>(events.find(id)))
+                                queueDecryption(*e);
+                        else
+                                invalidateRow(id);
+                }
+
+                waitingForSession_.erase(waiting);
+        }
+}
+
+DecryptionResult
+TimelineModel::decrypt(const std::string &room_id,
+                       const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e)
+{
+        if (auto stored = cache::getDecryptedEvent(e.event_id))
+                return {*stored, true};
+
+        return decryptWithSession(room_id, e);
+}
+
+DecryptionResult
+TimelineModel::decryptWithSession(
+  const std::string &room_id,
+  const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e)
+{
         MegolmSessionIndex index;
-        index.room_id    = room_id_.toStdString();
+        index.room_id    = room_id;
         index.session_id = e.content.session_id;
         index.sender_key = e.content.sender_key;
 
@@ -748,32 +1858,45 @@ TimelineModel::decryptEvent(const mtx::events::EncryptedEvent<mtx::events::msg::
              "Placeholder, when the message was not decrypted yet or can't be decrypted.")
             .toStdString();
 
+        std::string msg_str;
         try {
-                if (!cache::inboundMegolmSessionExists(index)) {
-                        nhlog::crypto()->info("Could not find inbound megolm session ({}, {}, {})",
-                                              index.room_id,
-                                              index.session_id,
-                                              e.sender);
+                // One lookup, a missing session isn't read from the db again, until it arrives.
+                auto session = cache::getInboundMegolmSession(index);
+                if (!session) {
+                        nhlog::crypto()->debug("Could not find inbound megolm session ({}, {}, {})",
+                                               index.room_id,
+                                               index.session_id,
+                                               e.sender);
                         // TODO: request megolm session_id & session_key from the sender.
-                        decryptedEvents.insert(
-                          dummy.event_id, new DecryptionResult{dummy, false}, 1);
+                        return {dummy, false, true};
+                }
+
+                // Messages of other sessions are decrypted in parallel.
+                std::unique_lock<std::mutex> lock(session->mutex);
+                cache::LatencyTimer timer(megolmDecryptOperation(e.content.ciphertext.size()));
+                auto res = olm::client()->decrypt_group_message(session->session.get(),
+                                                                e.content.ciphertext);
+
+                // A message index is only used once, or an old message was replayed as a new
+                // event.
+                auto [decrypted, inserted] =
+                  session->decrypted.emplace(res.message_index, e.event_id);
+                if (!inserted && decrypted->second != e.event_id) {
+                        nhlog::crypto()->warn(
+                          "message index {} of megolm session ({}, {}) was replayed by {}",
+                          res.message_index,
+                          index.room_id,
+                          index.session_id,
+                          e.event_id);
+                        dummy.content.body =
+                          tr("-- Replay attack! This message index was reused --",
+                             "Placeholder, when the message index of an encrypted message was "
+                             "already used by another message.")
+                            .toStdString();
                         return {dummy, false};
                 }
-        } catch (const lmdb::error &e) {
-                nhlog::db()->critical("failed to check megolm session's existence: {}", e.what());
-                dummy.content.body = tr("-- Decryption Error (failed to communicate with DB) --",
-                                        "Placeholder, when the message can't be decrypted, because "
-                                        "the DB access failed when trying to lookup the session.")
-                                       .toStdString();
-                decryptedEvents.insert(dummy.event_id, new DecryptionResult{dummy, false}, 1);
-                return {dummy, false};
-        }
 
-        std::string msg_str;
-        try {
-                auto session = cache::getInboundMegolmSession(index);
-                auto res     = olm::client()->decrypt_group_message(session, e.content.ciphertext);
-                msg_str      = std::string((char *)res.data.data(), res.data.size());
+                msg_str = std::string((char *)res.data.data(), res.data.size());
         } catch (const lmdb::error &e) {
                 nhlog::db()->critical("failed to retrieve megolm session with index ({}, {}, {})",
                                       index.room_id,
@@ -785,8 +1908,7 @@ TimelineModel::decryptEvent(const mtx::events::EncryptedEvent<mtx::events::msg::
                      "Placeholder, when the message can't be decrypted, because the DB access "
                      "failed.")
                     .toStdString();
-                decryptedEvents.insert(dummy.event_id, new DecryptionResult{dummy, false}, 1);
-                return {dummy, false};
+                return {dummy, false, false, true};
         } catch (const mtx::crypto::olm_exception &e) {
                 nhlog::crypto()->critical("failed to decrypt message with index ({}, {}, {}): {}",
                                           index.room_id,
@@ -799,8 +1921,10 @@ TimelineModel::decryptEvent(const mtx::events::EncryptedEvent<mtx::events::msg::
                      "decrytion returned an error, which is passed ad %1.")
                     .arg(e.what())
                     .toStdString();
-                decryptedEvents.insert(dummy.event_id, new DecryptionResult{dummy, false}, 1);
-                return {dummy, false};
+                // Keys forwarded by another device may start at an older index.
+                const bool unknownIndex =
+                  std::string(e.what()).find("UNKNOWN_MESSAGE_INDEX") != std::string::npos;
+                return {dummy, false, false, unknownIndex};
         }
 
         // Add missing fields for the event.
@@ -821,7 +1945,6 @@ TimelineModel::decryptEvent(const mtx::events::EncryptedEvent<mtx::events::msg::
         mtx::responses::utils::parse_timeline_events(event_array, temp_events);
 
         if (temp_events.size() == 1) {
-                decryptedEvents.insert(e.event_id, new DecryptionResult{temp_events[0], true}, 1);
                 return {temp_events[0], true};
         }
 
@@ -830,7 +1953,6 @@ TimelineModel::decryptEvent(const mtx::events::EncryptedEvent<mtx::events::msg::
              "Placeholder, when the message was decrypted, but we couldn't parse it, because "
              "Nheko/mtxclient don't support that event type yet.")
             .toStdString();
-        decryptedEvents.insert(dummy.event_id, new DecryptionResult{dummy, false}, 1);
         return {dummy, false};
 }
 
@@ -873,57 +1995,135 @@ TimelineModel::readReceiptsAction(QString id) const
         MainWindow::instance()->openReadReceiptsDialog(id);
 }
 
-void
-TimelineModel::redactEvent(QString id)
-{
-        if (!id.isEmpty())
-                http::client()->redact_event(
-                  room_id_.toStdString(),
-                  id.toStdString(),
-                  [this, id](const mtx::responses::EventId &, mtx::http::RequestErr err) {
-                          if (err) {
-                                  emit redactionFailed(
-                                    tr("Message redaction failed: %1")
-                                      .arg(QString::fromStdString(err->matrix_error.error)));
-                                  return;
-                          }
+void
+TimelineModel::redactEvent(QString id)
+{
+        if (id.isEmpty())
+                return;
+
+        requestsInFlight_++;
+        http::client()->redact_event(
+          room_id_.toStdString(),
+          id.toStdString(),
+          [this, id](const mtx::responses::EventId &, mtx::http::RequestErr err) {
+                  if (err)
+                          emit redactionFailed(
+                            tr("Message redaction failed: %1")
+                              .arg(QString::fromStdString(err->matrix_error.error)));
+                  else
+                          emit eventRedacted(id);
+
+                  // The model may be unloaded from here on.
+                  requestsInFlight_--;
+          });
+}
+
+int
+TimelineModel::idToIndex(QString id) const
+{
+        if (id.isEmpty())
+                return -1;
+        return events.rowOf(collapsedInto_.value(id, id));
+}
+
+QString
+TimelineModel::indexToId(int index) const
+{
+        if (index < 0 || index >= (int)events.size())
+                return "";
+        return events.idAt(index);
+}
+
+void
+TimelineModel::updateReceipts(
+  const std::map<std::string, std::map<std::string, uint64_t>> &receipts)
+{
+        // Keeping the receipt of every member of a large room only to tell, how far our messages
+        // were read, isn't worth it.
+        if (cache::isLargeRoom(room_id_.toStdString()))
+                return;
+
+        const auto local_user = http::client()->user_id().to_string();
+
+        bool changed = false;
+        for (const auto &[event_id, users] : receipts) {
+                for (const auto &[user_id, ts] : users) {
+                        if (user_id == local_user)
+                                continue;
+
+                        auto &receipt = receipts_[user_id];
+                        if (receipt.first.isEmpty() || ts >= receipt.second) {
+                                receipt = {QString::fromStdString(event_id), ts};
+                                changed = true;
+                        }
+                }
+        }
+
+        if (!changed)
+                return;
+
+        const int oldRow = idToIndex(readUpTo_);
+        readUpToDirty_   = true;
+        const int newRow = readUpToRow();
+
+        // Our messages between the old and the new receipt became read.
+        if (newRow < 0 || (oldRow >= 0 && newRow >= oldRow))
+                return;
+
+        const int end = oldRow >= 0 ? oldRow : static_cast<int>(events.size());
+
+        std::vector<int> rows;
+        for (int row = newRow; row < end; row++)
+                if (events.senderAt(row) == local_user)
+                        rows.push_back(row);
 
-                          emit eventRedacted(id);
-                  });
+        emitRowsChanged(std::move(rows));
 }
 
 int
-TimelineModel::idToIndex(QString id) const
+TimelineModel::readUpToRow() const
 {
-        if (id.isEmpty())
-                return -1;
-        for (int i = 0; i < (int)eventOrder.size(); i++)
-                if (id == eventOrder[i])
-                        return i;
-        return -1;
+        if (readUpToDirty_ || readUpToSize_ != events.size()) {
+                int newest = -1;
+                readUpTo_.clear();
+                for (const auto &[user_id, receipt] : receipts_) {
+                        const int row = idToIndex(receipt.first);
+                        if (row >= 0 && (newest < 0 || row < newest)) {
+                                newest    = row;
+                                readUpTo_ = receipt.first;
+                        }
+                }
+
+                readUpToDirty_ = false;
+                readUpToSize_  = events.size();
+        }
+
+        return idToIndex(readUpTo_);
 }
 
-QString
-TimelineModel::indexToId(int index) const
+bool
+TimelineModel::isReadByOthers(const QString &id) const
 {
-        if (index < 0 || index >= (int)eventOrder.size())
-                return "";
-        return eventOrder[index];
+        const int row = idToIndex(id), readRow = readUpToRow();
+        return row >= 0 && readRow >= 0 && row >= readRow;
 }
 
 // Note: this will only be called for our messages
 void
 TimelineModel::markEventsAsRead(const std::vector<QString> &event_ids)
 {
+        std::vector<int> rows;
         for (const auto &id : event_ids) {
                 read.insert(id);
                 int idx = idToIndex(id);
                 if (idx < 0) {
                         nhlog::ui()->warn("Read index out of range");
-                        return;
+                        break;
                 }
-                emit dataChanged(index(idx, 0), index(idx, 0));
+                rows.push_back(idx);
         }
+
+        emitRowsChanged(std::move(rows));
 }
 
 void
@@ -936,9 +2136,9 @@ TimelineModel::sendEncryptedMessage(const std::string &txn_id, nlohmann::json co
 
         json doc = {{"type", "m.room.message"}, {"content", content}, {"room_id", room_id}};
 
-        try {
-                // Check if we have already an outbound megolm session then we can use.
-                if (cache::outboundMegolmSessionExists(room_id)) {
+        // Encrypts and sends the message, once the session was shared with the new devices.
+        auto send = [this, room_id, doc, txn_id]() {
+                try {
                         auto data =
                           olm::encrypt_group_message(room_id, http::client()->device_id(), doc);
 
@@ -956,181 +2156,94 @@ TimelineModel::sendEncryptedMessage(const std::string &txn_id, nlohmann::json co
                                                              err->matrix_error.error,
                                                              status_code);
                                           emit messageFailed(QString::fromStdString(txn_id));
+                                          return;
                                   }
                                   emit messageSent(
                                     QString::fromStdString(txn_id),
                                     QString::fromStdString(res.event_id.to_string()));
                           });
-                        return;
+                } catch (const lmdb::error &e) {
+                        nhlog::db()->critical("failed to save megolm outbound session: {}",
+                                              e.what());
+                        emit messageFailed(QString::fromStdString(txn_id));
+                }
+        };
+
+        try {
+                const auto members = cache::roomMembers(room_id);
+
+                // The current session is kept, unless somebody left or it is used up. Devices,
+                // which joined since it was shared, get it at its current index.
+                OutboundGroupSessionData session_data;
+                std::string session_key;
+                bool reuse = false;
+                if (cache::outboundMegolmSessionExists(room_id)) {
+                        const auto current = cache::getOutboundMegolmSession(room_id);
+                        if (auto reason = megolmRotationReason(current.data, members)) {
+                                nhlog::crypto()->info(
+                                  "rotating the megolm session of {}: {}", room_id, reason);
+                        } else {
+                                session_data = current.data;
+                                session_key  = mtx::crypto::session_key(current.session);
+                                reuse        = true;
+                        }
                 }
 
-                nhlog::ui()->debug("creating new outbound megolm session");
+                if (!reuse) {
+                        nhlog::ui()->debug("creating new outbound megolm session");
 
-                // Create a new outbound megolm session.
-                auto outbound_session  = olm::client()->init_outbound_group_session();
-                const auto session_id  = mtx::crypto::session_id(outbound_session.get());
-                const auto session_key = mtx::crypto::session_key(outbound_session.get());
+                        auto outbound_session = olm::client()->init_outbound_group_session();
+                        session_data          = OutboundGroupSessionData{};
+                        session_data.session_id =
+                          mtx::crypto::session_id(outbound_session.get());
+                        session_data.session_key = mtx::crypto::session_key(outbound_session.get());
+                        session_data.created_at =
+                          static_cast<uint64_t>(QDateTime::currentMSecsSinceEpoch());
+                        session_key = session_data.session_key;
+
+                        cache::saveOutboundMegolmSession(
+                          room_id, session_data, std::move(outbound_session));
+                }
 
                 // TODO: needs to be moved in the lib.
                 auto megolm_payload = json{{"algorithm", "m.megolm.v1.aes-sha2"},
                                            {"room_id", room_id},
-                                           {"session_id", session_id},
+                                           {"session_id", session_data.session_id},
                                            {"session_key", session_key}};
 
-                // Saving the new megolm session.
-                // TODO: Maybe it's too early to save.
-                OutboundGroupSessionData session_data;
-                session_data.session_id    = session_id;
-                session_data.session_key   = session_key;
-                session_data.message_index = 0; // TODO Update me
-                cache::saveOutboundMegolmSession(
-                  room_id, session_data, std::move(outbound_session));
-
-                const auto members = cache::roomMembers(room_id);
                 nhlog::ui()->info("retrieved {} members for {}", members.size(), room_id);
 
-                auto keeper =
-                  std::make_shared<StateKeeper>([megolm_payload, room_id, doc, txn_id, this]() {
-                          try {
-                                  auto data = olm::encrypt_group_message(
-                                    room_id, http::client()->device_id(), doc);
-
-                                  http::client()
-                                    ->send_room_message<msg::Encrypted, EventType::RoomEncrypted>(
-                                      room_id,
-                                      txn_id,
-                                      data,
-                                      [this, txn_id](const mtx::responses::EventId &res,
-                                                     mtx::http::RequestErr err) {
-                                              if (err) {
-                                                      const int status_code =
-                                                        static_cast<int>(err->status_code);
-                                                      nhlog::net()->warn(
-                                                        "[{}] failed to send message: {} {}",
-                                                        txn_id,
-                                                        err->matrix_error.error,
-                                                        status_code);
-                                                      emit messageFailed(
-                                                        QString::fromStdString(txn_id));
-                                              }
-                                              emit messageSent(
-                                                QString::fromStdString(txn_id),
-                                                QString::fromStdString(res.event_id.to_string()));
-                                      });
-                          } catch (const lmdb::error &e) {
-                                  nhlog::db()->critical(
-                                    "failed to save megolm outbound session: {}", e.what());
-                                  emit messageFailed(QString::fromStdString(txn_id));
-                          }
-                  });
-
-                mtx::requests::QueryKeys req;
-                for (const auto &member : members)
-                        req.device_keys[member] = {};
-
-                http::client()->query_keys(
-                  req,
-                  [keeper = std::move(keeper), megolm_payload, txn_id, this](
-                    const mtx::responses::QueryKeys &res, mtx::http::RequestErr err) {
-                          if (err) {
-                                  nhlog::net()->warn("failed to query device keys: {} {}",
-                                                     err->matrix_error.error,
-                                                     static_cast<int>(err->status_code));
+                auto keeper = std::make_shared<StateKeeper>(std::move(send));
+
+                // Only the users, whose devices changed since they were queried, are queried again.
+                olm::query_device_keys(
+                  members,
+                  [keeper      = std::move(keeper),
+                   shared_with = std::move(session_data.shared_with),
+                   megolm_payload,
+                   txn_id,
+                   this](olm::UserDevices devices, bool failed) mutable {
+                          if (failed) {
                                   // TODO: Mark the event as failed. Communicate with the UI.
                                   emit messageFailed(QString::fromStdString(txn_id));
                                   return;
                           }
 
-                          for (const auto &user : res.device_keys) {
-                                  // Mapping from a device_id with valid identity keys to the
-                                  // generated room_key event used for sharing the megolm session.
-                                  std::map<std::string, std::string> room_key_msgs;
-                                  std::map<std::string, DevicePublicKeys> deviceKeys;
-
-                                  room_key_msgs.clear();
-                                  deviceKeys.clear();
-
-                                  for (const auto &dev : user.second) {
-                                          const auto user_id   = ::UserId(dev.second.user_id);
-                                          const auto device_id = DeviceId(dev.second.device_id);
-
-                                          const auto device_keys = dev.second.keys;
-                                          const auto curveKey    = "curve25519:" + device_id.get();
-                                          const auto edKey       = "ed25519:" + device_id.get();
-
-                                          if ((device_keys.find(curveKey) == device_keys.end()) ||
-                                              (device_keys.find(edKey) == device_keys.end())) {
-                                                  nhlog::net()->debug(
-                                                    "ignoring malformed keys for device {}",
-                                                    device_id.get());
-                                                  continue;
-                                          }
-
-                                          DevicePublicKeys pks;
-                                          pks.ed25519    = device_keys.at(edKey);
-                                          pks.curve25519 = device_keys.at(curveKey);
-
-                                          try {
-                                                  if (!mtx::crypto::verify_identity_signature(
-                                                        json(dev.second), device_id, user_id)) {
-                                                          nhlog::crypto()->warn(
-                                                            "failed to verify identity keys: {}",
-                                                            json(dev.second).dump(2));
-                                                          continue;
-                                                  }
-                                          } catch (const json::exception &e) {
-                                                  nhlog::crypto()->warn(
-                                                    "failed to parse device key json: {}",
-                                                    e.what());
-                                                  continue;
-                                          } catch (const mtx::crypto::olm_exception &e) {
-                                                  nhlog::crypto()->warn(
-                                                    "failed to verify device key json: {}",
-                                                    e.what());
-                                                  continue;
-                                          }
-
-                                          auto room_key = olm::client()
-                                                            ->create_room_key_event(
-                                                              user_id, pks.ed25519, megolm_payload)
-                                                            .dump();
-
-                                          room_key_msgs.emplace(device_id, room_key);
-                                          deviceKeys.emplace(device_id, pks);
-                                  }
-
-                                  std::vector<std::string> valid_devices;
-                                  valid_devices.reserve(room_key_msgs.size());
-                                  for (auto const &d : room_key_msgs) {
-                                          valid_devices.push_back(d.first);
+                          std::size_t newDevices = 0;
+                          for (auto &[user_id, keys] : devices) {
+                                  if (auto shared = shared_with.find(user_id);
+                                      shared != shared_with.end())
+                                          for (const auto &device_id : shared->second)
+                                                  keys.erase(device_id);
+                                  newDevices += keys.size();
+                          }
 
-                                          nhlog::net()->info("{}", d.first);
-                                          nhlog::net()->info("  curve25519 {}",
-                                                             deviceKeys.at(d.first).curve25519);
-                                          nhlog::net()->info("  ed25519 {}",
-                                                             deviceKeys.at(d.first).ed25519);
-                                  }
+                          // The keeper sends the message right away.
+                          if (newDevices == 0)
+                                  return;
 
-                                  nhlog::net()->info(
-                                    "sending claim request for user {} with {} devices",
-                                    user.first,
-                                    valid_devices.size());
-
-                                  http::client()->claim_keys(
-                                    user.first,
-                                    valid_devices,
-                                    std::bind(&TimelineModel::handleClaimedKeys,
-                                              this,
-                                              keeper,
-                                              room_key_msgs,
-                                              deviceKeys,
-                                              user.first,
-                                              std::placeholders::_1,
-                                              std::placeholders::_2));
-
-                                  // TODO: Wait before sending the next batch of requests.
-                                  std::this_thread::sleep_for(std::chrono::milliseconds(500));
-                          }
+                          shareMegolmSession(
+                            std::move(keeper), megolm_payload, std::move(devices), txn_id);
                   });
 
                 // TODO: Let the user know about the errors.
@@ -1145,8 +2258,82 @@ TimelineModel::sendEncryptedMessage(const std::string &txn_id, nlohmann::json co
         }
 }
 
+void
+TimelineModel::shareMegolmSession(
+  std::shared_ptr<StateKeeper> keeper,
+  const nlohmann::json &megolm_payload,
+  std::map<std::string, std::map<std::string, DevicePublicKeys>> devices,
+  const std::string &txn_id)
+{
+        auto distribution        = std::make_shared<KeyDistribution>();
+        distribution->txn_id     = txn_id;
+        distribution->room_id    = megolm_payload.at("room_id");
+        distribution->session_id = megolm_payload.at("session_id");
+        for (auto &[user_id, keys] : devices)
+                if (!keys.empty())
+                        distribution->users.emplace_back(user_id, std::move(keys));
+        distribution->total     = distribution->users.size();
+        distribution->remaining = distribution->total;
+
+        nhlog::net()->info("claiming one-time keys of {} users", distribution->total);
+        emit keySharingProgress(
+          QString::fromStdString(txn_id), 0, static_cast<int>(distribution->total));
+
+        // Every claim starts the next one, when it finished. The keeper sends the message, once
+        // the room keys of all users were sent.
+        for (std::size_t i = 0; i < MAX_RUNNING_KEY_CLAIMS; i++)
+                claimNextKeys(keeper, megolm_payload, distribution);
+}
+
+void
+TimelineModel::claimNextKeys(std::shared_ptr<StateKeeper> keeper,
+                             const nlohmann::json &megolm_payload,
+                             std::shared_ptr<KeyDistribution> distribution)
+{
+        std::string user_id;
+        std::map<std::string, DevicePublicKeys> deviceKeys;
+        {
+                std::lock_guard<std::mutex> lock(distribution->mutex);
+                if (distribution->users.empty())
+                        return;
+
+                std::tie(user_id, deviceKeys) = std::move(distribution->users.front());
+                distribution->users.pop_front();
+        }
+
+        // Mapping from a device_id with valid identity keys to the
+        // generated room_key event used for sharing the megolm session.
+        std::map<std::string, std::string> room_key_msgs;
+        std::vector<std::string> valid_devices;
+        valid_devices.reserve(deviceKeys.size());
+        for (const auto &[device_id, pks] : deviceKeys) {
+                auto room_key =
+                  olm::client()
+                    ->create_room_key_event(::UserId(user_id), pks.ed25519, megolm_payload)
+                    .dump();
+
+                room_key_msgs.emplace(device_id, room_key);
+                valid_devices.push_back(device_id);
+        }
+
+        nhlog::net()->info(
+          "sending claim request for user {} with {} devices", user_id, valid_devices.size());
+
+        http::countRequest(http::Traffic::Keys);
+        http::client()->claim_keys(
+          user_id,
+          valid_devices,
+          [this, keeper, megolm_payload, distribution, room_key_msgs, deviceKeys, user_id](
+            const mtx::responses::ClaimKeys &res, mtx::http::RequestErr err) {
+                  handleClaimedKeys(
+                    keeper, distribution, room_key_msgs, deviceKeys, user_id, res, err);
+                  claimNextKeys(keeper, megolm_payload, distribution);
+          });
+}
+
 void
 TimelineModel::handleClaimedKeys(std::shared_ptr<StateKeeper> keeper,
+                                 std::shared_ptr<KeyDistribution> distribution,
                                  const std::map<std::string, std::string> &room_keys,
                                  const std::map<std::string, DevicePublicKeys> &pks,
                                  const std::string &user_id,
@@ -1158,76 +2345,153 @@ TimelineModel::handleClaimedKeys(std::shared_ptr<StateKeeper> keeper,
                                    err->matrix_error.error,
                                    err->parse_error,
                                    static_cast<int>(err->status_code));
+                finishKeyDistribution(keeper, distribution, user_id, json::object());
                 return;
         }
 
         nhlog::net()->debug("claimed keys for {}", user_id);
 
-        if (res.one_time_keys.size() == 0) {
-                nhlog::net()->debug("no one-time keys found for user_id: {}", user_id);
-                return;
-        }
-
         if (res.one_time_keys.find(user_id) == res.one_time_keys.end()) {
                 nhlog::net()->debug("no one-time keys found for user_id: {}", user_id);
+                finishKeyDistribution(keeper, distribution, user_id, json::object());
                 return;
         }
 
-        auto retrieved_devices = res.one_time_keys.at(user_id);
+        // Creating the olm sessions is the expensive part, so the users are encrypted for in
+        // parallel.
+        QtConcurrent::run(
+          keySharingPool(),
+          [this, keeper, distribution, room_keys, pks, user_id, res]() {
+                  cache::LatencyTimer timer(NHEKO_METRIC("share keys with user"));
+                  const auto &retrieved_devices = res.one_time_keys.at(user_id);
+                  cache::recordCount(NHEKO_METRIC("share keys devices"), retrieved_devices.size());
+
+                  // The to_device messages for the devices of the user.
+                  json messages = json::object();
+                  for (const auto &rd : retrieved_devices) {
+                          const auto device_id = rd.first;
+                          nhlog::net()->debug("{} : \n {}", device_id, rd.second.dump(2));
+
+                          if (pks.find(device_id) == pks.end()) {
+                                  nhlog::net()->critical("couldn't find public key for device: {}",
+                                                         device_id);
+                                  continue;
+                          }
 
-        // Payload with all the to_device message to be sent.
-        json body;
-        body["messages"][user_id] = json::object();
+                          if (room_keys.find(device_id) == room_keys.end()) {
+                                  nhlog::net()->critical("couldn't find m.room_key for device: {}",
+                                                         device_id);
+                                  continue;
+                          }
 
-        for (const auto &rd : retrieved_devices) {
-                const auto device_id = rd.first;
-                nhlog::net()->debug("{} : \n {}", device_id, rd.second.dump(2));
+                          try {
+                                  // TODO: Verify signatures
+                                  auto otk = rd.second.begin()->at("key");
 
-                // TODO: Verify signatures
-                auto otk = rd.second.begin()->at("key");
+                                  auto id_key = pks.at(device_id).curve25519;
+                                  auto s      = olm::client()->create_outbound_session(id_key, otk);
 
-                if (pks.find(device_id) == pks.end()) {
-                        nhlog::net()->critical("couldn't find public key for device: {}",
-                                               device_id);
-                        continue;
-                }
+                                  messages[device_id] = olm::client()->create_olm_encrypted_content(
+                                    s.get(), room_keys.at(device_id), id_key);
 
-                auto id_key = pks.at(device_id).curve25519;
-                auto s      = olm::client()->create_outbound_session(id_key, otk);
+                                  cache::saveOlmSession(id_key, std::move(s));
+                          } catch (const lmdb::error &e) {
+                                  nhlog::db()->critical("failed to save outbound olm session: {}",
+                                                        e.what());
+                          } catch (const mtx::crypto::olm_exception &e) {
+                                  nhlog::crypto()->critical(
+                                    "failed to create outbound olm session: {}", e.what());
+                          } catch (const json::exception &e) {
+                                  nhlog::crypto()->critical(
+                                    "failed to parse one-time key of {}: {}", device_id, e.what());
+                          }
+                  }
 
-                if (room_keys.find(device_id) == room_keys.end()) {
-                        nhlog::net()->critical("couldn't find m.room_key for device: {}",
-                                               device_id);
-                        continue;
-                }
+                  finishKeyDistribution(keeper, distribution, user_id, std::move(messages));
+          });
+}
 
-                auto device_msg = olm::client()->create_olm_encrypted_content(
-                  s.get(), room_keys.at(device_id), pks.at(device_id).curve25519);
+void
+TimelineModel::finishKeyDistribution(std::shared_ptr<StateKeeper> keeper,
+                                     std::shared_ptr<KeyDistribution> distribution,
+                                     const std::string &user_id,
+                                     json messages)
+{
+        const bool failed = messages.empty();
 
-                try {
-                        cache::saveOlmSession(id_key, std::move(s));
-                } catch (const lmdb::error &e) {
-                        nhlog::db()->critical("failed to save outbound olm session: {}", e.what());
-                } catch (const mtx::crypto::olm_exception &e) {
-                        nhlog::crypto()->critical("failed to pickle outbound olm session: {}",
-                                                  e.what());
+        json batch             = json::object();
+        std::size_t batchUsers = 0, finished = 0;
+        {
+                std::lock_guard<std::mutex> lock(distribution->mutex);
+                distribution->remaining--;
+
+                if (failed) {
+                        distribution->finished++;
+                } else {
+                        distribution->batchBytes += messages.dump().size();
+                        distribution->batchUsers++;
+                        distribution->batch[user_id] = std::move(messages);
                 }
 
-                body["messages"][user_id][device_id] = device_msg;
+                if (distribution->batchBytes >= TO_DEVICE_BATCH_BYTES ||
+                    (distribution->remaining == 0 && distribution->batchUsers > 0)) {
+                        batch.swap(distribution->batch);
+                        batchUsers               = distribution->batchUsers;
+                        distribution->batchUsers = 0;
+                        distribution->batchBytes = 0;
+                }
+
+                finished = distribution->finished;
+        }
+
+        if (batchUsers == 0) {
+                if (failed)
+                        emit keySharingProgress(QString::fromStdString(distribution->txn_id),
+                                                static_cast<int>(finished),
+                                                static_cast<int>(distribution->total));
+                return;
         }
 
-        nhlog::net()->info("send_to_device: {}", user_id);
+        nhlog::net()->info("send_to_device: room key for {} users", batchUsers);
+
+        std::map<std::string, std::set<std::string>> recipients;
+        for (const auto &[user_id, devices] : batch.items())
+                for (const auto &device : devices.items())
+                        recipients[user_id].insert(device.key());
 
+        http::countRequest(http::Traffic::Keys);
         http::client()->send_to_device(
-          "m.room.encrypted", body, [keeper](mtx::http::RequestErr err) {
+          "m.room.encrypted",
+          json{{"messages", std::move(batch)}},
+          [this, keeper, distribution, batchUsers, recipients = std::move(recipients)](
+            mtx::http::RequestErr err) {
                   if (err) {
                           nhlog::net()->warn("failed to send "
                                              "send_to_device "
                                              "message: {}",
                                              err->matrix_error.error);
+                  } else {
+                          try {
+                                  cache::addOutboundMegolmSessionRecipients(
+                                    distribution->room_id, distribution->session_id, recipients);
+                          } catch (const lmdb::error &e) {
+                                  nhlog::db()->warn("failed to save the recipients of {}: {}",
+                                                    distribution->session_id,
+                                                    e.what());
+                          }
+                  }
+
+                  std::size_t finished = 0;
+                  {
+                          std::lock_guard<std::mutex> lock(distribution->mutex);
+                          distribution->finished += batchUsers;
+                          finished = distribution->finished;
                   }
 
-                  (void)keeper;
+                  // The keeper sends the message, once the last batch finished.
+                  emit keySharingProgress(QString::fromStdString(distribution->txn_id),
+                                          static_cast<int>(finished),
+                                          static_cast<int>(distribution->total));
           });
 }
 
@@ -1251,6 +2515,8 @@ struct SendMessageVisitor
                         auto encInfo = mtx::accessors::file(msg);
                         if (encInfo)
                                 emit model_->newEncryptedImage(encInfo.value());
+                        if (auto thumbnail = mtx::accessors::thumbnail_file(msg))
+                                emit model_->newEncryptedImage(thumbnail.value());
 
                         model_->sendEncryptedMessage(txn_id_qstr_.toStdString(),
                                                      nlohmann::json(msg.content));
@@ -1271,6 +2537,7 @@ struct SendMessageVisitor
                                                              err->matrix_error.error,
                                                              status_code);
                                           emit model->messageFailed(txn_id_qstr);
+                                          return;
                                   }
                                   emit model->messageSent(
                                     txn_id_qstr, QString::fromStdString(res.event_id.to_string()));
@@ -1283,15 +2550,48 @@ struct SendMessageVisitor
 };
 
 void
-TimelineModel::processOnePendingMessage()
+TimelineModel::sendPendingMessages()
 {
-        if (pending.isEmpty())
+        // Messages after a failed one wait for its retry, so they don't overtake it.
+        if (!waitingForRetry_.isEmpty())
+                return;
+
+        const auto room_id   = room_id_.toStdString();
+        const bool encrypted = cache::isRoomEncrypted(room_id);
+
+        // The megolm session is shared with all members, also those the syncs don't contain.
+        if (encrypted && !membersLoaded_) {
+                if (!pending.isEmpty())
+                        loadMembers();
                 return;
+        }
+
+        // Every message would share its own new megolm session, so the first message of an
+        // encrypted room, or the first one after the session is due for rotation, is sent
+        // alone. The next ones wait until its session was shared, so the recipients can decrypt
+        // them right away.
+        int window = sendWindow_;
+        if (!sharingKeys_.isEmpty())
+                window = 1;
+        else if (encrypted && window > 1 && pending.size() > 1 &&
+                 (!cache::outboundMegolmSessionExists(room_id) ||
+                  megolmRotationReason(cache::getOutboundMegolmSession(room_id).data,
+                                       cache::roomMembers(room_id))))
+                window = 1;
+
+        // Started in the order they were queued. Failures may change the queue meanwhile.
+        const auto queue = pending;
+        for (const auto &txn_id : queue) {
+                if (sending_.size() >= window || !waitingForRetry_.isEmpty())
+                        break;
+                if (sending_.contains(txn_id))
+                        continue;
 
-        QString txn_id_qstr = pending.first();
+                sending_[txn_id].start();
 
-        auto event = events.value(txn_id_qstr);
-        std::visit(SendMessageVisitor{txn_id_qstr, this}, event);
+                auto event = events.value(txn_id);
+                std::visit(SendMessageVisitor{txn_id, this}, event);
+        }
 }
 
 void
@@ -1306,20 +2606,100 @@ TimelineModel::addPendingMessage(mtx::events::collections::TimelineEvents event)
           },
           event);
 
+        // Stored before it is sent, so it is sent again after a restart, if it is lost.
+        cache::saveOutboxMessage(room_id_.toStdString(), event);
+
+        // It is shown below the newest events.
+        showLatest();
+
         internalAddEvents({event});
 
         QString txn_id_qstr = QString::fromStdString(mtx::accessors::event_id(event));
         beginInsertRows(QModelIndex(), 0, 0);
         pending.push_back(txn_id_qstr);
-        this->eventOrder.insert(this->eventOrder.begin(), txn_id_qstr);
+        this->events.prepend({txn_id_qstr});
+        endInsertRows();
+        updateLastMessage();
+
+        sendPendingMessages();
+}
+
+void
+TimelineModel::restoreOutbox()
+{
+        std::vector<mtx::events::collections::TimelineEvents> messages;
+        for (auto &message : cache::outboxMessages(room_id_.toStdString())) {
+                // Keyed by transaction id, so every message is queued only once.
+                const auto txn_id = QString::fromStdString(mtx::accessors::event_id(message));
+                if (!events.contains(txn_id))
+                        messages.push_back(std::move(message));
+        }
+
+        if (messages.empty())
+                return;
+
+        nhlog::ui()->info("restoring {} unsent messages of {}",
+                          messages.size(),
+                          room_id_.toStdString());
+
+        auto ids = internalAddEvents(messages);
+        if (ids.empty())
+                return;
+
+        beginInsertRows(QModelIndex(), 0, static_cast<int>(ids.size()) - 1);
+        for (const auto &id : ids)
+                pending.push_back(id);
+        events.prepend(ids);
         endInsertRows();
         updateLastMessage();
 
-        emit nextPendingMessage();
+        sendPendingMessages();
+}
+
+void
+TimelineModel::loadMembers()
+{
+        if (membersLoaded_ || loadingMembers_)
+                return;
+
+        loadingMembers_ = true;
+
+        const auto room_id = room_id_.toStdString();
+        http::client()->members(
+          room_id, [this, room_id](const mtx::responses::Members &res, mtx::http::RequestErr err) {
+                  if (err) {
+                          nhlog::net()->warn("failed to retrieve the members of {}: {}",
+                                             room_id,
+                                             err->matrix_error.error);
+                          emit membersRetrieved();
+                          return;
+                  }
+
+                  try {
+                          cache::saveMembers(room_id, res.chunk);
+                  } catch (const lmdb::error &e) {
+                          nhlog::db()->warn(
+                            "failed to save the members of {}: {}", room_id, e.what());
+                  }
+
+                  nhlog::net()->debug("retrieved {} members of {}", res.chunk.size(), room_id);
+                  emit membersRetrieved();
+          });
+}
+
+void
+TimelineModel::resendPendingMessages()
+{
+        if (pending.isEmpty())
+                return;
+
+        // The retry timers of the failed messages find nothing to wait for anymore.
+        waitingForRetry_.clear();
+        sendPendingMessages();
 }
 
 bool
-TimelineModel::saveMedia(QString eventId) const
+TimelineModel::saveMedia(QString eventId)
 {
         mtx::events::collections::TimelineEvents event = events.value(eventId);
 
@@ -1358,42 +2738,66 @@ TimelineModel::saveMedia(QString eventId) const
         if (filename.isEmpty())
                 return false;
 
-        const auto url = mxcUrl.toStdString();
+        // The file is streamed to disk, so large files don't have to fit into memory.
+        auto download = new MediaDownload(mxcUrl, filename, encryptionInfo);
+        connect(download,
+                &MediaDownload::progress,
+                this,
+                [this, mxcUrl](qint64 received, qint64 total) {
+                        emit mediaProgress(mxcUrl, received, total);
+                });
+        download->start();
 
-        http::client()->download(
-          url,
-          [filename, url, encryptionInfo](const std::string &data,
-                                          const std::string &,
-                                          const std::string &,
-                                          mtx::http::RequestErr err) {
-                  if (err) {
-                          nhlog::net()->warn("failed to retrieve image {}: {} {}",
-                                             url,
-                                             err->matrix_error.error,
-                                             static_cast<int>(err->status_code));
-                          return;
-                  }
+        return true;
+}
 
-                  try {
-                          auto temp = data;
-                          if (encryptionInfo)
-                                  temp = mtx::crypto::to_string(
-                                    mtx::crypto::decrypt_file(temp, encryptionInfo.value()));
+void
+TimelineModel::prefetchMedia(int first,
+                             int last,
+                             int avatarSize,
+                             int mediaWidth,
+                             int mediaMaxHeight)
+{
+        // The room, which is opened next, is prefetched with the same layout.
+        manager_->setMediaLayout(avatarSize, mediaWidth, mediaMaxHeight);
 
-                          QFile file(filename);
+        first = std::max(first, 0);
+        last  = std::min(last, static_cast<int>(events.size()) - 1);
 
-                          if (!file.open(QIODevice::WriteOnly))
-                                  return;
+        std::vector<std::pair<QString, QSize>> images;
+        QSet<QString> senders;
+        for (int i = first; i <= last; i++) {
+                const auto &row = displayRow(events.idAt(i));
 
-                          file.write(QByteArray(temp.data(), (int)temp.size()));
-                          file.close();
+                if (!senders.contains(row.userId)) {
+                        senders.insert(row.userId);
+                        images.emplace_back(avatarUrl(row.userId),
+                                            manager_->imageSourceSize(avatarSize, avatarSize));
+                }
 
-                          return;
-                  } catch (const std::exception &e) {
-                          nhlog::ui()->warn("Error while saving file to: {}", e.what());
-                  }
-          });
-        return true;
+                // Laid out like the delegates do, the width of the timeline is only an estimate
+                // of theirs, but usually rounds to the same size.
+                if (row.type == qml_mtx_events::ImageMessage ||
+                    row.type == qml_mtx_events::Sticker) {
+                        double width = row.width < 1 ? mediaWidth
+                                                     : std::min<double>(mediaWidth, row.width);
+                        if (width * row.proportionalHeight > mediaMaxHeight)
+                                width = mediaMaxHeight / row.proportionalHeight;
+                        // The delegates show the thumbnail, if the sender uploaded one.
+                        images.emplace_back(
+                          row.thumbnailUrl.isEmpty() ? row.url : row.thumbnailUrl,
+                          manager_->imageSourceSize(width, width * row.proportionalHeight));
+                } else if (row.type == qml_mtx_events::VideoMessage &&
+                           !row.thumbnailUrl.isEmpty()) {
+                        const double width =
+                          std::min<double>(mediaWidth, row.width ? row.width : 400);
+                        images.emplace_back(
+                          row.thumbnailUrl,
+                          manager_->imageSourceSize(width, width * row.proportionalHeight));
+                }
+        }
+
+        manager_->imageProvider()->prefetch(images);
 }
 
 void
@@ -1420,61 +2824,56 @@ TimelineModel::cacheMedia(QString eventId)
 
         QString suffix = QMimeDatabase().mimeTypeForName(mimeType).preferredSuffix();
 
-        const auto url = mxcUrl.toStdString();
-        QFileInfo filename(QString("%1/media_cache/%2.%3")
-                             .arg(QStandardPaths::writableLocation(QStandardPaths::CacheLocation))
-                             .arg(QString(mxcUrl).remove("mxc://"))
-                             .arg(suffix));
-        if (QDir::cleanPath(filename.path()) != filename.path()) {
-                nhlog::net()->warn("mxcUrl '{}' is not safe, not downloading file", url);
-                return;
-        }
-
-        QDir().mkpath(filename.path());
+        // Share the entry of the full size image with the MxcImageProvider.
+        const auto cacheKey = QString(mxcUrl).remove("mxc://");
+        const auto url      = mxcUrl.toStdString();
 
-        if (filename.isReadable()) {
-                emit mediaCached(mxcUrl, filename.filePath());
+        // Files are played and opened by their suffix, so only reuse a file with the right one.
+        if (auto path = cache::mediaPath(cacheKey);
+            !path.isEmpty() && QFileInfo(path).suffix() == suffix) {
+                emit mediaCached(mxcUrl, path);
                 return;
         }
 
-        http::client()->download(
-          url,
-          [this, mxcUrl, filename, url, encryptionInfo](const std::string &data,
-                                                        const std::string &,
-                                                        const std::string &,
-                                                        mtx::http::RequestErr err) {
-                  if (err) {
-                          nhlog::net()->warn("failed to retrieve image {}: {} {}",
-                                             url,
-                                             err->matrix_error.error,
-                                             static_cast<int>(err->status_code));
-                          return;
-                  }
-
-                  try {
-                          auto temp = data;
-                          if (encryptionInfo)
-                                  temp = mtx::crypto::to_string(
-                                    mtx::crypto::decrypt_file(temp, encryptionInfo.value()));
-
-                          QFile file(filename.filePath());
-
-                          if (!file.open(QIODevice::WriteOnly))
-                                  return;
-
-                          file.write(QByteArray(temp.data(), temp.size()));
-                          file.close();
-                  } catch (const std::exception &e) {
-                          nhlog::ui()->warn("Error while saving file to: {}", e.what());
-                  }
-
-                  emit mediaCached(mxcUrl, filename.filePath());
-          });
+        auto download =
+          new MediaDownload(mxcUrl, cache::mediaFileFor(cacheKey, suffix), encryptionInfo);
+        connect(download,
+                &MediaDownload::progress,
+                this,
+                [this, mxcUrl](qint64 received, qint64 total) {
+                        emit mediaProgress(mxcUrl, received, total);
+                });
+        connect(download,
+                &MediaDownload::finished,
+                this,
+                [this, mxcUrl, cacheKey, suffix](QString, qint64 size) {
+                        // Adding the file may evict other media, which shouldn't block the UI.
+                        requestsInFlight_++;
+                        QtConcurrent::run([this, mxcUrl, cacheKey, suffix, size]() {
+                                auto path = cache::addMediaFile(cacheKey, suffix, size);
+                                if (!path.isEmpty())
+                                        emit mediaCached(mxcUrl, path);
+                                requestsInFlight_--;
+                        });
+                });
+        download->start();
 }
 
 QString
 TimelineModel::formatTypingUsers(const std::vector<QString> &users, QColor bg)
 {
+        if (users.empty())
+                return "";
+
+        QStringList key;
+        for (const auto &user : users)
+                key.append(user);
+        key.append(bg.name(QColor::HexArgb));
+        const auto cacheKey = key.join('\n');
+
+        if (auto cached = formattedTyping_.object(cacheKey))
+                return *cached;
+
         QString temp =
           tr("%1 and %2 are typing.",
              "Multiple users are typing. First argument is a comma separated list of potentially "
@@ -1483,10 +2882,6 @@ TimelineModel::formatTypingUsers(const std::vector<QString> &users, QColor bg)
              "warnings.)",
              users.size());
 
-        if (users.empty()) {
-                return "";
-        }
-
         QStringList uidWithoutLast;
 
         auto formatUser = [this, bg](const QString &user_id) -> QString {
@@ -1525,17 +2920,46 @@ TimelineModel::formatTypingUsers(const std::vector<QString> &users, QColor bg)
                 uidWithoutLast.append(formatUser(users[i]));
         }
 
-        return temp.arg(uidWithoutLast.join(", ")).arg(formatUser(users.back()));
+        const auto formatted = temp.arg(uidWithoutLast.join(", ")).arg(formatUser(users.back()));
+        formattedTyping_.insert(cacheKey, new QString(formatted), 1);
+        return formatted;
+}
+
+QString
+TimelineModel::formatMemoized(const QString &id, QString (TimelineModel::*render)(const QString &))
+{
+        if (auto cached = formattedEvents_.object(id))
+                return *cached;
+
+        // Empty results aren't cached, the event may just not be loaded yet.
+        auto formatted = (this->*render)(id);
+        if (!formatted.isEmpty())
+                formattedEvents_.insert(id, new QString(formatted), 1);
+
+        return formatted;
+}
+
+void
+TimelineModel::invalidateRow(const QString &id)
+{
+        displayRows_.remove(id);
+        formattedEvents_.remove(id);
 }
 
 QString
 TimelineModel::formatJoinRuleEvent(QString id)
+{
+        return formatMemoized(id, &TimelineModel::renderJoinRuleEvent);
+}
+
+QString
+TimelineModel::renderJoinRuleEvent(const QString &id)
 {
         if (!events.contains(id))
                 return "";
 
-        auto event =
-          std::get_if<mtx::events::StateEvent<mtx::events::state::JoinRules>>(&events[id]);
+        auto ev    = events.value(id);
+        auto event = std::get_if<mtx::events::StateEvent<mtx::events::state::JoinRules>>(&ev);
         if (!event)
                 return "";
 
@@ -1555,12 +2979,18 @@ TimelineModel::formatJoinRuleEvent(QString id)
 
 QString
 TimelineModel::formatGuestAccessEvent(QString id)
+{
+        return formatMemoized(id, &TimelineModel::renderGuestAccessEvent);
+}
+
+QString
+TimelineModel::renderGuestAccessEvent(const QString &id)
 {
         if (!events.contains(id))
                 return "";
 
-        auto event =
-          std::get_if<mtx::events::StateEvent<mtx::events::state::GuestAccess>>(&events[id]);
+        auto ev    = events.value(id);
+        auto event = std::get_if<mtx::events::StateEvent<mtx::events::state::GuestAccess>>(&ev);
         if (!event)
                 return "";
 
@@ -1579,12 +3009,19 @@ TimelineModel::formatGuestAccessEvent(QString id)
 
 QString
 TimelineModel::formatHistoryVisibilityEvent(QString id)
+{
+        return formatMemoized(id, &TimelineModel::renderHistoryVisibilityEvent);
+}
+
+QString
+TimelineModel::renderHistoryVisibilityEvent(const QString &id)
 {
         if (!events.contains(id))
                 return "";
 
+        auto ev = events.value(id);
         auto event =
-          std::get_if<mtx::events::StateEvent<mtx::events::state::HistoryVisibility>>(&events[id]);
+          std::get_if<mtx::events::StateEvent<mtx::events::state::HistoryVisibility>>(&ev);
 
         if (!event)
                 return "";
@@ -1613,12 +3050,18 @@ TimelineModel::formatHistoryVisibilityEvent(QString id)
 
 QString
 TimelineModel::formatPowerLevelEvent(QString id)
+{
+        return formatMemoized(id, &TimelineModel::renderPowerLevelEvent);
+}
+
+QString
+TimelineModel::renderPowerLevelEvent(const QString &id)
 {
         if (!events.contains(id))
                 return "";
 
-        auto event =
-          std::get_if<mtx::events::StateEvent<mtx::events::state::PowerLevels>>(&events[id]);
+        auto ev    = events.value(id);
+        auto event = std::get_if<mtx::events::StateEvent<mtx::events::state::PowerLevels>>(&ev);
         if (!event)
                 return "";
 
@@ -1631,38 +3074,34 @@ TimelineModel::formatPowerLevelEvent(QString id)
 
 QString
 TimelineModel::formatMemberEvent(QString id)
+{
+        return formatMemoized(id, &TimelineModel::renderMemberEvent);
+}
+
+QString
+TimelineModel::renderMemberEvent(const QString &id)
 {
         if (!events.contains(id))
                 return "";
 
-        auto event = std::get_if<mtx::events::StateEvent<mtx::events::state::Member>>(&events[id]);
+        auto ev    = events.value(id);
+        auto event = std::get_if<mtx::events::StateEvent<mtx::events::state::Member>>(&ev);
         if (!event)
                 return "";
 
+        mtx::events::collections::TimelineEvents prevEv;
         mtx::events::StateEvent<mtx::events::state::Member> *prevEvent = nullptr;
         QString prevEventId = QString::fromStdString(event->unsigned_data.replaces_state);
         if (!prevEventId.isEmpty()) {
                 if (!events.contains(prevEventId)) {
-                        http::client()->get_event(
-                          this->room_id_.toStdString(),
-                          event->unsigned_data.replaces_state,
-                          [this, id, prevEventId](
-                            const mtx::events::collections::TimelineEvents &timeline,
-                            mtx::http::RequestErr err) {
-                                  if (err) {
-                                          nhlog::net()->error(
-                                            "Failed to retrieve event with id {}, which was "
-                                            "requested to show the membership for event {}",
-                                            prevEventId.toStdString(),
-                                            id.toStdString());
-                                          return;
-                                  }
-                                  emit eventFetched(id, timeline);
-                          });
-                } else {
+                        if (auto fetched = fetcher_.fetch(event->unsigned_data.replaces_state, id))
+                                events.insert(prevEventId, *fetched);
+                }
+
+                if (events.contains(prevEventId)) {
+                        prevEv    = events.value(prevEventId);
                         prevEvent =
-                          std::get_if<mtx::events::StateEvent<mtx::events::state::Member>>(
-                            &events[prevEventId]);
+                          std::get_if<mtx::events::StateEvent<mtx::events::state::Member>>(&prevEv);
                 }
         }
 
@@ -1738,3 +3177,52 @@ TimelineModel::formatMemberEvent(QString id)
 
         return rendered;
 }
+
+QString
+TimelineModel::formatMemberRun(QString id)
+{
+        auto run = memberRuns_.constFind(id);
+        if (run == memberRuns_.constEnd())
+                return formatMemberEvent(id);
+
+        int joined = 0, left = 0, invited = 0, banned = 0, knocked = 0;
+        for (const auto &member : run.value()) {
+                auto ev    = events.value(member);
+                auto event = std::get_if<mtx::events::StateEvent<mtx::events::state::Member>>(&ev);
+                if (!event)
+                        continue;
+
+                using namespace mtx::events::state;
+                switch (event->content.membership) {
+                case Membership::Join:
+                        joined++;
+                        break;
+                case Membership::Leave:
+                        left++;
+                        break;
+                case Membership::Invite:
+                        invited++;
+                        break;
+                case Membership::Ban:
+                        banned++;
+                        break;
+                case Membership::Knock:
+                        knocked++;
+                        break;
+                }
+        }
+
+        QStringList parts;
+        if (joined)
+                parts << tr("%n user(s) joined", "", joined);
+        if (left)
+                parts << tr("%n left", "", left);
+        if (invited)
+                parts << tr("%n were invited", "", invited);
+        if (banned)
+                parts << tr("%n were banned", "", banned);
+        if (knocked)
+                parts << tr("%n knocked", "", knocked);
+
+        return parts.join(", ") + ".";
+}
@@ -1,14 +1,26 @@
 #pragma once
 
+#include <atomic>
+#include <deque>
+#include <set>
+#include <unordered_map>
+
 #include <QAbstractListModel>
+#include <QCache>
 #include <QColor>
 #include <QDate>
+#include <QDateTime>
+#include <QElapsedTimer>
 #include <QHash>
 #include <QSet>
 
 #include <mtxclient/http/errors.hpp>
 
 #include "CacheCryptoStructs.h"
+#include "CacheStructs.h"
+#include "EventFetcher.h"
+#include "EventStore.h"
+#include "ReadMarker.h"
 
 namespace mtx::http {
 using RequestErr = const std::optional<mtx::http::ClientError> &;
@@ -19,6 +31,7 @@ struct Messages;
 struct ClaimKeys;
 }
 struct RelatedInfo;
+struct KeyDistribution;
 
 namespace qml_mtx_events {
 Q_NAMESPACE
@@ -112,6 +125,52 @@ struct DecryptionResult
         mtx::events::collections::TimelineEvents event;
         //! Whether or not the decryption was successful.
         bool isDecrypted = false;
+        //! The megolm session of the event wasn't received yet.
+        bool missingSession = false;
+        //! The decryption failed for a reason, which may go away, e.g. the db access failed, so
+        //! it is tried again later.
+        bool transient = false;
+};
+
+//! The values of an event, as the timeline shows them.
+struct DisplayRow
+{
+        QString userId;
+        QString userName;
+        QDateTime timestamp;
+        qml_mtx_events::EventType type = qml_mtx_events::Unsupported;
+        QString typeString;
+        QString body;
+        QString formattedBody;
+        QString url;
+        QString thumbnailUrl;
+        QString blurhash;
+        QString filename;
+        QString filesize;
+        QString mimetype;
+        qulonglong height         = 0;
+        qulonglong width          = 0;
+        double proportionalHeight = 1.;
+        bool isEncrypted          = false;
+        //! Whether the local user sent it.
+        bool isOwn = false;
+        QString replyTo;
+        QString roomId;
+        QString roomName;
+        QString roomTopic;
+};
+
+//! Rough estimates of the memory used by a timeline, in bytes.
+struct TimelineMemoryUsage
+{
+        //! The stored events, parsed and raw.
+        std::size_t events = 0;
+        //! The cache of the decrypted events.
+        std::size_t decrypted = 0;
+        //! The cache of the values of the rows shown.
+        std::size_t rows = 0;
+
+        std::size_t total() const { return events + decrypted + rows; }
 };
 
 class TimelineViewManager;
@@ -132,6 +191,7 @@ public:
 
         enum Roles
         {
+                //! The key of the day and sender of the row, see EventStore::sectionKeyAt.
                 Section,
                 Type,
                 TypeString,
@@ -156,6 +216,11 @@ public:
                 RoomId,
                 RoomName,
                 RoomTopic,
+                //! The number of member events, which the row represents.
+                CollapsedCount,
+                //! The timestamp, sender and avatar of the event and whether it is the first of
+                //! its day, as shown by a section header.
+                SectionHeader,
                 Dump,
         };
 
@@ -172,6 +237,8 @@ public:
         Q_INVOKABLE QString formatDateSeparator(QDate date) const;
         Q_INVOKABLE QString formatTypingUsers(const std::vector<QString> &users, QColor bg);
         Q_INVOKABLE QString formatMemberEvent(QString id);
+        //! A summary of the member events, which a row represents, e.g. "12 users joined, 3 left."
+        Q_INVOKABLE QString formatMemberRun(QString id);
         Q_INVOKABLE QString formatJoinRuleEvent(QString id);
         Q_INVOKABLE QString formatHistoryVisibilityEvent(QString id);
         Q_INVOKABLE QString formatGuestAccessEvent(QString id);
@@ -186,11 +253,63 @@ public:
         Q_INVOKABLE void redactEvent(QString id);
         Q_INVOKABLE int idToIndex(QString id) const;
         Q_INVOKABLE QString indexToId(int index) const;
+        //! Scroll to an event. If it isn't loaded, the rows are replaced by the events around it,
+        //! from the cache or a single /context request, instead of paginating all the way there.
+        Q_INVOKABLE void showEvent(QString id);
+        //! Show the newest events again, after a jump to an older event.
+        Q_INVOKABLE void showLatest();
+        //! Replace the rows by the newest stored events, e.g. when more events arrived, than are
+        //! worth adding one by one.
+        void reloadFromCache();
+        //! Show the member events, which a row represents, as rows of their own.
+        Q_INVOKABLE void expandMemberRun(QString id);
+        //! Remember the position of the timeline, so it is shown again, when the room is opened
+        //! again: the lowest visible event and how far it reaches below the view. An empty
+        //! anchor means the newest events.
+        Q_INVOKABLE void saveViewport(QString anchorId, double offset)
+        {
+                viewportAnchor_ = anchorId;
+                viewportOffset_ = offset;
+        }
+        Q_INVOKABLE QString viewportAnchor() const { return viewportAnchor_; }
+        Q_INVOKABLE double viewportOffset() const { return viewportOffset_; }
         Q_INVOKABLE void cacheMedia(QString eventId);
-        Q_INVOKABLE bool saveMedia(QString eventId) const;
+        Q_INVOKABLE bool saveMedia(QString eventId);
+        //! Fetch the avatars and images of the rows first to last, which will be shown next, with
+        //! a low priority. Called by the timeline, when it scrolls.
+        Q_INVOKABLE void prefetchMedia(int first,
+                                       int last,
+                                       int avatarSize,
+                                       int mediaWidth,
+                                       int mediaMaxHeight);
+
+        //! Prepare the room to be opened: restore its newest events from the cache in the thread
+        //! pool and start decrypting them and fetching their media. Nothing is requested from
+        //! the server.
+        void warmUp();
+        QString roomId() const { return room_id_; }
 
         void updateLastMessage();
+        //! Show the newest message of a room without a model in the room list.
+        static void updateLastMessage(TimelineViewManager *manager,
+                                      const QString &room_id,
+                                      const mtx::responses::Timeline &timeline,
+                                      bool decrypt);
+        //! Decrypt an event, unless its plaintext was kept, and keep and index the plaintext for
+        //! the timeline and the search. Can run on any thread.
+        static DecryptionResult decryptAndKeep(
+          const std::string &room_id,
+          const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e);
         void addEvents(const mtx::responses::Timeline &events);
+        //! Add the receipts of a sync, event_id -> {user_id -> timestamp}.
+        void updateReceipts(const std::map<std::string, std::map<std::string, uint64_t>> &receipts);
+        //! Rough estimate of the memory used by the events and caches of the room, in bytes.
+        std::size_t memoryUsage() const { return memoryBreakdown().total(); }
+        TimelineMemoryUsage memoryBreakdown() const;
+        //! Whether messages or requests of the room are in flight, so the model has to stay.
+        bool isBusy() const;
+        //! How many events of the room are decrypted in the background right now.
+        int decryptQueue() const { return static_cast<int>(decrypting_.size()); }
         template<class T>
         void sendMessage(const T &msg);
         RelatedInfo relatedInfo(QString id);
@@ -199,6 +318,8 @@ public slots:
         void setCurrentIndex(int index);
         int currentIndex() const { return idToIndex(currentId); }
         void markEventsAsRead(const std::vector<QString> &event_ids);
+        //! Decrypt the events again, which waited for one of the sessions.
+        void receivedInboundMegolmSessions(const QStringList &session_ids);
         QVariantMap getDump(QString eventId) const;
         void updateTypingUsers(const std::vector<QString> &users)
         {
@@ -225,53 +346,232 @@ public slots:
                 }
         }
         void setDecryptDescription(bool decrypt) { decryptDescription = decrypt; }
+        //! Recompute the display values of all events, e.g. after the theme changed.
+        void clearDisplayRows() { displayRows_.clear(); }
+        //! Send the pending messages right away, e.g. when the connection came back, instead of
+        //! waiting for the delay of a failed message.
+        void resendPendingMessages();
+        //! Retrieve the members of the room once, because the syncs only contain the senders of
+        //! the events.
+        void loadMembers();
 
 private slots:
-        // Add old events at the top of the timeline.
-        void addBackwardsEvents(const mtx::responses::Messages &msgs);
-        void processOnePendingMessage();
+        // Add old events at the top of the timeline. If they reached stored events, the next page
+        // is restored from the cache again.
+        void addBackwardsEvents(const mtx::responses::Messages &msgs, bool connected);
+        //! Send the pending messages in order, as long as the window of requests isn't full.
+        void sendPendingMessages();
         void addPendingMessage(mtx::events::collections::TimelineEvents event);
 
 signals:
-        void oldMessagesRetrieved(const mtx::responses::Messages &res);
+        void oldMessagesRetrieved(const mtx::responses::Messages &res, bool connected);
+        //! The view should scroll to the row.
+        void scrollToIndex(int index);
+        //! Emitted from the network thread, when the events around an event were stored, or
+        //! couldn't be retrieved.
+        void contextRetrieved(QString id, bool stored);
+        //! Emitted from the network thread, when a page before the gap after the newest row was
+        //! stored, or couldn't be retrieved.
+        void newerGapFilled(bool filled);
         void messageFailed(QString txn_id);
         void messageSent(QString txn_id, QString event_id);
         void currentIndexChanged(int index);
         void redactionFailed(QString id);
         void eventRedacted(QString id);
-        void nextPendingMessage();
         void newMessageToSend(mtx::events::collections::TimelineEvents event);
         void mediaCached(QString mxcUrl, QString cacheUrl);
+        //! Progress of a download started by cacheMedia or saveMedia. total is -1, if unknown.
+        void mediaProgress(QString mxcUrl, qint64 received, qint64 total);
         void newEncryptedImage(mtx::crypto::EncryptedFile encryptionInfo);
-        void eventFetched(QString requestingEvent, mtx::events::collections::TimelineEvents event);
         void typingUsersChanged(std::vector<QString> users);
+        //! The room keys of the megolm session, which a message started, were sent to the devices
+        //! of finished of total users. Emitted from other threads.
+        void keySharingProgress(QString txn_id, int finished, int total);
+        //! Emitted from the network thread, when the members were stored or couldn't be
+        //! retrieved.
+        void membersRetrieved();
         void replyChanged(QString reply);
 
 private:
+        //! Decrypt an event and cache the result. Blocks until the event is decrypted.
         DecryptionResult decryptEvent(
           const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e) const;
+        //! The cached decryption of an event, or a placeholder, while it is decrypted in the
+        //! background. The row is updated, when the decrypted event is ready.
+        DecryptionResult decryptEventLater(
+          const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e) const;
+        //! Append the next page of the cached events. Returns false, if there are none left.
+        bool restoreFromCache();
+        //! Append a page of the cached events, which was read from the cache.
+        bool appendCachedWindow(const TimelineWindow &window);
+        //! Start decrypting the newest rows and fetching their media.
+        void warmUpNewestRows();
+        //! Replace the rows by the stored events around an event. Returns false, if it isn't in
+        //! the stored timeline.
+        bool showCachedEvent(const QString &id);
+        //! Add the next page of the stored events, which are newer than the newest row, while the
+        //! timeline is detached. Requests the missing events, if there is a gap.
+        void fetchNewer();
+        //! Remove all rows. The events stay stored.
+        void clearRows();
+        //! Add the unsent messages at the bottom, once the rows reach the newest events again.
+        void attachPending();
+        //! Decrypt the encrypted events around a row in the background.
+        void decryptAround(int row) const;
+        void queueDecryption(
+          const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e) const;
+        void decryptionFinished(const std::string &event_id,
+                                const std::string &session_id,
+                                const DecryptionResult &result);
+        //! Lay out the rows of the images again, once their dimensions were probed.
+        void receivedImageDimensions(const QString &mxcUrl);
+        //! Remember the event, if it waits for its megolm session.
+        void waitForSession(const std::string &event_id,
+                            const std::string &session_id,
+                            const DecryptionResult &result) const;
+        //! Decrypt an event, unless its plaintext was kept by an earlier decryption. Doesn't
+        //! access the model, so it can run on any thread.
+        static DecryptionResult decrypt(
+          const std::string &room_id,
+          const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e);
+        //! Decrypt an event with its megolm session.
+        static DecryptionResult decryptWithSession(
+          const std::string &room_id,
+          const mtx::events::EncryptedEvent<mtx::events::msg::Encrypted> &e);
         std::vector<QString> internalAddEvents(
           const std::vector<mtx::events::collections::TimelineEvents> &timeline);
+        //! Drop the display values and the formatted text of an event, e.g. after it changed.
+        void invalidateRow(const QString &id);
+        //! The formatted text of a state event, rendered on first use.
+        QString formatMemoized(const QString &id,
+                               QString (TimelineModel::*render)(const QString &));
+        QString renderMemberEvent(const QString &id);
+        QString renderJoinRuleEvent(const QString &id);
+        QString renderHistoryVisibilityEvent(const QString &id);
+        QString renderGuestAccessEvent(const QString &id);
+        QString renderPowerLevelEvent(const QString &id);
+        //! The display values of an event, computed on first use. Valid until the next call.
+        const DisplayRow &displayRow(const QString &id) const;
+        //! Emit one dataChanged per contiguous range of the rows, instead of one per row.
+        void emitRowsChanged(std::vector<int> rows);
+        //! Add older events, newest first, at the end of the timeline.
+        void appendEvents(const std::vector<mtx::events::collections::TimelineEvents> &timeline);
+        //! Fold new member events into the member event next to them, so consecutive member
+        //! events take only one row. Returns the events, which need rows of their own.
+        std::vector<QString> collapseMemberRuns(const std::vector<QString> &ids, bool older);
         void sendEncryptedMessage(const std::string &txn_id, nlohmann::json content);
+        //! Share a new megolm session with the devices, a few users at a time. The room keys
+        //! are encrypted in a thread pool and sent in batches. Reports keySharingProgress for the
+        //! message, which started the session.
+        void shareMegolmSession(
+          std::shared_ptr<StateKeeper> keeper,
+          const nlohmann::json &megolm_payload,
+          std::map<std::string, std::map<std::string, DevicePublicKeys>> devices,
+          const std::string &txn_id);
+        void claimNextKeys(std::shared_ptr<StateKeeper> keeper,
+                           const nlohmann::json &megolm_payload,
+                           std::shared_ptr<KeyDistribution> distribution);
         void handleClaimedKeys(std::shared_ptr<StateKeeper> keeper,
+                               std::shared_ptr<KeyDistribution> distribution,
                                const std::map<std::string, std::string> &room_key,
                                const std::map<std::string, DevicePublicKeys> &pks,
                                const std::string &user_id,
                                const mtx::responses::ClaimKeys &res,
                                mtx::http::RequestErr err);
-        void readEvent(const std::string &id);
-
-        QHash<QString, mtx::events::collections::TimelineEvents> events;
+        //! Add the encrypted room keys of a user to the next to_device request, which is sent
+        //! once it is full or the last user was encrypted for. Empty, if encrypting failed.
+        void finishKeyDistribution(std::shared_ptr<StateKeeper> keeper,
+                                   std::shared_ptr<KeyDistribution> distribution,
+                                   const std::string &user_id,
+                                   nlohmann::json messages);
+        //! Add the unsent messages of the outbox as pending messages and send them.
+        void restoreOutbox();
+
+        EventStore events;
+        mutable QCache<std::string, DecryptionResult> decryptedEvents_;
+        //! The events, which are decrypted in the background right now, and their session.
+        mutable std::unordered_map<std::string, std::string> decrypting_;
+        //! The events in decrypting_, whose session arrived during their decryption. A failed
+        //! decryption of them is retried.
+        std::set<std::string> sessionArrived_;
+        //! The events, which couldn't be decrypted yet, by the megolm session they wait for.
+        mutable std::unordered_map<std::string, std::set<std::string>> waitingForSession_;
+        //! The image events without dimensions, by the image they wait for to be probed.
+        mutable QHash<QString, QSet<QString>> waitingForDimensions_;
+        //! Dropped, when the event, the members of the room or the theme change.
+        mutable QCache<QString, DisplayRow> displayRows_;
+        //! The texts of the formatted state events. Dropped, when the event or the members of the
+        //! room change.
+        QCache<QString, QString> formattedEvents_;
+        //! The formatted typing users by user ids and background. Dropped with formattedEvents_.
+        QCache<QString, QString> formattedTyping_;
         QSet<QString> read;
+        //! Whether another user has read the event or a newer one.
+        bool isReadByOthers(const QString &id) const;
+        //! The row of readUpTo_, or -1, if no other user has read an event of the timeline.
+        int readUpToRow() const;
+        //! The newest receipt of every other user, user_id -> (event_id, timestamp). The state of
+        //! our messages is derived from them, so it doesn't read the receipts from the cache.
+        std::map<std::string, std::pair<QString, uint64_t>> receipts_;
+        //! The newest event of the timeline, which another user has read. Looked up again, when
+        //! the receipts or the number of events changed.
+        mutable QString readUpTo_;
+        mutable bool readUpToDirty_      = true;
+        mutable std::size_t readUpToSize_ = 0;
+        //! The messages, which weren't acknowledged by the server yet, in the order they were sent.
         QList<QString> pending;
-        std::vector<QString> eventOrder;
+        //! The pending messages, whose request is running, and since when.
+        QHash<QString, QElapsedTimer> sending_;
+        //! How often the pending messages failed to send, for the delay before their retry.
+        QHash<QString, int> sendFailures_;
+        //! The failed messages, which wait for their retry.
+        QSet<QString> waitingForRetry_;
+        //! The messages, whose new megolm session isn't shared with all devices yet.
+        QSet<QString> sharingKeys_;
+        bool membersLoaded_  = false;
+        bool loadingMembers_ = false;
+        //! The redactions and media files in flight, whose callbacks use the model on other
+        //! threads.
+        std::atomic_int requestsInFlight_{0};
+        //! How many messages are sent at the same time. With more than one, a message may reach the
+        //! server before an older one. The local echoes keep the order they were sent in, until
+        //! the timeline is loaded again from the cache, which has the order of the server.
+        int sendWindow_ = 1;
+        //! The consecutive member events, newest first, by the event whose row represents them.
+        QHash<QString, std::deque<QString>> memberRuns_;
+        //! The event, whose row represents a collapsed member event.
+        QHash<QString, QString> collapsedInto_;
+        //! The member events, which the user expanded. New events don't collapse into them.
+        QSet<QString> expandedRuns_;
 
         QString room_id_;
         QString prev_batch_token_;
-
-        bool isInitialSync        = true;
-        bool paginationInProgress = false;
-        bool decryptDescription   = true;
+        QString viewportAnchor_;
+        double viewportOffset_ = 0;
+        //! Retrieves the events, which replies and member changes refer to.
+        EventFetcher fetcher_;
+        //! Sends the newest read event, once the scrolling settled.
+        ReadMarker readMarker_;
+
+        bool isInitialSync         = true;
+        bool paginationInProgress  = false;
+        bool decryptDescription    = true;
+        bool collapseMemberEvents_ = true;
+        //! Whether fetchMore has to use /messages, because the cache has no older events.
+        bool cachedHistoryExhausted_ = false;
+        //! Whether warmUp reads the newest cached events in the thread pool.
+        bool warmingUp_ = false;
+        //! Whether the rows end before the newest events of the room, after a jump to an older
+        //! event. Newer events are loaded, while the view gets close to the newest row.
+        bool detached_ = false;
+        //! Whether the events before the gap after the newest row are requested.
+        bool fillingNewerGap_ = false;
+        //! The requests for the context of an event, which are in flight.
+        int contextRequests_ = 0;
+        //! Whether the running pagination shouldn't add its events, e.g. after a jump.
+        bool discardPagination_ = false;
+        //! Older events are requested, when the viewport gets this close to the oldest row.
+        int prefetchDistance_ = 0;
 
         QString currentId;
         QString reply_;
@@ -0,0 +1,241 @@
+#include "TimelineStats.h"
+
+#include <algorithm>
+
+#include <QCoreApplication>
+#include <QFile>
+#include <QMetaEnum>
+#include <QQuickWindow>
+#include <QStringList>
+
+#include <nlohmann/json.hpp>
+
+#include "Logging.h"
+#include "MxcImageProvider.h"
+#include "TimelineModel.h"
+#include "Wakeups.h"
+#include "WorkerPools.h"
+
+//! How often the numbers of the overlay are updated.
+constexpr int UPDATE_INTERVAL = 1000;
+//! The unattended scroll benchmark waits this long after the first room is shown, so the
+//! benchmark doesn't time the loading of its messages.
+constexpr int BENCHMARK_DELAY = 2000;
+
+QString TimelineStats::benchmarkReport_;
+
+TimelineStats::TimelineStats(QQuickWindow *window, QObject *parent)
+  : QObject(parent)
+  , window_(window)
+{
+        updateTimer_.setInterval(UPDATE_INTERVAL);
+        wakeups::manage(&updateTimer_, "timeline stats", true);
+        connect(&updateTimer_, &QTimer::timeout, this, &TimelineStats::update);
+}
+
+void
+TimelineStats::setEnabled(bool enabled)
+{
+        if (enabled_ == enabled)
+                return;
+
+        enabled_ = enabled;
+        if (enabled) {
+                // Emitted by the render thread.
+                frameConnection_ = connect(window_,
+                                           &QQuickWindow::frameSwapped,
+                                           this,
+                                           &TimelineStats::frameSwapped,
+                                           Qt::QueuedConnection);
+                lastFrame_.invalidate();
+                updateTimer_.start();
+                update();
+        } else {
+                finishBenchmark();
+                disconnect(frameConnection_);
+                updateTimer_.stop();
+                createdThisFrame_.clear();
+        }
+
+        emit enabledChanged();
+}
+
+void
+TimelineStats::setTimeline(TimelineModel *timeline)
+{
+        timeline_ = timeline;
+        if (enabled_)
+                update();
+
+        if (timeline && benchmarkOnStart() && !benchmarkRequested_) {
+                benchmarkRequested_ = true;
+                QTimer::singleShot(BENCHMARK_DELAY, this, &TimelineStats::benchmarkRequested);
+        }
+}
+
+void
+TimelineStats::setScrolling(bool scrolling)
+{
+        // The first frame of a scroll is timed from its start, not from the last frame before.
+        if (scrolling && !scrolling_)
+                lastFrame_.start();
+
+        scrolling_ = scrolling;
+}
+
+void
+TimelineStats::delegateCreated(int type)
+{
+        delegates_++;
+        created_++;
+        if (enabled_)
+                createdThisFrame_[type]++;
+        if (benchmarking_)
+                benchmarkCreated_[type]++;
+}
+
+void
+TimelineStats::startBenchmark()
+{
+        setEnabled(true);
+
+        benchmarkFrames_.clear();
+        benchmarkCreated_.clear();
+        benchmarkResult_.clear();
+        benchmarking_ = true;
+        emit benchmarkChanged();
+}
+
+void
+TimelineStats::finishBenchmark()
+{
+        if (!benchmarking_)
+                return;
+
+        benchmarking_ = false;
+
+        auto frames = std::move(benchmarkFrames_);
+        std::sort(frames.begin(), frames.end());
+        const auto percentile = [&frames](double p) {
+                if (frames.empty())
+                        return 0.0;
+                return frames[static_cast<std::size_t>(p * (frames.size() - 1))] / 1e6;
+        };
+
+        const auto types = QMetaEnum::fromType<qml_mtx_events::EventType>();
+        QStringList created;
+        int total = 0;
+        for (const auto &[type, count] : benchmarkCreated_) {
+                created.push_back(QString("%1 %2").arg(count).arg(types.valueToKey(type)));
+                total += count;
+        }
+
+        // The peaks are those of the whole session, the pools don't know about the benchmark.
+        const auto decode = workers::stats(workers::Pool::Decode);
+        const auto crypto = workers::stats(workers::Pool::Crypto);
+
+        benchmarkResult_ = QString("scroll benchmark: %1 frames, p50 %2 ms, p90 %3 ms, p99 %4 ms, "
+                                   "max %5 ms\n%6 delegates created: %7\n"
+                                   "decode pool %8 jobs, at most %9 queued, "
+                                   "media crypto pool %10 jobs, at most %11 queued")
+                             .arg(frames.size())
+                             .arg(percentile(0.5), 0, 'f', 1)
+                             .arg(percentile(0.9), 0, 'f', 1)
+                             .arg(percentile(0.99), 0, 'f', 1)
+                             .arg(percentile(1), 0, 'f', 1)
+                             .arg(total)
+                             .arg(created.join(", "))
+                             .arg(decode.jobs)
+                             .arg(decode.peakQueued)
+                             .arg(crypto.jobs)
+                             .arg(crypto.peakQueued);
+        nhlog::ui()->info("{}", benchmarkResult_.toStdString());
+
+        benchmarkCreated_.clear();
+        emit benchmarkChanged();
+
+        if (benchmarkReport_.isEmpty())
+                return;
+
+        const nlohmann::json report = {{"frames", frames.size()},
+                                       {"p50", percentile(0.5)},
+                                       {"p90", percentile(0.9)},
+                                       {"p99", percentile(0.99)},
+                                       {"max", percentile(1)},
+                                       {"delegates created", total}};
+
+        QFile file(benchmarkReport_);
+        if (!file.open(QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text))
+                nhlog::ui()->warn("failed to write the scroll benchmark to {}",
+                                  benchmarkReport_.toStdString());
+        else
+                file.write(QByteArray::fromStdString(report.dump() + "\n"));
+
+        benchmarkReport_.clear();
+        QCoreApplication::quit();
+}
+
+void
+TimelineStats::setBenchmarkReport(const QString &file)
+{
+        benchmarkReport_ = file;
+}
+
+void
+TimelineStats::frameSwapped()
+{
+        // Only the frames of a scroll are timed, the others only show, that something changed.
+        if (scrolling_ && lastFrame_.isValid()) {
+                const auto gap = lastFrame_.nsecsElapsed();
+                frames_++;
+                framesTime_ += gap;
+                if (benchmarking_)
+                        benchmarkFrames_.push_back(gap);
+
+                if (gap > maxFrameNsecs_) {
+                        maxFrameNsecs_       = gap;
+                        createdSlowestFrame_ = createdThisFrame_;
+                }
+        }
+
+        createdThisFrame_.clear();
+        lastFrame_.start();
+}
+
+void
+TimelineStats::update()
+{
+        frameTime_    = frames_ ? framesTime_ / 1e6 / frames_ : 0;
+        maxFrameTime_ = maxFrameNsecs_ / 1e6;
+
+        const auto types = QMetaEnum::fromType<qml_mtx_events::EventType>();
+        QStringList slowest;
+        for (const auto &[type, count] : createdSlowestFrame_)
+                slowest.push_back(QString("%1 %2").arg(count).arg(types.valueToKey(type)));
+        slowestFrame_ = slowest.join(", ");
+
+        createdPerSecond_ = created_;
+        rows_             = timeline_ ? timeline_->rowCount() : 0;
+        decryptQueue_     = timeline_ ? timeline_->decryptQueue() : 0;
+
+        // The counters are read one after the other, so a response may finish in between.
+        const auto images  = MxcImageProvider::stats();
+        const auto settled = images.responses_completed + images.responses_cancelled;
+        pendingImages_     = static_cast<int>(
+          images.responses_requested > settled ? images.responses_requested - settled : 0);
+
+        const auto decode = workers::stats(workers::Pool::Decode);
+        const auto crypto = workers::stats(workers::Pool::Crypto);
+        decodeQueue_      = decode.queued;
+        decodeRunning_    = decode.running;
+        cryptoQueue_      = crypto.queued;
+        cryptoRunning_    = crypto.running;
+
+        frames_        = 0;
+        framesTime_    = 0;
+        maxFrameNsecs_ = 0;
+        created_       = 0;
+        createdSlowestFrame_.clear();
+
+        emit updated();
+}
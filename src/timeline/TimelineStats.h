@@ -0,0 +1,144 @@
+#pragma once
+
+#include <map>
+#include <vector>
+
+#include <QElapsedTimer>
+#include <QObject>
+#include <QPointer>
+#include <QString>
+#include <QTimer>
+
+class QQuickWindow;
+class TimelineModel;
+
+//! The numbers of the performance overlay of the timeline, to find out, which messages make the
+//! scrolling stutter.
+//!
+//! While the overlay is shown, the frames of the window are timed, while the timeline scrolls,
+//! and the numbers are updated once a second. The slowest frame of each second remembers the
+//! types of the delegates, which were created for it. While it is hidden, only the delegates are
+//! counted.
+//!
+//! The scroll benchmark of the overlay keeps the time of every frame, while it flicks through the
+//! timeline, and reports the percentiles and the delegates created by type at the end. With
+//! --scroll-benchmark it runs unattended, see setBenchmarkReport.
+class TimelineStats : public QObject
+{
+        Q_OBJECT
+
+        Q_PROPERTY(bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged)
+        Q_PROPERTY(double frameTime READ frameTime NOTIFY updated)
+        Q_PROPERTY(double maxFrameTime READ maxFrameTime NOTIFY updated)
+        Q_PROPERTY(QString slowestFrame READ slowestFrame NOTIFY updated)
+        Q_PROPERTY(int delegates READ delegates NOTIFY updated)
+        Q_PROPERTY(int delegatesCreated READ delegatesCreated NOTIFY updated)
+        Q_PROPERTY(int rows READ rows NOTIFY updated)
+        Q_PROPERTY(int pendingImages READ pendingImages NOTIFY updated)
+        Q_PROPERTY(int decryptQueue READ decryptQueue NOTIFY updated)
+        Q_PROPERTY(int decodeQueue READ decodeQueue NOTIFY updated)
+        Q_PROPERTY(int decodeRunning READ decodeRunning NOTIFY updated)
+        Q_PROPERTY(int cryptoQueue READ cryptoQueue NOTIFY updated)
+        Q_PROPERTY(int cryptoRunning READ cryptoRunning NOTIFY updated)
+        Q_PROPERTY(bool benchmarking READ benchmarking NOTIFY benchmarkChanged)
+        Q_PROPERTY(QString benchmarkResult READ benchmarkResult NOTIFY benchmarkChanged)
+
+public:
+        TimelineStats(QQuickWindow *window, QObject *parent = nullptr);
+
+        bool enabled() const { return enabled_; }
+        void setEnabled(bool enabled);
+        //! The room shown in the timeline.
+        void setTimeline(TimelineModel *timeline);
+
+        //! The mean time between the frames of the last second, in ms, while the timeline scrolled.
+        double frameTime() const { return frameTime_; }
+        double maxFrameTime() const { return maxFrameTime_; }
+        //! The delegates created for the slowest frame of the last second by type.
+        QString slowestFrame() const { return slowestFrame_; }
+        //! The delegates, which exist right now.
+        int delegates() const { return delegates_; }
+        //! The delegates created in the last second.
+        int delegatesCreated() const { return createdPerSecond_; }
+        int rows() const { return rows_; }
+        //! The image responses, which didn't get their image yet.
+        int pendingImages() const { return pendingImages_; }
+        //! The events of the room, which are decrypted right now.
+        int decryptQueue() const { return decryptQueue_; }
+        //! The jobs of the image pools, which wait for a thread or run, see workers.
+        int decodeQueue() const { return decodeQueue_; }
+        int decodeRunning() const { return decodeRunning_; }
+        int cryptoQueue() const { return cryptoQueue_; }
+        int cryptoRunning() const { return cryptoRunning_; }
+
+        //! Called by the timeline, when it starts or stops moving. The time between two scrolls is
+        //! idle, however long a frame of a scroll takes.
+        Q_INVOKABLE void setScrolling(bool scrolling);
+
+        //! Called by every delegate with the type of its event, when it is created or destroyed.
+        Q_INVOKABLE void delegateCreated(int type);
+        Q_INVOKABLE void delegateDestroyed() { delegates_--; }
+
+        bool benchmarking() const { return benchmarking_; }
+        //! The summary of the last scroll benchmark.
+        QString benchmarkResult() const { return benchmarkResult_; }
+        //! Start keeping the frames and the created delegates, the overlay is shown meanwhile.
+        Q_INVOKABLE void startBenchmark();
+        //! Stop the benchmark, log its summary and show it in the overlay.
+        Q_INVOKABLE void finishBenchmark();
+
+        //! Run the scroll benchmark, once the first room is shown, append its result to file as a
+        //! line of json and quit.
+        static void setBenchmarkReport(const QString &file);
+        static bool benchmarkOnStart() { return !benchmarkReport_.isEmpty(); }
+
+signals:
+        void enabledChanged();
+        void updated();
+        void benchmarkChanged();
+        //! The timeline should run the scroll benchmark, see setBenchmarkReport.
+        void benchmarkRequested();
+
+private:
+        void frameSwapped();
+        void update();
+
+        QQuickWindow *window_;
+        QPointer<TimelineModel> timeline_;
+        bool enabled_   = false;
+        bool scrolling_ = false;
+        QTimer updateTimer_;
+        QMetaObject::Connection frameConnection_;
+
+        QElapsedTimer lastFrame_;
+        //! The frames and their time in the current second.
+        int frames_           = 0;
+        qint64 framesTime_    = 0;
+        qint64 maxFrameNsecs_ = 0;
+        //! The delegates created since the last frame and for the slowest frame of the second,
+        //! by type.
+        std::map<int, int> createdThisFrame_, createdSlowestFrame_;
+        int created_ = 0;
+
+        double frameTime_    = 0;
+        double maxFrameTime_ = 0;
+        QString slowestFrame_;
+        int delegates_        = 0;
+        int createdPerSecond_ = 0;
+        int rows_             = 0;
+        int pendingImages_    = 0;
+        int decryptQueue_     = 0;
+        int decodeQueue_      = 0;
+        int decodeRunning_    = 0;
+        int cryptoQueue_      = 0;
+        int cryptoRunning_    = 0;
+
+        bool benchmarking_ = false;
+        //! The frame times of the benchmark in ns and the delegates it created by type.
+        std::vector<qint64> benchmarkFrames_;
+        std::map<int, int> benchmarkCreated_;
+        QString benchmarkResult_;
+        bool benchmarkRequested_ = false;
+
+        static QString benchmarkReport_;
+};
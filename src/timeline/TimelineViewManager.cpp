@@ -1,21 +1,68 @@
 #include "TimelineViewManager.h"
 
+#include <chrono>
+#include <cmath>
+#include <memory>
+
+#include <QFutureWatcher>
+#include <QGuiApplication>
 #include <QMetaType>
 #include <QPalette>
+#include <QPointer>
+#include <QQmlComponent>
 #include <QQmlContext>
+#include <QQuickWindow>
 
 #include "BlurhashProvider.h"
 #include "ChatPage.h"
 #include "ColorImageProvider.h"
 #include "DelegateChooser.h"
+#include "JdenticonProvider.h"
 #include "Logging.h"
 #include "MatrixClient.h"
+#include "MemoryGovernor.h"
+#include "MessageRenderer.h"
 #include "MxcImageProvider.h"
+#include "RichText.h"
+#include "Startup.h"
+#include "Trace.h"
 #include "UserSettingsPage.h"
 #include "dialogs/ImageOverlay.h"
 
 Q_DECLARE_METATYPE(mtx::events::collections::TimelineEvents)
 
+//! The range of the widths, at which images are loaded, in device pixels.
+constexpr int MIN_IMAGE_BUCKET = 32;
+constexpr int MAX_IMAGE_BUCKET = 4096;
+
+constexpr const char *TIMELINE_VIEW = "qrc:///qml/TimelineView.qml";
+//! The delegates of the timeline. They are compiled with the view anyway, but compiling them on
+//! their own shows the time each one takes in the startup trace.
+constexpr const char *PRELOADED_DELEGATES[] = {
+  "qrc:///qml/delegates/MessageDelegate.qml",
+  "qrc:///qml/delegates/TextMessage.qml",
+  "qrc:///qml/delegates/NoticeMessage.qml",
+  "qrc:///qml/delegates/ImageMessage.qml",
+  "qrc:///qml/delegates/PlayableMediaMessage.qml",
+  "qrc:///qml/delegates/FileMessage.qml",
+  "qrc:///qml/delegates/Reply.qml",
+};
+
+namespace {
+//! The width an image of width is loaded at: a power of two or the size halfway to the next one.
+int
+imageBucket(int width)
+{
+        int bucket = MIN_IMAGE_BUCKET;
+        while (bucket < width && bucket < MAX_IMAGE_BUCKET) {
+                if (bucket + bucket / 2 >= width)
+                        return bucket + bucket / 2;
+                bucket *= 2;
+        }
+        return bucket;
+}
+}
+
 void
 TimelineViewManager::updateEncryptedDescriptions()
 {
@@ -34,8 +81,6 @@ TimelineViewManager::updateEncryptedDescriptions()
 void
 TimelineViewManager::updateColorPalette()
 {
-        userColors.clear();
-
         if (settings->theme() == "light") {
                 view->rootContext()->setContextProperty("currentActivePalette", QPalette());
                 view->rootContext()->setContextProperty("currentInactivePalette", QPalette());
@@ -46,21 +91,43 @@ TimelineViewManager::updateColorPalette()
                 view->rootContext()->setContextProperty("currentActivePalette", QPalette());
                 view->rootContext()->setContextProperty("currentInactivePalette", nullptr);
         }
+
+        // The icons are cached per color, the ones in the colors of the old theme won't be
+        // requested again.
+        colorImgProvider->invalidateColors(QGuiApplication::palette());
+
+        for (const auto &model : models)
+                model->clearDisplayRows();
 }
 
 QColor
 TimelineViewManager::userColor(QString id, QColor background)
 {
-        if (!userColors.contains(id))
-                userColors.insert(
-                  id, QColor(utils::generateContrastingHexColor(id, background.name())));
-        return userColors.value(id);
+        return utils::userColor(id, background);
+}
+
+QSize
+TimelineViewManager::imageSourceSize(double width, double height) const
+{
+        if (width <= 0 || height <= 0)
+                return QSize();
+
+        const auto ratio  = qApp->devicePixelRatio();
+        const auto bucket = imageBucket(static_cast<int>(std::ceil(width * ratio)));
+        return QSize(bucket, static_cast<int>(std::ceil(bucket * height / width)));
+}
+
+bool
+TimelineViewManager::jdenticonsAvailable() const
+{
+        return JdenticonProvider::available();
 }
 
 TimelineViewManager::TimelineViewManager(QSharedPointer<UserSettings> userSettings, QWidget *parent)
   : imgProvider(new MxcImageProvider())
   , colorImgProvider(new ColorImageProvider())
   , blurhashProvider(new BlurhashProvider())
+  , jdenticonProvider(new JdenticonProvider())
   , settings(userSettings)
 {
         qmlRegisterUncreatableMetaObject(qml_mtx_events::staticMetaObject,
@@ -71,6 +138,7 @@ TimelineViewManager::TimelineViewManager(QSharedPointer<UserSettings> userSettin
                                          "Can't instantiate enum!");
         qmlRegisterType<DelegateChoice>("im.nheko", 1, 0, "DelegateChoice");
         qmlRegisterType<DelegateChooser>("im.nheko", 1, 0, "DelegateChooser");
+        qmlRegisterType<RichText>("im.nheko", 1, 0, "RichText");
         qRegisterMetaType<mtx::events::collections::TimelineEvents>();
 
 #ifdef USE_QUICK_VIEW
@@ -87,12 +155,46 @@ TimelineViewManager::TimelineViewManager(QSharedPointer<UserSettings> userSettin
         });
 #endif
         container->setMinimumSize(200, 200);
+
+#ifdef USE_QUICK_VIEW
+        QQuickWindow *window = view;
+#else
+        QQuickWindow *window = view->quickWindow();
+#endif
+        stats_ = new TimelineStats(window, this);
+
+        // A room switch lasts until the timeline is rendered with the new room.
+        connect(
+          window,
+          &QQuickWindow::afterRendering,
+          this,
+          [this]() {
+                  startup::reached(startup::Milestone::FirstFrame);
+                  if (!switching_.isValid())
+                          return;
+
+                  startup::reached(startup::Milestone::FirstTimeline);
+                  cache::recordLatency(switchingToLoaded_ ? NHEKO_METRIC("switchRoomLoaded")
+                                                          : NHEKO_METRIC("switchRoom"),
+                                       std::chrono::microseconds(switching_.nsecsElapsed() / 1000));
+                  switching_.invalidate();
+          },
+          Qt::QueuedConnection);
         view->rootContext()->setContextProperty("timelineManager", this);
         updateColorPalette();
         view->engine()->addImageProvider("MxcImage", imgProvider);
         view->engine()->addImageProvider("colorimage", colorImgProvider);
         view->engine()->addImageProvider("blurhash", blurhashProvider);
-        view->setSource(QUrl("qrc:///qml/TimelineView.qml"));
+        view->engine()->addImageProvider("jdenticon", jdenticonProvider);
+
+        // The view is compiled by the loader thread of the engine, while the cache is restored.
+        // Setting the source then only creates it from the compiled types.
+        for (const auto url : PRELOADED_DELEGATES)
+                compileComponent(url, {});
+        compileComponent(TIMELINE_VIEW, [this]() {
+                trace::Span span("load qml");
+                view->setSource(QUrl(TIMELINE_VIEW));
+        });
 
         connect(dynamic_cast<ChatPage *>(parent),
                 &ChatPage::themeChanged,
@@ -102,30 +204,93 @@ TimelineViewManager::TimelineViewManager(QSharedPointer<UserSettings> userSettin
                 &ChatPage::decryptSidebarChanged,
                 this,
                 &TimelineViewManager::updateEncryptedDescriptions);
+
+        connect(&typingUsers_,
+                &TypingUsers::typingUsersChanged,
+                this,
+                [this](QString room_id, std::vector<QString> users) {
+                        if (auto model = models.value(room_id))
+                                model->updateTypingUsers(users);
+                });
+}
+
+void
+TimelineViewManager::compileComponent(const char *url, std::function<void()> ready)
+{
+        const auto start = std::chrono::steady_clock::now();
+
+        // The component stays around, so the compiled types stay in the cache of the engine.
+        auto component =
+          new QQmlComponent(view->engine(), QUrl(url), QQmlComponent::Asynchronous, this);
+
+        auto done = [component, url, start, ready = std::move(ready)]() {
+                if (component->isLoading())
+                        return;
+
+                trace::record(url, start, std::chrono::steady_clock::now());
+
+                if (component->isError())
+                        nhlog::ui()->warn("failed to compile {}: {}",
+                                          url,
+                                          component->errorString().toStdString());
+                if (ready)
+                        ready();
+        };
+
+        if (component->isLoading())
+                connect(component, &QQmlComponent::statusChanged, this, done);
+        else
+                done();
+}
+
+void
+TimelineViewManager::reloadFromCache(const QString &room_id)
+{
+        if (auto model = models.value(room_id))
+                model->reloadFromCache();
 }
 
 void
 TimelineViewManager::sync(const mtx::responses::Rooms &rooms)
 {
-        for (const auto &[room_id, room] : rooms.join) {
-                // addRoom will only add the room, if it doesn't exist
-                addRoom(QString::fromStdString(room_id));
-                const auto &room_model = models.value(QString::fromStdString(room_id));
-                room_model->addEvents(room.timeline);
+        const bool typingEnabled =
+          ChatPage::instance()->userSettings()->isTypingNotificationsEnabled();
+        const auto local_user = http::client()->user_id().to_string();
 
-                if (ChatPage::instance()->userSettings()->isTypingNotificationsEnabled()) {
+        for (const auto &[room_id, room] : rooms.join) {
+                // Kept for every room, so a room shows who is typing, once it is opened.
+                if (typingEnabled) {
                         std::vector<QString> typing;
                         typing.reserve(room.ephemeral.typing.size());
                         for (const auto &user : room.ephemeral.typing) {
-                                if (user != http::client()->user_id().to_string())
+                                if (user != local_user)
                                         typing.push_back(QString::fromStdString(user));
                         }
-                        room_model->updateTypingUsers(typing);
+                        typingUsers_.update(QString::fromStdString(room_id), std::move(typing));
+                }
+
+                // Rooms, which weren't opened yet, load their events from the cache later.
+                const auto &room_model = models.value(QString::fromStdString(room_id));
+                if (!room_model) {
+                        TimelineModel::updateLastMessage(this,
+                                                         QString::fromStdString(room_id),
+                                                         room.timeline,
+                                                         settings->isDecryptSidebarEnabled());
+                        continue;
                 }
+
+                room_model->addEvents(room.timeline);
+                room_model->updateReceipts(room.ephemeral.receipts);
         }
 
+        // The messages, which were left over from the last session.
+        if (this->isInitialSync_)
+                drainOutbox();
+
         this->isInitialSync_ = false;
         emit initialSyncChanged(false);
+
+        unloadInactiveModels();
 }
 
 void
@@ -140,7 +305,75 @@ TimelineViewManager::addRoom(const QString &room_id)
                         imgProvider,
                         &MxcImageProvider::addEncryptionInfo);
                 models.insert(room_id, std::move(newRoom));
+                recentRooms_.append(room_id);
+        }
+}
+
+QSharedPointer<TimelineModel>
+TimelineViewManager::loadModel(const QString &room_id)
+{
+        addRoom(room_id);
+        return models.value(room_id);
+}
+
+void
+TimelineViewManager::drainOutbox()
+{
+        for (const auto &model : models)
+                model->resendPendingMessages();
+
+        // New models send the messages of their outbox themselves.
+        const auto joined = cache::joinedRooms();
+        for (const auto &room_id : cache::outboxRooms()) {
+                const auto room = QString::fromStdString(room_id);
+                if (!models.contains(room) &&
+                    std::find(joined.begin(), joined.end(), room_id) != joined.end())
+                        loadModel(room);
+        }
+}
+
+QMap<QString, TimelineMemoryUsage>
+TimelineViewManager::memoryUsage() const
+{
+        QMap<QString, TimelineMemoryUsage> usage;
+        for (auto it = models.begin(); it != models.end(); ++it)
+                usage.insert(it.key(), it.value()->memoryBreakdown());
+
+        return usage;
+}
+
+void
+TimelineViewManager::unloadInactiveModels()
+{
+        trimModels(memory::budget(memory::Layer::Timelines));
+}
+
+void
+TimelineViewManager::trimModels(std::size_t budget)
+{
+        std::size_t used = 0;
+        for (const auto &model : models)
+                if (model.data() != timeline_)
+                        used += model->memoryUsage();
+
+        // Unload the least recently viewed rooms first.
+        QStringList unloaded;
+        for (auto it = recentRooms_.crbegin(); it != recentRooms_.crend() && used > budget; ++it) {
+                auto model = models.value(*it);
+                if (!model || model.data() == timeline_ || model->isBusy())
+                        continue;
+
+                nhlog::ui()->debug("unloading the timeline of room {} ({} bytes)",
+                                   it->toStdString(),
+                                   model->memoryUsage());
+
+                used -= std::min(used, model->memoryUsage());
+                models.remove(*it);
+                unloaded.push_back(*it);
         }
+
+        for (const auto &room_id : unloaded)
+                recentRooms_.removeOne(room_id);
 }
 
 void
@@ -148,43 +381,90 @@ TimelineViewManager::setHistoryView(const QString &room_id)
 {
         nhlog::ui()->info("Trying to activate room {}", room_id.toStdString());
 
-        auto room = models.find(room_id);
-        if (room != models.end()) {
-                timeline_ = room.value().data();
-                emit activeTimelineChanged(timeline_);
-                nhlog::ui()->info("Activated room {}", room_id.toStdString());
-        }
+        if (room_id.isEmpty())
+                return;
+
+        switchingToLoaded_ = models.contains(room_id);
+        switching_.start();
+
+        timeline_ = loadModel(room_id).data();
+        timeline_->loadMembers();
+        typingUsers_.setVisibleRoom(room_id);
+        stats_->setTimeline(timeline_);
+        emit activeTimelineChanged(timeline_);
+        nhlog::ui()->info("Activated room {}", room_id.toStdString());
+
+        recentRooms_.removeOne(room_id);
+        recentRooms_.prepend(room_id);
+        unloadInactiveModels();
 }
 
 void
-TimelineViewManager::openImageOverlay(QString mxcUrl, QString eventId) const
+TimelineViewManager::prefetchRoom(const QString &room_id)
 {
+        if (room_id.isEmpty() || (timeline_ && timeline_->roomId() == room_id))
+                return;
+
+        loadModel(room_id)->warmUp();
+
+        // Kept like a recently viewed room, so it isn't unloaded again right away.
+        recentRooms_.removeOne(room_id);
+        recentRooms_.prepend(room_id);
+        unloadInactiveModels();
+}
+
+void
+TimelineViewManager::openImageOverlay(QString mxcUrl,
+                                      QString eventId,
+                                      QString previewUrl,
+                                      QSize previewSize) const
+{
+        // Opened right away. The preview, which the provider has cached for the timeline, is
+        // shown until the image is downloaded and decoded.
+        QPointer<dialogs::ImageOverlay> imgDialog = new dialogs::ImageOverlay();
+        imgDialog->showFullScreen();
+        connect(imgDialog,
+                &dialogs::ImageOverlay::saving,
+                timeline_,
+                [this, eventId, imgDialog]() {
+                        // hide the overlay while presenting the save dialog for better
+                        // cross platform support.
+                        imgDialog->hide();
+
+                        if (!timeline_->saveMedia(eventId)) {
+                                imgDialog->show();
+                        } else {
+                                imgDialog->close();
+                        }
+                });
+
+        // The responses are deleted, once they finished, even if the overlay is closed already,
+        // so the full image isn't kept around. Every textureFactory is a new one, which the
+        // caller owns.
+        QQuickImageResponse *preview =
+          imgProvider->requestImageResponse(previewUrl.remove("mxc://"), previewSize);
+        connect(preview, &QQuickImageResponse::finished, this, [preview, imgDialog]() {
+                preview->deleteLater();
+                if (imgDialog && preview->errorString().isEmpty())
+                        imgDialog->setPreview(
+                          std::unique_ptr<QQuickTextureFactory>(preview->textureFactory())
+                            ->image());
+        });
+
         QQuickImageResponse *imgResponse =
           imgProvider->requestImageResponse(mxcUrl.remove("mxc://"), QSize());
-        connect(imgResponse, &QQuickImageResponse::finished, this, [this, eventId, imgResponse]() {
+        connect(imgResponse, &QQuickImageResponse::finished, this, [imgResponse, imgDialog]() {
+                imgResponse->deleteLater();
                 if (!imgResponse->errorString().isEmpty()) {
                         nhlog::ui()->error("Error when retrieving image for overlay: {}",
                                            imgResponse->errorString().toStdString());
                         return;
                 }
-                auto pixmap = QPixmap::fromImage(imgResponse->textureFactory()->image());
-
-                auto imgDialog = new dialogs::ImageOverlay(pixmap);
-                imgDialog->showFullScreen();
-                connect(imgDialog,
-                        &dialogs::ImageOverlay::saving,
-                        timeline_,
-                        [this, eventId, imgDialog]() {
-                                // hide the overlay while presenting the save dialog for better
-                                // cross platform support.
-                                imgDialog->hide();
-
-                                if (!timeline_->saveMedia(eventId)) {
-                                        imgDialog->show();
-                                } else {
-                                        imgDialog->close();
-                                }
-                        });
+
+                if (imgDialog)
+                        imgDialog->setImage(
+                          std::unique_ptr<QQuickTextureFactory>(imgResponse->textureFactory())
+                            ->image());
         });
 }
 
@@ -199,12 +479,37 @@ TimelineViewManager::updateReadReceipts(const QString &room_id,
 }
 
 void
-TimelineViewManager::initWithMessages(const std::map<QString, mtx::responses::Timeline> &msgs)
+TimelineViewManager::receivedInboundMegolmSessions(const QString &room_id,
+                                                   const QStringList &session_ids)
+{
+        auto room = models.find(room_id);
+        if (room != models.end())
+                room.value()->receivedInboundMegolmSessions(session_ids);
+}
+
+void
+TimelineViewManager::renderMarkdown(const QString &markdown,
+                                    std::function<void(const QString &)> send)
+{
+        auto html = MessageRenderer::instance().markdownLater(markdown);
+        rendering_.push_back({html, std::move(send)});
+
+        auto watcher = new QFutureWatcher<QString>(this);
+        connect(watcher, &QFutureWatcher<QString>::finished, this, [this, watcher]() {
+                watcher->deleteLater();
+                sendRenderedMessages();
+        });
+        watcher->setFuture(html);
+}
+
+void
+TimelineViewManager::sendRenderedMessages()
 {
-        for (const auto &e : msgs) {
-                addRoom(e.first);
+        while (!rendering_.empty() && rendering_.front().html.isFinished()) {
+                auto message = std::move(rendering_.front());
+                rendering_.pop_front();
 
-                models.value(e.first)->addEvents(e.second);
+                message.send(message.html.result());
         }
 }
 
@@ -217,25 +522,16 @@ TimelineViewManager::queueTextMessage(const QString &msg)
         mtx::events::msg::Text text = {};
         text.body                   = msg.trimmed().toStdString();
 
-        if (settings->isMarkdownEnabled()) {
-                text.formatted_body = utils::markdownToHtml(msg).toStdString();
-
-                // Don't send formatted_body, when we don't need to
-                if (text.formatted_body.find("<") == std::string::npos)
-                        text.formatted_body = "";
-                else
-                        text.format = "org.matrix.custom.html";
-        }
-
+        std::optional<RelatedInfo> related;
         if (!timeline_->reply().isEmpty()) {
-                auto related = timeline_->relatedInfo(timeline_->reply());
+                related = timeline_->relatedInfo(timeline_->reply());
 
                 QString body;
                 bool firstLine = true;
-                for (const auto &line : related.quoted_body.split("\n")) {
+                for (const auto &line : related->quoted_body.split("\n")) {
                         if (firstLine) {
                                 firstLine = false;
-                                body = QString("> <%1> %2\n").arg(related.quoted_user).arg(line);
+                                body = QString("> <%1> %2\n").arg(related->quoted_user).arg(line);
                         } else {
                                 body = QString("%1\n> %2\n").arg(body).arg(line);
                         }
@@ -245,41 +541,67 @@ TimelineViewManager::queueTextMessage(const QString &msg)
 
                 // NOTE(Nico): rich replies always need a formatted_body!
                 text.format = "org.matrix.custom.html";
-                if (settings->isMarkdownEnabled())
-                        text.formatted_body =
-                          utils::getFormattedQuoteBody(related, utils::markdownToHtml(msg))
-                            .toStdString();
-                else
-                        text.formatted_body =
-                          utils::getFormattedQuoteBody(related, msg.toHtmlEscaped()).toStdString();
 
-                text.relates_to.in_reply_to.event_id = related.related_event;
+                text.relates_to.in_reply_to.event_id = related->related_event;
                 timeline_->resetReply();
         }
 
-        timeline_->sendMessage(text);
+        if (!settings->isMarkdownEnabled()) {
+                if (related)
+                        text.formatted_body =
+                          utils::getFormattedQuoteBody(*related, msg.toHtmlEscaped()).toStdString();
+
+                timeline_->sendMessage(text);
+                return;
+        }
+
+        // Large pastes take a while to render, so the composer isn't blocked meanwhile. The
+        // model may be unloaded by then, so it is loaded again to send the message.
+        const auto room_id = timeline_->roomId();
+        renderMarkdown(msg, [this, room_id, text, related](const QString &html) mutable {
+                if (related) {
+                        text.formatted_body =
+                          utils::getFormattedQuoteBody(*related, html).toStdString();
+                } else if (html.contains('<')) {
+                        // Don't send formatted_body, when we don't need to
+                        text.formatted_body = html.toStdString();
+                        text.format         = "org.matrix.custom.html";
+                }
+
+                if (auto timeline = loadModel(room_id))
+                        timeline->sendMessage(text);
+        });
 }
 
 void
 TimelineViewManager::queueEmoteMessage(const QString &msg)
 {
-        auto html = utils::markdownToHtml(msg);
+        if (!timeline_)
+                return;
 
         mtx::events::msg::Emote emote;
         emote.body = msg.trimmed().toStdString();
 
-        if (html != msg.trimmed().toHtmlEscaped() && settings->isMarkdownEnabled()) {
-                emote.formatted_body = html.toStdString();
-                emote.format         = "org.matrix.custom.html";
-        }
-
         if (!timeline_->reply().isEmpty()) {
                 emote.relates_to.in_reply_to.event_id = timeline_->reply().toStdString();
                 timeline_->resetReply();
         }
 
-        if (timeline_)
+        if (!settings->isMarkdownEnabled()) {
                 timeline_->sendMessage(emote);
+                return;
+        }
+
+        const auto room_id = timeline_->roomId();
+        renderMarkdown(msg, [this, room_id, emote, msg](const QString &html) mutable {
+                if (html != msg.trimmed().toHtmlEscaped()) {
+                        emote.formatted_body = html.toStdString();
+                        emote.format         = "org.matrix.custom.html";
+                }
+
+                if (auto timeline = loadModel(room_id))
+                        timeline->sendMessage(emote);
+        });
 }
 
 void
@@ -289,20 +611,17 @@ TimelineViewManager::queueImageMessage(const QString &roomid,
                                        const QString &url,
                                        const QString &mime,
                                        uint64_t dsize,
-                                       const QSize &dimensions,
-                                       const QString &blurhash)
+                                       const mtx::common::ImageInfo &info)
 {
         mtx::events::msg::Image image;
+        image.info          = info;
         image.info.mimetype = mime.toStdString();
         image.info.size     = dsize;
-        image.info.blurhash = blurhash.toStdString();
         image.body          = filename.toStdString();
         image.url           = url.toStdString();
-        image.info.h        = dimensions.height();
-        image.info.w        = dimensions.width();
         image.file          = file;
 
-        auto model = models.value(roomid);
+        auto model = loadModel(roomid);
         if (!model->reply().isEmpty()) {
                 image.relates_to.in_reply_to.event_id = model->reply().toStdString();
                 model->resetReply();
@@ -327,7 +646,7 @@ TimelineViewManager::queueFileMessage(
         file.url           = url.toStdString();
         file.file          = encryptedFile;
 
-        auto model = models.value(roomid);
+        auto model = loadModel(roomid);
         if (!model->reply().isEmpty()) {
                 file.relates_to.in_reply_to.event_id = model->reply().toStdString();
                 model->resetReply();
@@ -351,7 +670,7 @@ TimelineViewManager::queueAudioMessage(const QString &roomid,
         audio.url           = url.toStdString();
         audio.file          = file;
 
-        auto model = models.value(roomid);
+        auto model = loadModel(roomid);
         if (!model->reply().isEmpty()) {
                 audio.relates_to.in_reply_to.event_id = model->reply().toStdString();
                 model->resetReply();
@@ -375,7 +694,7 @@ TimelineViewManager::queueVideoMessage(const QString &roomid,
         video.url           = url.toStdString();
         video.file          = file;
 
-        auto model = models.value(roomid);
+        auto model = loadModel(roomid);
         if (!model->reply().isEmpty()) {
                 video.relates_to.in_reply_to.event_id = model->reply().toStdString();
                 model->resetReply();
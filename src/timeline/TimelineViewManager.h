@@ -1,5 +1,10 @@
 #pragma once
 
+#include <deque>
+#include <functional>
+
+#include <QElapsedTimer>
+#include <QFuture>
 #include <QQuickView>
 #include <QQuickWidget>
 #include <QSharedPointer>
@@ -11,10 +16,13 @@
 #include "Cache.h"
 #include "Logging.h"
 #include "TimelineModel.h"
+#include "TimelineStats.h"
+#include "TypingUsers.h"
 #include "Utils.h"
 
 class MxcImageProvider;
 class BlurhashProvider;
+class JdenticonProvider;
 class ColorImageProvider;
 class UserSettings;
 
@@ -26,20 +34,65 @@ class TimelineViewManager : public QObject
           TimelineModel *timeline MEMBER timeline_ READ activeTimeline NOTIFY activeTimelineChanged)
         Q_PROPERTY(
           bool isInitialSync MEMBER isInitialSync_ READ isInitialSync NOTIFY initialSyncChanged)
+        Q_PROPERTY(TimelineStats *stats READ stats CONSTANT)
 
 public:
         TimelineViewManager(QSharedPointer<UserSettings> userSettings, QWidget *parent = nullptr);
         QWidget *getWidget() const { return container; }
+        MxcImageProvider *imageProvider() const { return imgProvider; }
 
         void sync(const mtx::responses::Rooms &rooms);
         void addRoom(const QString &room_id);
-
-        void clearAll() { models.clear(); }
+        //! Whether the timeline of the room is in memory.
+        bool isLoaded(const QString &room_id) const { return models.contains(room_id); }
+        //! Replace the rows of a loaded room by its newest stored events.
+        void reloadFromCache(const QString &room_id);
+        //! Send the unsent messages of all rooms, e.g. after a restart or when the connection
+        //! came back. Rooms with unsent messages are loaded.
+        void drainOutbox();
+
+        void clearAll()
+        {
+                models.clear();
+                recentRooms_.clear();
+                typingUsers_.clear();
+        }
+        //! Estimated memory used by the timelines of the loaded rooms.
+        QMap<QString, TimelineMemoryUsage> memoryUsage() const;
+        //! Unload the least recently viewed rooms, until the ones, which aren't shown, use at most
+        //! budget bytes.
+        void trimModels(std::size_t budget);
+
+        //! The sizes of the avatars and media in the timeline, as last laid out by it.
+        struct MediaLayout
+        {
+                int avatarSize     = 0;
+                int mediaWidth     = 0;
+                int mediaMaxHeight = 0;
+        };
+        MediaLayout mediaLayout() const { return mediaLayout_; }
+        void setMediaLayout(int avatarSize, int mediaWidth, int mediaMaxHeight)
+        {
+                mediaLayout_ = {avatarSize, mediaWidth, mediaMaxHeight};
+        }
 
         Q_INVOKABLE TimelineModel *activeTimeline() const { return timeline_; }
+        //! The numbers of the performance overlay.
+        TimelineStats *stats() const { return stats_; }
         Q_INVOKABLE bool isInitialSync() const { return isInitialSync_; }
-        Q_INVOKABLE void openImageOverlay(QString mxcUrl, QString eventId) const;
+        //! Open the image of an event. The preview, the image shown in the timeline at the given
+        //! source size, is shown right away, while the image itself loads.
+        Q_INVOKABLE void openImageOverlay(QString mxcUrl,
+                                          QString eventId,
+                                          QString previewUrl,
+                                          QSize previewSize) const;
         Q_INVOKABLE QColor userColor(QString id, QColor background);
+        //! The size in device pixels, at which an image shown at width x height is loaded. The
+        //! width is rounded up to one of a few sizes, so the delegates and the prefetches request
+        //! the same sizes and hit the caches of the image provider.
+        Q_INVOKABLE QSize imageSourceSize(double width, double height) const;
+        //! Whether the avatars of users without one are identicons of the jdenticon plugin.
+        Q_INVOKABLE bool jdenticonsAvailable() const;
 
 signals:
         void clearRoomMessageCount(QString roomid);
@@ -51,9 +104,12 @@ signals:
 
 public slots:
         void updateReadReceipts(const QString &room_id, const std::vector<QString> &event_ids);
-        void initWithMessages(const std::map<QString, mtx::responses::Timeline> &msgs);
+        void receivedInboundMegolmSessions(const QString &room_id, const QStringList &session_ids);
 
         void setHistoryView(const QString &room_id);
+        //! Prepare a room, which is likely opened next, e.g. because it is hovered in the room
+        //! list, so switching to it only has to create the delegates.
+        void prefetchRoom(const QString &room_id);
         void updateColorPalette();
 
         void queueTextMessage(const QString &msg);
@@ -64,8 +120,7 @@ public slots:
                                const QString &url,
                                const QString &mime,
                                uint64_t dsize,
-                               const QSize &dimensions,
-                               const QString &blurhash);
+                               const mtx::common::ImageInfo &info);
         void queueFileMessage(const QString &roomid,
                               const QString &filename,
                               const std::optional<mtx::crypto::EncryptedFile> &file,
@@ -97,11 +152,42 @@ private:
         MxcImageProvider *imgProvider;
         ColorImageProvider *colorImgProvider;
         BlurhashProvider *blurhashProvider;
-
+        JdenticonProvider *jdenticonProvider;
+
+        //! Compile a QML file in the background and call ready, once it is done. The time it
+        //! takes is recorded in the startup trace.
+        void compileComponent(const char *url, std::function<void()> ready);
+        //! The model of a room, which is created, if the room isn't loaded.
+        QSharedPointer<TimelineModel> loadModel(const QString &room_id);
+        //! Unload the least recently viewed rooms, until the others fit into the memory budget of
+        //! the timelines. They load their events from the cache again, when they are opened.
+        void unloadInactiveModels();
+        //! Render the markdown of a sent message in the background and pass the html to send.
+        //! The messages are sent in the order they were queued, no matter which renders first.
+        void renderMarkdown(const QString &markdown, std::function<void(const QString &)> send);
+        void sendRenderedMessages();
+
+        struct RenderingMessage
+        {
+                QFuture<QString> html;
+                std::function<void(const QString &)> send;
+        };
+
+        //! The models of the opened rooms. Rooms get a model, when they are opened.
         QHash<QString, QSharedPointer<TimelineModel>> models;
+        //! The loaded rooms, most recently viewed first.
+        QStringList recentRooms_;
+        //! The sent messages, whose markdown is rendered right now, oldest first.
+        std::deque<RenderingMessage> rendering_;
         TimelineModel *timeline_ = nullptr;
         bool isInitialSync_      = true;
+        MediaLayout mediaLayout_;
+        TypingUsers typingUsers_;
+        TimelineStats *stats_;
+
+        //! Started by a room switch and stopped by the next frame of the timeline.
+        QElapsedTimer switching_;
+        bool switchingToLoaded_ = false;
 
         QSharedPointer<UserSettings> settings;
-        QHash<QString, QColor> userColors;
 };
@@ -0,0 +1,81 @@
+#include "TypingUsers.h"
+
+#include <algorithm>
+
+#include "Wakeups.h"
+
+//! The typing users of the visible room are passed on at most that often.
+constexpr int TYPING_USERS_INTERVAL = 500;
+
+TypingUsers::TypingUsers(QObject *parent)
+  : QObject(parent)
+{
+        timer_.setSingleShot(true);
+        timer_.setInterval(TYPING_USERS_INTERVAL);
+        wakeups::manage(&timer_, "typing users");
+
+        connect(&timer_, &QTimer::timeout, this, [this]() {
+                if (!pending_)
+                        return;
+
+                flush();
+                timer_.start();
+        });
+}
+
+void
+TypingUsers::update(const QString &room_id, std::vector<QString> users)
+{
+        std::sort(users.begin(), users.end());
+
+        auto room = rooms_.find(room_id);
+        if (room == rooms_.end()) {
+                if (users.empty())
+                        return;
+                room = rooms_.insert(room_id, {});
+        }
+
+        if (*room == users)
+                return;
+
+        if (users.empty())
+                rooms_.erase(room);
+        else
+                *room = std::move(users);
+
+        if (room_id != visibleRoom_)
+                return;
+
+        if (timer_.isActive()) {
+                pending_ = true;
+                return;
+        }
+
+        flush();
+        timer_.start();
+}
+
+void
+TypingUsers::setVisibleRoom(const QString &room_id)
+{
+        visibleRoom_ = room_id;
+        timer_.stop();
+        flush();
+}
+
+void
+TypingUsers::clear()
+{
+        rooms_.clear();
+        visibleRoom_.clear();
+        pending_ = false;
+        timer_.stop();
+}
+
+void
+TypingUsers::flush()
+{
+        pending_ = false;
+        if (!visibleRoom_.isEmpty())
+                emit typingUsersChanged(visibleRoom_, rooms_.value(visibleRoom_));
+}
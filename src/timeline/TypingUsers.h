@@ -0,0 +1,41 @@
+#pragma once
+
+#include <vector>
+
+#include <QHash>
+#include <QObject>
+#include <QString>
+#include <QTimer>
+
+//! The typing users of the joined rooms, from the ephemeral events of the syncs.
+//!
+//! In a busy room they change several times a second, while the footer of the timeline formats
+//! them again for every change. So only the room in view passes its changes on, the first one
+//! right away and then at most one every TYPING_USERS_INTERVAL. The other rooms pass theirs on,
+//! once they are shown.
+class TypingUsers : public QObject
+{
+        Q_OBJECT
+
+public:
+        TypingUsers(QObject *parent = nullptr);
+
+        //! The typing users of a room in a sync. Changes of the order only aren't changes.
+        void update(const QString &room_id, std::vector<QString> users);
+        //! Show the users of that room from now on and pass them on right away.
+        void setVisibleRoom(const QString &room_id);
+        void clear();
+
+signals:
+        //! The typing users of the visible room changed.
+        void typingUsersChanged(QString room_id, std::vector<QString> users);
+
+private:
+        void flush();
+
+        QHash<QString, std::vector<QString>> rooms_;
+        QString visibleRoom_;
+        //! Whether the visible room changed, since it was passed on.
+        bool pending_ = false;
+        QTimer timer_;
+};
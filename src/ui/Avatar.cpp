@@ -1,7 +1,7 @@
 #include <QPainter>
-#include <QSettings>
 
 #include "AvatarProvider.h"
+#include "UserSettingsPage.h"
 #include "Utils.h"
 #include "ui/Avatar.h"
 
@@ -101,7 +101,7 @@ Avatar::setImage(const QString &room, const QString &user)
 void
 Avatar::paintEvent(QPaintEvent *)
 {
-        bool rounded = QSettings().value("user/avatar_circles", true).toBool();
+        bool rounded = UserSettings::snapshot()->avatarCircles;
 
         QPainter painter(this);
         painter.setRenderHint(QPainter::Antialiasing);
@@ -5,6 +5,7 @@
 #include <QLocale>
 #include <QPainter>
 #include <QPen>
+#include <QRegularExpression>
 #include <QtGlobal>
 
 constexpr int VPadding = 6;
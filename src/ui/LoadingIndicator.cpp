@@ -4,6 +4,8 @@
 #include <QPainter>
 #include <QTimer>
 
+#include "Wakeups.h"
+
 LoadingIndicator::LoadingIndicator(QWidget *parent)
   : QWidget(parent)
   , interval_(70)
@@ -15,6 +17,7 @@ LoadingIndicator::LoadingIndicator(QWidget *parent)
 
         timer_ = new QTimer(this);
         connect(timer_, SIGNAL(timeout()), this, SLOT(onTimeout()));
+        wakeups::manage(timer_, "loading indicator");
 }
 
 void
@@ -22,7 +25,7 @@ LoadingIndicator::paintEvent(QPaintEvent *e)
 {
         Q_UNUSED(e)
 
-        if (!timer_->isActive())
+        if (!running_)
                 return;
 
         QPainter painter(this);
@@ -55,11 +58,26 @@ LoadingIndicator::paintEvent(QPaintEvent *e)
 
                 painter.restore();
         }
+
+        if (progress_ >= 0) {
+                QPen pen(color_);
+                pen.setWidth(2);
+                painter.setPen(pen);
+                painter.setBrush(Qt::NoBrush);
+
+                // Qt measures the arcs in 1/16 degrees, counterclockwise from 3 o'clock.
+                const QRect ring(rect().center().x() - width / 2 + 1,
+                                 rect().center().y() - width / 2 + 1,
+                                 width - 2,
+                                 width - 2);
+                painter.drawArc(ring, 90 * 16, -static_cast<int>(qMin(progress_, 1.0) * 360 * 16));
+        }
 }
 
 void
 LoadingIndicator::start()
 {
+        running_ = true;
         timer_->start(interval_);
         show();
 }
@@ -67,10 +85,29 @@ LoadingIndicator::start()
 void
 LoadingIndicator::stop()
 {
+        running_ = false;
         timer_->stop();
         hide();
 }
 
+void
+LoadingIndicator::showEvent(QShowEvent *event)
+{
+        QWidget::showEvent(event);
+
+        if (running_ && !timer_->isActive())
+                timer_->start(interval_);
+}
+
+void
+LoadingIndicator::hideEvent(QHideEvent *event)
+{
+        QWidget::hideEvent(event);
+
+        // Also hidden along with the window, which nobody sees spinning.
+        timer_->stop();
+}
+
 void
 LoadingIndicator::onTimeout()
 {
@@ -15,6 +15,8 @@ public:
         LoadingIndicator(QWidget *parent = nullptr);
 
         void paintEvent(QPaintEvent *e) override;
+        void showEvent(QShowEvent *event) override;
+        void hideEvent(QHideEvent *event) override;
 
         void start();
         void stop();
@@ -25,12 +27,23 @@ public:
         int interval() { return interval_; }
         void setInterval(int interval) { interval_ = interval; }
 
+        //! Draw a ring, which fills up to progress, between 0 and 1, around the spinner. A
+        //! negative progress hides it.
+        void setProgress(qreal progress)
+        {
+                progress_ = progress;
+                update();
+        }
+
 private slots:
         void onTimeout();
 
 private:
         int interval_;
         int angle_;
+        //! Whether it was started. The timer only runs, while it is visible.
+        bool running_ = false;
+        qreal progress_ = -1;
 
         QColor color_;
         QTimer *timer_;
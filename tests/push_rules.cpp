@@ -0,0 +1,313 @@
+#include <gtest/gtest.h>
+
+#include <QDir>
+
+#include <mtx/events/collections.hpp>
+#include <mtx/pushrules.hpp>
+#include <nlohmann/json.hpp>
+
+#include "Logging.h"
+#include "PushRuleEvaluator.h"
+
+using nlohmann::json;
+
+namespace {
+constexpr auto MUTED_ROOM = "!muted:example.org";
+constexpr auto OTHER_ROOM = "!other:example.org";
+constexpr auto ALICE      = "@alice:example.org";
+constexpr auto CAROL      = "@carol:example.org";
+
+//! A message, as the timeline of a sync contains it, without its room id.
+mtx::events::collections::TimelineEvents
+message(const std::string &body, const std::string &sender = ALICE)
+{
+        const json content = {{"msgtype", "m.text"}, {"body", body}};
+
+        mtx::events::collections::TimelineEvent event;
+        mtx::events::collections::from_json(json{{"type", "m.room.message"},
+                                                 {"event_id", "$event:example.org"},
+                                                 {"sender", sender},
+                                                 {"origin_server_ts", 1600000000000},
+                                                 {"content", content}},
+                                            event);
+        return event.data;
+}
+
+//! A rule, which matches every message.
+json
+messageRule(const std::string &rule_id, const json &actions)
+{
+        return {{"rule_id", rule_id},
+                {"default", false},
+                {"enabled", true},
+                {"conditions",
+                 {{{"kind", "event_match"}, {"key", "type"}, {"pattern", "m.room.message"}}}},
+                {"actions", actions}};
+}
+
+//! The actions, which notify and set the highlight tweak.
+json
+highlight(bool value = true)
+{
+        return json::array({"notify", {{"set_tweak", "highlight"}, {"value", value}}});
+}
+
+//! The underride rules, which notify every message.
+json
+notifyMessages()
+{
+        return json::array({messageRule(".m.rule.message", {"notify"})});
+}
+
+//! The rules of the given kinds, the other kinds have none.
+mtx::pushrules::GlobalRuleset
+rules(json global)
+{
+        for (const auto kind : {"override", "content", "room", "sender", "underride"})
+                if (!global.contains(kind))
+                        global[kind] = json::array();
+
+        return json{{"global", global}}.get<mtx::pushrules::GlobalRuleset>();
+}
+
+//! The rules, which notify every message, with the given override and room rules.
+mtx::pushrules::GlobalRuleset
+ruleset(const json &override_, const json &room)
+{
+        return rules({{"override", override_}, {"room", room}, {"underride", notifyMessages()}});
+}
+
+//! A content rule with the given glob, which highlights the message.
+mtx::pushrules::GlobalRuleset
+contentRule(const std::string &pattern)
+{
+        return rules({{"content",
+                       {{{"rule_id", pattern},
+                         {"default", false},
+                         {"enabled", true},
+                         {"pattern", pattern},
+                         {"actions", highlight()}}}}});
+}
+
+//! A rule, which notifies rooms with the given number of members.
+mtx::pushrules::GlobalRuleset
+memberCountRule(const std::string &is)
+{
+        return rules(
+          {{"override",
+            {{{"rule_id", ".m.rule.member_count"},
+              {"default", false},
+              {"enabled", true},
+              {"conditions", {{{"kind", "room_member_count"}, {"is", is}}}},
+              {"actions", {"notify"}}}}}});
+}
+
+//! A rule of the given kind, which matches a message of Alice in the muted room, whose body
+//! contains cake.
+json
+matchingRule(const std::string &kind, const json &actions)
+{
+        if (kind == "content")
+                return {{"rule_id", "cake"},
+                        {"default", false},
+                        {"enabled", true},
+                        {"pattern", "cake"},
+                        {"actions", actions}};
+        if (kind == "room" || kind == "sender")
+                return {{"rule_id", kind == "room" ? MUTED_ROOM : ALICE},
+                        {"default", false},
+                        {"enabled", true},
+                        {"actions", actions}};
+
+        return messageRule(".test." + kind, actions);
+}
+
+PushRuleEvaluator::Room
+room(const std::string &id)
+{
+        return PushRuleEvaluator::Room{id, "Bob", 3};
+}
+}
+
+TEST(PushRules, RoomRuleMutesTheRoom)
+{
+        const json mute = {{"rule_id", MUTED_ROOM},
+                           {"default", false},
+                           {"enabled", true},
+                           {"actions", {"dont_notify"}}};
+        const PushRuleEvaluator evaluator(ruleset(json::array(), json::array({mute})));
+
+        EXPECT_FALSE(evaluator.evaluate(message("hello"), room(MUTED_ROOM)).notify);
+        EXPECT_TRUE(evaluator.evaluate(message("hello"), room(OTHER_ROOM)).notify);
+}
+
+TEST(PushRules, OverrideRuleMutesTheRoom)
+{
+        const json mute = {
+          {"rule_id", MUTED_ROOM},
+          {"default", false},
+          {"enabled", true},
+          {"conditions",
+           {{{"kind", "event_match"}, {"key", "room_id"}, {"pattern", MUTED_ROOM}}}},
+          {"actions", json::array()}};
+        const PushRuleEvaluator evaluator(ruleset(json::array({mute}), json::array()));
+
+        EXPECT_FALSE(evaluator.evaluate(message("hello"), room(MUTED_ROOM)).notify);
+        EXPECT_TRUE(evaluator.evaluate(message("hello"), room(OTHER_ROOM)).notify);
+}
+
+TEST(PushRules, ContentRuleMatchesWholeWords)
+{
+        const PushRuleEvaluator evaluator(contentRule("cake"));
+
+        EXPECT_TRUE(evaluator.evaluate(message("cake"), room(OTHER_ROOM)).highlight);
+        EXPECT_TRUE(evaluator.evaluate(message("I want Cake!"), room(OTHER_ROOM)).highlight);
+        EXPECT_FALSE(evaluator.evaluate(message("pancakes"), room(OTHER_ROOM)).notify);
+        EXPECT_FALSE(evaluator.evaluate(message("cakes"), room(OTHER_ROOM)).notify);
+}
+
+TEST(PushRules, ContentRuleGlobs)
+{
+        const PushRuleEvaluator star(contentRule("cake*lie"));
+        EXPECT_TRUE(star.evaluate(message("the cake is a lie"), room(OTHER_ROOM)).highlight);
+        EXPECT_TRUE(star.evaluate(message("cakelie"), room(OTHER_ROOM)).highlight);
+        EXPECT_FALSE(star.evaluate(message("the cake is a lies"), room(OTHER_ROOM)).notify);
+
+        const PushRuleEvaluator question(contentRule("b?b"));
+        EXPECT_TRUE(question.evaluate(message("hi bob!"), room(OTHER_ROOM)).highlight);
+        EXPECT_FALSE(question.evaluate(message("hi bb"), room(OTHER_ROOM)).notify);
+        EXPECT_FALSE(question.evaluate(message("bobby"), room(OTHER_ROOM)).notify);
+}
+
+TEST(PushRules, ContainsDisplayName)
+{
+        const json mention = {
+          {"rule_id", ".m.rule.contains_display_name"},
+          {"default", true},
+          {"enabled", true},
+          {"conditions", {{{"kind", "contains_display_name"}}}},
+          {"actions", highlight()}};
+        const PushRuleEvaluator evaluator(rules({{"override", json::array({mention})}}));
+
+        EXPECT_TRUE(evaluator.evaluate(message("hi bob!"), room(OTHER_ROOM)).highlight);
+        EXPECT_TRUE(evaluator.evaluate(message("Bob: hi"), room(OTHER_ROOM)).highlight);
+        EXPECT_FALSE(evaluator.evaluate(message("hi bobby"), room(OTHER_ROOM)).notify);
+
+        auto unnamed        = room(OTHER_ROOM);
+        unnamed.displayName = "";
+        EXPECT_FALSE(evaluator.evaluate(message("hi bob"), unnamed).notify);
+}
+
+TEST(PushRules, RoomMemberCount)
+{
+        auto members = [](int count) {
+                auto r        = room(OTHER_ROOM);
+                r.memberCount = count;
+                return r;
+        };
+
+        const PushRuleEvaluator two(memberCountRule("2"));
+        EXPECT_TRUE(two.evaluate(message("hello"), members(2)).notify);
+        EXPECT_FALSE(two.evaluate(message("hello"), members(3)).notify);
+
+        const PushRuleEvaluator equal(memberCountRule("==2"));
+        EXPECT_TRUE(equal.evaluate(message("hello"), members(2)).notify);
+        EXPECT_FALSE(equal.evaluate(message("hello"), members(1)).notify);
+
+        const PushRuleEvaluator atLeast(memberCountRule(">=10"));
+        EXPECT_TRUE(atLeast.evaluate(message("hello"), members(10)).notify);
+        EXPECT_TRUE(atLeast.evaluate(message("hello"), members(11)).notify);
+        EXPECT_FALSE(atLeast.evaluate(message("hello"), members(9)).notify);
+
+        const PushRuleEvaluator less(memberCountRule("<5"));
+        EXPECT_TRUE(less.evaluate(message("hello"), members(4)).notify);
+        EXPECT_FALSE(less.evaluate(message("hello"), members(5)).notify);
+}
+
+TEST(PushRules, SenderRuleMutesTheSender)
+{
+        const json mute = {
+          {"rule_id", ALICE}, {"default", false}, {"enabled", true}, {"actions", {"dont_notify"}}};
+        const PushRuleEvaluator evaluator(
+          rules({{"sender", json::array({mute})}, {"underride", notifyMessages()}}));
+
+        EXPECT_FALSE(evaluator.evaluate(message("hello", ALICE), room(OTHER_ROOM)).notify);
+        EXPECT_TRUE(evaluator.evaluate(message("hello", CAROL), room(OTHER_ROOM)).notify);
+}
+
+TEST(PushRules, HighlightTweak)
+{
+        const PushRuleEvaluator highlighted(
+          rules({{"override", json::array({messageRule(".test", highlight())})}}));
+        EXPECT_TRUE(highlighted.evaluate(message("hello"), room(OTHER_ROOM)).highlight);
+
+        const PushRuleEvaluator plain(
+          rules({{"override", json::array({messageRule(".test", highlight(false))})}}));
+        const auto actions = plain.evaluate(message("hello"), room(OTHER_ROOM));
+        EXPECT_TRUE(actions.notify);
+        EXPECT_FALSE(actions.highlight);
+}
+
+TEST(PushRules, DisabledRulesAreSkipped)
+{
+        auto mute       = messageRule(".test.mute", {"dont_notify"});
+        mute["enabled"] = false;
+        const PushRuleEvaluator evaluator(
+          rules({{"override", json::array({mute})}, {"underride", notifyMessages()}}));
+
+        EXPECT_TRUE(evaluator.evaluate(message("hello"), room(MUTED_ROOM)).notify);
+}
+
+TEST(PushRules, KindsAreEvaluatedInOrder)
+{
+        const std::vector<std::string> kinds = {
+          "override", "content", "room", "sender", "underride"};
+        const json mute = {"dont_notify"};
+
+        // Every rule matches, so the kind evaluated first decides the actions.
+        for (std::size_t i = 0; i + 1 < kinds.size(); i++) {
+                const auto &first = kinds[i], &second = kinds[i + 1];
+                SCOPED_TRACE(first + " before " + second);
+
+                const PushRuleEvaluator muted(
+                  rules({{first, json::array({matchingRule(first, mute)})},
+                         {second, json::array({matchingRule(second, highlight())})}}));
+                EXPECT_FALSE(muted.evaluate(message("a cake"), room(MUTED_ROOM)).notify);
+
+                const PushRuleEvaluator highlighted(
+                  rules({{first, json::array({matchingRule(first, highlight())})},
+                         {second, json::array({matchingRule(second, mute)})}}));
+                EXPECT_TRUE(highlighted.evaluate(message("a cake"), room(MUTED_ROOM)).highlight);
+        }
+}
+
+TEST(PushRules, SenderNotificationPermission)
+{
+        const json roomNotification = {
+          {"rule_id", ".m.rule.roomnotif"},
+          {"default", true},
+          {"enabled", true},
+          {"conditions",
+           {{{"kind", "event_match"}, {"key", "content.body"}, {"pattern", "@room"}},
+            {{"kind", "sender_notification_permission"}, {"key", "room"}}}},
+          {"actions", highlight()}};
+        const PushRuleEvaluator evaluator(rules({{"override", json::array({roomNotification})}}));
+
+        auto context                  = room(OTHER_ROOM);
+        context.roomNotificationLevel = 50;
+
+        context.senderPowerLevel = 0;
+        EXPECT_FALSE(evaluator.evaluate(message("@room hi"), context).notify);
+
+        context.senderPowerLevel = 50;
+        EXPECT_TRUE(evaluator.evaluate(message("@room hi"), context).highlight);
+}
+
+int
+main(int argc, char **argv)
+{
+        nhlog::init(QDir::temp().filePath("nheko-tests.log").toStdString());
+
+        ::testing::InitGoogleTest(&argc, argv);
+        return RUN_ALL_TESTS();
+}
@@ -227,23 +227,88 @@ decodeAC(std::string_view value, float maximumValue)
         return decodeAC(decode83(value), maximumValue);
 }
 
+//! The image in linear RGB with one plane per channel, so a row of a channel is contiguous.
+struct LinearImage
+{
+        size_t width, height;
+        std::vector<float> r, g, b;
+};
+
+LinearImage
+toLinear(const unsigned char *pixels, size_t width, size_t height)
+{
+        // Every pixel would otherwise call pow for every component.
+        static const auto table = [] {
+                std::array<float, 256> t{};
+                for (int i = 0; i < 256; i++)
+                        t[i] = srgbToLinear(i);
+                return t;
+        }();
+
+        LinearImage image{width, height, {}, {}, {}};
+        image.r.resize(width * height);
+        image.g.resize(width * height);
+        image.b.resize(width * height);
+
+        for (size_t i = 0; i < width * height; i++) {
+                image.r[i] = table[pixels[3 * i + 0]];
+                image.g[i] = table[pixels[3 * i + 1]];
+                image.b[i] = table[pixels[3 * i + 2]];
+        }
+
+        return image;
+}
+
+//! cos(pi * component * i / size) for every position i.
+std::vector<float>
+basisTable(int component, size_t size)
+{
+        std::vector<float> table(size);
+        for (size_t i = 0; i < size; i++)
+                table[i] = std::cos(M_PI * component * i / float(size));
+        return table;
+}
+
+//! The dot product of a row of a channel with the basis function. It sums into independent
+//! lanes, which the compiler can map to SIMD registers without reordering a single sum.
+float
+dotRow(const float *values, const float *basis, size_t width)
+{
+        constexpr size_t LANES = 8;
+
+        std::array<float, LANES> lanes{};
+        size_t x = 0;
+        for (; x + LANES <= width; x += LANES)
+                for (size_t l = 0; l < LANES; l++)
+                        lanes[l] += values[x + l] * basis[x + l];
+
+        float sum = 0;
+        for (; x < width; x++)
+                sum += values[x] * basis[x];
+        for (auto lane : lanes)
+                sum += lane;
+
+        return sum;
+}
+
 Color
-multiplyBasisFunction(Components components, int width, int height, unsigned char *pixels)
+multiplyBasisFunction(Components components,
+                      const LinearImage &image,
+                      const std::vector<float> &basisX,
+                      const std::vector<float> &basisY)
 {
         Color c{};
         float normalisation = (components.x == 0 && components.y == 0) ? 1 : 2;
 
-        for (int y = 0; y < height; y++) {
-                for (int x = 0; x < width; x++) {
-                        float basis = std::cos(M_PI * components.x * x / float(width)) *
-                                      std::cos(M_PI * components.y * y / float(height));
-                        c.r += basis * srgbToLinear(pixels[3 * x + 0 + y * width * 3]);
-                        c.g += basis * srgbToLinear(pixels[3 * x + 1 + y * width * 3]);
-                        c.b += basis * srgbToLinear(pixels[3 * x + 2 + y * width * 3]);
-                }
+        // The basis function is separable, so every row is summed with the horizontal part first.
+        for (size_t y = 0; y < image.height; y++) {
+                const auto row = y * image.width;
+                c.r += basisY[y] * dotRow(&image.r[row], basisX.data(), image.width);
+                c.g += basisY[y] * dotRow(&image.g[row], basisX.data(), image.width);
+                c.b += basisY[y] * dotRow(&image.b[row], basisX.data(), image.width);
         }
 
-        float scale = normalisation / (width * height);
+        float scale = normalisation / (image.width * image.height);
         c *= scale;
         return c;
 }
@@ -277,24 +342,40 @@ decode(std::string_view blurhash, size_t width, size_t height, size_t bytesPerPi
                 return {};
         }
 
-        i.image.reserve(height * width * 3);
+        i.image.reserve(height * width * bytesPerPixel);
 
-        for (size_t y = 0; y < height; y++) {
-                for (size_t x = 0; x < width; x++) {
-                        Color c{};
+        std::vector<std::vector<float>> basisX, basisY;
+        for (int nx = 0; nx < components.x; nx++)
+                basisX.push_back(basisTable(nx, width));
+        for (int ny = 0; ny < components.y; ny++)
+                basisY.push_back(basisTable(ny, height));
 
-                        for (size_t nx = 0; nx < size_t(components.x); nx++) {
-                                for (size_t ny = 0; ny < size_t(components.y); ny++) {
-                                        float basis =
-                                          std::cos(M_PI * float(x) * float(nx) / float(width)) *
-                                          std::cos(M_PI * float(y) * float(ny) / float(height));
-                                        c += values[nx + ny * components.x] * basis;
-                                }
+        // The basis is separable, so the vertical part is applied once per row. The horizontal
+        // part then adds each component to whole rows of a channel, which the compiler can
+        // vectorize.
+        std::vector<float> r(width), g(width), b(width);
+        for (size_t y = 0; y < height; y++) {
+                std::fill(r.begin(), r.end(), 0.f);
+                std::fill(g.begin(), g.end(), 0.f);
+                std::fill(b.begin(), b.end(), 0.f);
+
+                for (int nx = 0; nx < components.x; nx++) {
+                        Color row{};
+                        for (int ny = 0; ny < components.y; ny++)
+                                row += values[nx + ny * components.x] * basisY[ny][y];
+
+                        const auto &basis = basisX[nx];
+                        for (size_t x = 0; x < width; x++) {
+                                r[x] += row.r * basis[x];
+                                g[x] += row.g * basis[x];
+                                b[x] += row.b * basis[x];
                         }
+                }
 
-                        i.image.push_back(static_cast<unsigned char>(linearToSrgb(c.r)));
-                        i.image.push_back(static_cast<unsigned char>(linearToSrgb(c.g)));
-                        i.image.push_back(static_cast<unsigned char>(linearToSrgb(c.b)));
+                for (size_t x = 0; x < width; x++) {
+                        i.image.push_back(static_cast<unsigned char>(linearToSrgb(r[x])));
+                        i.image.push_back(static_cast<unsigned char>(linearToSrgb(g[x])));
+                        i.image.push_back(static_cast<unsigned char>(linearToSrgb(b[x])));
 
                         for (size_t p = 3; p < bytesPerPixel; p++)
                                 i.image.push_back(255);
@@ -314,11 +395,20 @@ encode(unsigned char *image, size_t width, size_t height, int components_x, int
             components_y > 9 || !image)
                 return "";
 
+        const auto linear = toLinear(image, width, height);
+
+        std::vector<std::vector<float>> basisX, basisY;
+        for (int x = 0; x < components_x; x++)
+                basisX.push_back(basisTable(x, width));
+        for (int y = 0; y < components_y; y++)
+                basisY.push_back(basisTable(y, height));
+
         std::vector<Color> factors;
         factors.reserve(components_x * components_y);
         for (int y = 0; y < components_y; y++) {
                 for (int x = 0; x < components_x; x++) {
-                        factors.push_back(multiplyBasisFunction({x, y}, width, height, image));
+                        factors.push_back(
+                          multiplyBasisFunction({x, y}, linear, basisX[x], basisY[y]));
                 }
         }
 
@@ -361,6 +451,8 @@ encode(unsigned char *image, size_t width, size_t height, int components_x, int
 }
 
 #ifdef DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+#include <chrono>
+
 TEST_CASE("component packing")
 {
         for (int i = 0; i < 9 * 9; i++)
@@ -472,4 +564,96 @@ TEST_CASE("encode")
         CHECK(blurhash::encode(black.data(), 360, 200, 4, 0) == "");
         CHECK(blurhash::encode(black.data(), 360, 200, 4, 3) == "L00000fQfQfQfQfQfQfQfQfQfQfQ");
 }
+
+namespace {
+//! The straightforward encoder, which evaluates the basis function for every pixel.
+std::string
+referenceEncode(unsigned char *pixels, int width, int height, int components_x, int components_y)
+{
+        std::vector<Color> factors;
+        for (int cy = 0; cy < components_y; cy++) {
+                for (int cx = 0; cx < components_x; cx++) {
+                        Color c{};
+                        for (int y = 0; y < height; y++) {
+                                for (int x = 0; x < width; x++) {
+                                        float basis = std::cos(M_PI * cx * x / float(width)) *
+                                                      std::cos(M_PI * cy * y / float(height));
+                                        auto p = &pixels[3 * (x + y * width)];
+                                        c.r += basis * srgbToLinear(p[0]);
+                                        c.g += basis * srgbToLinear(p[1]);
+                                        c.b += basis * srgbToLinear(p[2]);
+                                }
+                        }
+                        c *= ((cx == 0 && cy == 0) ? 1 : 2) / float(width * height);
+                        factors.push_back(c);
+                }
+        }
+
+        auto dc = factors.front();
+        factors.erase(factors.begin());
+
+        float actualMaximumValue = 0;
+        for (auto ac : factors)
+                actualMaximumValue =
+                  std::max({std::abs(ac.r), std::abs(ac.g), std::abs(ac.b), actualMaximumValue});
+
+        int quantisedMaximumValue = encodeMaxAC(actualMaximumValue);
+        float maximumValue        = ((float)quantisedMaximumValue + 1) / 166;
+
+        std::string h = leftPad(encode83(packComponents({components_x, components_y})), 1);
+        h += leftPad(encode83(quantisedMaximumValue), 1);
+        h += leftPad(encode83(encodeDC(dc)), 4);
+        for (auto ac : factors)
+                h += leftPad(encode83(encodeAC(ac, maximumValue)), 2);
+        return h;
+}
+
+std::vector<unsigned char>
+gradient(int width, int height)
+{
+        std::vector<unsigned char> pixels;
+        for (int y = 0; y < height; y++) {
+                for (int x = 0; x < width; x++) {
+                        pixels.push_back(static_cast<unsigned char>(255 * x / width));
+                        pixels.push_back(static_cast<unsigned char>(255 * y / height));
+                        pixels.push_back(static_cast<unsigned char>((x * y) % 256));
+                }
+        }
+        return pixels;
+}
+}
+
+TEST_CASE("encode matches the reference encoder")
+{
+        for (auto [width, height] : {std::pair{32, 32}, {33, 17}, {360, 200}}) {
+                auto pixels = gradient(width, height);
+                CHECK(blurhash::encode(pixels.data(), width, height, 4, 3) ==
+                      referenceEncode(pixels.data(), width, height, 4, 3));
+        }
+}
+
+TEST_CASE("encode benchmark")
+{
+        auto pixels = gradient(360, 200);
+
+        auto time = [](auto &&f) {
+                auto start = std::chrono::steady_clock::now();
+                for (int i = 0; i < 10; i++)
+                        f();
+                return std::chrono::duration_cast<std::chrono::microseconds>(
+                         std::chrono::steady_clock::now() - start)
+                         .count() /
+                       10;
+        };
+
+        auto reference = time([&] { referenceEncode(pixels.data(), 360, 200, 4, 3); });
+        auto separable = time([&] { blurhash::encode(pixels.data(), 360, 200, 4, 3); });
+
+        auto small     = gradient(32, 32);
+        auto thumbnail = time([&] { blurhash::encode(small.data(), 32, 32, 4, 3); });
+
+        MESSAGE("360x200 reference: " << reference << " us, separable: " << separable
+                                      << " us, 32x32 separable: " << thumbnail << " us");
+        CHECK(separable <= reference);
+}
 #endif